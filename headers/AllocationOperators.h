@@ -134,6 +134,129 @@ inline void* aligned_alloc_q (const pointer_uint_q uSize, const QAlignment& alig
     #endif
 #endif
 
+#if QE_CONFIG_ALLOCATIONBACKEND_DEFAULT == QE_CONFIG_ALLOCATIONBACKEND_SIZECLASS
+    #include "QSizeClassAllocator.h"
+
+    using Kinesis::QuimeraEngine::Common::Memory::QSizeClassAllocator;
+#endif
+
+/// <summary>
+/// Allocates a memory block using the allocation backend selected in the configuration.
+/// </summary>
+/// <param name="uSize">[IN] Size (in bytes) of the memory block to be allocated. It must be greater than zero.</param>
+/// <returns>
+/// A memory block of the specified size. It is null if no memory could be allocated.
+/// </returns>
+inline void* backend_alloc_q(const pointer_uint_q uSize)
+{
+#if QE_CONFIG_ALLOCATIONBACKEND_DEFAULT == QE_CONFIG_ALLOCATIONBACKEND_SIZECLASS
+    return QSizeClassAllocator::Get()->Allocate(uSize);
+#else
+    return malloc(uSize);
+#endif
+}
+
+/// <summary>
+/// Frees a memory block using the allocation backend selected in the configuration.
+/// </summary>
+/// <param name="pMemoryBlock">[IN] Pointer to the memory block to be deallocated. It must have been allocated using backend_alloc_q. It may be null.</param>
+inline void backend_free_q(void* pMemoryBlock)
+{
+#if QE_CONFIG_ALLOCATIONBACKEND_DEFAULT == QE_CONFIG_ALLOCATIONBACKEND_SIZECLASS
+    QSizeClassAllocator::Get()->Deallocate(pMemoryBlock);
+#else
+    free(pMemoryBlock);
+#endif
+}
+
+/// <summary>
+/// Allocates an aligned memory block using the allocation backend selected in the configuration.
+/// </summary>
+/// <param name="uSize">[IN] Size (in bytes) of the memory block to be allocated. It must be greater than zero.</param>
+/// <param name="alignment">[IN] The data alignment value (must be always a power of two).</param>
+/// <returns>
+/// An aligned memory block of the specified size. It is null if no memory could be allocated.
+/// </returns>
+inline void* backend_aligned_alloc_q(const pointer_uint_q uSize, const QAlignment& alignment)
+{
+#if QE_CONFIG_ALLOCATIONBACKEND_DEFAULT == QE_CONFIG_ALLOCATIONBACKEND_SIZECLASS
+    return QSizeClassAllocator::Get()->Allocate(uSize, alignment);
+#else
+    return aligned_alloc_q(uSize, alignment);
+#endif
+}
+
+/// <summary>
+/// Frees an aligned memory block using the allocation backend selected in the configuration.
+/// </summary>
+/// <param name="pMemoryBlock">[IN] Pointer to the aligned memory block to be deallocated. It must have been allocated using backend_aligned_alloc_q.</param>
+/// <param name="alignment">[IN] The data alignment value used when the memory block was allocated.</param>
+inline void backend_aligned_free_q(void* pMemoryBlock, const QAlignment& alignment)
+{
+#if QE_CONFIG_ALLOCATIONBACKEND_DEFAULT == QE_CONFIG_ALLOCATIONBACKEND_SIZECLASS
+    QSizeClassAllocator::Get()->Deallocate(pMemoryBlock, alignment);
+#else
+    aligned_free_q(pMemoryBlock);
+#endif
+}
+
+/// <summary>
+/// Allocates a memory block using the allocation backend and notifies the allocation tracker.
+/// </summary>
+/// <remarks>
+/// The block is preceded by a header that stores its size and tag.<br/>
+/// The global operators use it when the allocation tracking is enabled in the configuration; it is always available, though.
+/// </remarks>
+/// <param name="uSize">[IN] Size (in bytes) of the memory block to be allocated. It must be greater than zero.</param>
+/// <returns>
+/// A memory block of the specified size. It is null if no memory could be allocated.
+/// </returns>
+QE_LAYER_COMMON_SYMBOLS void* tracked_alloc_q(const pointer_uint_q uSize);
+
+/// <summary>
+/// Frees a memory block allocated using tracked_alloc_q and notifies the allocation tracker.
+/// </summary>
+/// <param name="pMemoryBlock">[IN] Pointer to the memory block to be deallocated. It may be null.</param>
+QE_LAYER_COMMON_SYMBOLS void tracked_free_q(void* pMemoryBlock);
+
+/// <summary>
+/// Allocates an aligned memory block using the allocation backend and notifies the allocation tracker.
+/// </summary>
+/// <remarks>
+/// The block is preceded by a header that stores its size and tag, padded to keep the alignment.
+/// </remarks>
+/// <param name="uSize">[IN] Size (in bytes) of the memory block to be allocated. It must be greater than zero.</param>
+/// <param name="alignment">[IN] The data alignment value (must be always a power of two).</param>
+/// <returns>
+/// An aligned memory block of the specified size. It is null if no memory could be allocated.
+/// </returns>
+QE_LAYER_COMMON_SYMBOLS void* tracked_aligned_alloc_q(const pointer_uint_q uSize, const QAlignment& alignment);
+
+/// <summary>
+/// Frees an aligned memory block allocated using tracked_aligned_alloc_q and notifies the allocation tracker.
+/// </summary>
+/// <param name="pMemoryBlock">[IN] Pointer to the aligned memory block to be deallocated. It may be null.</param>
+/// <param name="alignment">[IN] The data alignment value used when the memory block was allocated.</param>
+QE_LAYER_COMMON_SYMBOLS void tracked_aligned_free_q(void* pMemoryBlock, const QAlignment& alignment);
+
+#if QE_CONFIG_ALLOCATIONTRACKING_DEFAULT == QE_CONFIG_ALLOCATIONTRACKING_ENABLED
+
+    // The global operators notify every allocation to the allocation tracker
+    #define operator_alloc_q(uSize)                               tracked_alloc_q(uSize)
+    #define operator_free_q(pMemoryBlock)                         tracked_free_q(pMemoryBlock)
+    #define operator_aligned_alloc_q(uSize, alignment)            tracked_aligned_alloc_q(uSize, alignment)
+    #define operator_aligned_free_q(pMemoryBlock, alignment)      tracked_aligned_free_q(pMemoryBlock, alignment)
+
+#else
+
+    // The global operators use the allocation backend directly, so there is no overhead
+    #define operator_alloc_q(uSize)                               backend_alloc_q(uSize)
+    #define operator_free_q(pMemoryBlock)                         backend_free_q(pMemoryBlock)
+    #define operator_aligned_alloc_q(uSize, alignment)            backend_aligned_alloc_q(uSize, alignment)
+    #define operator_aligned_free_q(pMemoryBlock, alignment)      backend_aligned_free_q(pMemoryBlock, alignment)
+
+#endif
+
 /// <summary>
 /// Allocates a memory block. Overrides the global new operator provided by the CRT libraries.
 /// </summary>
@@ -149,7 +272,7 @@ void* operator new (const size_t uSize) throw(std::bad_alloc)
 {
     QE_ASSERT_ERROR(uSize != 0, "The size of the block to allocate must be greater than zero");
 
-    void* p = malloc(uSize);
+    void* p = operator_alloc_q(uSize);
 
     QE_ASSERT_ERROR(p != null_q, "Fatal error: No memory could be allocated");
 
@@ -175,7 +298,7 @@ void* operator new (const size_t uSize, const std::nothrow_t& nothrow_value) thr
 {
     QE_ASSERT_ERROR(uSize != 0, "The size of the block to allocate must be greater than zero");
 
-    void* p = malloc(uSize);
+    void* p = operator_alloc_q(uSize);
 
     QE_ASSERT_ERROR(p != null_q, "Fatal error: No memory could be allocated");
 
@@ -200,7 +323,7 @@ void* operator new[] (const size_t uSize) throw(std::bad_alloc)
 {
     QE_ASSERT_ERROR(uSize != 0, "The size of the block to allocate must be greater than zero");
 
-    void* p = malloc(uSize);
+    void* p = operator_alloc_q(uSize);
 
     QE_ASSERT_ERROR(p != null_q, "Fatal error: No memory could be allocated");
 
@@ -226,7 +349,7 @@ void* operator new[] (const size_t uSize, const std::nothrow_t& nothrow_value) t
 {
     QE_ASSERT_ERROR(uSize != 0, "The size of the block to allocate must be greater than zero");
 
-    void* p = malloc(uSize);
+    void* p = operator_alloc_q(uSize);
 
     QE_ASSERT_ERROR(p != null_q, "Fatal error: No memory could be allocated");
 
@@ -246,7 +369,7 @@ inline
 void operator delete (void* pMemoryBlock) throw()
 #ifndef QE_PREPROCESSOR_EXPORTLIB_COMMON
 {
-    free(pMemoryBlock);
+    operator_free_q(pMemoryBlock);
 }
 #else
 ;
@@ -263,7 +386,7 @@ inline
 void operator delete (void* pMemoryBlock, const std::nothrow_t& nothrow_constant) throw()
 #ifndef QE_PREPROCESSOR_EXPORTLIB_COMMON
 {
-    free(pMemoryBlock);
+    operator_free_q(pMemoryBlock);
 }
 #else
 ;
@@ -279,7 +402,7 @@ inline
 void operator delete[] (void* pMemoryBlock) throw()
 #ifndef QE_PREPROCESSOR_EXPORTLIB_COMMON
 {
-    free(pMemoryBlock);
+    operator_free_q(pMemoryBlock);
 }
 #else
 ;
@@ -296,7 +419,7 @@ inline
 void operator delete[] (void* pMemoryBlock, const std::nothrow_t& nothrow_constant) throw()
 #ifndef QE_PREPROCESSOR_EXPORTLIB_COMMON
 {
-    free(pMemoryBlock);
+    operator_free_q(pMemoryBlock);
 }
 #else
 ;
@@ -92,6 +92,41 @@ namespace Configuration
 
 #define QE_CONFIG_ASSERTSTRACING_DEFAULT QE_CONFIG_ASSERTSTRACING_ENABLED // [Configurable]
 
+// --------------------------------------------------------------------------------------------------------
+// String hash cache: Specifies whether strings keep their hash once it has been calculated, so it does not
+// have to be calculated again every time the same string is used as a key in a hash table.
+//
+// How to use it: Write a behavior value as the default definition.
+// --------------------------------------------------------------------------------------------------------
+#define QE_CONFIG_STRINGHASHCACHE_DISABLED 0x0
+#define QE_CONFIG_STRINGHASHCACHE_ENABLED  0x1
+
+#define QE_CONFIG_STRINGHASHCACHE_DEFAULT QE_CONFIG_STRINGHASHCACHE_ENABLED // [Configurable]
+
+// --------------------------------------------------------------------------------------------------------
+// Allocation backend: Specifies where the memory requested through the global new and delete operators
+// comes from. It can be the system (malloc and free) or the size-class allocator, which serves small blocks
+// from pools grouped by size and requests bigger blocks to the system.
+//
+// How to use it: Write a backend value as the default definition.
+// --------------------------------------------------------------------------------------------------------
+#define QE_CONFIG_ALLOCATIONBACKEND_SYSTEM    0x0
+#define QE_CONFIG_ALLOCATIONBACKEND_SIZECLASS 0x1
+
+#define QE_CONFIG_ALLOCATIONBACKEND_DEFAULT QE_CONFIG_ALLOCATIONBACKEND_SYSTEM // [Configurable]
+
+// --------------------------------------------------------------------------------------------------------
+// Allocation tracking: Specifies whether the global new and delete operators notify every allocation to
+// the allocation tracker, which keeps statistics per tag (see SQAllocationTracker and QE_ALLOCATION_TAG).
+// When enabled, every block carries a small header with its size and tag.
+//
+// How to use it: Write a behavior value as the default definition.
+// --------------------------------------------------------------------------------------------------------
+#define QE_CONFIG_ALLOCATIONTRACKING_DISABLED 0x0
+#define QE_CONFIG_ALLOCATIONTRACKING_ENABLED  0x1
+
+#define QE_CONFIG_ALLOCATIONTRACKING_DEFAULT QE_CONFIG_ALLOCATIONTRACKING_DISABLED // [Configurable]
+
 
 }//namespace Configuration
 }//namespace Common
@@ -0,0 +1,315 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QALLOCATIONSNAPSHOT__
+#define __QALLOCATIONSNAPSHOT__
+
+#include "DataTypesDefinitions.h"
+#include "CommonDefinitions.h"
+#include "StringsDefinitions.h"
+#include "SQAllocationTracker.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::i64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace Memory
+{
+
+/// <summary>
+/// The statistics of every allocation tag at a given moment, as obtained from SQAllocationTracker.
+/// </summary>
+/// <remarks>
+/// The difference between two snapshots shows what happened between them, for example, the allocations made during a frame.
+/// Snapshots do not use the global operators, so they are not included in the statistics themselves.
+/// </remarks>
+class QE_LAYER_COMMON_SYMBOLS QAllocationSnapshot
+{
+    friend class SQAllocationTracker;
+
+    // INTERNAL CLASSES
+    // -----------------
+protected:
+
+    /// <summary>
+    /// The statistics of a tag.
+    /// </summary>
+    struct QTagStatistics
+    {
+        /// <summary>
+        /// The name of the tag. It is null for the untagged group.
+        /// </summary>
+        const char* m_szName;
+
+        /// <summary>
+        /// The source file where the tag was registered. It is null for the untagged group.
+        /// </summary>
+        const char* m_szFile;
+
+        /// <summary>
+        /// The line of the source file where the tag was registered.
+        /// </summary>
+        int m_nLine;
+
+        /// <summary>
+        /// The bytes allocated and not deallocated yet. It may be negative in the difference between snapshots.
+        /// </summary>
+        i64_q m_nLiveBytes;
+
+        /// <summary>
+        /// The maximum number of live bytes reached since the high-water mark of the tag was enabled. It is zero if it is not enabled.
+        /// </summary>
+        u64_q m_uHighWaterMark;
+
+        /// <summary>
+        /// The number of allocations.
+        /// </summary>
+        u64_q m_uAllocations;
+
+        /// <summary>
+        /// The number of deallocations.
+        /// </summary>
+        u64_q m_uDeallocations;
+
+        /// <summary>
+        /// The sum of the sizes of all the allocations.
+        /// </summary>
+        u64_q m_uAllocatedBytes;
+
+        /// <summary>
+        /// The number of allocations whose size belongs to every interval of the histogram.
+        /// </summary>
+        u64_q m_arHistogram[SQAllocationTracker::HISTOGRAM_BUCKETS_COUNT];
+    };
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor. The snapshot contains no tags.
+    /// </summary>
+    QAllocationSnapshot();
+
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="snapshot">[IN] The snapshot to be copied.</param>
+    QAllocationSnapshot(const QAllocationSnapshot &snapshot);
+
+protected:
+
+    /// <summary>
+    /// Constructor that receives the number of tags. All the statistics are zero.
+    /// </summary>
+    /// <param name="uTagsCount">[IN] The number of tags, including the untagged group.</param>
+    explicit QAllocationSnapshot(const u32_q uTagsCount);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    ~QAllocationSnapshot();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Assignment operator.
+    /// </summary>
+    /// <param name="snapshot">[IN] The snapshot to be copied.</param>
+    /// <returns>
+    /// A reference to the resultant snapshot.
+    /// </returns>
+    QAllocationSnapshot& operator=(const QAllocationSnapshot &snapshot);
+
+    /// <summary>
+    /// Calculates what happened between a previous snapshot and this one.
+    /// </summary>
+    /// <remarks>
+    /// The live bytes, the allocations, the deallocations, the allocated bytes and the histogram are the differences between both snapshots. The 
+    /// high-water mark is the one of this snapshot. Tags registered after the previous snapshot was taken are compared to zero.
+    /// </remarks>
+    /// <param name="previousSnapshot">[IN] A snapshot taken before this one. It must not contain more tags than this one.</param>
+    /// <returns>
+    /// A snapshot that contains the differences.
+    /// </returns>
+    QAllocationSnapshot GetDifference(const QAllocationSnapshot &previousSnapshot) const;
+
+    /// <summary>
+    /// Generates a text that contains the statistics of every tag, one line per tag, in the same order they were registered. Tags with 
+    /// no allocations nor deallocations are omitted.
+    /// </summary>
+    /// <remarks>
+    /// Every line has the following format: "NAME (FILE:LINE): N live bytes, high-water mark N bytes, N allocations, N deallocations, N bytes allocated, 
+    /// sizes [&lt;=16: N, &lt;=32: N, ..., &gt;262144: N]". Empty intervals of the histogram are omitted. The untagged group is named "Untagged" and has no file.
+    /// </remarks>
+    /// <returns>
+    /// The text that describes the statistics of every tag. It is empty if no tag has allocations.
+    /// </returns>
+    Kinesis::QuimeraEngine::Common::DataTypes::string_q ToString() const;
+
+    /// <summary>
+    /// Gets the sum of the live bytes of all the tags.
+    /// </summary>
+    /// <returns>
+    /// The number of bytes allocated and not deallocated yet. It may be negative in the difference between snapshots.
+    /// </returns>
+    i64_q GetTotalLiveBytes() const;
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of tags, including the untagged group, which is always the first one.
+    /// </summary>
+    /// <returns>
+    /// The number of tags.
+    /// </returns>
+    u32_q GetTagsCount() const;
+
+    /// <summary>
+    /// Gets the name of a tag.
+    /// </summary>
+    /// <param name="uTag">[IN] The identifier of the tag. It must be lower than the number of tags.</param>
+    /// <returns>
+    /// The name of the tag. It is null for the untagged group.
+    /// </returns>
+    const char* GetTagName(const u32_q uTag) const;
+
+    /// <summary>
+    /// Gets the source file where a tag was registered.
+    /// </summary>
+    /// <param name="uTag">[IN] The identifier of the tag. It must be lower than the number of tags.</param>
+    /// <returns>
+    /// The path of the file. It is null for the untagged group.
+    /// </returns>
+    const char* GetTagFile(const u32_q uTag) const;
+
+    /// <summary>
+    /// Gets the line of the source file where a tag was registered.
+    /// </summary>
+    /// <param name="uTag">[IN] The identifier of the tag. It must be lower than the number of tags.</param>
+    /// <returns>
+    /// The line. It is zero for the untagged group.
+    /// </returns>
+    int GetTagLine(const u32_q uTag) const;
+
+    /// <summary>
+    /// Gets the bytes of a tag that were allocated and not deallocated yet.
+    /// </summary>
+    /// <param name="uTag">[IN] The identifier of the tag. It must be lower than the number of tags.</param>
+    /// <returns>
+    /// The number of live bytes. It may be negative in the difference between snapshots.
+    /// </returns>
+    i64_q GetLiveBytes(const u32_q uTag) const;
+
+    /// <summary>
+    /// Gets the maximum number of live bytes reached by a tag since its high-water mark was enabled (see SQAllocationTracker::EnableHighWaterMark).
+    /// </summary>
+    /// <param name="uTag">[IN] The identifier of the tag. It must be lower than the number of tags.</param>
+    /// <returns>
+    /// The high-water mark, in bytes. It is zero if the high-water mark of the tag is not enabled.
+    /// </returns>
+    u64_q GetHighWaterMark(const u32_q uTag) const;
+
+    /// <summary>
+    /// Gets the number of allocations of a tag.
+    /// </summary>
+    /// <param name="uTag">[IN] The identifier of the tag. It must be lower than the number of tags.</param>
+    /// <returns>
+    /// The number of allocations.
+    /// </returns>
+    u64_q GetAllocations(const u32_q uTag) const;
+
+    /// <summary>
+    /// Gets the number of deallocations of a tag.
+    /// </summary>
+    /// <param name="uTag">[IN] The identifier of the tag. It must be lower than the number of tags.</param>
+    /// <returns>
+    /// The number of deallocations.
+    /// </returns>
+    u64_q GetDeallocations(const u32_q uTag) const;
+
+    /// <summary>
+    /// Gets the sum of the sizes of all the allocations of a tag.
+    /// </summary>
+    /// <param name="uTag">[IN] The identifier of the tag. It must be lower than the number of tags.</param>
+    /// <returns>
+    /// The number of allocated bytes.
+    /// </returns>
+    u64_q GetAllocatedBytes(const u32_q uTag) const;
+
+    /// <summary>
+    /// Gets the number of allocations of a tag whose size belongs to an interval of the histogram.
+    /// </summary>
+    /// <param name="uTag">[IN] The identifier of the tag. It must be lower than the number of tags.</param>
+    /// <param name="uBucket">[IN] The index of the interval. It must be lower than SQAllocationTracker::HISTOGRAM_BUCKETS_COUNT.</param>
+    /// <returns>
+    /// The number of allocations.
+    /// </returns>
+    u64_q GetHistogramCount(const u32_q uTag, const u32_q uBucket) const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The statistics of every tag.
+    /// </summary>
+    QTagStatistics* m_arTags;
+
+    /// <summary>
+    /// The number of tags.
+    /// </summary>
+    u32_q m_uTagsCount;
+
+};
+
+} //namespace Memory
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QALLOCATIONSNAPSHOT__
@@ -29,6 +29,7 @@
 
 #include "ToolsDefinitions.h"
 #include "QArrayFixed.h"
+#include "SQGeometricGrowthPolicy.h"
 #include <cstring>
 
 
@@ -55,7 +56,9 @@ namespace Containers
 /// be used.</typeparam>
 /// <typeparam name="ComparatorT">Optional. The type of comparator to compare elements to each other, used in search and ordering
 /// algorithms. By default, SQComparatorDefault will be used.</typeparam>
-template<class T, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, class ComparatorT = SQComparatorDefault<T> >
+/// <typeparam name="GrowthPolicyT">Optional. The policy that calculates the new capacity of the array when it is exceeded. By default, 
+/// SQGeometricGrowthPolicy will be used.</typeparam>
+template<class T, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, class ComparatorT = SQComparatorDefault<T>, class GrowthPolicyT = SQGeometricGrowthPolicy>
 class QArrayDynamic : public QArrayFixed<T, AllocatorT, ComparatorT>
 {
     using QArrayFixed<T, AllocatorT, ComparatorT>::m_allocator;
@@ -64,16 +67,6 @@ class QArrayDynamic : public QArrayFixed<T, AllocatorT, ComparatorT>
     using QArrayFixed<T, AllocatorT, ComparatorT>::m_pElementBasePointer;
     
 
-    // CONSTANTS
-    // ---------------
-private:
-
-    /// <summary>
-    /// The reallocation factor to be applied to calculate the new capacity on every reallocation. It must be greater than or equal to 1.
-    /// </summary>
-    static float REALLOCATION_FACTOR;
-
-
     // CONSTRUCTORS
     // ---------------
 public:
@@ -131,11 +124,13 @@ public:
         m_uLast = INPUT_COUNT - 1U;// Fixed arrays are supposed not to be empty
         m_uFirst = 0; // Fixed arrays are supposed to start at 0
 
-        // Copies every element
-        for(pointer_uint_q uIndex = 0; uIndex < m_uLast + 1U; ++uIndex) // Fixed arrays are supposed not to be empty
-            new(m_allocator.Allocate()) T(arInputArray[uIndex]);
-
         m_pElementBasePointer = scast_q(m_allocator.GetPointer(), T*);
+
+        // Occupies the space of all the elements and then copies them
+        for(pointer_uint_q uIndex = 0; uIndex < INPUT_COUNT; ++uIndex)
+            m_allocator.Allocate();
+
+        SQBulkElementOperations<T>::CopyConstruct(m_pElementBasePointer, &arInputArray[0], INPUT_COUNT); // Fixed arrays are supposed not to be empty
     }
 
     /// <summary>
@@ -157,12 +152,13 @@ public:
         m_uLast = arInputArray.m_uLast;
         m_uFirst = arInputArray.m_uFirst;
 
-        // Copies every element, if input array is not empty
-        if(m_uLast != QArrayDynamic::END_POSITION_FORWARD)
-            for(pointer_uint_q uIndex = 0; uIndex < m_uLast + 1U; ++uIndex)
-                new(m_allocator.Allocate()) T(arInputArray[uIndex]);
-
         m_pElementBasePointer = scast_q(m_allocator.GetPointer(), T*);
+
+        // Occupies the space of all the elements and then copies them
+        for(pointer_uint_q uIndex = 0; uIndex < INPUT_COUNT; ++uIndex)
+            m_allocator.Allocate();
+
+        SQBulkElementOperations<T>::CopyConstruct(m_pElementBasePointer, arInputArray.m_pElementBasePointer, INPUT_COUNT);
     }
     
     /// <summary>
@@ -293,6 +289,32 @@ public:
         }
     }
 
+    /// <summary>
+    /// Reduces the capacity of the array so it is equal to the number of elements, releasing the memory that is not used.
+    /// </summary>
+    /// <remarks>
+    /// If the array is empty, the capacity will be 1.<br/>
+    /// This operation implies a reallocation, which means that any pointer to elements of this array will be pointing to garbage.<br/>
+    /// Elements are moved bitwise; no assignment operator nor copy constructors are called during this operation.
+    /// </remarks>
+    void ShrinkToFit()
+    {
+        const pointer_uint_q COUNT = this->GetCount();
+        const pointer_uint_q FINAL_CAPACITY = COUNT > 0 ? COUNT : 1U;
+
+        if(FINAL_CAPACITY < this->GetCapacity())
+        {
+            // The allocator must consider the first blocks as occupied, and the rest as free, so they can be released
+            m_allocator.Clear();
+
+            for(pointer_uint_q i = 0; i < COUNT; ++i)
+                m_allocator.Allocate();
+
+            m_allocator.Shrink(FINAL_CAPACITY * sizeof(T));
+            m_pElementBasePointer = scast_q(m_allocator.GetPointer(), T*);
+        }
+    }
+
     /// <summary>
     /// Copies an element to the end of the array.
     /// </summary>
@@ -303,15 +325,81 @@ public:
     /// <param name="newElement">[IN] The element to be copied.</param>
     void Add(const T &newElement)
     {
-        if(this->GetCount() == this->GetCapacity())
-            this->_ReallocateByFactor(this->GetCapacity() + 1U);
-        
-        if(this->IsEmpty())
-            m_uFirst = m_uLast = 0;
-        else
-            ++m_uLast;
-
-        new(m_allocator.Allocate()) T(newElement);
+        new(this->_AllocateLast()) T(newElement);
+    }
+    
+    /// <summary>
+    /// Constructs a new element at the end of the array, calling its default constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the array is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called.
+    /// </remarks>
+    void Emplace()
+    {
+        new(this->_AllocateLast()) T();
+    }
+    
+    /// <summary>
+    /// Constructs a new element at the end of the array, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the array is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called.
+    /// </remarks>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    template<class Argument1T>
+    void Emplace(const Argument1T &argument1)
+    {
+        new(this->_AllocateLast()) T(argument1);
+    }
+    
+    /// <summary>
+    /// Constructs a new element at the end of the array, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the array is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called.
+    /// </remarks>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    /// <param name="argument2">[IN] The second argument to pass to the constructor of the element.</param>
+    template<class Argument1T, class Argument2T>
+    void Emplace(const Argument1T &argument1, const Argument2T &argument2)
+    {
+        new(this->_AllocateLast()) T(argument1, argument2);
+    }
+    
+    /// <summary>
+    /// Constructs a new element at the end of the array, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the array is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called.
+    /// </remarks>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    /// <param name="argument2">[IN] The second argument to pass to the constructor of the element.</param>
+    /// <param name="argument3">[IN] The third argument to pass to the constructor of the element.</param>
+    template<class Argument1T, class Argument2T, class Argument3T>
+    void Emplace(const Argument1T &argument1, const Argument2T &argument2, const Argument3T &argument3)
+    {
+        new(this->_AllocateLast()) T(argument1, argument2, argument3);
+    }
+    
+    /// <summary>
+    /// Constructs a new element at the end of the array, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the array is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called.
+    /// </remarks>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    /// <param name="argument2">[IN] The second argument to pass to the constructor of the element.</param>
+    /// <param name="argument3">[IN] The third argument to pass to the constructor of the element.</param>
+    /// <param name="argument4">[IN] The fourth argument to pass to the constructor of the element.</param>
+    template<class Argument1T, class Argument2T, class Argument3T, class Argument4T>
+    void Emplace(const Argument1T &argument1, const Argument2T &argument2, const Argument3T &argument3, const Argument4T &argument4)
+    {
+        new(this->_AllocateLast()) T(argument1, argument2, argument3, argument4);
     }
     
     /// <summary>
@@ -337,7 +425,7 @@ public:
         pointer_uint_q uIndex = &(*position) - m_pElementBasePointer;
 
         if(this->GetCount() == this->GetCapacity())
-            this->_ReallocateByFactor(this->GetCapacity() + 1U);
+            this->_ReallocateByPolicy(this->GetCapacity() + 1U);
 
         if(this->IsEmpty())
         {
@@ -383,7 +471,7 @@ public:
         QE_ASSERT_WARNING(!this->IsEmpty() && uIndex <= m_uLast, "The input index is out of bounds");
 
         if(this->GetCount() == this->GetCapacity())
-            this->_ReallocateByFactor(this->GetCapacity() + 1U);
+            this->_ReallocateByPolicy(this->GetCapacity() + 1U);
 
         if(this->IsEmpty())
         {
@@ -411,6 +499,34 @@ public:
         }
     }
     
+    /// <summary>
+    /// Copies an element to the array, placing it at the position that keeps the array sorted in ascending order.
+    /// </summary>
+    /// <remarks>
+    /// Elements are compared using the array's comparator.<br/>
+    /// The array must be sorted in ascending order according to the same comparator; otherwise, the position of the new element is undefined.<br/>
+    /// The position is found using binary search. If there are elements equal to the new one, it will be placed after them.<br/>
+    /// An insertion produces the movement of all the subsequent elements in the array one position forward, which will affect the content pointed 
+    /// to by any existing iterator or pointer.<br/>
+    /// If the capacity of the array is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The copy constructor of the element will be called.
+    /// </remarks>
+    /// <param name="newElement">[IN] The element to be copied.</param>
+    /// <returns>
+    /// The position index (zero-based) where the new element was placed.
+    /// </returns>
+    pointer_uint_q SortedInsert(const T &newElement)
+    {
+        const pointer_uint_q INDEX = this->_UpperBound(newElement);
+
+        if(INDEX == this->GetCount())
+            this->Add(newElement);
+        else
+            this->Insert(newElement, INDEX);
+
+        return INDEX;
+    }
+    
     /// <summary>
     /// Deletes an element placed at a concrete position in the array.
     /// </summary>
@@ -512,8 +628,7 @@ public:
         if(!this->IsEmpty())
         {
             // Calls every destructor, from first to last
-            for(pointer_uint_q uIndex = m_uFirst; uIndex <= m_uLast; ++uIndex)
-                (m_pElementBasePointer + uIndex)->~T();
+            SQBulkElementOperations<T>::Destroy(m_pElementBasePointer, this->GetCount());
 
             m_uFirst = QArrayDynamic::END_POSITION_BACKWARD;
             m_uLast = QArrayDynamic::END_POSITION_FORWARD;
@@ -564,10 +679,9 @@ public:
         const pointer_uint_q NEW_ELEMENTS_COUNT = last.GetInternalPosition() - first.GetInternalPosition() + 1U;
 
         if(this->GetCapacity() < this->GetCount() + NEW_ELEMENTS_COUNT)
-            this->_ReallocateByFactor(this->GetCount() + NEW_ELEMENTS_COUNT);
+            this->_ReallocateByPolicy(this->GetCount() + NEW_ELEMENTS_COUNT);
 
-        const T* pCurrentInput = &*first;
-        const T* pAfterLast = (&*last) + 1U;
+        T* pCurrentResident = m_pElementBasePointer + this->GetCount();
 
         // If the array is empty, sets up the first and the last positions
         if(this->IsEmpty())
@@ -576,9 +690,11 @@ public:
             m_uLast = -1;
         }
 
-        // Copies each element in the input range
-        for(; pCurrentInput != pAfterLast; ++pCurrentInput)
-            new(m_allocator.Allocate()) T(*pCurrentInput);
+        // Occupies the space of the new elements and then copies the input range
+        for(pointer_uint_q i = 0; i < NEW_ELEMENTS_COUNT; ++i)
+            m_allocator.Allocate();
+
+        SQBulkElementOperations<T>::CopyConstruct(pCurrentResident, &*first, NEW_ELEMENTS_COUNT);
 
         m_uLast += NEW_ELEMENTS_COUNT;
     }
@@ -615,11 +731,9 @@ public:
         const pointer_uint_q NEW_ELEMENTS_COUNT = last.GetInternalPosition() - first.GetInternalPosition() + 1U;
 
         if(this->GetCapacity() < this->GetCount() + NEW_ELEMENTS_COUNT)
-            this->_ReallocateByFactor(this->GetCount() + NEW_ELEMENTS_COUNT);
+            this->_ReallocateByPolicy(this->GetCount() + NEW_ELEMENTS_COUNT);
         
         T* pCurrentResident = m_pElementBasePointer + FIXED_INDEX;
-        const T* pCurrentInput = &*first;
-        const T* pAfterLast = (&*last) + 1U;
 
         // If the array is empty, sets up the first and the last positions
         if(this->IsEmpty())
@@ -633,9 +747,8 @@ public:
         if(!INSERTING_AT_THE_END)
             memmove(pCurrentResident + NEW_ELEMENTS_COUNT, pCurrentResident, (this->GetCount() - FIXED_INDEX - NEW_ELEMENTS_COUNT) * sizeof(T));
 
-        // Copies each element in the input range
-        for(; pCurrentInput != pAfterLast; ++pCurrentInput, ++pCurrentResident)
-            new(pCurrentResident) T(*pCurrentInput);
+        // Copies the input range
+        SQBulkElementOperations<T>::CopyConstruct(pCurrentResident, &*first, NEW_ELEMENTS_COUNT);
 
         if(m_uLast == QArrayDynamic::END_POSITION_FORWARD)
             ++m_uLast; // Trick: Converts END_POSITION_FORWARD (-2) to END_POSITION_BACKWARD (-1) so the sum below is always correct
@@ -678,12 +791,10 @@ public:
 
         if(this->GetCapacity() < this->GetCount() + NEW_ELEMENTS_COUNT)
         {
-            this->_ReallocateByFactor(this->GetCount() + NEW_ELEMENTS_COUNT);
+            this->_ReallocateByPolicy(this->GetCount() + NEW_ELEMENTS_COUNT);
         }
         
         T* pCurrentResident = m_pElementBasePointer + FIXED_INDEX;
-        const T* pCurrentInput = &*first;
-        const T* pAfterLast = (&*last) + 1U;
 
         // If the array is empty, sets up the first and the last positions
         if(this->IsEmpty())
@@ -697,9 +808,8 @@ public:
         if(!INSERTING_AT_THE_END)
             memmove(pCurrentResident + NEW_ELEMENTS_COUNT, pCurrentResident, (this->GetCount() - FIXED_INDEX - NEW_ELEMENTS_COUNT) * sizeof(T));
 
-        // Copies each element in the input range
-        for(; pCurrentInput != pAfterLast; ++pCurrentInput, ++pCurrentResident)
-            new(pCurrentResident) T(*pCurrentInput);
+        // Copies the input range
+        SQBulkElementOperations<T>::CopyConstruct(pCurrentResident, &*first, NEW_ELEMENTS_COUNT);
         
         if(m_uLast == QArrayDynamic::END_POSITION_FORWARD)
             ++m_uLast; // Trick: Converts END_POSITION_FORWARD (-2) to END_POSITION_BACKWARD (-1) so the sum below is always correct
@@ -734,8 +844,7 @@ public:
         T* pAfterLast = (&*last) + 1U;
 
         // Deletes each element in the input range
-        for(T* pElementToDelete = pFirstInRange; pElementToDelete != pAfterLast; ++pElementToDelete)
-            (*pElementToDelete).~T();
+        SQBulkElementOperations<T>::Destroy(pFirstInRange, ELEMENTS_TO_REMOVE_COUNT);
 
         const pointer_uint_q FIRST_DELETED_POSITION = pFirstInRange - m_pElementBasePointer;
         const pointer_uint_q ELEMENTS_AFTER_LAST = this->GetCount() - FIRST_DELETED_POSITION - ELEMENTS_TO_REMOVE_COUNT;
@@ -781,8 +890,7 @@ public:
         T* pAfterLast = m_pElementBasePointer + uLast + 1U;
 
         // Deletes each element in the input range
-        for(T* pElementToDelete = pFirstInRange; pElementToDelete != pAfterLast; ++pElementToDelete)
-            (*pElementToDelete).~T();
+        SQBulkElementOperations<T>::Destroy(pFirstInRange, ELEMENTS_TO_REMOVE_COUNT);
         
         const pointer_uint_q FIRST_DELETED_POSITION = pFirstInRange - m_pElementBasePointer;
         const pointer_uint_q ELEMENTS_AFTER_LAST = this->GetCount() - FIRST_DELETED_POSITION - ELEMENTS_TO_REMOVE_COUNT;
@@ -828,12 +936,11 @@ public:
         
         QArrayDynamic arResult(ELEMENTS_TO_GET_COUNT);
 
-        const T* pCurrentResult = &*first;
-        const T* pAfterLast = &*last + 1U;
+        // Occupies the space of all the elements and then copies the input range
+        for(pointer_uint_q i = 0; i < ELEMENTS_TO_GET_COUNT; ++i)
+            arResult.m_allocator.Allocate();
 
-        // Copies each element in the input range
-        for(; pCurrentResult != pAfterLast; ++pCurrentResult)
-            new(arResult.m_allocator.Allocate()) T(*pCurrentResult);
+        SQBulkElementOperations<T>::CopyConstruct(arResult.m_pElementBasePointer, &*first, ELEMENTS_TO_GET_COUNT);
 
         arResult.m_uFirst = 0;
         arResult.m_uLast  = ELEMENTS_TO_GET_COUNT - 1U;
@@ -864,12 +971,11 @@ public:
         
         QArrayDynamic arResult(ELEMENTS_TO_GET_COUNT);
 
-        T* pCurrentResult = m_pElementBasePointer + uFirst;
-        T* pAfterLast = m_pElementBasePointer + uLast + 1U;
+        // Occupies the space of all the elements and then copies the input range
+        for(pointer_uint_q i = 0; i < ELEMENTS_TO_GET_COUNT; ++i)
+            arResult.m_allocator.Allocate();
 
-        // Copies each element in the input range
-        for(; pCurrentResult != pAfterLast; ++pCurrentResult)
-            new(arResult.m_allocator.Allocate()) T(*pCurrentResult);
+        SQBulkElementOperations<T>::CopyConstruct(arResult.m_pElementBasePointer, m_pElementBasePointer + uFirst, ELEMENTS_TO_GET_COUNT);
 
         arResult.m_uFirst = 0;
         arResult.m_uLast  = ELEMENTS_TO_GET_COUNT - 1U;
@@ -880,14 +986,35 @@ public:
 private:
 
     /// <summary>
-    /// Increases the capacity of the array, reserving memory for more elements than necessary, depending on the reallocation factor.
+    /// Reserves the space of a new element at the end of the array, without constructing it.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the array is exceeded, a reallocation will take place.
+    /// </remarks>
+    /// <returns>
+    /// The address where the new element must be constructed.
+    /// </returns>
+    void* _AllocateLast()
+    {
+        if(this->GetCount() == this->GetCapacity())
+            this->_ReallocateByPolicy(this->GetCapacity() + 1U);
+        
+        if(this->IsEmpty())
+            m_uFirst = m_uLast = 0;
+        else
+            ++m_uLast;
+
+        return m_allocator.Allocate();
+    }
+
+    /// <summary>
+    /// Increases the capacity of the array, reserving memory for more elements than necessary, depending on the growth policy.
     /// </summary>
     /// <param name="uNumberOfElements">[IN] The number of elements for which to reserve memory. It should be greater than the
     /// current capacity or nothing will happen.</param>
-    void _ReallocateByFactor(const pointer_uint_q uNumberOfElements)
+    void _ReallocateByPolicy(const pointer_uint_q uNumberOfElements)
     {
-        const pointer_uint_q FINAL_CAPACITY = scast_q(scast_q(uNumberOfElements, float) * QArrayDynamic::REALLOCATION_FACTOR, pointer_uint_q);
-        this->Reserve(FINAL_CAPACITY);
+        this->Reserve(GrowthPolicyT::GetNewCapacity(uNumberOfElements));
     }
 
 
@@ -909,11 +1036,8 @@ protected:
 
 // ATTRIBUTE INITIALIZATION
 // ----------------------------
-template<class T, class AllocatorT, class ComparatorT>
-pointer_uint_q QArrayDynamic<T, AllocatorT, ComparatorT>::sm_uDefaultCapacity = 1;
-
-template<class T, class AllocatorT, class ComparatorT>
-float QArrayDynamic<T, AllocatorT, ComparatorT>::REALLOCATION_FACTOR = 1.5f;
+template<class T, class AllocatorT, class ComparatorT, class GrowthPolicyT>
+pointer_uint_q QArrayDynamic<T, AllocatorT, ComparatorT, GrowthPolicyT>::sm_uDefaultCapacity = 1;
 
 
 } //namespace Containers
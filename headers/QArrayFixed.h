@@ -34,8 +34,13 @@
 #include "QPoolAllocator.h"
 #include "QAlignment.h"
 #include "SQComparatorDefault.h"
+#include "SQSorter.h"
+#include "SQBulkElementOperations.h"
 #include "AllocationOperators.h"
 #include "EQIterationDirection.h"
+#include "QContainerStatistics.h"
+#include "QContainerImageHeader.h"
+#include "SQTypeTraits.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
@@ -924,13 +929,13 @@ public:
         QE_ASSERT_ERROR( pArray != null_q, "The argument pArray is null." );
         QE_ASSERT_ERROR( uNumberOfElements > 0, "Zero elements array is not allowed." );
 
+        m_pElementBasePointer = scast_q(m_allocator.GetPointer(), T*);
+
+        // Occupies the space of all the elements and then writes a copy of the input array
         for(pointer_uint_q uIndex = 0; uIndex < uNumberOfElements; ++uIndex)
-        {
-            // Allocates and writes in the returned buffer a copy of the input array
-            new(m_allocator.Allocate()) T(pArray[uIndex]);
-        }
+            m_allocator.Allocate();
 
-        m_pElementBasePointer = scast_q(m_allocator.GetPointer(), T*);
+        SQBulkElementOperations<T>::CopyConstruct(m_pElementBasePointer, pArray, uNumberOfElements);
     }
 
     /// <summary>
@@ -946,14 +951,13 @@ public:
             m_allocator(fixedArray.GetCount() * sizeof(T), sizeof(T), QAlignment(alignof_q(T))),
             m_pElementBasePointer(null_q)
     {
+        m_pElementBasePointer = scast_q(m_allocator.GetPointer(), T*);
+
+        // Occupies the space of all the elements and then copies the elements of the origin array
         for(pointer_uint_q uIndex = 0; uIndex < fixedArray.m_uLast + 1U; ++uIndex)
-        {
-            // Constructs a T object over the buffer returned by the allocator and initializes it with
-            // the value of the origin element in the corresponding array position.
-            new(m_allocator.Allocate()) T(fixedArray[uIndex]);
-        }
+            m_allocator.Allocate();
 
-        m_pElementBasePointer = scast_q(m_allocator.GetPointer(), T*);
+        SQBulkElementOperations<T>::CopyConstruct(m_pElementBasePointer, fixedArray.m_pElementBasePointer, fixedArray.m_uLast + 1U);
     }
 
 protected:
@@ -982,10 +986,7 @@ public:
     /// </remarks>
     ~QArrayFixed()
     {
-        const pointer_uint_q ARRAY_COUNT = this->GetCount();
-
-        for(pointer_uint_q uIndex = 0; uIndex < ARRAY_COUNT; ++uIndex)
-            this->GetValue(uIndex).~T();
+        SQBulkElementOperations<T>::Destroy(m_pElementBasePointer, this->GetCount());
     }
 
 
@@ -1010,17 +1011,16 @@ public:
     /// </returns>
     QArrayFixed& operator= (const QArrayFixed &fixedArray)
     {
-        pointer_uint_q uElementsToCopy;
+        if(this != &fixedArray)
+        {
+            pointer_uint_q uElementsToCopy;
 
-        if(m_uLast > fixedArray.m_uLast)
-            uElementsToCopy = fixedArray.GetCount();
-        else
-            uElementsToCopy = this->GetCount();
+            if(m_uLast > fixedArray.m_uLast)
+                uElementsToCopy = fixedArray.GetCount();
+            else
+                uElementsToCopy = this->GetCount();
 
-        for(pointer_uint_q uIndex = 0; uIndex < uElementsToCopy; ++uIndex)
-        {
-            // Destination array element value = Origin array element value, using pointers arithmetic
-            this->SetValue(uIndex, fixedArray.GetValue(uIndex));
+            SQBulkElementOperations<T>::Assign(m_pElementBasePointer, fixedArray.m_pElementBasePointer, uElementsToCopy);
         }
 
         return *this;
@@ -1418,6 +1418,166 @@ public:
 
         return bElementFound ? --position : position;
     }
+    
+    /// <summary>
+    /// Sorts the elements of the array in ascending order, using the introsort algorithm.
+    /// </summary>
+    /// <remarks>
+    /// Elements are compared using the array's comparator.<br/>
+    /// The sort is not stable, equal elements may not keep their relative order. Use StableSort if that order is relevant.<br/>
+    /// No assignment operator nor copy constructors are called during this operation.
+    /// </remarks>
+    void Sort()
+    {
+        if(!this->IsEmpty())
+            SQSorter<T, ComparatorT>::Sort(m_pElementBasePointer, this->GetCount());
+    }
+    
+    /// <summary>
+    /// Sorts the elements of the array in ascending order, using the merge sort algorithm, keeping the relative order of equal elements.
+    /// </summary>
+    /// <remarks>
+    /// Elements are compared using the array's comparator.<br/>
+    /// An auxiliary buffer whose size is half the size of the array is allocated and freed during this operation.<br/>
+    /// No assignment operator nor copy constructors are called during this operation.
+    /// </remarks>
+    void StableSort()
+    {
+        if(!this->IsEmpty())
+            SQSorter<T, ComparatorT>::StableSort(m_pElementBasePointer, this->GetCount());
+    }
+    
+    /// <summary>
+    /// Searches for an element in the array equal to a given one and obtains its position index, using binary search.
+    /// </summary>
+    /// <remarks>
+    /// Elements are compared using the array's comparator.<br/>
+    /// The array must be sorted in ascending order according to the same comparator; otherwise, the result is undefined.<br/>
+    /// If there are several equal elements, the first one will be returned.
+    /// </remarks>
+    /// <param name="element">[IN] The element to be searched through the array.</param>
+    /// <returns>
+    /// The position index (zero-based) of the first element that is equal to the input one. If the element is not found,
+    /// the ELEMENT_NOT_FOUND constant will be returned.
+    /// </returns>
+    pointer_uint_q BinarySearch(const T &element) const
+    {
+        const pointer_uint_q INDEX = this->_LowerBound(element);
+
+        return INDEX < this->GetCount() && ComparatorT::Compare(m_pElementBasePointer[INDEX], element) == 0 ? INDEX : 
+                                                                                                               QArrayFixed::ELEMENT_NOT_FOUND;
+    }
+    
+    /// <summary>
+    /// Searches for the first element in the array that is not lower than a given one, using binary search.
+    /// </summary>
+    /// <remarks>
+    /// Elements are compared using the array's comparator.<br/>
+    /// The array must be sorted in ascending order according to the same comparator; otherwise, the result is undefined.
+    /// </remarks>
+    /// <param name="element">[IN] The element to compare to.</param>
+    /// <returns>
+    /// The position of the first element that is greater than or equal to the input one. If all the elements are lower,
+    /// the iterator will point to the forward end position.
+    /// </returns>
+    QArrayIterator LowerBound(const T &element) const
+    {
+        const pointer_uint_q INDEX = this->_LowerBound(element);
+
+        return QArrayFixed::QArrayIterator(this, INDEX < this->GetCount() ? INDEX : QArrayFixed::END_POSITION_FORWARD);
+    }
+    
+    /// <summary>
+    /// Searches for the first element in the array that is greater than a given one, using binary search.
+    /// </summary>
+    /// <remarks>
+    /// Elements are compared using the array's comparator.<br/>
+    /// The array must be sorted in ascending order according to the same comparator; otherwise, the result is undefined.
+    /// </remarks>
+    /// <param name="element">[IN] The element to compare to.</param>
+    /// <returns>
+    /// The position of the first element that is greater than the input one. If no element is greater,
+    /// the iterator will point to the forward end position.
+    /// </returns>
+    QArrayIterator UpperBound(const T &element) const
+    {
+        const pointer_uint_q INDEX = this->_UpperBound(element);
+
+        return QArrayFixed::QArrayIterator(this, INDEX < this->GetCount() ? INDEX : QArrayFixed::END_POSITION_FORWARD);
+    }
+    
+    /// <summary>
+    /// Searches for the range of elements in the array that are equal to a given one, using binary search.
+    /// </summary>
+    /// <remarks>
+    /// Elements are compared using the array's comparator.<br/>
+    /// The array must be sorted in ascending order according to the same comparator; otherwise, the result is undefined.
+    /// </remarks>
+    /// <param name="element">[IN] The element to be searched through the array.</param>
+    /// <param name="first">[OUT] The position of the first element that is equal to the input one. If the element is not found,
+    /// the iterator will point to the forward end position.</param>
+    /// <param name="last">[OUT] The position of the last element that is equal to the input one. If the element is not found,
+    /// the iterator will point to the forward end position.</param>
+    /// <returns>
+    /// The number of elements equal to the input one.
+    /// </returns>
+    pointer_uint_q EqualRange(const T &element, QArrayIterator &first, QArrayIterator &last) const
+    {
+        const pointer_uint_q FIRST_INDEX = this->_LowerBound(element);
+        const pointer_uint_q END_INDEX = this->_UpperBound(element);
+
+        if(FIRST_INDEX == END_INDEX)
+        {
+            first = QArrayFixed::QArrayIterator(this, QArrayFixed::END_POSITION_FORWARD);
+            last = first;
+        }
+        else
+        {
+            first = QArrayFixed::QArrayIterator(this, FIRST_INDEX);
+            last = QArrayFixed::QArrayIterator(this, END_INDEX - 1U);
+        }
+
+        return END_INDEX - FIRST_INDEX;
+    }
+
+    /// <summary>
+    /// Gets information about the memory usage of the array.
+    /// </summary>
+    /// <returns>
+    /// The number of elements, the capacity and the bytes reserved and used by the allocator. The shape properties are zero.
+    /// </returns>
+    QContainerStatistics GetStatistics() const
+    {
+        QContainerStatistics statistics;
+        statistics.SetCount(this->GetCount());
+        statistics.SetCapacity(this->GetCapacity());
+        statistics.SetReservedBytes(m_allocator.GetPoolSize());
+        statistics.SetUsedBytes(m_allocator.GetAllocatedBytes());
+
+        return statistics;
+    }
+
+    /// <summary>
+    /// Writes a flat binary image of the array, which can be read without deserializing the elements by QArrayImageView.
+    /// </summary>
+    /// <remarks>
+    /// The image is composed of a QContainerImageHeader followed by the bytes of the elements, in the same order.<br/>
+    /// Only arrays whose elements are trivially copyable (see SQTypeTraits) can be written.
+    /// </remarks>
+    /// <typeparam name="BinaryStreamWriterT">The type of the writer, normally QBinaryStreamWriter. It must provide the methods Write and WriteBytes.</typeparam>
+    /// <param name="writer">[IN/OUT] The writer that receives the image.</param>
+    template<class BinaryStreamWriterT>
+    void WriteImage(BinaryStreamWriterT &writer) const
+    {
+        QE_ASSERT_ERROR(SQTypeTraits<T>::IS_TRIVIALLY_COPYABLE, "Only arrays whose elements are trivially copyable can be written as images.");
+
+        const pointer_uint_q COUNT = this->GetCount();
+
+        writer.Write(QContainerImageHeader(QContainerImageHeader::CONTAINER_TYPE_ARRAY, sizeof(T), COUNT, QContainerImageHeader::NULL_POSITION));
+
+        if(COUNT > 0)
+            writer.WriteBytes(m_pElementBasePointer, COUNT * sizeof(T));
+    }
 
 private:
 
@@ -1454,6 +1614,72 @@ private:
         return position;
     }
 
+protected:
+
+    /// <summary>
+    /// Calculates the index of the first element in the sorted array that is not lower than a given one.
+    /// </summary>
+    /// <param name="element">[IN] The element to compare to.</param>
+    /// <returns>
+    /// The index of the first element that is greater than or equal to the input one. If all the elements are lower, 
+    /// the number of elements in the array.
+    /// </returns>
+    pointer_uint_q _LowerBound(const T &element) const
+    {
+        pointer_uint_q uFirst = 0;
+        pointer_uint_q uNumberOfElements = this->GetCount();
+
+        // The search range is halved every iteration, keeping the half that contains the bound
+        while(uNumberOfElements > 0)
+        {
+            const pointer_uint_q HALF = uNumberOfElements >> 1U;
+
+            if(ComparatorT::Compare(m_pElementBasePointer[uFirst + HALF], element) < 0)
+            {
+                uFirst += HALF + 1U;
+                uNumberOfElements -= HALF + 1U;
+            }
+            else
+            {
+                uNumberOfElements = HALF;
+            }
+        }
+
+        return uFirst;
+    }
+
+    /// <summary>
+    /// Calculates the index of the first element in the sorted array that is greater than a given one.
+    /// </summary>
+    /// <param name="element">[IN] The element to compare to.</param>
+    /// <returns>
+    /// The index of the first element that is greater than the input one. If no element is greater, 
+    /// the number of elements in the array.
+    /// </returns>
+    pointer_uint_q _UpperBound(const T &element) const
+    {
+        pointer_uint_q uFirst = 0;
+        pointer_uint_q uNumberOfElements = this->GetCount();
+
+        // The search range is halved every iteration, keeping the half that contains the bound
+        while(uNumberOfElements > 0)
+        {
+            const pointer_uint_q HALF = uNumberOfElements >> 1U;
+
+            if(ComparatorT::Compare(m_pElementBasePointer[uFirst + HALF], element) <= 0)
+            {
+                uFirst += HALF + 1U;
+                uNumberOfElements -= HALF + 1U;
+            }
+            else
+            {
+                uNumberOfElements = HALF;
+            }
+        }
+
+        return uFirst;
+    }
+
 
     // PROPERTIES
     // ---------------
@@ -0,0 +1,161 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QARRAYIMAGEVIEW__
+#define __QARRAYIMAGEVIEW__
+
+#include "DataTypesDefinitions.h"
+#include "ToolsDefinitions.h"
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+#include "QContainerImageHeader.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Provides read-only access to the elements of an array image, written by either QArrayFixed::WriteImage or QList::WriteImage.
+/// </summary>
+/// <remarks>
+/// The view does not copy nor deserialize the image, elements are read directly from the buffer, which may be a memory-mapped file.<br/>
+/// The buffer is not owned by the view and must remain valid while the view is used. It must be aligned, at least, to the alignment of the elements.
+/// </remarks>
+/// <typeparam name="T">The type of the elements stored in the image. It must be the same type used to write the image.</typeparam>
+template<class T>
+class QArrayImageView
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the image to read.
+    /// </summary>
+    /// <param name="pImage">[IN] The address of the first byte of the image. It must not be null and it must contain an array image 
+    /// whose elements occupy the same size as T.</param>
+    explicit QArrayImageView(const void* pImage) : m_pHeader(scast_q(pImage, const QContainerImageHeader*)),
+                                                   m_pElements(rcast_q(scast_q(pImage, const u8_q*) + sizeof(QContainerImageHeader), const T*))
+    {
+        QE_ASSERT_ERROR(pImage != null_q, "The input image cannot be null.");
+        QE_ASSERT_ERROR(rcast_q(pImage, pointer_uint_q) % sizeof(u32_q) == 0 && rcast_q(pImage, pointer_uint_q) % alignof_q(T) == 0, 
+                        "The input image must be aligned, at least, to 4 bytes and to the alignment of the elements.");
+        QE_ASSERT_ERROR(m_pHeader->IsCompatible(QContainerImageHeader::CONTAINER_TYPE_ARRAY, sizeof(T)), "The input buffer does not contain an array image of elements of the expected type.");
+        QE_ASSERT_ERROR(rcast_q(m_pElements, pointer_uint_q) % alignof_q(T) == 0, "The elements in the input image are not aligned to the alignment of T.");
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets an element of the image.
+    /// </summary>
+    /// <param name="uIndex">[IN] The position of the element. It must be lower than the number of elements.</param>
+    /// <returns>
+    /// A reference to the element, stored in the image.
+    /// </returns>
+    const T& operator[](const pointer_uint_q uIndex) const
+    {
+        return this->GetValue(uIndex);
+    }
+
+    /// <summary>
+    /// Gets an element of the image.
+    /// </summary>
+    /// <param name="uIndex">[IN] The position of the element. It must be lower than the number of elements.</param>
+    /// <returns>
+    /// A reference to the element, stored in the image.
+    /// </returns>
+    const T& GetValue(const pointer_uint_q uIndex) const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+
+        QE_ASSERT_ERROR(uIndex < this->GetCount(), string_q("The input index (") + string_q::FromInteger(uIndex) + ") is out of bounds.");
+
+        return m_pElements[uIndex];
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of elements in the image.
+    /// </summary>
+    /// <returns>
+    /// The number of elements.
+    /// </returns>
+    pointer_uint_q GetCount() const
+    {
+        return m_pHeader->GetCount();
+    }
+
+    /// <summary>
+    /// Indicates whether the image is empty.
+    /// </summary>
+    /// <returns>
+    /// True if there are no elements in the image; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_pHeader->GetCount() == 0;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The header at the beginning of the image.
+    /// </summary>
+    const QContainerImageHeader* m_pHeader;
+
+    /// <summary>
+    /// The first element of the image, right after the header.
+    /// </summary>
+    const T* m_pElements;
+
+};
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QARRAYIMAGEVIEW__
@@ -0,0 +1,172 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QARRAYINLINE__
+#define __QARRAYINLINE__
+
+#include "QArrayDynamic.h"
+#include "QArrayInlineAllocator.h"
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Represents a dynamic array that stores a limited number of elements inside the instance, so it does not need to reserve memory 
+/// from the heap until that number is exceeded.
+/// </summary>
+/// <remarks>
+/// It behaves exactly as a dynamic array whose minimum capacity is the number of elements stored inside the instance. When more elements 
+/// are added, they are all moved to the allocator, where they stay until the array is destroyed.<br/>
+/// It is intended to be used for short-lived arrays that usually contain a few elements, like local variables.<br/>
+/// Since elements may be stored inside the instance, it must not be copied or moved by copying its bytes, which means that it should not be 
+/// used as the element type of other containers.<br/>
+/// Elements are assured to be placed contiguously in memory.<br/>
+/// Elements are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
+/// If SQComparatorDefault is used as comparator, elements will be forced to implement operators "==" and "<".
+/// </remarks>
+/// <typeparam name="T">The type of every element in the array.</typeparam>
+/// <typeparam name="INLINE_CAPACITY">The maximum number of elements that can be stored inside the instance. It must be greater than zero.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The type of allocator to store the elements of the array when they do not fit inside the instance. 
+/// By default, QPoolAllocator will be used.</typeparam>
+/// <typeparam name="ComparatorT">Optional. The type of comparator to compare elements to each other, used in search and ordering
+/// algorithms. By default, SQComparatorDefault will be used.</typeparam>
+template<class T, pointer_uint_q INLINE_CAPACITY, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, class ComparatorT = SQComparatorDefault<T> >
+class QArrayInline : public QArrayDynamic<T, QArrayInlineAllocator<T, INLINE_CAPACITY, AllocatorT>, ComparatorT>
+{
+    // TYPEDEFS
+    // ---------------
+protected:
+
+    typedef QArrayDynamic<T, QArrayInlineAllocator<T, INLINE_CAPACITY, AllocatorT>, ComparatorT> BaseType;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    /// <remarks>
+    /// The initial capacity is the number of elements that can be stored inside the instance.
+    /// </remarks>
+    QArrayInline()
+    {
+    }
+
+    /// <summary>
+    /// Constructor that receives the initial capacity.
+    /// </summary>
+    /// <remarks>
+    /// If the initial capacity is greater than the number of elements that can be stored inside the instance, memory is reserved from the 
+    /// allocator.
+    /// </remarks>
+    /// <param name="uInitialCapacity">[IN] The number of elements for which to reserve memory, the initial capacity. It must be greater 
+    /// than zero.</param>
+    explicit QArrayInline(const pointer_uint_q uInitialCapacity) : BaseType(uInitialCapacity)
+    {
+    }
+
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor of every new element is called, from first to last.<br/>
+    /// The elements are stored inside the instance if they fit, no matter where the elements of the input array are stored.
+    /// </remarks>
+    /// <param name="arInputArray">[IN] The input array to be copied.</param>
+    QArrayInline(const QArrayInline &arInputArray) : BaseType(arInputArray)
+    {
+    }
+
+    /// <summary>
+    /// Constructor that receives an existing array and its size.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor is called for every element of the array.
+    /// </remarks>
+    /// <param name="pArray">[IN] The existing array that will be copied. It must not be null.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the input array. It must be greater than zero.</param>
+    QArrayInline(const T* pArray, const pointer_uint_q uNumberOfElements) : BaseType(pArray, uNumberOfElements)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Assignment operator that copies an inline array.
+    /// </summary>
+    /// <remarks>
+    /// If the input array has less elements than the resident array, the destructor of the last elements (the difference) 
+    /// will be called.<br/>
+    /// If the input array has more elements than the resident array, the copy constructor of the new elements (the difference)
+    /// will be called.<br/>
+    /// When copying an element of a position that already exists in the resident array, the assignment operator of that 
+    /// element will be called.
+    /// </remarks>
+    /// <param name="arInputArray">[IN] The input array to be copied.</param>
+    /// <returns>
+    /// A reference to the resultant inline array.
+    /// </returns>
+    QArrayInline& operator=(const QArrayInline &arInputArray)
+    {
+        BaseType::operator=(arInputArray);
+        return *this;
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Indicates whether the elements are stored inside the instance or in the allocator.
+    /// </summary>
+    /// <returns>
+    /// True if the elements are stored inside the instance; False if they have been moved to the allocator.
+    /// </returns>
+    bool IsInline() const
+    {
+        return this->GetAllocator()->IsUsingInlineBuffer();
+    }
+};
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QARRAYINLINE__
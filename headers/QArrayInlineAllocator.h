@@ -0,0 +1,444 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QARRAYINLINEALLOCATOR__
+#define __QARRAYINLINEALLOCATOR__
+
+#include <cstring>
+
+#include "DataTypesDefinitions.h"
+#include "ToolsDefinitions.h"
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+#include "QAlignment.h"
+#include "QPoolAllocator.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Allocator used by inline arrays, which stores the blocks of a limited number of elements inside the instance and moves them to another allocator 
+/// only when more blocks are needed.
+/// </summary>
+/// <remarks>
+/// It provides the same interface as QPoolAllocator so it can be used by arrays, which allocate their blocks sequentially and always deallocate the 
+/// last blocks. Blocks are assured to be contiguous in memory and to be returned in ascending order, so this allocator does not track which blocks 
+/// are free while they are in the internal buffer.<br/>
+/// Once the blocks have been moved to the external allocator (spilled), they stay there until the allocator is destroyed or it is shrunk to a size 
+/// that fits in the internal buffer.<br/>
+/// Since the internal buffer is part of the instance, its address changes if the instance is copied bitwise; instances must not be copied or moved by 
+/// copying their bytes, as containers do with their elements.
+/// </remarks>
+/// <typeparam name="T">The type of the elements to be stored in the blocks.</typeparam>
+/// <typeparam name="INLINE_CAPACITY">The maximum number of elements stored in the internal buffer. It must be greater than zero.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The type of the allocator to which the blocks are moved when the internal buffer is not big enough. 
+/// It must provide the same interface as QPoolAllocator. By default, QPoolAllocator will be used.</typeparam>
+template<class T, pointer_uint_q INLINE_CAPACITY, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator>
+class QArrayInlineAllocator
+{
+    // CONSTANTS
+    // ---------------
+private:
+
+    /// <summary>
+    /// The size, in bytes, of the internal buffer available for blocks.
+    /// </summary>
+    static const pointer_uint_q INLINE_POOL_SIZE = INLINE_CAPACITY * sizeof(T);
+
+    /// <summary>
+    /// The size, in bytes, of the internal buffer, including the bytes that may be lost when adjusting its alignment.
+    /// </summary>
+    static const pointer_uint_q INLINE_BUFFER_SIZE = INLINE_CAPACITY * sizeof(T) + alignof_q(T) - 1U;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructs an allocator passing the pool size, block size and memory alignment.
+    /// </summary>
+    /// <remarks>
+    /// If the size of the pool fits in the internal buffer, the internal buffer is used and the size of the pool will be the size of the internal
+    /// buffer; otherwise, the external allocator is created with the requested size.
+    /// </remarks>
+    /// <param name="uSize">[IN] Size of the pool, in bytes. It must be greater than zero.</param>
+    /// <param name="uBlockSize">[IN] Size of each block to allocate, in bytes. It must be greater than zero.</param>
+    /// <param name="alignment">[IN] Multiple of which must be the memory address. All the blocks will have the same alignment. It must not 
+    /// be greater than the alignment of the type of the elements.</param>
+    QArrayInlineAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const QAlignment &alignment) :
+                                                                                        m_pFirst(null_q),
+                                                                                        m_uBlockSize(uBlockSize),
+                                                                                        m_uAllocatedBytes(0),
+                                                                                        m_alignment(alignment),
+                                                                                        m_pExternalAllocator(null_q)
+    {
+        QE_ASSERT_ERROR(uSize != 0, "Size cannot be zero");
+        QE_ASSERT_ERROR(uBlockSize != 0, "Block size cannot be zero");
+        QE_ASSERT_ERROR(scast_q(alignment, pointer_uint_q) <= alignof_q(T), "The alignment cannot be greater than the alignment of the type of the elements");
+
+        if(uSize > INLINE_POOL_SIZE)
+        {
+            m_pExternalAllocator = new AllocatorT(uSize, uBlockSize, alignment);
+        }
+        else
+        {
+            this->_UseInlineBuffer();
+        }
+    }
+
+private:
+
+    // Disabled
+    QArrayInlineAllocator(const QArrayInlineAllocator &);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It destroys the external allocator, if it was created.
+    /// </summary>
+    ~QArrayInlineAllocator()
+    {
+        delete m_pExternalAllocator;
+    }
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Disabled
+    QArrayInlineAllocator& operator=(const QArrayInlineAllocator &);
+
+public:
+
+    /// <summary>
+    /// Allocates a block and returns its address.
+    /// </summary>
+    /// <returns>
+    /// Pointer to the allocated memory block. Returns null if the pool is full.
+    /// </returns>
+    void* Allocate()
+    {
+        if(m_pExternalAllocator != null_q)
+            return m_pExternalAllocator->Allocate();
+
+        if(m_uAllocatedBytes + m_uBlockSize > INLINE_POOL_SIZE)
+            return null_q;
+
+        void* pBlock = m_pFirst + m_uAllocatedBytes;
+        m_uAllocatedBytes += m_uBlockSize;
+
+        return pBlock;
+    }
+
+    /// <summary>
+    /// Deallocates a block.
+    /// </summary>
+    /// <remarks>
+    /// While the internal buffer is used, the deallocated block is supposed to be one of the last allocated blocks.
+    /// </remarks>
+    /// <param name="pBlock">[IN] Pointer to a block previously allocated with the corresponding class method. It must not be null.</param>
+    void Deallocate(const void* pBlock)
+    {
+        QE_ASSERT_ERROR(pBlock != null_q, "Pointer to block to deallocate cannot be null");
+
+        if(m_pExternalAllocator != null_q)
+        {
+            m_pExternalAllocator->Deallocate(pBlock);
+        }
+        else
+        {
+            QE_ASSERT_ERROR(scast_q(pBlock, const u8_q*) >= m_pFirst && scast_q(pBlock, const u8_q*) < m_pFirst + m_uAllocatedBytes, 
+                            "Pointer to block to deallocate must be an address provided by this allocator");
+
+            m_uAllocatedBytes -= m_uBlockSize;
+        }
+    }
+
+    /// <summary>
+    /// Clears the pool, so that makes it all available to allocate.
+    /// </summary>
+    void Clear()
+    {
+        if(m_pExternalAllocator != null_q)
+            m_pExternalAllocator->Clear();
+        else
+            m_uAllocatedBytes = 0;
+    }
+
+    /// <summary>
+    /// Copies raw data in allocated blocks into destination allocator passed by parameter.
+    /// </summary>
+    /// <remarks>
+    /// The size of destination allocator must be greater or equal than the size of the source pool. 
+    /// The block size of the destination allocator must be equal than the source block size.
+    /// </remarks>
+    /// <param name="allocator">[IN/OUT] The destination allocator.</param>
+    void CopyTo(QArrayInlineAllocator &allocator) const
+    {
+        QE_ASSERT_ERROR(this->GetPoolSize() <= allocator.GetPoolSize(), "Chunk size for allocations must be greater or equal in the destination allocator than in the source allocator");
+        QE_ASSERT_ERROR(m_uBlockSize == allocator.m_uBlockSize, "Block sizes of origin and destination allocators must be equal");
+
+        if(m_pExternalAllocator != null_q && allocator.m_pExternalAllocator != null_q)
+        {
+            m_pExternalAllocator->CopyTo(*allocator.m_pExternalAllocator);
+        }
+        else
+        {
+            const pointer_uint_q ALLOCATED_BYTES = this->GetAllocatedBytes();
+
+            allocator.Clear();
+            memcpy(allocator.GetPointer(), this->GetPointer(), ALLOCATED_BYTES);
+
+            for(pointer_uint_q i = 0; i < ALLOCATED_BYTES; i += m_uBlockSize)
+                allocator.Allocate();
+        }
+    }
+
+    /// <summary>
+    /// Moves the allocated data to a bigger memory block at a different memory address.
+    /// </summary>
+    /// <remarks>
+    /// If the internal buffer is being used, the external allocator is created and the allocated blocks are moved to it.
+    /// </remarks>
+    /// <param name="uNewSize">[IN] The new size of the pool, in bytes. It must be greater than the current size of the pool; otherwise, no action 
+    /// will be performed.</param>
+    void Reallocate(const pointer_uint_q uNewSize)
+    {
+        QE_ASSERT_WARNING(uNewSize > this->GetPoolSize(), "The new size must be greater than the current size of the pool.");
+
+        if(m_pExternalAllocator != null_q)
+        {
+            m_pExternalAllocator->Reallocate(uNewSize);
+        }
+        else if(uNewSize > INLINE_POOL_SIZE)
+        {
+            m_pExternalAllocator = new AllocatorT(uNewSize, m_uBlockSize, m_alignment);
+            memcpy(m_pExternalAllocator->GetPointer(), m_pFirst, m_uAllocatedBytes);
+
+            // The blocks are occupied in the same order they were occupied in the internal buffer
+            for(pointer_uint_q i = 0; i < m_uAllocatedBytes; i += m_uBlockSize)
+                m_pExternalAllocator->Allocate();
+
+            m_pFirst = null_q;
+            m_uAllocatedBytes = 0;
+        }
+    }
+
+    /// <summary>
+    /// Moves the allocated data to a smaller memory block, releasing the blocks at the end of the pool.
+    /// </summary>
+    /// <remarks>
+    /// If the external allocator is being used and the new size fits in the internal buffer, the allocated blocks are moved back to the internal 
+    /// buffer and the external allocator is destroyed. The internal buffer cannot be shrunk.<br/>
+    /// All the blocks that lie beyond the new size must be free; otherwise, no action will be performed.
+    /// </remarks>
+    /// <param name="uNewSize">[IN] The new size of the pool, in bytes. It must be lower than the current size of the pool and greater than or 
+    /// equal to the size of a block; otherwise, no action will be performed.</param>
+    void Shrink(const pointer_uint_q uNewSize)
+    {
+        QE_ASSERT_WARNING(uNewSize < this->GetPoolSize(), "The new size must be lower than the current size of the pool.");
+
+        if(m_pExternalAllocator != null_q)
+        {
+            if(uNewSize > INLINE_POOL_SIZE)
+            {
+                m_pExternalAllocator->Shrink(uNewSize);
+            }
+            else
+            {
+                // The allocated blocks are supposed to be the first blocks of the external pool, as it happens when they were occupied in order
+                const pointer_uint_q ALLOCATED_BYTES = m_pExternalAllocator->GetAllocatedBytes();
+
+                QE_ASSERT_ERROR(ALLOCATED_BYTES <= uNewSize, "Some of the allocated blocks lie beyond the new size of the pool.");
+
+                if(ALLOCATED_BYTES <= uNewSize)
+                {
+                    this->_UseInlineBuffer();
+                    memcpy(m_pFirst, m_pExternalAllocator->GetPointer(), ALLOCATED_BYTES);
+                    m_uAllocatedBytes = ALLOCATED_BYTES;
+
+                    delete m_pExternalAllocator;
+                    m_pExternalAllocator = null_q;
+                }
+            }
+        }
+    }
+
+private:
+
+    /// <summary>
+    /// Makes the allocator store the blocks in the internal buffer, adjusting the address of the first block to the alignment.
+    /// </summary>
+    void _UseInlineBuffer()
+    {
+        // Calculates the memory address offset (adjustment) so the buffer starts at a multiple of the alignment
+        const pointer_uint_q ALIGNMENT = scast_q(m_alignment, pointer_uint_q);
+        pointer_uint_q uAdjustment = ALIGNMENT - (rcast_q(m_arInlineBuffer, pointer_uint_q) & (ALIGNMENT - 1U));
+
+        if(uAdjustment == ALIGNMENT)
+            uAdjustment = 0;
+
+        m_pFirst = m_arInlineBuffer + uAdjustment;
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Returns the size of the buffer reserved to allocate blocks.
+    /// </summary>
+    /// <returns>
+    /// The size of the buffer reserved to allocate blocks, either the internal buffer or the external allocator's.
+    /// </returns>
+    pointer_uint_q GetPoolSize() const
+    {
+        return m_pExternalAllocator != null_q ? m_pExternalAllocator->GetPoolSize() : INLINE_POOL_SIZE;
+    }
+
+    /// <summary>
+    /// Returns if there are free blocks to allocate.
+    /// </summary>
+    /// <returns>
+    /// True if there are free blocks to allocate. Otherwise returns false.
+    /// </returns>
+    bool CanAllocate() const
+    {
+        return m_pExternalAllocator != null_q ? m_pExternalAllocator->CanAllocate() : m_uAllocatedBytes + m_uBlockSize <= INLINE_POOL_SIZE;
+    }
+
+    /// <summary>
+    /// Returns the bytes sum of current allocated blocks.
+    /// </summary>
+    /// <returns>
+    /// The bytes sum of current allocated blocks.
+    /// </returns>
+    pointer_uint_q GetAllocatedBytes() const
+    {
+        return m_pExternalAllocator != null_q ? m_pExternalAllocator->GetAllocatedBytes() : m_uAllocatedBytes;
+    }
+
+    /// <summary>
+    /// Returns a pointer to the first block of the entire chunk of memory.
+    /// </summary>
+    /// <returns>
+    /// A pointer to the first block of the entire chunk of memory.
+    /// </returns>
+    void* GetPointer() const
+    {
+        return m_pExternalAllocator != null_q ? m_pExternalAllocator->GetPointer() : m_pFirst;
+    }
+
+    /// <summary>
+    /// Returns the memory alignment.
+    /// </summary>
+    /// <returns>
+    /// The memory alignment.
+    /// </returns>
+    QAlignment GetAlignment() const
+    {
+        return m_alignment;
+    }
+
+    /// <summary>
+    /// Indicates whether the blocks are stored in the internal buffer or they have been moved to the external allocator.
+    /// </summary>
+    /// <returns>
+    /// True if the internal buffer is being used; False otherwise.
+    /// </returns>
+    bool IsUsingInlineBuffer() const
+    {
+        return m_pExternalAllocator == null_q;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The internal buffer where blocks are stored until they do not fit.
+    /// </summary>
+    u8_q m_arInlineBuffer[INLINE_BUFFER_SIZE];
+
+    /// <summary>
+    /// Pointer to the first block in the internal buffer, once its alignment has been adjusted. It is null when the external allocator is used.
+    /// </summary>
+    u8_q* m_pFirst;
+
+    /// <summary>
+    /// Size of blocks to allocate.
+    /// </summary>
+    pointer_uint_q m_uBlockSize;
+
+    /// <summary>
+    /// Sum of current allocated bytes in the internal buffer.
+    /// </summary>
+    pointer_uint_q m_uAllocatedBytes;
+
+    /// <summary>
+    /// Alignment of the blocks.
+    /// </summary>
+    QAlignment m_alignment;
+
+    /// <summary>
+    /// The allocator where blocks are stored when they do not fit in the internal buffer. It is null while the internal buffer is used.
+    /// </summary>
+    AllocatorT* m_pExternalAllocator;
+};
+
+
+// ATTRIBUTE INITIALIZATION
+// ----------------------------
+template<class T, pointer_uint_q INLINE_CAPACITY, class AllocatorT>
+const pointer_uint_q QArrayInlineAllocator<T, INLINE_CAPACITY, AllocatorT>::INLINE_POOL_SIZE;
+
+template<class T, pointer_uint_q INLINE_CAPACITY, class AllocatorT>
+const pointer_uint_q QArrayInlineAllocator<T, INLINE_CAPACITY, AllocatorT>::INLINE_BUFFER_SIZE;
+
+} // namespace Containers
+} // namespace Tools
+} // namespace QuimeraEngine
+} // namespace Kinesis
+
+#endif // __QARRAYINLINEALLOCATOR__
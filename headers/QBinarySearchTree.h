@@ -35,6 +35,10 @@
 #include "SQComparatorDefault.h"
 #include "EQTreeTraversalOrder.h"
 #include "EQIterationDirection.h"
+#include "SQTypeTraits.h"
+#include "QContainerStatistics.h"
+#include "QContainerImageHeader.h"
+#include "SQGeometricGrowthPolicy.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
@@ -59,6 +63,8 @@ namespace Containers
 /// <remarks>
 /// Nodes are placed in their corresponding position as they are added or removed. Although they follow a tree structure, removing a parent does not imply the 
 /// removal of its children.<br/>
+/// The tree is self-balanced (red-black tree), so adding, removing and searching for elements take logarithmic time in the worst case. Nodes may be rotated 
+/// after every addition or removal, which means that the shape of the tree depends on the order of such operations but the in-order sequence does not.<br/>
 /// In a binary search tree, elements cannot be modified, their position in the tree may become inconsistent since it depends on their value and the comparison algorithm.<br/>
 /// There is not a default way to traverse an binary search tree, the desired method will have to be specified when necessary.<br/>
 /// Elements are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
@@ -67,7 +73,8 @@ namespace Containers
 /// <typeparam name="T">The type of the tree elements.</typeparam>
 /// <typeparam name="AllocatorT">The allocator used to reserve memory. The default type is QPoolAllocator.</typeparam>
 /// <typeparam name="ComparatorT">The comparator. The default type is SQComparatorDefault.</typeparam>
-template<class T, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, class ComparatorT = SQComparatorDefault<T> >
+/// <typeparam name="GrowthPolicyT">The policy that calculates the new capacity when it is exceeded. The default type is SQGeometricGrowthPolicy.</typeparam>
+template<class T, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, class ComparatorT = SQComparatorDefault<T>, class GrowthPolicyT = SQGeometricGrowthPolicy>
 class QBinarySearchTree
 {
     // INTERNAL CLASSES
@@ -89,10 +96,12 @@ protected:
         /// <param name="uParentPosition">[IN] The physical position of the parent node.</param>
         /// <param name="uLeftChildPosition">[IN] The physical position of left child node.</param>
         /// <param name="uRightChildPosition">[IN] The physical position of the right child node.</param>
-        QBinaryNode(const pointer_uint_q uParentPosition, const pointer_uint_q uLeftChildPosition, const pointer_uint_q uRightChildPosition) :
+        /// <param name="bIsRed">[IN] Indicates whether the node is red (True) or black (False), used to keep the tree balanced.</param>
+        QBinaryNode(const pointer_uint_q uParentPosition, const pointer_uint_q uLeftChildPosition, const pointer_uint_q uRightChildPosition, const bool bIsRed) :
                                                                                             m_uParent(uParentPosition),
                                                                                             m_uLeft(uLeftChildPosition),
-                                                                                            m_uRight(uRightChildPosition)
+                                                                                            m_uRight(uRightChildPosition),
+                                                                                            m_bIsRed(bIsRed)
         {
         }
         
@@ -134,6 +143,17 @@ protected:
             return m_uRight;
         }
         
+        /// <summary>
+        /// Indicates whether the node is red or black.
+        /// </summary>
+        /// <returns>
+        /// True if the node is red; False if it is black.
+        /// </returns>
+        bool IsRed() const
+        {
+            return m_bIsRed;
+        }
+        
         /// <summary>
         /// Sets the physical position of the parent node.
         /// </summary>
@@ -160,6 +180,15 @@ protected:
         {
             m_uRight = uPosition;
         }
+        
+        /// <summary>
+        /// Sets the color of the node.
+        /// </summary>
+        /// <param name="bIsRed">[IN] True to make the node red; False to make it black.</param>
+        void SetRed(const bool bIsRed)
+        {
+            m_bIsRed = bIsRed;
+        }
 
 
         // ATTRIBUTES
@@ -181,6 +210,11 @@ protected:
         /// </returns>
         pointer_uint_q m_uRight;
 
+        /// <returns>
+        /// The color of the node, True means red and False means black.
+        /// </returns>
+        bool m_bIsRed;
+
     }; // class QBinaryNode
     
 public:
@@ -1025,13 +1059,6 @@ protected:
     /// Constant to symbolize the absence of a node or the end of the sequence when the tree is traversed forward.
     /// </summary>
     static const pointer_uint_q END_POSITION_FORWARD = -2;
-    
-private:
-
-    /// <summary>
-    /// The reallocation factor to be applied to calculate the new capacity on every reallocation. It must be greater than or equal to 1.
-    /// </summary>
-    static float REALLOCATION_FACTOR;
 
 
     // CONSTRUCTORS
@@ -1089,11 +1116,15 @@ public:
             tree.m_elementAllocator.CopyTo(m_elementAllocator);
             tree.m_nodeAllocator.CopyTo(m_nodeAllocator);
 
-            QBinarySearchTree::QConstBinarySearchTreeIterator itSource = tree.GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
-            QBinarySearchTree::QConstBinarySearchTreeIterator itDestination = this->GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
+            // The bytes of the elements have already been copied, which is enough for trivially copyable types
+            if(!SQTypeTraits<T>::IS_TRIVIALLY_COPYABLE)
+            {
+                QBinarySearchTree::QConstBinarySearchTreeIterator itSource = tree.GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
+                QBinarySearchTree::QConstBinarySearchTreeIterator itDestination = this->GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
 
-            for(; !itSource.IsEnd(); ++itSource, ++itDestination)
-                new(ccast_q(&*itDestination, T*)) T(*itSource);
+                for(; !itSource.IsEnd(); ++itSource, ++itDestination)
+                    new(ccast_q(&*itDestination, T*)) T(*itSource);
+            }
         }
     }
 
@@ -1110,10 +1141,13 @@ public:
     /// </remarks>
     ~QBinarySearchTree()
     {
-        QBinarySearchTree::QConstBinarySearchTreeIterator it = this->GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
+        if(!SQTypeTraits<T>::IS_TRIVIALLY_DESTRUCTIBLE)
+        {
+            QBinarySearchTree::QConstBinarySearchTreeIterator it = this->GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
 
-        for(; !it.IsEnd(); ++it)
-            (*it).~T();
+            for(; !it.IsEnd(); ++it)
+                (*it).~T();
+        }
     }
 
 
@@ -1150,11 +1184,15 @@ public:
                 tree.m_elementAllocator.CopyTo(m_elementAllocator);
                 tree.m_nodeAllocator.CopyTo(m_nodeAllocator);
 
-                QBinarySearchTree::QConstBinarySearchTreeIterator itSource = tree.GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
-                QBinarySearchTree::QConstBinarySearchTreeIterator itDestination = this->GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
+                // The bytes of the elements have already been copied, which is enough for trivially copyable types
+                if(!SQTypeTraits<T>::IS_TRIVIALLY_COPYABLE)
+                {
+                    QBinarySearchTree::QConstBinarySearchTreeIterator itSource = tree.GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
+                    QBinarySearchTree::QConstBinarySearchTreeIterator itDestination = this->GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
 
-                for(; !itSource.IsEnd(); ++itSource, ++itDestination)
-                    new(ccast_q(&*itDestination, T*)) T(*itSource);
+                    for(; !itSource.IsEnd(); ++itSource, ++itDestination)
+                        new(ccast_q(&*itDestination, T*)) T(*itSource);
+                }
             }
         }
 
@@ -1245,90 +1283,192 @@ public:
             m_pNodeBasePointer = scast_q(m_nodeAllocator.GetPointer(), QBinarySearchTree::QBinaryNode*);
         }
     }
-    
+
     /// <summary>
-    /// Adds an element to the tree as a leaf node.
+    /// Reduces the capacity of the tree so it is equal to the number of elements, releasing the memory that is not used.
     /// </summary>
     /// <remarks>
-    /// This operation may imply a reallocation, which means that any pointer to elements of this tree will be pointing to garbage.<br/>
-    /// The copy constructor of the new element will be called.
+    /// If the tree is empty, the capacity will be 1.<br/>
+    /// Since the unused blocks may be interleaved with the elements, the elements are first moved so they occupy consecutive positions in memory, 
+    /// in ascending order. This operation implies a reallocation, which means that any pointer or iterator to elements of this tree will be pointing to garbage.<br/>
+    /// Elements are moved bitwise; no assignment operator nor copy constructors are called during this operation.
     /// </remarks>
-    /// <param name="newElement">[IN] The value of the new element. There must not be any element in the tree with the same value.</param>
-    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited. It is used to create the returned iterator.</param>
-    /// <returns>
-    /// An iterator that points to the just added element. If the element was already in the tree, the returned iterator will point to the end position.
-    /// </returns>
-    QConstBinarySearchTreeIterator Add(const T &newElement, const EQTreeTraversalOrder &eTraversalOrder)
+    void ShrinkToFit()
     {
-        if(this->GetCapacity() == this->GetCount())
-            this->_ReallocateByFactor(this->GetCapacity() + 1U);
-
-        new(m_elementAllocator.Allocate()) T(newElement);
+        using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
 
-        QBinarySearchTree::QBinaryNode* pNewNode = null_q;
+        const pointer_uint_q COUNT = this->GetCount();
 
-        if(m_uRoot == QBinarySearchTree::END_POSITION_FORWARD)
+        if(COUNT > 0)
         {
-            // If the tree is empty, the root node is created
-            pNewNode = new(m_nodeAllocator.Allocate()) QBinarySearchTree::QBinaryNode(QBinarySearchTree::END_POSITION_FORWARD, 
-                                                                                      QBinarySearchTree::END_POSITION_FORWARD,
-                                                                                      QBinarySearchTree::END_POSITION_FORWARD);
-            m_uRoot = pNewNode - m_pNodeBasePointer;
-        }
-        else
-        {
-            static const int INPUT_VALUE_IS_LOWER = -1;
-            static const int INPUT_VALUE_IS_GREATER = 1;
-            QBinarySearchTree::QBinaryNode* pCurrentNode = m_pNodeBasePointer + m_uRoot;
-            T* pCurrentElement = m_pElementBasePointer + m_uRoot;
+            // Calculates the new position of every node, visiting them in in-order
+            pointer_uint_q* arNewPositions = new pointer_uint_q[this->GetCapacity()];
+            pointer_uint_q* arOldPositions = new pointer_uint_q[COUNT];
+            pointer_uint_q uIndex = 0;
+            this->_CalculateInOrderPositions(arNewPositions, arOldPositions);
 
-            int nComparisonResult = 0;
-            
-            // Performs a binary search through the tree to determine the position of the new element
-            while(pNewNode == null_q) // Until the new node is created
+            // Copies the elements and the nodes to temporary buffers in their new order, translating the positions stored in the nodes
+            u8_q* arElements = new u8_q[COUNT * sizeof(T)];
+            u8_q* arNodes = new u8_q[COUNT * sizeof(QBinarySearchTree::QBinaryNode)];
+
+            for(uIndex = 0; uIndex < COUNT; ++uIndex)
             {
-                nComparisonResult = ComparatorT::Compare(newElement, *pCurrentElement);
+                const QBinarySearchTree::QBinaryNode* pNode = m_pNodeBasePointer + arOldPositions[uIndex];
 
-                QE_ASSERT_ERROR(nComparisonResult != 0, "The input element already exists in the tree.");
+                memcpy(arElements + uIndex * sizeof(T), m_pElementBasePointer + arOldPositions[uIndex], sizeof(T));
+                new(arNodes + uIndex * sizeof(QBinarySearchTree::QBinaryNode)) QBinarySearchTree::QBinaryNode(QBinarySearchTree::_TranslatePosition(pNode->GetParent(),     arNewPositions),
+                                                                                                              QBinarySearchTree::_TranslatePosition(pNode->GetLeftChild(),  arNewPositions),
+                                                                                                              QBinarySearchTree::_TranslatePosition(pNode->GetRightChild(), arNewPositions),
+                                                                                                              pNode->IsRed());
+            }
 
-                if(nComparisonResult == INPUT_VALUE_IS_LOWER)
-                {
-                    if(pCurrentNode->GetLeftChild() != QBinarySearchTree::END_POSITION_FORWARD)
-                    {
-                        // If the new value is lower than the current element's value and there is a left child, moves down to the left child
-                        pCurrentElement = m_pElementBasePointer + pCurrentNode->GetLeftChild();
-                        pCurrentNode = m_pNodeBasePointer + pCurrentNode->GetLeftChild();
-                    }
-                    else
-                    {
-                        // If the new value is lower than the current element's value and there is not a left child, the new value occupies the left position
-                        pNewNode = new(m_nodeAllocator.Allocate()) QBinarySearchTree::QBinaryNode(pCurrentNode - m_pNodeBasePointer, 
-                                                                                                  QBinarySearchTree::END_POSITION_FORWARD, 
-                                                                                                  QBinarySearchTree::END_POSITION_FORWARD);
-                        pCurrentNode->SetLeftChild(pNewNode - m_pNodeBasePointer);
-                    }
-                }
-                else if(nComparisonResult == INPUT_VALUE_IS_GREATER)
-                {
-                    if(pCurrentNode->GetRightChild() != QBinarySearchTree::END_POSITION_FORWARD)
-                    {
-                        // If the new value is greater than the current element's value and there is a right child, moves down to the right child
-                        pCurrentElement = m_pElementBasePointer + pCurrentNode->GetRightChild();
-                        pCurrentNode = m_pNodeBasePointer + pCurrentNode->GetRightChild();
-                    }
-                    else
-                    {
-                        // If the new value is greater than the current element's value and there is not a right child, the new value occupies the right position
-                        pNewNode = new(m_nodeAllocator.Allocate()) QBinarySearchTree::QBinaryNode(pCurrentNode - m_pNodeBasePointer, 
-                                                                                                  QBinarySearchTree::END_POSITION_FORWARD, 
-                                                                                                  QBinarySearchTree::END_POSITION_FORWARD);
-                        pCurrentNode->SetRightChild(pNewNode - m_pNodeBasePointer);
-                    }
-                }
-            } // while(pNewNode != null_q)
+            // Elements are relocated bitwise on purpose, even if they are not trivially copyable, the cast just states so
+            memcpy(scast_q(m_pElementBasePointer, void*), arElements, COUNT * sizeof(T));
+            memcpy(m_pNodeBasePointer, arNodes, COUNT * sizeof(QBinarySearchTree::QBinaryNode));
+            m_uRoot = arNewPositions[m_uRoot];
+
+            delete[] arElements;
+            delete[] arNodes;
+            delete[] arNewPositions;
+            delete[] arOldPositions;
+
+            // The allocators must consider the first blocks as occupied, and the rest as free
+            m_elementAllocator.Clear();
+            m_nodeAllocator.Clear();
+
+            for(uIndex = 0; uIndex < COUNT; ++uIndex)
+            {
+                m_elementAllocator.Allocate();
+                m_nodeAllocator.Allocate();
+            }
         }
 
-        return QBinarySearchTree::QConstBinarySearchTreeIterator(this, pNewNode - m_pNodeBasePointer, eTraversalOrder);
+        const pointer_uint_q FINAL_CAPACITY = COUNT > 0 ? COUNT : 1U;
+
+        if(FINAL_CAPACITY < this->GetCapacity())
+        {
+            m_elementAllocator.Shrink(FINAL_CAPACITY * sizeof(T));
+            m_nodeAllocator.Shrink(FINAL_CAPACITY * sizeof(QBinarySearchTree::QBinaryNode));
+            m_pElementBasePointer = scast_q(m_elementAllocator.GetPointer(), T*);
+            m_pNodeBasePointer = scast_q(m_nodeAllocator.GetPointer(), QBinarySearchTree::QBinaryNode*);
+        }
+    }
+    
+    /// <summary>
+    /// Adds an element to the tree as a leaf node.
+    /// </summary>
+    /// <remarks>
+    /// This operation may imply a reallocation, which means that any pointer to elements of this tree will be pointing to garbage.<br/>
+    /// The copy constructor of the new element will be called.<br/>
+    /// The tree is rebalanced after the addition, so some nodes may be rotated; the physical position of every element does not change, though.
+    /// </remarks>
+    /// <param name="newElement">[IN] The value of the new element. There must not be any element in the tree with the same value.</param>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited. It is used to create the returned iterator.</param>
+    /// <returns>
+    /// An iterator that points to the just added element. If the element was already in the tree, the returned iterator will point to the end position.
+    /// </returns>
+    QConstBinarySearchTreeIterator Add(const T &newElement, const EQTreeTraversalOrder &eTraversalOrder)
+    {
+        return this->_AddNode(new(this->_AllocateElement()) T(newElement), eTraversalOrder);
+    }
+    
+    /// <summary>
+    /// Constructs a new element in the tree as a leaf node, calling its default constructor.
+    /// </summary>
+    /// <remarks>
+    /// This operation may imply a reallocation, which means that any pointer to elements of this tree will be pointing to garbage.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called. There must not be any element in the tree with the same value.<br/>
+    /// The tree is rebalanced after the addition, so some nodes may be rotated; the physical position of every element does not change, though.
+    /// </remarks>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited. It is used to create the returned iterator.</param>
+    /// <returns>
+    /// An iterator that points to the just added element.
+    /// </returns>
+    QConstBinarySearchTreeIterator Emplace(const EQTreeTraversalOrder &eTraversalOrder)
+    {
+        return this->_AddNode(new(this->_AllocateElement()) T(), eTraversalOrder);
+    }
+    
+    /// <summary>
+    /// Constructs a new element in the tree as a leaf node, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// This operation may imply a reallocation, which means that any pointer to elements of this tree will be pointing to garbage.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called. There must not be any element in the tree with the same value.<br/>
+    /// The tree is rebalanced after the addition, so some nodes may be rotated; the physical position of every element does not change, though.
+    /// </remarks>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited. It is used to create the returned iterator.</param>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    /// <returns>
+    /// An iterator that points to the just added element.
+    /// </returns>
+    template<class Argument1T>
+    QConstBinarySearchTreeIterator Emplace(const EQTreeTraversalOrder &eTraversalOrder, const Argument1T &argument1)
+    {
+        return this->_AddNode(new(this->_AllocateElement()) T(argument1), eTraversalOrder);
+    }
+    
+    /// <summary>
+    /// Constructs a new element in the tree as a leaf node, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// This operation may imply a reallocation, which means that any pointer to elements of this tree will be pointing to garbage.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called. There must not be any element in the tree with the same value.<br/>
+    /// The tree is rebalanced after the addition, so some nodes may be rotated; the physical position of every element does not change, though.
+    /// </remarks>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited. It is used to create the returned iterator.</param>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    /// <param name="argument2">[IN] The second argument to pass to the constructor of the element.</param>
+    /// <returns>
+    /// An iterator that points to the just added element.
+    /// </returns>
+    template<class Argument1T, class Argument2T>
+    QConstBinarySearchTreeIterator Emplace(const EQTreeTraversalOrder &eTraversalOrder, const Argument1T &argument1, const Argument2T &argument2)
+    {
+        return this->_AddNode(new(this->_AllocateElement()) T(argument1, argument2), eTraversalOrder);
+    }
+    
+    /// <summary>
+    /// Constructs a new element in the tree as a leaf node, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// This operation may imply a reallocation, which means that any pointer to elements of this tree will be pointing to garbage.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called. There must not be any element in the tree with the same value.<br/>
+    /// The tree is rebalanced after the addition, so some nodes may be rotated; the physical position of every element does not change, though.
+    /// </remarks>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited. It is used to create the returned iterator.</param>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    /// <param name="argument2">[IN] The second argument to pass to the constructor of the element.</param>
+    /// <param name="argument3">[IN] The third argument to pass to the constructor of the element.</param>
+    /// <returns>
+    /// An iterator that points to the just added element.
+    /// </returns>
+    template<class Argument1T, class Argument2T, class Argument3T>
+    QConstBinarySearchTreeIterator Emplace(const EQTreeTraversalOrder &eTraversalOrder, const Argument1T &argument1, const Argument2T &argument2, const Argument3T &argument3)
+    {
+        return this->_AddNode(new(this->_AllocateElement()) T(argument1, argument2, argument3), eTraversalOrder);
+    }
+    
+    /// <summary>
+    /// Constructs a new element in the tree as a leaf node, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// This operation may imply a reallocation, which means that any pointer to elements of this tree will be pointing to garbage.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called. There must not be any element in the tree with the same value.<br/>
+    /// The tree is rebalanced after the addition, so some nodes may be rotated; the physical position of every element does not change, though.
+    /// </remarks>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited. It is used to create the returned iterator.</param>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    /// <param name="argument2">[IN] The second argument to pass to the constructor of the element.</param>
+    /// <param name="argument3">[IN] The third argument to pass to the constructor of the element.</param>
+    /// <param name="argument4">[IN] The fourth argument to pass to the constructor of the element.</param>
+    /// <returns>
+    /// An iterator that points to the just added element.
+    /// </returns>
+    template<class Argument1T, class Argument2T, class Argument3T, class Argument4T>
+    QConstBinarySearchTreeIterator Emplace(const EQTreeTraversalOrder &eTraversalOrder, const Argument1T &argument1, const Argument2T &argument2, const Argument3T &argument3, const Argument4T &argument4)
+    {
+        return this->_AddNode(new(this->_AllocateElement()) T(argument1, argument2, argument3, argument4), eTraversalOrder);
     }
     
     /// <summary>
@@ -1336,7 +1476,8 @@ public:
     /// </summary>
     /// <remarks>
     /// The destructor of the element will be called.<br/>
-    /// Removing an element does not imply the removal of its child nodes; instead, they will be reordered so the right child will be always a descendant of the left child when both exist.
+    /// Removing an element does not imply the removal of its child nodes; when it has both children, its in-order successor will occupy its place in the tree.<br/>
+    /// The tree is rebalanced after the removal, so some nodes may be rotated; the physical position of the remaining elements does not change, though.
     /// </remarks>
     /// <param name="elementPosition">[IN] The position of the element to remove. It must not point to the end position.</param>
     /// <returns>
@@ -1356,62 +1497,67 @@ public:
         pointer_uint_q uElementPosition = pElement - m_pElementBasePointer;
 
         QBinarySearchTree::QBinaryNode* pNode = m_pNodeBasePointer + uElementPosition;
-        
-        pointer_uint_q uNewChild = QBinarySearchTree::END_POSITION_FORWARD;
-
-        if(pNode->GetRightChild() != QBinarySearchTree::END_POSITION_FORWARD && 
-           pNode->GetLeftChild()  != QBinarySearchTree::END_POSITION_FORWARD)
-        {
-            // The node has both left and right children
 
-            // The node will be replaced with the left child
-            uNewChild = pNode->GetLeftChild();
-
-            // The right child will be appended to the deepest right child in the branch of the node's left child
-            QBinarySearchTree::QBinaryNode* pRightMostChild = m_pNodeBasePointer + pNode->GetLeftChild();
+        // The node that will occupy the place of the node which is unlinked from the tree, and the parent of such place
+        pointer_uint_q uNewChild = QBinarySearchTree::END_POSITION_FORWARD;
+        pointer_uint_q uNewChildParent = QBinarySearchTree::END_POSITION_FORWARD;
 
-            while(pRightMostChild->GetRightChild() != QBinarySearchTree::END_POSITION_FORWARD)
-                pRightMostChild = m_pNodeBasePointer + pRightMostChild->GetRightChild();
+        // The color of the node that is unlinked from the tree; if it is black, the tree must be rebalanced
+        bool bUnlinkedNodeWasRed = pNode->IsRed();
 
-            pRightMostChild->SetRightChild(pNode->GetRightChild());
-            QBinarySearchTree::QBinaryNode* pRightChildNode = m_pNodeBasePointer + pNode->GetRightChild();
-            pRightChildNode->SetParent(pRightMostChild - m_pNodeBasePointer);
+        if(pNode->GetLeftChild() == QBinarySearchTree::END_POSITION_FORWARD)
+        {
+            // The node has right child only, or no children
+            // The node will be replaced with the right child
+            uNewChild = pNode->GetRightChild();
+            uNewChildParent = pNode->GetParent();
+            this->_ReplaceSubtree(uElementPosition, uNewChild);
         }
-        else if(pNode->GetLeftChild() != QBinarySearchTree::END_POSITION_FORWARD)
+        else if(pNode->GetRightChild() == QBinarySearchTree::END_POSITION_FORWARD)
         {
             // The node has left child only
             // The node will be replaced with the left child
             uNewChild = pNode->GetLeftChild();
+            uNewChildParent = pNode->GetParent();
+            this->_ReplaceSubtree(uElementPosition, uNewChild);
         }
-        else if(pNode->GetRightChild() != QBinarySearchTree::END_POSITION_FORWARD)
+        else
         {
-            // The node has right child only
-            // The node will be replaced with the right child
-            uNewChild = pNode->GetRightChild();
-        }
+            // The node has both left and right children
+            // The node will be replaced with its successor, which is the "leftest" node in the branch of its right child
+            // Note: Nodes are relinked instead of moving elements, so the physical position of the successor does not change
+            pointer_uint_q uSuccessor = pNode->GetRightChild();
 
-        // If the node has a child that will occupy its position
-        if(uNewChild != QBinarySearchTree::END_POSITION_FORWARD)
-        {
-            // Sets the parent of the node that will occupy the position of the removed node
-            QBinarySearchTree::QBinaryNode* pNewChild = m_pNodeBasePointer + uNewChild;
-            pNewChild->SetParent(pNode->GetParent());
-        }
-        
-        // If the removed node had a parent, its child (either left or right) is set to the node that occupies its place
-        if(pNode->GetParent() != QBinarySearchTree::END_POSITION_FORWARD)
-        {
-            QBinarySearchTree::QBinaryNode* pParentNode = m_pNodeBasePointer + pNode->GetParent();
-            
-            if(pParentNode->GetLeftChild() == uElementPosition)
-                pParentNode->SetLeftChild(uNewChild);
-            else // It is the right-child
-                pParentNode->SetRightChild(uNewChild);
+            while((m_pNodeBasePointer + uSuccessor)->GetLeftChild() != QBinarySearchTree::END_POSITION_FORWARD)
+                uSuccessor = (m_pNodeBasePointer + uSuccessor)->GetLeftChild();
+
+            QBinarySearchTree::QBinaryNode* pSuccessorNode = m_pNodeBasePointer + uSuccessor;
+            bUnlinkedNodeWasRed = pSuccessorNode->IsRed();
+            uNewChild = pSuccessorNode->GetRightChild();
+
+            if(pSuccessorNode->GetParent() == uElementPosition)
+            {
+                // The successor is the right child of the node
+                uNewChildParent = uSuccessor;
+            }
+            else
+            {
+                // The successor is replaced with its right child and then it adopts the node's right child
+                uNewChildParent = pSuccessorNode->GetParent();
+                this->_ReplaceSubtree(uSuccessor, uNewChild);
+                pSuccessorNode->SetRightChild(pNode->GetRightChild());
+                (m_pNodeBasePointer + pSuccessorNode->GetRightChild())->SetParent(uSuccessor);
+            }
+
+            // The successor occupies the place of the node, adopting its left child and its color
+            this->_ReplaceSubtree(uElementPosition, uSuccessor);
+            pSuccessorNode->SetLeftChild(pNode->GetLeftChild());
+            (m_pNodeBasePointer + pSuccessorNode->GetLeftChild())->SetParent(uSuccessor);
+            pSuccessorNode->SetRed(pNode->IsRed());
         }
 
-        // Updates the root of the tree if necessary
-        if(uElementPosition == m_uRoot)
-            m_uRoot = uNewChild;
+        if(!bUnlinkedNodeWasRed)
+            this->_RebalanceAfterRemove(uNewChild, uNewChildParent);
 
         // Both element and node are destroyed
         pElement->~T();
@@ -1585,18 +1731,539 @@ public:
         this->m_elementAllocator.CopyTo(destinationTree.m_elementAllocator);
         destinationTree.m_uRoot = m_uRoot;
     }
+
+    /// <summary>
+    /// Gets information about the memory usage and the shape of the tree.
+    /// </summary>
+    /// <remarks>
+    /// The height and the average depth are calculated by visiting every node, without using additional memory.
+    /// </remarks>
+    /// <returns>
+    /// The number of elements, the capacity, the bytes reserved and used by both the element allocator and the node allocator, the height and 
+    /// the average depth of the nodes.
+    /// </returns>
+    QContainerStatistics GetStatistics() const
+    {
+        pointer_uint_q uSumOfDepths = 0;
+        pointer_uint_q uMaximumDepth = 0;
+
+        // Depth-first traversal that uses the parent of every node to go back, the previous node tells which child subtree has been visited already
+        pointer_uint_q uNode = m_uRoot;
+        pointer_uint_q uPreviousNode = QBinarySearchTree::END_POSITION_FORWARD;
+        pointer_uint_q uDepth = 0;
+
+        while(uNode != QBinarySearchTree::END_POSITION_FORWARD)
+        {
+            const QBinaryNode* pNode = m_pNodeBasePointer + uNode;
+            pointer_uint_q uNextNode = pNode->GetParent();
+
+            if(uPreviousNode == pNode->GetParent())
+            {
+                uSumOfDepths += uDepth;
+
+                if(uDepth > uMaximumDepth)
+                    uMaximumDepth = uDepth;
+
+                if(pNode->GetLeftChild() != QBinarySearchTree::END_POSITION_FORWARD)
+                    uNextNode = pNode->GetLeftChild();
+                else if(pNode->GetRightChild() != QBinarySearchTree::END_POSITION_FORWARD)
+                    uNextNode = pNode->GetRightChild();
+            }
+            else if(uPreviousNode == pNode->GetLeftChild() && pNode->GetRightChild() != QBinarySearchTree::END_POSITION_FORWARD)
+            {
+                uNextNode = pNode->GetRightChild();
+            }
+
+            if(uNextNode == pNode->GetParent())
+                --uDepth;
+            else
+                ++uDepth;
+
+            uPreviousNode = uNode;
+            uNode = uNextNode;
+        }
+
+        QContainerStatistics statistics;
+        statistics.SetCount(this->GetCount());
+        statistics.SetCapacity(this->GetCapacity());
+        statistics.SetReservedBytes(m_elementAllocator.GetPoolSize() + m_nodeAllocator.GetPoolSize());
+        statistics.SetUsedBytes(m_elementAllocator.GetAllocatedBytes() + m_nodeAllocator.GetAllocatedBytes());
+
+        if(m_uRoot != QBinarySearchTree::END_POSITION_FORWARD)
+        {
+            statistics.SetHeight(uMaximumDepth + 1U);
+            statistics.SetAverageDepth(scast_q(uSumOfDepths, float_q) / scast_q(this->GetCount(), float_q));
+        }
+
+        return statistics;
+    }
+
+    /// <summary>
+    /// Writes a flat binary image of the tree, which can be read without deserializing the elements by QBinarySearchTreeImageView.
+    /// </summary>
+    /// <remarks>
+    /// The image is composed of a QContainerImageHeader, which stores the position of the root node, followed by the nodes and then by the bytes 
+    /// of the elements, both sorted in ascending order. Every node occupies four 32-bits values: the parent, the left child, the right child and 
+    /// whether it is red (1) or black (0).<br/>
+    /// Elements are not padded: the header occupies 32 bytes and every node 16 bytes, so the elements are aligned in the image only if their 
+    /// alignment is not greater than 16 bytes. Trees of types with bigger alignments cannot be written.<br/>
+    /// Only trees whose elements are trivially copyable (see SQTypeTraits) can be written. The tree is not modified.
+    /// </remarks>
+    /// <typeparam name="BinaryStreamWriterT">The type of the writer, normally QBinaryStreamWriter. It must provide the methods Write and WriteBytes.</typeparam>
+    /// <param name="writer">[IN/OUT] The writer that receives the image.</param>
+    template<class BinaryStreamWriterT>
+    void WriteImage(BinaryStreamWriterT &writer) const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+        using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+        QE_ASSERT_ERROR(SQTypeTraits<T>::IS_TRIVIALLY_COPYABLE, "Only trees whose elements are trivially copyable can be written as images.");
+        QE_ASSERT_ERROR(alignof_q(T) <= 16U, "Only trees whose elements have an alignment lower than or equal to 16 bytes can be written as images.");
+
+        const pointer_uint_q COUNT = this->GetCount();
+
+        if(COUNT == 0)
+        {
+            writer.Write(QContainerImageHeader(QContainerImageHeader::CONTAINER_TYPE_BINARYSEARCHTREE, sizeof(T), 0, QContainerImageHeader::NULL_POSITION));
+        }
+        else
+        {
+            pointer_uint_q* arNewPositions = new pointer_uint_q[this->GetCapacity()];
+            pointer_uint_q* arOldPositions = new pointer_uint_q[COUNT];
+            this->_CalculateInOrderPositions(arNewPositions, arOldPositions);
+
+            // Nodes and elements are gathered in their new order so they are written at once
+            u32_q* arNodes = new u32_q[COUNT * 4U];
+            u8_q* arElements = new u8_q[COUNT * sizeof(T)];
+
+            for(pointer_uint_q uIndex = 0; uIndex < COUNT; ++uIndex)
+            {
+                const QBinarySearchTree::QBinaryNode* pNode = m_pNodeBasePointer + arOldPositions[uIndex];
+
+                arNodes[uIndex * 4U]      = QBinarySearchTree::_TranslateImagePosition(pNode->GetParent(),     arNewPositions);
+                arNodes[uIndex * 4U + 1U] = QBinarySearchTree::_TranslateImagePosition(pNode->GetLeftChild(),  arNewPositions);
+                arNodes[uIndex * 4U + 2U] = QBinarySearchTree::_TranslateImagePosition(pNode->GetRightChild(), arNewPositions);
+                arNodes[uIndex * 4U + 3U] = pNode->IsRed() ? 1U : 0;
+                memcpy(arElements + uIndex * sizeof(T), m_pElementBasePointer + arOldPositions[uIndex], sizeof(T));
+            }
+
+            writer.Write(QContainerImageHeader(QContainerImageHeader::CONTAINER_TYPE_BINARYSEARCHTREE, sizeof(T), COUNT, scast_q(arNewPositions[m_uRoot], u32_q)));
+            writer.WriteBytes(arNodes, COUNT * 4U * sizeof(u32_q));
+            writer.WriteBytes(arElements, COUNT * sizeof(T));
+
+            delete[] arNodes;
+            delete[] arElements;
+            delete[] arNewPositions;
+            delete[] arOldPositions;
+        }
+    }
     
 private:
 
     /// <summary>
-    /// Increases the capacity of the tree, reserving memory for more elements than necessary, depending on the reallocation factor.
+    /// Reserves the space of a new element, without constructing it.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the tree is exceeded, a reallocation will take place.
+    /// </remarks>
+    /// <returns>
+    /// The address where the new element must be constructed.
+    /// </returns>
+    void* _AllocateElement()
+    {
+        if(this->GetCapacity() == this->GetCount())
+            this->_ReallocateByPolicy(this->GetCapacity() + 1U);
+
+        return m_elementAllocator.Allocate();
+    }
+
+    /// <summary>
+    /// Creates the node of a just constructed element and links it to the tree as a leaf node, rebalancing the tree afterwards.
+    /// </summary>
+    /// <param name="pNewElement">[IN] The just constructed element. It must have been allocated using the _AllocateElement method.</param>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements of the tree will be visited. It is used to create the returned iterator.</param>
+    /// <returns>
+    /// An iterator that points to the new element.
+    /// </returns>
+    QConstBinarySearchTreeIterator _AddNode(const T* pNewElement, const EQTreeTraversalOrder &eTraversalOrder)
+    {
+        QBinarySearchTree::QBinaryNode* pNewNode = null_q;
+
+        if(m_uRoot == QBinarySearchTree::END_POSITION_FORWARD)
+        {
+            // If the tree is empty, the root node is created
+            pNewNode = new(m_nodeAllocator.Allocate()) QBinarySearchTree::QBinaryNode(QBinarySearchTree::END_POSITION_FORWARD, 
+                                                                                      QBinarySearchTree::END_POSITION_FORWARD,
+                                                                                      QBinarySearchTree::END_POSITION_FORWARD,
+                                                                                      false);
+            m_uRoot = pNewNode - m_pNodeBasePointer;
+        }
+        else
+        {
+            static const int INPUT_VALUE_IS_LOWER = -1;
+            static const int INPUT_VALUE_IS_GREATER = 1;
+            QBinarySearchTree::QBinaryNode* pCurrentNode = m_pNodeBasePointer + m_uRoot;
+            T* pCurrentElement = m_pElementBasePointer + m_uRoot;
+
+            int nComparisonResult = 0;
+            
+            // Performs a binary search through the tree to determine the position of the new element
+            while(pNewNode == null_q) // Until the new node is created
+            {
+                nComparisonResult = ComparatorT::Compare(*pNewElement, *pCurrentElement);
+
+                QE_ASSERT_ERROR(nComparisonResult != 0, "The input element already exists in the tree.");
+
+                if(nComparisonResult == INPUT_VALUE_IS_LOWER)
+                {
+                    if(pCurrentNode->GetLeftChild() != QBinarySearchTree::END_POSITION_FORWARD)
+                    {
+                        // If the new value is lower than the current element's value and there is a left child, moves down to the left child
+                        pCurrentElement = m_pElementBasePointer + pCurrentNode->GetLeftChild();
+                        pCurrentNode = m_pNodeBasePointer + pCurrentNode->GetLeftChild();
+                    }
+                    else
+                    {
+                        // If the new value is lower than the current element's value and there is not a left child, the new value occupies the left position
+                        pNewNode = new(m_nodeAllocator.Allocate()) QBinarySearchTree::QBinaryNode(pCurrentNode - m_pNodeBasePointer, 
+                                                                                                  QBinarySearchTree::END_POSITION_FORWARD, 
+                                                                                                  QBinarySearchTree::END_POSITION_FORWARD,
+                                                                                                  true);
+                        pCurrentNode->SetLeftChild(pNewNode - m_pNodeBasePointer);
+                    }
+                }
+                else if(nComparisonResult == INPUT_VALUE_IS_GREATER)
+                {
+                    if(pCurrentNode->GetRightChild() != QBinarySearchTree::END_POSITION_FORWARD)
+                    {
+                        // If the new value is greater than the current element's value and there is a right child, moves down to the right child
+                        pCurrentElement = m_pElementBasePointer + pCurrentNode->GetRightChild();
+                        pCurrentNode = m_pNodeBasePointer + pCurrentNode->GetRightChild();
+                    }
+                    else
+                    {
+                        // If the new value is greater than the current element's value and there is not a right child, the new value occupies the right position
+                        pNewNode = new(m_nodeAllocator.Allocate()) QBinarySearchTree::QBinaryNode(pCurrentNode - m_pNodeBasePointer, 
+                                                                                                  QBinarySearchTree::END_POSITION_FORWARD, 
+                                                                                                  QBinarySearchTree::END_POSITION_FORWARD,
+                                                                                                  true);
+                        pCurrentNode->SetRightChild(pNewNode - m_pNodeBasePointer);
+                    }
+                }
+            } // while(pNewNode != null_q)
+
+            this->_RebalanceAfterAdd(pNewNode - m_pNodeBasePointer);
+        }
+
+        return QBinarySearchTree::QConstBinarySearchTreeIterator(this, pNewNode - m_pNodeBasePointer, eTraversalOrder);
+    }
+
+    /// <summary>
+    /// Increases the capacity of the tree, reserving memory for more elements than necessary, depending on the growth policy.
     /// </summary>
     /// <param name="uNumberOfElements">[IN] The number of elements for which to reserve memory. It should be greater than the
     /// current capacity or nothing will happen.</param>
-    void _ReallocateByFactor(const pointer_uint_q uNumberOfElements)
+    void _ReallocateByPolicy(const pointer_uint_q uNumberOfElements)
     {
-        const pointer_uint_q FINAL_CAPACITY = scast_q(scast_q(uNumberOfElements, float) * QBinarySearchTree::REALLOCATION_FACTOR, pointer_uint_q);
-        this->Reserve(FINAL_CAPACITY);
+        this->Reserve(GrowthPolicyT::GetNewCapacity(uNumberOfElements));
+    }
+
+    /// <summary>
+    /// Calculates the position every node would occupy if the nodes were stored in in-order, this is, sorted.
+    /// </summary>
+    /// <param name="arNewPositions">[OUT] The new position of every node, indexed by the current position. It must have as many elements as the capacity.</param>
+    /// <param name="arOldPositions">[OUT] The current position of every node, indexed by the new position. It must have as many elements as nodes in the tree.</param>
+    void _CalculateInOrderPositions(pointer_uint_q* arNewPositions, pointer_uint_q* arOldPositions) const
+    {
+        pointer_uint_q uIndex = 0;
+        pointer_uint_q uCurrent = m_uRoot;
+
+        while((m_pNodeBasePointer + uCurrent)->GetLeftChild() != QBinarySearchTree::END_POSITION_FORWARD)
+            uCurrent = (m_pNodeBasePointer + uCurrent)->GetLeftChild();
+
+        while(uCurrent != QBinarySearchTree::END_POSITION_FORWARD)
+        {
+            arNewPositions[uCurrent] = uIndex;
+            arOldPositions[uIndex] = uCurrent;
+            ++uIndex;
+
+            if((m_pNodeBasePointer + uCurrent)->GetRightChild() != QBinarySearchTree::END_POSITION_FORWARD)
+            {
+                // The next node is the leftmost node of the right subtree
+                uCurrent = (m_pNodeBasePointer + uCurrent)->GetRightChild();
+
+                while((m_pNodeBasePointer + uCurrent)->GetLeftChild() != QBinarySearchTree::END_POSITION_FORWARD)
+                    uCurrent = (m_pNodeBasePointer + uCurrent)->GetLeftChild();
+            }
+            else
+            {
+                // The next node is the first ancestor of which the current node is in the left subtree
+                pointer_uint_q uParent = (m_pNodeBasePointer + uCurrent)->GetParent();
+
+                while(uParent != QBinarySearchTree::END_POSITION_FORWARD && (m_pNodeBasePointer + uParent)->GetRightChild() == uCurrent)
+                {
+                    uCurrent = uParent;
+                    uParent = (m_pNodeBasePointer + uCurrent)->GetParent();
+                }
+
+                uCurrent = uParent;
+            }
+        }
+    }
+
+    /// <summary>
+    /// Obtains the position a node will occupy in a container image, after the nodes are rearranged.
+    /// </summary>
+    /// <param name="uPosition">[IN] The current position of the node. It can be QBinarySearchTree::END_POSITION_FORWARD.</param>
+    /// <param name="arNewPositions">[IN] The new position of every node, indexed by the current position.</param>
+    /// <returns>
+    /// The new position of the node, or QContainerImageHeader::NULL_POSITION if the input position is QBinarySearchTree::END_POSITION_FORWARD.
+    /// </returns>
+    static Kinesis::QuimeraEngine::Common::DataTypes::u32_q _TranslateImagePosition(const pointer_uint_q uPosition, const pointer_uint_q* arNewPositions)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+        return uPosition == QBinarySearchTree::END_POSITION_FORWARD ? QContainerImageHeader::NULL_POSITION : scast_q(arNewPositions[uPosition], u32_q);
+    }
+
+    /// <summary>
+    /// Obtains the position a node will occupy after the nodes are rearranged.
+    /// </summary>
+    /// <param name="uPosition">[IN] The current position of the node. It can be QBinarySearchTree::END_POSITION_FORWARD.</param>
+    /// <param name="arNewPositions">[IN] The new position of every node, indexed by the current position.</param>
+    /// <returns>
+    /// The new position of the node, or QBinarySearchTree::END_POSITION_FORWARD if the input position is QBinarySearchTree::END_POSITION_FORWARD.
+    /// </returns>
+    static pointer_uint_q _TranslatePosition(const pointer_uint_q uPosition, const pointer_uint_q* arNewPositions)
+    {
+        return uPosition == QBinarySearchTree::END_POSITION_FORWARD ? QBinarySearchTree::END_POSITION_FORWARD : arNewPositions[uPosition];
+    }
+
+    /// <summary>
+    /// Checks whether a node is red. Non-existent nodes are considered black.
+    /// </summary>
+    /// <param name="uNode">[IN] The physical position of the node. It may be the end position.</param>
+    /// <returns>
+    /// True if the node exists and is red; False otherwise.
+    /// </returns>
+    bool _IsRed(const pointer_uint_q uNode) const
+    {
+        return uNode != QBinarySearchTree::END_POSITION_FORWARD && (m_pNodeBasePointer + uNode)->IsRed();
+    }
+
+    /// <summary>
+    /// Makes a subtree occupy the place of another subtree in the tree, as a child of its parent or as the root.
+    /// </summary>
+    /// <remarks>
+    /// The children of the replaced node are not modified.
+    /// </remarks>
+    /// <param name="uReplacedNode">[IN] The physical position of the node to be replaced. It must exist.</param>
+    /// <param name="uNewNode">[IN] The physical position of the node that will take its place. It may be the end position.</param>
+    void _ReplaceSubtree(const pointer_uint_q uReplacedNode, const pointer_uint_q uNewNode)
+    {
+        const pointer_uint_q PARENT_POSITION = (m_pNodeBasePointer + uReplacedNode)->GetParent();
+
+        if(PARENT_POSITION == QBinarySearchTree::END_POSITION_FORWARD)
+            m_uRoot = uNewNode;
+        else if((m_pNodeBasePointer + PARENT_POSITION)->GetLeftChild() == uReplacedNode)
+            (m_pNodeBasePointer + PARENT_POSITION)->SetLeftChild(uNewNode);
+        else // It is the right-child
+            (m_pNodeBasePointer + PARENT_POSITION)->SetRightChild(uNewNode);
+
+        if(uNewNode != QBinarySearchTree::END_POSITION_FORWARD)
+            (m_pNodeBasePointer + uNewNode)->SetParent(PARENT_POSITION);
+    }
+
+    /// <summary>
+    /// Rotates a node to the left, so its right child takes its place and the node becomes the left child of the former.
+    /// </summary>
+    /// <param name="uNode">[IN] The physical position of the node to rotate. It must have a right child.</param>
+    void _RotateLeft(const pointer_uint_q uNode)
+    {
+        QBinarySearchTree::QBinaryNode* pNode = m_pNodeBasePointer + uNode;
+        const pointer_uint_q PIVOT_POSITION = pNode->GetRightChild();
+        QBinarySearchTree::QBinaryNode* pPivotNode = m_pNodeBasePointer + PIVOT_POSITION;
+
+        // The left child of the pivot is moved to the right of the node
+        pNode->SetRightChild(pPivotNode->GetLeftChild());
+
+        if(pPivotNode->GetLeftChild() != QBinarySearchTree::END_POSITION_FORWARD)
+            (m_pNodeBasePointer + pPivotNode->GetLeftChild())->SetParent(uNode);
+
+        this->_ReplaceSubtree(uNode, PIVOT_POSITION);
+        pPivotNode->SetLeftChild(uNode);
+        pNode->SetParent(PIVOT_POSITION);
+    }
+
+    /// <summary>
+    /// Rotates a node to the right, so its left child takes its place and the node becomes the right child of the former.
+    /// </summary>
+    /// <param name="uNode">[IN] The physical position of the node to rotate. It must have a left child.</param>
+    void _RotateRight(const pointer_uint_q uNode)
+    {
+        QBinarySearchTree::QBinaryNode* pNode = m_pNodeBasePointer + uNode;
+        const pointer_uint_q PIVOT_POSITION = pNode->GetLeftChild();
+        QBinarySearchTree::QBinaryNode* pPivotNode = m_pNodeBasePointer + PIVOT_POSITION;
+
+        // The right child of the pivot is moved to the left of the node
+        pNode->SetLeftChild(pPivotNode->GetRightChild());
+
+        if(pPivotNode->GetRightChild() != QBinarySearchTree::END_POSITION_FORWARD)
+            (m_pNodeBasePointer + pPivotNode->GetRightChild())->SetParent(uNode);
+
+        this->_ReplaceSubtree(uNode, PIVOT_POSITION);
+        pPivotNode->SetRightChild(uNode);
+        pNode->SetParent(PIVOT_POSITION);
+    }
+
+    /// <summary>
+    /// Restores the properties of the red-black tree after a red leaf node has been added, recoloring and rotating its ancestors when necessary.
+    /// </summary>
+    /// <param name="uNode">[IN] The physical position of the added node.</param>
+    void _RebalanceAfterAdd(pointer_uint_q uNode)
+    {
+        // While there are two consecutive red nodes (the root is always black, so the grandparent exists)
+        while(uNode != m_uRoot && this->_IsRed((m_pNodeBasePointer + uNode)->GetParent()))
+        {
+            pointer_uint_q uParent = (m_pNodeBasePointer + uNode)->GetParent();
+            const pointer_uint_q GRANDPARENT_POSITION = (m_pNodeBasePointer + uParent)->GetParent();
+            QBinarySearchTree::QBinaryNode* pGrandparentNode = m_pNodeBasePointer + GRANDPARENT_POSITION;
+
+            const bool bParentIsLeftChild = pGrandparentNode->GetLeftChild() == uParent;
+            const pointer_uint_q UNCLE_POSITION = bParentIsLeftChild ? pGrandparentNode->GetRightChild() : 
+                                                                       pGrandparentNode->GetLeftChild();
+
+            if(this->_IsRed(UNCLE_POSITION))
+            {
+                // Both the parent and the uncle are red, the red color is moved up to the grandparent
+                (m_pNodeBasePointer + uParent)->SetRed(false);
+                (m_pNodeBasePointer + UNCLE_POSITION)->SetRed(false);
+                pGrandparentNode->SetRed(true);
+                uNode = GRANDPARENT_POSITION;
+            }
+            else
+            {
+                if(bParentIsLeftChild)
+                {
+                    // If the node is an inner grandchild, it is rotated to become an outer grandchild
+                    if((m_pNodeBasePointer + uParent)->GetRightChild() == uNode)
+                    {
+                        this->_RotateLeft(uParent);
+                        uParent = uNode;
+                    }
+
+                    this->_RotateRight(GRANDPARENT_POSITION);
+                }
+                else
+                {
+                    // If the node is an inner grandchild, it is rotated to become an outer grandchild
+                    if((m_pNodeBasePointer + uParent)->GetLeftChild() == uNode)
+                    {
+                        this->_RotateRight(uParent);
+                        uParent = uNode;
+                    }
+
+                    this->_RotateLeft(GRANDPARENT_POSITION);
+                }
+
+                // The parent now occupies the place of the grandparent and the tree is balanced
+                (m_pNodeBasePointer + uParent)->SetRed(false);
+                pGrandparentNode->SetRed(true);
+                uNode = m_uRoot;
+            }
+        }
+
+        (m_pNodeBasePointer + m_uRoot)->SetRed(false);
+    }
+
+    /// <summary>
+    /// Restores the properties of the red-black tree after a black node has been unlinked, recoloring and rotating the nodes around 
+    /// the place it occupied when necessary.
+    /// </summary>
+    /// <param name="uNode">[IN] The physical position of the node that occupies the place of the unlinked node. It may be the end position.</param>
+    /// <param name="uParent">[IN] The physical position of the parent of such place. It is the end position when the place is the root.</param>
+    void _RebalanceAfterRemove(pointer_uint_q uNode, pointer_uint_q uParent)
+    {
+        // While the branch of the node lacks one black node
+        while(uNode != m_uRoot && !this->_IsRed(uNode))
+        {
+            QBinarySearchTree::QBinaryNode* pParentNode = m_pNodeBasePointer + uParent;
+            const bool bNodeIsLeftChild = pParentNode->GetLeftChild() == uNode;
+
+            // Note: The sibling always exists since its branch has more black nodes than the node's branch
+            pointer_uint_q uSibling = bNodeIsLeftChild ? pParentNode->GetRightChild() : pParentNode->GetLeftChild();
+
+            if(this->_IsRed(uSibling))
+            {
+                // The sibling is red, the parent is rotated so the new sibling is black
+                (m_pNodeBasePointer + uSibling)->SetRed(false);
+                pParentNode->SetRed(true);
+
+                if(bNodeIsLeftChild)
+                {
+                    this->_RotateLeft(uParent);
+                    uSibling = pParentNode->GetRightChild();
+                }
+                else
+                {
+                    this->_RotateRight(uParent);
+                    uSibling = pParentNode->GetLeftChild();
+                }
+            }
+
+            QBinarySearchTree::QBinaryNode* pSiblingNode = m_pNodeBasePointer + uSibling;
+
+            if(!this->_IsRed(pSiblingNode->GetLeftChild()) && !this->_IsRed(pSiblingNode->GetRightChild()))
+            {
+                // Both children of the sibling are black, the lack of a black node is moved up to the parent
+                pSiblingNode->SetRed(true);
+                uNode = uParent;
+                uParent = pParentNode->GetParent();
+            }
+            else
+            {
+                if(bNodeIsLeftChild)
+                {
+                    // If the outer child of the sibling is black, the sibling is rotated so it becomes red
+                    if(!this->_IsRed(pSiblingNode->GetRightChild()))
+                    {
+                        (m_pNodeBasePointer + pSiblingNode->GetLeftChild())->SetRed(false);
+                        pSiblingNode->SetRed(true);
+                        this->_RotateRight(uSibling);
+                        uSibling = pParentNode->GetRightChild();
+                        pSiblingNode = m_pNodeBasePointer + uSibling;
+                    }
+
+                    pSiblingNode->SetRed(pParentNode->IsRed());
+                    pParentNode->SetRed(false);
+                    (m_pNodeBasePointer + pSiblingNode->GetRightChild())->SetRed(false);
+                    this->_RotateLeft(uParent);
+                }
+                else
+                {
+                    // If the outer child of the sibling is black, the sibling is rotated so it becomes red
+                    if(!this->_IsRed(pSiblingNode->GetLeftChild()))
+                    {
+                        (m_pNodeBasePointer + pSiblingNode->GetRightChild())->SetRed(false);
+                        pSiblingNode->SetRed(true);
+                        this->_RotateLeft(uSibling);
+                        uSibling = pParentNode->GetLeftChild();
+                        pSiblingNode = m_pNodeBasePointer + uSibling;
+                    }
+
+                    pSiblingNode->SetRed(pParentNode->IsRed());
+                    pParentNode->SetRed(false);
+                    (m_pNodeBasePointer + pSiblingNode->GetLeftChild())->SetRed(false);
+                    this->_RotateRight(uParent);
+                }
+
+                // The tree is balanced
+                uNode = m_uRoot;
+            }
+        }
+
+        if(uNode != QBinarySearchTree::END_POSITION_FORWARD)
+            (m_pNodeBasePointer + uNode)->SetRed(false);
     }
 
     // PROPERTIES
@@ -1681,11 +2348,8 @@ protected:
 
 // ATTRIBUTE INITIALIZATION
 // ----------------------------
-template <class T, class AllocatorT, class ComparatorT>
-pointer_uint_q QBinarySearchTree<T, AllocatorT, ComparatorT>::sm_uDefaultCapacity = 1;
-
-template<class T, class AllocatorT, class ComparatorT>
-float QBinarySearchTree<T, AllocatorT, ComparatorT>::REALLOCATION_FACTOR = 1.5f;
+template <class T, class AllocatorT, class ComparatorT, class GrowthPolicyT>
+pointer_uint_q QBinarySearchTree<T, AllocatorT, ComparatorT, GrowthPolicyT>::sm_uDefaultCapacity = 1;
 
 
 } //namespace Containers
@@ -0,0 +1,233 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QBINARYSEARCHTREEIMAGEVIEW__
+#define __QBINARYSEARCHTREEIMAGEVIEW__
+
+#include "DataTypesDefinitions.h"
+#include "ToolsDefinitions.h"
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+#include "SQComparatorDefault.h"
+#include "QContainerImageHeader.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Provides read-only access to the elements of a binary search tree image, written by QBinarySearchTree::WriteImage.
+/// </summary>
+/// <remarks>
+/// The view does not copy nor deserialize the image, nodes and elements are read directly from the buffer, which may be a memory-mapped file.<br/>
+/// Elements are stored in ascending order, so they can be traversed sequentially by their position; searches descend through the nodes from 
+/// the root, like in the original tree.<br/>
+/// The buffer is not owned by the view and must remain valid while the view is used. It must be aligned, at least, to the alignment of the elements, 
+/// which cannot be greater than 16 bytes since the elements are not padded in the image.
+/// </remarks>
+/// <typeparam name="T">The type of the elements stored in the image. It must be the same type used to write the image.</typeparam>
+/// <typeparam name="ComparatorT">Optional. The type of comparator used to search for elements. It must be the same order used by the tree that 
+/// wrote the image. By default, SQComparatorDefault will be used.</typeparam>
+template<class T, class ComparatorT = SQComparatorDefault<T> >
+class QBinarySearchTreeImageView
+{
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The position returned when an element is not found.
+    /// </summary>
+    static const pointer_uint_q END_POSITION;
+
+protected:
+
+    /// <summary>
+    /// The number of 32-bits values that compose every node in the image.
+    /// </summary>
+    static const pointer_uint_q NODE_SIZE;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the image to read.
+    /// </summary>
+    /// <param name="pImage">[IN] The address of the first byte of the image. It must not be null and it must contain a binary search tree image 
+    /// whose elements occupy the same size as T.</param>
+    explicit QBinarySearchTreeImageView(const void* pImage) : m_pHeader(scast_q(pImage, const QContainerImageHeader*)),
+                                                              m_pNodes(rcast_q(scast_q(pImage, const u8_q*) + sizeof(QContainerImageHeader), const u32_q*)),
+                                                              m_pElements(null_q)
+    {
+        QE_ASSERT_ERROR(pImage != null_q, "The input image cannot be null.");
+        QE_ASSERT_ERROR(rcast_q(pImage, pointer_uint_q) % sizeof(u32_q) == 0 && rcast_q(pImage, pointer_uint_q) % alignof_q(T) == 0, 
+                        "The input image must be aligned, at least, to 4 bytes and to the alignment of the elements.");
+        QE_ASSERT_ERROR(m_pHeader->IsCompatible(QContainerImageHeader::CONTAINER_TYPE_BINARYSEARCHTREE, sizeof(T)), "The input buffer does not contain a binary search tree image of elements of the expected type.");
+
+        m_pElements = rcast_q(m_pNodes + m_pHeader->GetCount() * QBinarySearchTreeImageView::NODE_SIZE, const T*);
+        QE_ASSERT_ERROR(alignof_q(T) <= 16U, "The alignment of the elements cannot be greater than 16 bytes, since they are not padded in the image.");
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Searches for an element in the image.
+    /// </summary>
+    /// <remarks>
+    /// Elements are compared using the comparator. The cost of the search is logarithmic, as in the tree that wrote the image.
+    /// </remarks>
+    /// <param name="value">[IN] The value of the element to search for.</param>
+    /// <returns>
+    /// The position of the element, which is also its index in ascending order. If the element is not found, it returns END_POSITION.
+    /// </returns>
+    pointer_uint_q Find(const T &value) const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::i8_q;
+
+        u32_q uNode = m_pHeader->GetRoot();
+
+        while(uNode != QContainerImageHeader::NULL_POSITION)
+        {
+            const i8_q COMPARISON_RESULT = ComparatorT::Compare(value, m_pElements[uNode]);
+
+            if(COMPARISON_RESULT == 0)
+                return scast_q(uNode, pointer_uint_q);
+            else if(COMPARISON_RESULT < 0)
+                uNode = m_pNodes[uNode * QBinarySearchTreeImageView::NODE_SIZE + 1U]; // Left child
+            else
+                uNode = m_pNodes[uNode * QBinarySearchTreeImageView::NODE_SIZE + 2U]; // Right child
+        }
+
+        return QBinarySearchTreeImageView::END_POSITION;
+    }
+
+    /// <summary>
+    /// Checks whether an element is stored in the image.
+    /// </summary>
+    /// <param name="value">[IN] The value of the element to search for.</param>
+    /// <returns>
+    /// True if the element is in the image; False otherwise.
+    /// </returns>
+    bool Contains(const T &value) const
+    {
+        return this->Find(value) != QBinarySearchTreeImageView::END_POSITION;
+    }
+
+    /// <summary>
+    /// Gets an element of the image.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of the element, which is its index in ascending order. It must be lower than the number of elements.</param>
+    /// <returns>
+    /// A reference to the element, stored in the image.
+    /// </returns>
+    const T& GetValue(const pointer_uint_q uPosition) const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+
+        QE_ASSERT_ERROR(uPosition < this->GetCount(), string_q("The input position (") + string_q::FromInteger(uPosition) + ") is out of bounds.");
+
+        return m_pElements[uPosition];
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of elements in the image.
+    /// </summary>
+    /// <returns>
+    /// The number of elements.
+    /// </returns>
+    pointer_uint_q GetCount() const
+    {
+        return m_pHeader->GetCount();
+    }
+
+    /// <summary>
+    /// Indicates whether the image is empty.
+    /// </summary>
+    /// <returns>
+    /// True if there are no elements in the image; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_pHeader->GetCount() == 0;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The header at the beginning of the image.
+    /// </summary>
+    const QContainerImageHeader* m_pHeader;
+
+    /// <summary>
+    /// The first value of the first node, right after the header.
+    /// </summary>
+    const u32_q* m_pNodes;
+
+    /// <summary>
+    /// The first element of the image, right after the nodes.
+    /// </summary>
+    const T* m_pElements;
+
+};
+
+
+// ATTRIBUTE INITIALIZATION
+// ----------------------------
+template<class T, class ComparatorT>
+const pointer_uint_q QBinarySearchTreeImageView<T, ComparatorT>::END_POSITION = -1;
+
+template<class T, class ComparatorT>
+const pointer_uint_q QBinarySearchTreeImageView<T, ComparatorT>::NODE_SIZE = 4U;
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QBINARYSEARCHTREEIMAGEVIEW__
@@ -0,0 +1,642 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QBITARRAY__
+#define __QBITARRAY__
+
+#include <cstring>
+
+#include "DataTypesDefinitions.h"
+#include "ToolsDefinitions.h"
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+#include "QPoolAllocator.h"
+#include "QAlignment.h"
+#include "SQVU32.h"
+#include "SQGeometricGrowthPolicy.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::vf32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQVU32;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Represents a sequence of bits whose size can change, stored in 32-bits words.
+/// </summary>
+/// <remarks>
+/// Every bit occupies one bit of memory, instead of the byte occupied by every element of an array of booleans. Words are grouped in lanes 
+/// of 128 bits, aligned to 16 bytes, so bitwise operations between bit arrays process a whole lane with every SIMD instruction.<br/>
+/// Bits beyond the last one are always zero, so counting and searching operations never need to check the number of bits.<br/>
+/// The capacity is always a multiple of 128 bits.
+/// </remarks>
+/// <typeparam name="AllocatorT">Optional. The type of allocator that reserves the memory of the words. By default, QPoolAllocator will
+/// be used.</typeparam>
+/// <typeparam name="GrowthPolicyT">Optional. The policy that calculates the new capacity, in bits, when it is exceeded. By default, 
+/// SQGeometricGrowthPolicy will be used.</typeparam>
+template<class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, class GrowthPolicyT = SQGeometricGrowthPolicy>
+class QBitArray
+{
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The value returned by searching operations when no bit is found.
+    /// </summary>
+    static const pointer_uint_q END_POSITION;
+
+protected:
+
+    /// <summary>
+    /// The number of bits in a word.
+    /// </summary>
+    static const pointer_uint_q BITS_PER_WORD;
+
+    /// <summary>
+    /// The number of words in a lane, which is processed with every SIMD instruction.
+    /// </summary>
+    static const pointer_uint_q WORDS_PER_LANE;
+
+    /// <summary>
+    /// The number of bits in a lane.
+    /// </summary>
+    static const pointer_uint_q BITS_PER_LANE;
+
+    /// <summary>
+    /// The size of a lane, in bytes. Every lane is a block of the allocator.
+    /// </summary>
+    static const pointer_uint_q LANE_SIZE;
+
+    /// <summary>
+    /// The alignment of the words, which is required to load a whole lane at once.
+    /// </summary>
+    static const pointer_uint_q LANE_ALIGNMENT;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    /// <remarks>
+    /// The initial capacity is one lane.
+    /// </remarks>
+    QBitArray() : m_allocator(QBitArray::LANE_SIZE, QBitArray::LANE_SIZE, QAlignment(QBitArray::LANE_ALIGNMENT)),
+                  m_pWords(null_q),
+                  m_uCount(0),
+                  m_uCapacity(0)
+    {
+        this->_AllocateLanes();
+    }
+
+    /// <summary>
+    /// Constructor that receives the initial number of bits and their value.
+    /// </summary>
+    /// <param name="uCount">[IN] The number of bits. It must be greater than zero.</param>
+    /// <param name="bValue">[IN] The value of every bit.</param>
+    QBitArray(const pointer_uint_q uCount, const bool bValue) : m_allocator(QBitArray::_GetSizeInBytes(uCount), QBitArray::LANE_SIZE, QAlignment(QBitArray::LANE_ALIGNMENT)),
+                                                                m_pWords(null_q),
+                                                                m_uCount(0),
+                                                                m_uCapacity(0)
+    {
+        QE_ASSERT_ERROR(uCount > 0, "The number of bits must be greater than zero.");
+
+        this->_AllocateLanes();
+        m_uCount = uCount;
+        this->SetAll(bValue);
+    }
+
+    /// <summary>
+    /// Copy constructor that receives another instance and stores a copy of it.
+    /// </summary>
+    /// <remarks>
+    /// The capacity of the resultant bit array is equal to the input bit array's.
+    /// </remarks>
+    /// <param name="bitArray">[IN] The other bit array to be copied.</param>
+    QBitArray(const QBitArray &bitArray) : m_allocator(QBitArray::_GetSizeInBytes(bitArray.m_uCapacity), QBitArray::LANE_SIZE, QAlignment(QBitArray::LANE_ALIGNMENT)),
+                                           m_pWords(null_q),
+                                           m_uCount(0),
+                                           m_uCapacity(0)
+    {
+        this->_AllocateLanes();
+        memcpy(m_pWords, bitArray.m_pWords, this->_GetNumberOfWords(bitArray.m_uCount) * sizeof(u32_q));
+        m_uCount = bitArray.m_uCount;
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Assignment operator that copies the bits of another bit array.
+    /// </summary>
+    /// <remarks>
+    /// A reallocation takes place only if the capacity is not enough to store all the bits.
+    /// </remarks>
+    /// <param name="bitArray">[IN] The other bit array to be copied.</param>
+    /// <returns>
+    /// A reference to the resultant bit array.
+    /// </returns>
+    QBitArray& operator=(const QBitArray &bitArray)
+    {
+        if(this != &bitArray)
+        {
+            this->Clear();
+            this->Reserve(bitArray.m_uCount);
+            memcpy(m_pWords, bitArray.m_pWords, this->_GetNumberOfWords(bitArray.m_uCount) * sizeof(u32_q));
+            m_uCount = bitArray.m_uCount;
+        }
+
+        return *this;
+    }
+
+    /// <summary>
+    /// Adds a bit to the end of the bit array.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the bit array is exceeded, a reallocation will take place.
+    /// </remarks>
+    /// <param name="bValue">[IN] The value of the new bit.</param>
+    void Add(const bool bValue)
+    {
+        if(m_uCount == m_uCapacity)
+            this->Reserve(GrowthPolicyT::GetNewCapacity(m_uCount + 1U));
+
+        ++m_uCount;
+        this->SetBit(m_uCount - 1U, bValue);
+    }
+
+    /// <summary>
+    /// Changes the number of bits of the bit array.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the bit array is exceeded, a reallocation will take place.
+    /// </remarks>
+    /// <param name="uCount">[IN] The new number of bits. Bits added at the end are zero.</param>
+    void Resize(const pointer_uint_q uCount)
+    {
+        if(uCount > m_uCapacity)
+            this->Reserve(uCount);
+
+        if(uCount < m_uCount)
+        {
+            // Removed bits are set to zero, so bits beyond the last one are always zero
+            const pointer_uint_q FIRST_WORD_TO_CLEAR = this->_GetNumberOfWords(uCount);
+            memset(m_pWords + FIRST_WORD_TO_CLEAR, 0, (this->_GetNumberOfWords(m_uCount) - FIRST_WORD_TO_CLEAR) * sizeof(u32_q));
+            m_uCount = uCount;
+            this->_ClearTail();
+        }
+        else
+        {
+            m_uCount = uCount;
+        }
+    }
+
+    /// <summary>
+    /// Increases the capacity of the bit array, reserving memory for more bits.
+    /// </summary>
+    /// <remarks>
+    /// The capacity is rounded up to the next multiple of 128 bits.
+    /// </remarks>
+    /// <param name="uNumberOfBits">[IN] The number of bits for which to reserve memory. It should be greater than the current capacity or nothing will happen.</param>
+    void Reserve(const pointer_uint_q uNumberOfBits)
+    {
+        if(uNumberOfBits > m_uCapacity)
+        {
+            // The allocator keeps the words when it moves them to the new buffer
+            m_allocator.Reallocate(QBitArray::_GetSizeInBytes(uNumberOfBits));
+            this->_AllocateLanes();
+        }
+    }
+
+    /// <summary>
+    /// Removes all the bits of the bit array.
+    /// </summary>
+    /// <remarks>
+    /// The capacity does not change.
+    /// </remarks>
+    void Clear()
+    {
+        memset(m_pWords, 0, this->_GetNumberOfWords(m_uCount) * sizeof(u32_q));
+        m_uCount = 0;
+    }
+
+    /// <summary>
+    /// Sets the value of all the bits.
+    /// </summary>
+    /// <param name="bValue">[IN] The new value of every bit.</param>
+    void SetAll(const bool bValue)
+    {
+        memset(m_pWords, bValue ? 0xFF : 0, this->_GetNumberOfWords(m_uCount) * sizeof(u32_q));
+        this->_ClearTail();
+    }
+
+    /// <summary>
+    /// Calculates the bitwise AND of every bit and the bit at the same position in another bit array.
+    /// </summary>
+    /// <param name="bitArray">[IN] The other bit array. It must have the same number of bits.</param>
+    void And(const QBitArray &bitArray)
+    {
+        QE_ASSERT_ERROR(m_uCount == bitArray.m_uCount, "Both bit arrays must have the same number of bits.");
+
+        const pointer_uint_q NUMBER_OF_WORDS = this->_GetNumberOfLanes(m_uCount) * QBitArray::WORDS_PER_LANE;
+        vf32_q lane;
+        vf32_q otherLane;
+
+        for(pointer_uint_q uWord = 0; uWord < NUMBER_OF_WORDS; uWord += QBitArray::WORDS_PER_LANE)
+        {
+            SQVU32::Load(m_pWords + uWord, lane);
+            SQVU32::Load(bitArray.m_pWords + uWord, otherLane);
+            SQVU32::And(lane, otherLane, lane);
+            SQVU32::Store(lane, m_pWords + uWord);
+        }
+    }
+
+    /// <summary>
+    /// Calculates the bitwise OR of every bit and the bit at the same position in another bit array.
+    /// </summary>
+    /// <param name="bitArray">[IN] The other bit array. It must have the same number of bits.</param>
+    void Or(const QBitArray &bitArray)
+    {
+        QE_ASSERT_ERROR(m_uCount == bitArray.m_uCount, "Both bit arrays must have the same number of bits.");
+
+        const pointer_uint_q NUMBER_OF_WORDS = this->_GetNumberOfLanes(m_uCount) * QBitArray::WORDS_PER_LANE;
+        vf32_q lane;
+        vf32_q otherLane;
+
+        for(pointer_uint_q uWord = 0; uWord < NUMBER_OF_WORDS; uWord += QBitArray::WORDS_PER_LANE)
+        {
+            SQVU32::Load(m_pWords + uWord, lane);
+            SQVU32::Load(bitArray.m_pWords + uWord, otherLane);
+            SQVU32::Or(lane, otherLane, lane);
+            SQVU32::Store(lane, m_pWords + uWord);
+        }
+    }
+
+    /// <summary>
+    /// Calculates the bitwise exclusive OR of every bit and the bit at the same position in another bit array.
+    /// </summary>
+    /// <param name="bitArray">[IN] The other bit array. It must have the same number of bits.</param>
+    void Xor(const QBitArray &bitArray)
+    {
+        QE_ASSERT_ERROR(m_uCount == bitArray.m_uCount, "Both bit arrays must have the same number of bits.");
+
+        const pointer_uint_q NUMBER_OF_WORDS = this->_GetNumberOfLanes(m_uCount) * QBitArray::WORDS_PER_LANE;
+        vf32_q lane;
+        vf32_q otherLane;
+
+        for(pointer_uint_q uWord = 0; uWord < NUMBER_OF_WORDS; uWord += QBitArray::WORDS_PER_LANE)
+        {
+            SQVU32::Load(m_pWords + uWord, lane);
+            SQVU32::Load(bitArray.m_pWords + uWord, otherLane);
+            SQVU32::Xor(lane, otherLane, lane);
+            SQVU32::Store(lane, m_pWords + uWord);
+        }
+    }
+
+    /// <summary>
+    /// Inverts the value of every bit.
+    /// </summary>
+    void Not()
+    {
+        const pointer_uint_q NUMBER_OF_WORDS = this->_GetNumberOfLanes(m_uCount) * QBitArray::WORDS_PER_LANE;
+        vf32_q lane;
+
+        for(pointer_uint_q uWord = 0; uWord < NUMBER_OF_WORDS; uWord += QBitArray::WORDS_PER_LANE)
+        {
+            SQVU32::Load(m_pWords + uWord, lane);
+            SQVU32::Not(lane, lane);
+            SQVU32::Store(lane, m_pWords + uWord);
+        }
+
+        // Bits beyond the last one were inverted too
+        memset(m_pWords + this->_GetNumberOfWords(m_uCount), 0, (NUMBER_OF_WORDS - this->_GetNumberOfWords(m_uCount)) * sizeof(u32_q));
+        this->_ClearTail();
+    }
+
+    /// <summary>
+    /// Counts the number of bits whose value is one.
+    /// </summary>
+    /// <returns>
+    /// The number of bits that are set.
+    /// </returns>
+    pointer_uint_q CountSetBits() const
+    {
+        const pointer_uint_q NUMBER_OF_WORDS = this->_GetNumberOfWords(m_uCount);
+        pointer_uint_q uCount = 0;
+
+        for(pointer_uint_q uWord = 0; uWord < NUMBER_OF_WORDS; ++uWord)
+            uCount += QBitArray::_CountSetBits(m_pWords[uWord]);
+
+        return uCount;
+    }
+
+    /// <summary>
+    /// Searches for the first bit whose value is one.
+    /// </summary>
+    /// <returns>
+    /// The position of the bit. If all the bits are zero, it returns END_POSITION.
+    /// </returns>
+    pointer_uint_q FindFirstSetBit() const
+    {
+        return this->FindNextSetBit(0);
+    }
+
+    /// <summary>
+    /// Searches for the first bit whose value is one, starting at a position.
+    /// </summary>
+    /// <remarks>
+    /// It can be used to iterate through all the bits that are set, passing the position of the previous bit plus one.
+    /// </remarks>
+    /// <param name="uPosition">[IN] The position of the first bit to check. If it is greater than or equal to the number of bits, 
+    /// nothing will be found.</param>
+    /// <returns>
+    /// The position of the bit. If there are no bits set at or after the position, it returns END_POSITION.
+    /// </returns>
+    pointer_uint_q FindNextSetBit(const pointer_uint_q uPosition) const
+    {
+        if(uPosition >= m_uCount)
+            return QBitArray::END_POSITION;
+
+        const pointer_uint_q NUMBER_OF_WORDS = this->_GetNumberOfWords(m_uCount);
+        pointer_uint_q uWord = uPosition / QBitArray::BITS_PER_WORD;
+
+        // Bits before the position are discarded in the first word
+        u32_q uBits = m_pWords[uWord] & (~0U << (uPosition % QBitArray::BITS_PER_WORD));
+
+        while(uBits == 0)
+        {
+            ++uWord;
+
+            if(uWord == NUMBER_OF_WORDS)
+                return QBitArray::END_POSITION;
+
+            uBits = m_pWords[uWord];
+        }
+
+        return uWord * QBitArray::BITS_PER_WORD + QBitArray::_GetFirstSetBit(uBits);
+    }
+
+private:
+
+    /// <summary>
+    /// Allocates the lanes of the allocator that are not in use yet and sets their words to zero.
+    /// </summary>
+    /// <remarks>
+    /// The capacity is updated to the size of the allocator.
+    /// </remarks>
+    void _AllocateLanes()
+    {
+        const pointer_uint_q NUMBER_OF_LANES = m_allocator.GetPoolSize() / QBitArray::LANE_SIZE;
+        const pointer_uint_q FIRST_NEW_WORD = this->_GetNumberOfWords(m_uCapacity);
+
+        for(pointer_uint_q uLane = m_uCapacity / QBitArray::BITS_PER_LANE; uLane < NUMBER_OF_LANES; ++uLane)
+            m_allocator.Allocate();
+
+        m_pWords = scast_q(m_allocator.GetPointer(), u32_q*);
+        memset(m_pWords + FIRST_NEW_WORD, 0, NUMBER_OF_LANES * QBitArray::LANE_SIZE - FIRST_NEW_WORD * sizeof(u32_q));
+        m_uCapacity = NUMBER_OF_LANES * QBitArray::BITS_PER_LANE;
+    }
+
+    /// <summary>
+    /// Sets to zero the bits of the last word that are beyond the last bit.
+    /// </summary>
+    void _ClearTail()
+    {
+        const pointer_uint_q USED_BITS_IN_LAST_WORD = m_uCount % QBitArray::BITS_PER_WORD;
+
+        if(USED_BITS_IN_LAST_WORD != 0)
+            m_pWords[m_uCount / QBitArray::BITS_PER_WORD] &= (1U << USED_BITS_IN_LAST_WORD) - 1U;
+    }
+
+    /// <summary>
+    /// Calculates the number of words required to store a number of bits.
+    /// </summary>
+    /// <param name="uNumberOfBits">[IN] The number of bits.</param>
+    /// <returns>
+    /// The number of words.
+    /// </returns>
+    static pointer_uint_q _GetNumberOfWords(const pointer_uint_q uNumberOfBits)
+    {
+        return (uNumberOfBits + QBitArray::BITS_PER_WORD - 1U) / QBitArray::BITS_PER_WORD;
+    }
+
+    /// <summary>
+    /// Calculates the number of lanes required to store a number of bits.
+    /// </summary>
+    /// <param name="uNumberOfBits">[IN] The number of bits.</param>
+    /// <returns>
+    /// The number of lanes.
+    /// </returns>
+    static pointer_uint_q _GetNumberOfLanes(const pointer_uint_q uNumberOfBits)
+    {
+        return (uNumberOfBits + QBitArray::BITS_PER_LANE - 1U) / QBitArray::BITS_PER_LANE;
+    }
+
+    /// <summary>
+    /// Calculates the size, in bytes, of the lanes required to store a number of bits.
+    /// </summary>
+    /// <param name="uNumberOfBits">[IN] The number of bits.</param>
+    /// <returns>
+    /// The size of the lanes, in bytes.
+    /// </returns>
+    static pointer_uint_q _GetSizeInBytes(const pointer_uint_q uNumberOfBits)
+    {
+        return QBitArray::_GetNumberOfLanes(uNumberOfBits) * QBitArray::LANE_SIZE;
+    }
+
+    /// <summary>
+    /// Counts the number of bits that are set in a word.
+    /// </summary>
+    /// <remarks>
+    /// Bits are added in parallel, in groups of increasing size, so the cost does not depend on the value of the word.
+    /// </remarks>
+    /// <param name="uWord">[IN] The word.</param>
+    /// <returns>
+    /// The number of bits set.
+    /// </returns>
+    static pointer_uint_q _CountSetBits(u32_q uWord)
+    {
+        uWord = uWord - ((uWord >> 1U) & 0x55555555U);
+        uWord = (uWord & 0x33333333U) + ((uWord >> 2U) & 0x33333333U);
+        uWord = (uWord + (uWord >> 4U)) & 0x0F0F0F0FU;
+        return (uWord * 0x01010101U) >> 24U;
+    }
+
+    /// <summary>
+    /// Gets the index of the least significant bit that is set in a word.
+    /// </summary>
+    /// <remarks>
+    /// The isolated bit is multiplied by a De Bruijn sequence, whose upper 5 bits are different for every possible position.
+    /// </remarks>
+    /// <param name="uWord">[IN] The word. It must not be zero.</param>
+    /// <returns>
+    /// The index of the bit.
+    /// </returns>
+    static pointer_uint_q _GetFirstSetBit(const u32_q uWord)
+    {
+        static const pointer_uint_q BIT_POSITIONS[32] = { 0,  1,  28, 2,  29, 14, 24, 3,  30, 22, 20, 15, 25, 17, 4,  8, 
+                                                          31, 27, 13, 23, 21, 19, 16, 7,  26, 12, 18, 6,  11, 5,  10, 9 };
+
+        return BIT_POSITIONS[scast_q((uWord & (0U - uWord)) * 0x077CB531U, u32_q) >> 27U];
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the value of a bit.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of the bit. It must be lower than the number of bits.</param>
+    /// <returns>
+    /// True if the bit is one; False otherwise.
+    /// </returns>
+    bool GetBit(const pointer_uint_q uPosition) const
+    {
+        QE_ASSERT_ERROR(uPosition < m_uCount, "The position is out of bounds.");
+
+        return (m_pWords[uPosition / QBitArray::BITS_PER_WORD] & (1U << (uPosition % QBitArray::BITS_PER_WORD))) != 0;
+    }
+
+    /// <summary>
+    /// Sets the value of a bit.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of the bit. It must be lower than the number of bits.</param>
+    /// <param name="bValue">[IN] The new value of the bit.</param>
+    void SetBit(const pointer_uint_q uPosition, const bool bValue)
+    {
+        QE_ASSERT_ERROR(uPosition < m_uCount, "The position is out of bounds.");
+
+        const u32_q MASK = 1U << (uPosition % QBitArray::BITS_PER_WORD);
+
+        if(bValue)
+            m_pWords[uPosition / QBitArray::BITS_PER_WORD] |= MASK;
+        else
+            m_pWords[uPosition / QBitArray::BITS_PER_WORD] &= ~MASK;
+    }
+
+    /// <summary>
+    /// Gets the number of bits in the bit array.
+    /// </summary>
+    /// <returns>
+    /// The number of bits.
+    /// </returns>
+    pointer_uint_q GetCount() const
+    {
+        return m_uCount;
+    }
+
+    /// <summary>
+    /// Gets the number of bits for which memory has been reserved.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the bit array, which is a multiple of 128.
+    /// </returns>
+    pointer_uint_q GetCapacity() const
+    {
+        return m_uCapacity;
+    }
+
+    /// <summary>
+    /// Indicates whether the bit array is empty or not.
+    /// </summary>
+    /// <returns>
+    /// True if the bit array is empty; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_uCount == 0;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The allocator that stores the words, a lane per block.
+    /// </summary>
+    AllocatorT m_allocator;
+
+    /// <summary>
+    /// The words that store the bits, from the least significant bit of the first word to the most significant bit of the last word.
+    /// </summary>
+    u32_q* m_pWords;
+
+    /// <summary>
+    /// The number of bits.
+    /// </summary>
+    pointer_uint_q m_uCount;
+
+    /// <summary>
+    /// The number of bits that fit in the allocated words.
+    /// </summary>
+    pointer_uint_q m_uCapacity;
+};
+
+
+// ATTRIBUTE INITIALIZATION
+// ----------------------------
+template<class AllocatorT, class GrowthPolicyT>
+const pointer_uint_q QBitArray<AllocatorT, GrowthPolicyT>::END_POSITION = -1;
+
+template<class AllocatorT, class GrowthPolicyT>
+const pointer_uint_q QBitArray<AllocatorT, GrowthPolicyT>::BITS_PER_WORD = 32U;
+
+template<class AllocatorT, class GrowthPolicyT>
+const pointer_uint_q QBitArray<AllocatorT, GrowthPolicyT>::WORDS_PER_LANE = 4U;
+
+template<class AllocatorT, class GrowthPolicyT>
+const pointer_uint_q QBitArray<AllocatorT, GrowthPolicyT>::BITS_PER_LANE = 128U;
+
+template<class AllocatorT, class GrowthPolicyT>
+const pointer_uint_q QBitArray<AllocatorT, GrowthPolicyT>::LANE_SIZE = 16U;
+
+template<class AllocatorT, class GrowthPolicyT>
+const pointer_uint_q QBitArray<AllocatorT, GrowthPolicyT>::LANE_ALIGNMENT = 16U;
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QBITARRAY__
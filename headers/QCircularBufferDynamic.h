@@ -0,0 +1,246 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QCIRCULARBUFFERDYNAMIC__
+#define __QCIRCULARBUFFERDYNAMIC__
+
+#include <cstring>
+
+#include "QCircularBufferFixed.h"
+#include "SQGeometricGrowthPolicy.h"
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Represents a sequence of elements that can be added and removed at both ends in constant time, without moving the rest of the 
+/// elements. Its capacity grows automatically when it is full.
+/// </summary>
+/// <remarks>
+/// Elements are stored in a contiguous buffer that is used as a ring, so the sequence may wrap around the end of the buffer; this means 
+/// that the elements occupy, at most, two contiguous ranges (see GetContiguousRanges).<br/>
+/// Memory is only allocated when an element is added to a full buffer or when more capacity is reserved explicitly. When that occurs, 
+/// elements are moved bitwise to the new buffer, so pointers and references to them are invalidated.<br/>
+/// Elements are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.
+/// </remarks>
+/// <typeparam name="T">The type of every element in the buffer.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The type of allocator to store the elements of the buffer. By default, QPoolAllocator will
+/// be used.</typeparam>
+/// <typeparam name="GrowthPolicyT">Optional. The policy that calculates the new capacity of the buffer when it is exceeded. By default, 
+/// SQGeometricGrowthPolicy will be used.</typeparam>
+template<class T, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, class GrowthPolicyT = SQGeometricGrowthPolicy>
+class QCircularBufferDynamic : public QCircularBufferFixed<T, AllocatorT>
+{
+    using QCircularBufferFixed<T, AllocatorT>::m_uFirst;
+    using QCircularBufferFixed<T, AllocatorT>::m_uCount;
+    using QCircularBufferFixed<T, AllocatorT>::m_uCapacity;
+    using QCircularBufferFixed<T, AllocatorT>::m_allocator;
+    using QCircularBufferFixed<T, AllocatorT>::m_pElementBasePointer;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    /// <remarks>
+    /// The initial capacity depends on the value of the default capacity of the class.
+    /// </remarks>
+    QCircularBufferDynamic()
+    {
+    }
+
+    /// <summary>
+    /// Constructor that receives the initial capacity.
+    /// </summary>
+    /// <param name="uInitialCapacity">[IN] The number of elements for which to reserve memory, the initial capacity. It must be 
+    /// greater than zero.</param>
+    explicit QCircularBufferDynamic(const pointer_uint_q uInitialCapacity)
+    {
+        QE_ASSERT_ERROR(uInitialCapacity > 0, "The initial capacity cannot be zero, it must be, at least, one.");
+
+        this->Reserve(uInitialCapacity);
+    }
+
+    /// <summary>
+    /// Copy constructor that receives a buffer of any kind.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor of every element is called, from the front to the back. The capacity of the resultant buffer will be 
+    /// the same as the capacity of the input buffer.
+    /// </remarks>
+    /// <param name="buffer">[IN] The buffer to be copied.</param>
+    QCircularBufferDynamic(const QCircularBufferFixed<T, AllocatorT> &buffer) : QCircularBufferFixed<T, AllocatorT>(buffer)
+    {
+    }
+
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor of every element is called, from the front to the back. The capacity of the resultant buffer will be 
+    /// the same as the capacity of the input buffer.
+    /// </remarks>
+    /// <param name="buffer">[IN] The buffer to be copied.</param>
+    QCircularBufferDynamic(const QCircularBufferDynamic &buffer) : QCircularBufferFixed<T, AllocatorT>(buffer)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Assignment operator that copies the elements of a buffer of any kind.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every resident element is called and then the copy constructor of every input element, from the front to the back.<br/>
+    /// If the capacity of the resident buffer is not enough to store all the input elements, it will be increased.
+    /// </remarks>
+    /// <param name="buffer">[IN] The buffer to be copied.</param>
+    /// <returns>
+    /// A reference to the resident buffer.
+    /// </returns>
+    QCircularBufferDynamic& operator=(const QCircularBufferFixed<T, AllocatorT> &buffer)
+    {
+        if(this != &buffer)
+        {
+            this->Clear();
+            this->Reserve(buffer.GetCount());
+            QCircularBufferFixed<T, AllocatorT>::operator=(buffer);
+        }
+
+        return *this;
+    }
+
+    /// <summary>
+    /// Assignment operator that copies the elements of another buffer.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every resident element is called and then the copy constructor of every input element, from the front to the back.<br/>
+    /// If the capacity of the resident buffer is not enough to store all the input elements, it will be increased.
+    /// </remarks>
+    /// <param name="buffer">[IN] The buffer to be copied.</param>
+    /// <returns>
+    /// A reference to the resident buffer.
+    /// </returns>
+    QCircularBufferDynamic& operator=(const QCircularBufferDynamic &buffer)
+    {
+        const QCircularBufferFixed<T, AllocatorT> &baseBuffer = buffer;
+        return this->operator=(baseBuffer);
+    }
+
+    /// <summary>
+    /// Copies an element at the back of the buffer.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor of the new element is called. If the buffer is full, its capacity is increased.
+    /// </remarks>
+    /// <param name="newElement">[IN] The element to be copied.</param>
+    void PushBack(const T &newElement)
+    {
+        if(m_uCount == m_uCapacity)
+            this->_ReallocateByPolicy(m_uCapacity + 1U);
+
+        QCircularBufferFixed<T, AllocatorT>::PushBack(newElement);
+    }
+
+    /// <summary>
+    /// Copies an element at the front of the buffer.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor of the new element is called. If the buffer is full, its capacity is increased.
+    /// </remarks>
+    /// <param name="newElement">[IN] The element to be copied.</param>
+    void PushFront(const T &newElement)
+    {
+        if(m_uCount == m_uCapacity)
+            this->_ReallocateByPolicy(m_uCapacity + 1U);
+
+        QCircularBufferFixed<T, AllocatorT>::PushFront(newElement);
+    }
+
+    /// <summary>
+    /// Increases the capacity of the buffer, reserving memory for more elements.
+    /// </summary>
+    /// <remarks>
+    /// Elements are moved bitwise to the new buffer, so pointers and references to them are invalidated.<br/>
+    /// If the requested number of elements is not greater than the current capacity, nothing will happen.
+    /// </remarks>
+    /// <param name="uNumberOfElements">[IN] The number of elements for which to reserve memory.</param>
+    void Reserve(const pointer_uint_q uNumberOfElements)
+    {
+        if(uNumberOfElements > m_uCapacity)
+        {
+            const pointer_uint_q OLD_CAPACITY = m_uCapacity;
+
+            m_allocator.Reallocate(uNumberOfElements * sizeof(T));
+            m_pElementBasePointer = scast_q(m_allocator.GetPointer(), T*);
+            m_uCapacity = uNumberOfElements;
+            this->_OccupyBlocks(OLD_CAPACITY, m_uCapacity);
+
+            // If the sequence wrapped around the end of the old buffer, the elements from the front to the old end are moved to the 
+            // new end so the sequence remains contiguous across the wrap point
+            if(m_uFirst + m_uCount > OLD_CAPACITY)
+            {
+                const pointer_uint_q ELEMENTS_BEFORE_END = OLD_CAPACITY - m_uFirst;
+                const pointer_uint_q NEW_FIRST = m_uCapacity - ELEMENTS_BEFORE_END;
+                // Elements are relocated bitwise on purpose, even if they are not trivially copyable, the cast just states so
+                memmove(scast_q(m_pElementBasePointer + NEW_FIRST, void*), m_pElementBasePointer + m_uFirst, ELEMENTS_BEFORE_END * sizeof(T));
+                m_uFirst = NEW_FIRST;
+            }
+        }
+    }
+
+private:
+
+    /// <summary>
+    /// Increases the capacity of the buffer, reserving memory for more elements than necessary, depending on the growth policy.
+    /// </summary>
+    /// <param name="uNumberOfElements">[IN] The minimum number of elements the buffer has to be able to store.</param>
+    void _ReallocateByPolicy(const pointer_uint_q uNumberOfElements)
+    {
+        this->Reserve(GrowthPolicyT::GetNewCapacity(uNumberOfElements));
+    }
+};
+
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QCIRCULARBUFFERDYNAMIC__
@@ -0,0 +1,545 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QCIRCULARBUFFERFIXED__
+#define __QCIRCULARBUFFERFIXED__
+
+#include "DataTypesDefinitions.h"
+#include "ToolsDefinitions.h"
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+#include "QPoolAllocator.h"
+#include "QAlignment.h"
+#include "SQBulkElementOperations.h"
+#include "AllocationOperators.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Represents a sequence of elements that can be added and removed at both ends in constant time, without moving the rest of the 
+/// elements and without allocating memory. Its capacity is defined when it is constructed and cannot be changed afterwards.
+/// </summary>
+/// <remarks>
+/// Elements are stored in a contiguous buffer that is used as a ring, so the sequence may wrap around the end of the buffer; this means 
+/// that the elements occupy, at most, two contiguous ranges (see GetContiguousRanges).<br/>
+/// When the buffer is full, adding an element at one end overwrites the element at the opposite end, so the buffer always keeps the 
+/// most recently added elements.<br/>
+/// Elements are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.
+/// </remarks>
+/// <typeparam name="T">The type of every element in the buffer.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The type of allocator to store the elements of the buffer. By default, QPoolAllocator will
+/// be used.</typeparam>
+template<class T, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator>
+class QCircularBufferFixed
+{
+
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The number of elements that can be stored in the buffer by default, when it is not specified.
+    /// </summary>
+    static const pointer_uint_q DEFAULT_CAPACITY = 1;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the maximum number of elements the buffer can store.
+    /// </summary>
+    /// <param name="uCapacity">[IN] The maximum number of elements the buffer can store. It must be greater than zero.</param>
+    explicit QCircularBufferFixed(const pointer_uint_q uCapacity) :
+                                                                  m_uFirst(0),
+                                                                  m_uCount(0),
+                                                                  m_uCapacity(uCapacity),
+                                                                  m_allocator(uCapacity * sizeof(T), sizeof(T), QAlignment(alignof_q(T))),
+                                                                  m_pElementBasePointer(null_q)
+    {
+        QE_ASSERT_ERROR(uCapacity > 0, "The capacity of the buffer must be greater than zero.");
+
+        this->_OccupyBlocks(0, m_uCapacity);
+        m_pElementBasePointer = scast_q(m_allocator.GetPointer(), T*);
+    }
+
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor of every element is called, from the front to the back. The capacity of the resultant buffer will be the 
+    /// same as the capacity of the input buffer.
+    /// </remarks>
+    /// <param name="buffer">[IN] The buffer to be copied.</param>
+    QCircularBufferFixed(const QCircularBufferFixed &buffer) :
+                                                             m_uFirst(0),
+                                                             m_uCount(0),
+                                                             m_uCapacity(buffer.m_uCapacity),
+                                                             m_allocator(buffer.m_uCapacity * sizeof(T), sizeof(T), QAlignment(alignof_q(T))),
+                                                             m_pElementBasePointer(null_q)
+    {
+        this->_OccupyBlocks(0, m_uCapacity);
+        m_pElementBasePointer = scast_q(m_allocator.GetPointer(), T*);
+
+        this->_CopyConstructFrom(buffer, 0);
+    }
+
+protected:
+
+    /// <summary>
+    /// Constructs an empty buffer with the default capacity. Intended to be used by derived classes.
+    /// </summary>
+    QCircularBufferFixed() :
+                           m_uFirst(0),
+                           m_uCount(0),
+                           m_uCapacity(QCircularBufferFixed::DEFAULT_CAPACITY),
+                           m_allocator(QCircularBufferFixed::DEFAULT_CAPACITY * sizeof(T), sizeof(T), QAlignment(alignof_q(T))),
+                           m_pElementBasePointer(null_q)
+    {
+        this->_OccupyBlocks(0, m_uCapacity);
+        m_pElementBasePointer = scast_q(m_allocator.GetPointer(), T*);
+    }
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every element is called.
+    /// </remarks>
+    ~QCircularBufferFixed()
+    {
+        this->Clear();
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Assignment operator that copies the elements of another buffer.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every resident element is called and then the copy constructor of every input element, from the front to the back.<br/>
+    /// The capacity of the resident buffer does not change; if the input buffer contains more elements than the resident buffer can store,
+    /// only the elements at the back of the input buffer will be copied, as if they were added one by one using PushBack.
+    /// </remarks>
+    /// <param name="buffer">[IN] The buffer to be copied.</param>
+    /// <returns>
+    /// A reference to the resident buffer.
+    /// </returns>
+    QCircularBufferFixed& operator=(const QCircularBufferFixed &buffer)
+    {
+        if(this != &buffer)
+        {
+            this->Clear();
+
+            const pointer_uint_q ELEMENTS_TO_SKIP = buffer.m_uCount > m_uCapacity ? buffer.m_uCount - m_uCapacity : 0;
+            this->_CopyConstructFrom(buffer, ELEMENTS_TO_SKIP);
+        }
+
+        return *this;
+    }
+
+    /// <summary>
+    /// Gets an element of the buffer, from the front to the back.
+    /// </summary>
+    /// <param name="uIndex">[IN] The position of the element, starting at the front. It must be lower than the number of elements.</param>
+    /// <returns>
+    /// A reference to the element.
+    /// </returns>
+    T& operator[](const pointer_uint_q uIndex) const
+    {
+        return this->GetValue(uIndex);
+    }
+
+    /// <summary>
+    /// Copies an element at the back of the buffer.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor of the new element is called. If the buffer is full, the element at the front is assigned the input value 
+    /// instead and the next element becomes the front.
+    /// </remarks>
+    /// <param name="newElement">[IN] The element to be copied.</param>
+    void PushBack(const T &newElement)
+    {
+        if(m_uCount == m_uCapacity)
+        {
+            // The oldest element is replaced
+            m_pElementBasePointer[m_uFirst] = newElement;
+            m_uFirst = this->_GetPhysicalIndex(1U);
+        }
+        else
+        {
+            new(m_pElementBasePointer + this->_GetPhysicalIndex(m_uCount)) T(newElement);
+            ++m_uCount;
+        }
+    }
+
+    /// <summary>
+    /// Copies an element at the front of the buffer.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor of the new element is called. If the buffer is full, the element at the back is assigned the input value 
+    /// instead and it becomes the front.
+    /// </remarks>
+    /// <param name="newElement">[IN] The element to be copied.</param>
+    void PushFront(const T &newElement)
+    {
+        // When the buffer is full, the position before the front is occupied by the back
+        const pointer_uint_q NEW_FIRST = m_uFirst == 0 ? m_uCapacity - 1U : m_uFirst - 1U;
+
+        if(m_uCount == m_uCapacity)
+        {
+            m_pElementBasePointer[NEW_FIRST] = newElement;
+        }
+        else
+        {
+            new(m_pElementBasePointer + NEW_FIRST) T(newElement);
+            ++m_uCount;
+        }
+
+        m_uFirst = NEW_FIRST;
+    }
+
+    /// <summary>
+    /// Removes the element at the back of the buffer.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of the element is called.
+    /// </remarks>
+    void PopBack()
+    {
+        QE_ASSERT_ERROR(m_uCount > 0, "It is not possible to remove elements from an empty buffer.");
+
+        if(m_uCount > 0)
+        {
+            --m_uCount;
+            m_pElementBasePointer[this->_GetPhysicalIndex(m_uCount)].~T();
+        }
+    }
+
+    /// <summary>
+    /// Removes the element at the front of the buffer.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of the element is called.
+    /// </remarks>
+    void PopFront()
+    {
+        QE_ASSERT_ERROR(m_uCount > 0, "It is not possible to remove elements from an empty buffer.");
+
+        if(m_uCount > 0)
+        {
+            m_pElementBasePointer[m_uFirst].~T();
+            m_uFirst = this->_GetPhysicalIndex(1U);
+            --m_uCount;
+        }
+    }
+
+    /// <summary>
+    /// Removes all the elements of the buffer.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every element is called. The capacity does not change.
+    /// </remarks>
+    void Clear()
+    {
+        const T* pFirstRange = null_q;
+        const T* pSecondRange = null_q;
+        pointer_uint_q uFirstRangeCount = 0;
+        pointer_uint_q uSecondRangeCount = 0;
+        this->GetContiguousRanges(pFirstRange, uFirstRangeCount, pSecondRange, uSecondRangeCount);
+
+        SQBulkElementOperations<T>::Destroy(ccast_q(pFirstRange, T*), uFirstRangeCount);
+        SQBulkElementOperations<T>::Destroy(ccast_q(pSecondRange, T*), uSecondRangeCount);
+
+        m_uFirst = 0;
+        m_uCount = 0;
+    }
+
+    /// <summary>
+    /// Gets the two contiguous ranges of memory that contain the elements of the buffer, from the front to the back.
+    /// </summary>
+    /// <remarks>
+    /// The first range always starts at the front. The second range is only used when the sequence wraps around the end of the 
+    /// internal buffer, otherwise it will be null and its number of elements will be zero. If the buffer is empty, both ranges will be null.<br/>
+    /// This is intended to copy all the elements in two bulk operations, for example, when writing them to a stream.<br/>
+    /// Pointers are invalidated when the buffer is modified.
+    /// </remarks>
+    /// <param name="pFirstRange">[OUT] The first element of the first range.</param>
+    /// <param name="uFirstRangeCount">[OUT] The number of elements in the first range.</param>
+    /// <param name="pSecondRange">[OUT] The first element of the second range.</param>
+    /// <param name="uSecondRangeCount">[OUT] The number of elements in the second range.</param>
+    void GetContiguousRanges(const T* &pFirstRange, pointer_uint_q &uFirstRangeCount, const T* &pSecondRange, pointer_uint_q &uSecondRangeCount) const
+    {
+        const pointer_uint_q ELEMENTS_BEFORE_END = m_uCapacity - m_uFirst;
+
+        if(m_uCount == 0)
+        {
+            pFirstRange = null_q;
+            uFirstRangeCount = 0;
+            pSecondRange = null_q;
+            uSecondRangeCount = 0;
+        }
+        else if(m_uCount <= ELEMENTS_BEFORE_END)
+        {
+            pFirstRange = m_pElementBasePointer + m_uFirst;
+            uFirstRangeCount = m_uCount;
+            pSecondRange = null_q;
+            uSecondRangeCount = 0;
+        }
+        else
+        {
+            pFirstRange = m_pElementBasePointer + m_uFirst;
+            uFirstRangeCount = ELEMENTS_BEFORE_END;
+            pSecondRange = m_pElementBasePointer;
+            uSecondRangeCount = m_uCount - ELEMENTS_BEFORE_END;
+        }
+    }
+
+protected:
+
+    /// <summary>
+    /// Calculates the position in the internal buffer of an element, given its position in the sequence.
+    /// </summary>
+    /// <param name="uIndex">[IN] The position of the element, starting at the front. It must not be greater than the capacity.</param>
+    /// <returns>
+    /// The position of the element in the internal buffer.
+    /// </returns>
+    pointer_uint_q _GetPhysicalIndex(const pointer_uint_q uIndex) const
+    {
+        const pointer_uint_q POSITION = m_uFirst + uIndex;
+        return POSITION >= m_uCapacity ? POSITION - m_uCapacity : POSITION;
+    }
+
+    /// <summary>
+    /// Occupies a range of blocks of the allocator. The whole internal buffer is managed by the circular buffer, so all the blocks 
+    /// must be occupied in order to keep the allocator consistent.
+    /// </summary>
+    /// <param name="uFirstBlock">[IN] The number of blocks already occupied.</param>
+    /// <param name="uLastBlock">[IN] The number of blocks that must be occupied.</param>
+    void _OccupyBlocks(const pointer_uint_q uFirstBlock, const pointer_uint_q uLastBlock)
+    {
+        for(pointer_uint_q uBlock = uFirstBlock; uBlock < uLastBlock; ++uBlock)
+            m_allocator.Allocate();
+    }
+
+    /// <summary>
+    /// Copies the elements of another buffer at the back of the resident buffer, which must be empty and have enough capacity.
+    /// </summary>
+    /// <param name="buffer">[IN] The buffer whose elements will be copied.</param>
+    /// <param name="uElementsToSkip">[IN] The number of elements at the front of the input buffer that will not be copied.</param>
+    void _CopyConstructFrom(const QCircularBufferFixed &buffer, const pointer_uint_q uElementsToSkip)
+    {
+        const T* pFirstRange = null_q;
+        const T* pSecondRange = null_q;
+        pointer_uint_q uFirstRangeCount = 0;
+        pointer_uint_q uSecondRangeCount = 0;
+        buffer.GetContiguousRanges(pFirstRange, uFirstRangeCount, pSecondRange, uSecondRangeCount);
+
+        // The skipped elements are removed from the ranges
+        if(uElementsToSkip >= uFirstRangeCount)
+        {
+            pSecondRange += uElementsToSkip - uFirstRangeCount;
+            uSecondRangeCount -= uElementsToSkip - uFirstRangeCount;
+            uFirstRangeCount = 0;
+        }
+        else
+        {
+            pFirstRange += uElementsToSkip;
+            uFirstRangeCount -= uElementsToSkip;
+        }
+
+        m_uFirst = 0;
+        m_uCount = uFirstRangeCount + uSecondRangeCount;
+
+        SQBulkElementOperations<T>::CopyConstruct(m_pElementBasePointer, pFirstRange, uFirstRangeCount);
+        SQBulkElementOperations<T>::CopyConstruct(m_pElementBasePointer + uFirstRangeCount, pSecondRange, uSecondRangeCount);
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets an element of the buffer, from the front to the back.
+    /// </summary>
+    /// <param name="uIndex">[IN] The position of the element, starting at the front. It must be lower than the number of elements.</param>
+    /// <returns>
+    /// A reference to the element.
+    /// </returns>
+    T& GetValue(const pointer_uint_q uIndex) const
+    {
+        QE_ASSERT_ERROR(uIndex < m_uCount, "The index is out of bounds.");
+
+        return m_pElementBasePointer[this->_GetPhysicalIndex(uIndex)];
+    }
+
+    /// <summary>
+    /// Gets the element at the front of the buffer.
+    /// </summary>
+    /// <returns>
+    /// A reference to the element. If the buffer is empty, the result is undefined.
+    /// </returns>
+    T& GetFront() const
+    {
+        QE_ASSERT_ERROR(m_uCount > 0, "The buffer is empty, there is no element at the front.");
+
+        return m_pElementBasePointer[m_uFirst];
+    }
+
+    /// <summary>
+    /// Gets the element at the back of the buffer.
+    /// </summary>
+    /// <returns>
+    /// A reference to the element. If the buffer is empty, the result is undefined.
+    /// </returns>
+    T& GetBack() const
+    {
+        QE_ASSERT_ERROR(m_uCount > 0, "The buffer is empty, there is no element at the back.");
+
+        return m_pElementBasePointer[this->_GetPhysicalIndex(m_uCount - 1U)];
+    }
+
+    /// <summary>
+    /// Returns a constant pointer to the allocator.
+    /// </summary>
+    /// <returns>
+    /// Constant pointer to the allocator.
+    /// </returns>
+    const AllocatorT* GetAllocator() const
+    {
+        return &m_allocator;
+    }
+
+    /// <summary>
+    /// Gets the number of elements in the buffer.
+    /// </summary>
+    /// <returns>
+    /// The number of elements.
+    /// </returns>
+    pointer_uint_q GetCount() const
+    {
+        return m_uCount;
+    }
+
+    /// <summary>
+    /// Gets the maximum number of elements the buffer can store.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the buffer.
+    /// </returns>
+    pointer_uint_q GetCapacity() const
+    {
+        return m_uCapacity;
+    }
+
+    /// <summary>
+    /// Checks whether the buffer is empty or not.
+    /// </summary>
+    /// <returns>
+    /// True if the buffer is empty; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_uCount == 0;
+    }
+
+    /// <summary>
+    /// Checks whether the buffer is full or not.
+    /// </summary>
+    /// <returns>
+    /// True if the number of elements equals the capacity; False otherwise.
+    /// </returns>
+    bool IsFull() const
+    {
+        return m_uCount == m_uCapacity;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The position of the element at the front in the internal buffer.
+    /// </summary>
+    pointer_uint_q m_uFirst;
+
+    /// <summary>
+    /// The number of elements in the buffer.
+    /// </summary>
+    pointer_uint_q m_uCount;
+
+    /// <summary>
+    /// The number of elements that fit in the internal buffer.
+    /// </summary>
+    pointer_uint_q m_uCapacity;
+
+    /// <summary>
+    /// The allocator which stores the elements.
+    /// </summary>
+    AllocatorT m_allocator;
+
+    /// <summary>
+    /// A pointer to the buffer stored in the memory allocator, casted to the element type, intended to improve overall performance.
+    /// </summary>
+    T* m_pElementBasePointer;
+};
+
+
+// ATTRIBUTE INITIALIZATION
+// ----------------------------
+template<class T, class AllocatorT>
+const pointer_uint_q QCircularBufferFixed<T, AllocatorT>::DEFAULT_CAPACITY;
+
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QCIRCULARBUFFERFIXED__
@@ -0,0 +1,425 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QCONCURRENTHASHTABLE__
+#define __QCONCURRENTHASHTABLE__
+
+#include "SystemDefinitions.h"
+
+#include "QHashtable.h"
+#include "QSharedMutex.h"
+#include "QScopedExclusiveLock.h"
+#include "QScopedSharedLock.h"
+#include "QAlignment.h"
+#include "AllocationOperators.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+/// <summary>
+/// Represents a hash table that can be accessed from several threads at the same time.
+/// </summary>
+/// <remarks>
+/// The table is divided into segments, each of them being an independent QHashtable protected by its own shared mutex (lock striping). Every key 
+/// always belongs to the same segment, so operations on keys of different segments do not block each other. Lookups only lock their segment in shared 
+/// mode, so they never wait for other lookups; additions and removals lock their segment exclusively.<br/>
+/// Segments are allocated separately, aligned to the size of a cache line, so threads working on different segments do not invalidate each other's caches.<br/>
+/// Every segment grows and rehashes on its own, as a QHashtable does.<br/>
+/// Since other threads may modify the table at any moment, values are always returned by copy and there are no iterators.<br/>
+/// This class is thread-safe.
+/// </remarks>
+/// <typeparam name="KeyT">The type of the key associated to every value in the table.</typeparam>
+/// <typeparam name="ValueT">The type of the values stored in the table.</typeparam>
+/// <typeparam name="HashProviderT">Optional. The type of the hash provider. By default, it is SQIntegerHashProvider.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The type of the allocator that reserves memory for keys, values and buckets. By default, it is QPoolAllocator.</typeparam>
+/// <typeparam name="KeyComparatorT">Optional. The type of comparator utilized to compare keys. The default type is SQComparatorDefault.</typeparam>
+/// <typeparam name="ValueComparatorT">Optional. The type of comparator utilized to compare values. The default type is SQComparatorDefault.</typeparam>
+template<class KeyT, class ValueT, class HashProviderT = Kinesis::QuimeraEngine::Tools::Containers::SQIntegerHashProvider, 
+                                   class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, 
+                                   class KeyComparatorT = Kinesis::QuimeraEngine::Tools::Containers::SQComparatorDefault<KeyT>, 
+                                   class ValueComparatorT = Kinesis::QuimeraEngine::Tools::Containers::SQComparatorDefault<ValueT> >
+class QConcurrentHashtable
+{
+    // TYPEDEFS
+    // ---------------
+protected:
+
+    typedef Kinesis::QuimeraEngine::Tools::Containers::QHashtable<KeyT, ValueT, HashProviderT, AllocatorT, KeyComparatorT, ValueComparatorT> HashtableType;
+
+
+    // INTERNAL CLASSES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// A part of the table, which stores the key-value pairs whose keys belong to it and the mutex that protects them.
+    /// </summary>
+    class QSegment
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the initial number of buckets and their expected slots.
+        /// </summary>
+        /// <param name="uNumberOfBuckets">[IN] The number of buckets in the segment. It must be greater than zero.</param>
+        /// <param name="uSlotsPerBucket">[IN] The number of expected slots per bucket. It must be greater than zero.</param>
+        QSegment(const pointer_uint_q uNumberOfBuckets, const pointer_uint_q uSlotsPerBucket) : m_hashtable(uNumberOfBuckets, uSlotsPerBucket)
+        {
+        }
+
+
+        // PROPERTIES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Gets the mutex that protects the segment.
+        /// </summary>
+        /// <returns>
+        /// The mutex of the segment.
+        /// </returns>
+        QSharedMutex& GetMutex()
+        {
+            return m_mutex;
+        }
+
+        /// <summary>
+        /// Gets the hashtable that stores the key-value pairs of the segment.
+        /// </summary>
+        /// <returns>
+        /// The hashtable of the segment.
+        /// </returns>
+        HashtableType& GetHashtable()
+        {
+            return m_hashtable;
+        }
+
+
+        // ATTRIBUTES
+        // ---------------
+    private:
+
+        /// <summary>
+        /// The mutex that protects the segment.
+        /// </summary>
+        QSharedMutex m_mutex;
+
+        /// <summary>
+        /// The hashtable that stores the key-value pairs of the segment.
+        /// </summary>
+        HashtableType m_hashtable;
+    };
+
+
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The size, in bytes, of a cache line. Segments are aligned to it.
+    /// </summary>
+    static const pointer_uint_q CACHE_LINE_SIZE = 64U;
+
+    /// <summary>
+    /// The number of buckets passed to the hash provider when calculating the segment of a key. It is the greatest prime number that fits in 32 bits.
+    /// </summary>
+    static const pointer_uint_q SEGMENT_HASH_RANGE = 4294967291U;
+
+public:
+
+    /// <summary>
+    /// The maximum number of segments a table can be divided into.
+    /// </summary>
+    static const pointer_uint_q MAX_SEGMENTS = 65536U;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the number of segments, the initial number of buckets and their expected slots.
+    /// </summary>
+    /// <param name="uNumberOfSegments">[IN] The number of independently locked segments. The higher it is, the less threads compete for the same segment. 
+    /// It must be a power of two, greater than zero and not greater than MAX_SEGMENTS.</param>
+    /// <param name="uNumberOfBuckets">[IN] The number of buckets in the table, which are shared out among the segments. Every segment has, at least, one bucket.</param>
+    /// <param name="uSlotsPerBucket">[IN] The number of expected slots per bucket. The higher it is, the more capacity the table has initially. It must be greater than zero.</param>
+    QConcurrentHashtable(const pointer_uint_q uNumberOfSegments, const pointer_uint_q uNumberOfBuckets, const pointer_uint_q uSlotsPerBucket) : 
+                                                                                                                    m_arSegments(new QSegment*[uNumberOfSegments]),
+                                                                                                                    m_uNumberOfSegments(uNumberOfSegments)
+    {
+        QE_ASSERT_ERROR(uNumberOfSegments > 0 && (uNumberOfSegments & (uNumberOfSegments - 1U)) == 0, "The number of segments must be a power of two greater than zero.");
+        QE_ASSERT_ERROR(uNumberOfSegments <= QConcurrentHashtable::MAX_SEGMENTS, "The number of segments must not be greater than MAX_SEGMENTS.");
+
+        const pointer_uint_q BUCKETS_PER_SEGMENT = uNumberOfBuckets > uNumberOfSegments ? (uNumberOfBuckets + uNumberOfSegments - 1U) / uNumberOfSegments : 1U;
+
+        for(pointer_uint_q i = 0; i < m_uNumberOfSegments; ++i)
+            m_arSegments[i] = new(QAlignment(QConcurrentHashtable::CACHE_LINE_SIZE)) QSegment(BUCKETS_PER_SEGMENT, uSlotsPerBucket);
+    }
+
+private:
+
+    // Disabled.
+    QConcurrentHashtable(const QConcurrentHashtable &);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every key and value will be called in an undetermined order. No thread may be using the table.
+    /// </remarks>
+    ~QConcurrentHashtable()
+    {
+        for(pointer_uint_q i = 0; i < m_uNumberOfSegments; ++i)
+        {
+            m_arSegments[i]->~QSegment();
+            operator delete(m_arSegments[i], QAlignment(QConcurrentHashtable::CACHE_LINE_SIZE));
+        }
+
+        delete[] m_arSegments;
+    }
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Disabled.
+    QConcurrentHashtable& operator=(const QConcurrentHashtable &);
+
+public:
+
+    /// <summary>
+    /// Adds a key and its associated value to the table or, if the key already exists, replaces its associated value.
+    /// </summary>
+    /// <remarks>
+    /// Only the segment the key belongs to is locked, exclusively.<br/>
+    /// If the key is added, the copy constructor of both the key and the value will be called; otherwise, the assignment operator of the value will be called.
+    /// </remarks>
+    /// <param name="key">[IN] The key.</param>
+    /// <param name="value">[IN] The value associated to the key.</param>
+    /// <returns>
+    /// True if the key did not exist and has been added; False if it already existed and its value has been replaced.
+    /// </returns>
+    bool AddOrUpdate(const KeyT &key, const ValueT &value)
+    {
+        QSegment* pSegment = this->_GetSegment(key);
+        QScopedExclusiveLock<QSharedMutex> exclusiveLock(pSegment->GetMutex());
+
+        HashtableType& hashtable = pSegment->GetHashtable();
+        const bool KEY_EXISTS = hashtable.TrySetValue(key, value);
+
+        if(!KEY_EXISTS)
+            hashtable.Add(key, value);
+
+        return !KEY_EXISTS;
+    }
+
+    /// <summary>
+    /// Searches for a key and, if it is found, obtains a copy of its associated value.
+    /// </summary>
+    /// <remarks>
+    /// Only the segment the key belongs to is locked, in shared mode, so lookups do not block each other.<br/>
+    /// If the key is found, the assignment operator of the value will be called.
+    /// </remarks>
+    /// <param name="key">[IN] The key to search for.</param>
+    /// <param name="value">[OUT] The value associated to the key. If the key is not found, it is not modified.</param>
+    /// <returns>
+    /// True if the key exists; False otherwise.
+    /// </returns>
+    bool TryGetValue(const KeyT &key, ValueT &value) const
+    {
+        QSegment* pSegment = this->_GetSegment(key);
+        QScopedSharedLock<QSharedMutex> sharedLock(pSegment->GetMutex());
+
+        typename HashtableType::ConstIterator itKeyValue = pSegment->GetHashtable().PositionOfKey(key);
+        const bool KEY_EXISTS = !itKeyValue.IsEnd();
+
+        if(KEY_EXISTS)
+            value = itKeyValue->GetValue();
+
+        return KEY_EXISTS;
+    }
+
+    /// <summary>
+    /// Checks whether a key exists in the table.
+    /// </summary>
+    /// <remarks>
+    /// Only the segment the key belongs to is locked, in shared mode. The result may be out of date as soon as it is returned, if other threads modify the table.
+    /// </remarks>
+    /// <param name="key">[IN] The key to search for.</param>
+    /// <returns>
+    /// True if the key exists; False otherwise.
+    /// </returns>
+    bool ContainsKey(const KeyT &key) const
+    {
+        QSegment* pSegment = this->_GetSegment(key);
+        QScopedSharedLock<QSharedMutex> sharedLock(pSegment->GetMutex());
+
+        return pSegment->GetHashtable().ContainsKey(key);
+    }
+
+    /// <summary>
+    /// Removes a key and its associated value from the table, if the key exists.
+    /// </summary>
+    /// <remarks>
+    /// Only the segment the key belongs to is locked, exclusively.<br/>
+    /// The destructor of both the key and the value will be called.
+    /// </remarks>
+    /// <param name="key">[IN] The key to remove.</param>
+    /// <returns>
+    /// True if the key existed and has been removed; False otherwise.
+    /// </returns>
+    bool Remove(const KeyT &key)
+    {
+        QSegment* pSegment = this->_GetSegment(key);
+        QScopedExclusiveLock<QSharedMutex> exclusiveLock(pSegment->GetMutex());
+
+        return pSegment->GetHashtable().TryRemove(key);
+    }
+
+private:
+
+    /// <summary>
+    /// Gets the segment a key belongs to.
+    /// </summary>
+    /// <remarks>
+    /// The hash key is scrambled before choosing the segment, using Fibonacci hashing; otherwise, if the number of buckets of the segments were a multiple of 
+    /// the number of segments, the keys of every segment would only fall into a fraction of its buckets.
+    /// </remarks>
+    /// <param name="key">[IN] A key.</param>
+    /// <returns>
+    /// The segment of the key.
+    /// </returns>
+    QSegment* _GetSegment(const KeyT &key) const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+        const u32_q HASH_KEY = scast_q(HashProviderT::GenerateHashKey(key, QConcurrentHashtable::SEGMENT_HASH_RANGE), u32_q);
+        const u32_q SCRAMBLED_HASH_KEY = HASH_KEY * 2654435769U;
+
+        return m_arSegments[(SCRAMBLED_HASH_KEY >> 16U) & (m_uNumberOfSegments - 1U)];
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of elements added to the table.
+    /// </summary>
+    /// <remarks>
+    /// Segments are locked one after another, in shared mode, so the result may not correspond to any actual state of the table if other threads modify it meanwhile.
+    /// </remarks>
+    /// <returns>
+    /// The number of elements in the table.
+    /// </returns>
+    pointer_uint_q GetCount() const
+    {
+        pointer_uint_q uCount = 0;
+
+        for(pointer_uint_q i = 0; i < m_uNumberOfSegments; ++i)
+        {
+            QScopedSharedLock<QSharedMutex> sharedLock(m_arSegments[i]->GetMutex());
+            uCount += m_arSegments[i]->GetHashtable().GetCount();
+        }
+
+        return uCount;
+    }
+
+    /// <summary>
+    /// Indicates whether the table is empty or not.
+    /// </summary>
+    /// <remarks>
+    /// Segments are locked one after another, in shared mode, so the result may be out of date if other threads modify the table meanwhile.
+    /// </remarks>
+    /// <returns>
+    /// True if the table is empty; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        bool bIsEmpty = true;
+
+        for(pointer_uint_q i = 0; i < m_uNumberOfSegments && bIsEmpty; ++i)
+        {
+            QScopedSharedLock<QSharedMutex> sharedLock(m_arSegments[i]->GetMutex());
+            bIsEmpty = m_arSegments[i]->GetHashtable().IsEmpty();
+        }
+
+        return bIsEmpty;
+    }
+
+    /// <summary>
+    /// Gets the number of segments the table is divided into.
+    /// </summary>
+    /// <returns>
+    /// The number of segments.
+    /// </returns>
+    pointer_uint_q GetNumberOfSegments() const
+    {
+        return m_uNumberOfSegments;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The segments of the table, allocated separately.
+    /// </summary>
+    QSegment** m_arSegments;
+
+    /// <summary>
+    /// The number of segments of the table.
+    /// </summary>
+    const pointer_uint_q m_uNumberOfSegments;
+};
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QCONCURRENTHASHTABLE__
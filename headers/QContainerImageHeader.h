@@ -0,0 +1,192 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QCONTAINERIMAGEHEADER__
+#define __QCONTAINERIMAGEHEADER__
+
+#include "DataTypesDefinitions.h"
+#include "ToolsDefinitions.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Describes the content of a container image, a flat binary representation of a container that can be used directly from memory, without 
+/// deserializing its elements.
+/// </summary>
+/// <remarks>
+/// Container images are written by the WriteImage method of containers and read by image views, like QArrayImageView. Every image starts with 
+/// this header, which occupies 32 bytes so the data that follows it keeps the alignment of the image, up to 16 bytes.<br/>
+/// Positions stored in images are 32-bits indices relative to the beginning of the node or element array, so an image can be placed at any 
+/// address, for example, in a memory-mapped file. Elements are stored as raw bytes, so images can only be read by programs compiled for 
+/// the same platform, with the same type layout and endianness.
+/// </remarks>
+class QE_LAYER_TOOLS_SYMBOLS QContainerImageHeader
+{
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The type of the images of arrays and lists, whose elements are stored in order, without nodes.
+    /// </summary>
+    static const u32_q CONTAINER_TYPE_ARRAY;
+
+    /// <summary>
+    /// The type of the images of N-ary trees, whose nodes and elements are stored in depth-first pre-order.
+    /// </summary>
+    static const u32_q CONTAINER_TYPE_NTREE;
+
+    /// <summary>
+    /// The type of the images of binary search trees, whose nodes and elements are stored in ascending order.
+    /// </summary>
+    static const u32_q CONTAINER_TYPE_BINARYSEARCHTREE;
+
+    /// <summary>
+    /// The value stored in an image instead of a position when it does not refer to any node.
+    /// </summary>
+    static const u32_q NULL_POSITION;
+
+protected:
+
+    /// <summary>
+    /// The value that identifies the beginning of a container image ("QECI" in memory, in little-endian machines).
+    /// </summary>
+    static const u32_q SIGNATURE;
+
+    /// <summary>
+    /// The version of the image format.
+    /// </summary>
+    static const u32_q VERSION;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the description of the image.
+    /// </summary>
+    /// <param name="uContainerType">[IN] The type of the image, one of the CONTAINER_TYPE constants.</param>
+    /// <param name="uElementSize">[IN] The size, in bytes, of every element.</param>
+    /// <param name="uCount">[IN] The number of elements. It must fit in 32 bits.</param>
+    /// <param name="uRoot">[IN] The position of the root node, for trees, or NULL_POSITION.</param>
+    QContainerImageHeader(const u32_q uContainerType, const pointer_uint_q uElementSize, const pointer_uint_q uCount, const u32_q uRoot);
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Checks whether the header belongs to an image that can be read as a given type of container.
+    /// </summary>
+    /// <param name="uContainerType">[IN] The expected type of the image, one of the CONTAINER_TYPE constants.</param>
+    /// <param name="uElementSize">[IN] The expected size, in bytes, of every element.</param>
+    /// <returns>
+    /// True if the signature, the version, the type and the size of the elements are the expected ones; False otherwise.
+    /// </returns>
+    bool IsCompatible(const u32_q uContainerType, const pointer_uint_q uElementSize) const;
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of elements in the image.
+    /// </summary>
+    /// <returns>
+    /// The number of elements.
+    /// </returns>
+    pointer_uint_q GetCount() const;
+
+    /// <summary>
+    /// Gets the position of the root node.
+    /// </summary>
+    /// <returns>
+    /// The position of the root node. If the image does not belong to a tree or it is empty, it returns NULL_POSITION.
+    /// </returns>
+    u32_q GetRoot() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The signature of the image.
+    /// </summary>
+    u32_q m_uSignature;
+
+    /// <summary>
+    /// The version of the image format.
+    /// </summary>
+    u32_q m_uVersion;
+
+    /// <summary>
+    /// The type of the image.
+    /// </summary>
+    u32_q m_uContainerType;
+
+    /// <summary>
+    /// The size, in bytes, of every element.
+    /// </summary>
+    u32_q m_uElementSize;
+
+    /// <summary>
+    /// The number of elements.
+    /// </summary>
+    u32_q m_uCount;
+
+    /// <summary>
+    /// The position of the root node.
+    /// </summary>
+    u32_q m_uRoot;
+
+    /// <summary>
+    /// Reserved for future versions; it makes the header occupy 32 bytes.
+    /// </summary>
+    u32_q m_arReserved[2];
+
+};
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QCONTAINERIMAGEHEADER__
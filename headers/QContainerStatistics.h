@@ -0,0 +1,320 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QCONTAINERSTATISTICS__
+#define __QCONTAINERSTATISTICS__
+
+#include "DataTypesDefinitions.h"
+#include "ToolsDefinitions.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Stores information about the memory usage and the shape of a container at a given moment, so containers of different types can be compared.
+/// </summary>
+/// <remarks>
+/// Not every container fills all the properties; those that do not apply to a container (like the height of a list or the load factor of a tree) are zero.
+/// </remarks>
+class QContainerStatistics
+{
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor that sets all the properties to zero.
+    /// </summary>
+    QContainerStatistics() : m_uCount(0),
+                             m_uCapacity(0),
+                             m_uReservedBytes(0),
+                             m_uUsedBytes(0),
+                             m_fLoadFactor(0.0f),
+                             m_uMaximumChainLength(0),
+                             m_uHeight(0),
+                             m_fAverageDepth(0.0f)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Adds the memory usage of other statistics (count, capacity, reserved bytes and used bytes) to these statistics.
+    /// </summary>
+    /// <remarks>
+    /// It is used to calculate the statistics of containers that are composed of other containers.
+    /// </remarks>
+    /// <param name="statistics">[IN] The statistics whose memory usage will be added.</param>
+    void AddMemoryUsage(const QContainerStatistics &statistics)
+    {
+        m_uCount += statistics.m_uCount;
+        m_uCapacity += statistics.m_uCapacity;
+        m_uReservedBytes += statistics.m_uReservedBytes;
+        m_uUsedBytes += statistics.m_uUsedBytes;
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the number of elements in the container.
+    /// </summary>
+    /// <returns>
+    /// The number of elements.
+    /// </returns>
+    pointer_uint_q GetCount() const
+    {
+        return m_uCount;
+    }
+
+    /// <summary>
+    /// Sets the number of elements in the container.
+    /// </summary>
+    /// <param name="uCount">[IN] The number of elements.</param>
+    void SetCount(const pointer_uint_q uCount)
+    {
+        m_uCount = uCount;
+    }
+
+    /// <summary>
+    /// Gets the number of elements that can be stored in the container without reallocating memory.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the container.
+    /// </returns>
+    pointer_uint_q GetCapacity() const
+    {
+        return m_uCapacity;
+    }
+
+    /// <summary>
+    /// Sets the number of elements that can be stored in the container without reallocating memory.
+    /// </summary>
+    /// <param name="uCapacity">[IN] The capacity of the container.</param>
+    void SetCapacity(const pointer_uint_q uCapacity)
+    {
+        m_uCapacity = uCapacity;
+    }
+
+    /// <summary>
+    /// Gets the number of bytes reserved by the allocators of the container, either used or not.
+    /// </summary>
+    /// <returns>
+    /// The number of reserved bytes.
+    /// </returns>
+    pointer_uint_q GetReservedBytes() const
+    {
+        return m_uReservedBytes;
+    }
+
+    /// <summary>
+    /// Sets the number of bytes reserved by the allocators of the container, either used or not.
+    /// </summary>
+    /// <param name="uReservedBytes">[IN] The number of reserved bytes.</param>
+    void SetReservedBytes(const pointer_uint_q uReservedBytes)
+    {
+        m_uReservedBytes = uReservedBytes;
+    }
+
+    /// <summary>
+    /// Gets the number of bytes occupied by the allocated blocks of the container.
+    /// </summary>
+    /// <returns>
+    /// The number of used bytes.
+    /// </returns>
+    pointer_uint_q GetUsedBytes() const
+    {
+        return m_uUsedBytes;
+    }
+
+    /// <summary>
+    /// Sets the number of bytes occupied by the allocated blocks of the container.
+    /// </summary>
+    /// <param name="uUsedBytes">[IN] The number of used bytes.</param>
+    void SetUsedBytes(const pointer_uint_q uUsedBytes)
+    {
+        m_uUsedBytes = uUsedBytes;
+    }
+
+    /// <summary>
+    /// Gets the number of bytes reserved by the allocators of the container that are not being used.
+    /// </summary>
+    /// <returns>
+    /// The difference between the reserved bytes and the used bytes.
+    /// </returns>
+    pointer_uint_q GetUnusedBytes() const
+    {
+        return m_uReservedBytes - m_uUsedBytes;
+    }
+
+    /// <summary>
+    /// Gets the number of elements divided by the number of buckets, in hashtables.
+    /// </summary>
+    /// <returns>
+    /// The load factor.
+    /// </returns>
+    float_q GetLoadFactor() const
+    {
+        return m_fLoadFactor;
+    }
+
+    /// <summary>
+    /// Sets the number of elements divided by the number of buckets, in hashtables.
+    /// </summary>
+    /// <param name="fLoadFactor">[IN] The load factor.</param>
+    void SetLoadFactor(const float_q fLoadFactor)
+    {
+        m_fLoadFactor = fLoadFactor;
+    }
+
+    /// <summary>
+    /// Gets the number of elements of the longest chain of colliding elements stored in the same bucket, in hashtables.
+    /// </summary>
+    /// <returns>
+    /// The length of the longest chain.
+    /// </returns>
+    pointer_uint_q GetMaximumChainLength() const
+    {
+        return m_uMaximumChainLength;
+    }
+
+    /// <summary>
+    /// Sets the number of elements of the longest chain of colliding elements stored in the same bucket, in hashtables.
+    /// </summary>
+    /// <param name="uMaximumChainLength">[IN] The length of the longest chain.</param>
+    void SetMaximumChainLength(const pointer_uint_q uMaximumChainLength)
+    {
+        m_uMaximumChainLength = uMaximumChainLength;
+    }
+
+    /// <summary>
+    /// Gets the number of levels of a tree, this is, the depth of the deepest node plus one. A tree with only the root node has a height of 1.
+    /// </summary>
+    /// <returns>
+    /// The height of the tree.
+    /// </returns>
+    pointer_uint_q GetHeight() const
+    {
+        return m_uHeight;
+    }
+
+    /// <summary>
+    /// Sets the number of levels of a tree, this is, the depth of the deepest node plus one.
+    /// </summary>
+    /// <param name="uHeight">[IN] The height of the tree.</param>
+    void SetHeight(const pointer_uint_q uHeight)
+    {
+        m_uHeight = uHeight;
+    }
+
+    /// <summary>
+    /// Gets the average number of edges between the nodes of a tree and its root node.
+    /// </summary>
+    /// <returns>
+    /// The average depth of the nodes.
+    /// </returns>
+    float_q GetAverageDepth() const
+    {
+        return m_fAverageDepth;
+    }
+
+    /// <summary>
+    /// Sets the average number of edges between the nodes of a tree and its root node.
+    /// </summary>
+    /// <param name="fAverageDepth">[IN] The average depth of the nodes.</param>
+    void SetAverageDepth(const float_q fAverageDepth)
+    {
+        m_fAverageDepth = fAverageDepth;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+private:
+
+    /// <summary>
+    /// The number of elements in the container.
+    /// </summary>
+    pointer_uint_q m_uCount;
+
+    /// <summary>
+    /// The number of elements that can be stored in the container without reallocating memory.
+    /// </summary>
+    pointer_uint_q m_uCapacity;
+
+    /// <summary>
+    /// The number of bytes reserved by the allocators of the container.
+    /// </summary>
+    pointer_uint_q m_uReservedBytes;
+
+    /// <summary>
+    /// The number of bytes occupied by the allocated blocks of the container.
+    /// </summary>
+    pointer_uint_q m_uUsedBytes;
+
+    /// <summary>
+    /// The number of elements divided by the number of buckets.
+    /// </summary>
+    float_q m_fLoadFactor;
+
+    /// <summary>
+    /// The number of elements of the longest chain of colliding elements.
+    /// </summary>
+    pointer_uint_q m_uMaximumChainLength;
+
+    /// <summary>
+    /// The number of levels of a tree.
+    /// </summary>
+    pointer_uint_q m_uHeight;
+
+    /// <summary>
+    /// The average number of edges between the nodes of a tree and its root node.
+    /// </summary>
+    float_q m_fAverageDepth;
+};
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QCONTAINERSTATISTICS__
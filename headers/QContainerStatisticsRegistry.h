@@ -0,0 +1,178 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QCONTAINERSTATISTICSREGISTRY__
+#define __QCONTAINERSTATISTICSREGISTRY__
+
+#include "SystemDefinitions.h"
+#include "StringsDefinitions.h"
+#include "QContainerStatistics.h"
+#include "QDictionary.h"
+#include "QSharedMutex.h"
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Diagnosis
+{
+
+/// <summary>
+/// Accumulates the statistics of containers grouped by container type, so it is possible to know which kind of data structure 
+/// consumes or wastes most of the memory of a process.
+/// </summary>
+/// <remarks>
+/// It is a singleton.<br/>
+/// It is thread-safe.<br/>
+/// Containers do not register themselves; the statistics of a container are added explicitly, usually when taking a snapshot of the memory usage. The 
+/// type of a container is an arbitrary name chosen by the user (for example, "Entities by name" or "QHashtable&lt;string_q, QEntity*&gt;").
+/// </remarks>
+class QE_LAYER_SYSTEM_SYMBOLS QContainerStatisticsRegistry
+{
+    // TYPEDEFS
+    // ---------------
+protected:
+
+    typedef Kinesis::QuimeraEngine::Tools::Containers::QDictionary<Kinesis::QuimeraEngine::Common::DataTypes::string_q, 
+                                                                   Kinesis::QuimeraEngine::Tools::Containers::QContainerStatistics> StatisticsContainer;
+
+    typedef Kinesis::QuimeraEngine::Tools::Containers::QDictionary<Kinesis::QuimeraEngine::Common::DataTypes::string_q, 
+                                                                   Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q> ContainerCountContainer;
+
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    QContainerStatisticsRegistry();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the instance of the registry.
+    /// </summary>
+    /// <returns>
+    /// A unique instance of the registry.
+    /// </returns>
+    static QContainerStatisticsRegistry* Get();
+
+    /// <summary>
+    /// Adds the statistics of a container to the totals of its type.
+    /// </summary>
+    /// <param name="strContainerType">[IN] The name of the type of container. It must not be empty.</param>
+    /// <param name="statistics">[IN] The statistics of the container.</param>
+    void Add(const Kinesis::QuimeraEngine::Common::DataTypes::string_q &strContainerType, const Kinesis::QuimeraEngine::Tools::Containers::QContainerStatistics &statistics);
+
+    /// <summary>
+    /// Obtains the statistics of a container and adds them to the totals of its type.
+    /// </summary>
+    /// <typeparam name="ContainerT">The type of the container. It must provide a GetStatistics method.</typeparam>
+    /// <param name="strContainerType">[IN] The name of the type of container. It must not be empty.</param>
+    /// <param name="container">[IN] The container.</param>
+    template<class ContainerT>
+    void AddContainer(const Kinesis::QuimeraEngine::Common::DataTypes::string_q &strContainerType, const ContainerT &container)
+    {
+        this->Add(strContainerType, container.GetStatistics());
+    }
+
+    /// <summary>
+    /// Removes the totals of all the container types.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Gets the totals of a container type.
+    /// </summary>
+    /// <remarks>
+    /// The number of elements, the capacity and the bytes are the sum of the statistics of all the containers of the type. The maximum chain length and the height are 
+    /// the maximum values among all of them. The load factor and the average depth are the average of the values of all the containers.
+    /// </remarks>
+    /// <param name="strContainerType">[IN] The name of the type of container.</param>
+    /// <returns>
+    /// The totals of the container type. If no statistics were added for the type, all the properties are zero.
+    /// </returns>
+    Kinesis::QuimeraEngine::Tools::Containers::QContainerStatistics GetTotals(const Kinesis::QuimeraEngine::Common::DataTypes::string_q &strContainerType) const;
+
+    /// <summary>
+    /// Gets the number of containers whose statistics were added for a container type.
+    /// </summary>
+    /// <param name="strContainerType">[IN] The name of the type of container.</param>
+    /// <returns>
+    /// The number of containers. Zero if no statistics were added for the type.
+    /// </returns>
+    Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q GetNumberOfContainers(const Kinesis::QuimeraEngine::Common::DataTypes::string_q &strContainerType) const;
+
+    /// <summary>
+    /// Generates a text that contains the totals of every container type, one line per type, sorted by the name of the type.
+    /// </summary>
+    /// <remarks>
+    /// Every line has the following format: "TYPE: N containers, N elements, capacity N, N bytes reserved, N bytes used, N bytes unused, load factor N, 
+    /// maximum chain length N, height N, average depth N".
+    /// </remarks>
+    /// <returns>
+    /// The text that describes the totals of every container type. It is empty if there are no statistics.
+    /// </returns>
+    Kinesis::QuimeraEngine::Common::DataTypes::string_q ToString() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The accumulated statistics of every container type. The load factor and the average depth are stored as sums, not averages.
+    /// </summary>
+    StatisticsContainer m_totals;
+
+    /// <summary>
+    /// The number of containers whose statistics were added for every container type.
+    /// </summary>
+    ContainerCountContainer m_containerCounts;
+
+    // Synchronization
+
+    /// <summary>
+    /// Mutex to synchronize the access to the totals.
+    /// </summary>
+    mutable Kinesis::QuimeraEngine::System::Threading::QSharedMutex m_totalsMutex;
+
+};
+
+} //namespace Diagnosis
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QCONTAINERSTATISTICSREGISTRY__
@@ -51,7 +51,8 @@ namespace Containers
 /// </summary>
 /// <remarks>
 /// Key and value types are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
-/// If SQComparatorDefault is used as key comparator, keys will be forced to implement operators "==" and "<".
+/// If SQComparatorDefault is used as key comparator, keys will be forced to implement operators "==" and "<".<br/>
+/// Pairs are stored in a balanced binary search tree, so adding, removing and searching for keys take logarithmic time in the worst case.
 /// </remarks>
 /// <typeparam name="KeyT">The type of the keys associated to every value.</typeparam>
 /// <typeparam name="ValueT">The type of the values.</typeparam>
@@ -645,6 +646,18 @@ public:
     {
         m_keyValues.Reserve(uNumberOfElements);
     }
+
+    /// <summary>
+    /// Reduces the capacity of the dictionary so it is equal to the number of elements, releasing the memory that is not used.
+    /// </summary>
+    /// <remarks>
+    /// If the dictionary is empty, the capacity will be 1.<br/>
+    /// This operation implies a reallocation, which means that any pointer or iterator to elements of this dictionary will be pointing to garbage.
+    /// </remarks>
+    void ShrinkToFit()
+    {
+        m_keyValues.ShrinkToFit();
+    }
     
     /// <summary>
     /// Adds a key and its associated value to the dictionary.
@@ -855,6 +868,20 @@ public:
         return !QDictionary::operator==(dictionary);
     }
 
+    /// <summary>
+    /// Gets information about the memory usage and the shape of the dictionary.
+    /// </summary>
+    /// <remarks>
+    /// The height and the average depth refer to the internal binary search tree. This operation visits every key-value pair.
+    /// </remarks>
+    /// <returns>
+    /// The number of key-value pairs, the capacity, the bytes reserved and used, the height and the average depth of the nodes.
+    /// </returns>
+    QContainerStatistics GetStatistics() const
+    {
+        return m_keyValues.GetStatistics();
+    }
+
 
     // PROPERTIES
     // ---------------
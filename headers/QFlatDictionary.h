@@ -0,0 +1,1065 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QFLATDICTIONARY__
+#define __QFLATDICTIONARY__
+
+#include <cstring>
+
+#include "ToolsDefinitions.h"
+#include "Assertions.h"
+#include "SQComparatorDefault.h"
+#include "QPoolAllocator.h"
+#include "QKeyValuePair.h"
+#include "QArrayDynamic.h"
+#include "SQKeyValuePairComparator.h"
+#include "SQAnyTypeToStringConverter.h"
+#include "EQIterationDirection.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+using Kinesis::QuimeraEngine::Tools::Containers::EQIterationDirection;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+
+/// <summary>
+/// Represents a data structure that stores pairs composed of a value and its associated key which must be unique in the container. Pairs are stored
+/// contiguously, sorted by key, which makes it suitable for dictionaries that are filled once and then queried many times.
+/// </summary>
+/// <remarks>
+/// Key and value types are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
+/// If SQComparatorDefault is used as key comparator, keys will be forced to implement operators "==" and "<".<br/>
+/// Searching for a key takes logarithmic time and, unlike QDictionary, visits consecutive memory positions instead of following links among nodes.
+/// Adding or removing a single pair takes linear time since subsequent pairs have to be moved; use Build to fill the dictionary with many pairs at once.
+/// </remarks>
+/// <typeparam name="KeyT">The type of the keys associated to every value.</typeparam>
+/// <typeparam name="ValueT">The type of the values.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The allocator used to reserve memory. The default type is QPoolAllocator.</typeparam>
+/// <typeparam name="KeyComparatorT">Optional. The type of comparator utilized to compare keys. The default type is SQComparatorDefault.</typeparam>
+/// <typeparam name="ValueComparatorT">Optional. The type of comparator utilized to compare values. The default type is SQComparatorDefault.</typeparam>
+template<class KeyT, class ValueT, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, class KeyComparatorT = SQComparatorDefault<KeyT>, class ValueComparatorT = SQComparatorDefault<ValueT> >
+class QFlatDictionary
+{
+    // TYPEDEFS (I)
+    // ---------------
+protected:
+
+    typedef QKeyValuePair<KeyT, ValueT> KeyValuePairType;
+    typedef QArrayDynamic<KeyValuePairType, AllocatorT, SQKeyValuePairComparator<KeyT, ValueT, KeyComparatorT> > InternalArrayType;
+
+
+    // INTERNAL CLASSES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Iterator that steps once per key-value pair of a dictionary, from the lowest key to the greatest.
+    /// </summary>
+    /// <remarks>
+    /// Once an interator have been bound to a dictionary, it cannot point to another dictionary ever.<br/>
+    /// Iterators can be invalid, this means, they may not point to an existing position of the dictionary.<br/>
+    /// The position just before the first element or just after the last one (end positions) are considered as valid positions.
+    /// </remarks>
+    class QConstFlatDictionaryIterator
+    {
+        // CONSTRUCTORS
+	    // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the dictionary to iterate through and the position to physically point to. This constructor is intended
+        /// to be used internally, use GetFirst or GetLast methods of the QFlatDictionary class instead.
+        /// </summary>
+        /// <remarks>
+        /// If the dictionary is empty, it will point to the end position (forward iteration).
+        /// </remarks>
+        /// <param name="pDictionary">[IN] The dictionary to iterate through. It must not be null.</param>
+        /// <param name="uPosition">[IN] The position the iterator will point to. It must be lower than the number of elements in the dictionary.</param>
+        QConstFlatDictionaryIterator(const QFlatDictionary* pDictionary, const pointer_uint_q uPosition) : m_arrayIterator(&pDictionary->m_keyValues, uPosition),
+                                                                                                           m_pDictionary(pDictionary)
+        {
+        }
+
+
+        // METHODS
+	    // ---------------
+    public:
+
+        /// <summary>
+        /// Assignment operator that moves the iterator to the same position of other iterator.
+        /// </summary>
+        /// <param name="iterator">[IN] Iterator whose position will be copied. It must point to the same dictionary as the resident iterator.</param>
+        /// <returns>
+        /// A reference to the resident iterator.
+        /// </returns>
+        QConstFlatDictionaryIterator& operator=(const QConstFlatDictionaryIterator &iterator)
+        {
+            QE_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid.");
+            QE_ASSERT_ERROR(m_pDictionary == iterator.m_pDictionary, "The input iterator points to a different dictionary.");
+
+            m_arrayIterator = iterator.m_arrayIterator;
+
+            return *this;
+        }
+
+        /// <summary>
+        /// Indirection operator that returns a reference to the key-value pair the iterator points to.
+        /// </summary>
+        /// <returns>
+        /// A reference to the key-value pair the iterator points to. If the iterator is invalid or points to an end position,
+        /// the result is undefined.
+        /// </returns>
+        const KeyValuePairType& operator*() const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it is not possible to get the reference to the dictionary element.");
+
+            return *m_arrayIterator;
+        }
+
+        /// <summary>
+        /// Dereferencing operator that returns a pointer to the key-value pair the iterator points to.
+        /// </summary>
+        /// <returns>
+        /// A pointer to the key-value pair the iterator points to. If the iterator is invalid or points to an end position,
+        /// the result is undefined.
+        /// </returns>
+        const KeyValuePairType* operator->() const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it is not possible to get the pointer to the dictionary element.");
+
+            return m_arrayIterator.operator->();
+        }
+
+        /// <summary>
+        /// Post-increment operator that makes the iterator step forward after the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to increment an iterator that already points to the position after the last element (end position).<br/>
+        /// It is not possible to increment an invalid iterator.
+        /// </remarks>
+        /// <param name=".">[IN] Unused parameter.</param>
+        /// <returns>
+        /// A copy of the previous state of the iterator.
+        /// </returns>
+        QConstFlatDictionaryIterator operator++(int)
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it cannot be incremented");
+            QE_ASSERT_WARNING(!this->IsEnd(EQIterationDirection::E_Forward), "The iterator points to an end position, it is not possible to increment it");
+
+            QConstFlatDictionaryIterator iteratorCopy = *this;
+            m_arrayIterator++;
+            return iteratorCopy;
+        }
+
+        /// <summary>
+        /// Post-decrement operator that makes the iterator step backward after the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to decrement an iterator that already points to the position before the first element (end position).<br/>
+        /// It is not possible to decrement an invalid iterator.
+        /// </remarks>
+        /// <param name=".">[IN] Unused parameter.</param>
+        /// <returns>
+        /// A copy of the previous state of the iterator.
+        /// </returns>
+        QConstFlatDictionaryIterator operator--(int)
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it cannot be decremented");
+            QE_ASSERT_WARNING(!this->IsEnd(EQIterationDirection::E_Backward), "The iterator points to an end position, it is not possible to decrement it");
+
+            QConstFlatDictionaryIterator iteratorCopy = *this;
+            m_arrayIterator--;
+            return iteratorCopy;
+        }
+
+        /// <summary>
+        /// Pre-increment operator that makes the iterator step forward before the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to increment an iterator that already points to the position after the last element (end position).<br/>
+        /// It is not possible to increment an invalid iterator.
+        /// </remarks>
+        /// <returns>
+        /// A reference to the iterator.
+        /// </returns>
+        QConstFlatDictionaryIterator& operator++()
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it cannot be incremented");
+            QE_ASSERT_WARNING(!this->IsEnd(EQIterationDirection::E_Forward), "The iterator points to an end position, it is not possible to increment it");
+
+            ++m_arrayIterator;
+
+            return *this;
+        }
+
+        /// <summary>
+        /// Pre-decrement operator that makes the iterator step backward before the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to decrement an iterator that already points to the position before the first element (end position).<br/>
+        /// It is not possible to decrement an invalid iterator.
+        /// </remarks>
+        /// <returns>
+        /// A reference to the iterator.
+        /// </returns>
+        QConstFlatDictionaryIterator& operator--()
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it cannot be decremented");
+            QE_ASSERT_WARNING(!this->IsEnd(EQIterationDirection::E_Backward), "The iterator points to an end position, it is not possible to decrement it");
+
+            --m_arrayIterator;
+
+            return *this;
+        }
+
+        /// <summary>
+        /// Equality operator that checks if both iterators are the same.
+        /// </summary>
+        /// <remarks>
+        /// An iterator must point to the same position of the same dictionary to be considered equal.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if they are pointing to the same position of the same dictionary; False otherwise.
+        /// </returns>
+        bool operator==(const QConstFlatDictionaryIterator &iterator) const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+            QE_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid");
+            QE_ASSERT_ERROR(m_pDictionary == iterator.m_pDictionary, "Iterators point to different dictionaries");
+
+            return m_arrayIterator == iterator.m_arrayIterator;
+        }
+
+        /// <summary>
+        /// Inequality operator that checks if both iterators are different.
+        /// </summary>
+        /// <remarks>
+        /// An iterator that points to a different position or to a different dictionary is considered distinct.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if they are pointing to the a different position or a different dictionary; False otherwise.
+        /// </returns>
+        bool operator!=(const QConstFlatDictionaryIterator &iterator) const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+            QE_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid");
+            QE_ASSERT_ERROR(m_pDictionary == iterator.m_pDictionary, "Iterators point to different dictionaries");
+
+            return m_arrayIterator != iterator.m_arrayIterator;
+        }
+
+        /// <summary>
+        /// Greater than operator that checks whether resident iterator points to a more posterior position than the input iterator.
+        /// </summary>
+        /// <remarks>
+        /// If iterators point to different dictionaries or they are not valid, the result is undefined.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if the resident iterator points to a more posterior position than the input iterator; False otherwise.
+        /// </returns>
+        bool operator>(const QConstFlatDictionaryIterator &iterator) const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+            QE_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid");
+            QE_ASSERT_ERROR(m_pDictionary == iterator.m_pDictionary, "Iterators point to different dictionaries");
+
+            return m_arrayIterator > iterator.m_arrayIterator;
+        }
+
+        /// <summary>
+        /// Lower than operator that checks whether resident iterator points to a more anterior position than the input iterator.
+        /// </summary>
+        /// <remarks>
+        /// If iterators point to different dictionaries or they are not valid, the result is undefined.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if the resident iterator points to a more anterior position than the input iterator; False otherwise.
+        /// </returns>
+        bool operator<(const QConstFlatDictionaryIterator &iterator) const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+            QE_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid");
+            QE_ASSERT_ERROR(m_pDictionary == iterator.m_pDictionary, "Iterators point to different dictionaries");
+
+            return m_arrayIterator < iterator.m_arrayIterator;
+        }
+
+        /// <summary>
+        /// Greater than or equal to operator that checks whether resident iterator points to a more posterior position than the
+        /// input iterator or to the same position.
+        /// </summary>
+        /// <remarks>
+        /// If iterators point to different dictionaries or they are not valid, the result is undefined.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if the resident iterator points to a more posterior position than the input iterator or to the same position; False otherwise.
+        /// </returns>
+        bool operator>=(const QConstFlatDictionaryIterator &iterator) const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+            QE_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid");
+            QE_ASSERT_ERROR(m_pDictionary == iterator.m_pDictionary, "Iterators point to different dictionaries");
+
+            return m_arrayIterator >= iterator.m_arrayIterator;
+        }
+
+        /// <summary>
+        /// Lower than or equal to operator that checks whether resident iterator points to a more anterior position than the input
+        /// iterator or to the same position.
+        /// </summary>
+        /// <remarks>
+        /// If iterators point to different dictionaries or they are not valid, the result is undefined.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if the resident iterator points to a more anterior position than the input iterator or to the same position; False otherwise.
+        /// </returns>
+        bool operator<=(const QConstFlatDictionaryIterator &iterator) const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+            QE_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid");
+            QE_ASSERT_ERROR(m_pDictionary == iterator.m_pDictionary, "Iterators point to different dictionaries");
+
+            return m_arrayIterator <= iterator.m_arrayIterator;
+        }
+
+        /// <summary>
+        /// Indicates whether the iterator is pointing to one of the ends of the dictionary.
+        /// </summary>
+        /// <remarks>
+        /// The position immediately before the first element and the position immediately after the last element are cosidered end
+        /// positions; therefore, this method can be used for both forward and backard iteration.<br/>
+        /// An invalid iterator is not considered as an end position.
+        /// </remarks>
+        /// <returns>
+        /// True if the iterator is pointing to an end position; False otherwise.
+        /// </returns>
+        bool IsEnd() const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+
+            return m_arrayIterator.IsEnd();
+        }
+
+        /// <summary>
+        /// Indicates whether the iterator is pointing to one of the ends of the dictionary, distinguishing which of them.
+        /// </summary>
+        /// <remarks>
+        /// The position immediately before the first element and the position immediately after the last element are cosidered end
+        /// positions; therefore, this method can be used for both forward and backard iteration.<br/>
+        /// An invalid iterator is not considered as an end position.
+        /// </remarks>
+        /// <param name="eIterationDirection">[IN] The iteration direction used to identify which of the end positions is checked.</param>
+        /// <returns>
+        /// True if the iterator is pointing to the position after the last element when iterating forward or if it is
+        /// pointing to the position immediately before the first position when iterating backward; False otherwise.
+        /// </returns>
+        bool IsEnd(const EQIterationDirection &eIterationDirection) const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+
+            return m_arrayIterator.IsEnd(eIterationDirection);
+        }
+
+        /// <summary>
+        /// Makes the iterator point to the first position.
+        /// </summary>
+        /// <remarks>
+        /// If the dictionary is empty, the iterator will point to the end position (forward iteration).
+        /// </remarks>
+        void MoveFirst()
+        {
+            m_arrayIterator = typename InternalArrayType::ConstIterator(&m_pDictionary->m_keyValues,
+                                                                        m_pDictionary->IsEmpty() ? QFlatDictionary::END_POSITION_FORWARD : 0);
+        }
+
+        /// <summary>
+        /// Makes the iterator point to the last position.
+        /// </summary>
+        /// <remarks>
+        /// If the dictionary is empty, the iterator will point to the end position (forward iteration).
+        /// </remarks>
+        void MoveLast()
+        {
+            m_arrayIterator = typename InternalArrayType::ConstIterator(&m_pDictionary->m_keyValues,
+                                                                        m_pDictionary->IsEmpty() ? QFlatDictionary::END_POSITION_FORWARD :
+                                                                                                   m_pDictionary->GetCount() - 1U);
+        }
+
+        /// <summary>
+        /// Checks whether the iterator is valid or not.
+        /// </summary>
+        /// <remarks>
+        /// An iterator is considered invalid when it points to an unexisting position (a dictionary may have been shortened while the iterator
+        /// was pointing to its last position). If the dictionary to iterate has been destroyed, there is no way for the iterator to realize that so
+        /// its behavior is undefined and this method will not detect that situation.<br/>
+        /// The position before the first element or after the last one (end positions) are considered as valid positions.
+        /// </remarks>
+        /// <returns>
+        /// True if the iterator is valid; False otherwise.
+        /// </returns>
+        bool IsValid() const
+        {
+            return m_arrayIterator.IsValid();
+        }
+
+        /// <summary>
+        /// Gets the container that is being traversed by the iterator.
+        /// </summary>
+        /// <returns>
+        /// A pointer to the container. It never changes since the iterator is created.
+        /// </returns>
+        const QFlatDictionary* GetContainer() const
+        {
+            return m_pDictionary;
+        }
+
+        /// <summary>
+        /// Gets the "physical" position of the container's allocated buffer where the iterator is pointing to.
+        /// </summary>
+        /// <remarks>
+        /// This method is intended to be used internally by containers, users should not call it.
+        /// </remarks>
+        /// <returns>
+        /// The position the iterator points to.
+        /// </returns>
+        pointer_uint_q GetInternalPosition() const
+        {
+            return m_arrayIterator.GetInternalPosition();
+        }
+
+
+        // ATTRIBUTES
+	    // ---------------
+    protected:
+
+        /// <summary>
+        /// A wrapped array iterator.
+        /// </summary>
+        typename InternalArrayType::ConstIterator m_arrayIterator;
+
+        /// <summary>
+        /// The traversed dictionary.
+        /// </summary>
+        const QFlatDictionary* m_pDictionary;
+
+    }; // QConstFlatDictionaryIterator
+
+
+    // TYPEDEFS (II)
+    // ---------------
+public:
+
+    typedef typename QFlatDictionary::QConstFlatDictionaryIterator ConstIterator;
+
+
+   	// CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// Constant to symbolize the absence of a key-value pair or the end of the sequence when the dictionary is traversed forward.
+    /// </summary>
+    static const pointer_uint_q END_POSITION_FORWARD = -2;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    QFlatDictionary()
+    {
+    }
+
+    /// <summary>
+    /// Constructor that receives the initial capacity.
+    /// </summary>
+    /// <param name="uInitialCapacity">[IN] The number of key-value pairs for which to reserve memory. It must be greater than zero.</param>
+    explicit QFlatDictionary(const pointer_uint_q uInitialCapacity) : m_keyValues(uInitialCapacity)
+    {
+    }
+
+    /// <summary>
+    /// Copy constructor that receives another instance and stores a copy of it.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor is called for every key and value, from the lowest key to the greatest.
+    /// </remarks>
+    /// <param name="dictionary">[IN] The other dictionary to be copied.</param>
+    QFlatDictionary(const QFlatDictionary &dictionary) : m_keyValues(dictionary.m_keyValues)
+    {
+    }
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every key and value will be called, from the lowest key to the greatest.
+    /// </remarks>
+    ~QFlatDictionary()
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Assignment operator that receives another instance and stores a copy of it.
+    /// </summary>
+    /// <remarks>
+    /// All the elements in the resident dictionary will be firstly removed, calling each keys's and value's destructor.
+    /// The copy constructor is then called for every copied key and value, from the lowest key to the greatest.
+    /// </remarks>
+    /// <param name="dictionary">[IN] The other dictionary to be copied.</param>
+    /// <returns>
+    /// A reference to the resultant dictionary.
+    /// </returns>
+    QFlatDictionary& operator=(const QFlatDictionary &dictionary)
+    {
+        if(this != &dictionary)
+        {
+            m_keyValues.Clear();
+
+            if(!dictionary.IsEmpty())
+                m_keyValues.AddRange(dictionary.m_keyValues.GetFirst(), dictionary.m_keyValues.GetLast());
+        }
+
+        return *this;
+    }
+
+    /// <summary>
+    /// Performs a shallow copy of the content of the dictionary to another dictionary.
+    /// </summary>
+    /// <remarks>
+    /// Care must be taken when instances store pointers to other objects (like strings do); cloning such types may lead to hard-to-debug errors.<br/>
+    /// If the capacity of the destination dictionary is lower than the resident's, it will reserve more memory before the copy takes place.<br/>
+    /// No constructors will be called during this operation.
+    /// </remarks>
+    /// <param name="destinationDictionary">[IN/OUT] The destination dictionary to which the contents will be copied.</param>
+    void Clone(QFlatDictionary &destinationDictionary) const
+    {
+        m_keyValues.Clone(destinationDictionary.m_keyValues);
+    }
+
+    /// <summary>
+    /// Array subscript operator that receives a key and retrieves its associated value.
+    /// </summary>
+    /// <param name="key">[IN] A key whose associated value will be obtained. It must exist in the dictionary.</param>
+    /// <returns>
+    /// A reference to the associated value.
+    /// </returns>
+    ValueT& operator[](const KeyT &key) const
+    {
+        return this->GetValue(key);
+    }
+
+    /// <summary>
+    /// Gets the value that corresponds to the given key.
+    /// </summary>
+    /// <param name="key">[IN] A key whose associated value will be obtained. It must exist in the dictionary.</param>
+    /// <returns>
+    /// A reference to the associated value.
+    /// </returns>
+    ValueT& GetValue(const KeyT& key) const
+    {
+        const pointer_uint_q POSITION = this->_FindKey(key);
+
+        QE_ASSERT_ERROR(POSITION != QFlatDictionary::END_POSITION_FORWARD, "The specified key does not exist.");
+
+        return m_keyValues[POSITION].GetValue();
+    }
+
+    /// <summary>
+    /// Sets the value that corresponds to the given key.
+    /// </summary>
+    /// <remarks>
+    /// It calls the assignment operator of the value.
+    /// </remarks>
+    /// <param name="key">[IN] A key whose associated value will be modified. It must exist in the dictionary.</param>
+    /// <param name="newValue">[IN] The value that will replace the existing one.</param>
+    void SetValue(const KeyT& key, const ValueT& newValue) const
+    {
+        this->GetValue(key) = newValue;
+    }
+
+    /// <summary>
+    /// Empties the dictionary.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of each key and value will be called, from the lowest key to the greatest.
+    /// </remarks>
+    void Clear()
+    {
+        m_keyValues.Clear();
+    }
+
+    /// <summary>
+    /// Increases the capacity of the dictionary, reserving memory for more elements.
+    /// </summary>
+    /// <remarks>
+    /// This operation implies a reallocation, which means that any pointer to elements of this dictionary will be pointing to garbage.
+    /// </remarks>
+    /// <param name="uNumberOfElements">[IN] The number of elements for which to reserve memory. It should be greater than the
+    /// current capacity or nothing will happen.</param>
+    void Reserve(const pointer_uint_q uNumberOfElements)
+    {
+        m_keyValues.Reserve(uNumberOfElements);
+    }
+
+    /// <summary>
+    /// Replaces the content of the dictionary with a set of keys and their associated values, sorting all of them at once.
+    /// </summary>
+    /// <remarks>
+    /// This is the fastest way to fill the dictionary with many pairs, since adding them one by one implies moving the subsequent pairs every time.<br/>
+    /// The destructor of every existing key and value will be called. Then, the copy constructor of every new key and value will be called.<br/>
+    /// This operation may imply a reallocation, which means that any pointer to elements of this dictionary will be pointing to garbage.
+    /// </remarks>
+    /// <param name="arKeys">[IN] The keys to add, in any order. Keys must be unique. It must not be null.</param>
+    /// <param name="arValues">[IN] The values associated to every key, in the same order. It must not be null.</param>
+    /// <param name="uNumberOfPairs">[IN] The number of keys and values in the input arrays.</param>
+    void Build(const KeyT* arKeys, const ValueT* arValues, const pointer_uint_q uNumberOfPairs)
+    {
+        QE_ASSERT_ERROR(arKeys != null_q, "The input array of keys must not be null.");
+        QE_ASSERT_ERROR(arValues != null_q, "The input array of values must not be null.");
+
+        m_keyValues.Clear();
+
+        if(uNumberOfPairs > m_keyValues.GetCapacity())
+            m_keyValues.Reserve(uNumberOfPairs);
+
+        for(pointer_uint_q i = 0; i < uNumberOfPairs; ++i)
+            m_keyValues.Add(KeyValuePairType(arKeys[i], arValues[i]));
+
+        if(uNumberOfPairs > 1U)
+        {
+            this->_Sort();
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT != QE_CONFIG_ASSERTSBEHAVIOR_DISABLED
+            // Since pairs are sorted, duplicate keys are contiguous
+            for(pointer_uint_q i = 1U; i < uNumberOfPairs; ++i)
+            {
+                QE_ASSERT_ERROR(KeyComparatorT::Compare(m_keyValues[i - 1U].GetKey(), m_keyValues[i].GetKey()) != 0, "The input keys must be unique.");
+            }
+#endif
+        }
+    }
+
+    /// <summary>
+    /// Adds a key and its associated value to the dictionary.
+    /// </summary>
+    /// <remarks>
+    /// All the pairs whose key is greater than the new key are moved one position forward, which will affect the content pointed to by any existing iterator.<br/>
+    /// This operation may imply a reallocation, which means that any pointer to elements of this dictionary will be pointing to garbage.<br/>
+    /// The copy constructor of both the new key and the new value will be called.
+    /// </remarks>
+    /// <param name="key">[IN] The new key. It must not exist in the directory yet.</param>
+    /// <param name="value">[IN] The new value associated to the new key.</param>
+    /// <returns>
+    /// An iterator that points to the just added key-value pair.
+    /// </returns>
+    QConstFlatDictionaryIterator Add(const KeyT &key, const ValueT &value)
+    {
+        QE_ASSERT_ERROR(!this->ContainsKey(key), "The key already exists in the dictionary.");
+
+        const pointer_uint_q POSITION = this->_LowerBound(key);
+
+        if(POSITION == m_keyValues.GetCount())
+            m_keyValues.Add(KeyValuePairType(key, value));
+        else
+            m_keyValues.Insert(KeyValuePairType(key, value), POSITION);
+
+        return QConstFlatDictionaryIterator(this, POSITION);
+    }
+
+    /// <summary>
+    /// Removes an key-value pair from the dictionary by its position.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of both the key and the value will be called.<br/>
+    /// All the subsequent pairs are moved one position backward, which will affect the content pointed to by any existing iterator.
+    /// </remarks>
+    /// <param name="pairPosition">[IN] The position of the key-value pair to remove. It must not point to the end position.</param>
+    /// <returns>
+    /// An iterator that points to the next key-value pair. If the removed pair was the last one in the dictionary, the returned iterator will point to the end position.
+    /// </returns>
+    QConstFlatDictionaryIterator Remove(const typename QFlatDictionary::QConstFlatDictionaryIterator &pairPosition)
+    {
+        QE_ASSERT_ERROR(!pairPosition.IsEnd(), "The input iterator must not point to an end position.");
+        QE_ASSERT_ERROR(pairPosition.GetContainer() == this, "The input iterator points to a different dictionary.");
+
+        const pointer_uint_q POSITION = pairPosition.GetInternalPosition();
+
+        m_keyValues.Remove(POSITION);
+
+        // The next pair now occupies the position of the removed one
+        return QConstFlatDictionaryIterator(this, POSITION < m_keyValues.GetCount() ? POSITION : QFlatDictionary::END_POSITION_FORWARD);
+    }
+
+    /// <summary>
+    /// Removes an key-value pair from the dictionary by its key.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of both the key and the value will be called.<br/>
+    /// All the subsequent pairs are moved one position backward, which will affect the content pointed to by any existing iterator.
+    /// </remarks>
+    /// <param name="key">[IN] The key to search for. It must exist in the dictionary.</param>
+    void Remove(const KeyT &key)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQAnyTypeToStringConverter;
+
+        const pointer_uint_q POSITION = this->_FindKey(key);
+
+        QE_ASSERT_ERROR(POSITION != QFlatDictionary::END_POSITION_FORWARD, string_q("The input key (") + SQAnyTypeToStringConverter::Convert(key) + ") does not exist in the dictionary.");
+
+        if(POSITION != QFlatDictionary::END_POSITION_FORWARD)
+            m_keyValues.Remove(POSITION);
+    }
+
+    /// <summary>
+    /// Gets the first element in the dictionary, which is the one whose key is the lowest.
+    /// </summary>
+    /// <returns>
+    /// An iterator that points to the first key-value pair. If the dictionary is empty, the iterator will point to the end position.
+    /// </returns>
+    QConstFlatDictionaryIterator GetFirst() const
+    {
+        QFlatDictionary::QConstFlatDictionaryIterator iterator(this, QFlatDictionary::END_POSITION_FORWARD);
+        iterator.MoveFirst();
+        return iterator;
+    }
+
+    /// <summary>
+    /// Gets the last element in the dictionary, which is the one whose key is the greatest.
+    /// </summary>
+    /// <returns>
+    /// An iterator that points to the last key-value pair. If the dictionary is empty, the iterator will point to the end position.
+    /// </returns>
+    QConstFlatDictionaryIterator GetLast() const
+    {
+        QFlatDictionary::QConstFlatDictionaryIterator iterator(this, QFlatDictionary::END_POSITION_FORWARD);
+        iterator.MoveLast();
+        return iterator;
+    }
+
+    /// <summary>
+    /// Checks whether there is any value in the dictionary that is equal to another given value.
+    /// </summary>
+    /// <remarks>
+    /// Values are compared to the provided value using the container's value comparator.<br/>
+    /// </remarks>
+    /// <param name="value">[IN] The value to search for.</param>
+    /// <returns>
+    /// True if the value is present in the dictionary; False otherwise.
+    /// </returns>
+    bool ContainsValue(const ValueT &value) const
+    {
+        const pointer_uint_q COUNT = m_keyValues.GetCount();
+        pointer_uint_q i = 0;
+
+        while(i < COUNT && ValueComparatorT::Compare(m_keyValues[i].GetValue(), value) != 0)
+            ++i;
+
+        return i < COUNT;
+    }
+
+    /// <summary>
+    /// Checks whether there is any key in the dictionary that is equal to other given key.
+    /// </summary>
+    /// <remarks>
+    /// Keys are compared to the provided key using the container's key comparator.<br/>
+    /// </remarks>
+    /// <param name="key">[IN] The key to search for.</param>
+    /// <returns>
+    /// True if the key is present in the dictionary; False otherwise.
+    /// </returns>
+    bool ContainsKey(const KeyT &key) const
+    {
+        return this->_FindKey(key) != QFlatDictionary::END_POSITION_FORWARD;
+    }
+
+    /// <summary>
+    /// Searches for a given key-value pair and obtains its position.
+    /// </summary>
+    /// <param name="key">[IN] The key of the pair to search for.</param>
+    /// <returns>
+    /// An iterator that points to the position of the key-value pair. If the key is not present in the dictionary, the iterator will point to the end position.
+    /// </returns>
+    QConstFlatDictionaryIterator PositionOfKey(const KeyT &key) const
+    {
+        return QConstFlatDictionaryIterator(this, this->_FindKey(key));
+    }
+
+    /// <summary>
+    /// Equality operator that checks whether two dictionaries are equal.
+    /// </summary>
+    /// <remarks>
+    /// Every key and value are compared with the key and value at the same position in the other dictionary. Keys and values are compared using the dictionary's
+    /// key and value comparator, respectively. The order in which key-value pairs were added is not relevant.
+    /// </remarks>
+    /// <param name="dictionary">[IN] The dictionary to compare to.</param>
+    /// <returns>
+    /// True if all the keys and values of both dictionaries are equal; False otherwise.
+    /// </returns>
+    bool operator==(const QFlatDictionary &dictionary) const
+    {
+        bool bResult = this->GetCount() == dictionary.GetCount();
+
+        if(bResult && this != &dictionary)
+        {
+            const pointer_uint_q COUNT = m_keyValues.GetCount();
+
+            for(pointer_uint_q i = 0; i < COUNT && bResult; ++i)
+            {
+                bResult = KeyComparatorT::Compare(m_keyValues[i].GetKey(), dictionary.m_keyValues[i].GetKey())       == 0 &&
+                          ValueComparatorT::Compare(m_keyValues[i].GetValue(), dictionary.m_keyValues[i].GetValue()) == 0;
+            }
+        }
+
+        return bResult;
+    }
+
+    /// <summary>
+    /// Inequality operator that checks whether two dictionaries are different.
+    /// </summary>
+    /// <remarks>
+    /// Every key and value are compared with the key and value at the same position in the other dictionary. Keys and values are compared using the dictionary's
+    /// key and value comparators, respectively. The order in which key-value pairs were added is not relevant.
+    /// </remarks>
+    /// <param name="dictionary">[IN] The dictionary to compare to.</param>
+    /// <returns>
+    /// True if any of the keys or values are different; False otherwise.
+    /// </returns>
+    bool operator!=(const QFlatDictionary &dictionary) const
+    {
+        return !QFlatDictionary::operator==(dictionary);
+    }
+
+private:
+
+    /// <summary>
+    /// Calculates the position of the first pair whose key is not lower than a given key.
+    /// </summary>
+    /// <remarks>
+    /// The search halves the range on every step by selecting one of the halves with a conditional assignment instead of a jump,
+    /// so the compiler can generate a conditional move and there are no branch mispredictions; the number of iterations depends only on the number of pairs.
+    /// </remarks>
+    /// <param name="key">[IN] The key to search for.</param>
+    /// <returns>
+    /// The position of the first pair whose key is equal to or greater than the input key. If all the keys are lower, it returns the number of pairs.
+    /// </returns>
+    pointer_uint_q _LowerBound(const KeyT &key) const
+    {
+        pointer_uint_q uCount = m_keyValues.GetCount();
+        pointer_uint_q uFirst = 0;
+
+        if(uCount > 0)
+        {
+            const KeyValuePairType* arPairs = &m_keyValues[0];
+
+            while(uCount > 1U)
+            {
+                const pointer_uint_q HALF = uCount >> 1U;
+                uFirst = KeyComparatorT::Compare(arPairs[uFirst + HALF].GetKey(), key) < 0 ? uFirst + HALF : uFirst;
+                uCount -= HALF;
+            }
+
+            uFirst += KeyComparatorT::Compare(arPairs[uFirst].GetKey(), key) < 0 ? 1U : 0;
+        }
+
+        return uFirst;
+    }
+
+    /// <summary>
+    /// Searches for a key in the dictionary.
+    /// </summary>
+    /// <param name="key">[IN] The key to search for.</param>
+    /// <returns>
+    /// The position of the pair that contains the key. If the key is not present in the dictionary, it returns the end position.
+    /// </returns>
+    pointer_uint_q _FindKey(const KeyT &key) const
+    {
+        const pointer_uint_q POSITION = this->_LowerBound(key);
+
+        return POSITION < m_keyValues.GetCount() && KeyComparatorT::Compare(m_keyValues[POSITION].GetKey(), key) == 0 ? POSITION :
+                                                                                                                        QFlatDictionary::END_POSITION_FORWARD;
+    }
+
+    /// <summary>
+    /// Sorts all the pairs by their key, from the lowest to the greatest, using the heapsort algorithm.
+    /// </summary>
+    /// <remarks>
+    /// Pairs are swapped by copying their bytes, no assignment operator nor copy constructors are called. No additional memory is required.
+    /// </remarks>
+    void _Sort()
+    {
+        KeyValuePairType* arPairs = &m_keyValues[0];
+        const pointer_uint_q COUNT = m_keyValues.GetCount();
+
+        // Builds a max-heap whose root is the pair with the greatest key
+        for(pointer_uint_q uParent = COUNT >> 1U; uParent > 0; --uParent)
+            QFlatDictionary::_SiftDown(arPairs, uParent - 1U, COUNT);
+
+        // Moves the root to the end of the heap and restores the heap with the remaining pairs
+        for(pointer_uint_q uHeapSize = COUNT - 1U; uHeapSize > 0; --uHeapSize)
+        {
+            QFlatDictionary::_SwapPairs(arPairs, 0, uHeapSize);
+            QFlatDictionary::_SiftDown(arPairs, 0, uHeapSize);
+        }
+    }
+
+    /// <summary>
+    /// Moves a pair down in a max-heap until its key is greater than the keys of its children.
+    /// </summary>
+    /// <param name="arPairs">[IN/OUT] The pairs that form the heap.</param>
+    /// <param name="uPosition">[IN] The position of the pair to move.</param>
+    /// <param name="uHeapSize">[IN] The number of pairs in the heap.</param>
+    static void _SiftDown(KeyValuePairType* arPairs, pointer_uint_q uPosition, const pointer_uint_q uHeapSize)
+    {
+        pointer_uint_q uChild = uPosition * 2U + 1U;
+
+        while(uChild < uHeapSize)
+        {
+            // Selects the child with the greatest key
+            if(uChild + 1U < uHeapSize && KeyComparatorT::Compare(arPairs[uChild].GetKey(), arPairs[uChild + 1U].GetKey()) < 0)
+                ++uChild;
+
+            if(KeyComparatorT::Compare(arPairs[uPosition].GetKey(), arPairs[uChild].GetKey()) >= 0)
+                break;
+
+            QFlatDictionary::_SwapPairs(arPairs, uPosition, uChild);
+            uPosition = uChild;
+            uChild = uPosition * 2U + 1U;
+        }
+    }
+
+    /// <summary>
+    /// Swaps two pairs by copying their bytes.
+    /// </summary>
+    /// <param name="arPairs">[IN/OUT] The array that contains both pairs.</param>
+    /// <param name="uPairA">[IN] The position of a pair.</param>
+    /// <param name="uPairB">[IN] The position of the other pair.</param>
+    static void _SwapPairs(KeyValuePairType* arPairs, const pointer_uint_q uPairA, const pointer_uint_q uPairB)
+    {
+        u8_q arBytes[sizeof(KeyValuePairType)];
+        memcpy(arBytes,          &arPairs[uPairA], sizeof(KeyValuePairType));
+        memcpy(&arPairs[uPairA], &arPairs[uPairB], sizeof(KeyValuePairType));
+        memcpy(&arPairs[uPairB], arBytes,          sizeof(KeyValuePairType));
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the allocator of keys and values.
+    /// </summary>
+    /// <returns>
+    /// The key-value allocator.
+    /// </returns>
+    const AllocatorT* GetAllocator() const
+    {
+        return m_keyValues.GetAllocator();
+    }
+
+    /// <summary>
+    /// Gets the capacity of the directory, which means the number of elements that can be added before they are reallocated to
+    /// another part of memory.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the dictionary.
+    /// </returns>
+    pointer_uint_q GetCapacity() const
+    {
+        return m_keyValues.GetCapacity();
+    }
+
+    /// <summary>
+    /// Gets the number of elements added to the dictionary.
+    /// </summary>
+    /// <returns>
+    /// The number of elements in the dictionary.
+    /// </returns>
+    pointer_uint_q GetCount() const
+    {
+        return m_keyValues.GetCount();
+    }
+
+    /// <summary>
+    /// Indicates whether the dictionary is empty or not.
+    /// </summary>
+    /// <returns>
+    /// True if the dictionary is empty; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_keyValues.IsEmpty();
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The internal array that holds all the key-value pairs, sorted by key.
+    /// </summary>
+    InternalArrayType m_keyValues;
+};
+
+
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QFLATDICTIONARY__
@@ -0,0 +1,1269 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QFLATHASHTABLE__
+#define __QFLATHASHTABLE__
+
+#include <emmintrin.h> // Includes __m128i definition and SSE2 integer operations.
+#include <cstring>
+
+#include "DataTypesDefinitions.h"
+#include "ToolsDefinitions.h"
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+#include "AllocationOperators.h"
+#include "SQComparatorDefault.h"
+#include "QKeyValuePair.h"
+#include "SQIntegerHashProvider.h"
+#include "QPoolAllocator.h"
+#include "QAlignment.h"
+#include "SQAnyTypeToStringConverter.h"
+#include "QArrayResult.h"
+#include "EQIterationDirection.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Represents a hash table, a data structure that acts as an associative array that maps unique keys to values, whose key-value pairs are stored
+/// contiguously in memory.
+/// </summary>
+/// <remarks>
+/// The hash table is implemented following the open-addressing model (a.k.a. closed hashing). Key-value pairs are stored in a single array of slots and
+/// every slot has an associated control byte that indicates whether the slot is empty, full or was deleted; when it is full, the control byte also stores
+/// 7 bits of the hash of the key. Slots are divided into groups of 16, whose control bytes are compared at once using SSE2 instructions, so most
+/// lookups only touch one group of control bytes and one slot.<br/>
+/// Groups are probed following a triangular sequence, which visits every group since the number of groups is always a power of two.<br/>
+/// When more than 7/8 of the slots are in use, the capacity is doubled and all the key-value pairs are moved to their new positions. Key-value pairs are
+/// moved by copying their bytes, no constructors, destructors nor assignment operators are called.<br/>
+/// The same hash providers as in QHashtable can be used; the full hash key is obtained by passing the maximum integer value as the number of buckets.<br/>
+/// Keys and values are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
+/// If SQComparatorDefault is used as key comparator, keys will be forced to implement operators "==" and "<".
+/// </remarks>
+/// <typeparam name="KeyT">The type of the key associated to every value in the table.</typeparam>
+/// <typeparam name="ValueT">The type of the values stored in the table.</typeparam>
+/// <typeparam name="HashProviderT">Optional. The type of the hash provider. By default, it is SQIntegerHashProvider.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The type of the allocator that reserves memory for slots and control bytes. By default, it is QPoolAllocator.</typeparam>
+/// <typeparam name="KeyComparatorT">Optional. The type of comparator utilized to compare keys. The default type is SQComparatorDefault.</typeparam>
+/// <typeparam name="ValueComparatorT">Optional. The type of comparator utilized to compare values. The default type is SQComparatorDefault.</typeparam>
+template<class KeyT, class ValueT, class HashProviderT = SQIntegerHashProvider,
+                                   class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator,
+                                   class KeyComparatorT = SQComparatorDefault<KeyT>,
+                                   class ValueComparatorT = SQComparatorDefault<ValueT> >
+class QFlatHashtable
+{
+    // TYPEDEFS (I)
+    // ---------------
+protected:
+
+    typedef QKeyValuePair<KeyT, ValueT> KeyValuePairType;
+
+
+    // INTERNAL CLASSES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Iterator that steps once per key-value pair of a flat hashtable, in an undefined order.
+    /// </summary>
+    /// <remarks>
+    /// Once an interator have been bound to a hashtable, it cannot point to another hashtable ever.<br/>
+    /// Iterators can be invalid, this means, they may not point to an existing position of the hashtable.<br/>
+    /// The position just before the first element or just after the last one (end positions) are considered as valid positions.<br/>
+    /// Any addition to the hashtable may move key-value pairs to other positions; iterators should not be used after an addition.
+    /// </remarks>
+    class QConstFlatHashtableIterator
+    {
+        // CONSTRUCTORS
+	    // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the hashtable to iterate through and the position to physically point to. This constructor is intended
+        /// to be used internally, use GetFirst or GetLast methods of the QFlatHashtable class instead.
+        /// </summary>
+        /// <param name="pHashtable">[IN] The hashtable to iterate through. It must not be null.</param>
+        /// <param name="uPosition">[IN] The position the iterator will point to. This is not the logical position of hashtable elements, but the physical.
+        /// It must be lower than the capacity of the hashtable and the slot must be in use, unless it is an end position.</param>
+        QConstFlatHashtableIterator(const QFlatHashtable* pHashtable, const pointer_uint_q uPosition) : m_pHashtable(pHashtable),
+                                                                                                        m_uPosition(uPosition)
+        {
+            QE_ASSERT_ERROR(pHashtable != null_q, "Invalid argument: The pointer to the hashtable cannot be null");
+            QE_ASSERT_WARNING(uPosition == QFlatHashtable::END_POSITION_BACKWARD ||
+                              uPosition == QFlatHashtable::END_POSITION_FORWARD ||
+                              (pHashtable->m_uNumberOfSlots > uPosition && pHashtable->_IsFull(uPosition)),
+                              "Invalid argument: The position must point to a slot in use");
+        }
+
+
+        // METHODS
+	    // ---------------
+    public:
+
+        /// <summary>
+        /// Assignment operator that moves the iterator to the same position of other iterator.
+        /// </summary>
+        /// <param name="iterator">[IN] Iterator whose position will be copied. It must point to the same hashtable as the resident iterator.</param>
+        /// <returns>
+        /// A reference to the resident iterator.
+        /// </returns>
+        QConstFlatHashtableIterator& operator=(const QConstFlatHashtableIterator &iterator)
+        {
+            QE_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid.");
+            QE_ASSERT_ERROR(m_pHashtable == iterator.m_pHashtable, "The input iterator points to a different hashtable.");
+
+            m_uPosition = iterator.m_uPosition;
+
+            return *this;
+        }
+
+        /// <summary>
+        /// Indirection operator that returns a reference to the key-value pair the iterator points to.
+        /// </summary>
+        /// <returns>
+        /// A reference to the key-value pair the iterator points to. If the iterator is invalid or points to an end position,
+        /// the result is undefined.
+        /// </returns>
+        const KeyValuePairType& operator*() const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it is not possible to get the reference to the hashtable element.");
+            QE_ASSERT_ERROR(!this->IsEnd(), "The iterator points to an end position, it is not possible to get the reference to the hashtable element.");
+
+            return m_pHashtable->m_pSlots[m_uPosition];
+        }
+
+        /// <summary>
+        /// Dereferencing operator that returns a pointer to the key-value pair the iterator points to.
+        /// </summary>
+        /// <returns>
+        /// A pointer to the key-value pair the iterator points to. If the iterator is invalid or points to an end position,
+        /// the result is undefined.
+        /// </returns>
+        const KeyValuePairType* operator->() const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it is not possible to get the pointer to the hashtable element.");
+            QE_ASSERT_ERROR(!this->IsEnd(), "The iterator points to an end position, it is not possible to get the pointer to the hashtable element.");
+
+            return &m_pHashtable->m_pSlots[m_uPosition];
+        }
+
+        /// <summary>
+        /// Post-increment operator that makes the iterator step forward after the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to increment an iterator that already points to the position after the last element (end position).<br/>
+        /// It is not possible to increment an invalid iterator.
+        /// </remarks>
+        /// <param name=".">[IN] Unused parameter.</param>
+        /// <returns>
+        /// A copy of the previous state of the iterator.
+        /// </returns>
+        QConstFlatHashtableIterator operator++(int)
+        {
+            QConstFlatHashtableIterator iteratorCopy = *this;
+            ++(*this);
+            return iteratorCopy;
+        }
+
+        /// <summary>
+        /// Post-decrement operator that makes the iterator step backward after the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to decrement an iterator that already points to the position before the first element (end position).<br/>
+        /// It is not possible to decrement an invalid iterator.
+        /// </remarks>
+        /// <param name=".">[IN] Unused parameter.</param>
+        /// <returns>
+        /// A copy of the previous state of the iterator.
+        /// </returns>
+        QConstFlatHashtableIterator operator--(int)
+        {
+            QConstFlatHashtableIterator iteratorCopy = *this;
+            --(*this);
+            return iteratorCopy;
+        }
+
+        /// <summary>
+        /// Pre-increment operator that makes the iterator step forward before the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to increment an iterator that already points to the position after the last element (end position).<br/>
+        /// It is not possible to increment an invalid iterator.
+        /// </remarks>
+        /// <returns>
+        /// A reference to the iterator.
+        /// </returns>
+        QConstFlatHashtableIterator& operator++()
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it cannot be incremented");
+            QE_ASSERT_WARNING(!this->IsEnd(EQIterationDirection::E_Forward), "The iterator points to an end position, it is not possible to increment it");
+
+            if(m_uPosition == QFlatHashtable::END_POSITION_BACKWARD)
+                m_uPosition = m_pHashtable->_FindNextFullSlot(0);
+            else if(m_uPosition != QFlatHashtable::END_POSITION_FORWARD)
+                m_uPosition = m_pHashtable->_FindNextFullSlot(m_uPosition + 1U);
+
+            return *this;
+        }
+
+        /// <summary>
+        /// Pre-decrement operator that makes the iterator step backward before the expression have been evaluated.
+        /// </summary>
+        /// <remarks>
+        /// It is not possible to decrement an iterator that already points to the position before the first element (end position).<br/>
+        /// It is not possible to decrement an invalid iterator.
+        /// </remarks>
+        /// <returns>
+        /// A reference to the iterator.
+        /// </returns>
+        QConstFlatHashtableIterator& operator--()
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid, it cannot be decremented");
+            QE_ASSERT_WARNING(!this->IsEnd(EQIterationDirection::E_Backward), "The iterator points to an end position, it is not possible to decrement it");
+
+            if(m_uPosition == QFlatHashtable::END_POSITION_FORWARD)
+                m_uPosition = m_pHashtable->_FindPreviousFullSlot(m_pHashtable->m_uNumberOfSlots);
+            else if(m_uPosition != QFlatHashtable::END_POSITION_BACKWARD)
+                m_uPosition = m_pHashtable->_FindPreviousFullSlot(m_uPosition);
+
+            return *this;
+        }
+
+        /// <summary>
+        /// Equality operator that checks if both iterators are the same.
+        /// </summary>
+        /// <remarks>
+        /// An iterator must point to the same position of the same hashtable to be considered equal.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if they are pointing to the same position of the same hashtable; False otherwise.
+        /// </returns>
+        bool operator==(const QConstFlatHashtableIterator &iterator) const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+            QE_ASSERT_ERROR(iterator.IsValid(), "The input iterator is not valid");
+            QE_ASSERT_ERROR(m_pHashtable == iterator.m_pHashtable, "Iterators point to different hashtables");
+
+            return m_uPosition == iterator.m_uPosition && m_pHashtable == iterator.m_pHashtable;
+        }
+
+        /// <summary>
+        /// Inequality operator that checks if both iterators are different.
+        /// </summary>
+        /// <remarks>
+        /// An iterator that points to a different position or to a different hashtable is considered distinct.
+        /// </remarks>
+        /// <param name="iterator">[IN] The other iterator to compare to.</param>
+        /// <returns>
+        /// True if they are pointing to the a different position or a different hashtable; False otherwise.
+        /// </returns>
+        bool operator!=(const QConstFlatHashtableIterator &iterator) const
+        {
+            return !this->operator==(iterator);
+        }
+
+        /// <summary>
+        /// Indicates whether the iterator is pointing to one of the ends of the hashtable.
+        /// </summary>
+        /// <remarks>
+        /// The position immediately before the first element and the position immediately after the last element are cosidered end
+        /// positions; therefore, this method can be used for both forward and backard iteration.<br/>
+        /// An invalid iterator is not considered as an end position.
+        /// </remarks>
+        /// <returns>
+        /// True if the iterator is pointing to an end position; False otherwise.
+        /// </returns>
+        bool IsEnd() const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+
+            return m_uPosition == QFlatHashtable::END_POSITION_BACKWARD || m_uPosition == QFlatHashtable::END_POSITION_FORWARD;
+        }
+
+        /// <summary>
+        /// Indicates whether the iterator is pointing to one of the ends of the hashtable, distinguishing which of them.
+        /// </summary>
+        /// <remarks>
+        /// The position immediately before the first element and the position immediately after the last element are cosidered end
+        /// positions; therefore, this method can be used for both forward and backard iteration.<br/>
+        /// An invalid iterator is not considered as an end position.
+        /// </remarks>
+        /// <param name="eIterationDirection">[IN] The iteration direction used to identify which of the end positions is checked.</param>
+        /// <returns>
+        /// True if the iterator is pointing to the position after the last element when iterating forward or if it is
+        /// pointing to the position immediately before the first position when iterating backward; False otherwise.
+        /// </returns>
+        bool IsEnd(const EQIterationDirection &eIterationDirection) const
+        {
+            QE_ASSERT_ERROR(this->IsValid(), "The iterator is not valid");
+
+            return (eIterationDirection == EQIterationDirection::E_Backward && m_uPosition == QFlatHashtable::END_POSITION_BACKWARD) ||
+                   (eIterationDirection == EQIterationDirection::E_Forward  && m_uPosition == QFlatHashtable::END_POSITION_FORWARD);
+        }
+
+        /// <summary>
+        /// Makes the iterator point to the first position.
+        /// </summary>
+        /// <remarks>
+        /// If the hashtable is empty, the iterator will point to the end position (forward iteration).
+        /// </remarks>
+        void MoveFirst()
+        {
+            m_uPosition = m_pHashtable->_FindNextFullSlot(0);
+        }
+
+        /// <summary>
+        /// Makes the iterator point to the last position.
+        /// </summary>
+        /// <remarks>
+        /// If the hashtable is empty, the iterator will point to the end position (forward iteration).
+        /// </remarks>
+        void MoveLast()
+        {
+            m_uPosition = m_pHashtable->_FindPreviousFullSlot(m_pHashtable->m_uNumberOfSlots);
+
+            if(m_uPosition == QFlatHashtable::END_POSITION_BACKWARD)
+                m_uPosition = QFlatHashtable::END_POSITION_FORWARD;
+        }
+
+        /// <summary>
+        /// Checks whether the iterator is valid or not.
+        /// </summary>
+        /// <remarks>
+        /// An iterator is considered invalid when it points to an unexisting position or to a slot that is not in use anymore. If the hashtable
+        /// to iterate has been destroyed, there is no way for the iterator to realize that so its behavior is undefined and this method will not
+        /// detect that situation.<br/>
+        /// The position before the first element or after the last one (end positions) are considered as valid positions.
+        /// </remarks>
+        /// <returns>
+        /// True if the iterator is valid; False otherwise.
+        /// </returns>
+        bool IsValid() const
+        {
+            return m_uPosition == QFlatHashtable::END_POSITION_BACKWARD ||
+                   m_uPosition == QFlatHashtable::END_POSITION_FORWARD ||
+                   (m_uPosition < m_pHashtable->m_uNumberOfSlots && m_pHashtable->_IsFull(m_uPosition));
+        }
+
+        /// <summary>
+        /// Gets the container that is being traversed by the iterator.
+        /// </summary>
+        /// <returns>
+        /// A pointer to the container. It never changes since the iterator is created.
+        /// </returns>
+        const QFlatHashtable* GetContainer() const
+        {
+            return m_pHashtable;
+        }
+
+        /// <summary>
+        /// Gets the "physical" position of the container's allocated buffer where the iterator is pointing to.
+        /// </summary>
+        /// <remarks>
+        /// This method is intended to be used internally by containers, users should not call it.
+        /// </remarks>
+        /// <returns>
+        /// The position the iterator points to.
+        /// </returns>
+        pointer_uint_q GetInternalPosition() const
+        {
+            return m_uPosition;
+        }
+
+
+        // ATTRIBUTES
+	    // ---------------
+    protected:
+
+        /// <summary>
+        /// The traversed hashtable.
+        /// </summary>
+        const QFlatHashtable* m_pHashtable;
+
+        /// <summary>
+        /// The current iteration position regarding the base position of the slot array (zero).
+        /// </summary>
+        pointer_uint_q m_uPosition;
+
+    }; // QConstFlatHashtableIterator
+
+
+    // TYPEDEFS (II)
+    // ---------------
+public:
+
+    typedef typename QFlatHashtable::QConstFlatHashtableIterator ConstIterator;
+
+
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// Constant to symbolize the end of the sequence near the last element.
+    /// </summary>
+    static const pointer_uint_q END_POSITION_FORWARD = -2;
+
+    /// <summary>
+    /// Constant to symbolize the end of the sequence near the first element.
+    /// </summary>
+    static const pointer_uint_q END_POSITION_BACKWARD = -1;
+
+    /// <summary>
+    /// The number of slots in a group, whose control bytes are compared at once.
+    /// </summary>
+    static const pointer_uint_q GROUP_SIZE = 16;
+
+    /// <summary>
+    /// The control byte of a slot that has never been used since the last rehash.
+    /// </summary>
+    static const u8_q CONTROL_EMPTY = 0x80;
+
+    /// <summary>
+    /// The control byte of a slot whose key-value pair was removed. Lookups must not stop at these slots.
+    /// </summary>
+    static const u8_q CONTROL_DELETED = 0xFE;
+
+    /// <summary>
+    /// The mask applied to a hash key to obtain the 7 bits stored in the control byte of a slot in use.
+    /// </summary>
+    static const u32_q CONTROL_HASH_MASK = 0x7F;
+
+    /// <summary>
+    /// The alignment of the control bytes, required to load a whole group at once.
+    /// </summary>
+    static const pointer_uint_q CONTROL_ALIGNMENT = 16;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the initial capacity.
+    /// </summary>
+    /// <remarks>
+    /// The number of slots is rounded up so it is a power of two multiple of 16 and the capacity is not exceeded until the maximum load is reached.
+    /// </remarks>
+    /// <param name="uInitialCapacity">[IN] The number of key-value pairs that can be added before the hashtable grows. It must be greater than zero.</param>
+    explicit QFlatHashtable(const pointer_uint_q uInitialCapacity) : m_pSlotAllocator(null_q),
+                                                                     m_pControlAllocator(null_q),
+                                                                     m_pSlots(null_q),
+                                                                     m_pControlBytes(null_q),
+                                                                     m_uNumberOfSlots(0),
+                                                                     m_uCount(0),
+                                                                     m_uGrowthLeft(0)
+    {
+        QE_ASSERT_ERROR(uInitialCapacity > 0, "The initial capacity must be greater than zero.");
+
+        this->_Allocate(QFlatHashtable::_CalculateNumberOfSlots(uInitialCapacity));
+    }
+
+    /// <summary>
+    /// Copy constructor that receives another instance and stores a copy of it.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor is called for every copied key and value, in an arbitrary order.<br/>
+    /// The number of slots of the resultant hashtable is equal to the input hashtable's.
+    /// </remarks>
+    /// <param name="hashtable">[IN] The other hashtable to be copied.</param>
+    QFlatHashtable(const QFlatHashtable &hashtable) : m_pSlotAllocator(null_q),
+                                                      m_pControlAllocator(null_q),
+                                                      m_pSlots(null_q),
+                                                      m_pControlBytes(null_q),
+                                                      m_uNumberOfSlots(0),
+                                                      m_uCount(0),
+                                                      m_uGrowthLeft(0)
+    {
+        this->_Allocate(hashtable.m_uNumberOfSlots);
+
+        // Every key-value pair is copied
+        for(QFlatHashtable::QConstFlatHashtableIterator it = hashtable.GetFirst(); !it.IsEnd(); ++it)
+            this->Add(it->GetKey(), it->GetValue());
+    }
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every key and value will be called in an undetermined order.
+    /// </remarks>
+    ~QFlatHashtable()
+    {
+        this->_DestroyAllSlots();
+        this->_Deallocate();
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Increases the capacity of the hashtable, reserving memory for more elements.
+    /// </summary>
+    /// <remarks>
+    /// It produces the rehash of every element.<br/>
+    /// This operation implies a reallocation, which means that any pointer to elements of this hashtable will be pointing to garbage.
+    /// </remarks>
+    /// <param name="uNumberOfElements">[IN] The number of key-value pairs for which to reserve memory. It should be greater than the
+    /// current capacity or nothing will happen.</param>
+    void Reserve(const pointer_uint_q uNumberOfElements)
+    {
+        if(uNumberOfElements > this->GetCapacity())
+            this->_Rehash(QFlatHashtable::_CalculateNumberOfSlots(uNumberOfElements));
+    }
+
+    /// <summary>
+    /// Adds a key and its associated value to the hashtable.
+    /// </summary>
+    /// <remarks>
+    /// This operation may imply a reallocation, which means that any pointer to elements of this hashtable will be pointing to garbage.<br/>
+    /// The copy constructor of both the new key and the new value will be called.
+    /// </remarks>
+    /// <param name="key">[IN] The new key. It must not exist in the hashtable yet.</param>
+    /// <param name="value">[IN] The new value associated to the new key.</param>
+    /// <returns>
+    /// An iterator that points to the just added key-value pair.
+    /// </returns>
+    QConstFlatHashtableIterator Add(const KeyT &key, const ValueT &value)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQAnyTypeToStringConverter;
+
+        QE_ASSERT_ERROR(!this->ContainsKey(key), string_q("The new key (") + SQAnyTypeToStringConverter::Convert(key) + ") already exists in the hashtable.");
+
+        const u32_q HASH_KEY = QFlatHashtable::_GenerateHashKey(key);
+        pointer_uint_q uPosition = this->_FindFreeSlot(HASH_KEY);
+
+        // When there are no empty slots left (deleted slots can be reused though), the hashtable grows or, if most of the unavailable slots
+        // were deleted, the slots are just rehashed
+        if(m_uGrowthLeft == 0 && m_pControlBytes[uPosition] == QFlatHashtable::CONTROL_EMPTY)
+        {
+            const pointer_uint_q NEW_NUMBER_OF_SLOTS = m_uCount * 2U >= QFlatHashtable::_CalculateMaxLoad(m_uNumberOfSlots) ?
+                                                                                                            m_uNumberOfSlots * 2U :
+                                                                                                            m_uNumberOfSlots;
+            this->_Rehash(NEW_NUMBER_OF_SLOTS);
+            uPosition = this->_FindFreeSlot(HASH_KEY);
+        }
+
+        if(m_pControlBytes[uPosition] == QFlatHashtable::CONTROL_EMPTY)
+            --m_uGrowthLeft;
+
+        m_pControlBytes[uPosition] = scast_q(HASH_KEY & QFlatHashtable::CONTROL_HASH_MASK, u8_q);
+        new(&m_pSlots[uPosition]) KeyValuePairType(key, value);
+        ++m_uCount;
+
+        return QFlatHashtable::QConstFlatHashtableIterator(this, uPosition);
+    }
+
+    /// <summary>
+    /// Array subscript operator that receives a key and retrieves its associated value.
+    /// </summary>
+    /// <param name="key">[IN] A key whose associated value will be obtained. It must exist in the hashtable.</param>
+    /// <returns>
+    /// A reference to the associated value.
+    /// </returns>
+    ValueT& operator[](const KeyT &key) const
+    {
+        return this->GetValue(key);
+    }
+
+    /// <summary>
+    /// Gets the value that corresponds to the given key.
+    /// </summary>
+    /// <param name="key">[IN] A key whose associated value will be obtained. It must exist in the hashtable.</param>
+    /// <returns>
+    /// A reference to the associated value.
+    /// </returns>
+    ValueT& GetValue(const KeyT& key) const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQAnyTypeToStringConverter;
+
+        const pointer_uint_q POSITION = this->_FindKey(key);
+
+        QE_ASSERT_ERROR(POSITION != QFlatHashtable::END_POSITION_FORWARD, string_q("The input key (") + SQAnyTypeToStringConverter::Convert(key) + ") does not exist in the hashtable.");
+
+        return m_pSlots[POSITION].GetValue();
+    }
+
+    /// <summary>
+    /// Sets the value that corresponds to the given key.
+    /// </summary>
+    /// <remarks>
+    /// It calls the assignment operator of the value.
+    /// </remarks>
+    /// <param name="key">[IN] A key whose associated value will be modified. It must exist in the hashtable.</param>
+    /// <param name="newValue">[IN] The value that will replace the existing one.</param>
+    void SetValue(const KeyT& key, const ValueT& newValue) const
+    {
+        this->GetValue(key) = newValue;
+    }
+
+    /// <summary>
+    /// Checks whether there is any key in the hashtable that is equal to other given key.
+    /// </summary>
+    /// <remarks>
+    /// Keys are compared to the provided key using the container's key comparator.<br/>
+    /// </remarks>
+    /// <param name="key">[IN] The key to search for.</param>
+    /// <returns>
+    /// True if the key is present in the hashtable; False otherwise.
+    /// </returns>
+    bool ContainsKey(const KeyT &key) const
+    {
+        return this->_FindKey(key) != QFlatHashtable::END_POSITION_FORWARD;
+    }
+
+    /// <summary>
+    /// Removes an key-value pair from the hashtable by its key.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of both the key and the value will be called.<br/>
+    /// Other key-value pairs are not moved, so iterators that point to them remain valid.
+    /// </remarks>
+    /// <param name="key">[IN] The key to search for. It must exist in the hashtable.</param>
+    void Remove(const KeyT &key)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQAnyTypeToStringConverter;
+
+        const pointer_uint_q POSITION = this->_FindKey(key);
+
+        QE_ASSERT_ERROR(POSITION != QFlatHashtable::END_POSITION_FORWARD, string_q("The input key (") + SQAnyTypeToStringConverter::Convert(key) + ") does not exist in the hashtable.");
+
+        m_pSlots[POSITION].~KeyValuePairType();
+        --m_uCount;
+
+        // If the group had an empty slot, no lookup has ever probed beyond it so the slot can be marked as empty too; otherwise,
+        // it must be marked as deleted so lookups continue probing the next groups
+        const pointer_uint_q GROUP_POSITION = POSITION & ~(QFlatHashtable::GROUP_SIZE - 1U);
+
+        if(QFlatHashtable::_MatchControlByte(&m_pControlBytes[GROUP_POSITION], QFlatHashtable::CONTROL_EMPTY) != 0)
+        {
+            m_pControlBytes[POSITION] = QFlatHashtable::CONTROL_EMPTY;
+            ++m_uGrowthLeft;
+        }
+        else
+        {
+            m_pControlBytes[POSITION] = QFlatHashtable::CONTROL_DELETED;
+        }
+    }
+
+    /// <summary>
+    /// Removes all the key-value pairs of the hashtable.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every key and value will be called in an undetermined order. The capacity does not change.
+    /// </remarks>
+    void Clear()
+    {
+        this->_DestroyAllSlots();
+        memset(m_pControlBytes, QFlatHashtable::CONTROL_EMPTY, m_uNumberOfSlots);
+        m_uCount = 0;
+        m_uGrowthLeft = QFlatHashtable::_CalculateMaxLoad(m_uNumberOfSlots);
+    }
+
+    /// <summary>
+    /// Gets the first element in the hashtable, which can be any of the existing elements since no defined order is followed.
+    /// </summary>
+    /// <returns>
+    /// An iterator that points to the first key-value pair. If the hashtable is empty, the iterator will point to the end position.
+    /// </returns>
+    QConstFlatHashtableIterator GetFirst() const
+    {
+        QFlatHashtable::QConstFlatHashtableIterator iterator(this, QFlatHashtable::END_POSITION_FORWARD);
+        iterator.MoveFirst();
+        return iterator;
+    }
+
+    /// <summary>
+    /// Gets the last element in the hashtable, which can be any of the existing elements since no defined order is followed.
+    /// </summary>
+    /// <returns>
+    /// An iterator that points to the last key-value pair. If the hashtable is empty, the iterator will point to the end position.
+    /// </returns>
+    QConstFlatHashtableIterator GetLast() const
+    {
+        QFlatHashtable::QConstFlatHashtableIterator iterator(this, QFlatHashtable::END_POSITION_FORWARD);
+        iterator.MoveLast();
+        return iterator;
+    }
+
+    /// <summary>
+    /// Searches for a given key-value pair and obtains its position.
+    /// </summary>
+    /// <param name="key">[IN] The key of the pair to search for.</param>
+    /// <returns>
+    /// An iterator that points to the position of the key-value pair. If the key is not present in the hashtable, the iterator will point to the end position.
+    /// </returns>
+    QConstFlatHashtableIterator PositionOfKey(const KeyT &key) const
+    {
+        return QFlatHashtable::QConstFlatHashtableIterator(this, this->_FindKey(key));
+    }
+
+    /// <summary>
+    /// Equality operator that checks whether two hashtables are equal.
+    /// </summary>
+    /// <remarks>
+    /// Keys and values are compared using the hashtable's key and value comparator, respectively.
+    /// The order in which key-value pairs were added is not relevant.
+    /// </remarks>
+    /// <param name="hashtable">[IN] The hashtable to compare to.</param>
+    /// <returns>
+    /// True if all the keys and values of both hashtables are equal; False otherwise.
+    /// </returns>
+    bool operator==(const QFlatHashtable &hashtable) const
+    {
+        bool bResult = m_uCount == hashtable.m_uCount;
+
+        if(bResult && this != &hashtable)
+        {
+            QFlatHashtable::QConstFlatHashtableIterator itThisKeyValuePair = this->GetFirst();
+
+            while(!itThisKeyValuePair.IsEnd() && bResult)
+            {
+                const pointer_uint_q FOUND_POSITION = hashtable._FindKey(itThisKeyValuePair->GetKey());
+
+                bResult = FOUND_POSITION != QFlatHashtable::END_POSITION_FORWARD &&
+                          ValueComparatorT::Compare(itThisKeyValuePair->GetValue(), hashtable.m_pSlots[FOUND_POSITION].GetValue()) == 0;
+                ++itThisKeyValuePair;
+            }
+        }
+
+        return bResult;
+    }
+
+    /// <summary>
+    /// Inequality operator that checks whether two hashtables are different.
+    /// </summary>
+    /// <remarks>
+    /// Keys and values are compared using the hashtable's key and value comparators, respectively.
+    /// The order in which key-value pairs were added is not relevant.
+    /// </remarks>
+    /// <param name="hashtable">[IN] The hashtable to compare to.</param>
+    /// <returns>
+    /// True if any of the keys or values are different; False otherwise.
+    /// </returns>
+    bool operator!=(const QFlatHashtable &hashtable) const
+    {
+        return !this->operator==(hashtable);
+    }
+
+    /// <summary>
+    /// Assignment operator that receives another instance and stores a copy of it.
+    /// </summary>
+    /// <remarks>
+    /// All the elements in the resident hashtable will be firstly removed, calling each keys's and value's destructor.
+    /// The copy constructor is then called for every copied key and value, in an arbitrary order.<br/>
+    /// If the capacity of the resident hashtable is lower than the input hashtable's, it will grow before the copy takes place.
+    /// </remarks>
+    /// <param name="hashtable">[IN] The other hashtable to be copied.</param>
+    /// <returns>
+    /// A reference to the resultant hashtable.
+    /// </returns>
+    QFlatHashtable& operator=(const QFlatHashtable &hashtable)
+    {
+        if(this != &hashtable)
+        {
+            this->Clear();
+            this->Reserve(hashtable.m_uCount);
+
+            // Every key-value pair is copied
+            for(QFlatHashtable::QConstFlatHashtableIterator it = hashtable.GetFirst(); !it.IsEnd(); ++it)
+                this->Add(it->GetKey(), it->GetValue());
+        }
+
+        return *this;
+    }
+
+private:
+
+    /// <summary>
+    /// Calculates the number of slots required to store a number of key-value pairs without exceeding the maximum load.
+    /// </summary>
+    /// <param name="uNumberOfElements">[IN] The number of key-value pairs.</param>
+    /// <returns>
+    /// A power of two greater than or equal to the size of a group.
+    /// </returns>
+    static pointer_uint_q _CalculateNumberOfSlots(const pointer_uint_q uNumberOfElements)
+    {
+        pointer_uint_q uNumberOfSlots = QFlatHashtable::GROUP_SIZE;
+
+        while(QFlatHashtable::_CalculateMaxLoad(uNumberOfSlots) < uNumberOfElements)
+            uNumberOfSlots *= 2U;
+
+        return uNumberOfSlots;
+    }
+
+    /// <summary>
+    /// Calculates the maximum number of slots that can be used (either full or deleted) before the hashtable has to be rehashed.
+    /// </summary>
+    /// <param name="uNumberOfSlots">[IN] The total number of slots.</param>
+    /// <returns>
+    /// The 7/8 of the number of slots.
+    /// </returns>
+    static pointer_uint_q _CalculateMaxLoad(const pointer_uint_q uNumberOfSlots)
+    {
+        return uNumberOfSlots - uNumberOfSlots / 8U;
+    }
+
+    /// <summary>
+    /// Generates the full hash key of a key.
+    /// </summary>
+    /// <remarks>
+    /// The result of the hash provider is mixed so the lower bits, used to choose the group, and the bits stored in the control bytes
+    /// depend on all the bits of the hash key. Otherwise, consecutive integers (which the integer hash provider does not alter) would fill
+    /// the groups sequentially.
+    /// </remarks>
+    /// <param name="key">[IN] The key.</param>
+    /// <returns>
+    /// The hash key.
+    /// </returns>
+    static u32_q _GenerateHashKey(const KeyT &key)
+    {
+        u32_q uHashKey = scast_q(HashProviderT::GenerateHashKey(key, scast_q(-1, pointer_uint_q)), u32_q);
+
+        // MurmurHash3's finalizer
+        uHashKey ^= uHashKey >> 16U;
+        uHashKey *= 0x85EBCA6BU;
+        uHashKey ^= uHashKey >> 13U;
+        uHashKey *= 0xC2B2AE35U;
+        uHashKey ^= uHashKey >> 16U;
+
+        return uHashKey;
+    }
+
+    /// <summary>
+    /// Compares the control bytes of a group to a value, all at once.
+    /// </summary>
+    /// <param name="pGroup">[IN] The first control byte of the group. It must be aligned to 16 bytes.</param>
+    /// <param name="uValue">[IN] The value to compare to.</param>
+    /// <returns>
+    /// A mask whose Nth bit is set if the Nth control byte of the group is equal to the value.
+    /// </returns>
+    static u32_q _MatchControlByte(const u8_q* pGroup, const u8_q uValue)
+    {
+        const __m128i GROUP = _mm_load_si128(rcast_q(pGroup, const __m128i*));
+        return scast_q(_mm_movemask_epi8(_mm_cmpeq_epi8(GROUP, _mm_set1_epi8(scast_q(uValue, char)))), u32_q);
+    }
+
+    /// <summary>
+    /// Finds the control bytes of a group that belong to slots not in use (either empty or deleted), all at once.
+    /// </summary>
+    /// <param name="pGroup">[IN] The first control byte of the group. It must be aligned to 16 bytes.</param>
+    /// <returns>
+    /// A mask whose Nth bit is set if the Nth slot of the group is not in use.
+    /// </returns>
+    static u32_q _MatchFreeSlots(const u8_q* pGroup)
+    {
+        // The most significant bit is only set for empty and deleted slots
+        const __m128i GROUP = _mm_load_si128(rcast_q(pGroup, const __m128i*));
+        return scast_q(_mm_movemask_epi8(GROUP), u32_q);
+    }
+
+    /// <summary>
+    /// Gets the index of the least significant bit that is set in a mask.
+    /// </summary>
+    /// <param name="uMask">[IN] The mask. It must not be zero.</param>
+    /// <returns>
+    /// The index of the bit.
+    /// </returns>
+    static pointer_uint_q _GetFirstSetBit(u32_q uMask)
+    {
+        pointer_uint_q uBit = 0;
+
+        while((uMask & 1U) == 0)
+        {
+            uMask >>= 1U;
+            ++uBit;
+        }
+
+        return uBit;
+    }
+
+    /// <summary>
+    /// Searches for the slot that contains a key.
+    /// </summary>
+    /// <param name="key">[IN] The key to search for.</param>
+    /// <returns>
+    /// The position of the slot. If the key is not present, it returns the end position (forward iteration).
+    /// </returns>
+    pointer_uint_q _FindKey(const KeyT &key) const
+    {
+        const u32_q HASH_KEY = QFlatHashtable::_GenerateHashKey(key);
+        const u8_q CONTROL_HASH = scast_q(HASH_KEY & QFlatHashtable::CONTROL_HASH_MASK, u8_q);
+        const pointer_uint_q NUMBER_OF_GROUPS = m_uNumberOfSlots / QFlatHashtable::GROUP_SIZE;
+        pointer_uint_q uGroup = (HASH_KEY >> 7U) & (NUMBER_OF_GROUPS - 1U);
+        pointer_uint_q uResult = QFlatHashtable::END_POSITION_FORWARD;
+        bool bStop = false;
+
+        for(pointer_uint_q uProbe = 1U; uProbe <= NUMBER_OF_GROUPS && !bStop; ++uProbe)
+        {
+            const u8_q* pGroup = &m_pControlBytes[uGroup * QFlatHashtable::GROUP_SIZE];
+            u32_q uCandidates = QFlatHashtable::_MatchControlByte(pGroup, CONTROL_HASH);
+
+            // Only slots whose control byte matches the hash key are compared
+            while(uCandidates != 0 && !bStop)
+            {
+                const pointer_uint_q POSITION = uGroup * QFlatHashtable::GROUP_SIZE + QFlatHashtable::_GetFirstSetBit(uCandidates);
+
+                if(KeyComparatorT::Compare(m_pSlots[POSITION].GetKey(), key) == 0)
+                {
+                    uResult = POSITION;
+                    bStop = true;
+                }
+
+                uCandidates &= uCandidates - 1U;
+            }
+
+            // A group with empty slots ends the probe sequence
+            bStop = bStop || QFlatHashtable::_MatchControlByte(pGroup, QFlatHashtable::CONTROL_EMPTY) != 0;
+
+            uGroup = (uGroup + uProbe) & (NUMBER_OF_GROUPS - 1U);
+        }
+
+        return uResult;
+    }
+
+    /// <summary>
+    /// Searches for the first slot not in use (either empty or deleted) in the probe sequence of a hash key.
+    /// </summary>
+    /// <remarks>
+    /// There must be at least one slot not in use.
+    /// </remarks>
+    /// <param name="uHashKey">[IN] The hash key.</param>
+    /// <returns>
+    /// The position of the slot.
+    /// </returns>
+    pointer_uint_q _FindFreeSlot(const u32_q uHashKey) const
+    {
+        const pointer_uint_q NUMBER_OF_GROUPS = m_uNumberOfSlots / QFlatHashtable::GROUP_SIZE;
+        pointer_uint_q uGroup = (uHashKey >> 7U) & (NUMBER_OF_GROUPS - 1U);
+        u32_q uFreeSlots = QFlatHashtable::_MatchFreeSlots(&m_pControlBytes[uGroup * QFlatHashtable::GROUP_SIZE]);
+
+        for(pointer_uint_q uProbe = 1U; uFreeSlots == 0; ++uProbe)
+        {
+            uGroup = (uGroup + uProbe) & (NUMBER_OF_GROUPS - 1U);
+            uFreeSlots = QFlatHashtable::_MatchFreeSlots(&m_pControlBytes[uGroup * QFlatHashtable::GROUP_SIZE]);
+        }
+
+        return uGroup * QFlatHashtable::GROUP_SIZE + QFlatHashtable::_GetFirstSetBit(uFreeSlots);
+    }
+
+    /// <summary>
+    /// Searches for the first slot in use, starting from a given position.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of the first slot to check.</param>
+    /// <returns>
+    /// The position of the slot. If there are no more slots in use, it returns the end position (forward iteration).
+    /// </returns>
+    pointer_uint_q _FindNextFullSlot(pointer_uint_q uPosition) const
+    {
+        while(uPosition < m_uNumberOfSlots && !this->_IsFull(uPosition))
+            ++uPosition;
+
+        return uPosition < m_uNumberOfSlots ? uPosition : QFlatHashtable::END_POSITION_FORWARD;
+    }
+
+    /// <summary>
+    /// Searches for the last slot in use before a given position.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position after the first slot to check.</param>
+    /// <returns>
+    /// The position of the slot. If there are no more slots in use, it returns the end position (backward iteration).
+    /// </returns>
+    pointer_uint_q _FindPreviousFullSlot(pointer_uint_q uPosition) const
+    {
+        while(uPosition > 0 && !this->_IsFull(uPosition - 1U))
+            --uPosition;
+
+        return uPosition > 0 ? uPosition - 1U : QFlatHashtable::END_POSITION_BACKWARD;
+    }
+
+    /// <summary>
+    /// Indicates whether a slot is in use.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of the slot. It must be lower than the number of slots.</param>
+    /// <returns>
+    /// True if the slot stores a key-value pair; False otherwise.
+    /// </returns>
+    bool _IsFull(const pointer_uint_q uPosition) const
+    {
+        return (m_pControlBytes[uPosition] & 0x80U) == 0;
+    }
+
+    /// <summary>
+    /// Reserves memory for the slots and their control bytes, which are all marked as empty.
+    /// </summary>
+    /// <remarks>
+    /// Previous memory, if any, is not released.
+    /// </remarks>
+    /// <param name="uNumberOfSlots">[IN] The number of slots. It must be a power of two greater than or equal to the size of a group.</param>
+    void _Allocate(const pointer_uint_q uNumberOfSlots)
+    {
+        m_pSlotAllocator = new AllocatorT(uNumberOfSlots * sizeof(KeyValuePairType), uNumberOfSlots * sizeof(KeyValuePairType), QAlignment(alignof_q(KeyValuePairType)));
+        m_pControlAllocator = new AllocatorT(uNumberOfSlots, uNumberOfSlots, QAlignment(QFlatHashtable::CONTROL_ALIGNMENT));
+        m_pSlots = scast_q(m_pSlotAllocator->Allocate(), KeyValuePairType*);
+        m_pControlBytes = scast_q(m_pControlAllocator->Allocate(), u8_q*);
+        memset(m_pControlBytes, QFlatHashtable::CONTROL_EMPTY, uNumberOfSlots);
+        m_uNumberOfSlots = uNumberOfSlots;
+        m_uGrowthLeft = QFlatHashtable::_CalculateMaxLoad(uNumberOfSlots);
+    }
+
+    /// <summary>
+    /// Releases the memory of the slots and their control bytes.
+    /// </summary>
+    /// <remarks>
+    /// No destructors are called.
+    /// </remarks>
+    void _Deallocate()
+    {
+        delete m_pSlotAllocator;
+        delete m_pControlAllocator;
+        m_pSlotAllocator = null_q;
+        m_pControlAllocator = null_q;
+        m_pSlots = null_q;
+        m_pControlBytes = null_q;
+    }
+
+    /// <summary>
+    /// Calls the destructor of every key-value pair in the hashtable.
+    /// </summary>
+    void _DestroyAllSlots()
+    {
+        for(pointer_uint_q uPosition = 0; uPosition < m_uNumberOfSlots; ++uPosition)
+        {
+            if(this->_IsFull(uPosition))
+                m_pSlots[uPosition].~KeyValuePairType();
+        }
+    }
+
+    /// <summary>
+    /// Reallocates the slots and moves every key-value pair to its position in the new slot array.
+    /// </summary>
+    /// <remarks>
+    /// Deleted slots are discarded. Key-value pairs are moved by copying their bytes, no constructors, destructors nor assignment operators are called.
+    /// </remarks>
+    /// <param name="uNumberOfSlots">[IN] The new number of slots. It must be a power of two greater than or equal to the size of a group and
+    /// there must be enough slots to store all the key-value pairs.</param>
+    void _Rehash(const pointer_uint_q uNumberOfSlots)
+    {
+        AllocatorT* pOldSlotAllocator = m_pSlotAllocator;
+        AllocatorT* pOldControlAllocator = m_pControlAllocator;
+        const KeyValuePairType* pOldSlots = m_pSlots;
+        const u8_q* pOldControlBytes = m_pControlBytes;
+        const pointer_uint_q OLD_NUMBER_OF_SLOTS = m_uNumberOfSlots;
+
+        this->_Allocate(uNumberOfSlots);
+
+        for(pointer_uint_q uOldPosition = 0; uOldPosition < OLD_NUMBER_OF_SLOTS; ++uOldPosition)
+        {
+            if((pOldControlBytes[uOldPosition] & 0x80U) == 0)
+            {
+                const u32_q HASH_KEY = QFlatHashtable::_GenerateHashKey(pOldSlots[uOldPosition].GetKey());
+                const pointer_uint_q NEW_POSITION = this->_FindFreeSlot(HASH_KEY);
+
+                m_pControlBytes[NEW_POSITION] = pOldControlBytes[uOldPosition];
+                memcpy(&m_pSlots[NEW_POSITION], &pOldSlots[uOldPosition], sizeof(KeyValuePairType));
+            }
+        }
+
+        m_uGrowthLeft -= m_uCount;
+
+        delete pOldSlotAllocator;
+        delete pOldControlAllocator;
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Returns the number of key-value pairs that can be stored in the hashtable without a reallocation.
+    /// </summary>
+    /// <remarks>
+    /// Removed key-value pairs may keep their slots occupied until the next reallocation, so in some cases fewer elements can be added.
+    /// </remarks>
+    /// <returns>
+    /// The number of key-value pairs that can be stored in the hashtable without a reallocation.
+    /// </returns>
+    pointer_uint_q GetCapacity() const
+    {
+        return QFlatHashtable::_CalculateMaxLoad(m_uNumberOfSlots);
+    }
+
+    /// <summary>
+    /// Gets the allocator of keys and values.
+    /// </summary>
+    /// <returns>
+    /// The key-value allocator.
+    /// </returns>
+    const AllocatorT* GetAllocator() const
+    {
+        return m_pSlotAllocator;
+    }
+
+    /// <summary>
+    /// Gets the total number of slots in the hashtable, either in use or not.
+    /// </summary>
+    /// <returns>
+    /// The number of slots.
+    /// </returns>
+    pointer_uint_q GetNumberOfSlots() const
+    {
+        return m_uNumberOfSlots;
+    }
+
+    /// <summary>
+    /// Gets the load factor of the hashtable, this is, the proportion of slots in use.
+    /// </summary>
+    /// <returns>
+    /// The number of elements divided by the number of slots.
+    /// </returns>
+    float GetLoadFactor() const
+    {
+        return scast_q(m_uCount, float) / scast_q(m_uNumberOfSlots, float);
+    }
+
+    /// <summary>
+    /// Gets the number of elements added to the hashtable.
+    /// </summary>
+    /// <returns>
+    /// The number of elements in the hashtable.
+    /// </returns>
+    pointer_uint_q GetCount() const
+    {
+        return m_uCount;
+    }
+
+    /// <summary>
+    /// Indicates whether the hashtable is empty or not.
+    /// </summary>
+    /// <returns>
+    /// True if the hashtable is empty; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_uCount == 0;
+    }
+
+    /// <summary>
+    /// Gets all the existing keys from the hashtable.
+    /// </summary>
+    /// <returns>
+    /// An array of keys, in an undefined order. If the hashtable is empty, a null pointer is returned. The wrapper is attached to the array.
+    /// </returns>
+    Kinesis::QuimeraEngine::Common::DataTypes::QArrayResult<KeyT> GetKeys() const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::QArrayResult;
+
+        KeyT* arKeys = null_q;
+
+        // If the hashtable is empty, a null pointer will be returned
+        if(m_uCount > 0)
+            arKeys = new KeyT[m_uCount];
+
+        pointer_uint_q uKey = 0;
+
+        for(pointer_uint_q uPosition = 0; uPosition < m_uNumberOfSlots; ++uPosition)
+        {
+            if(this->_IsFull(uPosition))
+            {
+                new(&arKeys[uKey]) KeyT(m_pSlots[uPosition].GetKey());
+                ++uKey;
+            }
+        }
+
+        return QArrayResult<KeyT>(arKeys, uKey);
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The allocator of the slot array.
+    /// </summary>
+    AllocatorT* m_pSlotAllocator;
+
+    /// <summary>
+    /// The allocator of the control bytes.
+    /// </summary>
+    AllocatorT* m_pControlAllocator;
+
+    /// <summary>
+    /// The slot array. Only slots whose control byte indicates they are in use store a key-value pair.
+    /// </summary>
+    KeyValuePairType* m_pSlots;
+
+    /// <summary>
+    /// The control bytes, one per slot. It is aligned to 16 bytes so every group can be loaded at once.
+    /// </summary>
+    u8_q* m_pControlBytes;
+
+    /// <summary>
+    /// The total number of slots. It is always a power of two greater than or equal to the size of a group.
+    /// </summary>
+    pointer_uint_q m_uNumberOfSlots;
+
+    /// <summary>
+    /// The number of key-value pairs stored in the hashtable.
+    /// </summary>
+    pointer_uint_q m_uCount;
+
+    /// <summary>
+    /// The number of empty slots that can be used before the maximum load is exceeded.
+    /// </summary>
+    pointer_uint_q m_uGrowthLeft;
+
+};
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QFLATHASHTABLE__
@@ -38,6 +38,7 @@
 #include "QPoolAllocator.h"
 #include "SQAnyTypeToStringConverter.h"
 #include "QArrayResult.h"
+#include "QContainerStatistics.h"
 
 
 namespace Kinesis
@@ -56,6 +57,9 @@ namespace Containers
 /// Currently, the hash table is implemented following the separate-chaining model (a.k.a. closed addressing or open hashing). An array is filled with buckets which point to slots 
 /// (colliding elements) stored as key-value pairs into a single shared double-linked list; this allows every bucket to grow indefinitely. The array of buckets can grow too 
 /// although it implies rehashing everything.<br/>
+/// When the load factor (the number of elements divided by the number of buckets) exceeds the maximum load factor, the array of buckets grows and the existing slots are rehashed 
+/// incrementally, a few buckets every time an element is added or removed, so the cost is amortized instead of paid at once. Slots are never copied during a rehash, only 
+/// relinked in the slot list.<br/>
 /// Hash tables use a hash function or hash provider to compute an internal index that determines the position of a new key-value pair. Such provider depends on the key's data type.<br/>
 /// Keys and values are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
 /// If SQComparatorDefault is used as key comparator, keys will be forced to implement operators "==" and "<".
@@ -577,6 +581,13 @@ protected:
 
     // CONSTANTS
     // ---------------
+public:
+
+    /// <summary>
+    /// The maximum load factor used when it is not specified. It must be greater than zero.
+    /// </summary>
+    static const float DEFAULT_MAX_LOAD_FACTOR;
+
 protected:
 
     /// <summary>
@@ -589,6 +600,11 @@ protected:
     /// </summary>
     static const pointer_uint_q END_POSITION_BACKWARD = -1;
 
+    /// <summary>
+    /// The number of buckets of the previous bucket array that are rehashed every time an element is added or removed while a rehash is in progress.
+    /// </summary>
+    static const pointer_uint_q REHASHED_BUCKETS_PER_OPERATION = 4;
+
 
     // CONSTRUCTORS
     // ---------------
@@ -600,7 +616,9 @@ public:
     /// <param name="uNumberOfBuckets">[IN] The number of buckets in the table. The higher it is, the less collisions occurs. It must be greater than zero.</param>
     /// <param name="uSlotsPerBucket">[IN] The number of expected slots per bucket. The higher it is, the more capacity the table has initially. It must be greater than zero.</param>
     QHashtable(const pointer_uint_q uNumberOfBuckets, const pointer_uint_q uSlotsPerBucket) : m_arBuckets(uNumberOfBuckets),
-                                                                                              m_slots(uNumberOfBuckets * uSlotsPerBucket)
+                                                                                              m_slots(uNumberOfBuckets * uSlotsPerBucket),
+                                                                                              m_uRehashedBuckets(0),
+                                                                                              m_fMaxLoadFactor(QHashtable::DEFAULT_MAX_LOAD_FACTOR)
     {
         QE_ASSERT_ERROR(uNumberOfBuckets > 0, "The number of buckets must be greater than zero.");
         QE_ASSERT_ERROR(uSlotsPerBucket > 0, "The number of slots per bucket must be greater than zero.");
@@ -617,11 +635,14 @@ public:
     /// </summary>
     /// <remarks>
     /// The copy constructor is called for every copied key and value, in an arbitrary order.<br/>
-    /// The capacity of the resultant hashtable is equal to the amount of elements in the input hashtable. If it is empty, then the capacity of the input hashtable is used instead.
+    /// The capacity of the resultant hashtable is equal to the amount of elements in the input hashtable. If it is empty, then the capacity of the input hashtable is used instead.<br/>
+    /// The maximum load factor is copied too.
     /// </remarks>
     /// <param name="hashtable">[IN] The other hashtable to be copied.</param>
     QHashtable(const QHashtable &hashtable) : m_arBuckets(hashtable.m_arBuckets.GetCount()),
-                                              m_slots(hashtable.m_slots.GetCount() == 0 ? hashtable.GetCapacity() : hashtable.m_slots.GetCount())
+                                              m_slots(hashtable.m_slots.GetCount() == 0 ? hashtable.GetCapacity() : hashtable.m_slots.GetCount()),
+                                              m_uRehashedBuckets(0),
+                                              m_fMaxLoadFactor(hashtable.m_fMaxLoadFactor)
     {
         static const QHashtable::QBucket DEFAULT_BUCKET;
 
@@ -668,12 +689,50 @@ public:
         m_slots.Reserve(uNumberOfElements);
     }
 
+    /// <summary>
+    /// Reduces the capacity of the hashtable so it is equal to the number of key-value pairs, releasing the memory that is not used.
+    /// </summary>
+    /// <remarks>
+    /// If there is a rehash in progress, it is completed first. The number of buckets does not change; use Rehash to reduce it.<br/>
+    /// If the hashtable is empty, the capacity will be 1.<br/>
+    /// The slots are moved so they occupy consecutive positions in memory, which implies a reallocation; any pointer or iterator to elements 
+    /// of this hashtable will be pointing to garbage.
+    /// </remarks>
+    void ShrinkToFit()
+    {
+        this->_CompleteRehash();
+        m_arOldBuckets.ShrinkToFit();
+
+        // The slot list is compacted in the order it is traversed, so the new position of every slot is its index in the sequence
+        pointer_uint_q* arNewPositions = new pointer_uint_q[m_slots.GetCapacity()];
+        pointer_uint_q uIndex = 0;
+
+        for(typename SlotListType::Iterator slot = m_slots.GetFirst(); !slot.IsEnd(); ++slot, ++uIndex)
+            arNewPositions[slot.GetInternalPosition()] = uIndex;
+
+        m_slots.ShrinkToFit();
+
+        for(pointer_uint_q uBucket = 0; uBucket < m_arBuckets.GetCount(); ++uBucket)
+        {
+            QHashtable::QBucket& bucket = m_arBuckets[uBucket];
+
+            if(bucket.GetSlotCount() > 0)
+                bucket.SetSlotPosition(arNewPositions[bucket.GetSlotPosition()]);
+        }
+
+        delete[] arNewPositions;
+
+        m_arBuckets.ShrinkToFit();
+    }
+
     /// <summary>
     /// Adds a key and its associated value to the hashtable.
     /// </summary>
     /// <remarks>
     /// This operation may imply a reallocation, which means that any pointer to elements of this hashtable will be pointing to garbage.<br/>
-    /// The copy constructor of both the new key and the new value will be called.
+    /// The copy constructor of both the new key and the new value will be called.<br/>
+    /// If the maximum load factor is exceeded, the number of buckets will grow and a rehash will start. Existing slots are rehashed progressively in this and 
+    /// subsequent additions and removals.
     /// </remarks>
     /// <param name="key">[IN] The new key. It must not exist in the hashtable yet.</param>
     /// <param name="value">[IN] The new value associated to the new key.</param>
@@ -686,9 +745,10 @@ public:
 
         QE_ASSERT_ERROR(!this->ContainsKey(key), string_q("The new key (") + SQAnyTypeToStringConverter::Convert(key) + ") already exists in the hashtable.");
 
+        this->_RehashStep();
+
         // Gets the corresponding bucket
-        pointer_uint_q uHashKey = HashProviderT::GenerateHashKey(key, m_arBuckets.GetCount());
-        QHashtable::QBucket& bucket = m_arBuckets[uHashKey];
+        QHashtable::QBucket& bucket = this->_GetBucket(key);
         
         // Creates a key-value by copying the data without calling any constructor
         u8_q pKeyValueBlock[sizeof(KeyValuePairType)];
@@ -715,6 +775,15 @@ public:
         bucket.SetSlotPosition(uFirstSlotPosition);
         bucket.SetSlotCount(bucket.GetSlotCount() + 1U);
 
+        // The array of buckets grows when there are too many slots per bucket
+        if(scast_q(m_slots.GetCount(), float) > m_fMaxLoadFactor * scast_q(m_arBuckets.GetCount(), float))
+        {
+            // A rehash in progress must be completed before starting another
+            this->_CompleteRehash();
+            this->_BeginRehash(m_arBuckets.GetCount() * 2U + 1U);
+            this->_RehashStep();
+        }
+
         return QHashtable::QConstHashtableIterator(this, uFirstSlotPosition);
     }
     
@@ -742,8 +811,7 @@ public:
         using Kinesis::QuimeraEngine::Common::DataTypes::SQAnyTypeToStringConverter;
 
         // Gets the corresponding bucket
-        pointer_uint_q uHashKey = HashProviderT::GenerateHashKey(key, m_arBuckets.GetCount());
-        QHashtable::QBucket& bucket = m_arBuckets[uHashKey];
+        const QHashtable::QBucket& bucket = this->_GetBucket(key);
 
         QE_ASSERT_ERROR(bucket.GetSlotCount() > 0, string_q("The input key (") + SQAnyTypeToStringConverter::Convert(key) + ") does not exist in the hashtable.");
 
@@ -774,6 +842,40 @@ public:
     {
         this->GetValue(key) = newValue;
     }
+
+    /// <summary>
+    /// Sets the value that corresponds to the given key, if the key exists.
+    /// </summary>
+    /// <remarks>
+    /// It calls the assignment operator of the value. The key is searched for only once.
+    /// </remarks>
+    /// <param name="key">[IN] A key whose associated value will be modified.</param>
+    /// <param name="newValue">[IN] The value that will replace the existing one.</param>
+    /// <returns>
+    /// True if the key exists and its value has been replaced; False otherwise.
+    /// </returns>
+    bool TrySetValue(const KeyT& key, const ValueT& newValue)
+    {
+        // Gets the corresponding bucket
+        const QHashtable::QBucket& bucket = this->_GetBucket(key);
+
+        typename SlotListType::Iterator slot(&m_slots, bucket.GetSlotPosition());
+        pointer_uint_q uSlot = 0;
+
+        // Traverses all the slots of the bucket
+        while(uSlot < bucket.GetSlotCount() && KeyComparatorT::Compare(slot->GetKey(), key) != 0)
+        {
+            ++slot;
+            ++uSlot;
+        }
+
+        const bool KEY_EXISTS = uSlot != bucket.GetSlotCount();
+
+        if(KEY_EXISTS)
+            slot->SetValue(newValue);
+
+        return KEY_EXISTS;
+    }
     
     /// <summary>
     /// Checks whether there is any key in the hashtable that is equal to other given key.
@@ -788,8 +890,7 @@ public:
     bool ContainsKey(const KeyT &key) const
     {
         // Gets the corresponding bucket
-        pointer_uint_q uHashKey = HashProviderT::GenerateHashKey(key, m_arBuckets.GetCount());
-        QHashtable::QBucket& bucket = m_arBuckets[uHashKey];
+        const QHashtable::QBucket& bucket = this->_GetBucket(key);
 
         typename SlotListType::Iterator slot(&m_slots, bucket.GetSlotPosition());
         pointer_uint_q uSlot = 0;
@@ -808,18 +909,36 @@ public:
     /// Removes an key-value pair from the hashtable by its key.
     /// </summary>
     /// <remarks>
-    /// The destructor of both the key and the value will be called.
+    /// The destructor of both the key and the value will be called.<br/>
+    /// If a rehash is in progress, some buckets will be rehashed too.
     /// </remarks>
     /// <param name="key">[IN] The key to search for. It must exist in the hashtable.</param>
     void Remove(const KeyT &key)
     {
         using Kinesis::QuimeraEngine::Common::DataTypes::SQAnyTypeToStringConverter;
 
-        // Gets the corresponding bucket
-        pointer_uint_q uHashKey = HashProviderT::GenerateHashKey(key, m_arBuckets.GetCount());
-        QHashtable::QBucket& bucket = m_arBuckets[uHashKey];
+        QE_ASSERT_ERROR(this->ContainsKey(key), string_q("The input key (") + SQAnyTypeToStringConverter::Convert(key) + ") does not exist in the hashtable.");
 
-        QE_ASSERT_ERROR(bucket.GetSlotCount() > 0, string_q("The input key (") + SQAnyTypeToStringConverter::Convert(key) + ") does not exist in the hashtable.");
+        this->TryRemove(key);
+    }
+
+    /// <summary>
+    /// Removes an key-value pair from the hashtable by its key, if the key exists.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of both the key and the value will be called. The key is searched for only once.<br/>
+    /// If a rehash is in progress, some buckets will be rehashed too.
+    /// </remarks>
+    /// <param name="key">[IN] The key to search for.</param>
+    /// <returns>
+    /// True if the key existed and has been removed; False otherwise.
+    /// </returns>
+    bool TryRemove(const KeyT &key)
+    {
+        this->_RehashStep();
+
+        // Gets the corresponding bucket
+        QHashtable::QBucket& bucket = this->_GetBucket(key);
 
         typename SlotListType::Iterator slot(&m_slots, bucket.GetSlotPosition());
         pointer_uint_q uSlot = 0;
@@ -829,16 +948,28 @@ public:
             ++slot;
             ++uSlot;
         }
-        
-        QE_ASSERT_ERROR(uSlot < bucket.GetSlotCount(), string_q("The input key (") + SQAnyTypeToStringConverter::Convert(key) + ") does not exist in the hashtable.");
 
-        // Updates the bucket
-        bucket.SetSlotCount(bucket.GetSlotCount() - 1U);
+        const bool KEY_EXISTS = uSlot != bucket.GetSlotCount();
 
-        if(bucket.GetSlotCount() == 0)
-            bucket.SetSlotPosition(QHashtable::END_POSITION_FORWARD);
+        if(KEY_EXISTS)
+        {
+            // Updates the bucket
+            bucket.SetSlotCount(bucket.GetSlotCount() - 1U);
 
-        m_slots.Remove(slot);
+            if(bucket.GetSlotCount() == 0)
+                bucket.SetSlotPosition(QHashtable::END_POSITION_FORWARD);
+            else if(uSlot == 0)
+            {
+                // The next slot becomes the first one of the bucket
+                typename SlotListType::Iterator nextSlot = slot;
+                ++nextSlot;
+                bucket.SetSlotPosition(nextSlot.GetInternalPosition());
+            }
+
+            m_slots.Remove(slot);
+        }
+
+        return KEY_EXISTS;
     }
 
     /// <summary>
@@ -877,8 +1008,7 @@ public:
     QConstHashtableIterator PositionOfKey(const KeyT &key) const
     {
         // Gets the corresponding bucket
-        pointer_uint_q uHashKey = HashProviderT::GenerateHashKey(key, m_arBuckets.GetCount());
-        QHashtable::QBucket& bucket = m_arBuckets[uHashKey];
+        const QHashtable::QBucket& bucket = this->_GetBucket(key);
 
         typename SlotListType::Iterator slot(&m_slots, bucket.GetSlotPosition());
         pointer_uint_q uSlot = 0;
@@ -951,7 +1081,8 @@ public:
     /// </summary>
     /// <remarks>
     /// All the elements in the resident hashtable will be firstly removed, calling each keys's and value's destructor.
-    /// The copy constructor is then called for every copied key and value, in an arbitrary order.
+    /// The copy constructor is then called for every copied key and value, in an arbitrary order.<br/>
+    /// The maximum load factor is copied too.
     /// </remarks>
     /// <param name="hashtable">[IN] The other hashtable to be copied.</param>
     /// <returns>
@@ -968,6 +1099,9 @@ public:
             m_slots.Reserve(hashtable.m_slots.GetCapacity()); // Thund: Using GetCount instead could save some memory?
             m_arBuckets.Clear();
             m_arBuckets.Reserve(hashtable.m_arBuckets.GetCapacity());
+            m_arOldBuckets.Clear();
+            m_uRehashedBuckets = 0;
+            m_fMaxLoadFactor = hashtable.m_fMaxLoadFactor;
 
             // The array of buckets is pre-allocated and initialized
             for(pointer_uint_q uIndex = 0; uIndex < hashtable.m_arBuckets.GetCount(); ++uIndex)
@@ -994,6 +1128,183 @@ public:
     {
         m_slots.Clone(destinationHashtable.m_slots);
         m_arBuckets.Clone(destinationHashtable.m_arBuckets);
+        m_arOldBuckets.Clone(destinationHashtable.m_arOldBuckets);
+        destinationHashtable.m_uRehashedBuckets = m_uRehashedBuckets;
+        destinationHashtable.m_fMaxLoadFactor = m_fMaxLoadFactor;
+    }
+
+    /// <summary>
+    /// Changes the number of buckets of the hashtable and redistributes all the existing key-value pairs among them.
+    /// </summary>
+    /// <remarks>
+    /// Unlike the rehash triggered when the maximum load factor is exceeded, this operation is not performed progressively; every slot is rehashed 
+    /// before the method returns. If there was a rehash in progress, it is completed first.<br/>
+    /// No constructors, destructors nor assignment operators are called during this operation, slots are just relinked. Existing iterators remain valid.<br/>
+    /// If the resultant load factor is greater than the maximum load factor, the number of buckets will grow again in the next addition.
+    /// </remarks>
+    /// <param name="uNumberOfBuckets">[IN] The new number of buckets. It must be greater than zero.</param>
+    void Rehash(const pointer_uint_q uNumberOfBuckets)
+    {
+        QE_ASSERT_ERROR(uNumberOfBuckets > 0, "The number of buckets must be greater than zero.");
+
+        this->_CompleteRehash();
+
+        if(uNumberOfBuckets != m_arBuckets.GetCount())
+        {
+            this->_BeginRehash(uNumberOfBuckets);
+            this->_CompleteRehash();
+        }
+    }
+
+    /// <summary>
+    /// Gets information about the memory usage and the distribution of the key-value pairs of the hashtable.
+    /// </summary>
+    /// <remarks>
+    /// The reserved and used bytes include the array of buckets, the previous array of buckets (if there is a rehash in progress) and the slot list.<br/>
+    /// The length of every chain is the number of slots in a bucket. This operation visits every bucket.
+    /// </remarks>
+    /// <returns>
+    /// The number of key-value pairs, the capacity, the bytes reserved and used, the load factor and the maximum chain length.
+    /// </returns>
+    QContainerStatistics GetStatistics() const
+    {
+        const QContainerStatistics BUCKETS_STATISTICS = m_arBuckets.GetStatistics();
+        const QContainerStatistics OLD_BUCKETS_STATISTICS = m_arOldBuckets.GetStatistics();
+        const QContainerStatistics SLOTS_STATISTICS = m_slots.GetStatistics();
+
+        pointer_uint_q uMaximumChainLength = 0;
+
+        for(pointer_uint_q uBucket = 0; uBucket < m_arBuckets.GetCount(); ++uBucket)
+            if(m_arBuckets[uBucket].GetSlotCount() > uMaximumChainLength)
+                uMaximumChainLength = m_arBuckets[uBucket].GetSlotCount();
+
+        for(pointer_uint_q uBucket = m_uRehashedBuckets; uBucket < m_arOldBuckets.GetCount(); ++uBucket)
+            if(m_arOldBuckets[uBucket].GetSlotCount() > uMaximumChainLength)
+                uMaximumChainLength = m_arOldBuckets[uBucket].GetSlotCount();
+
+        QContainerStatistics statistics;
+        statistics.SetCount(this->GetCount());
+        statistics.SetCapacity(this->GetCapacity());
+        statistics.SetReservedBytes(BUCKETS_STATISTICS.GetReservedBytes() + OLD_BUCKETS_STATISTICS.GetReservedBytes() + SLOTS_STATISTICS.GetReservedBytes());
+        statistics.SetUsedBytes(BUCKETS_STATISTICS.GetUsedBytes() + OLD_BUCKETS_STATISTICS.GetUsedBytes() + SLOTS_STATISTICS.GetUsedBytes());
+        statistics.SetLoadFactor(scast_q(this->GetLoadFactor(), float_q));
+        statistics.SetMaximumChainLength(uMaximumChainLength);
+
+        return statistics;
+    }
+
+private:
+
+    /// <summary>
+    /// Gets the bucket a key belongs to.
+    /// </summary>
+    /// <remarks>
+    /// While a rehash is in progress, keys whose bucket in the previous array of buckets has not been rehashed yet still belong to that bucket.
+    /// </remarks>
+    /// <param name="key">[IN] A key.</param>
+    /// <returns>
+    /// A reference to the bucket where the key is stored or where it should be added.
+    /// </returns>
+    QBucket& _GetBucket(const KeyT &key) const
+    {
+        if(!m_arOldBuckets.IsEmpty())
+        {
+            pointer_uint_q uOldHashKey = HashProviderT::GenerateHashKey(key, m_arOldBuckets.GetCount());
+
+            if(uOldHashKey >= m_uRehashedBuckets)
+                return m_arOldBuckets[uOldHashKey];
+        }
+
+        pointer_uint_q uHashKey = HashProviderT::GenerateHashKey(key, m_arBuckets.GetCount());
+        return m_arBuckets[uHashKey];
+    }
+
+    /// <summary>
+    /// Replaces the array of buckets with a new one and keeps the current one until all its slots are rehashed.
+    /// </summary>
+    /// <remarks>
+    /// There must not be any rehash in progress.
+    /// </remarks>
+    /// <param name="uNumberOfBuckets">[IN] The number of buckets of the new array. It must be greater than zero.</param>
+    void _BeginRehash(const pointer_uint_q uNumberOfBuckets)
+    {
+        static const QHashtable::QBucket DEFAULT_BUCKET;
+
+        QE_ASSERT_ERROR(m_arOldBuckets.IsEmpty(), "There is a rehash in progress already.");
+
+        m_arBuckets.Clone(m_arOldBuckets);
+        m_uRehashedBuckets = 0;
+
+        m_arBuckets.Clear();
+        m_arBuckets.Reserve(uNumberOfBuckets);
+
+        for(pointer_uint_q uIndex = 0; uIndex < uNumberOfBuckets; ++uIndex)
+            m_arBuckets.Add(DEFAULT_BUCKET);
+    }
+
+    /// <summary>
+    /// Rehashes a few buckets of the previous array of buckets, if there is a rehash in progress.
+    /// </summary>
+    void _RehashStep()
+    {
+        for(pointer_uint_q uStep = 0; uStep < QHashtable::REHASHED_BUCKETS_PER_OPERATION && !m_arOldBuckets.IsEmpty(); ++uStep)
+            this->_RehashNextBucket();
+    }
+
+    /// <summary>
+    /// Rehashes all the remaining buckets of the previous array of buckets, if there is a rehash in progress.
+    /// </summary>
+    void _CompleteRehash()
+    {
+        while(!m_arOldBuckets.IsEmpty())
+            this->_RehashNextBucket();
+    }
+
+    /// <summary>
+    /// Moves every slot of the next bucket to be rehashed to its bucket in the new array of buckets.
+    /// </summary>
+    /// <remarks>
+    /// Slots of a bucket must be contiguous in the slot list. A slot whose new bucket is still empty stays where it is; otherwise, it is relinked 
+    /// before the first slot of its new bucket. Either way, slots of the same bucket are kept contiguous and the remaining slots of the old bucket 
+    /// are not separated.<br/>
+    /// When the last bucket has been rehashed, the previous array of buckets is emptied.
+    /// </remarks>
+    void _RehashNextBucket()
+    {
+        static const QHashtable::QBucket DEFAULT_BUCKET;
+
+        QHashtable::QBucket& oldBucket = m_arOldBuckets[m_uRehashedBuckets];
+        typename SlotListType::Iterator slot(&m_slots, oldBucket.GetSlotPosition());
+        const pointer_uint_q SLOT_COUNT = oldBucket.GetSlotCount();
+
+        for(pointer_uint_q uSlot = 0; uSlot < SLOT_COUNT; ++uSlot)
+        {
+            // The next slot has to be obtained before relinking the current one
+            typename SlotListType::Iterator nextSlot = slot;
+
+            if(uSlot + 1U < SLOT_COUNT)
+                ++nextSlot;
+
+            pointer_uint_q uHashKey = HashProviderT::GenerateHashKey(slot->GetKey(), m_arBuckets.GetCount());
+            QHashtable::QBucket& newBucket = m_arBuckets[uHashKey];
+
+            if(newBucket.GetSlotCount() > 0)
+                m_slots.Move(slot, typename SlotListType::Iterator(&m_slots, newBucket.GetSlotPosition()));
+
+            newBucket.SetSlotPosition(slot.GetInternalPosition());
+            newBucket.SetSlotCount(newBucket.GetSlotCount() + 1U);
+
+            slot = nextSlot;
+        }
+
+        oldBucket = DEFAULT_BUCKET;
+        ++m_uRehashedBuckets;
+
+        if(m_uRehashedBuckets == m_arOldBuckets.GetCount())
+        {
+            m_arOldBuckets.Clear();
+            m_uRehashedBuckets = 0;
+        }
     }
    
 
@@ -1023,6 +1334,67 @@ public:
         return m_slots.GetAllocator();
     }
 
+    /// <summary>
+    /// Gets the number of buckets in the hashtable.
+    /// </summary>
+    /// <remarks>
+    /// If there is a rehash in progress, it returns the number of buckets the slots are being rehashed to.
+    /// </remarks>
+    /// <returns>
+    /// The number of buckets.
+    /// </returns>
+    pointer_uint_q GetNumberOfBuckets() const
+    {
+        return m_arBuckets.GetCount();
+    }
+
+    /// <summary>
+    /// Gets the load factor of the hashtable, this is, the average number of slots per bucket.
+    /// </summary>
+    /// <returns>
+    /// The number of elements divided by the number of buckets.
+    /// </returns>
+    float GetLoadFactor() const
+    {
+        return scast_q(m_slots.GetCount(), float) / scast_q(m_arBuckets.GetCount(), float);
+    }
+
+    /// <summary>
+    /// Gets the maximum load factor allowed before the number of buckets grows.
+    /// </summary>
+    /// <returns>
+    /// The maximum load factor.
+    /// </returns>
+    float GetMaxLoadFactor() const
+    {
+        return m_fMaxLoadFactor;
+    }
+
+    /// <summary>
+    /// Sets the maximum load factor allowed before the number of buckets grows.
+    /// </summary>
+    /// <remarks>
+    /// Lower values reduce collisions at the expense of memory. The new value is not checked until the next addition.
+    /// </remarks>
+    /// <param name="fMaxLoadFactor">[IN] The maximum load factor. It must be greater than zero.</param>
+    void SetMaxLoadFactor(const float fMaxLoadFactor)
+    {
+        QE_ASSERT_ERROR(fMaxLoadFactor > 0.0f, "The maximum load factor must be greater than zero.");
+
+        m_fMaxLoadFactor = fMaxLoadFactor;
+    }
+
+    /// <summary>
+    /// Indicates whether the slots are being rehashed progressively.
+    /// </summary>
+    /// <returns>
+    /// True if there is a rehash in progress; False otherwise.
+    /// </returns>
+    bool IsRehashing() const
+    {
+        return !m_arOldBuckets.IsEmpty();
+    }
+
     /// <summary>
     /// Gets the number of elements added to the hashtable.
     /// </summary>
@@ -1085,8 +1457,29 @@ protected:
     /// </summary>
     SlotListType m_slots;
 
+    /// <summary>
+    /// The previous array of buckets while a rehash is in progress. It is empty otherwise.
+    /// </summary>
+    BucketsArrayType m_arOldBuckets;
+
+    /// <summary>
+    /// The number of buckets of the previous array of buckets that have already been rehashed.
+    /// </summary>
+    pointer_uint_q m_uRehashedBuckets;
+
+    /// <summary>
+    /// The maximum load factor allowed before the number of buckets grows.
+    /// </summary>
+    float m_fMaxLoadFactor;
+
 };
 
+
+// ATTRIBUTE INITIALIZATION
+// ----------------------------
+template<class KeyT, class ValueT, class HashProviderT, class AllocatorT, class KeyComparatorT, class ValueComparatorT>
+const float QHashtable<KeyT, ValueT, HashProviderT, AllocatorT, KeyComparatorT, ValueComparatorT>::DEFAULT_MAX_LOAD_FACTOR = 1.0f;
+
 } //namespace Containers
 } //namespace Tools
 } //namespace QuimeraEngine
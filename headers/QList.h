@@ -34,7 +34,11 @@
 #include "QAlignment.h"
 #include "SQComparatorDefault.h"
 #include "AllocationOperators.h"
+#include "SQTypeTraits.h"
 #include "EQIterationDirection.h"
+#include "QContainerStatistics.h"
+#include "QContainerImageHeader.h"
+#include "SQGeometricGrowthPolicy.h"
 
 
 using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
@@ -59,19 +63,10 @@ namespace Containers
 /// <typeparam name="T"> The type of the list elements.</typeparam>
 /// <typeparam name="AllocatorT"> The allocator used to reserve memory. The default type is QPoolAllocator.</typeparam>
 /// <typeparam name="ComparatorT"> The comparator. The default type is SQComparatorDefault.</typeparam>
-template <class T, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, class ComparatorT = SQComparatorDefault<T> >
+/// <typeparam name="GrowthPolicyT"> The policy that calculates the new capacity when it is exceeded. The default type is SQGeometricGrowthPolicy.</typeparam>
+template <class T, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, class ComparatorT = SQComparatorDefault<T>, class GrowthPolicyT = SQGeometricGrowthPolicy>
 class QList
 {
-    // CONSTANTS
-    // ---------------
-private:
-
-    /// <summary>
-    /// The reallocation factor to be applied to calculate the new capacity on every reallocation. It must be greater than or equal to 1.
-    /// </summary>
-    static float REALLOCATION_FACTOR;
-
-
     // INTERNAL CLASSES
     // -----------------
 
@@ -1033,12 +1028,16 @@ public:
             m_uFirst = list.m_uFirst;
             m_uLast = list.m_uLast;
 
-            QList::QListIterator iteratorOrigin = list.GetFirst();
-            QList::QListIterator iteratorDestination = this->GetFirst();
-
-            for(; !iteratorOrigin.IsEnd(); ++iteratorOrigin, ++iteratorDestination)
+            // The bytes of the elements have already been copied, which is enough for trivially copyable types
+            if(!SQTypeTraits<T>::IS_TRIVIALLY_COPYABLE)
             {
-                new(&(*iteratorDestination)) T(*iteratorOrigin);
+                QList::QListIterator iteratorOrigin = list.GetFirst();
+                QList::QListIterator iteratorDestination = this->GetFirst();
+
+                for(; !iteratorOrigin.IsEnd(); ++iteratorOrigin, ++iteratorDestination)
+                {
+                    new(&(*iteratorDestination)) T(*iteratorOrigin);
+                }
             }
         }
     }
@@ -1085,7 +1084,7 @@ public:
     /// </remarks>
     ~QList()
     {
-        if(!this->IsEmpty())
+        if(!this->IsEmpty() && !SQTypeTraits<T>::IS_TRIVIALLY_DESTRUCTIBLE)
         {
             // Iterates the list in an orderly manner, calling the destructor for each element.
             for(QList::QListIterator it = this->GetFirst(); !it.IsEnd(); ++it)
@@ -1386,43 +1385,172 @@ public:
     }
 
     /// <summary>
-    /// Copies an element to the end of the list.
+    /// Moves the elements so they occupy consecutive positions in memory, in the same order they are traversed, and releases 
+    /// the capacity that is not used.
     /// </summary>
     /// <remarks>
-    /// If the capacity of the list is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
-    /// The copy constructor of the element will be called.
+    /// After many insertions and removals, traversing the list may imply jumping to distant memory addresses. Once compacted, 
+    /// the first element of the list is stored at the beginning of the buffer and every element is followed by the next one in the list.<br/>
+    /// This operation implies a reallocation, which means that any pointer or iterator to elements of this list will be pointing to garbage.<br/>
+    /// Elements are moved bitwise; no assignment operator nor copy constructors are called during this operation. The capacity 
+    /// will be equal to the number of elements, or 1 if the list is empty.
     /// </remarks>
-    /// <param name="newElement">[IN] The element to be copied.</param>
-    void Add(const T &newElement)
+    /// <returns>
+    /// The number of bytes released, taking into account both the elements and the internal links.
+    /// </returns>
+    pointer_uint_q Compact()
     {
-        if(this->GetCount() == this->GetCapacity())
-            this->_ReallocateByFactor(this->GetCapacity() + 1U);
-        
-        pointer_uint_q uNewLinkPrevious = m_uLast;
+        const pointer_uint_q COUNT = this->GetCount();
+        const pointer_uint_q ORIGINAL_POOL_SIZE = m_elementAllocator.GetPoolSize() + m_linkAllocator.GetPoolSize();
 
-        if(this->IsEmpty())
+        if(COUNT > 0)
         {
-            // If the list is empty, there is no previous link
-            uNewLinkPrevious = QList::END_POSITION_BACKWARD;
-        }
+            // Copies the elements to a temporary buffer in the same order they are traversed and then moves them back to the beginning
+            u8_q* arElements = new u8_q[COUNT * sizeof(T)];
+            pointer_uint_q uIndex = 0;
 
-        // Creates the new link
-        QList::QLink* pNewLastLink = new(m_linkAllocator.Allocate()) QList::QLink(uNewLinkPrevious, QList::END_POSITION_FORWARD);
+            for(pointer_uint_q uCurrent = m_uFirst; uCurrent != QList::END_POSITION_FORWARD; uCurrent = (m_pLinkBasePointer + uCurrent)->GetNext())
+            {
+                memcpy(arElements + uIndex * sizeof(T), m_pElementBasePointer + uCurrent, sizeof(T));
+                ++uIndex;
+            }
 
-        if(uNewLinkPrevious != QList::END_POSITION_BACKWARD)
-        {
-            // Makes the last link point to the new link
-            QList::QLink* pLastLink = m_pLinkBasePointer + m_uLast;
-            pLastLink->SetNext(pNewLastLink - m_pLinkBasePointer);
-            m_uLast = pNewLastLink - m_pLinkBasePointer;
+            // Elements are relocated bitwise on purpose, even if they are not trivially copyable, the cast just states so
+            memcpy(scast_q(m_pElementBasePointer, void*), arElements, COUNT * sizeof(T));
+            delete[] arElements;
+
+            // Every link points to the adjacent positions
+            for(uIndex = 0; uIndex < COUNT; ++uIndex)
+            {
+                new(m_pLinkBasePointer + uIndex) QList::QLink(uIndex == 0          ? QList::END_POSITION_BACKWARD : uIndex - 1U, 
+                                                              uIndex == COUNT - 1U ? QList::END_POSITION_FORWARD  : uIndex + 1U);
+            }
+
+            m_uFirst = 0;
+            m_uLast = COUNT - 1U;
+
+            // The allocators must consider the first blocks as occupied, and the rest as free
+            m_elementAllocator.Clear();
+            m_linkAllocator.Clear();
+
+            for(uIndex = 0; uIndex < COUNT; ++uIndex)
+            {
+                m_elementAllocator.Allocate();
+                m_linkAllocator.Allocate();
+            }
         }
-        else
+
+        const pointer_uint_q FINAL_CAPACITY = COUNT > 0 ? COUNT : 1U;
+
+        if(FINAL_CAPACITY < this->GetCapacity())
         {
-            m_uFirst = m_uLast = 0;
+            m_elementAllocator.Shrink(FINAL_CAPACITY * sizeof(T));
+            m_linkAllocator.Shrink(FINAL_CAPACITY * sizeof(QList::QLink));
+            m_pElementBasePointer = scast_q(m_elementAllocator.GetPointer(), T*);
+            m_pLinkBasePointer = scast_q(m_linkAllocator.GetPointer(), QList::QLink*);
         }
 
-        // Copies the new element
-        new(m_elementAllocator.Allocate()) T(newElement);
+        return ORIGINAL_POOL_SIZE - m_elementAllocator.GetPoolSize() - m_linkAllocator.GetPoolSize();
+    }
+
+    /// <summary>
+    /// Reduces the capacity of the list so it is equal to the number of elements, releasing the memory that is not used.
+    /// </summary>
+    /// <remarks>
+    /// If the list is empty, the capacity will be 1.<br/>
+    /// Since the unused blocks may be interleaved with the elements, the list is compacted (see Compact), which implies a reallocation 
+    /// that makes any pointer or iterator to elements of this list point to garbage.
+    /// </remarks>
+    void ShrinkToFit()
+    {
+        this->Compact();
+    }
+
+    /// <summary>
+    /// Copies an element to the end of the list.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the list is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The copy constructor of the element will be called.
+    /// </remarks>
+    /// <param name="newElement">[IN] The element to be copied.</param>
+    void Add(const T &newElement)
+    {
+        new(this->_AllocateLast()) T(newElement);
+    }
+    
+    /// <summary>
+    /// Constructs a new element at the end of the list, calling its default constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the list is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called.
+    /// </remarks>
+    void Emplace()
+    {
+        new(this->_AllocateLast()) T();
+    }
+    
+    /// <summary>
+    /// Constructs a new element at the end of the list, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the list is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called.
+    /// </remarks>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    template<class Argument1T>
+    void Emplace(const Argument1T &argument1)
+    {
+        new(this->_AllocateLast()) T(argument1);
+    }
+    
+    /// <summary>
+    /// Constructs a new element at the end of the list, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the list is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called.
+    /// </remarks>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    /// <param name="argument2">[IN] The second argument to pass to the constructor of the element.</param>
+    template<class Argument1T, class Argument2T>
+    void Emplace(const Argument1T &argument1, const Argument2T &argument2)
+    {
+        new(this->_AllocateLast()) T(argument1, argument2);
+    }
+    
+    /// <summary>
+    /// Constructs a new element at the end of the list, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the list is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called.
+    /// </remarks>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    /// <param name="argument2">[IN] The second argument to pass to the constructor of the element.</param>
+    /// <param name="argument3">[IN] The third argument to pass to the constructor of the element.</param>
+    template<class Argument1T, class Argument2T, class Argument3T>
+    void Emplace(const Argument1T &argument1, const Argument2T &argument2, const Argument3T &argument3)
+    {
+        new(this->_AllocateLast()) T(argument1, argument2, argument3);
+    }
+    
+    /// <summary>
+    /// Constructs a new element at the end of the list, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the list is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called.
+    /// </remarks>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    /// <param name="argument2">[IN] The second argument to pass to the constructor of the element.</param>
+    /// <param name="argument3">[IN] The third argument to pass to the constructor of the element.</param>
+    /// <param name="argument4">[IN] The fourth argument to pass to the constructor of the element.</param>
+    template<class Argument1T, class Argument2T, class Argument3T, class Argument4T>
+    void Emplace(const Argument1T &argument1, const Argument2T &argument2, const Argument3T &argument3, const Argument4T &argument4)
+    {
+        new(this->_AllocateLast()) T(argument1, argument2, argument3, argument4);
     }
     
     /// <summary>
@@ -1446,7 +1574,7 @@ public:
         QE_ASSERT_WARNING(!this->IsEmpty() && !position.IsEnd(), "The input iterator is out of bounds");
 
         if(this->GetCount() == this->GetCapacity())
-            this->_ReallocateByFactor(this->GetCapacity() + 1U);
+            this->_ReallocateByPolicy(this->GetCapacity() + 1U);
 
         // Gets the position of the iterator
         pointer_uint_q uIndex = &(*position) - m_pElementBasePointer;
@@ -1535,7 +1663,7 @@ public:
         QE_ASSERT_WARNING(!this->IsEmpty() && uIndex < this->GetCount(), "The input iterator is out of bounds");
         
         if(this->GetCount() == this->GetCapacity())
-            this->_ReallocateByFactor(this->GetCapacity() + 1U);
+            this->_ReallocateByPolicy(this->GetCapacity() + 1U);
 
         pointer_uint_q uNewLinkNext = 0;
         pointer_uint_q uNewLinkPrevious = 0;
@@ -1746,8 +1874,11 @@ public:
         if(!this->IsEmpty())
         {
             // Calls every destructor, from first to last
-            for(QList::QListIterator it = this->GetFirst(); !it.IsEnd(); ++it)
-                (*it).~T();
+            if(!SQTypeTraits<T>::IS_TRIVIALLY_DESTRUCTIBLE)
+            {
+                for(QList::QListIterator it = this->GetFirst(); !it.IsEnd(); ++it)
+                    (*it).~T();
+            }
 
             m_uFirst = QList::END_POSITION_BACKWARD;
             m_uLast = QList::END_POSITION_FORWARD;
@@ -1873,7 +2004,173 @@ public:
         memcpy(pElementA, pElementB, sizeof(T));
         memcpy(pElementB, arBytes,   sizeof(T));
     }
-    
+
+    /// <summary>
+    /// Moves an element of the list to another position, just before a given element.
+    /// </summary>
+    /// <remarks>
+    /// Only the links between elements are modified; the element keeps its physical position so iterators that point to it remain valid.<br/>
+    /// No assignment operator nor copy constructors are called during this operation.
+    /// </remarks>
+    /// <param name="element">[IN] The position of the element to move. It must not be an end position.</param>
+    /// <param name="position">[IN] The position of the element before which the moved element will be placed. If it is an end position,
+    /// the element will be moved to the end of the list. It must point to the same list; otherwise, the behavior is undefined.</param>
+    void Move(const typename QList::QConstListIterator &element, const typename QList::QConstListIterator &position)
+    {
+        QE_ASSERT_ERROR(element.IsValid(), "The input element iterator is not valid.");
+        QE_ASSERT_ERROR(position.IsValid(), "The input position iterator is not valid.");
+        QE_ASSERT_ERROR(!element.IsEnd(), "The input element iterator must not point to an end position.");
+
+        const pointer_uint_q ELEMENT_POSITION = element.GetInternalPosition();
+        const pointer_uint_q TARGET_POSITION = position.IsEnd() ? QList::END_POSITION_FORWARD : position.GetInternalPosition();
+        QList::QLink* pMovedLink = m_pLinkBasePointer + ELEMENT_POSITION;
+
+        // Nothing changes if the element is already placed before the target position
+        if(ELEMENT_POSITION != TARGET_POSITION && pMovedLink->GetNext() != TARGET_POSITION)
+        {
+            // Unlinks the element
+            const pointer_uint_q OLD_NEXT = pMovedLink->GetNext();
+            const pointer_uint_q OLD_PREVIOUS = pMovedLink->GetPrevious();
+
+            if(OLD_NEXT != QList::END_POSITION_FORWARD)
+                (m_pLinkBasePointer + OLD_NEXT)->SetPrevious(OLD_PREVIOUS);
+            else
+                m_uLast = OLD_PREVIOUS;
+
+            if(OLD_PREVIOUS != QList::END_POSITION_BACKWARD)
+                (m_pLinkBasePointer + OLD_PREVIOUS)->SetNext(OLD_NEXT);
+            else
+                m_uFirst = OLD_NEXT;
+
+            // Links the element before the target position
+            pointer_uint_q uNewPrevious = QList::END_POSITION_BACKWARD;
+
+            if(TARGET_POSITION == QList::END_POSITION_FORWARD)
+            {
+                uNewPrevious = m_uLast;
+                m_uLast = ELEMENT_POSITION;
+            }
+            else
+            {
+                QList::QLink* pNextLink = m_pLinkBasePointer + TARGET_POSITION;
+                uNewPrevious = pNextLink->GetPrevious();
+                pNextLink->SetPrevious(ELEMENT_POSITION);
+            }
+
+            if(uNewPrevious != QList::END_POSITION_BACKWARD)
+                (m_pLinkBasePointer + uNewPrevious)->SetNext(ELEMENT_POSITION);
+            else
+                m_uFirst = ELEMENT_POSITION;
+
+            pMovedLink->SetPrevious(uNewPrevious);
+            pMovedLink->SetNext(TARGET_POSITION);
+        }
+    }
+
+    /// <summary>
+    /// Sorts the elements of the list in ascending order, keeping the relative order of equal elements.
+    /// </summary>
+    /// <remarks>
+    /// Lists are always sorted using the merge sort algorithm, so this method behaves exactly like StableSort.
+    /// It exists so lists and arrays can be sorted the same way.
+    /// </remarks>
+    void Sort()
+    {
+        this->StableSort();
+    }
+
+    /// <summary>
+    /// Sorts the elements of the list in ascending order, using the merge sort algorithm, keeping the relative order of equal elements.
+    /// </summary>
+    /// <remarks>
+    /// Elements are compared using the list's comparator.<br/>
+    /// Only the links between elements are modified; elements keep their physical position so iterators that point to them remain valid, 
+    /// although the order in which they are traversed changes. No additional memory is required.<br/>
+    /// No assignment operator nor copy constructors are called during this operation.
+    /// </remarks>
+    void StableSort()
+    {
+        if(this->GetCount() > 1U)
+        {
+            pointer_uint_q uHead = m_uFirst;
+            pointer_uint_q uRunLength = 1U;
+            pointer_uint_q uNumberOfMerges = 0;
+
+            // Every pass merges every pair of consecutive runs, whose length is doubled every time, until there is only one run
+            do
+            {
+                pointer_uint_q uLeft = uHead;
+                pointer_uint_q uTail = QList::END_POSITION_FORWARD;
+                uHead = QList::END_POSITION_FORWARD;
+                uNumberOfMerges = 0;
+
+                while(uLeft != QList::END_POSITION_FORWARD)
+                {
+                    ++uNumberOfMerges;
+
+                    // Finds the beginning of the right run
+                    pointer_uint_q uRight = uLeft;
+                    pointer_uint_q uLeftLength = 0;
+
+                    while(uLeftLength < uRunLength && uRight != QList::END_POSITION_FORWARD)
+                    {
+                        ++uLeftLength;
+                        uRight = (m_pLinkBasePointer + uRight)->GetNext();
+                    }
+
+                    pointer_uint_q uRightLength = uRunLength;
+
+                    // Merges both runs, appending the elements to the tail of the sorted sequence
+                    while(uLeftLength > 0 || (uRightLength > 0 && uRight != QList::END_POSITION_FORWARD))
+                    {
+                        pointer_uint_q uNext = QList::END_POSITION_FORWARD;
+
+                        if(uLeftLength > 0 &&
+                           (uRightLength == 0 || uRight == QList::END_POSITION_FORWARD || 
+                            !(ComparatorT::Compare(*(m_pElementBasePointer + uRight), *(m_pElementBasePointer + uLeft)) < 0)))
+                        {
+                            // Equal elements are taken from the left run first, so the sort is stable
+                            uNext = uLeft;
+                            uLeft = (m_pLinkBasePointer + uLeft)->GetNext();
+                            --uLeftLength;
+                        }
+                        else
+                        {
+                            uNext = uRight;
+                            uRight = (m_pLinkBasePointer + uRight)->GetNext();
+                            --uRightLength;
+                        }
+
+                        if(uTail == QList::END_POSITION_FORWARD)
+                            uHead = uNext;
+                        else
+                            (m_pLinkBasePointer + uTail)->SetNext(uNext);
+
+                        uTail = uNext;
+                    }
+
+                    uLeft = uRight;
+                }
+
+                (m_pLinkBasePointer + uTail)->SetNext(QList::END_POSITION_FORWARD);
+                uRunLength *= 2U;
+
+            } while(uNumberOfMerges > 1U);
+
+            // Only the next links were updated while merging, previous links are restored now
+            pointer_uint_q uPrevious = QList::END_POSITION_BACKWARD;
+
+            for(pointer_uint_q uCurrent = uHead; uCurrent != QList::END_POSITION_FORWARD; uCurrent = (m_pLinkBasePointer + uCurrent)->GetNext())
+            {
+                (m_pLinkBasePointer + uCurrent)->SetPrevious(uPrevious);
+                uPrevious = uCurrent;
+            }
+
+            m_uFirst = uHead;
+            m_uLast = uPrevious;
+        }
+    }
+
     /// <summary>
     /// Checks if any of the elements in the list is equal to a given one.
     /// </summary>
@@ -2163,19 +2460,112 @@ public:
 
         this->Remove(it);
     }
+
+    /// <summary>
+    /// Gets information about the memory usage of the list.
+    /// </summary>
+    /// <returns>
+    /// The number of elements, the capacity and the bytes reserved and used by both the element allocator and the link allocator. The shape properties are zero.
+    /// </returns>
+    QContainerStatistics GetStatistics() const
+    {
+        QContainerStatistics statistics;
+        statistics.SetCount(this->GetCount());
+        statistics.SetCapacity(this->GetCapacity());
+        statistics.SetReservedBytes(m_elementAllocator.GetPoolSize() + m_linkAllocator.GetPoolSize());
+        statistics.SetUsedBytes(m_elementAllocator.GetAllocatedBytes() + m_linkAllocator.GetAllocatedBytes());
+
+        return statistics;
+    }
+
+    /// <summary>
+    /// Writes a flat binary image of the list, which can be read without deserializing the elements by QArrayImageView.
+    /// </summary>
+    /// <remarks>
+    /// The image is composed of a QContainerImageHeader followed by the bytes of the elements, in the order they are traversed from the 
+    /// first to the last, so the links are not needed.<br/>
+    /// Only lists whose elements are trivially copyable (see SQTypeTraits) can be written. The list is not modified.
+    /// </remarks>
+    /// <typeparam name="BinaryStreamWriterT">The type of the writer, normally QBinaryStreamWriter. It must provide the methods Write and WriteBytes.</typeparam>
+    /// <param name="writer">[IN/OUT] The writer that receives the image.</param>
+    template<class BinaryStreamWriterT>
+    void WriteImage(BinaryStreamWriterT &writer) const
+    {
+        QE_ASSERT_ERROR(SQTypeTraits<T>::IS_TRIVIALLY_COPYABLE, "Only lists whose elements are trivially copyable can be written as images.");
+
+        const pointer_uint_q COUNT = this->GetCount();
+
+        writer.Write(QContainerImageHeader(QContainerImageHeader::CONTAINER_TYPE_ARRAY, sizeof(T), COUNT, QContainerImageHeader::NULL_POSITION));
+
+        if(COUNT > 0)
+        {
+            // Elements are gathered in the same order they are traversed so they are written at once
+            u8_q* arElements = new u8_q[COUNT * sizeof(T)];
+            pointer_uint_q uIndex = 0;
+
+            for(pointer_uint_q uCurrent = m_uFirst; uCurrent != QList::END_POSITION_FORWARD; uCurrent = (m_pLinkBasePointer + uCurrent)->GetNext())
+            {
+                memcpy(arElements + uIndex * sizeof(T), m_pElementBasePointer + uCurrent, sizeof(T));
+                ++uIndex;
+            }
+
+            writer.WriteBytes(arElements, COUNT * sizeof(T));
+            delete[] arElements;
+        }
+    }
     
     
 private:
 
     /// <summary>
-    /// Increases the capacity of the list, reserving memory for more elements than necessary, depending on the reallocation factor.
+    /// Links a new element at the end of the list and reserves its space, without constructing it.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the list is exceeded, a reallocation will take place.
+    /// </remarks>
+    /// <returns>
+    /// The address where the new element must be constructed.
+    /// </returns>
+    void* _AllocateLast()
+    {
+        if(this->GetCount() == this->GetCapacity())
+            this->_ReallocateByPolicy(this->GetCapacity() + 1U);
+        
+        pointer_uint_q uNewLinkPrevious = m_uLast;
+
+        if(this->IsEmpty())
+        {
+            // If the list is empty, there is no previous link
+            uNewLinkPrevious = QList::END_POSITION_BACKWARD;
+        }
+
+        // Creates the new link
+        QList::QLink* pNewLastLink = new(m_linkAllocator.Allocate()) QList::QLink(uNewLinkPrevious, QList::END_POSITION_FORWARD);
+
+        if(uNewLinkPrevious != QList::END_POSITION_BACKWARD)
+        {
+            // Makes the last link point to the new link
+            QList::QLink* pLastLink = m_pLinkBasePointer + m_uLast;
+            pLastLink->SetNext(pNewLastLink - m_pLinkBasePointer);
+            m_uLast = pNewLastLink - m_pLinkBasePointer;
+        }
+        else
+        {
+            // Once elements have been removed, the pool does not necessarily return the first position
+            m_uFirst = m_uLast = pNewLastLink - m_pLinkBasePointer;
+        }
+
+        return m_elementAllocator.Allocate();
+    }
+
+    /// <summary>
+    /// Increases the capacity of the list, reserving memory for more elements than necessary, depending on the growth policy.
     /// </summary>
     /// <param name="uNumberOfElements">[IN] The number of elements for which to reserve memory. It should be greater than the
     /// current capacity or nothing will happen.</param>
-    void _ReallocateByFactor(const pointer_uint_q uNumberOfElements)
+    void _ReallocateByPolicy(const pointer_uint_q uNumberOfElements)
     {
-        const pointer_uint_q FINAL_CAPACITY = scast_q(scast_q(uNumberOfElements, float) * QList::REALLOCATION_FACTOR, pointer_uint_q);
-        this->Reserve(FINAL_CAPACITY);
+        this->Reserve(GrowthPolicyT::GetNewCapacity(uNumberOfElements));
     }
 
 
@@ -2267,11 +2657,8 @@ protected:
 
 // ATTRIBUTE INITIALIZATION
 // ----------------------------
-template<class T, class AllocatorT, class ComparatorT>
-float QList<T, AllocatorT, ComparatorT>::REALLOCATION_FACTOR = 1.5f;
-
-template<class T, class AllocatorT, class ComparatorT>
-const pointer_uint_q QList<T, AllocatorT, ComparatorT>::END_POSITION_FORWARD = -2;
+template<class T, class AllocatorT, class ComparatorT, class GrowthPolicyT>
+const pointer_uint_q QList<T, AllocatorT, ComparatorT, GrowthPolicyT>::END_POSITION_FORWARD = -2;
 
 } //namespace Containers
 } //namespace Tools
@@ -0,0 +1,362 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QLOCKFREEPOOLALLOCATOR__
+#define __QLOCKFREEPOOLALLOCATOR__
+
+#include "SystemDefinitions.h"
+
+#include <boost/atomic.hpp>
+#include "QAlignment.h"
+
+#ifdef QE_COMPILER_MSVC
+    // This warning appears when instancing a template to create a data member and that template instance is not exported.
+    // In this case, it is not important since the data member is not accessible.
+    #pragma warning( disable : 4251 ) // http://msdn.microsoft.com/en-us/library/esew7y1w.aspx
+#endif
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+/// <summary>
+/// Represents a pool allocator, like QPoolAllocator, whose blocks can be allocated and deallocated from several threads at the same time without locks.
+/// </summary>
+/// <remarks>
+/// Free blocks form a stack (Treiber stack) whose top is replaced with a compare-and-swap operation. The top is stored as the index of the block 
+/// together with a tag that changes every time the top is replaced, so a thread cannot take a block that was allocated and deallocated again while 
+/// it was reading the stack (ABA problem). The index of the next free block of every block is stored in a separate array, so the content of the 
+/// allocated blocks is never read by the allocator.<br/>
+/// Allocate, Deallocate, CanAllocate and the properties can be used from any thread at any time. A block may be deallocated by a different thread 
+/// from the one that allocated it. The rest of methods (Clear, CopyTo, Reallocate and Shrink) must not be used while other threads are using the allocator; 
+/// they are provided so the allocator can replace QPoolAllocator in containers.<br/>
+/// The pool cannot have more than 2^32 - 1 blocks.
+/// </remarks>
+class QE_LAYER_SYSTEM_SYMBOLS QLockFreePoolAllocator
+{
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The size, in bytes, of a cache line. The top of the stack is separated from the rest of attributes by it.
+    /// </summary>
+    static const pointer_uint_q CACHE_LINE_SIZE = 64U;
+
+    /// <summary>
+    /// The index used to indicate that there are no more free blocks.
+    /// </summary>
+    static const u32_q END_INDEX;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructs a pool allocator passing the pool size, block size and memory alignment.
+    /// </summary>
+    /// <remarks>
+    /// Pre-allocates uSize bytes plus (uSize/uBlockSize)*4 bytes for internals.
+    /// </remarks>
+    /// <param name="uSize">[IN] Size of the pool, in bytes. It must be greater than or equal to the block size.</param>
+    /// <param name="uBlockSize">[IN] Size of each block to allocate, in bytes. It must be greater than zero.</param>
+    /// <param name="alignment">[IN] Multiple of which must be the memory address. All the blocks will have the same alignment.</param>
+    QLockFreePoolAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const QAlignment &alignment);
+
+private:
+
+    // Disabled.
+    QLockFreePoolAllocator(const QLockFreePoolAllocator &);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It frees the pool.
+    /// </summary>
+    ~QLockFreePoolAllocator();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Allocates a block in the pool and returns its address.
+    /// </summary>
+    /// <remarks>
+    /// This method is lock-free and can be called from several threads at the same time.
+    /// </remarks>
+    /// <returns>
+    /// Pointer to the allocated memory block. Returns null if pool is full.
+    /// </returns>
+    void* Allocate();
+
+    /// <summary>
+    /// Deallocates the block passed in the parameter.
+    /// </summary>
+    /// <remarks>
+    /// This method is lock-free and can be called from several threads at the same time.
+    /// </remarks>
+    /// <param name="pBlock">[IN] Pointer to a block previously allocated by this allocator, in any thread. It must not be null.</param>
+    void Deallocate(const void* pBlock);
+
+    /// <summary>
+    /// Deallocates all the blocks. The next blocks will be allocated in the same order they are stored.
+    /// </summary>
+    /// <remarks>
+    /// It must not be called while other threads are using the allocator.
+    /// </remarks>
+    void Clear();
+
+    /// <summary>
+    /// Copies the content of all the blocks and which of them are allocated to another pool allocator.
+    /// </summary>
+    /// <remarks>
+    /// It must not be called while other threads are using any of both allocators.
+    /// </remarks>
+    /// <param name="poolAllocator">[IN/OUT] The destination allocator. It must have the same block size and, at least, the same number of blocks.</param>
+    void CopyTo(QLockFreePoolAllocator &poolAllocator) const;
+
+    /// <summary>
+    /// Increases the size of the pool, moving the blocks to a new buffer. The allocated blocks keep their position in the pool.
+    /// </summary>
+    /// <remarks>
+    /// It must not be called while other threads are using the allocator. Any pointer to the blocks will point to garbage.
+    /// </remarks>
+    /// <param name="uNewSize">[IN] The new size of the pool, in bytes. It must be greater than the current size.</param>
+    void Reallocate(const pointer_uint_q uNewSize);
+
+    /// <summary>
+    /// Reduces the size of the pool, moving the blocks to a new buffer. The allocated blocks keep their position in the pool.
+    /// </summary>
+    /// <remarks>
+    /// It must not be called while other threads are using the allocator. Any pointer to the blocks will point to garbage.
+    /// </remarks>
+    /// <param name="uNewSize">[IN] The new size of the pool, in bytes. It must be lower than the current size and greater than or equal to the block size. 
+    /// All the blocks beyond the new size must be free.</param>
+    void Shrink(const pointer_uint_q uNewSize);
+
+private:
+
+    // Disabled.
+    QLockFreePoolAllocator& operator=(const QLockFreePoolAllocator &);
+
+    /// <summary>
+    /// Replaces the buffer of the pool and the list of free blocks with new ones, copying the content of the blocks that fit in the new buffer.
+    /// </summary>
+    /// <param name="uNewSize">[IN] The new size of the pool, in bytes. It must be, at least, the size of a block.</param>
+    void _ReplaceBuffers(const pointer_uint_q uNewSize);
+
+    /// <summary>
+    /// Links a range of blocks in ascending order, the last one pointing to a given block.
+    /// </summary>
+    /// <param name="arNextFreeBlocks">[IN/OUT] The list of free blocks to modify.</param>
+    /// <param name="uFirstIndex">[IN] The index of the first block of the range.</param>
+    /// <param name="uEndIndex">[IN] The index after the last block of the range. It must be greater than the first index.</param>
+    /// <param name="uNextIndex">[IN] The index of the block that follows the last block of the range.</param>
+    static void _LinkFreeBlocks(boost::atomic<u32_q>* arNextFreeBlocks, const u32_q uFirstIndex, const u32_q uEndIndex, const u32_q uNextIndex);
+
+    /// <summary>
+    /// Copies a list of free blocks to another list with a different number of blocks. The free blocks that do not exist in the destination 
+    /// are skipped and the blocks that do not exist in the source are added as free blocks to the end of the list.
+    /// </summary>
+    /// <param name="arSourceNextFreeBlocks">[IN] The list of free blocks to copy.</param>
+    /// <param name="uSourceFirstIndex">[IN] The index of the first free block of the source list. It may be END_INDEX.</param>
+    /// <param name="uSourceBlocksCount">[IN] The number of blocks of the source list.</param>
+    /// <param name="arDestinationNextFreeBlocks">[OUT] The list where the free blocks will be copied.</param>
+    /// <param name="uDestinationBlocksCount">[IN] The number of blocks of the destination list.</param>
+    /// <returns>
+    /// The index of the first free block of the destination list, or END_INDEX if there are no free blocks.
+    /// </returns>
+    static u32_q _CopyFreeBlocks(const boost::atomic<u32_q>* arSourceNextFreeBlocks, 
+                                 const u32_q uSourceFirstIndex, 
+                                 const u32_q uSourceBlocksCount, 
+                                 boost::atomic<u32_q>* arDestinationNextFreeBlocks, 
+                                 const u32_q uDestinationBlocksCount);
+
+    /// <summary>
+    /// Composes the value of the top of the stack of free blocks.
+    /// </summary>
+    /// <param name="uIndex">[IN] The index of the first free block.</param>
+    /// <param name="uTag">[IN] The tag that identifies the current version of the top.</param>
+    /// <returns>
+    /// The top of the stack.
+    /// </returns>
+    static u64_q _MakeTop(const u32_q uIndex, const u32_q uTag);
+
+    /// <summary>
+    /// Gets the index of the first free block from the top of the stack of free blocks.
+    /// </summary>
+    /// <param name="uTop">[IN] The top of the stack.</param>
+    /// <returns>
+    /// The index of the first free block, or END_INDEX if there are no free blocks.
+    /// </returns>
+    static u32_q _GetTopIndex(const u64_q uTop);
+
+    /// <summary>
+    /// Gets the tag from the top of the stack of free blocks.
+    /// </summary>
+    /// <param name="uTop">[IN] The top of the stack.</param>
+    /// <returns>
+    /// The tag.
+    /// </returns>
+    static u32_q _GetTopTag(const u64_q uTop);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the size of the pool plus the memory reserved for internals, in bytes.
+    /// </summary>
+    /// <returns>
+    /// The total size.
+    /// </returns>
+    pointer_uint_q GetTotalSize() const;
+
+    /// <summary>
+    /// Gets the size of the pool, in bytes.
+    /// </summary>
+    /// <returns>
+    /// The size of the pool.
+    /// </returns>
+    pointer_uint_q GetPoolSize() const;
+
+    /// <summary>
+    /// Indicates whether there is, at least, one free block in the pool.
+    /// </summary>
+    /// <remarks>
+    /// Other threads may allocate or deallocate blocks right after the check, so the result is only a hint when the allocator is shared.
+    /// </remarks>
+    /// <returns>
+    /// True if there are free blocks; False otherwise.
+    /// </returns>
+    bool CanAllocate() const;
+
+    /// <summary>
+    /// Gets the number of allocated bytes.
+    /// </summary>
+    /// <returns>
+    /// The sum of the sizes of the allocated blocks.
+    /// </returns>
+    pointer_uint_q GetAllocatedBytes() const;
+
+    /// <summary>
+    /// Gets the address of the first block of the pool.
+    /// </summary>
+    /// <returns>
+    /// The address of the first block.
+    /// </returns>
+    void* GetPointer() const;
+
+    /// <summary>
+    /// Gets the alignment of the blocks.
+    /// </summary>
+    /// <returns>
+    /// The memory alignment.
+    /// </returns>
+    QAlignment GetAlignment() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The top of the stack of free blocks: the index of the first free block in the lower 32 bits and a tag that changes every time the top is replaced in the 
+    /// upper 32 bits.
+    /// </summary>
+    boost::atomic<u64_q> m_uTop;
+
+    /// <summary>
+    /// Separates the top of the stack, which is modified by every allocation, from the rest of attributes.
+    /// </summary>
+    u8_q m_arTopPadding[QLockFreePoolAllocator::CACHE_LINE_SIZE];
+
+    /// <summary>
+    /// The number of allocated blocks.
+    /// </summary>
+    boost::atomic<u32_q> m_uAllocatedBlocks;
+
+    /// <summary>
+    /// Separates the counter of allocated blocks from the attributes that do not change when blocks are allocated.
+    /// </summary>
+    u8_q m_arCounterPadding[QLockFreePoolAllocator::CACHE_LINE_SIZE];
+
+    /// <summary>
+    /// The index of the next free block of every block. Only the values of the free blocks are meaningful.
+    /// </summary>
+    boost::atomic<u32_q>* m_arNextFreeBlocks;
+
+    /// <summary>
+    /// The first block of the pool.
+    /// </summary>
+    u8_q* m_pFirst;
+
+    /// <summary>
+    /// Size of blocks to allocate.
+    /// </summary>
+    pointer_uint_q m_uBlockSize;
+
+    /// <summary>
+    /// Size of the pool, in bytes.
+    /// </summary>
+    pointer_uint_q m_uPoolSize;
+
+    /// <summary>
+    /// Number of blocks that fit into the pool.
+    /// </summary>
+    u32_q m_uBlocksCount;
+
+    /// <summary>
+    /// Alignment of the blocks.
+    /// </summary>
+    QAlignment m_alignment;
+};
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QLOCKFREEPOOLALLOCATOR__
@@ -0,0 +1,499 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QMPMCQUEUE__
+#define __QMPMCQUEUE__
+
+#include "SystemDefinitions.h"
+
+#include <boost/atomic.hpp>
+#include "QLinearAllocator.h"
+#include "QAlignment.h"
+#include "QMutex.h"
+#include "QScopedExclusiveLock.h"
+#include "QConditionVariable.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+using Kinesis::QuimeraEngine::Common::Memory::QLinearAllocator;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+/// <summary>
+/// Represents a bounded first-in first-out queue that several threads can fill and empty at the same time, without locking.
+/// </summary>
+/// <remarks>
+/// Elements are stored in a ring buffer of fixed capacity, whose memory is reserved by a linear allocator when the queue is created. Every slot of the buffer 
+/// occupies whole cache lines and contains the element and a sequence number that tells producers and consumers whether the slot is free or filled in the 
+/// current lap around the ring. Producers and consumers reserve a position by incrementing an atomic counter with a compare-and-swap operation and then 
+/// only access the slot of that position, so threads working on different positions do not share any cache line.<br/>
+/// TryPush and TryPop never block. Push and Pop make the thread wait, using a condition variable, while the queue is full or empty, respectively; the mutex 
+/// is only locked when a thread has to wait or there is a thread waiting.<br/>
+/// Elements are copied into the queue when they are added, and copied out and destroyed when they are extracted.<br/>
+/// Use QSPSCQueue when there is only one producer and one consumer, it is faster.<br/>
+/// This class is thread-safe.
+/// </remarks>
+/// <typeparam name="T">The type of the elements in the queue. Its alignment must not be greater than the size of a cache line.</typeparam>
+template<class T>
+class QMPMCQueue
+{
+    // TYPEDEFS
+    // ---------------
+protected:
+
+    typedef boost::atomic<pointer_uint_q> SequenceType;
+
+
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The size, in bytes, of a cache line. Slots are aligned to it and the counters are separated by it.
+    /// </summary>
+    static const pointer_uint_q CACHE_LINE_SIZE = 64U;
+
+    /// <summary>
+    /// The offset, in bytes, of the sequence number from the start of a slot, where the element is stored.
+    /// </summary>
+    static const pointer_uint_q SEQUENCE_OFFSET = (sizeof(T) + alignof_q(SequenceType) - 1U) / alignof_q(SequenceType) * alignof_q(SequenceType);
+
+    /// <summary>
+    /// The size, in bytes, of a slot. It is a multiple of the size of a cache line.
+    /// </summary>
+    static const pointer_uint_q SLOT_SIZE = (SEQUENCE_OFFSET + sizeof(SequenceType) + CACHE_LINE_SIZE - 1U) / CACHE_LINE_SIZE * CACHE_LINE_SIZE;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the capacity of the queue.
+    /// </summary>
+    /// <param name="uCapacity">[IN] The maximum number of elements the queue can store. It must be a power of two greater than one.</param>
+    explicit QMPMCQueue(const pointer_uint_q uCapacity) : m_allocator(uCapacity * QMPMCQueue::SLOT_SIZE, QAlignment(QMPMCQueue::CACHE_LINE_SIZE)),
+                                                          m_pSlots(null_q),
+                                                          m_uCapacity(uCapacity),
+                                                          m_uTail(0),
+                                                          m_uHead(0),
+                                                          m_uWaitingProducers(0),
+                                                          m_uWaitingConsumers(0)
+    {
+        QE_ASSERT_ERROR(uCapacity > 1U && (uCapacity & (uCapacity - 1U)) == 0, "The capacity must be a power of two greater than one.");
+
+        m_pSlots = scast_q(m_allocator.Allocate(uCapacity * QMPMCQueue::SLOT_SIZE), u8_q*);
+
+        // The slot of every position is free for the first lap
+        for(pointer_uint_q uPosition = 0; uPosition < uCapacity; ++uPosition)
+            new(&this->_GetSequence(uPosition)) SequenceType(uPosition);
+    }
+
+private:
+
+    // Disabled.
+    QMPMCQueue(const QMPMCQueue &);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every element that remains in the queue will be called. No thread may be using the queue.
+    /// </remarks>
+    ~QMPMCQueue()
+    {
+        const pointer_uint_q TAIL = m_uTail.load(boost::memory_order_relaxed);
+
+        for(pointer_uint_q uPosition = m_uHead.load(boost::memory_order_relaxed); uPosition != TAIL; ++uPosition)
+            this->_GetElement(uPosition)->~T();
+
+        for(pointer_uint_q uPosition = 0; uPosition < m_uCapacity; ++uPosition)
+            this->_GetSequence(uPosition).~SequenceType();
+    }
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Disabled.
+    QMPMCQueue& operator=(const QMPMCQueue &);
+
+public:
+
+    /// <summary>
+    /// Adds a copy of an element to the end of the queue, if it is not full.
+    /// </summary>
+    /// <remarks>
+    /// It never blocks, although it may have to retry if other producers reserve the same position at the same time.<br/>
+    /// The copy constructor of the element will be called.
+    /// </remarks>
+    /// <param name="value">[IN] The element to add.</param>
+    /// <returns>
+    /// True if the element was added; False if the queue was full.
+    /// </returns>
+    bool TryPush(const T &value)
+    {
+        const bool ELEMENT_ADDED = this->_TryPush(value);
+
+        if(ELEMENT_ADDED)
+            this->_NotifyWaitingThreads(m_uWaitingConsumers, m_notEmptyCondition);
+
+        return ELEMENT_ADDED;
+    }
+
+    /// <summary>
+    /// Adds a copy of an element to the end of the queue, waiting for a consumer to extract an element if it is full.
+    /// </summary>
+    /// <remarks>
+    /// The copy constructor of the element will be called.
+    /// </remarks>
+    /// <param name="value">[IN] The element to add.</param>
+    void Push(const T &value)
+    {
+        if(!this->_TryPush(value))
+        {
+            QScopedExclusiveLock<QMutex> lock(m_mutex);
+            m_uWaitingProducers.fetch_add(1U, boost::memory_order_relaxed);
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+
+            while(!this->_TryPush(value))
+                m_notFullCondition.Wait(lock);
+
+            m_uWaitingProducers.fetch_sub(1U, boost::memory_order_relaxed);
+        }
+
+        this->_NotifyWaitingThreads(m_uWaitingConsumers, m_notEmptyCondition);
+    }
+
+    /// <summary>
+    /// Extracts the element at the front of the queue, if it is not empty.
+    /// </summary>
+    /// <remarks>
+    /// It never blocks, although it may have to retry if other consumers reserve the same position at the same time.<br/>
+    /// The assignment operator and the destructor of the element will be called.
+    /// </remarks>
+    /// <param name="value">[OUT] The extracted element. If the queue is empty, it is not modified.</param>
+    /// <returns>
+    /// True if an element was extracted; False if the queue was empty.
+    /// </returns>
+    bool TryPop(T &value)
+    {
+        const bool ELEMENT_EXTRACTED = this->_TryPop(value);
+
+        if(ELEMENT_EXTRACTED)
+            this->_NotifyWaitingThreads(m_uWaitingProducers, m_notFullCondition);
+
+        return ELEMENT_EXTRACTED;
+    }
+
+    /// <summary>
+    /// Extracts the element at the front of the queue, waiting for a producer to add an element if it is empty.
+    /// </summary>
+    /// <remarks>
+    /// The assignment operator and the destructor of the element will be called.
+    /// </remarks>
+    /// <param name="value">[OUT] The extracted element.</param>
+    void Pop(T &value)
+    {
+        if(!this->_TryPop(value))
+        {
+            QScopedExclusiveLock<QMutex> lock(m_mutex);
+            m_uWaitingConsumers.fetch_add(1U, boost::memory_order_relaxed);
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+
+            while(!this->_TryPop(value))
+                m_notEmptyCondition.Wait(lock);
+
+            m_uWaitingConsumers.fetch_sub(1U, boost::memory_order_relaxed);
+        }
+
+        this->_NotifyWaitingThreads(m_uWaitingProducers, m_notFullCondition);
+    }
+
+private:
+
+    /// <summary>
+    /// Adds a copy of an element to the end of the queue, if it is not full, without notifying any waiting thread.
+    /// </summary>
+    /// <remarks>
+    /// A slot is free for the position of the tail when its sequence number equals the position. If it is lower, the element of the previous lap 
+    /// has not been extracted yet; if it is greater, another producer has already reserved the position.
+    /// </remarks>
+    /// <param name="value">[IN] The element to add.</param>
+    /// <returns>
+    /// True if the element was added; False if the queue was full.
+    /// </returns>
+    bool _TryPush(const T &value)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::i32_q;
+
+        pointer_uint_q uPosition = m_uTail.load(boost::memory_order_relaxed);
+        bool bPositionReserved = false;
+
+        while(!bPositionReserved)
+        {
+            // The difference is calculated with wrap-around so it remains valid when the counters overflow
+            const pointer_uint_q SEQUENCE = this->_GetSequence(uPosition).load(boost::memory_order_acquire);
+            const i32_q DIFFERENCE = scast_q(SEQUENCE - uPosition, i32_q);
+
+            if(DIFFERENCE == 0)
+                bPositionReserved = m_uTail.compare_exchange_weak(uPosition, uPosition + 1U, boost::memory_order_relaxed);
+            else if(DIFFERENCE < 0)
+                return false;
+            else
+                uPosition = m_uTail.load(boost::memory_order_relaxed);
+        }
+
+        new(this->_GetElement(uPosition)) T(value);
+        this->_GetSequence(uPosition).store(uPosition + 1U, boost::memory_order_release);
+
+        return true;
+    }
+
+    /// <summary>
+    /// Extracts the element at the front of the queue, if it is not empty, without notifying any waiting thread.
+    /// </summary>
+    /// <remarks>
+    /// A slot is filled for the position of the head when its sequence number equals the position plus one. If it is lower, no element has been 
+    /// added to the slot in this lap yet; if it is greater, another consumer has already reserved the position.<br/>
+    /// Once the element is extracted, the sequence number is set to the position the slot will have in the next lap.
+    /// </remarks>
+    /// <param name="value">[OUT] The extracted element. If the queue is empty, it is not modified.</param>
+    /// <returns>
+    /// True if an element was extracted; False if the queue was empty.
+    /// </returns>
+    bool _TryPop(T &value)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::i32_q;
+
+        pointer_uint_q uPosition = m_uHead.load(boost::memory_order_relaxed);
+        bool bPositionReserved = false;
+
+        while(!bPositionReserved)
+        {
+            const pointer_uint_q SEQUENCE = this->_GetSequence(uPosition).load(boost::memory_order_acquire);
+            const i32_q DIFFERENCE = scast_q(SEQUENCE - (uPosition + 1U), i32_q);
+
+            if(DIFFERENCE == 0)
+                bPositionReserved = m_uHead.compare_exchange_weak(uPosition, uPosition + 1U, boost::memory_order_relaxed);
+            else if(DIFFERENCE < 0)
+                return false;
+            else
+                uPosition = m_uHead.load(boost::memory_order_relaxed);
+        }
+
+        T* pElement = this->_GetElement(uPosition);
+        value = *pElement;
+        pElement->~T();
+        this->_GetSequence(uPosition).store(uPosition + m_uCapacity, boost::memory_order_release);
+
+        return true;
+    }
+
+    /// <summary>
+    /// Wakes a thread up if there is any waiting for a condition.
+    /// </summary>
+    /// <remarks>
+    /// The fence guarantees that either the waiting thread sees the last change in the queue before it starts waiting or this thread sees the waiting thread.
+    /// </remarks>
+    /// <param name="uWaitingThreads">[IN] The counter of threads that wait for the condition.</param>
+    /// <param name="condition">[IN] The condition variable the threads wait for.</param>
+    void _NotifyWaitingThreads(const boost::atomic<pointer_uint_q> &uWaitingThreads, QConditionVariable &condition)
+    {
+        boost::atomic_thread_fence(boost::memory_order_seq_cst);
+
+        if(uWaitingThreads.load(boost::memory_order_relaxed) != 0)
+        {
+            QScopedExclusiveLock<QMutex> lock(m_mutex);
+            condition.NotifyOne();
+        }
+    }
+
+    /// <summary>
+    /// Gets the element stored in the slot that corresponds to a position.
+    /// </summary>
+    /// <param name="uPosition">[IN] A position, which may be greater than the capacity.</param>
+    /// <returns>
+    /// A pointer to the element of the slot.
+    /// </returns>
+    T* _GetElement(const pointer_uint_q uPosition) const
+    {
+        return rcast_q(m_pSlots + (uPosition & (m_uCapacity - 1U)) * QMPMCQueue::SLOT_SIZE, T*);
+    }
+
+    /// <summary>
+    /// Gets the sequence number of the slot that corresponds to a position.
+    /// </summary>
+    /// <param name="uPosition">[IN] A position, which may be greater than the capacity.</param>
+    /// <returns>
+    /// The sequence number of the slot.
+    /// </returns>
+    SequenceType& _GetSequence(const pointer_uint_q uPosition) const
+    {
+        return *rcast_q(m_pSlots + (uPosition & (m_uCapacity - 1U)) * QMPMCQueue::SLOT_SIZE + QMPMCQueue::SEQUENCE_OFFSET, SequenceType*);
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the maximum number of elements the queue can store.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the queue.
+    /// </returns>
+    pointer_uint_q GetCapacity() const
+    {
+        return m_uCapacity;
+    }
+
+    /// <summary>
+    /// Gets the number of elements in the queue.
+    /// </summary>
+    /// <remarks>
+    /// Positions reserved by threads that are still adding or extracting an element are counted as occupied. The result may be out of date as soon 
+    /// as it is returned, if other threads modify the queue.
+    /// </remarks>
+    /// <returns>
+    /// The number of elements in the queue.
+    /// </returns>
+    pointer_uint_q GetCount() const
+    {
+        const pointer_uint_q HEAD = m_uHead.load(boost::memory_order_acquire);
+        const pointer_uint_q TAIL = m_uTail.load(boost::memory_order_acquire);
+
+        // The head may have overtaken the tail read before it if other threads are working on the queue
+        return TAIL - HEAD > m_uCapacity ? 0 : TAIL - HEAD;
+    }
+
+    /// <summary>
+    /// Indicates whether the queue is empty or not.
+    /// </summary>
+    /// <remarks>
+    /// The result may be out of date as soon as it is returned, if other threads modify the queue.
+    /// </remarks>
+    /// <returns>
+    /// True if the queue is empty; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return this->GetCount() == 0;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The allocator that reserves the slots of the queue.
+    /// </summary>
+    QLinearAllocator m_allocator;
+
+    /// <summary>
+    /// The ring buffer of slots, each of them containing an element and its sequence number.
+    /// </summary>
+    u8_q* m_pSlots;
+
+    /// <summary>
+    /// The maximum number of elements in the queue.
+    /// </summary>
+    const pointer_uint_q m_uCapacity;
+
+    /// <summary>
+    /// Separates the attributes read by all the threads from the attributes of the producers.
+    /// </summary>
+    u8_q m_arProducersPadding[QMPMCQueue::CACHE_LINE_SIZE];
+
+    /// <summary>
+    /// The next position where an element will be added.
+    /// </summary>
+    boost::atomic<pointer_uint_q> m_uTail;
+
+    /// <summary>
+    /// Separates the attributes of the producers from the attributes of the consumers.
+    /// </summary>
+    u8_q m_arConsumersPadding[QMPMCQueue::CACHE_LINE_SIZE];
+
+    /// <summary>
+    /// The next position from where an element will be extracted.
+    /// </summary>
+    boost::atomic<pointer_uint_q> m_uHead;
+
+    /// <summary>
+    /// Separates the attributes of the consumers from the attributes used for waiting.
+    /// </summary>
+    u8_q m_arWaitingPadding[QMPMCQueue::CACHE_LINE_SIZE];
+
+    /// <summary>
+    /// The number of producers waiting for the queue not to be full.
+    /// </summary>
+    boost::atomic<pointer_uint_q> m_uWaitingProducers;
+
+    /// <summary>
+    /// The number of consumers waiting for the queue not to be empty.
+    /// </summary>
+    boost::atomic<pointer_uint_q> m_uWaitingConsumers;
+
+    /// <summary>
+    /// The mutex that protects the waiting threads.
+    /// </summary>
+    QMutex m_mutex;
+
+    /// <summary>
+    /// The condition producers wait for when the queue is full.
+    /// </summary>
+    QConditionVariable m_notFullCondition;
+
+    /// <summary>
+    /// The condition consumers wait for when the queue is empty.
+    /// </summary>
+    QConditionVariable m_notEmptyCondition;
+};
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QMPMCQUEUE__
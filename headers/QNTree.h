@@ -34,9 +34,13 @@
 #include "QAlignment.h"
 #include "SQComparatorDefault.h"
 #include "AllocationOperators.h"
+#include "SQTypeTraits.h"
 #include "EQTreeTraversalOrder.h"
 #include "EQIterationDirection.h"
 #include "SQInteger.h"
+#include "QContainerStatistics.h"
+#include "QContainerImageHeader.h"
+#include "SQGeometricGrowthPolicy.h"
 
 using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
 using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
@@ -65,7 +69,8 @@ namespace Containers
 /// <typeparam name="T">The type of the tree elements.</typeparam>
 /// <typeparam name="AllocatorT">The allocator used to reserve memory. The default type is QPoolAllocator.</typeparam>
 /// <typeparam name="ComparatorT">The comparator. The default type is SQComparatorDefault.</typeparam>
-template <class T, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, class ComparatorT = SQComparatorDefault<T> >
+/// <typeparam name="GrowthPolicyT">The policy that calculates the new capacity when it is exceeded. The default type is SQGeometricGrowthPolicy.</typeparam>
+template <class T, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, class ComparatorT = SQComparatorDefault<T>, class GrowthPolicyT = SQGeometricGrowthPolicy>
 class QNTree
 {
 
@@ -1641,13 +1646,6 @@ protected:
     /// </summary>
     const pointer_uint_q MAX_CHILDREN;
 
-private:
-
-    /// <summary>
-    /// The reallocation factor to be applied to calculate the new capacity on every reallocation. It must be greater than or equal to 1.
-    /// </summary>
-    static float REALLOCATION_FACTOR;
-    
 
     // CONSTRUCTORS
     // ---------------
@@ -1720,11 +1718,15 @@ public:
             tree.m_elementAllocator.CopyTo(m_elementAllocator);
             tree.m_nodeAllocator.CopyTo(m_nodeAllocator);
 
-            QNTree::QNTreeIterator itSource = tree.GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder);
-            QNTree::QNTreeIterator itDestination = this->GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+            // The bytes of the elements have already been copied, which is enough for trivially copyable types
+            if(!SQTypeTraits<T>::IS_TRIVIALLY_COPYABLE)
+            {
+                QNTree::QNTreeIterator itSource = tree.GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+                QNTree::QNTreeIterator itDestination = this->GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder);
 
-            for(; !itSource.IsEnd(); ++itSource, ++itDestination)
-                new(&*itDestination) T(*itSource);
+                for(; !itSource.IsEnd(); ++itSource, ++itDestination)
+                    new(&*itDestination) T(*itSource);
+            }
         }
     }
 
@@ -1743,7 +1745,7 @@ public:
     /// </remarks>
     ~QNTree()
     {
-        if(!this->IsEmpty())
+        if(!this->IsEmpty() && !SQTypeTraits<T>::IS_TRIVIALLY_DESTRUCTIBLE)
             for(QNTree::QConstNTreeIterator it = this->GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder); !it.IsEnd(); ++it)
                 (*it).~T();
     }
@@ -1784,11 +1786,15 @@ public:
                 tree.m_elementAllocator.CopyTo(m_elementAllocator);
                 tree.m_nodeAllocator.CopyTo(m_nodeAllocator);
 
-                QNTree::QNTreeIterator itSource = tree.GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder);
-                QNTree::QNTreeIterator itDestination = this->GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+                // The bytes of the elements have already been copied, which is enough for trivially copyable types
+                if(!SQTypeTraits<T>::IS_TRIVIALLY_COPYABLE)
+                {
+                    QNTree::QNTreeIterator itSource = tree.GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+                    QNTree::QNTreeIterator itDestination = this->GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder);
 
-                for(; !itSource.IsEnd(); ++itSource, ++itDestination)
-                    new(&*itDestination) T(*itSource);
+                    for(; !itSource.IsEnd(); ++itSource, ++itDestination)
+                        new(&*itDestination) T(*itSource);
+                }
             }
         }
 
@@ -1881,6 +1887,159 @@ public:
         }
     }
 
+    /// <summary>
+    /// Moves the elements so they occupy consecutive positions in memory, in the same order they are traversed, and releases 
+    /// the capacity that is not used.
+    /// </summary>
+    /// <remarks>
+    /// After many insertions and removals, traversing the tree may imply jumping to distant memory addresses. Once compacted, 
+    /// the root node is stored at the beginning of the buffer and every element is followed by the next one in the traversal order.<br/>
+    /// This operation implies a reallocation, which means that any pointer or iterator to elements of this tree will be pointing to garbage.<br/>
+    /// Elements are moved bitwise; no assignment operator nor copy constructors are called during this operation. The capacity 
+    /// will be equal to the number of elements, or 1 if the tree is empty.
+    /// </remarks>
+    /// <param name="eTraversalOrder">[IN] The order in which the elements will be placed in memory. Currently, only depth-first pre-order is supported.</param>
+    /// <returns>
+    /// The number of bytes released, taking into account both the elements and the internal nodes.
+    /// </returns>
+    pointer_uint_q Compact(const EQTreeTraversalOrder &eTraversalOrder)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+
+        QE_ASSERT_ERROR(eTraversalOrder == EQTreeTraversalOrder::E_DepthFirstPreOrder, string_q("The traversal order specified (") + eTraversalOrder.ToString() + ") is not supported. The only traversal order available currently is: DepthFirstPreOrder.");
+
+        const pointer_uint_q COUNT = this->GetCount();
+        const pointer_uint_q ORIGINAL_POOL_SIZE = m_elementAllocator.GetPoolSize() + m_nodeAllocator.GetPoolSize();
+
+        if(COUNT > 0)
+        {
+            // Calculates the new position of every node, visiting them in depth-first pre-order
+            pointer_uint_q* arNewPositions = new pointer_uint_q[this->GetCapacity()];
+            pointer_uint_q* arOldPositions = new pointer_uint_q[COUNT];
+            pointer_uint_q uIndex = 0;
+            this->_CalculatePreOrderPositions(arNewPositions, arOldPositions);
+
+            // Copies the elements and the nodes to temporary buffers in their new order, translating the positions stored in the nodes
+            u8_q* arElements = new u8_q[COUNT * sizeof(T)];
+            u8_q* arNodes = new u8_q[COUNT * sizeof(QNTree::QNode)];
+
+            for(uIndex = 0; uIndex < COUNT; ++uIndex)
+            {
+                const QNTree::QNode* pNode = m_pNodeBasePointer + arOldPositions[uIndex];
+
+                memcpy(arElements + uIndex * sizeof(T), m_pElementBasePointer + arOldPositions[uIndex], sizeof(T));
+                new(arNodes + uIndex * sizeof(QNTree::QNode)) QNTree::QNode(QNTree::_TranslatePosition(pNode->GetParent(),     arNewPositions),
+                                                                            QNTree::_TranslatePosition(pNode->GetNext(),       arNewPositions),
+                                                                            QNTree::_TranslatePosition(pNode->GetPrevious(),   arNewPositions),
+                                                                            QNTree::_TranslatePosition(pNode->GetFirstChild(), arNewPositions));
+            }
+
+            // Elements are relocated bitwise on purpose, even if they are not trivially copyable, the cast just states so
+            memcpy(scast_q(m_pElementBasePointer, void*), arElements, COUNT * sizeof(T));
+            memcpy(m_pNodeBasePointer, arNodes, COUNT * sizeof(QNTree::QNode));
+            m_uRoot = 0;
+
+            delete[] arElements;
+            delete[] arNodes;
+            delete[] arNewPositions;
+            delete[] arOldPositions;
+
+            // The allocators must consider the first blocks as occupied, and the rest as free
+            m_elementAllocator.Clear();
+            m_nodeAllocator.Clear();
+
+            for(uIndex = 0; uIndex < COUNT; ++uIndex)
+            {
+                m_elementAllocator.Allocate();
+                m_nodeAllocator.Allocate();
+            }
+        }
+
+        const pointer_uint_q FINAL_CAPACITY = COUNT > 0 ? COUNT : 1U;
+
+        if(FINAL_CAPACITY < this->GetCapacity())
+        {
+            m_elementAllocator.Shrink(FINAL_CAPACITY * sizeof(T));
+            m_nodeAllocator.Shrink(FINAL_CAPACITY * sizeof(QNTree::QNode));
+            m_pElementBasePointer = scast_q(m_elementAllocator.GetPointer(), T*);
+            m_pNodeBasePointer = scast_q(m_nodeAllocator.GetPointer(), QNTree::QNode*);
+        }
+
+        return ORIGINAL_POOL_SIZE - m_elementAllocator.GetPoolSize() - m_nodeAllocator.GetPoolSize();
+    }
+
+    /// <summary>
+    /// Writes a flat binary image of the tree, which can be read without deserializing the elements by QNTreeImageView.
+    /// </summary>
+    /// <remarks>
+    /// The image is composed of a QContainerImageHeader, followed by the nodes and then by the bytes of the elements, both in depth-first pre-order, 
+    /// so the root is the first node. Every node occupies four 32-bits positions: the parent, the next sibling, the previous sibling and the first child.<br/>
+    /// Elements are not padded: the header occupies 32 bytes and every node 16 bytes, so the elements are aligned in the image only if their 
+    /// alignment is not greater than 16 bytes. Trees of types with bigger alignments cannot be written.<br/>
+    /// Only trees whose elements are trivially copyable (see SQTypeTraits) can be written. The tree is not modified.
+    /// </remarks>
+    /// <typeparam name="BinaryStreamWriterT">The type of the writer, normally QBinaryStreamWriter. It must provide the methods Write and WriteBytes.</typeparam>
+    /// <param name="writer">[IN/OUT] The writer that receives the image.</param>
+    template<class BinaryStreamWriterT>
+    void WriteImage(BinaryStreamWriterT &writer) const
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+        using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+        QE_ASSERT_ERROR(SQTypeTraits<T>::IS_TRIVIALLY_COPYABLE, "Only trees whose elements are trivially copyable can be written as images.");
+        QE_ASSERT_ERROR(alignof_q(T) <= 16U, "Only trees whose elements have an alignment lower than or equal to 16 bytes can be written as images.");
+
+        const pointer_uint_q COUNT = this->GetCount();
+
+        if(COUNT == 0)
+        {
+            writer.Write(QContainerImageHeader(QContainerImageHeader::CONTAINER_TYPE_NTREE, sizeof(T), 0, QContainerImageHeader::NULL_POSITION));
+        }
+        else
+        {
+            pointer_uint_q* arNewPositions = new pointer_uint_q[this->GetCapacity()];
+            pointer_uint_q* arOldPositions = new pointer_uint_q[COUNT];
+            this->_CalculatePreOrderPositions(arNewPositions, arOldPositions);
+
+            // Nodes and elements are gathered in their new order so they are written at once
+            u32_q* arNodes = new u32_q[COUNT * 4U];
+            u8_q* arElements = new u8_q[COUNT * sizeof(T)];
+
+            for(pointer_uint_q uIndex = 0; uIndex < COUNT; ++uIndex)
+            {
+                const QNTree::QNode* pNode = m_pNodeBasePointer + arOldPositions[uIndex];
+
+                arNodes[uIndex * 4U]      = QNTree::_TranslateImagePosition(pNode->GetParent(),     arNewPositions);
+                arNodes[uIndex * 4U + 1U] = QNTree::_TranslateImagePosition(pNode->GetNext(),       arNewPositions);
+                arNodes[uIndex * 4U + 2U] = QNTree::_TranslateImagePosition(pNode->GetPrevious(),   arNewPositions);
+                arNodes[uIndex * 4U + 3U] = QNTree::_TranslateImagePosition(pNode->GetFirstChild(), arNewPositions);
+                memcpy(arElements + uIndex * sizeof(T), m_pElementBasePointer + arOldPositions[uIndex], sizeof(T));
+            }
+
+            writer.Write(QContainerImageHeader(QContainerImageHeader::CONTAINER_TYPE_NTREE, sizeof(T), COUNT, 0));
+            writer.WriteBytes(arNodes, COUNT * 4U * sizeof(u32_q));
+            writer.WriteBytes(arElements, COUNT * sizeof(T));
+
+            delete[] arNodes;
+            delete[] arElements;
+            delete[] arNewPositions;
+            delete[] arOldPositions;
+        }
+    }
+
+    /// <summary>
+    /// Reduces the capacity of the tree so it is equal to the number of elements, releasing the memory that is not used.
+    /// </summary>
+    /// <remarks>
+    /// If the tree is empty, the capacity will be 1.<br/>
+    /// Since the unused blocks may be interleaved with the elements, the tree is compacted in depth-first pre-order (see Compact), which implies 
+    /// a reallocation that makes any pointer or iterator to elements of this tree point to garbage.
+    /// </remarks>
+    void ShrinkToFit()
+    {
+        this->Compact(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    }
+
     /// <summary>
     /// Sets the root node of the tree.
     /// </summary>
@@ -1926,84 +2085,141 @@ public:
     /// </returns>
     QNTreeIterator AddChild(const typename QNTree::QConstNTreeIterator &parentNode, const T &newElement)
     {
-        //        R
-        //       / \
-        //      0-...
-        //     /|\
-        //    0-1-2-X
-        //
-        using Kinesis::QuimeraEngine::Common::DataTypes::SQInteger;
-        using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+        const pointer_uint_q NEW_NODE_POSITION = this->_AllocateChild(parentNode);
 
-        QE_ASSERT_ERROR(parentNode.IsValid(), "The input iterator is not valid.");
-        QE_ASSERT_ERROR(!parentNode.IsEnd(), "The input iterator must not point to an end position.");
+        if(NEW_NODE_POSITION != QNTree::END_POSITION_FORWARD)
+            new(m_pElementBasePointer + NEW_NODE_POSITION) T(newElement);
 
-        // Gets node pointer and position
-        QNTree::QNode* pParentNode = m_pNodeBasePointer + parentNode.GetInternalPosition();
-        
-        pointer_uint_q uNewNodePosition = QNTree::END_POSITION_FORWARD;
+        return QNTree::QNTreeIterator(this, NEW_NODE_POSITION, parentNode.GetTraversalOrder());
+    }
+    
+    /// <summary>
+    /// Constructs a new element at the last position of the child node list, calling its default constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the tree is empty, use the SetRootValue method.<br/>
+    /// If the parent node already has the maximum number of child nodes, the new element will not be added.<br/>
+    /// If the capacity of the tree is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called.
+    /// </remarks>
+    /// <param name="parentNode">[IN] An iterator that points to the parent node to which the element will be added as a child. It must not point to an end position.</param>
+    /// <returns>
+    /// An iterator that points to the just added element. If it was not added, the iterator will point to an end position.
+    /// </returns>
+    QNTreeIterator EmplaceChild(const typename QNTree::QConstNTreeIterator &parentNode)
+    {
+        const pointer_uint_q NEW_NODE_POSITION = this->_AllocateChild(parentNode);
 
-        // If the parent node has any child node
-        if(pParentNode->GetFirstChild() != QNTree::END_POSITION_FORWARD)
-        {
-            QNTree::QNode* pCurrentNode = m_pNodeBasePointer + pParentNode->GetFirstChild();
-            pointer_uint_q uNumberOfElements = 1U;
+        if(NEW_NODE_POSITION != QNTree::END_POSITION_FORWARD)
+            new(m_pElementBasePointer + NEW_NODE_POSITION) T();
 
-            // Navigates to the last child node
-            while(pCurrentNode->GetNext() != QNTree::END_POSITION_FORWARD)
-            {
-                pCurrentNode = m_pNodeBasePointer + pCurrentNode->GetNext();
-                ++uNumberOfElements;
-            }
+        return QNTree::QNTreeIterator(this, NEW_NODE_POSITION, parentNode.GetTraversalOrder());
+    }
+    
+    /// <summary>
+    /// Constructs a new element at the last position of the child node list, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the tree is empty, use the SetRootValue method.<br/>
+    /// If the parent node already has the maximum number of child nodes, the new element will not be added.<br/>
+    /// If the capacity of the tree is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called.
+    /// </remarks>
+    /// <param name="parentNode">[IN] An iterator that points to the parent node to which the element will be added as a child. It must not point to an end position.</param>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    /// <returns>
+    /// An iterator that points to the just added element. If it was not added, the iterator will point to an end position.
+    /// </returns>
+    template<class Argument1T>
+    QNTreeIterator EmplaceChild(const typename QNTree::QConstNTreeIterator &parentNode, const Argument1T &argument1)
+    {
+        const pointer_uint_q NEW_NODE_POSITION = this->_AllocateChild(parentNode);
 
-            QE_ASSERT_ERROR(uNumberOfElements < this->MAX_CHILDREN, string_q("It is not possible to add another child to this node, maximum allowed exceeded (") + string_q::FromInteger(this->MAX_CHILDREN) + ").");
+        if(NEW_NODE_POSITION != QNTree::END_POSITION_FORWARD)
+            new(m_pElementBasePointer + NEW_NODE_POSITION) T(argument1);
 
-            if(uNumberOfElements < this->MAX_CHILDREN)
-            {
-                // Reserves more memory if necessary
-                if(this->GetCount() == this->GetCapacity())
-                {
-                    pointer_uint_q uLastNodePosition = pCurrentNode - m_pNodeBasePointer;
-                    this->_ReallocateByFactor(this->GetCapacity() + 1U);
-                    pCurrentNode = m_pNodeBasePointer + uLastNodePosition;
-                }
+        return QNTree::QNTreeIterator(this, NEW_NODE_POSITION, parentNode.GetTraversalOrder());
+    }
+    
+    /// <summary>
+    /// Constructs a new element at the last position of the child node list, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the tree is empty, use the SetRootValue method.<br/>
+    /// If the parent node already has the maximum number of child nodes, the new element will not be added.<br/>
+    /// If the capacity of the tree is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called.
+    /// </remarks>
+    /// <param name="parentNode">[IN] An iterator that points to the parent node to which the element will be added as a child. It must not point to an end position.</param>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    /// <param name="argument2">[IN] The second argument to pass to the constructor of the element.</param>
+    /// <returns>
+    /// An iterator that points to the just added element. If it was not added, the iterator will point to an end position.
+    /// </returns>
+    template<class Argument1T, class Argument2T>
+    QNTreeIterator EmplaceChild(const typename QNTree::QConstNTreeIterator &parentNode, const Argument1T &argument1, const Argument2T &argument2)
+    {
+        const pointer_uint_q NEW_NODE_POSITION = this->_AllocateChild(parentNode);
 
-                // Adds the child to the end of the child list
-                QNTree::QNode* pNewNode = new(m_nodeAllocator.Allocate()) QNode(parentNode.GetInternalPosition(), 
-                                                                                QNTree::END_POSITION_FORWARD, 
-                                                                                pCurrentNode - m_pNodeBasePointer, 
-                                                                                QNTree::END_POSITION_FORWARD);
+        if(NEW_NODE_POSITION != QNTree::END_POSITION_FORWARD)
+            new(m_pElementBasePointer + NEW_NODE_POSITION) T(argument1, argument2);
 
-                uNewNodePosition = pNewNode - m_pNodeBasePointer;
-                pCurrentNode->SetNext(uNewNodePosition);
-                
-                // Copies the new element
-                new(m_elementAllocator.Allocate()) T(newElement);
-            }
-        }
-        else
-        {
-            // Reserves more memory if necessary
-            if(this->GetCount() == this->GetCapacity())
-            {
-                this->_ReallocateByFactor(this->GetCapacity() + 1U);
-                pParentNode = m_pNodeBasePointer + parentNode.GetInternalPosition();
-            }
+        return QNTree::QNTreeIterator(this, NEW_NODE_POSITION, parentNode.GetTraversalOrder());
+    }
+    
+    /// <summary>
+    /// Constructs a new element at the last position of the child node list, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the tree is empty, use the SetRootValue method.<br/>
+    /// If the parent node already has the maximum number of child nodes, the new element will not be added.<br/>
+    /// If the capacity of the tree is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called.
+    /// </remarks>
+    /// <param name="parentNode">[IN] An iterator that points to the parent node to which the element will be added as a child. It must not point to an end position.</param>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    /// <param name="argument2">[IN] The second argument to pass to the constructor of the element.</param>
+    /// <param name="argument3">[IN] The third argument to pass to the constructor of the element.</param>
+    /// <returns>
+    /// An iterator that points to the just added element. If it was not added, the iterator will point to an end position.
+    /// </returns>
+    template<class Argument1T, class Argument2T, class Argument3T>
+    QNTreeIterator EmplaceChild(const typename QNTree::QConstNTreeIterator &parentNode, const Argument1T &argument1, const Argument2T &argument2, const Argument3T &argument3)
+    {
+        const pointer_uint_q NEW_NODE_POSITION = this->_AllocateChild(parentNode);
 
-            // Adds the child as the first of the child list
-            QNTree::QNode* pNewNode = new(m_nodeAllocator.Allocate()) QNode(parentNode.GetInternalPosition(), 
-                                                                            QNTree::END_POSITION_FORWARD, 
-                                                                            QNTree::END_POSITION_FORWARD, 
-                                                                            QNTree::END_POSITION_FORWARD);
+        if(NEW_NODE_POSITION != QNTree::END_POSITION_FORWARD)
+            new(m_pElementBasePointer + NEW_NODE_POSITION) T(argument1, argument2, argument3);
 
-            uNewNodePosition = pNewNode - m_pNodeBasePointer;
-            pParentNode->SetFirstChild(uNewNodePosition);
+        return QNTree::QNTreeIterator(this, NEW_NODE_POSITION, parentNode.GetTraversalOrder());
+    }
+    
+    /// <summary>
+    /// Constructs a new element at the last position of the child node list, passing the input arguments to its constructor.
+    /// </summary>
+    /// <remarks>
+    /// If the tree is empty, use the SetRootValue method.<br/>
+    /// If the parent node already has the maximum number of child nodes, the new element will not be added.<br/>
+    /// If the capacity of the tree is exceeded, a reallocation will take place, which will make any existing pointer invalid.<br/>
+    /// The element is constructed in place, so no temporary object is created and no copy constructor is called.
+    /// </remarks>
+    /// <param name="parentNode">[IN] An iterator that points to the parent node to which the element will be added as a child. It must not point to an end position.</param>
+    /// <param name="argument1">[IN] The first argument to pass to the constructor of the element.</param>
+    /// <param name="argument2">[IN] The second argument to pass to the constructor of the element.</param>
+    /// <param name="argument3">[IN] The third argument to pass to the constructor of the element.</param>
+    /// <param name="argument4">[IN] The fourth argument to pass to the constructor of the element.</param>
+    /// <returns>
+    /// An iterator that points to the just added element. If it was not added, the iterator will point to an end position.
+    /// </returns>
+    template<class Argument1T, class Argument2T, class Argument3T, class Argument4T>
+    QNTreeIterator EmplaceChild(const typename QNTree::QConstNTreeIterator &parentNode, const Argument1T &argument1, const Argument2T &argument2, const Argument3T &argument3, const Argument4T &argument4)
+    {
+        const pointer_uint_q NEW_NODE_POSITION = this->_AllocateChild(parentNode);
 
-            // Copies the new element
-            new(m_elementAllocator.Allocate()) T(newElement);
-        }
+        if(NEW_NODE_POSITION != QNTree::END_POSITION_FORWARD)
+            new(m_pElementBasePointer + NEW_NODE_POSITION) T(argument1, argument2, argument3, argument4);
 
-        return QNTree::QNTreeIterator(this, uNewNodePosition, parentNode.GetTraversalOrder());
+        return QNTree::QNTreeIterator(this, NEW_NODE_POSITION, parentNode.GetTraversalOrder());
     }
     
     /// <summary>
@@ -2171,7 +2387,7 @@ public:
 
         // Reserves more memory if necessary
         if(this->GetCount() == this->GetCapacity())
-            this->_ReallocateByFactor(this->GetCapacity() + 1U);
+            this->_ReallocateByPolicy(this->GetCapacity() + 1U);
 
         // Gets node pointer and position
         QNTree::QNode* pParentNode = m_pNodeBasePointer + parentNode.GetInternalPosition();
@@ -2683,8 +2899,133 @@ public:
         memcpy(pElementB, arBytes,   sizeof(T));
     }
 
+    /// <summary>
+    /// Gets information about the memory usage and the shape of the tree.
+    /// </summary>
+    /// <remarks>
+    /// The height and the average depth are calculated by visiting every node, without using additional memory.
+    /// </remarks>
+    /// <returns>
+    /// The number of elements, the capacity, the bytes reserved and used by both the element allocator and the node allocator, the height and 
+    /// the average depth of the nodes.
+    /// </returns>
+    QContainerStatistics GetStatistics() const
+    {
+        pointer_uint_q uSumOfDepths = 0;
+        pointer_uint_q uMaximumDepth = 0;
+
+        // Depth-first traversal that uses the parent of every node to go back once all its children have been visited
+        pointer_uint_q uNode = m_uRoot;
+        pointer_uint_q uDepth = 0;
+        bool bDescending = true;
+
+        while(uNode != QNTree::END_POSITION_FORWARD)
+        {
+            const QNode* pNode = m_pNodeBasePointer + uNode;
+
+            if(bDescending)
+            {
+                uSumOfDepths += uDepth;
+
+                if(uDepth > uMaximumDepth)
+                    uMaximumDepth = uDepth;
+            }
+
+            if(bDescending && pNode->GetFirstChild() != QNTree::END_POSITION_FORWARD)
+            {
+                uNode = pNode->GetFirstChild();
+                ++uDepth;
+            }
+            else if(uNode != m_uRoot && pNode->GetNext() != QNTree::END_POSITION_FORWARD)
+            {
+                uNode = pNode->GetNext();
+                bDescending = true;
+            }
+            else
+            {
+                uNode = pNode->GetParent();
+                --uDepth;
+                bDescending = false;
+            }
+        }
+
+        QContainerStatistics statistics;
+        statistics.SetCount(this->GetCount());
+        statistics.SetCapacity(this->GetCapacity());
+        statistics.SetReservedBytes(m_elementAllocator.GetPoolSize() + m_nodeAllocator.GetPoolSize());
+        statistics.SetUsedBytes(m_elementAllocator.GetAllocatedBytes() + m_nodeAllocator.GetAllocatedBytes());
+
+        if(m_uRoot != QNTree::END_POSITION_FORWARD)
+        {
+            statistics.SetHeight(uMaximumDepth + 1U);
+            statistics.SetAverageDepth(scast_q(uSumOfDepths, float_q) / scast_q(this->GetCount(), float_q));
+        }
+
+        return statistics;
+    }
+
 private:
 
+    /// <summary>
+    /// Calculates the position every node would occupy if the nodes were stored in depth-first pre-order.
+    /// </summary>
+    /// <param name="arNewPositions">[OUT] The new position of every node, indexed by the current position. It must have as many elements as the capacity.</param>
+    /// <param name="arOldPositions">[OUT] The current position of every node, indexed by the new position. It must have as many elements as nodes in the tree.</param>
+    void _CalculatePreOrderPositions(pointer_uint_q* arNewPositions, pointer_uint_q* arOldPositions) const
+    {
+        pointer_uint_q uIndex = 0;
+        pointer_uint_q uCurrent = m_uRoot;
+
+        while(uCurrent != QNTree::END_POSITION_FORWARD)
+        {
+            arNewPositions[uCurrent] = uIndex;
+            arOldPositions[uIndex] = uCurrent;
+            ++uIndex;
+
+            if((m_pNodeBasePointer + uCurrent)->GetFirstChild() != QNTree::END_POSITION_FORWARD)
+            {
+                uCurrent = (m_pNodeBasePointer + uCurrent)->GetFirstChild();
+            }
+            else
+            {
+                // Goes up until an ancestor with a next sibling is found, or the root is reached
+                while(uCurrent != QNTree::END_POSITION_FORWARD && (m_pNodeBasePointer + uCurrent)->GetNext() == QNTree::END_POSITION_FORWARD)
+                    uCurrent = (m_pNodeBasePointer + uCurrent)->GetParent();
+
+                if(uCurrent != QNTree::END_POSITION_FORWARD)
+                    uCurrent = (m_pNodeBasePointer + uCurrent)->GetNext();
+            }
+        }
+    }
+
+    /// <summary>
+    /// Obtains the position a node will occupy in a container image, after the nodes are rearranged.
+    /// </summary>
+    /// <param name="uPosition">[IN] The current position of the node. It can be QNTree::END_POSITION_FORWARD.</param>
+    /// <param name="arNewPositions">[IN] The new position of every node, indexed by the current position.</param>
+    /// <returns>
+    /// The new position of the node, or QContainerImageHeader::NULL_POSITION if the input position is QNTree::END_POSITION_FORWARD.
+    /// </returns>
+    static Kinesis::QuimeraEngine::Common::DataTypes::u32_q _TranslateImagePosition(const pointer_uint_q uPosition, const pointer_uint_q* arNewPositions)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+        return uPosition == QNTree::END_POSITION_FORWARD ? QContainerImageHeader::NULL_POSITION : scast_q(arNewPositions[uPosition], u32_q);
+    }
+
+    /// <summary>
+    /// Obtains the position a node will occupy after the nodes are rearranged.
+    /// </summary>
+    /// <param name="uPosition">[IN] The current position of the node. It can be QNTree::END_POSITION_FORWARD.</param>
+    /// <param name="arNewPositions">[IN] The new position of every node, indexed by the current position.</param>
+    /// <returns>
+    /// The new position of the node, or QNTree::END_POSITION_FORWARD if the input position is QNTree::END_POSITION_FORWARD.
+    /// </returns>
+    static pointer_uint_q _TranslatePosition(const pointer_uint_q uPosition, const pointer_uint_q* arNewPositions)
+    {
+        return uPosition == QNTree::END_POSITION_FORWARD ? QNTree::END_POSITION_FORWARD : arNewPositions[uPosition];
+    }
+
     /// <summary>
     /// Updates the reference positions of all the nodes related to one given node.
     /// </summary>
@@ -2745,14 +3086,106 @@ private:
     }
 
     /// <summary>
-    /// Increases the capacity of the tree, reserving memory for more elements than necessary, depending on the reallocation factor.
+    /// Links a new node at the last position of the child node list and reserves the space of its element, without constructing it.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the tree is exceeded, a reallocation will take place.
+    /// </remarks>
+    /// <param name="parentNode">[IN] An iterator that points to the parent node to which the node will be added as a child. It must not point to an end position.</param>
+    /// <returns>
+    /// The position of the new node, which is the same as the position where its element must be constructed. If the parent node already has 
+    /// the maximum number of child nodes, the end position.
+    /// </returns>
+    pointer_uint_q _AllocateChild(const typename QNTree::QConstNTreeIterator &parentNode)
+    {
+        //        R
+        //       / \
+        //      0-...
+        //     /|\
+        //    0-1-2-X
+        //
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQInteger;
+        using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+
+        QE_ASSERT_ERROR(parentNode.IsValid(), "The input iterator is not valid.");
+        QE_ASSERT_ERROR(!parentNode.IsEnd(), "The input iterator must not point to an end position.");
+
+        // Gets node pointer and position
+        QNTree::QNode* pParentNode = m_pNodeBasePointer + parentNode.GetInternalPosition();
+        
+        pointer_uint_q uNewNodePosition = QNTree::END_POSITION_FORWARD;
+
+        // If the parent node has any child node
+        if(pParentNode->GetFirstChild() != QNTree::END_POSITION_FORWARD)
+        {
+            QNTree::QNode* pCurrentNode = m_pNodeBasePointer + pParentNode->GetFirstChild();
+            pointer_uint_q uNumberOfElements = 1U;
+
+            // Navigates to the last child node
+            while(pCurrentNode->GetNext() != QNTree::END_POSITION_FORWARD)
+            {
+                pCurrentNode = m_pNodeBasePointer + pCurrentNode->GetNext();
+                ++uNumberOfElements;
+            }
+
+            QE_ASSERT_ERROR(uNumberOfElements < this->MAX_CHILDREN, string_q("It is not possible to add another child to this node, maximum allowed exceeded (") + string_q::FromInteger(this->MAX_CHILDREN) + ").");
+
+            if(uNumberOfElements < this->MAX_CHILDREN)
+            {
+                // Reserves more memory if necessary
+                if(this->GetCount() == this->GetCapacity())
+                {
+                    pointer_uint_q uLastNodePosition = pCurrentNode - m_pNodeBasePointer;
+                    this->_ReallocateByPolicy(this->GetCapacity() + 1U);
+                    pCurrentNode = m_pNodeBasePointer + uLastNodePosition;
+                }
+
+                // Adds the child to the end of the child list
+                QNTree::QNode* pNewNode = new(m_nodeAllocator.Allocate()) QNode(parentNode.GetInternalPosition(), 
+                                                                                QNTree::END_POSITION_FORWARD, 
+                                                                                pCurrentNode - m_pNodeBasePointer, 
+                                                                                QNTree::END_POSITION_FORWARD);
+
+                uNewNodePosition = pNewNode - m_pNodeBasePointer;
+                pCurrentNode->SetNext(uNewNodePosition);
+                
+                // Reserves the space of the new element, which is constructed by the caller
+                m_elementAllocator.Allocate();
+            }
+        }
+        else
+        {
+            // Reserves more memory if necessary
+            if(this->GetCount() == this->GetCapacity())
+            {
+                this->_ReallocateByPolicy(this->GetCapacity() + 1U);
+                pParentNode = m_pNodeBasePointer + parentNode.GetInternalPosition();
+            }
+
+            // Adds the child as the first of the child list
+            QNTree::QNode* pNewNode = new(m_nodeAllocator.Allocate()) QNode(parentNode.GetInternalPosition(), 
+                                                                            QNTree::END_POSITION_FORWARD, 
+                                                                            QNTree::END_POSITION_FORWARD, 
+                                                                            QNTree::END_POSITION_FORWARD);
+
+            uNewNodePosition = pNewNode - m_pNodeBasePointer;
+            pParentNode->SetFirstChild(uNewNodePosition);
+
+            // Reserves the space of the new element, which is constructed by the caller
+            m_elementAllocator.Allocate();
+        }
+
+        return uNewNodePosition;
+    }
+
+    /// <summary>
+    /// Increases the capacity of the tree, reserving memory for more elements than necessary, depending on the growth policy.
     /// </summary>
     /// <param name="uNumberOfElements">[IN] The number of elements for which to reserve memory. It should be greater than the
     /// current capacity or nothing will happen.</param>
-    void _ReallocateByFactor(const pointer_uint_q uNumberOfElements)
+    void _ReallocateByPolicy(const pointer_uint_q uNumberOfElements)
     {
-        const pointer_uint_q FINAL_CAPACITY = scast_q(scast_q(uNumberOfElements, float) * QNTree::REALLOCATION_FACTOR, pointer_uint_q);
-        this->Reserve(FINAL_CAPACITY);
+        this->Reserve(GrowthPolicyT::GetNewCapacity(uNumberOfElements));
     }
 
 
@@ -2852,11 +3285,8 @@ protected:
 
 // ATTRIBUTE INITIALIZATION
 // ----------------------------
-template <class T, class AllocatorT, class ComparatorT>
-pointer_uint_q QNTree<T, AllocatorT, ComparatorT>::sm_uDefaultCapacity = 1;
-
-template<class T, class AllocatorT, class ComparatorT>
-float QNTree<T, AllocatorT, ComparatorT>::REALLOCATION_FACTOR = 1.5f;
+template <class T, class AllocatorT, class ComparatorT, class GrowthPolicyT>
+pointer_uint_q QNTree<T, AllocatorT, ComparatorT, GrowthPolicyT>::sm_uDefaultCapacity = 1;
 
 } //namespace Containers
 } //namespace Tools
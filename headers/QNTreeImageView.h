@@ -0,0 +1,262 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QNTREEIMAGEVIEW__
+#define __QNTREEIMAGEVIEW__
+
+#include "DataTypesDefinitions.h"
+#include "ToolsDefinitions.h"
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+#include "QContainerImageHeader.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Provides read-only access to the nodes and the elements of a tree image, written by QNTree::WriteImage.
+/// </summary>
+/// <remarks>
+/// The view does not copy nor deserialize the image, nodes and elements are read directly from the buffer, which may be a memory-mapped file.<br/>
+/// Nodes are identified by their position in depth-first pre-order, so the root is always at position zero and a whole subtree occupies 
+/// consecutive positions.<br/>
+/// The buffer is not owned by the view and must remain valid while the view is used. It must be aligned, at least, to the alignment of the elements, 
+/// which cannot be greater than 16 bytes since the elements are not padded in the image.
+/// </remarks>
+/// <typeparam name="T">The type of the elements stored in the image. It must be the same type used to write the image.</typeparam>
+template<class T>
+class QNTreeImageView
+{
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The position returned when a node does not exist.
+    /// </summary>
+    static const pointer_uint_q END_POSITION;
+
+protected:
+
+    /// <summary>
+    /// The number of 32-bits values that compose every node in the image.
+    /// </summary>
+    static const pointer_uint_q NODE_SIZE;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the image to read.
+    /// </summary>
+    /// <param name="pImage">[IN] The address of the first byte of the image. It must not be null and it must contain a tree image 
+    /// whose elements occupy the same size as T.</param>
+    explicit QNTreeImageView(const void* pImage) : m_pHeader(scast_q(pImage, const QContainerImageHeader*)),
+                                                   m_pNodes(rcast_q(scast_q(pImage, const u8_q*) + sizeof(QContainerImageHeader), const u32_q*)),
+                                                   m_pElements(null_q)
+    {
+        QE_ASSERT_ERROR(pImage != null_q, "The input image cannot be null.");
+        QE_ASSERT_ERROR(rcast_q(pImage, pointer_uint_q) % sizeof(u32_q) == 0 && rcast_q(pImage, pointer_uint_q) % alignof_q(T) == 0, 
+                        "The input image must be aligned, at least, to 4 bytes and to the alignment of the elements.");
+        QE_ASSERT_ERROR(m_pHeader->IsCompatible(QContainerImageHeader::CONTAINER_TYPE_NTREE, sizeof(T)), "The input buffer does not contain a tree image of elements of the expected type.");
+
+        m_pElements = rcast_q(m_pNodes + m_pHeader->GetCount() * QNTreeImageView::NODE_SIZE, const T*);
+        QE_ASSERT_ERROR(alignof_q(T) <= 16U, "The alignment of the elements cannot be greater than 16 bytes, since they are not padded in the image.");
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the element of a node.
+    /// </summary>
+    /// <param name="uNode">[IN] The position of the node. It must be lower than the number of elements.</param>
+    /// <returns>
+    /// A reference to the element, stored in the image.
+    /// </returns>
+    const T& GetValue(const pointer_uint_q uNode) const
+    {
+        QE_ASSERT_ERROR(uNode < this->GetCount(), "The input node does not exist.");
+
+        return m_pElements[uNode];
+    }
+
+    /// <summary>
+    /// Gets the parent of a node.
+    /// </summary>
+    /// <param name="uNode">[IN] The position of the node. It must be lower than the number of elements.</param>
+    /// <returns>
+    /// The position of the parent node. If the node is the root, it returns END_POSITION.
+    /// </returns>
+    pointer_uint_q GetParent(const pointer_uint_q uNode) const
+    {
+        return this->_GetLink(uNode, 0);
+    }
+
+    /// <summary>
+    /// Gets the next sibling of a node.
+    /// </summary>
+    /// <param name="uNode">[IN] The position of the node. It must be lower than the number of elements.</param>
+    /// <returns>
+    /// The position of the next sibling. If the node is the last child of its parent, it returns END_POSITION.
+    /// </returns>
+    pointer_uint_q GetNextSibling(const pointer_uint_q uNode) const
+    {
+        return this->_GetLink(uNode, 1U);
+    }
+
+    /// <summary>
+    /// Gets the previous sibling of a node.
+    /// </summary>
+    /// <param name="uNode">[IN] The position of the node. It must be lower than the number of elements.</param>
+    /// <returns>
+    /// The position of the previous sibling. If the node is the first child of its parent, it returns END_POSITION.
+    /// </returns>
+    pointer_uint_q GetPreviousSibling(const pointer_uint_q uNode) const
+    {
+        return this->_GetLink(uNode, 2U);
+    }
+
+    /// <summary>
+    /// Gets the first child of a node.
+    /// </summary>
+    /// <param name="uNode">[IN] The position of the node. It must be lower than the number of elements.</param>
+    /// <returns>
+    /// The position of the first child. If the node has no children, it returns END_POSITION.
+    /// </returns>
+    pointer_uint_q GetFirstChild(const pointer_uint_q uNode) const
+    {
+        return this->_GetLink(uNode, 3U);
+    }
+
+private:
+
+    /// <summary>
+    /// Gets one of the positions stored in a node.
+    /// </summary>
+    /// <param name="uNode">[IN] The position of the node. It must be lower than the number of elements.</param>
+    /// <param name="uLink">[IN] The index of the position in the node: 0 for the parent, 1 for the next sibling, 2 for the previous sibling and 3 for the first child.</param>
+    /// <returns>
+    /// The stored position, or END_POSITION if it does not refer to any node.
+    /// </returns>
+    pointer_uint_q _GetLink(const pointer_uint_q uNode, const pointer_uint_q uLink) const
+    {
+        QE_ASSERT_ERROR(uNode < this->GetCount(), "The input node does not exist.");
+
+        const u32_q LINK = m_pNodes[uNode * QNTreeImageView::NODE_SIZE + uLink];
+        return LINK == QContainerImageHeader::NULL_POSITION ? QNTreeImageView::END_POSITION : scast_q(LINK, pointer_uint_q);
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the root node of the tree.
+    /// </summary>
+    /// <returns>
+    /// The position of the root node, which is always zero. If the image is empty, it returns END_POSITION.
+    /// </returns>
+    pointer_uint_q GetRoot() const
+    {
+        return m_pHeader->GetRoot() == QContainerImageHeader::NULL_POSITION ? QNTreeImageView::END_POSITION : scast_q(m_pHeader->GetRoot(), pointer_uint_q);
+    }
+
+    /// <summary>
+    /// Gets the number of elements in the image.
+    /// </summary>
+    /// <returns>
+    /// The number of elements.
+    /// </returns>
+    pointer_uint_q GetCount() const
+    {
+        return m_pHeader->GetCount();
+    }
+
+    /// <summary>
+    /// Indicates whether the image is empty.
+    /// </summary>
+    /// <returns>
+    /// True if there are no elements in the image; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_pHeader->GetCount() == 0;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The header at the beginning of the image.
+    /// </summary>
+    const QContainerImageHeader* m_pHeader;
+
+    /// <summary>
+    /// The first value of the first node, right after the header.
+    /// </summary>
+    const u32_q* m_pNodes;
+
+    /// <summary>
+    /// The first element of the image, right after the nodes.
+    /// </summary>
+    const T* m_pElements;
+
+};
+
+
+// ATTRIBUTE INITIALIZATION
+// ----------------------------
+template<class T>
+const pointer_uint_q QNTreeImageView<T>::END_POSITION = -1;
+
+template<class T>
+const pointer_uint_q QNTreeImageView<T>::NODE_SIZE = 4U;
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QNTREEIMAGEVIEW__
@@ -48,6 +48,11 @@ namespace Memory
 /// Represents a custom allocator that works as a pool, providing a limited set of fixed-size and fixed-alignment blocks
 /// that are occupied and released as demanded.
 /// </summary>
+/// <remarks>
+/// By default, the list of free blocks is stored in a separate buffer, one pointer per block. Optionally, the list can be stored in the free blocks 
+/// themselves (intrusive free list) when a pointer fits in a block, which removes that buffer and the access to a second memory location in every 
+/// allocation. Blocks that have never been allocated are not linked; they are taken in ascending order, so clearing the pool does not write to it.
+/// </remarks>
 class QE_LAYER_COMMON_SYMBOLS QPoolAllocator
 {
     // CONSTRUCTORS
@@ -66,6 +71,21 @@ public:
     /// <param name="alignment">[IN] Multiple of which must be the memory address. All the blocks will have the same alignment.</param>
     QPoolAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const QAlignment &alignment); 
 
+    /// <summary>
+    /// Constructs a pool allocator passing the pool size, block size, memory alignment and whether the list of free blocks is stored in the blocks.
+    /// </summary>
+    /// <remarks>
+    /// Pre-allocates uSize bytes. If the list of free blocks is not stored in the blocks, it also allocates (uSize/uBlockSize)*sizeof(void**) bytes for internals.<br/>
+    /// While a block is free, its first sizeof(void**) bytes are overwritten by the allocator when using an intrusive free list.<br/>
+    /// Invalid values of the parameters may cause an unexpected behaviour.
+    /// </remarks>
+    /// <param name="uSize">[IN] Size of the pool, in bytes. It must be greater than zero.</param>
+    /// <param name="uBlockSize">[IN] Size of each block to allocate, in bytes. It must be greater than zero.</param>
+    /// <param name="alignment">[IN] Multiple of which must be the memory address. All the blocks will have the same alignment.</param>
+    /// <param name="bUseIntrusiveFreeList">[IN] Whether the list of free blocks is stored in the free blocks. It is ignored if the block size 
+    /// is lower than sizeof(void**), in which case a separate buffer is used.</param>
+    QPoolAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const QAlignment &alignment, const bool bUseIntrusiveFreeList); 
+
     /// <summary>
     /// Constructs a pool allocator passing the pool size, block size and memory address of a valid buffer to be used by the pool.
     /// </summary>
@@ -95,6 +115,26 @@ public:
     /// <param name="alignment">[IN] Multiple of which must be the memory address. All the blocks will have the same alignment.</param>
     QPoolAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const void *pBuffer, const QAlignment &alignment); 
 
+    /// <summary>
+    /// Constructs a pool allocator passing the pool size, blocks size, memory address of a valid buffer to be used by the pool, the alignment and 
+    /// whether the list of free blocks is stored in the blocks.
+    /// </summary>
+    /// <remarks>
+    /// It uses the passed buffer to allocate blocks. If the list of free blocks is not stored in the blocks, it also allocates a maximum of 
+    /// (uSize/uBlockSize)*sizeof(void**) bytes for internals; otherwise, it does not allocate any memory.<br/>
+    /// The buffer may not start exactly at the memory address passed as parameter due to the alignment adjustment. This will cause that the size may not be 
+    /// exactly what was passed as parameter.<br/>
+    /// Destructor will not free the buffer passed for the pool.
+    /// Invalid values of the parameters may cause an unexpected behaviour.
+    /// </remarks>
+    /// <param name="uSize">[IN] Size of the pool, in bytes. It must be greater than zero.</param>
+    /// <param name="uBlockSize">[IN] Size of each block to allocate, in bytes. It must be greater than zero.</param>
+    /// <param name="pBuffer">[IN] Pointer to an allocated buffer of size greater than or equal to the size passed in the parameter.</param>
+    /// <param name="alignment">[IN] Multiple of which must be the memory address. All the blocks will have the same alignment.</param>
+    /// <param name="bUseIntrusiveFreeList">[IN] Whether the list of free blocks is stored in the free blocks. It is ignored if the block size 
+    /// is lower than sizeof(void**), in which case a separate buffer is used.</param>
+    QPoolAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const void *pBuffer, const QAlignment &alignment, const bool bUseIntrusiveFreeList); 
+
 private:
 
     // Disabled.
@@ -140,6 +180,7 @@ public:
     /// <remarks>
     /// The size of destination pool allocator must be greater or equal than the size of the source pool. 
     /// The block size of the destination pool allocator must be equal than the source block size.<br />
+    /// Both allocators must store the list of free blocks in the same way (intrusive or not).<br />
     /// If the amount of blocks of the destination pool is greater than source pool's, exceeding blocks will be appended to the list of free blocks.
     /// </remarks>
     /// <param name="poolAllocator">[IN/OUT] The destination allocator.</param>
@@ -166,6 +207,18 @@ public:
     /// <param name="pNewLocation">[IN] The new memory address where the new block will be reserved. It must not be null, or no reallocation will be done.</param>
     void Reallocate(const pointer_uint_q uNewSize, const void* pNewLocation);
 
+    /// <summary>
+    /// Moves the allocated data to a smaller memory block at a different memory address, releasing the blocks at the end of the pool.
+    /// </summary>
+    /// <remarks>
+    /// The new address will be resolved by the system. The internal buffer's memory address will be adjusted to the same alignment.<br/>
+    /// The blocks that are kept preserve their position relative to the start of the pool, so all the blocks that lie beyond the new size 
+    /// must be free; otherwise, no action will be performed. The order of the remaining free blocks is preserved.
+    /// </remarks>
+    /// <param name="uNewSize">[IN] The new size of the pool, in bytes. It must be lower than the current size of the pool and greater than or 
+    /// equal to the size of a block; otherwise, no action will be performed.</param>
+    void Shrink(const pointer_uint_q uNewSize);
+
 
 private:
 
@@ -190,6 +243,17 @@ private:
     /// <param name="pNewLocation">[IN] The new memory address where the new block will be reserved. It must not be null, or no reallocation will be done.</param>
     void InternalReallocate(const pointer_uint_q uNewSize, void* pNewLocation);
 
+    /// <summary>
+    /// Links the free blocks of the intrusive free list in a buffer that contains a copy of the blocks, in the same order. Blocks keep their position 
+    /// relative to the start of the buffer.
+    /// </summary>    
+    /// <param name="pDestinationFirst">[IN] The first block of the destination buffer.</param>
+    /// <param name="uDestinationBlocksCount">[IN] The number of blocks in the destination buffer. Free blocks beyond it are skipped.</param>
+    /// <returns>
+    /// The first free block in the destination buffer, or null if there are no free blocks to link.
+    /// </returns>
+    void** CopyIntrusiveFreeList(void* pDestinationFirst, const pointer_uint_q uDestinationBlocksCount) const;
+
 
     // PROPERTIES
     // ---------------
@@ -226,7 +290,7 @@ public:
     /// </returns>
     inline bool CanAllocate() const
     {
-        return null_q != m_ppNextFreeBlock;
+        return null_q != m_ppNextFreeBlock || (m_bIntrusiveFreeList && m_uFirstUnusedBlock < m_uBlocksCount);
     }
 
     /// <summary>
@@ -262,17 +326,28 @@ public:
         return m_uAlignment;
     }
 
+    /// <summary>
+    /// Indicates whether the list of free blocks is stored in the free blocks themselves.
+    /// </summary>        
+    /// <returns>
+    /// True if the free list is intrusive; False if it is stored in a separate buffer.
+    /// </returns>        
+    inline bool IsFreeListIntrusive() const
+    {
+        return m_bIntrusiveFreeList;
+    }
+
 
     // ATTRIBUTES
     // ---------------
 protected:
     /// <summary>
-    /// Pointer to the chunk containing pointers to the free blocks of the pool.
+    /// Pointer to the chunk containing pointers to the free blocks of the pool. It is null when the free list is intrusive.
     /// </summary>        
     void** m_ppFreeBlocks;
 
     /// <summary>
-    /// Pointer to the block containing the pointer to the next free block.
+    /// Pointer to the block containing the pointer to the next free block. When the free list is intrusive, it is the first free block itself.
     /// </summary>        
     void** m_ppNextFreeBlock;
 
@@ -329,6 +404,16 @@ private:
     /// Otherwise True and memory buffer needs to be destroyed.
     /// </summary>    
     bool m_bNeedDestroyMemoryChunk;
+
+    /// <summary>
+    /// Index of the first block that has never been allocated since the pool was created or cleared. Only used when the free list is intrusive.
+    /// </summary>    
+    pointer_uint_q m_uFirstUnusedBlock;
+
+    /// <summary>
+    /// Whether the list of free blocks is stored in the free blocks themselves.
+    /// </summary>    
+    bool m_bIntrusiveFreeList;
 };
 
 } //namespace Memory
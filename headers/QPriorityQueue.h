@@ -0,0 +1,464 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QPRIORITYQUEUE__
+#define __QPRIORITYQUEUE__
+
+#include "ToolsDefinitions.h"
+#include "QArrayDynamic.h"
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Represents a collection of elements from which the lowest one is always extracted first, according to a comparator.
+/// </summary>
+/// <remarks>
+/// Elements are stored in an implicit heap, contiguously in a dynamic array, so adding or extracting an element does not allocate nodes and 
+/// its cost is logarithmic. Every element has, at most, ARITY children; wider heaps are shallower, which makes extractions touch less cache lines 
+/// when there are many elements, at the cost of more comparisons per level. The top element is always the lowest one; in order to extract 
+/// the greatest element first, use a comparator that inverts the order.<br/>
+/// Every element added to the queue is identified by a handle, which keeps referring to the same element while it moves in the heap. Handles are 
+/// used to decrease the value of an element, so the queue can be used in algorithms like Dijkstra's. The handle of an extracted element may 
+/// be reused by elements added later.<br/>
+/// Elements are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.<br/>
+/// If SQComparatorDefault is used as comparator, elements will be forced to implement operators "==" and "<".
+/// </remarks>
+/// <typeparam name="T">The type of every element in the queue.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The type of allocator to store the elements of the queue. By default, QPoolAllocator will
+/// be used.</typeparam>
+/// <typeparam name="ComparatorT">Optional. The type of comparator to compare elements to each other, which determines the order in which 
+/// they are extracted. By default, SQComparatorDefault will be used.</typeparam>
+/// <typeparam name="ARITY">Optional. The maximum number of children of every element in the heap. It must be greater than one. By default, 
+/// the heap is binary; 4 is recommended for queues with many elements.</typeparam>
+template<class T, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, class ComparatorT = SQComparatorDefault<T>, pointer_uint_q ARITY = 2U>
+class QPriorityQueue
+{
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The value stored in the position of a free handle when there are no more free handles after it.
+    /// </summary>
+    static const pointer_uint_q END_OF_FREE_HANDLES;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    /// <remarks>
+    /// The initial capacity depends on the value of the default initial capacity of QArrayDynamic.
+    /// </remarks>
+    QPriorityQueue() : m_uFirstFreeHandle(QPriorityQueue::END_OF_FREE_HANDLES)
+    {
+        QE_ASSERT_ERROR(ARITY > 1U, "The arity of the heap must be greater than one.");
+    }
+
+    /// <summary>
+    /// Constructor that receives the initial capacity.
+    /// </summary>
+    /// <param name="uInitialCapacity">[IN] The number of elements for which to reserve memory. It must be greater than zero.</param>
+    explicit QPriorityQueue(const pointer_uint_q uInitialCapacity) : m_arElements(uInitialCapacity),
+                                                                     m_arHandles(uInitialCapacity),
+                                                                     m_arPositions(uInitialCapacity),
+                                                                     m_uFirstFreeHandle(QPriorityQueue::END_OF_FREE_HANDLES)
+    {
+        QE_ASSERT_ERROR(ARITY > 1U, "The arity of the heap must be greater than one.");
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Adds a copy of an element to the queue.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the queue is exceeded, a reallocation will take place.<br/>
+    /// The copy constructor of the element will be called; the assignment operator will be called for every element moved in the heap.
+    /// </remarks>
+    /// <param name="newElement">[IN] The element to add.</param>
+    /// <returns>
+    /// The handle that identifies the element while it is in the queue.
+    /// </returns>
+    pointer_uint_q Push(const T &newElement)
+    {
+        pointer_uint_q uHandle = m_uFirstFreeHandle;
+
+        if(uHandle == QPriorityQueue::END_OF_FREE_HANDLES)
+        {
+            uHandle = m_arPositions.GetCount();
+            m_arPositions.Add(0);
+        }
+        else
+        {
+            // Free handles store the next free handle instead of a position
+            m_uFirstFreeHandle = m_arPositions[uHandle];
+        }
+
+        m_arElements.Add(newElement);
+        m_arHandles.Add(uHandle);
+        this->_SiftUp(m_arElements.GetCount() - 1U);
+
+        return uHandle;
+    }
+
+    /// <summary>
+    /// Removes the top element, which is the lowest one, from the queue.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of the element will be called; the assignment operator will be called for every element moved in the heap.<br/>
+    /// The handle of the element becomes invalid and may be returned again by Push.
+    /// </remarks>
+    void Pop()
+    {
+        QE_ASSERT_ERROR(!this->IsEmpty(), "The queue is empty, there is nothing to remove.");
+
+        const pointer_uint_q LAST_POSITION = m_arElements.GetCount() - 1U;
+        const pointer_uint_q REMOVED_HANDLE = m_arHandles[0];
+
+        // The last element replaces the top and then sinks to its place
+        if(LAST_POSITION > 0)
+        {
+            m_arElements[0] = m_arElements[LAST_POSITION];
+            m_arHandles[0] = m_arHandles[LAST_POSITION];
+        }
+
+        m_arElements.Remove(LAST_POSITION);
+        m_arHandles.Remove(LAST_POSITION);
+
+        m_arPositions[REMOVED_HANDLE] = m_uFirstFreeHandle;
+        m_uFirstFreeHandle = REMOVED_HANDLE;
+
+        if(LAST_POSITION > 0)
+            this->_SiftDown(0);
+    }
+
+    /// <summary>
+    /// Replaces an element of the queue with a lower or equal value, moving it towards the top if necessary.
+    /// </summary>
+    /// <remarks>
+    /// The assignment operator will be called for the element and for every element moved in the heap.
+    /// </remarks>
+    /// <param name="uHandle">[IN] The handle of the element, returned by Push. It must refer to an element that is in the queue.</param>
+    /// <param name="newValue">[IN] The new value of the element. It must not be greater than the current value.</param>
+    void DecreaseKey(const pointer_uint_q uHandle, const T &newValue)
+    {
+        QE_ASSERT_ERROR(this->_IsValidHandle(uHandle), "The handle does not refer to any element in the queue.");
+
+        const pointer_uint_q POSITION = m_arPositions[uHandle];
+
+        QE_ASSERT_ERROR(ComparatorT::Compare(newValue, m_arElements[POSITION]) <= 0, "The new value must not be greater than the current value of the element.");
+
+        m_arElements[POSITION] = newValue;
+        this->_SiftUp(POSITION);
+    }
+
+    /// <summary>
+    /// Replaces the content of the queue with copies of the elements of an array, reorganizing them in linear time.
+    /// </summary>
+    /// <remarks>
+    /// Building the heap at once is faster than adding the elements one by one.<br/>
+    /// The handle of every element is its index in the input array. Any previous handle becomes invalid.<br/>
+    /// The destructor of every previous element and the copy constructor of every new element will be called.
+    /// </remarks>
+    /// <param name="arElements">[IN] The array whose elements will be copied.</param>
+    void Heapify(const QArrayFixed<T, AllocatorT, ComparatorT> &arElements)
+    {
+        const pointer_uint_q COUNT = arElements.GetCount();
+
+        this->Clear();
+        this->Reserve(COUNT);
+        m_arElements = arElements;
+
+        for(pointer_uint_q i = 0; i < COUNT; ++i)
+        {
+            m_arHandles.Add(i);
+            m_arPositions.Add(i);
+        }
+
+        // Leaves are already heaps, every parent is sunk from the last one to the top
+        if(COUNT > 1U)
+        {
+            for(pointer_uint_q uParent = (COUNT - 2U) / ARITY + 1U; uParent > 0; --uParent)
+                this->_SiftDown(uParent - 1U);
+        }
+    }
+
+    /// <summary>
+    /// Increases the capacity of the queue, reserving memory for more elements.
+    /// </summary>
+    /// <param name="uNumberOfElements">[IN] The number of elements for which to reserve memory. It should be greater than the current capacity or nothing will happen.</param>
+    void Reserve(const pointer_uint_q uNumberOfElements)
+    {
+        m_arElements.Reserve(uNumberOfElements);
+        m_arHandles.Reserve(uNumberOfElements);
+        m_arPositions.Reserve(uNumberOfElements);
+    }
+
+    /// <summary>
+    /// Removes all the elements of the queue.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every element will be called. Every handle becomes invalid.
+    /// </remarks>
+    void Clear()
+    {
+        m_arElements.Clear();
+        m_arHandles.Clear();
+        m_arPositions.Clear();
+        m_uFirstFreeHandle = QPriorityQueue::END_OF_FREE_HANDLES;
+    }
+
+private:
+
+    /// <summary>
+    /// Moves an element towards the top of the heap while it is lower than its parent.
+    /// </summary>
+    /// <remarks>
+    /// Parents are moved down instead of swapped, so the element is only written once, at its final position.
+    /// </remarks>
+    /// <param name="uPosition">[IN] The position of the element in the heap.</param>
+    void _SiftUp(pointer_uint_q uPosition)
+    {
+        // The buffers are accessed directly to avoid checking the bounds on every access
+        T* arElements = &m_arElements[0];
+        pointer_uint_q* arHandles = &m_arHandles[0];
+        pointer_uint_q* arPositions = &m_arPositions[0];
+
+        const T ELEMENT = arElements[uPosition];
+        const pointer_uint_q HANDLE = arHandles[uPosition];
+
+        while(uPosition > 0)
+        {
+            const pointer_uint_q PARENT = (uPosition - 1U) / ARITY;
+
+            if(ComparatorT::Compare(ELEMENT, arElements[PARENT]) >= 0)
+                break;
+
+            arElements[uPosition] = arElements[PARENT];
+            arHandles[uPosition] = arHandles[PARENT];
+            arPositions[arHandles[uPosition]] = uPosition;
+            uPosition = PARENT;
+        }
+
+        arElements[uPosition] = ELEMENT;
+        arHandles[uPosition] = HANDLE;
+        arPositions[HANDLE] = uPosition;
+    }
+
+    /// <summary>
+    /// Moves an element towards the bottom of the heap while any of its children is lower than it.
+    /// </summary>
+    /// <remarks>
+    /// The lowest child is moved up instead of swapped, so the element is only written once, at its final position.
+    /// </remarks>
+    /// <param name="uPosition">[IN] The position of the element in the heap.</param>
+    void _SiftDown(pointer_uint_q uPosition)
+    {
+        // The buffers are accessed directly to avoid checking the bounds on every access
+        T* arElements = &m_arElements[0];
+        pointer_uint_q* arHandles = &m_arHandles[0];
+        pointer_uint_q* arPositions = &m_arPositions[0];
+
+        const T ELEMENT = arElements[uPosition];
+        const pointer_uint_q HANDLE = arHandles[uPosition];
+        const pointer_uint_q COUNT = m_arElements.GetCount();
+
+        pointer_uint_q uFirstChild = uPosition * ARITY + 1U;
+
+        while(uFirstChild < COUNT)
+        {
+            const pointer_uint_q LAST_CHILD = uFirstChild + ARITY < COUNT ? uFirstChild + ARITY : COUNT;
+            pointer_uint_q uLowestChild = uFirstChild;
+
+            for(pointer_uint_q uChild = uFirstChild + 1U; uChild < LAST_CHILD; ++uChild)
+            {
+                if(ComparatorT::Compare(arElements[uChild], arElements[uLowestChild]) < 0)
+                    uLowestChild = uChild;
+            }
+
+            if(ComparatorT::Compare(arElements[uLowestChild], ELEMENT) >= 0)
+                break;
+
+            arElements[uPosition] = arElements[uLowestChild];
+            arHandles[uPosition] = arHandles[uLowestChild];
+            arPositions[arHandles[uPosition]] = uPosition;
+            uPosition = uLowestChild;
+            uFirstChild = uPosition * ARITY + 1U;
+        }
+
+        arElements[uPosition] = ELEMENT;
+        arHandles[uPosition] = HANDLE;
+        arPositions[HANDLE] = uPosition;
+    }
+
+    /// <summary>
+    /// Checks whether a handle refers to an element that is in the queue.
+    /// </summary>
+    /// <param name="uHandle">[IN] A handle.</param>
+    /// <returns>
+    /// True if the handle is valid; False otherwise.
+    /// </returns>
+    bool _IsValidHandle(const pointer_uint_q uHandle) const
+    {
+        // Free handles store the next free handle, which cannot be the position of an element whose handle is the same
+        return uHandle < m_arPositions.GetCount() && 
+               m_arPositions[uHandle] < m_arHandles.GetCount() && 
+               m_arHandles[m_arPositions[uHandle]] == uHandle;
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the top element, which is the lowest one in the queue.
+    /// </summary>
+    /// <returns>
+    /// A constant reference to the top element. It must not be modified, use DecreaseKey instead.
+    /// </returns>
+    const T& GetTop() const
+    {
+        QE_ASSERT_ERROR(!this->IsEmpty(), "The queue is empty, there is no top element.");
+
+        return m_arElements[0];
+    }
+
+    /// <summary>
+    /// Gets the handle of the top element, which is the lowest one in the queue.
+    /// </summary>
+    /// <returns>
+    /// The handle of the top element.
+    /// </returns>
+    pointer_uint_q GetTopHandle() const
+    {
+        QE_ASSERT_ERROR(!this->IsEmpty(), "The queue is empty, there is no top element.");
+
+        return m_arHandles[0];
+    }
+
+    /// <summary>
+    /// Gets the element identified by a handle.
+    /// </summary>
+    /// <param name="uHandle">[IN] The handle of the element, returned by Push. It must refer to an element that is in the queue.</param>
+    /// <returns>
+    /// A constant reference to the element. It must not be modified, use DecreaseKey instead.
+    /// </returns>
+    const T& GetValue(const pointer_uint_q uHandle) const
+    {
+        QE_ASSERT_ERROR(this->_IsValidHandle(uHandle), "The handle does not refer to any element in the queue.");
+
+        return m_arElements[m_arPositions[uHandle]];
+    }
+
+    /// <summary>
+    /// Gets the number of elements in the queue.
+    /// </summary>
+    /// <returns>
+    /// The number of elements.
+    /// </returns>
+    pointer_uint_q GetCount() const
+    {
+        return m_arElements.GetCount();
+    }
+
+    /// <summary>
+    /// Gets the number of elements for which memory has been reserved.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the queue.
+    /// </returns>
+    pointer_uint_q GetCapacity() const
+    {
+        return m_arElements.GetCapacity();
+    }
+
+    /// <summary>
+    /// Indicates whether the queue is empty or not.
+    /// </summary>
+    /// <returns>
+    /// True if the queue is empty; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_arElements.IsEmpty();
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The elements, ordered as an implicit heap whose top is at position zero.
+    /// </summary>
+    QArrayDynamic<T, AllocatorT, ComparatorT> m_arElements;
+
+    /// <summary>
+    /// The handle of every element, at the same position as the element.
+    /// </summary>
+    QArrayDynamic<pointer_uint_q, AllocatorT> m_arHandles;
+
+    /// <summary>
+    /// The position in the heap of the element of every handle. For free handles, it contains the next free handle.
+    /// </summary>
+    QArrayDynamic<pointer_uint_q, AllocatorT> m_arPositions;
+
+    /// <summary>
+    /// The first handle of the list of free handles.
+    /// </summary>
+    pointer_uint_q m_uFirstFreeHandle;
+};
+
+
+// ATTRIBUTE INITIALIZATION
+// ----------------------------
+template<class T, class AllocatorT, class ComparatorT, pointer_uint_q ARITY>
+const pointer_uint_q QPriorityQueue<T, AllocatorT, ComparatorT, ARITY>::END_OF_FREE_HANDLES = -1;
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QPRIORITYQUEUE__
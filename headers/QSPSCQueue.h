@@ -0,0 +1,438 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QSPSCQUEUE__
+#define __QSPSCQUEUE__
+
+#include "SystemDefinitions.h"
+
+#include <boost/atomic.hpp>
+#include "QLinearAllocator.h"
+#include "QAlignment.h"
+#include "QMutex.h"
+#include "QScopedExclusiveLock.h"
+#include "QConditionVariable.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+using Kinesis::QuimeraEngine::Common::Memory::QLinearAllocator;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+/// <summary>
+/// Represents a bounded first-in first-out queue that one thread fills while another thread empties it, without locking.
+/// </summary>
+/// <remarks>
+/// Elements are stored in a ring buffer of fixed capacity, whose memory is reserved by a linear allocator when the queue is created, aligned to the size of a cache line. 
+/// The position where the producer writes and the position where the consumer reads are atomic counters placed in different cache lines; besides, every thread keeps 
+/// a copy of the other thread's counter and only reads the shared one when the copy says the queue is full or empty, respectively. This way, the producer and 
+/// the consumer rarely touch the same cache lines.<br/>
+/// Only one thread can add elements and only one thread can extract them at the same time, although they may be different threads during the lifetime of the queue 
+/// as long as there is a synchronization point in between. Use QMPMCQueue when there are several producers or consumers.<br/>
+/// TryPush and TryPop never block. Push and Pop make the thread wait, using a condition variable, while the queue is full or empty, respectively; the mutex 
+/// is only locked when a thread has to wait or there is a thread waiting.<br/>
+/// Elements are copied into the queue when they are added, and copied out and destroyed when they are extracted.<br/>
+/// This class is thread-safe under the restrictions mentioned above.
+/// </remarks>
+/// <typeparam name="T">The type of the elements in the queue. Its alignment must not be greater than the size of a cache line.</typeparam>
+template<class T>
+class QSPSCQueue
+{
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The size, in bytes, of a cache line. The buffer of the queue is aligned to it and the counters are separated by it.
+    /// </summary>
+    static const pointer_uint_q CACHE_LINE_SIZE = 64U;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the capacity of the queue.
+    /// </summary>
+    /// <param name="uCapacity">[IN] The maximum number of elements the queue can store. It must be a power of two greater than one.</param>
+    explicit QSPSCQueue(const pointer_uint_q uCapacity) : m_allocator(uCapacity * sizeof(T), QAlignment(QSPSCQueue::CACHE_LINE_SIZE)),
+                                                          m_arElements(null_q),
+                                                          m_uCapacity(uCapacity),
+                                                          m_uTail(0),
+                                                          m_uCachedHead(0),
+                                                          m_uHead(0),
+                                                          m_uCachedTail(0),
+                                                          m_uWaitingProducers(0),
+                                                          m_uWaitingConsumers(0)
+    {
+        QE_ASSERT_ERROR(uCapacity > 1U && (uCapacity & (uCapacity - 1U)) == 0, "The capacity must be a power of two greater than one.");
+
+        m_arElements = scast_q(m_allocator.Allocate(uCapacity * sizeof(T)), T*);
+    }
+
+private:
+
+    // Disabled.
+    QSPSCQueue(const QSPSCQueue &);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every element that remains in the queue will be called. No thread may be using the queue.
+    /// </remarks>
+    ~QSPSCQueue()
+    {
+        const pointer_uint_q TAIL = m_uTail.load(boost::memory_order_relaxed);
+
+        for(pointer_uint_q uPosition = m_uHead.load(boost::memory_order_relaxed); uPosition != TAIL; ++uPosition)
+            m_arElements[uPosition & (m_uCapacity - 1U)].~T();
+    }
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Disabled.
+    QSPSCQueue& operator=(const QSPSCQueue &);
+
+public:
+
+    /// <summary>
+    /// Adds a copy of an element to the end of the queue, if it is not full.
+    /// </summary>
+    /// <remarks>
+    /// It must only be called by the producer thread. It never blocks.<br/>
+    /// The copy constructor of the element will be called.
+    /// </remarks>
+    /// <param name="value">[IN] The element to add.</param>
+    /// <returns>
+    /// True if the element was added; False if the queue was full.
+    /// </returns>
+    bool TryPush(const T &value)
+    {
+        const bool ELEMENT_ADDED = this->_TryPush(value);
+
+        if(ELEMENT_ADDED)
+            this->_NotifyWaitingThreads(m_uWaitingConsumers, m_notEmptyCondition);
+
+        return ELEMENT_ADDED;
+    }
+
+    /// <summary>
+    /// Adds a copy of an element to the end of the queue, waiting for the consumer to extract an element if it is full.
+    /// </summary>
+    /// <remarks>
+    /// It must only be called by the producer thread.<br/>
+    /// The copy constructor of the element will be called.
+    /// </remarks>
+    /// <param name="value">[IN] The element to add.</param>
+    void Push(const T &value)
+    {
+        if(!this->_TryPush(value))
+        {
+            QScopedExclusiveLock<QMutex> lock(m_mutex);
+            m_uWaitingProducers.fetch_add(1U, boost::memory_order_relaxed);
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+
+            while(!this->_TryPush(value))
+                m_notFullCondition.Wait(lock);
+
+            m_uWaitingProducers.fetch_sub(1U, boost::memory_order_relaxed);
+        }
+
+        this->_NotifyWaitingThreads(m_uWaitingConsumers, m_notEmptyCondition);
+    }
+
+    /// <summary>
+    /// Extracts the element at the front of the queue, if it is not empty.
+    /// </summary>
+    /// <remarks>
+    /// It must only be called by the consumer thread. It never blocks.<br/>
+    /// The assignment operator and the destructor of the element will be called.
+    /// </remarks>
+    /// <param name="value">[OUT] The extracted element. If the queue is empty, it is not modified.</param>
+    /// <returns>
+    /// True if an element was extracted; False if the queue was empty.
+    /// </returns>
+    bool TryPop(T &value)
+    {
+        const bool ELEMENT_EXTRACTED = this->_TryPop(value);
+
+        if(ELEMENT_EXTRACTED)
+            this->_NotifyWaitingThreads(m_uWaitingProducers, m_notFullCondition);
+
+        return ELEMENT_EXTRACTED;
+    }
+
+    /// <summary>
+    /// Extracts the element at the front of the queue, waiting for the producer to add an element if it is empty.
+    /// </summary>
+    /// <remarks>
+    /// It must only be called by the consumer thread.<br/>
+    /// The assignment operator and the destructor of the element will be called.
+    /// </remarks>
+    /// <param name="value">[OUT] The extracted element.</param>
+    void Pop(T &value)
+    {
+        if(!this->_TryPop(value))
+        {
+            QScopedExclusiveLock<QMutex> lock(m_mutex);
+            m_uWaitingConsumers.fetch_add(1U, boost::memory_order_relaxed);
+            boost::atomic_thread_fence(boost::memory_order_seq_cst);
+
+            while(!this->_TryPop(value))
+                m_notEmptyCondition.Wait(lock);
+
+            m_uWaitingConsumers.fetch_sub(1U, boost::memory_order_relaxed);
+        }
+
+        this->_NotifyWaitingThreads(m_uWaitingProducers, m_notFullCondition);
+    }
+
+private:
+
+    /// <summary>
+    /// Adds a copy of an element to the end of the queue, if it is not full, without notifying any waiting thread.
+    /// </summary>
+    /// <param name="value">[IN] The element to add.</param>
+    /// <returns>
+    /// True if the element was added; False if the queue was full.
+    /// </returns>
+    bool _TryPush(const T &value)
+    {
+        const pointer_uint_q TAIL = m_uTail.load(boost::memory_order_relaxed);
+
+        // The shared head is only read when the cached one says the queue is full
+        if(TAIL - m_uCachedHead == m_uCapacity)
+        {
+            m_uCachedHead = m_uHead.load(boost::memory_order_acquire);
+
+            if(TAIL - m_uCachedHead == m_uCapacity)
+                return false;
+        }
+
+        new(&m_arElements[TAIL & (m_uCapacity - 1U)]) T(value);
+        m_uTail.store(TAIL + 1U, boost::memory_order_release);
+
+        return true;
+    }
+
+    /// <summary>
+    /// Extracts the element at the front of the queue, if it is not empty, without notifying any waiting thread.
+    /// </summary>
+    /// <param name="value">[OUT] The extracted element. If the queue is empty, it is not modified.</param>
+    /// <returns>
+    /// True if an element was extracted; False if the queue was empty.
+    /// </returns>
+    bool _TryPop(T &value)
+    {
+        const pointer_uint_q HEAD = m_uHead.load(boost::memory_order_relaxed);
+
+        // The shared tail is only read when the cached one says the queue is empty
+        if(HEAD == m_uCachedTail)
+        {
+            m_uCachedTail = m_uTail.load(boost::memory_order_acquire);
+
+            if(HEAD == m_uCachedTail)
+                return false;
+        }
+
+        T* pElement = &m_arElements[HEAD & (m_uCapacity - 1U)];
+        value = *pElement;
+        pElement->~T();
+        m_uHead.store(HEAD + 1U, boost::memory_order_release);
+
+        return true;
+    }
+
+    /// <summary>
+    /// Wakes a thread up if there is any waiting for a condition.
+    /// </summary>
+    /// <remarks>
+    /// The fence guarantees that either the waiting thread sees the last change in the queue before it starts waiting or this thread sees the waiting thread.
+    /// </remarks>
+    /// <param name="uWaitingThreads">[IN] The counter of threads that wait for the condition.</param>
+    /// <param name="condition">[IN] The condition variable the threads wait for.</param>
+    void _NotifyWaitingThreads(const boost::atomic<pointer_uint_q> &uWaitingThreads, QConditionVariable &condition)
+    {
+        boost::atomic_thread_fence(boost::memory_order_seq_cst);
+
+        if(uWaitingThreads.load(boost::memory_order_relaxed) != 0)
+        {
+            QScopedExclusiveLock<QMutex> lock(m_mutex);
+            condition.NotifyOne();
+        }
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the maximum number of elements the queue can store.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the queue.
+    /// </returns>
+    pointer_uint_q GetCapacity() const
+    {
+        return m_uCapacity;
+    }
+
+    /// <summary>
+    /// Gets the number of elements in the queue.
+    /// </summary>
+    /// <remarks>
+    /// The result may be out of date as soon as it is returned, if other threads modify the queue.
+    /// </remarks>
+    /// <returns>
+    /// The number of elements in the queue.
+    /// </returns>
+    pointer_uint_q GetCount() const
+    {
+        const pointer_uint_q HEAD = m_uHead.load(boost::memory_order_acquire);
+        return m_uTail.load(boost::memory_order_acquire) - HEAD;
+    }
+
+    /// <summary>
+    /// Indicates whether the queue is empty or not.
+    /// </summary>
+    /// <remarks>
+    /// The result may be out of date as soon as it is returned, if other threads modify the queue.
+    /// </remarks>
+    /// <returns>
+    /// True if the queue is empty; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return this->GetCount() == 0;
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The allocator that reserves the buffer of the queue.
+    /// </summary>
+    QLinearAllocator m_allocator;
+
+    /// <summary>
+    /// The ring buffer where elements are stored.
+    /// </summary>
+    T* m_arElements;
+
+    /// <summary>
+    /// The maximum number of elements in the queue.
+    /// </summary>
+    const pointer_uint_q m_uCapacity;
+
+    /// <summary>
+    /// Separates the attributes read by both threads from the attributes of the producer.
+    /// </summary>
+    u8_q m_arProducerPadding[QSPSCQueue::CACHE_LINE_SIZE];
+
+    /// <summary>
+    /// The number of elements added since the queue was created. Only the producer modifies it.
+    /// </summary>
+    boost::atomic<pointer_uint_q> m_uTail;
+
+    /// <summary>
+    /// The last value of the head read by the producer.
+    /// </summary>
+    pointer_uint_q m_uCachedHead;
+
+    /// <summary>
+    /// Separates the attributes of the producer from the attributes of the consumer.
+    /// </summary>
+    u8_q m_arConsumerPadding[QSPSCQueue::CACHE_LINE_SIZE];
+
+    /// <summary>
+    /// The number of elements extracted since the queue was created. Only the consumer modifies it.
+    /// </summary>
+    boost::atomic<pointer_uint_q> m_uHead;
+
+    /// <summary>
+    /// The last value of the tail read by the consumer.
+    /// </summary>
+    pointer_uint_q m_uCachedTail;
+
+    /// <summary>
+    /// Separates the attributes of the consumer from the attributes used for waiting.
+    /// </summary>
+    u8_q m_arWaitingPadding[QSPSCQueue::CACHE_LINE_SIZE];
+
+    /// <summary>
+    /// The number of producers waiting for the queue not to be full.
+    /// </summary>
+    boost::atomic<pointer_uint_q> m_uWaitingProducers;
+
+    /// <summary>
+    /// The number of consumers waiting for the queue not to be empty.
+    /// </summary>
+    boost::atomic<pointer_uint_q> m_uWaitingConsumers;
+
+    /// <summary>
+    /// The mutex that protects the waiting threads.
+    /// </summary>
+    QMutex m_mutex;
+
+    /// <summary>
+    /// The condition producers wait for when the queue is full.
+    /// </summary>
+    QConditionVariable m_notFullCondition;
+
+    /// <summary>
+    /// The condition consumers wait for when the queue is empty.
+    /// </summary>
+    QConditionVariable m_notEmptyCondition;
+};
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QSPSCQUEUE__
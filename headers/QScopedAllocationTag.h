@@ -0,0 +1,125 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QSCOPEDALLOCATIONTAG__
+#define __QSCOPEDALLOCATIONTAG__
+
+#include "DataTypesDefinitions.h"
+#include "CommonDefinitions.h"
+#include "SQAllocationTracker.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+
+#if QE_CONFIG_ALLOCATIONTRACKING_DEFAULT == QE_CONFIG_ALLOCATIONTRACKING_ENABLED
+
+    /// <summary>
+    /// Attributes all the allocations made by the calling thread, from this line to the end of the current scope, to a tag. The tag is identified by 
+    /// its name, the file and the line, and is registered the first time the line is executed. Only one tag can be declared per scope.
+    /// </summary>
+    /// <remarks>
+    /// It does nothing when the allocation tracking is disabled in the configuration.
+    /// </remarks>
+    /// <param name="szTagName">[IN] The name of the tag. It must be a string literal.</param>
+    #define QE_ALLOCATION_TAG(szTagName)                                                                                                                                         \
+            static const u32_q QE_ALLOCATION_TAG_IDENTIFIER = Kinesis::QuimeraEngine::Common::Memory::SQAllocationTracker::RegisterTag(szTagName, __FILE__, __LINE__);           \
+            Kinesis::QuimeraEngine::Common::Memory::QScopedAllocationTag QE_ALLOCATION_TAG_SCOPE(QE_ALLOCATION_TAG_IDENTIFIER)
+
+#else
+
+    #define QE_ALLOCATION_TAG(szTagName)
+
+#endif
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace Memory
+{
+
+/// <summary>
+/// Makes a tag the active allocation tag of the calling thread while the instance exists, and restores the previous one when it is destroyed.
+/// </summary>
+/// <remarks>
+/// It is usually created by means of the QE_ALLOCATION_TAG macro.
+/// </remarks>
+class QE_LAYER_COMMON_SYMBOLS QScopedAllocationTag
+{
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the tag to activate.
+    /// </summary>
+    /// <param name="uTag">[IN] The identifier of a tag registered in SQAllocationTracker.</param>
+    explicit QScopedAllocationTag(const u32_q uTag);
+
+private:
+
+    // Disabled.
+    QScopedAllocationTag(const QScopedAllocationTag &);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. Restores the tag that was active when the instance was created.
+    /// </summary>
+    ~QScopedAllocationTag();
+
+
+    // METHODS
+    // ---------------
+private:
+
+    // Disabled.
+    QScopedAllocationTag& operator=(const QScopedAllocationTag &);
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The tag that was active when the instance was created.
+    /// </summary>
+    u32_q m_uPreviousTag;
+
+};
+
+} //namespace Memory
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QSCOPEDALLOCATIONTAG__
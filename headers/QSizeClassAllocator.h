@@ -0,0 +1,486 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QSIZECLASSALLOCATOR__
+#define __QSIZECLASSALLOCATOR__
+
+#include <boost/atomic.hpp>
+
+#include "DataTypesDefinitions.h"
+#include "CommonDefinitions.h"
+#include "QAlignment.h"
+#include "QPoolAllocator.h"
+
+#ifdef QE_COMPILER_MSVC
+    // This warning appears when instancing a template to create a data member and that template instance is not exported.
+    // In this case, it is not important since the data member is not accessible.
+    #pragma warning( disable : 4251 ) // http://msdn.microsoft.com/en-us/library/esew7y1w.aspx
+#endif
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+using Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace Memory
+{
+
+/// <summary>
+/// Represents a general-purpose allocator that serves blocks of any size, grouping them in size classes (segregated fit). Every size class 
+/// allocates blocks of a fixed size from slabs, which are pools (QPoolAllocator) of equal-sized blocks; blocks bigger than the largest size 
+/// class are requested to the system.
+/// </summary>
+/// <remarks>
+/// There are 40 size classes, from 16 bytes to 32 KB: one every 16 bytes up to 128 bytes and 4 per power of two after that, so no more than 
+/// 25% of a block is wasted (except for requests lower than 16 bytes). All the blocks are aligned to 16 bytes.<br/>
+/// Slabs are created when all the slabs of a size class are full, and are not released until ReleaseEmptySlabs is called or the allocator is destroyed. 
+/// Every size class keeps a list of its slabs that have free blocks, so the cost of allocating a block does not depend on the number of slabs.<br/>
+/// The memory used by the allocator (slabs and internal lists) is obtained from the system directly, never through the new operator, so the allocator 
+/// can be used as the backend of the engine's allocation operators (see QE_CONFIG_ALLOCATIONBACKEND_DEFAULT in the configuration).<br/>
+/// It is thread-safe. Every size class has its own spin lock, so threads that allocate or deallocate blocks of different size classes do not wait 
+/// for each other. The list of slabs, which is read every time a block is deallocated but only modified when slabs are created or released, is 
+/// protected by a readers-writer spin lock. Locks yield the processor to other threads when they have to wait for long.
+/// </remarks>
+class QE_LAYER_COMMON_SYMBOLS QSizeClassAllocator
+{
+    // CONSTANTS
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The size of a cache line, in bytes, assumed to place the locks of different size classes apart.
+    /// </summary>
+    static const pointer_uint_q CACHE_LINE_SIZE = 64U;
+
+
+    // INTERNAL CLASSES
+    // -----------------
+protected:
+
+    /// <summary>
+    /// A pool of blocks of the same size class.
+    /// </summary>
+    struct QSlab
+    {
+        /// <summary>
+        /// The first byte of the memory of the slab.
+        /// </summary>
+        u8_q* m_pBegin;
+
+        /// <summary>
+        /// The position after the last byte of the memory of the slab.
+        /// </summary>
+        u8_q* m_pEnd;
+
+        /// <summary>
+        /// The pool that allocates the blocks in the memory of the slab.
+        /// </summary>
+        QPoolAllocator* m_pPool;
+
+        /// <summary>
+        /// The previous slab in the list of slabs of the same size class that have free blocks.
+        /// </summary>
+        QSlab* m_pPreviousAvailable;
+
+        /// <summary>
+        /// The next slab in the list of slabs of the same size class that have free blocks.
+        /// </summary>
+        QSlab* m_pNextAvailable;
+
+        /// <summary>
+        /// The size class of the blocks.
+        /// </summary>
+        u32_q m_uSizeClass;
+    };
+
+    /// <summary>
+    /// The state of a size class.
+    /// </summary>
+    struct QSizeClass
+    {
+        /// <summary>
+        /// The first slab of the list of slabs with free blocks. It is null when all the slabs of the size class are full.
+        /// </summary>
+        QSlab* m_pFirstAvailableSlab;
+
+        /// <summary>
+        /// Whether the lock of the size class is acquired. It protects the list of slabs with free blocks and the pools of the slabs of the size class.
+        /// </summary>
+        mutable boost::atomic<bool> m_bLocked;
+
+        /// <summary>
+        /// Separates the locks of adjacent size classes so they never share a cache line, otherwise threads using different size classes 
+        /// would invalidate each other's caches.
+        /// </summary>
+        u8_q m_arPadding[QSizeClassAllocator::CACHE_LINE_SIZE];
+    };
+
+
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The size, in bytes, of the smallest size class.
+    /// </summary>
+    static const pointer_uint_q MIN_BLOCK_SIZE;
+
+    /// <summary>
+    /// The size, in bytes, of the largest size class. Bigger blocks are requested to the system.
+    /// </summary>
+    static const pointer_uint_q MAX_BLOCK_SIZE;
+
+    /// <summary>
+    /// The alignment of all the blocks of the size classes. Blocks with bigger alignments are requested to the system.
+    /// </summary>
+    static const pointer_uint_q BLOCK_ALIGNMENT;
+
+    /// <summary>
+    /// The minimum size, in bytes, of a slab.
+    /// </summary>
+    static const pointer_uint_q SLAB_SIZE;
+
+    /// <summary>
+    /// The minimum number of blocks of a slab, used for the size classes whose blocks do not fit in SLAB_SIZE so many times.
+    /// </summary>
+    static const pointer_uint_q MIN_BLOCKS_PER_SLAB;
+
+    /// <summary>
+    /// The number of size classes.
+    /// </summary>
+    static const u32_q SIZE_CLASSES_COUNT = 40U;
+
+protected:
+
+    /// <summary>
+    /// The position returned when a block does not belong to any slab.
+    /// </summary>
+    static const pointer_uint_q END_POSITION;
+
+    /// <summary>
+    /// The flag added to the lock of the list of slabs when a thread is modifying the list or waiting to do it.
+    /// </summary>
+    static const u32_q SLABS_WRITER_FLAG;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor. No memory is reserved until the first block is allocated.
+    /// </summary>
+    QSizeClassAllocator();
+
+private:
+
+    // Disabled.
+    QSizeClassAllocator(const QSizeClassAllocator &);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It releases all the slabs. Blocks that were requested to the system are not released.
+    /// </summary>
+    ~QSizeClassAllocator();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the allocator used by the engine's allocation operators.
+    /// </summary>
+    /// <remarks>
+    /// The instance is created the first time this method is called and is never destroyed, since blocks may be deallocated by the destructors of 
+    /// static objects at any time.
+    /// </remarks>
+    /// <returns>
+    /// The unique instance of the allocator.
+    /// </returns>
+    static QSizeClassAllocator* Get();
+
+    /// <summary>
+    /// Allocates a block of, at least, the given size.
+    /// </summary>
+    /// <param name="uSize">[IN] The size of the block, in bytes. It must be greater than zero.</param>
+    /// <returns>
+    /// The address of the block, aligned to BLOCK_ALIGNMENT. It is null if there is no memory available.
+    /// </returns>
+    void* Allocate(const pointer_uint_q uSize);
+
+    /// <summary>
+    /// Allocates a block of, at least, the given size, with the given alignment.
+    /// </summary>
+    /// <param name="uSize">[IN] The size of the block, in bytes. It must be greater than zero.</param>
+    /// <param name="alignment">[IN] The alignment of the block. If it is greater than BLOCK_ALIGNMENT, the block is requested to the system.</param>
+    /// <returns>
+    /// The address of the block. It is null if there is no memory available.
+    /// </returns>
+    void* Allocate(const pointer_uint_q uSize, const QAlignment &alignment);
+
+    /// <summary>
+    /// Deallocates a block that was allocated without specifying an alignment.
+    /// </summary>
+    /// <param name="pBlock">[IN] The block to deallocate. If it is null, nothing is done.</param>
+    void Deallocate(const void* pBlock);
+
+    /// <summary>
+    /// Deallocates a block that was allocated specifying an alignment.
+    /// </summary>
+    /// <param name="pBlock">[IN] The block to deallocate. If it is null, nothing is done.</param>
+    /// <param name="alignment">[IN] The alignment used when the block was allocated.</param>
+    void Deallocate(const void* pBlock, const QAlignment &alignment);
+
+    /// <summary>
+    /// Releases the slabs that have no allocated blocks, returning their memory to the system.
+    /// </summary>
+    void ReleaseEmptySlabs();
+
+    /// <summary>
+    /// Calculates the size of the blocks that are allocated for requests of a given size.
+    /// </summary>
+    /// <param name="uSize">[IN] The size of the request, in bytes. It must be greater than zero.</param>
+    /// <returns>
+    /// The size of the block of the size class that serves the request. If the request is bigger than MAX_BLOCK_SIZE, it is the same size.
+    /// </returns>
+    static pointer_uint_q GetBlockSize(const pointer_uint_q uSize);
+
+private:
+
+    // Disabled.
+    QSizeClassAllocator& operator=(const QSizeClassAllocator &);
+
+    /// <summary>
+    /// Calculates the size class that serves requests of a given size.
+    /// </summary>
+    /// <param name="uSize">[IN] The size of the request, in bytes. It must be greater than zero and lower than or equal to MAX_BLOCK_SIZE.</param>
+    /// <returns>
+    /// The index of the size class.
+    /// </returns>
+    static u32_q _GetSizeClass(const pointer_uint_q uSize);
+
+    /// <summary>
+    /// Calculates the size of the blocks of a size class.
+    /// </summary>
+    /// <param name="uSizeClass">[IN] The index of the size class.</param>
+    /// <returns>
+    /// The size of the blocks, in bytes.
+    /// </returns>
+    static pointer_uint_q _GetSizeClassBlockSize(const u32_q uSizeClass);
+
+    /// <summary>
+    /// Allocates a block of a size class, creating a slab if all of them are full. No lock must be acquired.
+    /// </summary>
+    /// <remarks>
+    /// Blocks are allocated from the first slab of the list of slabs with free blocks; when it gets full, it is removed from the list.
+    /// </remarks>
+    /// <param name="uSizeClass">[IN] The index of the size class.</param>
+    /// <returns>
+    /// The address of the block. It is null if a slab could not be created.
+    /// </returns>
+    void* _AllocateFromSizeClass(const u32_q uSizeClass);
+
+    /// <summary>
+    /// Deallocates a block if it belongs to any slab. No lock must be acquired.
+    /// </summary>
+    /// <remarks>
+    /// If the slab was full, it is added to the list of slabs with free blocks of its size class.
+    /// </remarks>
+    /// <param name="pBlock">[IN] The block to deallocate.</param>
+    /// <returns>
+    /// True if the block belongs to a slab; False if it was requested to the system.
+    /// </returns>
+    bool _DeallocateFromSlab(const void* pBlock);
+
+    /// <summary>
+    /// Creates a slab for a size class, allocates a block from it and adds it to the list of slabs with free blocks of the size class. No lock must be acquired.
+    /// </summary>
+    /// <remarks>
+    /// The memory of the slab is requested to the system before acquiring any lock. Another thread may create a slab for the same size class 
+    /// at the same time; both are kept.
+    /// </remarks>
+    /// <param name="uSizeClass">[IN] The index of the size class.</param>
+    /// <returns>
+    /// The address of the block. It is null if there is no memory available.
+    /// </returns>
+    void* _AllocateFromNewSlab(const u32_q uSizeClass);
+
+    /// <summary>
+    /// Releases the memory of a slab. It is not removed from any list.
+    /// </summary>
+    /// <param name="pSlab">[IN] The slab to release.</param>
+    static void _DestroySlab(QSlab* pSlab);
+
+    /// <summary>
+    /// Inserts a slab at the beginning of the list of slabs with free blocks of its size class. The lock of the size class must be acquired.
+    /// </summary>
+    /// <param name="pSlab">[IN] The slab to insert. It must not be in the list.</param>
+    void _AddAvailableSlab(QSlab* pSlab);
+
+    /// <summary>
+    /// Removes a slab from the list of slabs with free blocks of its size class. The lock of the size class must be acquired.
+    /// </summary>
+    /// <param name="pSlab">[IN] The slab to remove. It must be in the list.</param>
+    void _RemoveAvailableSlab(QSlab* pSlab);
+
+    /// <summary>
+    /// Searches for the slab that contains a block. The lock of the list of slabs must be acquired, for reading or writing.
+    /// </summary>
+    /// <param name="pBlock">[IN] The block.</param>
+    /// <returns>
+    /// The position of the slab in the list of slabs, or END_POSITION if the block does not belong to any slab.
+    /// </returns>
+    pointer_uint_q _FindSlab(const void* pBlock) const;
+
+    /// <summary>
+    /// Acquires the lock of a size class, waiting actively until it is released by other thread.
+    /// </summary>
+    /// <remarks>
+    /// When the lock of the list of slabs is needed too, it must be acquired before, so threads never wait for each other in a cycle.
+    /// </remarks>
+    /// <param name="uSizeClass">[IN] The index of the size class.</param>
+    void _LockSizeClass(const u32_q uSizeClass) const;
+
+    /// <summary>
+    /// Releases the lock of a size class.
+    /// </summary>
+    /// <param name="uSizeClass">[IN] The index of the size class.</param>
+    void _UnlockSizeClass(const u32_q uSizeClass) const;
+
+    /// <summary>
+    /// Acquires the lock of the list of slabs for reading, waiting actively while a thread is modifying the list or waiting to do it.
+    /// </summary>
+    /// <remarks>
+    /// Many threads can read the list at the same time.
+    /// </remarks>
+    void _LockSlabsForReading() const;
+
+    /// <summary>
+    /// Releases the lock of the list of slabs acquired for reading.
+    /// </summary>
+    void _UnlockSlabsForReading() const;
+
+    /// <summary>
+    /// Acquires the lock of the list of slabs for writing, waiting actively until no other thread is reading or modifying the list.
+    /// </summary>
+    /// <remarks>
+    /// Once the thread starts waiting, no new reader can acquire the lock, so writers are not delayed indefinitely by a continuous flow of readers.
+    /// </remarks>
+    void _LockSlabsForWriting() const;
+
+    /// <summary>
+    /// Releases the lock of the list of slabs acquired for writing.
+    /// </summary>
+    void _UnlockSlabsForWriting() const;
+
+    /// <summary>
+    /// Waits for a short time inside a spin-wait loop.
+    /// </summary>
+    /// <remarks>
+    /// The processor is told that the thread is spinning and, after some attempts, the rest of the time slice is yielded to other threads.
+    /// </remarks>
+    /// <param name="uSpins">[IN/OUT] The number of times the thread has waited in the current loop. It must be zero when the loop starts.</param>
+    static void _SpinWait(u32_q &uSpins);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the amount of memory reserved for all the slabs.
+    /// </summary>
+    /// <returns>
+    /// The sum of the sizes of the slabs, in bytes.
+    /// </returns>
+    pointer_uint_q GetReservedBytes() const;
+
+    /// <summary>
+    /// Gets the amount of memory occupied by the blocks allocated in the slabs. Blocks requested to the system are not included.
+    /// </summary>
+    /// <returns>
+    /// The sum of the sizes of the allocated blocks, in bytes.
+    /// </returns>
+    pointer_uint_q GetAllocatedBytes() const;
+
+    /// <summary>
+    /// Gets the number of slabs.
+    /// </summary>
+    /// <returns>
+    /// The number of slabs of all the size classes.
+    /// </returns>
+    pointer_uint_q GetSlabsCount() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The slabs of all the size classes, sorted by address. It is protected by the lock of the list of slabs.
+    /// </summary>
+    QSlab** m_arSlabs;
+
+    /// <summary>
+    /// The number of slabs.
+    /// </summary>
+    pointer_uint_q m_uSlabsCount;
+
+    /// <summary>
+    /// The number of slabs that fit in the list of slabs.
+    /// </summary>
+    pointer_uint_q m_uSlabsCapacity;
+
+    /// <summary>
+    /// The lock of the list of slabs: the number of threads reading the list, plus SLABS_WRITER_FLAG if a thread is modifying it or waiting to do it.
+    /// </summary>
+    mutable boost::atomic<u32_q> m_uSlabsLock;
+
+    /// <summary>
+    /// The state of every size class.
+    /// </summary>
+    QSizeClass m_arSizeClasses[QSizeClassAllocator::SIZE_CLASSES_COUNT];
+};
+
+} //namespace Memory
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QSIZECLASSALLOCATOR__
@@ -0,0 +1,459 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QSLOTMAP__
+#define __QSLOTMAP__
+
+#include "ToolsDefinitions.h"
+#include "QArrayDynamic.h"
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Represents a collection of elements which are identified by handles that never dangle.
+/// </summary>
+/// <remarks>
+/// Elements are stored contiguously in a dynamic array, so iterating through them is as fast as iterating through an array, although 
+/// their order is not preserved when elements are removed. Every element is identified by a handle that keeps referring to it while it moves 
+/// in memory, either due to a removal or to a reallocation. Adding, removing and getting an element by its handle are constant-time operations.<br/>
+/// A handle is composed of the index of a slot, in the lower bits, and the generation of the slot, in the upper bits. The generation of a slot 
+/// changes every time its element is removed, so handles of removed elements are rejected even if the slot is reused later. 32-bits handles use 
+/// 20 bits for the index, which limits the number of slots to 1048575, and 12 bits for the generation; 64-bits handles use 32 bits for each part.
+/// A stale handle could only be accepted again after the generation of the slot wraps around.<br/>
+/// The value of a null handle is zero, which never refers to any element.<br/>
+/// Elements are forced to implement assignment operator, copy constructor and destructor, all of them publicly accessible.
+/// </remarks>
+/// <typeparam name="T">The type of every element in the slot map.</typeparam>
+/// <typeparam name="HandleT">Optional. The unsigned integer type of the handles, either u32_q or u64_q. By default, u32_q will be used.</typeparam>
+/// <typeparam name="AllocatorT">Optional. The type of allocator to store the elements of the slot map. By default, QPoolAllocator will
+/// be used.</typeparam>
+template<class T, class HandleT = Kinesis::QuimeraEngine::Common::DataTypes::u32_q, class AllocatorT = Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator>
+class QSlotMap
+{
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The value of a handle that does not refer to any element.
+    /// </summary>
+    static const HandleT NULL_HANDLE;
+
+protected:
+
+    /// <summary>
+    /// The number of bits of a handle that store the index of the slot.
+    /// </summary>
+    static const pointer_uint_q INDEX_BITS;
+
+    /// <summary>
+    /// The mask that extracts the index of the slot from a handle.
+    /// </summary>
+    static const HandleT INDEX_MASK;
+
+    /// <summary>
+    /// The highest generation a slot can reach before wrapping around.
+    /// </summary>
+    static const HandleT MAX_GENERATION;
+
+    /// <summary>
+    /// The value stored in the position of a free slot when there are no more free slots after it.
+    /// </summary>
+    static const pointer_uint_q END_OF_FREE_SLOTS;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Default constructor.
+    /// </summary>
+    /// <remarks>
+    /// The initial capacity depends on the value of the default initial capacity of QArrayDynamic.
+    /// </remarks>
+    QSlotMap() : m_uFirstFreeSlot(QSlotMap::END_OF_FREE_SLOTS)
+    {
+    }
+
+    /// <summary>
+    /// Constructor that receives the initial capacity.
+    /// </summary>
+    /// <param name="uInitialCapacity">[IN] The number of elements for which to reserve memory. It must be greater than zero.</param>
+    explicit QSlotMap(const pointer_uint_q uInitialCapacity) : m_arElements(uInitialCapacity),
+                                                               m_arElementSlots(uInitialCapacity),
+                                                               m_arSlotPositions(uInitialCapacity),
+                                                               m_arSlotGenerations(uInitialCapacity),
+                                                               m_uFirstFreeSlot(QSlotMap::END_OF_FREE_SLOTS)
+    {
+    }
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Adds a copy of an element to the slot map.
+    /// </summary>
+    /// <remarks>
+    /// If the capacity of the slot map is exceeded, a reallocation will take place, which does not affect the handles.<br/>
+    /// The copy constructor of the element will be called.
+    /// </remarks>
+    /// <param name="newElement">[IN] The element to add.</param>
+    /// <returns>
+    /// The handle that identifies the element while it is in the slot map.
+    /// </returns>
+    HandleT Add(const T &newElement)
+    {
+        pointer_uint_q uSlot = m_uFirstFreeSlot;
+
+        if(uSlot == QSlotMap::END_OF_FREE_SLOTS)
+        {
+            uSlot = m_arSlotPositions.GetCount();
+
+            QE_ASSERT_ERROR(uSlot < QSlotMap::INDEX_MASK, "The maximum number of slots has been reached, the index of the slot does not fit in the handle.");
+
+            m_arSlotPositions.Add(0);
+            m_arSlotGenerations.Add(1U);
+        }
+        else
+        {
+            // Free slots store the next free slot instead of a position
+            m_uFirstFreeSlot = m_arSlotPositions[uSlot];
+        }
+
+        m_arSlotPositions[uSlot] = m_arElements.GetCount();
+        m_arElements.Add(newElement);
+        m_arElementSlots.Add(uSlot);
+
+        return QSlotMap::_MakeHandle(uSlot, m_arSlotGenerations[uSlot]);
+    }
+
+    /// <summary>
+    /// Removes the element identified by a handle from the slot map.
+    /// </summary>
+    /// <remarks>
+    /// The last element is moved to the position of the removed one, so the order of the elements is not preserved.<br/>
+    /// The destructor of the removed element and the assignment operator of the moved element will be called.<br/>
+    /// The handle becomes invalid; its slot may be reused by elements added later, with a different generation.
+    /// </remarks>
+    /// <param name="handle">[IN] The handle of the element, returned by Add. It must refer to an element that is in the slot map.</param>
+    void Remove(const HandleT handle)
+    {
+        QE_ASSERT_ERROR(this->Contains(handle), "The handle does not refer to any element in the slot map.");
+
+        const pointer_uint_q REMOVED_SLOT = QSlotMap::_GetSlot(handle);
+        const pointer_uint_q REMOVED_POSITION = m_arSlotPositions[REMOVED_SLOT];
+        const pointer_uint_q LAST_POSITION = m_arElements.GetCount() - 1U;
+
+        // The last element fills the gap, so the elements remain contiguous
+        if(REMOVED_POSITION != LAST_POSITION)
+        {
+            const pointer_uint_q MOVED_SLOT = m_arElementSlots[LAST_POSITION];
+
+            m_arElements[REMOVED_POSITION] = m_arElements[LAST_POSITION];
+            m_arElementSlots[REMOVED_POSITION] = MOVED_SLOT;
+            m_arSlotPositions[MOVED_SLOT] = REMOVED_POSITION;
+        }
+
+        m_arElements.Remove(LAST_POSITION);
+        m_arElementSlots.Remove(LAST_POSITION);
+
+        this->_ReleaseSlot(REMOVED_SLOT);
+    }
+
+    /// <summary>
+    /// Checks whether a handle refers to an element that is in the slot map.
+    /// </summary>
+    /// <remarks>
+    /// Handles of removed elements are rejected, even if their slot has been reused.
+    /// </remarks>
+    /// <param name="handle">[IN] A handle.</param>
+    /// <returns>
+    /// True if the handle is valid; False otherwise.
+    /// </returns>
+    bool Contains(const HandleT handle) const
+    {
+        const pointer_uint_q SLOT = QSlotMap::_GetSlot(handle);
+
+        // Free slots store the next free slot, which cannot be the position of an element whose slot is the same
+        return SLOT < m_arSlotGenerations.GetCount() && 
+               m_arSlotGenerations[SLOT] == QSlotMap::_GetGeneration(handle) &&
+               m_arSlotPositions[SLOT] < m_arElementSlots.GetCount() && 
+               m_arElementSlots[m_arSlotPositions[SLOT]] == SLOT;
+    }
+
+    /// <summary>
+    /// Increases the capacity of the slot map, reserving memory for more elements.
+    /// </summary>
+    /// <param name="uNumberOfElements">[IN] The number of elements for which to reserve memory. It should be greater than the current capacity or nothing will happen.</param>
+    void Reserve(const pointer_uint_q uNumberOfElements)
+    {
+        m_arElements.Reserve(uNumberOfElements);
+        m_arElementSlots.Reserve(uNumberOfElements);
+        m_arSlotPositions.Reserve(uNumberOfElements);
+        m_arSlotGenerations.Reserve(uNumberOfElements);
+    }
+
+    /// <summary>
+    /// Removes all the elements of the slot map.
+    /// </summary>
+    /// <remarks>
+    /// The destructor of every element will be called. Every handle becomes invalid, slots are kept to be reused.
+    /// </remarks>
+    void Clear()
+    {
+        const pointer_uint_q ELEMENT_COUNT = m_arElementSlots.GetCount();
+
+        for(pointer_uint_q i = 0; i < ELEMENT_COUNT; ++i)
+            this->_ReleaseSlot(m_arElementSlots[i]);
+
+        m_arElements.Clear();
+        m_arElementSlots.Clear();
+    }
+
+private:
+
+    /// <summary>
+    /// Changes the generation of a slot, so its current handle becomes invalid, and adds it to the list of free slots.
+    /// </summary>
+    /// <param name="uSlot">[IN] The index of an occupied slot.</param>
+    void _ReleaseSlot(const pointer_uint_q uSlot)
+    {
+        HandleT uGeneration = m_arSlotGenerations[uSlot];
+
+        // Zero is skipped so the null handle is never valid
+        uGeneration = uGeneration == QSlotMap::MAX_GENERATION ? 1U : uGeneration + 1U;
+        m_arSlotGenerations[uSlot] = uGeneration;
+
+        m_arSlotPositions[uSlot] = m_uFirstFreeSlot;
+        m_uFirstFreeSlot = uSlot;
+    }
+
+    /// <summary>
+    /// Composes a handle from the index of a slot and its generation.
+    /// </summary>
+    /// <param name="uSlot">[IN] The index of the slot.</param>
+    /// <param name="uGeneration">[IN] The generation of the slot.</param>
+    /// <returns>
+    /// The handle.
+    /// </returns>
+    static HandleT _MakeHandle(const pointer_uint_q uSlot, const HandleT uGeneration)
+    {
+        return (uGeneration << QSlotMap::INDEX_BITS) | scast_q(uSlot, HandleT);
+    }
+
+    /// <summary>
+    /// Extracts the index of the slot from a handle.
+    /// </summary>
+    /// <param name="handle">[IN] A handle.</param>
+    /// <returns>
+    /// The index of the slot.
+    /// </returns>
+    static pointer_uint_q _GetSlot(const HandleT handle)
+    {
+        return scast_q(handle & QSlotMap::INDEX_MASK, pointer_uint_q);
+    }
+
+    /// <summary>
+    /// Extracts the generation of the slot from a handle.
+    /// </summary>
+    /// <param name="handle">[IN] A handle.</param>
+    /// <returns>
+    /// The generation of the slot.
+    /// </returns>
+    static HandleT _GetGeneration(const HandleT handle)
+    {
+        return handle >> QSlotMap::INDEX_BITS;
+    }
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the element identified by a handle.
+    /// </summary>
+    /// <remarks>
+    /// The returned reference is only valid until the next element is added or removed.
+    /// </remarks>
+    /// <param name="handle">[IN] The handle of the element, returned by Add. It must refer to an element that is in the slot map.</param>
+    /// <returns>
+    /// A reference to the element.
+    /// </returns>
+    T& GetValue(const HandleT handle)
+    {
+        QE_ASSERT_ERROR(this->Contains(handle), "The handle does not refer to any element in the slot map.");
+
+        return m_arElements[m_arSlotPositions[QSlotMap::_GetSlot(handle)]];
+    }
+
+    /// <summary>
+    /// Gets the element identified by a handle.
+    /// </summary>
+    /// <remarks>
+    /// The returned reference is only valid until the next element is added or removed.
+    /// </remarks>
+    /// <param name="handle">[IN] The handle of the element, returned by Add. It must refer to an element that is in the slot map.</param>
+    /// <returns>
+    /// A constant reference to the element.
+    /// </returns>
+    const T& GetValue(const HandleT handle) const
+    {
+        QE_ASSERT_ERROR(this->Contains(handle), "The handle does not refer to any element in the slot map.");
+
+        return m_arElements[m_arSlotPositions[QSlotMap::_GetSlot(handle)]];
+    }
+
+    /// <summary>
+    /// Gets the contiguous array that stores the elements, which can be used to iterate through all of them.
+    /// </summary>
+    /// <remarks>
+    /// The position of an element in the array changes when other elements are removed.
+    /// </remarks>
+    /// <returns>
+    /// A constant reference to the array of elements.
+    /// </returns>
+    const QArrayDynamic<T, AllocatorT>& GetElements() const
+    {
+        return m_arElements;
+    }
+
+    /// <summary>
+    /// Gets the handle of the element that occupies a position in the contiguous array of elements.
+    /// </summary>
+    /// <param name="uPosition">[IN] The position of the element in the array returned by GetElements. It must be lower than the number of elements.</param>
+    /// <returns>
+    /// The handle of the element.
+    /// </returns>
+    HandleT GetHandleAt(const pointer_uint_q uPosition) const
+    {
+        QE_ASSERT_ERROR(uPosition < m_arElementSlots.GetCount(), "The position is out of bounds.");
+
+        const pointer_uint_q SLOT = m_arElementSlots[uPosition];
+        return QSlotMap::_MakeHandle(SLOT, m_arSlotGenerations[SLOT]);
+    }
+
+    /// <summary>
+    /// Gets the number of elements in the slot map.
+    /// </summary>
+    /// <returns>
+    /// The number of elements.
+    /// </returns>
+    pointer_uint_q GetCount() const
+    {
+        return m_arElements.GetCount();
+    }
+
+    /// <summary>
+    /// Gets the number of elements for which memory has been reserved.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the slot map.
+    /// </returns>
+    pointer_uint_q GetCapacity() const
+    {
+        return m_arElements.GetCapacity();
+    }
+
+    /// <summary>
+    /// Indicates whether the slot map is empty or not.
+    /// </summary>
+    /// <returns>
+    /// True if the slot map is empty; False otherwise.
+    /// </returns>
+    bool IsEmpty() const
+    {
+        return m_arElements.IsEmpty();
+    }
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The elements, stored contiguously.
+    /// </summary>
+    QArrayDynamic<T, AllocatorT> m_arElements;
+
+    /// <summary>
+    /// The slot of every element, at the same position as the element.
+    /// </summary>
+    QArrayDynamic<pointer_uint_q, AllocatorT> m_arElementSlots;
+
+    /// <summary>
+    /// The position of the element of every slot. For free slots, it contains the next free slot.
+    /// </summary>
+    QArrayDynamic<pointer_uint_q, AllocatorT> m_arSlotPositions;
+
+    /// <summary>
+    /// The current generation of every slot.
+    /// </summary>
+    QArrayDynamic<HandleT, AllocatorT> m_arSlotGenerations;
+
+    /// <summary>
+    /// The first slot of the list of free slots.
+    /// </summary>
+    pointer_uint_q m_uFirstFreeSlot;
+};
+
+
+// ATTRIBUTE INITIALIZATION
+// ----------------------------
+template<class T, class HandleT, class AllocatorT>
+const HandleT QSlotMap<T, HandleT, AllocatorT>::NULL_HANDLE = 0;
+
+template<class T, class HandleT, class AllocatorT>
+const pointer_uint_q QSlotMap<T, HandleT, AllocatorT>::INDEX_BITS = sizeof(HandleT) == sizeof(Kinesis::QuimeraEngine::Common::DataTypes::u64_q) ? 32U : 20U;
+
+template<class T, class HandleT, class AllocatorT>
+const HandleT QSlotMap<T, HandleT, AllocatorT>::INDEX_MASK = (HandleT(1U) << QSlotMap<T, HandleT, AllocatorT>::INDEX_BITS) - 1U;
+
+template<class T, class HandleT, class AllocatorT>
+const HandleT QSlotMap<T, HandleT, AllocatorT>::MAX_GENERATION = HandleT(-1) >> QSlotMap<T, HandleT, AllocatorT>::INDEX_BITS;
+
+template<class T, class HandleT, class AllocatorT>
+const pointer_uint_q QSlotMap<T, HandleT, AllocatorT>::END_OF_FREE_SLOTS = -1;
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QSLOTMAP__
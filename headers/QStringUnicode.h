@@ -37,6 +37,7 @@
 #include <unicode/numfmt.h>
 #include <sstream>
 #include <math.h>
+#include <boost/atomic.hpp>
 
 #include "QCharUnicode.h"
 #include "QArrayResult.h"
@@ -461,6 +462,13 @@ public:
     /// </summary>
     static const unsigned int END_POSITION_BACKWARD = -2;
 
+private:
+
+    /// <summary>
+    /// Value of the cached hash when it has not been calculated yet or the string has changed since it was calculated.
+    /// </summary>
+    static const u64_q HASH_NOT_CALCULATED;
+
 
     // CONSTRUCTORS
     // ---------------
@@ -1485,6 +1493,14 @@ private:
     /// </returns>
     static const icu::Collator* _GetCollator(const EQComparisonType &eComparisonType);
 
+    /// <summary>
+    /// Calculates the hash of the string, without using the cached hash.
+    /// </summary>
+    /// <returns>
+    /// The hash of the string. It is never equal to HASH_NOT_CALCULATED.
+    /// </returns>
+    u64_q _CalculateHash() const;
+
 
     // PROPERTIES
     // ---------------
@@ -1519,6 +1535,20 @@ public:
     /// </returns>
     const u16_q* GetInternalBuffer() const;
 
+    /// <summary>
+    /// Gets a 64 bits hash of the string, calculated from the UTF-16 code units that compose it.
+    /// </summary>
+    /// <remarks>
+    /// Unless the string hash cache is disabled in the engine configuration, the hash is calculated only once and stored in the instance 
+    /// until the string is modified, so obtaining the hash of the same string again costs nothing.<br/>
+    /// The cache is accessed atomically, so the hash of the same constant string can be obtained from several threads at the same time.<br/>
+    /// Strings that are equal always have the same hash. Hashes depend on the endianness of the machine, so they must not be stored or transmitted.
+    /// </remarks>
+    /// <returns>
+    /// The hash of the string.
+    /// </returns>
+    u64_q GetHash() const;
+
     /// <summary>
     /// Obtains a constant empty string.
     /// </summary>
@@ -1558,6 +1588,11 @@ private:
     /// </summary>
     unsigned int m_uLength;
 
+    /// <summary>
+    /// The hash of the string, stored the first time it is calculated and reset when the string is modified.
+    /// </summary>
+    mutable boost::atomic<u64_q> m_uHash;
+
 };
 
 
@@ -0,0 +1,417 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __QTHREADCACHEDPOOLALLOCATOR__
+#define __QTHREADCACHEDPOOLALLOCATOR__
+
+#include "SystemDefinitions.h"
+
+#include <boost/thread/tss.hpp>
+#include "QPoolAllocator.h"
+#include "QAlignment.h"
+#include "QMutex.h"
+
+#ifdef QE_COMPILER_MSVC
+    // This warning appears when instancing a template to create a data member and that template instance is not exported.
+    // In this case, it is not important since the data member is not accessible.
+    #pragma warning( disable : 4251 ) // http://msdn.microsoft.com/en-us/library/esew7y1w.aspx
+#endif
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+using Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+/// <summary>
+/// Represents a pool allocator that can be used from several threads at the same time, which keeps a small cache of free blocks per thread.
+/// </summary>
+/// <remarks>
+/// Blocks are obtained from a central QPoolAllocator protected by a mutex, but every thread allocates from and deallocates to its own cache, 
+/// which is not shared, so most operations neither lock the mutex nor perform atomic operations. When the cache of a thread is empty, half 
+/// of it is filled with blocks of the central pool at once; when it is full, half of it is returned to the central pool at once.<br/>
+/// A block may be deallocated by a different thread from the one that allocated it.<br/>
+/// When a thread finishes, the blocks in its cache are returned to the central pool. Blocks kept in the caches of other threads cannot be allocated 
+/// by a thread whose cache is empty, so the allocator may return null even if not all the blocks are in use; ReleaseThreadCache can be used to return 
+/// them explicitly.<br/>
+/// The allocator must not be destroyed while other threads are using it, although it can be destroyed while the threads that used it are finishing.<br/>
+/// This class is thread-safe.
+/// </remarks>
+class QE_LAYER_SYSTEM_SYMBOLS QThreadCachedPoolAllocator
+{
+    // INTERNAL CLASSES
+    // ---------------
+protected:
+
+    class QSharedState;
+
+    /// <summary>
+    /// The free blocks kept by a thread.
+    /// </summary>
+    /// <remarks>
+    /// Only the thread that owns the cache modifies it, except when the cache is registered or unregistered, which is done while the mutex 
+    /// of the shared state is locked.
+    /// </remarks>
+    class QThreadCache
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the shared state of the allocator the cache belongs to.
+        /// </summary>
+        /// <param name="pSharedState">[IN] The shared state of the allocator that owns the cache. It must not be null.</param>
+        /// <param name="uCapacity">[IN] The maximum number of blocks in the cache.</param>
+        QThreadCache(QSharedState* pSharedState, const pointer_uint_q uCapacity);
+
+    private:
+
+        // Disabled.
+        QThreadCache(const QThreadCache &);
+
+        // Disabled.
+        QThreadCache& operator=(const QThreadCache &);
+
+
+        // DESTRUCTOR
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Destructor.
+        /// </summary>
+        ~QThreadCache();
+
+
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The free blocks, used as a stack.
+        /// </summary>
+        void** m_arBlocks;
+
+        /// <summary>
+        /// The number of free blocks in the cache.
+        /// </summary>
+        pointer_uint_q m_uCount;
+
+        /// <summary>
+        /// The shared state of the allocator that owns the cache. The cache holds a reference to it, so it exists as long as the cache does.
+        /// </summary>
+        QSharedState* m_pSharedState;
+
+        /// <summary>
+        /// The next cache in the list of caches of the allocator.
+        /// </summary>
+        QThreadCache* m_pNext;
+    };
+
+    /// <summary>
+    /// The data shared by the allocator and the caches of the threads, which is destroyed when neither the allocator nor any cache refer to it.
+    /// </summary>
+    /// <remarks>
+    /// Since every cache keeps it alive, a thread that finishes while the allocator is being destroyed can still lock the mutex, check whether 
+    /// the allocator exists and unregister its cache. All the attributes are protected by the mutex.
+    /// </remarks>
+    class QSharedState
+    {
+        // CONSTRUCTORS
+        // ---------------
+    public:
+
+        /// <summary>
+        /// Constructor that receives the allocator that owns the shared state, which holds the first reference.
+        /// </summary>
+        /// <param name="pOwner">[IN] The allocator that owns the shared state. It must not be null.</param>
+        explicit QSharedState(QThreadCachedPoolAllocator* pOwner);
+
+    private:
+
+        // Disabled.
+        QSharedState(const QSharedState &);
+
+        // Disabled.
+        QSharedState& operator=(const QSharedState &);
+
+
+        // ATTRIBUTES
+        // ---------------
+    public:
+
+        /// <summary>
+        /// The mutex that protects the central pool of the allocator, the list of caches and the number of references.
+        /// </summary>
+        QMutex m_mutex;
+
+        /// <summary>
+        /// The allocator that owns the shared state. It is null when the allocator has been destroyed.
+        /// </summary>
+        QThreadCachedPoolAllocator* m_pOwner;
+
+        /// <summary>
+        /// The first cache in the list of caches of all the threads.
+        /// </summary>
+        QThreadCache* m_pFirstCache;
+
+        /// <summary>
+        /// The number of references to the shared state, one for the allocator (until it is destroyed) and one for every cache in the list.
+        /// </summary>
+        pointer_uint_q m_uReferences;
+    };
+
+
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The maximum number of blocks kept by every thread when it is not specified.
+    /// </summary>
+    static const pointer_uint_q DEFAULT_CACHE_CAPACITY;
+
+
+    // CONSTRUCTORS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructor that receives the size of the pool, the size of every block and their alignment.
+    /// </summary>
+    /// <remarks>
+    /// Every thread will keep up to DEFAULT_CACHE_CAPACITY free blocks.
+    /// </remarks>
+    /// <param name="uSize">[IN] Size of the pool, in bytes. It must be greater than zero.</param>
+    /// <param name="uBlockSize">[IN] Size of each block to allocate, in bytes. It must be greater than zero.</param>
+    /// <param name="alignment">[IN] Multiple of which must be the memory address. All the blocks will have the same alignment.</param>
+    QThreadCachedPoolAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const QAlignment &alignment);
+
+    /// <summary>
+    /// Constructor that receives the size of the pool, the size of every block, their alignment and the capacity of the cache of every thread.
+    /// </summary>
+    /// <param name="uSize">[IN] Size of the pool, in bytes. It must be greater than zero.</param>
+    /// <param name="uBlockSize">[IN] Size of each block to allocate, in bytes. It must be greater than zero.</param>
+    /// <param name="alignment">[IN] Multiple of which must be the memory address. All the blocks will have the same alignment.</param>
+    /// <param name="uCacheCapacity">[IN] The maximum number of free blocks kept by every thread. It must be greater than 1. Blocks are moved 
+    /// between the cache and the central pool in batches of half this amount.</param>
+    QThreadCachedPoolAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const QAlignment &alignment, const pointer_uint_q uCacheCapacity);
+
+private:
+
+    // Disabled.
+    QThreadCachedPoolAllocator(const QThreadCachedPoolAllocator &);
+
+
+    // DESTRUCTOR
+    // ---------------
+public:
+
+    /// <summary>
+    /// Destructor. It frees the pool and the cache of the calling thread; the caches of the other threads are freed when they finish, 
+    /// even if that happens while the allocator is being destroyed.
+    /// </summary>
+    ~QThreadCachedPoolAllocator();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Allocates a block and returns its address.
+    /// </summary>
+    /// <remarks>
+    /// The mutex is only locked when the cache of the calling thread is empty.
+    /// </remarks>
+    /// <returns>
+    /// Pointer to the allocated memory block. Returns null if neither the cache of the calling thread nor the central pool have free blocks.
+    /// </returns>
+    void* Allocate();
+
+    /// <summary>
+    /// Deallocates a block, which is kept in the cache of the calling thread.
+    /// </summary>
+    /// <remarks>
+    /// The mutex is only locked when the cache of the calling thread is full.
+    /// </remarks>
+    /// <param name="pBlock">[IN] Pointer to a block previously allocated by this allocator, in any thread. It must not be null.</param>
+    void Deallocate(const void* pBlock);
+
+    /// <summary>
+    /// Returns all the blocks in the cache of the calling thread to the central pool, so other threads can allocate them.
+    /// </summary>
+    void ReleaseThreadCache();
+
+private:
+
+    // Disabled.
+    QThreadCachedPoolAllocator& operator=(const QThreadCachedPoolAllocator &);
+
+    /// <summary>
+    /// Gets the cache of the calling thread, creating it if it does not exist yet.
+    /// </summary>
+    /// <returns>
+    /// The cache of the calling thread.
+    /// </returns>
+    QThreadCache* _GetThreadCache();
+
+    /// <summary>
+    /// Moves up to half the capacity of a cache from the central pool to the cache.
+    /// </summary>
+    /// <param name="pCache">[IN/OUT] The cache of the calling thread.</param>
+    void _Refill(QThreadCache* pCache);
+
+    /// <summary>
+    /// Moves blocks from a cache to the central pool.
+    /// </summary>
+    /// <param name="pCache">[IN/OUT] The cache of the calling thread.</param>
+    /// <param name="uNumberOfBlocks">[IN] The number of blocks to move. It must not be greater than the number of blocks in the cache.</param>
+    void _Flush(QThreadCache* pCache, const pointer_uint_q uNumberOfBlocks);
+
+    /// <summary>
+    /// Returns all the blocks of a cache to the central pool, if the allocator still exists, and removes it from the list of caches.
+    /// </summary>
+    /// <remarks>
+    /// The mutex of the shared state must be locked.
+    /// </remarks>
+    /// <param name="pCache">[IN/OUT] The cache to unregister.</param>
+    static void _UnregisterThreadCache(QThreadCache* pCache);
+
+    /// <summary>
+    /// Removes a reference to a shared state.
+    /// </summary>
+    /// <remarks>
+    /// The mutex of the shared state must be locked.
+    /// </remarks>
+    /// <param name="pSharedState">[IN/OUT] The shared state.</param>
+    /// <returns>
+    /// True if it was the last reference, so the shared state must be destroyed once its mutex is unlocked; False otherwise.
+    /// </returns>
+    static bool _RemoveReference(QSharedState* pSharedState);
+
+    /// <summary>
+    /// Destroys the cache of a thread when it finishes, returning its blocks to the central pool if the allocator still exists.
+    /// </summary>
+    /// <param name="pCache">[IN] The cache to destroy.</param>
+    static void _DestroyThreadCache(QThreadCache* pCache);
+
+
+    // PROPERTIES
+    // ---------------
+public:
+
+    /// <summary>
+    /// Gets the size of the central pool, in bytes.
+    /// </summary>
+    /// <returns>
+    /// The size of the pool.
+    /// </returns>
+    pointer_uint_q GetPoolSize() const;
+
+    /// <summary>
+    /// Gets the number of bytes taken from the central pool, including the blocks kept in the caches of the threads.
+    /// </summary>
+    /// <returns>
+    /// The number of bytes taken from the central pool.
+    /// </returns>
+    pointer_uint_q GetAllocatedBytes();
+
+    /// <summary>
+    /// Indicates whether the calling thread can allocate a block.
+    /// </summary>
+    /// <returns>
+    /// True if either the cache of the calling thread or the central pool have free blocks; False otherwise.
+    /// </returns>
+    bool CanAllocate();
+
+    /// <summary>
+    /// Gets the maximum number of free blocks kept by every thread.
+    /// </summary>
+    /// <returns>
+    /// The capacity of the cache of every thread.
+    /// </returns>
+    pointer_uint_q GetCacheCapacity() const;
+
+    /// <summary>
+    /// Gets the alignment of the blocks.
+    /// </summary>
+    /// <returns>
+    /// The memory alignment.
+    /// </returns>
+    QAlignment GetAlignment() const;
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The pool from which all the blocks are obtained.
+    /// </summary>
+    QPoolAllocator m_centralPool;
+
+    /// <summary>
+    /// The mutex, the list of caches and the number of references, shared with the caches so they can outlive the allocator.
+    /// </summary>
+    QSharedState* m_pSharedState;
+
+    /// <summary>
+    /// The cache of every thread that has used the allocator.
+    /// </summary>
+    boost::thread_specific_ptr<QThreadCache> m_threadCache;
+
+    /// <summary>
+    /// The maximum number of free blocks kept by every thread.
+    /// </summary>
+    pointer_uint_q m_uCacheCapacity;
+
+    /// <summary>
+    /// The address of the first block of the pool.
+    /// </summary>
+    const void* m_pPoolBegin;
+
+    /// <summary>
+    /// The address right after the last block of the pool.
+    /// </summary>
+    const void* m_pPoolEnd;
+};
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __QTHREADCACHEDPOOLALLOCATOR__
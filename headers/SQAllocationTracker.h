@@ -0,0 +1,290 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SQALLOCATIONTRACKER__
+#define __SQALLOCATIONTRACKER__
+
+#include <boost/atomic.hpp>
+
+#include "DataTypesDefinitions.h"
+#include "CommonDefinitions.h"
+
+#ifdef QE_COMPILER_MSVC
+    // This warning appears when instancing a template to create a data member and that template instance is not exported.
+    // In this case, it is not important since the data member is not accessible.
+    #pragma warning( disable : 4251 ) // http://msdn.microsoft.com/en-us/library/esew7y1w.aspx
+#endif
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::i64_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace Memory
+{
+
+class QAllocationSnapshot;
+
+
+/// <summary>
+/// Keeps counters of the memory allocated through the global new and delete operators, grouped by tag, so it is possible to know which parts of 
+/// the engine use the heap and how.
+/// </summary>
+/// <remarks>
+/// It is thread-safe.<br/>
+/// A tag is a name plus the file and line where it is registered, usually by means of the QE_ALLOCATION_TAG macro. Every allocation is 
+/// attributed to the tag which is active in the calling thread at that moment; if there is none, it is attributed to the untagged group.<br/>
+/// The global operators only notify the tracker when the allocation tracking is enabled in the configuration (QE_CONFIG_ALLOCATIONTRACKING_DEFAULT); 
+/// otherwise, all the counters remain zero and there is no overhead at all.<br/>
+/// Every thread updates its own counters, which are merged when a snapshot is taken. When a thread finishes, its counters are kept and reused by 
+/// the next thread that starts allocating, so their number never exceeds the maximum number of threads that have existed at the same time. The live 
+/// bytes are kept by every thread too, as the difference between the bytes it allocated and the bytes it deallocated, so a block deallocated by 
+/// a different thread is still subtracted from the total.<br/>
+/// The high-water mark of a tag requires a counter of live bytes shared by all the threads, which is only updated for the tags whose high-water mark 
+/// has been enabled by means of EnableHighWaterMark; for the rest, it is zero.
+/// </remarks>
+class QE_LAYER_COMMON_SYMBOLS SQAllocationTracker
+{
+    // CONSTANTS
+    // ---------------
+public:
+
+    /// <summary>
+    /// The maximum number of tags, including the untagged group.
+    /// </summary>
+    static const u32_q MAX_TAGS = 128U;
+
+    /// <summary>
+    /// The number of intervals of the size histogram. The first one counts the blocks of up to 16 bytes, every following one doubles 
+    /// the upper limit of the previous one and the last one counts the blocks bigger than 256 KB.
+    /// </summary>
+    static const u32_q HISTOGRAM_BUCKETS_COUNT = 16U;
+
+    /// <summary>
+    /// The tag of the allocations made while no tag is active.
+    /// </summary>
+    static const u32_q UNTAGGED;
+
+protected:
+
+    /// <summary>
+    /// The size of a cache line, in bytes, assumed to place the counters of different tags apart.
+    /// </summary>
+    static const pointer_uint_q CACHE_LINE_SIZE = 64U;
+
+
+    // INTERNAL CLASSES
+    // -----------------
+protected:
+
+    /// <summary>
+    /// The counters of a tag that are shared by all the threads, used to calculate its high-water mark.
+    /// </summary>
+    struct QSharedTagCounters
+    {
+        /// <summary>
+        /// Whether the high-water mark of the tag is calculated. Unless it is, the rest of counters are not updated.
+        /// </summary>
+        boost::atomic<bool> m_bHighWaterMarkEnabled;
+
+        /// <summary>
+        /// The bytes of the tag that have been allocated and not deallocated yet since the high-water mark was enabled. It may be negative 
+        /// if blocks allocated before are deallocated.
+        /// </summary>
+        boost::atomic<i64_q> m_nLiveBytes;
+
+        /// <summary>
+        /// The maximum number of live bytes reached by the tag since the high-water mark was enabled.
+        /// </summary>
+        boost::atomic<i64_q> m_nHighWaterMark;
+
+        /// <summary>
+        /// Separates the counters of adjacent tags so they never share a cache line, otherwise threads allocating with different tags 
+        /// would invalidate each other's caches.
+        /// </summary>
+        u8_q m_arPadding[SQAllocationTracker::CACHE_LINE_SIZE];
+    };
+
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SQAllocationTracker();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Registers a tag or gets its identifier if it was already registered.
+    /// </summary>
+    /// <remarks>
+    /// Tags are never unregistered.
+    /// </remarks>
+    /// <param name="szName">[IN] The name of the tag. It must not be null and must exist during the whole life of the process, like a string literal.</param>
+    /// <param name="szFile">[IN] The path of the source file where the tag is registered. It must not be null and must exist during the whole life of the process.</param>
+    /// <param name="nLine">[IN] The line of the source file where the tag is registered.</param>
+    /// <returns>
+    /// The identifier of the tag. If there is no room for more tags, the untagged group is returned.
+    /// </returns>
+    static u32_q RegisterTag(const char* szName, const char* szFile, const int nLine);
+
+    /// <summary>
+    /// Gets the tag which is active in the calling thread.
+    /// </summary>
+    /// <returns>
+    /// The identifier of the tag.
+    /// </returns>
+    static u32_q GetCurrentTag();
+
+    /// <summary>
+    /// Sets the tag to which the allocations of the calling thread are attributed.
+    /// </summary>
+    /// <param name="uTag">[IN] The identifier of a registered tag.</param>
+    static void SetCurrentTag(const u32_q uTag);
+
+    /// <summary>
+    /// Makes the tracker calculate the high-water mark of a tag from now on.
+    /// </summary>
+    /// <remarks>
+    /// The allocations and deallocations of the tag will update a counter shared by all the threads, which is slower than the rest of counters 
+    /// when several threads use the tag at the same time.<br/>
+    /// The blocks allocated before the high-water mark is enabled are not counted, so it should be enabled right after the tag is registered.<br/>
+    /// It cannot be disabled.
+    /// </remarks>
+    /// <param name="uTag">[IN] The identifier of a registered tag.</param>
+    static void EnableHighWaterMark(const u32_q uTag);
+
+    /// <summary>
+    /// Adds an allocated block to the counters of a tag.
+    /// </summary>
+    /// <param name="uTag">[IN] The identifier of a registered tag.</param>
+    /// <param name="uSize">[IN] The size of the block, in bytes, as requested by the user.</param>
+    static void NotifyAllocation(const u32_q uTag, const pointer_uint_q uSize);
+
+    /// <summary>
+    /// Removes a deallocated block from the counters of a tag. The calling thread may not be the one that allocated the block.
+    /// </summary>
+    /// <param name="uTag">[IN] The identifier of the tag to which the block was attributed when it was allocated.</param>
+    /// <param name="uSize">[IN] The size of the block, in bytes, as requested by the user when it was allocated.</param>
+    static void NotifyDeallocation(const u32_q uTag, const pointer_uint_q uSize);
+
+    /// <summary>
+    /// Merges the counters of all the threads and gets the statistics of every tag.
+    /// </summary>
+    /// <remarks>
+    /// The counters of the threads that are allocating at the same time may be read in the middle of an operation, so the snapshot is not 
+    /// necessarily consistent among tags. The allocations made by the threads that have finished are included.
+    /// </remarks>
+    /// <returns>
+    /// The statistics of every registered tag.
+    /// </returns>
+    static QAllocationSnapshot TakeSnapshot();
+
+    /// <summary>
+    /// Calculates the interval of the size histogram to which a block belongs.
+    /// </summary>
+    /// <param name="uSize">[IN] The size of the block, in bytes.</param>
+    /// <returns>
+    /// The index of the interval of the histogram.
+    /// </returns>
+    static u32_q GetHistogramBucket(const pointer_uint_q uSize);
+
+    /// <summary>
+    /// Gets the upper limit of an interval of the size histogram.
+    /// </summary>
+    /// <param name="uBucket">[IN] The index of the interval of the histogram. It must be lower than HISTOGRAM_BUCKETS_COUNT.</param>
+    /// <returns>
+    /// The biggest size, in bytes, counted in the interval. For the last interval, it is the biggest size counted in the previous one.
+    /// </returns>
+    static pointer_uint_q GetHistogramBucketLimit(const u32_q uBucket);
+
+private:
+
+    /// <summary>
+    /// Makes the calling thread wait until the registry of tags is free, and then takes it.
+    /// </summary>
+    static void _LockRegistry();
+
+    /// <summary>
+    /// Frees the registry of tags.
+    /// </summary>
+    static void _UnlockRegistry();
+
+
+    // ATTRIBUTES
+    // ---------------
+protected:
+
+    /// <summary>
+    /// The names of the registered tags. The first element, the untagged group, is always null.
+    /// </summary>
+    static const char* sm_arTagNames[SQAllocationTracker::MAX_TAGS];
+
+    /// <summary>
+    /// The source files where the tags were registered.
+    /// </summary>
+    static const char* sm_arTagFiles[SQAllocationTracker::MAX_TAGS];
+
+    /// <summary>
+    /// The lines of the source files where the tags were registered.
+    /// </summary>
+    static int sm_arTagLines[SQAllocationTracker::MAX_TAGS];
+
+    /// <summary>
+    /// The number of registered tags, not including the untagged group. Like the rest of attributes, it is zero-initialized before any 
+    /// constructor is called, so allocations made during the initialization of static objects are counted correctly.
+    /// </summary>
+    static boost::atomic<u32_q> sm_uRegisteredTags;
+
+    /// <summary>
+    /// The counters used to calculate the high-water mark of every tag.
+    /// </summary>
+    static QSharedTagCounters sm_arSharedCounters[SQAllocationTracker::MAX_TAGS];
+
+    /// <summary>
+    /// Flag used as a lock to register tags.
+    /// </summary>
+    static boost::atomic<bool> sm_bRegistryLocked;
+
+};
+
+} //namespace Memory
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __SQALLOCATIONTRACKER__
@@ -0,0 +1,216 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SQBULKELEMENTOPERATIONS__
+#define __SQBULKELEMENTOPERATIONS__
+
+#include <cstring>
+
+#include "DataTypesDefinitions.h"
+#include "ToolsDefinitions.h"
+#include "AllocationOperators.h"
+#include "SQTypeTraits.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+
+/// <summary>
+/// Copies sequences of elements either by copying their bytes or by calling the copy constructor or the assignment operator of every element.
+/// </summary>
+/// <remarks>
+/// SQBulkElementOperations chooses the specialization at compile time, depending on whether the type is trivially copyable, so the byte copy is never 
+/// compiled for types that have to be copied element by element.<br/>
+/// This class is intended to be used internally by SQBulkElementOperations.
+/// </remarks>
+/// <typeparam name="T">The type of the elements.</typeparam>
+/// <typeparam name="IS_TRIVIALLY_COPYABLE">Indicates whether the elements can be copied by copying their bytes.</typeparam>
+template <class T, bool IS_TRIVIALLY_COPYABLE>
+class SQBulkElementCopier
+{
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SQBulkElementCopier();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructs a sequence of elements over uninitialized memory by calling the copy constructor of every element.
+    /// </summary>
+    /// <param name="arDestination">[IN] The uninitialized memory where the copies will be constructed. It must not overlap the source.</param>
+    /// <param name="arSource">[IN] The elements to copy.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements to copy.</param>
+    static void CopyConstruct(T* arDestination, const T* arSource, const pointer_uint_q uNumberOfElements)
+    {
+        for(pointer_uint_q i = 0; i < uNumberOfElements; ++i)
+            new(arDestination + i) T(arSource[i]);
+    }
+
+    /// <summary>
+    /// Assigns the elements of a sequence to the elements of another sequence by calling the assignment operator of every element.
+    /// </summary>
+    /// <param name="arDestination">[IN] The elements to assign to. They must not overlap the source.</param>
+    /// <param name="arSource">[IN] The elements to copy.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements to assign.</param>
+    static void Assign(T* arDestination, const T* arSource, const pointer_uint_q uNumberOfElements)
+    {
+        for(pointer_uint_q i = 0; i < uNumberOfElements; ++i)
+            arDestination[i] = arSource[i];
+    }
+};
+
+/// <summary>
+/// Copies sequences of trivially copyable elements by copying their bytes.
+/// </summary>
+/// <remarks>
+/// This class is intended to be used internally by SQBulkElementOperations.
+/// </remarks>
+/// <typeparam name="T">The type of the elements.</typeparam>
+template <class T>
+class SQBulkElementCopier<T, true>
+{
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SQBulkElementCopier();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructs a sequence of elements over uninitialized memory by copying the bytes of another sequence.
+    /// </summary>
+    /// <param name="arDestination">[IN] The uninitialized memory where the copies will be constructed. It must not overlap the source.</param>
+    /// <param name="arSource">[IN] The elements to copy.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements to copy.</param>
+    static void CopyConstruct(T* arDestination, const T* arSource, const pointer_uint_q uNumberOfElements)
+    {
+        // The casts tell the compiler that copying the bytes is intended, some types are declared trivially copyable by SQTypeTraits
+        if(uNumberOfElements > 0)
+            memcpy(scast_q(arDestination, void*), scast_q(arSource, const void*), uNumberOfElements * sizeof(T));
+    }
+
+    /// <summary>
+    /// Assigns the elements of a sequence to the elements of another sequence by copying their bytes.
+    /// </summary>
+    /// <param name="arDestination">[IN] The elements to assign to. They must not overlap the source.</param>
+    /// <param name="arSource">[IN] The elements to copy.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements to assign.</param>
+    static void Assign(T* arDestination, const T* arSource, const pointer_uint_q uNumberOfElements)
+    {
+        if(uNumberOfElements > 0)
+            memcpy(scast_q(arDestination, void*), scast_q(arSource, const void*), uNumberOfElements * sizeof(T));
+    }
+};
+
+
+/// <summary>
+/// Performs operations on sequences of contiguous elements, like copying or destroying them, as fast as their type allows.
+/// </summary>
+/// <remarks>
+/// Trivially copyable types are copied with a single memory block copy and trivially destructible types are not destroyed at all; otherwise,
+/// the copy constructor, the assignment operator or the destructor is called for every element. The type properties are provided by SQTypeTraits 
+/// and the way elements are copied is chosen at compile time.<br/>
+/// These operations are intended to be used internally by containers.
+/// </remarks>
+/// <typeparam name="T">The type of the elements.</typeparam>
+template <class T>
+class SQBulkElementOperations
+{
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SQBulkElementOperations();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Constructs a sequence of elements over uninitialized memory by copying another sequence.
+    /// </summary>
+    /// <param name="arDestination">[IN] The uninitialized memory where the copies will be constructed. It must not overlap the source.</param>
+    /// <param name="arSource">[IN] The elements to copy.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements to copy.</param>
+    static void CopyConstruct(T* arDestination, const T* arSource, const pointer_uint_q uNumberOfElements)
+    {
+        SQBulkElementCopier<T, SQTypeTraits<T>::IS_TRIVIALLY_COPYABLE>::CopyConstruct(arDestination, arSource, uNumberOfElements);
+    }
+
+    /// <summary>
+    /// Assigns the elements of a sequence to the elements of another sequence, one by one.
+    /// </summary>
+    /// <param name="arDestination">[IN] The elements to assign to. They must not overlap the source.</param>
+    /// <param name="arSource">[IN] The elements to copy.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements to assign.</param>
+    static void Assign(T* arDestination, const T* arSource, const pointer_uint_q uNumberOfElements)
+    {
+        SQBulkElementCopier<T, SQTypeTraits<T>::IS_TRIVIALLY_COPYABLE>::Assign(arDestination, arSource, uNumberOfElements);
+    }
+
+    /// <summary>
+    /// Calls the destructor of every element in a sequence.
+    /// </summary>
+    /// <param name="arElements">[IN] The elements to destroy.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements to destroy.</param>
+    static void Destroy(T* arElements, const pointer_uint_q uNumberOfElements)
+    {
+        if(!SQTypeTraits<T>::IS_TRIVIALLY_DESTRUCTIBLE)
+        {
+            for(pointer_uint_q i = 0; i < uNumberOfElements; ++i)
+                arElements[i].~T();
+        }
+    }
+};
+
+} // namespace Containers
+} // namespace Tools
+} // namespace QuimeraEngine
+} // namespace Kinesis
+
+#endif // __SQBULKELEMENTOPERATIONS__
@@ -0,0 +1,234 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SQFASTHASH__
+#define __SQFASTHASH__
+
+#include "DataTypesDefinitions.h"
+#include "CommonDefinitions.h"
+
+#if defined(QE_COMPILER_MSVC) && defined(_M_X64)
+    #include <intrin.h>
+#endif
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace DataTypes
+{
+
+/// <summary>
+/// Helper class that calculates 64 bits non-cryptographic hashes, intended to be used in hash tables.
+/// </summary>
+/// <remarks>
+/// It implements the algorithm of wyhash, by Wang Yi, which is based on the multiplication of 64 bits integers and the folding of 
+/// the 128 bits result. It reads 8 or 16 bytes per step, so its cost is much lower than that of hash functions that process 1 byte 
+/// per step, like Jenkins' one-at-a-time, while keeping a good distribution of the results.<br/>
+/// Results depend on the endianness of the machine, so they must not be stored or transmitted.
+/// </remarks>
+class QE_LAYER_COMMON_SYMBOLS SQFastHash
+{
+    // CONSTANTS
+    // ---------------
+private:
+
+    /// <summary>
+    /// The first of the prime numbers used to mix the input data.
+    /// </summary>
+    static const u64_q SECRET0 = 0x2d358dccaa6c78a5ULL;
+
+    /// <summary>
+    /// The second of the prime numbers used to mix the input data.
+    /// </summary>
+    static const u64_q SECRET1 = 0x8bb84b93962eacc9ULL;
+
+    /// <summary>
+    /// The third of the prime numbers used to mix the input data.
+    /// </summary>
+    static const u64_q SECRET2 = 0x4b33a62ed433d4a3ULL;
+
+    /// <summary>
+    /// The fourth of the prime numbers used to mix the input data.
+    /// </summary>
+    static const u64_q SECRET3 = 0x4d5a2da51de1aa47ULL;
+
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Default constructor (hidden).
+    SQFastHash();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calculates the hash of a sequence of bytes.
+    /// </summary>
+    /// <param name="pInput">[IN] The sequence of bytes. It can be null only if the size is zero.</param>
+    /// <param name="uSize">[IN] The number of bytes in the sequence.</param>
+    /// <returns>
+    /// The hash of the sequence.
+    /// </returns>
+    static u64_q Hash(const void* pInput, const pointer_uint_q uSize);
+
+    /// <summary>
+    /// Calculates the hash of a sequence of bytes, using a seed.
+    /// </summary>
+    /// <remarks>
+    /// Different seeds produce unrelated hashes for the same sequence.
+    /// </remarks>
+    /// <param name="pInput">[IN] The sequence of bytes. It can be null only if the size is zero.</param>
+    /// <param name="uSize">[IN] The number of bytes in the sequence.</param>
+    /// <param name="uSeed">[IN] The seed.</param>
+    /// <returns>
+    /// The hash of the sequence.
+    /// </returns>
+    static u64_q Hash(const void* pInput, const pointer_uint_q uSize, const u64_q uSeed);
+
+    /// <summary>
+    /// Calculates the hash of an integer number.
+    /// </summary>
+    /// <remarks>
+    /// All the bits of the input affect all the bits of the result, so numbers that only differ in their highest bits, like 
+    /// aligned addresses, are not grouped together when calculating the remainder of dividing the hash by a number.
+    /// </remarks>
+    /// <param name="uInput">[IN] The integer number.</param>
+    /// <returns>
+    /// The hash of the number.
+    /// </returns>
+    static u64_q HashInteger(const u64_q uInput)
+    {
+        u64_q uA = uInput ^ SQFastHash::SECRET0;
+        u64_q uB = SQFastHash::SECRET2 ^ SQFastHash::SECRET1;
+        SQFastHash::_Multiply(uA, uB);
+
+        return SQFastHash::_Mix(uA ^ SQFastHash::SECRET0, uB ^ SQFastHash::SECRET1);
+    }
+
+    /// <summary>
+    /// Combines two hashes into one, for example, to calculate the hash of a structure from the hashes of its members.
+    /// </summary>
+    /// <remarks>
+    /// The result depends on the order of the operands.
+    /// </remarks>
+    /// <param name="uFirstHash">[IN] The first hash.</param>
+    /// <param name="uSecondHash">[IN] The second hash.</param>
+    /// <returns>
+    /// The combined hash.
+    /// </returns>
+    static u64_q Combine(const u64_q uFirstHash, const u64_q uSecondHash)
+    {
+        return SQFastHash::_Mix(uFirstHash ^ SQFastHash::SECRET0, uSecondHash ^ SQFastHash::SECRET1);
+    }
+
+private:
+
+    /// <summary>
+    /// Multiplies two 64 bits integers, obtaining a 128 bits result.
+    /// </summary>
+    /// <param name="uA">[IN/OUT] The first operand. It receives the lowest 64 bits of the result.</param>
+    /// <param name="uB">[IN/OUT] The second operand. It receives the highest 64 bits of the result.</param>
+    static void _Multiply(u64_q &uA, u64_q &uB)
+    {
+#if defined(QE_COMPILER_GCC) && defined(__SIZEOF_INT128__)
+
+        const unsigned __int128 RESULT = scast_q(uA, unsigned __int128) * uB;
+        uA = scast_q(RESULT, u64_q);
+        uB = scast_q(RESULT >> 64U, u64_q);
+
+#elif defined(QE_COMPILER_MSVC) && defined(_M_X64)
+
+        uA = _umul128(uA, uB, &uB);
+
+#else
+
+        // The operands are split into halves of 32 bits
+        const u64_q A_HIGH = uA >> 32U;
+        const u64_q A_LOW  = uA & 0xFFFFFFFFULL;
+        const u64_q B_HIGH = uB >> 32U;
+        const u64_q B_LOW  = uB & 0xFFFFFFFFULL;
+
+        const u64_q HIGH_HIGH = A_HIGH * B_HIGH;
+        const u64_q HIGH_LOW  = A_HIGH * B_LOW;
+        const u64_q LOW_HIGH  = A_LOW  * B_HIGH;
+        const u64_q LOW_LOW   = A_LOW  * B_LOW;
+
+        const u64_q MIDDLE = (LOW_LOW >> 32U) + (HIGH_LOW & 0xFFFFFFFFULL) + (LOW_HIGH & 0xFFFFFFFFULL);
+
+        uA = (MIDDLE << 32U) | (LOW_LOW & 0xFFFFFFFFULL);
+        uB = HIGH_HIGH + (HIGH_LOW >> 32U) + (LOW_HIGH >> 32U) + (MIDDLE >> 32U);
+
+#endif
+    }
+
+    /// <summary>
+    /// Multiplies two 64 bits integers and folds the 128 bits result into 64 bits.
+    /// </summary>
+    /// <param name="uA">[IN] The first operand.</param>
+    /// <param name="uB">[IN] The second operand.</param>
+    /// <returns>
+    /// The exclusive disjunction of the lowest and the highest halves of the product.
+    /// </returns>
+    static u64_q _Mix(u64_q uA, u64_q uB)
+    {
+        SQFastHash::_Multiply(uA, uB);
+        return uA ^ uB;
+    }
+
+    /// <summary>
+    /// Reads an unaligned 64 bits integer.
+    /// </summary>
+    /// <param name="pInput">[IN] The address of the first byte.</param>
+    /// <returns>
+    /// The integer.
+    /// </returns>
+    static u64_q _Read64(const u8_q* pInput);
+
+    /// <summary>
+    /// Reads an unaligned 32 bits integer.
+    /// </summary>
+    /// <param name="pInput">[IN] The address of the first byte.</param>
+    /// <returns>
+    /// The integer.
+    /// </returns>
+    static u64_q _Read32(const u8_q* pInput);
+};
+
+
+} //namespace DataTypes
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __SQFASTHASH__
@@ -0,0 +1,120 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SQFASTKEYVALUEPAIRHASHPROVIDER__
+#define __SQFASTKEYVALUEPAIRHASHPROVIDER__
+
+#include "ToolsDefinitions.h"
+
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+#include "SQFastHash.h"
+#include "QKeyValuePair.h"
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Represents a hash provider that generates hash keys from key-value pairs, combining the hashes of both the key and the value.
+/// </summary>
+/// <typeparam name="KeyHashProviderT">The hash provider used for the keys. It must provide a static GenerateHash method that returns a 64 bits hash,
+/// like SQFastIntegerHashProvider or SQFastStringHashProvider.</typeparam>
+/// <typeparam name="ValueHashProviderT">The hash provider used for the values. It must provide a static GenerateHash method that returns a 64 bits hash.</typeparam>
+template<class KeyHashProviderT, class ValueHashProviderT>
+class SQFastKeyValuePairHashProvider
+{
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SQFastKeyValuePairHashProvider();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Generates a 64 bits hash from a key-value pair.
+    /// </summary>
+    /// <remarks>
+    /// Pairs whose key and value are swapped produce different hashes.
+    /// </remarks>
+    /// <typeparam name="KeyT">The type of the key.</typeparam>
+    /// <typeparam name="ValueT">The type of the value.</typeparam>
+    /// <param name="input">[IN] A key-value pair.</param>
+    /// <returns>
+    /// A hash.
+    /// </returns>
+    template<class KeyT, class ValueT>
+    static Kinesis::QuimeraEngine::Common::DataTypes::u64_q GenerateHash(const QKeyValuePair<KeyT, ValueT> &input)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQFastHash;
+
+        return SQFastHash::Combine(KeyHashProviderT::GenerateHash(input.GetKey()), ValueHashProviderT::GenerateHash(input.GetValue()));
+    }
+
+    /// <summary>
+    /// Generates a hash key from a key-value pair.
+    /// </summary>
+    /// <remarks>
+    /// It calculates the remainder of dividing the hash of the pair by the number of buckets in the table.
+    /// </remarks>
+    /// <typeparam name="KeyT">The type of the key.</typeparam>
+    /// <typeparam name="ValueT">The type of the value.</typeparam>
+    /// <param name="input">[IN] A key-value pair.</param>
+    /// <param name="uBucketsInTable">[IN] The number of buckets in the table for which the hash key is to be calculated. It must be greater than zero.</param>
+    /// <returns>
+    /// A hash key.
+    /// </returns>
+    template<class KeyT, class ValueT>
+    static Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q GenerateHashKey(const QKeyValuePair<KeyT, ValueT> &input, 
+                                                                                     const Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q uBucketsInTable)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+
+        QE_ASSERT_ERROR(uBucketsInTable > 0, "The input number of buckets must be greater than zero.");
+
+        return scast_q(SQFastKeyValuePairHashProvider::GenerateHash(input) % uBucketsInTable, pointer_uint_q);
+    }
+
+};
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __SQFASTKEYVALUEPAIRHASHPROVIDER__
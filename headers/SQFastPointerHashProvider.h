@@ -0,0 +1,116 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SQFASTPOINTERHASHPROVIDER__
+#define __SQFASTPOINTERHASHPROVIDER__
+
+#include "ToolsDefinitions.h"
+
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+#include "SQFastHash.h"
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Represents a hash provider that generates hash keys from memory addresses.
+/// </summary>
+/// <remarks>
+/// All the bits of the address are mixed, so aligned addresses, whose lowest bits are always zero, are spread across all the buckets.
+/// </remarks>
+class QE_LAYER_TOOLS_SYMBOLS SQFastPointerHashProvider
+{
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SQFastPointerHashProvider();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Generates a 64 bits hash from a memory address.
+    /// </summary>
+    /// <remarks>
+    /// Only the address is used, the pointed object is never accessed.
+    /// </remarks>
+    /// <typeparam name="T">The type of the pointed object.</typeparam>
+    /// <param name="pInput">[IN] A memory address. It can be null.</param>
+    /// <returns>
+    /// A hash.
+    /// </returns>
+    template<class T>
+    static Kinesis::QuimeraEngine::Common::DataTypes::u64_q GenerateHash(const T* pInput)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::SQFastHash;
+        using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+
+        return SQFastHash::HashInteger(rcast_q(pInput, pointer_uint_q));
+    }
+
+    /// <summary>
+    /// Generates a hash key from a memory address.
+    /// </summary>
+    /// <remarks>
+    /// It calculates the remainder of dividing the hash of the address by the number of buckets in the table.
+    /// </remarks>
+    /// <typeparam name="T">The type of the pointed object.</typeparam>
+    /// <param name="pInput">[IN] A memory address. It can be null.</param>
+    /// <param name="uBucketsInTable">[IN] The number of buckets in the table for which the hash key is to be calculated. It must be greater than zero.</param>
+    /// <returns>
+    /// A hash key.
+    /// </returns>
+    template<class T>
+    static Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q GenerateHashKey(const T* pInput, const Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q uBucketsInTable)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+
+        QE_ASSERT_ERROR(uBucketsInTable > 0, "The input number of buckets must be greater than zero.");
+
+        return scast_q(SQFastPointerHashProvider::GenerateHash(pInput) % uBucketsInTable, pointer_uint_q);
+    }
+
+};
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __SQFASTPOINTERHASHPROVIDER__
@@ -0,0 +1,149 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SQFASTVECTORHASHPROVIDER__
+#define __SQFASTVECTORHASHPROVIDER__
+
+#include "ToolsDefinitions.h"
+#include "DataTypesDefinitions.h"
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Math
+{
+    class QBaseVector2;
+    class QBaseVector3;
+    class QBaseVector4;
+}
+
+namespace Containers
+{
+
+/// <summary>
+/// Represents a hash provider that generates hash keys from vectors of 2, 3 or 4 components.
+/// </summary>
+/// <remarks>
+/// The hash is calculated from the bits of the components, so it is only consistent with the equality operator of vectors, 
+/// which uses a tolerance, when components are exact values like grid coordinates or values copied from other vectors. 
+/// Zero and negative zero produce the same hash.
+/// </remarks>
+class QE_LAYER_TOOLS_SYMBOLS SQFastVectorHashProvider
+{
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SQFastVectorHashProvider();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Generates a 64 bits hash from a vector of 2 components.
+    /// </summary>
+    /// <param name="vInput">[IN] A vector.</param>
+    /// <returns>
+    /// A hash.
+    /// </returns>
+    static Kinesis::QuimeraEngine::Common::DataTypes::u64_q GenerateHash(const Kinesis::QuimeraEngine::Tools::Math::QBaseVector2 &vInput);
+
+    /// <summary>
+    /// Generates a 64 bits hash from a vector of 3 components.
+    /// </summary>
+    /// <param name="vInput">[IN] A vector.</param>
+    /// <returns>
+    /// A hash.
+    /// </returns>
+    static Kinesis::QuimeraEngine::Common::DataTypes::u64_q GenerateHash(const Kinesis::QuimeraEngine::Tools::Math::QBaseVector3 &vInput);
+
+    /// <summary>
+    /// Generates a 64 bits hash from a vector of 4 components.
+    /// </summary>
+    /// <param name="vInput">[IN] A vector.</param>
+    /// <returns>
+    /// A hash.
+    /// </returns>
+    static Kinesis::QuimeraEngine::Common::DataTypes::u64_q GenerateHash(const Kinesis::QuimeraEngine::Tools::Math::QBaseVector4 &vInput);
+
+    /// <summary>
+    /// Generates a hash key from a vector of 2 components.
+    /// </summary>
+    /// <remarks>
+    /// It calculates the remainder of dividing the hash of the vector by the number of buckets in the table.
+    /// </remarks>
+    /// <param name="vInput">[IN] A vector.</param>
+    /// <param name="uBucketsInTable">[IN] The number of buckets in the table for which the hash key is to be calculated. It must be greater than zero.</param>
+    /// <returns>
+    /// A hash key.
+    /// </returns>
+    static Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q GenerateHashKey(const Kinesis::QuimeraEngine::Tools::Math::QBaseVector2 &vInput, 
+                                                                                     const Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q uBucketsInTable);
+
+    /// <summary>
+    /// Generates a hash key from a vector of 3 components.
+    /// </summary>
+    /// <remarks>
+    /// It calculates the remainder of dividing the hash of the vector by the number of buckets in the table.
+    /// </remarks>
+    /// <param name="vInput">[IN] A vector.</param>
+    /// <param name="uBucketsInTable">[IN] The number of buckets in the table for which the hash key is to be calculated. It must be greater than zero.</param>
+    /// <returns>
+    /// A hash key.
+    /// </returns>
+    static Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q GenerateHashKey(const Kinesis::QuimeraEngine::Tools::Math::QBaseVector3 &vInput, 
+                                                                                     const Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q uBucketsInTable);
+
+    /// <summary>
+    /// Generates a hash key from a vector of 4 components.
+    /// </summary>
+    /// <remarks>
+    /// It calculates the remainder of dividing the hash of the vector by the number of buckets in the table.
+    /// </remarks>
+    /// <param name="vInput">[IN] A vector.</param>
+    /// <param name="uBucketsInTable">[IN] The number of buckets in the table for which the hash key is to be calculated. It must be greater than zero.</param>
+    /// <returns>
+    /// A hash key.
+    /// </returns>
+    static Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q GenerateHashKey(const Kinesis::QuimeraEngine::Tools::Math::QBaseVector4 &vInput, 
+                                                                                     const Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q uBucketsInTable);
+
+};
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __SQFASTVECTORHASHPROVIDER__
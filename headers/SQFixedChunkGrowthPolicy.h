@@ -0,0 +1,87 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SQFIXEDCHUNKGROWTHPOLICY__
+#define __SQFIXEDCHUNKGROWTHPOLICY__
+
+#include "ToolsDefinitions.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+/// <summary>
+/// Represents a growth policy that makes the capacity of a container grow in chunks of a fixed number of elements every time it is exceeded.
+/// </summary>
+/// <remarks>
+/// The memory reserved beyond the required capacity is bounded by the size of the chunk, at the cost of a number of reallocations 
+/// that is linear with respect to the number of elements.
+/// </remarks>
+/// <typeparam name="CHUNK_SIZE">The number of elements of every chunk. It must be greater than zero.</typeparam>
+template<pointer_uint_q CHUNK_SIZE>
+class SQFixedChunkGrowthPolicy
+{
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SQFixedChunkGrowthPolicy();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Calculates the capacity a container must have when the required capacity exceeds the current one.
+    /// </summary>
+    /// <param name="uRequiredCapacity">[IN] The minimum number of elements the container has to be able to store. It must be greater than zero.</param>
+    /// <returns>
+    /// The new capacity, which is the lowest multiple of the chunk size that is greater than or equal to the required capacity.
+    /// </returns>
+    static pointer_uint_q GetNewCapacity(const pointer_uint_q uRequiredCapacity)
+    {
+        return ((uRequiredCapacity + CHUNK_SIZE - 1U) / CHUNK_SIZE) * CHUNK_SIZE;
+    }
+
+};
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __SQFIXEDCHUNKGROWTHPOLICY__
@@ -0,0 +1,277 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SQPARALLELSORTER__
+#define __SQPARALLELSORTER__
+
+#include "SystemDefinitions.h"
+
+#include "QThread.h"
+#include "QDelegate.h"
+#include "QArrayFixed.h"
+#include "SQSorter.h"
+#include "SQComparatorDefault.h"
+#include "AllocationOperators.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+/// <summary>
+/// Sorts sequences of elements using several threads at the same time.
+/// </summary>
+/// <remarks>
+/// The sequence is divided into as many chunks as threads, which are sorted simultaneously, each one in its own thread. Then pairs of consecutive chunks 
+/// are merged simultaneously too, halving the number of chunks on every step until only one remains.<br/>
+/// Elements are moved by copying their bytes; no assignment operators nor copy constructors are called. Elements are sorted in ascending order,
+/// according to the comparator.<br/>
+/// Linked lists cannot be divided without traversing them, so only contiguous sequences, like arrays, are supported.
+/// </remarks>
+/// <typeparam name="T">The type of the elements to sort.</typeparam>
+/// <typeparam name="ComparatorT">Optional. The type of comparator utilized to compare elements. The default type is SQComparatorDefault.</typeparam>
+template <class T, class ComparatorT = Kinesis::QuimeraEngine::Tools::Containers::SQComparatorDefault<T> >
+class SQParallelSorter
+{
+    // TYPEDEFS
+    // ---------------
+private:
+
+    typedef Kinesis::QuimeraEngine::Tools::Containers::SQSorter<T, ComparatorT> SorterType;
+
+
+    // CONSTANTS
+    // ---------------
+private:
+
+    /// <summary>
+    /// The minimum number of elements that every thread has to sort. Shorter sequences are split among less threads, since 
+    /// the cost of creating a thread would exceed the time spent sorting.
+    /// </summary>
+    static const pointer_uint_q MINIMUM_ELEMENTS_PER_THREAD = 8192U;
+
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SQParallelSorter();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Sorts a sequence of elements using several threads. Every chunk of the sequence is sorted using the introsort algorithm.
+    /// </summary>
+    /// <remarks>
+    /// The sort is not stable, equal elements may not keep their relative order.<br/>
+    /// An auxiliary buffer as big as the sequence is allocated and freed during this operation.
+    /// </remarks>
+    /// <param name="arElements">[IN/OUT] The sequence of elements to sort. It must not be null if the number of elements is greater than zero.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+    /// <param name="uNumberOfThreads">[IN] The maximum number of threads that will sort the sequence simultaneously. It must be greater than zero.</param>
+    static void Sort(T* arElements, const pointer_uint_q uNumberOfElements, const unsigned int uNumberOfThreads)
+    {
+        SQParallelSorter::_Sort(arElements, uNumberOfElements, uNumberOfThreads, &SorterType::Sort, &SQParallelSorter::_SortChunk);
+    }
+
+    /// <summary>
+    /// Sorts the elements of an array using several threads. Every chunk of the array is sorted using the introsort algorithm.
+    /// </summary>
+    /// <remarks>
+    /// The sort is not stable, equal elements may not keep their relative order.<br/>
+    /// An auxiliary buffer as big as the array is allocated and freed during this operation.
+    /// </remarks>
+    /// <typeparam name="AllocatorT">The allocator used by the array.</typeparam>
+    /// <param name="array">[IN/OUT] The array to sort. Dynamic arrays can be sorted too.</param>
+    /// <param name="uNumberOfThreads">[IN] The maximum number of threads that will sort the array simultaneously. It must be greater than zero.</param>
+    template<class AllocatorT>
+    static void Sort(Kinesis::QuimeraEngine::Tools::Containers::QArrayFixed<T, AllocatorT, ComparatorT> &array, const unsigned int uNumberOfThreads)
+    {
+        if(!array.IsEmpty())
+            SQParallelSorter::_Sort(&array[0], array.GetCount(), uNumberOfThreads, &SorterType::Sort, &SQParallelSorter::_SortChunk);
+    }
+
+    /// <summary>
+    /// Sorts a sequence of elements using several threads, keeping the relative order of equal elements. Every chunk of the sequence is sorted 
+    /// using the merge sort algorithm.
+    /// </summary>
+    /// <remarks>
+    /// An auxiliary buffer as big as the sequence is allocated and freed during this operation. Every chunk is sorted using its own part of the buffer, 
+    /// so no more memory is required. If the sequence is sorted in only one chunk, the buffer is half the size of the sequence.
+    /// </remarks>
+    /// <param name="arElements">[IN/OUT] The sequence of elements to sort. It must not be null if the number of elements is greater than zero.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+    /// <param name="uNumberOfThreads">[IN] The maximum number of threads that will sort the sequence simultaneously. It must be greater than zero.</param>
+    static void StableSort(T* arElements, const pointer_uint_q uNumberOfElements, const unsigned int uNumberOfThreads)
+    {
+        SQParallelSorter::_Sort(arElements, uNumberOfElements, uNumberOfThreads, &SorterType::StableSort, &SorterType::StableSort);
+    }
+
+    /// <summary>
+    /// Sorts the elements of an array using several threads, keeping the relative order of equal elements. Every chunk of the array is sorted 
+    /// using the merge sort algorithm.
+    /// </summary>
+    /// <remarks>
+    /// An auxiliary buffer as big as the array is allocated and freed during this operation. Every chunk is sorted using its own part of the buffer, 
+    /// so no more memory is required. If the array is sorted in only one chunk, the buffer is half the size of the array.
+    /// </remarks>
+    /// <typeparam name="AllocatorT">The allocator used by the array.</typeparam>
+    /// <param name="array">[IN/OUT] The array to sort. Dynamic arrays can be sorted too.</param>
+    /// <param name="uNumberOfThreads">[IN] The maximum number of threads that will sort the array simultaneously. It must be greater than zero.</param>
+    template<class AllocatorT>
+    static void StableSort(Kinesis::QuimeraEngine::Tools::Containers::QArrayFixed<T, AllocatorT, ComparatorT> &array, const unsigned int uNumberOfThreads)
+    {
+        if(!array.IsEmpty())
+            SQParallelSorter::_Sort(&array[0], array.GetCount(), uNumberOfThreads, &SorterType::StableSort, &SorterType::StableSort);
+    }
+
+private:
+
+    /// <summary>
+    /// Sorts a sequence of elements using several threads, sorting every chunk with a given function and merging them afterwards.
+    /// </summary>
+    /// <param name="arElements">[IN/OUT] The sequence of elements to sort.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+    /// <param name="uNumberOfThreads">[IN] The maximum number of threads that will sort the sequence simultaneously.</param>
+    /// <param name="pSequenceSortFunction">[IN] The function that sorts the whole sequence when it is not worth dividing it.</param>
+    /// <param name="pChunkSortFunction">[IN] The function that sorts every chunk, which receives the part of the auxiliary buffer that corresponds to the chunk.</param>
+    static void _Sort(T* arElements, 
+                      const pointer_uint_q uNumberOfElements, 
+                      const unsigned int uNumberOfThreads, 
+                      void (*pSequenceSortFunction)(T*, const pointer_uint_q), 
+                      void (*pChunkSortFunction)(T*, const pointer_uint_q, T*))
+    {
+        using Kinesis::QuimeraEngine::Common::QDelegate;
+
+        QE_ASSERT_ERROR(arElements != null_q || uNumberOfElements == 0, "The input sequence must not be null.");
+        QE_ASSERT_ERROR(uNumberOfThreads > 0, "The number of threads must be greater than zero.");
+
+        pointer_uint_q uNumberOfChunks = uNumberOfElements / SQParallelSorter::MINIMUM_ELEMENTS_PER_THREAD;
+
+        if(uNumberOfChunks > uNumberOfThreads)
+            uNumberOfChunks = uNumberOfThreads;
+
+        if(uNumberOfChunks <= 1U)
+        {
+            // It is not worth creating threads
+            pSequenceSortFunction(arElements, uNumberOfElements);
+        }
+        else
+        {
+            // The chunk I occupies the range [arChunkStarts[I], arChunkStarts[I + 1]); the last position stores the end of the sequence
+            pointer_uint_q* arChunkStarts = new pointer_uint_q[uNumberOfChunks + 1U];
+
+            // The remainder of the division is distributed among the first chunks
+            const pointer_uint_q CHUNK_SIZE = uNumberOfElements / uNumberOfChunks;
+            const pointer_uint_q REMAINDER = uNumberOfElements % uNumberOfChunks;
+
+            for(pointer_uint_q i = 0; i <= uNumberOfChunks; ++i)
+                arChunkStarts[i] = CHUNK_SIZE * i + (i < REMAINDER ? i : REMAINDER);
+
+            QThread** arThreads = new QThread*[uNumberOfChunks];
+
+            // Every thread uses the part of the buffer that corresponds to the position of its sequences, so they do not overlap
+            T* arBuffer = scast_q(aligned_alloc_q(uNumberOfElements * sizeof(T), QAlignment(alignof_q(T))), T*);
+
+            // Sorts every chunk in a different thread
+            QDelegate<void (T*, const pointer_uint_q, T*)> chunkSortFunction(pChunkSortFunction);
+
+            for(pointer_uint_q i = 0; i < uNumberOfChunks; ++i)
+                arThreads[i] = new QThread(chunkSortFunction, arElements + arChunkStarts[i], arChunkStarts[i + 1U] - arChunkStarts[i], arBuffer + arChunkStarts[i]);
+
+            SQParallelSorter::_JoinAndDestroyThreads(arThreads, uNumberOfChunks);
+
+            // Merges every pair of consecutive sorted sequences in a different thread
+            QDelegate<void (T*, const pointer_uint_q, const pointer_uint_q, T*)> mergeFunction(&SorterType::Merge);
+
+            for(pointer_uint_q uSortedChunks = 1U; uSortedChunks < uNumberOfChunks; uSortedChunks *= 2U)
+            {
+                pointer_uint_q uNumberOfMerges = 0;
+
+                for(pointer_uint_q uFirstChunk = 0; uFirstChunk + uSortedChunks < uNumberOfChunks; uFirstChunk += uSortedChunks * 2U)
+                {
+                    const pointer_uint_q FIRST = arChunkStarts[uFirstChunk];
+                    const pointer_uint_q MIDDLE = arChunkStarts[uFirstChunk + uSortedChunks];
+                    const pointer_uint_q LAST = arChunkStarts[uFirstChunk + uSortedChunks * 2U < uNumberOfChunks ? uFirstChunk + uSortedChunks * 2U : uNumberOfChunks];
+
+                    arThreads[uNumberOfMerges] = new QThread(mergeFunction, arElements + FIRST, MIDDLE - FIRST, LAST - FIRST, arBuffer + FIRST);
+                    ++uNumberOfMerges;
+                }
+
+                SQParallelSorter::_JoinAndDestroyThreads(arThreads, uNumberOfMerges);
+            }
+
+            aligned_free_q(arBuffer);
+            delete[] arThreads;
+            delete[] arChunkStarts;
+        }
+    }
+
+    /// <summary>
+    /// Sorts a chunk of a sequence of elements using the introsort algorithm, which does not need an auxiliary buffer.
+    /// </summary>
+    /// <param name="arElements">[IN/OUT] The chunk of elements to sort.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the chunk.</param>
+    /// <param name="arBuffer">[IN] The part of the auxiliary buffer that corresponds to the chunk. It is not used.</param>
+    static void _SortChunk(T* arElements, const pointer_uint_q uNumberOfElements, T* arBuffer)
+    {
+        SorterType::Sort(arElements, uNumberOfElements);
+    }
+
+    /// <summary>
+    /// Waits for a set of threads to finish and destroys them.
+    /// </summary>
+    /// <param name="arThreads">[IN/OUT] The threads to wait for.</param>
+    /// <param name="uNumberOfThreads">[IN] The number of threads.</param>
+    static void _JoinAndDestroyThreads(QThread** arThreads, const pointer_uint_q uNumberOfThreads)
+    {
+        for(pointer_uint_q i = 0; i < uNumberOfThreads; ++i)
+        {
+            arThreads[i]->Join();
+            delete arThreads[i];
+            arThreads[i] = null_q;
+        }
+    }
+
+};
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __SQPARALLELSORTER__
@@ -0,0 +1,428 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SQSORTER__
+#define __SQSORTER__
+
+#include <cstring>
+
+#include "DataTypesDefinitions.h"
+#include "ToolsDefinitions.h"
+#include "Assertions.h"
+#include "AllocationOperators.h"
+#include "SQComparatorDefault.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+
+/// <summary>
+/// Implements sorting algorithms that operate on contiguous sequences of elements.
+/// </summary>
+/// <remarks>
+/// Elements are moved by copying their bytes, as containers do when they reallocate or swap elements; no assignment operators nor copy constructors
+/// are called. Elements are sorted in ascending order, according to the comparator.
+/// </remarks>
+/// <typeparam name="T">The type of the elements to sort.</typeparam>
+/// <typeparam name="ComparatorT">Optional. The type of comparator utilized to compare elements. The default type is SQComparatorDefault.</typeparam>
+template <class T, class ComparatorT = SQComparatorDefault<T> >
+class SQSorter
+{
+    // CONSTANTS
+    // ---------------
+private:
+
+    /// <summary>
+    /// The number of elements of a sequence below which it is sorted by insertion, which is faster than partitioning or merging such short sequences.
+    /// </summary>
+    static const pointer_uint_q INSERTION_SORT_THRESHOLD = 16U;
+
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SQSorter();
+
+
+    // METHODS
+    // --------------
+public:
+
+    /// <summary>
+    /// Sorts a sequence of elements using the introsort algorithm.
+    /// </summary>
+    /// <remarks>
+    /// The sequence is partitioned as in quicksort, using the median of three elements as pivot. If the depth of the partitions exceeds twice the
+    /// logarithm of the number of elements, the partition is sorted using heapsort instead, so the worst case takes O(n log n) time.<br/>
+    /// The sort is not stable, equal elements may not keep their relative order. No additional memory is required.
+    /// </remarks>
+    /// <param name="arElements">[IN/OUT] The sequence of elements to sort. It must not be null if the number of elements is greater than zero.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+    static void Sort(T* arElements, const pointer_uint_q uNumberOfElements)
+    {
+        QE_ASSERT_ERROR(arElements != null_q || uNumberOfElements == 0, "The input sequence must not be null.");
+
+        pointer_uint_q uDepthLimit = 0;
+
+        for(pointer_uint_q uCount = uNumberOfElements; uCount > 1U; uCount >>= 1U)
+            uDepthLimit += 2U;
+
+        SQSorter::_IntroSort(arElements, uNumberOfElements, uDepthLimit);
+    }
+
+    /// <summary>
+    /// Sorts a sequence of elements using the merge sort algorithm.
+    /// </summary>
+    /// <remarks>
+    /// The sort is stable, equal elements keep their relative order.<br/>
+    /// It requires an auxiliary buffer whose size is half the size of the sequence, which is allocated and freed during the operation.
+    /// </remarks>
+    /// <param name="arElements">[IN/OUT] The sequence of elements to sort. It must not be null if the number of elements is greater than zero.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+    static void StableSort(T* arElements, const pointer_uint_q uNumberOfElements)
+    {
+        QE_ASSERT_ERROR(arElements != null_q || uNumberOfElements == 0, "The input sequence must not be null.");
+
+        if(uNumberOfElements <= SQSorter::INSERTION_SORT_THRESHOLD)
+        {
+            SQSorter::_InsertionSort(arElements, uNumberOfElements);
+        }
+        else
+        {
+            // The left half of every merge is copied to the buffer, it is never bigger than half the sequence
+            T* arBuffer = scast_q(aligned_alloc_q((uNumberOfElements / 2U) * sizeof(T), QAlignment(alignof_q(T))), T*);
+
+            SQSorter::_MergeSort(arElements, uNumberOfElements, arBuffer);
+
+            aligned_free_q(arBuffer);
+        }
+    }
+
+    /// <summary>
+    /// Sorts a sequence of elements using the merge sort algorithm and an auxiliary buffer provided by the caller.
+    /// </summary>
+    /// <remarks>
+    /// The sort is stable, equal elements keep their relative order.<br/>
+    /// No memory is allocated during the operation.
+    /// </remarks>
+    /// <param name="arElements">[IN/OUT] The sequence of elements to sort. It must not be null if the number of elements is greater than zero.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+    /// <param name="arBuffer">[IN] An auxiliary buffer whose capacity is, at least, half the number of elements. Its content is overwritten. 
+    /// It must not be null if the number of elements is greater than zero.</param>
+    static void StableSort(T* arElements, const pointer_uint_q uNumberOfElements, T* arBuffer)
+    {
+        QE_ASSERT_ERROR(arElements != null_q || uNumberOfElements == 0, "The input sequence must not be null.");
+        QE_ASSERT_ERROR(arBuffer != null_q || uNumberOfElements == 0, "The input buffer must not be null.");
+
+        if(uNumberOfElements <= SQSorter::INSERTION_SORT_THRESHOLD)
+            SQSorter::_InsertionSort(arElements, uNumberOfElements);
+        else
+            SQSorter::_MergeSort(arElements, uNumberOfElements, arBuffer);
+    }
+
+    /// <summary>
+    /// Merges two consecutive sorted sequences of elements so they form one sorted sequence.
+    /// </summary>
+    /// <remarks>
+    /// The merge is stable, when two elements are equal the one that belongs to the first sequence is placed first.
+    /// </remarks>
+    /// <param name="arElements">[IN/OUT] Both sequences of elements, one after the other. It must not be null.</param>
+    /// <param name="uMiddle">[IN] The number of elements in the first sequence, which is also the position of the first element of the second sequence.
+    /// It must not be greater than the total number of elements.</param>
+    /// <param name="uNumberOfElements">[IN] The total number of elements of both sequences.</param>
+    /// <param name="arBuffer">[IN] An auxiliary buffer whose capacity is, at least, the number of elements in the first sequence. Its content is overwritten. 
+    /// It must not be null.</param>
+    static void Merge(T* arElements, 
+                      const pointer_uint_q uMiddle, 
+                      const pointer_uint_q uNumberOfElements, 
+                      T* arBuffer)
+    {
+        QE_ASSERT_ERROR(arElements != null_q, "The input sequence must not be null.");
+        QE_ASSERT_ERROR(arBuffer != null_q, "The input buffer must not be null.");
+        QE_ASSERT_ERROR(uMiddle <= uNumberOfElements, "The middle position must not be greater than the number of elements.");
+
+        // Nothing has to be done if any sequence is empty or the last element of the first sequence is not greater than the first element of the second one
+        if(uMiddle > 0 && uMiddle < uNumberOfElements && ComparatorT::Compare(arElements[uMiddle], arElements[uMiddle - 1U]) < 0)
+        {
+            memcpy(arBuffer, arElements, uMiddle * sizeof(T));
+
+            pointer_uint_q uLeft = 0;
+            pointer_uint_q uRight = uMiddle;
+            pointer_uint_q uDestination = 0;
+
+            // The destination never reaches the next element of the second sequence to be merged
+            while(uLeft < uMiddle && uRight < uNumberOfElements)
+            {
+                if(ComparatorT::Compare(arElements[uRight], arBuffer[uLeft]) < 0)
+                {
+                    memcpy(&arElements[uDestination], &arElements[uRight], sizeof(T));
+                    ++uRight;
+                }
+                else
+                {
+                    memcpy(&arElements[uDestination], &arBuffer[uLeft], sizeof(T));
+                    ++uLeft;
+                }
+
+                ++uDestination;
+            }
+
+            // The remaining elements of the second sequence are already placed
+            memcpy(&arElements[uDestination], &arBuffer[uLeft], (uMiddle - uLeft) * sizeof(T));
+        }
+    }
+
+private:
+
+    /// <summary>
+    /// Sorts a sequence of elements using the introsort algorithm, with a maximum depth of partitions.
+    /// </summary>
+    /// <param name="arElements">[IN/OUT] The sequence of elements to sort.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+    /// <param name="uDepthLimit">[IN] The number of partitions that can be done before switching to heapsort.</param>
+    static void _IntroSort(T* arElements, pointer_uint_q uNumberOfElements, 
+                                          pointer_uint_q uDepthLimit)
+    {
+        // The first partition is sorted iteratively and the second one recursively, so the recursion depth is limited by the depth limit
+        while(uNumberOfElements > SQSorter::INSERTION_SORT_THRESHOLD && uDepthLimit > 0)
+        {
+            --uDepthLimit;
+
+            // The pivot is placed at the first position; the median of three guarantees that both scans of the partition stop before leaving the sequence
+            SQSorter::_MoveMedianToFirst(arElements, 1U, uNumberOfElements / 2U, uNumberOfElements - 1U);
+            const pointer_uint_q CUT = SQSorter::_Partition(arElements, uNumberOfElements);
+
+            SQSorter::_IntroSort(arElements + CUT, uNumberOfElements - CUT, uDepthLimit);
+            uNumberOfElements = CUT;
+        }
+
+        if(uNumberOfElements > SQSorter::INSERTION_SORT_THRESHOLD)
+            SQSorter::_HeapSort(arElements, uNumberOfElements);
+        else
+            SQSorter::_InsertionSort(arElements, uNumberOfElements);
+    }
+
+    /// <summary>
+    /// Moves the element whose value is the median of three elements to the first position of the sequence.
+    /// </summary>
+    /// <param name="arElements">[IN/OUT] The sequence of elements.</param>
+    /// <param name="uA">[IN] The position of the first element to compare. It must not be zero.</param>
+    /// <param name="uB">[IN] The position of the second element to compare. It must not be zero.</param>
+    /// <param name="uC">[IN] The position of the third element to compare. It must not be zero.</param>
+    static void _MoveMedianToFirst(T* arElements, const pointer_uint_q uA, 
+                                                  const pointer_uint_q uB, 
+                                                  const pointer_uint_q uC)
+    {
+        if(ComparatorT::Compare(arElements[uA], arElements[uB]) < 0)
+        {
+            if(ComparatorT::Compare(arElements[uB], arElements[uC]) < 0)
+                SQSorter::_SwapElements(arElements, 0, uB);
+            else if(ComparatorT::Compare(arElements[uA], arElements[uC]) < 0)
+                SQSorter::_SwapElements(arElements, 0, uC);
+            else
+                SQSorter::_SwapElements(arElements, 0, uA);
+        }
+        else if(ComparatorT::Compare(arElements[uA], arElements[uC]) < 0)
+            SQSorter::_SwapElements(arElements, 0, uA);
+        else if(ComparatorT::Compare(arElements[uB], arElements[uC]) < 0)
+            SQSorter::_SwapElements(arElements, 0, uC);
+        else
+            SQSorter::_SwapElements(arElements, 0, uB);
+    }
+
+    /// <summary>
+    /// Partitions a sequence of elements so the elements lower than the pivot are placed before those that are greater than the pivot.
+    /// </summary>
+    /// <remarks>
+    /// The pivot is the first element of the sequence and it is not moved.
+    /// </remarks>
+    /// <param name="arElements">[IN/OUT] The sequence of elements to partition.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+    /// <returns>
+    /// The position of the first element of the second partition.
+    /// </returns>
+    static pointer_uint_q _Partition(T* arElements, const pointer_uint_q uNumberOfElements)
+    {
+        const T &PIVOT = arElements[0];
+        pointer_uint_q uFirst = 1U;
+        pointer_uint_q uLast = uNumberOfElements;
+
+        bool bScansCrossed = false;
+
+        while(!bScansCrossed)
+        {
+            while(ComparatorT::Compare(arElements[uFirst], PIVOT) < 0)
+                ++uFirst;
+
+            --uLast;
+
+            while(ComparatorT::Compare(PIVOT, arElements[uLast]) < 0)
+                --uLast;
+
+            bScansCrossed = uFirst >= uLast;
+
+            if(!bScansCrossed)
+            {
+                SQSorter::_SwapElements(arElements, uFirst, uLast);
+                ++uFirst;
+            }
+        }
+
+        return uFirst;
+    }
+
+    /// <summary>
+    /// Sorts a sequence of elements using the insertion sort algorithm.
+    /// </summary>
+    /// <remarks>
+    /// The sort is stable.
+    /// </remarks>
+    /// <param name="arElements">[IN/OUT] The sequence of elements to sort.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+    static void _InsertionSort(T* arElements, const pointer_uint_q uNumberOfElements)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+
+        for(pointer_uint_q i = 1U; i < uNumberOfElements; ++i)
+        {
+            // Searches for the position of the element among the previous ones, which are already sorted
+            pointer_uint_q uPosition = i;
+
+            while(uPosition > 0 && ComparatorT::Compare(arElements[i], arElements[uPosition - 1U]) < 0)
+                --uPosition;
+
+            if(uPosition != i)
+            {
+                u8_q arBytes[sizeof(T)];
+                memcpy(arBytes, &arElements[i], sizeof(T));
+                memmove(&arElements[uPosition + 1U], &arElements[uPosition], (i - uPosition) * sizeof(T));
+                memcpy(&arElements[uPosition], arBytes, sizeof(T));
+            }
+        }
+    }
+
+    /// <summary>
+    /// Sorts a sequence of elements using the heapsort algorithm.
+    /// </summary>
+    /// <param name="arElements">[IN/OUT] The sequence of elements to sort.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+    static void _HeapSort(T* arElements, const pointer_uint_q uNumberOfElements)
+    {
+        // Builds a max-heap whose root is the greatest element
+        for(pointer_uint_q uParent = uNumberOfElements / 2U; uParent > 0; --uParent)
+            SQSorter::_SiftDown(arElements, uParent - 1U, uNumberOfElements);
+
+        // Moves the root to the end of the heap and restores the heap with the remaining elements
+        for(pointer_uint_q uHeapSize = uNumberOfElements - 1U; uHeapSize > 0; --uHeapSize)
+        {
+            SQSorter::_SwapElements(arElements, 0, uHeapSize);
+            SQSorter::_SiftDown(arElements, 0, uHeapSize);
+        }
+    }
+
+    /// <summary>
+    /// Moves an element down in a max-heap until it is greater than its children.
+    /// </summary>
+    /// <param name="arElements">[IN/OUT] The elements that form the heap.</param>
+    /// <param name="uPosition">[IN] The position of the element to move.</param>
+    /// <param name="uHeapSize">[IN] The number of elements in the heap.</param>
+    static void _SiftDown(T* arElements, pointer_uint_q uPosition, 
+                                         const pointer_uint_q uHeapSize)
+    {
+        pointer_uint_q uChild = uPosition * 2U + 1U;
+
+        while(uChild < uHeapSize)
+        {
+            // Selects the greatest child
+            if(uChild + 1U < uHeapSize && ComparatorT::Compare(arElements[uChild], arElements[uChild + 1U]) < 0)
+                ++uChild;
+
+            if(!(ComparatorT::Compare(arElements[uPosition], arElements[uChild]) < 0))
+                break;
+
+            SQSorter::_SwapElements(arElements, uPosition, uChild);
+            uPosition = uChild;
+            uChild = uPosition * 2U + 1U;
+        }
+    }
+
+    /// <summary>
+    /// Sorts a sequence of elements using the merge sort algorithm.
+    /// </summary>
+    /// <param name="arElements">[IN/OUT] The sequence of elements to sort.</param>
+    /// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+    /// <param name="arBuffer">[IN] An auxiliary buffer whose capacity is, at least, half the number of elements.</param>
+    static void _MergeSort(T* arElements, const pointer_uint_q uNumberOfElements, T* arBuffer)
+    {
+        if(uNumberOfElements <= SQSorter::INSERTION_SORT_THRESHOLD)
+        {
+            SQSorter::_InsertionSort(arElements, uNumberOfElements);
+        }
+        else
+        {
+            const pointer_uint_q MIDDLE = uNumberOfElements / 2U;
+
+            SQSorter::_MergeSort(arElements, MIDDLE, arBuffer);
+            SQSorter::_MergeSort(arElements + MIDDLE, uNumberOfElements - MIDDLE, arBuffer);
+            SQSorter::Merge(arElements, MIDDLE, uNumberOfElements, arBuffer);
+        }
+    }
+
+    /// <summary>
+    /// Swaps two elements by copying their bytes.
+    /// </summary>
+    /// <param name="arElements">[IN/OUT] The sequence that contains both elements.</param>
+    /// <param name="uElementA">[IN] The position of an element.</param>
+    /// <param name="uElementB">[IN] The position of the other element. It must be different from the position of the first element.</param>
+    static void _SwapElements(T* arElements, const pointer_uint_q uElementA, 
+                                             const pointer_uint_q uElementB)
+    {
+        using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+
+        u8_q arBytes[sizeof(T)];
+        memcpy(arBytes,                &arElements[uElementA], sizeof(T));
+        memcpy(&arElements[uElementA], &arElements[uElementB], sizeof(T));
+        memcpy(&arElements[uElementB], arBytes,                sizeof(T));
+    }
+
+};
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __SQSORTER__
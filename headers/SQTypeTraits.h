@@ -0,0 +1,194 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SQTYPETRAITS__
+#define __SQTYPETRAITS__
+
+#include "DataTypesDefinitions.h"
+#include "ToolsDefinitions.h"
+
+#if defined(QE_COMPILER_GCC) && QE_COMPILER_GCC >= 5 && __cplusplus >= 201103L
+    #include <type_traits>
+#endif
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Math
+{
+    // Forward declarations
+    class QBaseVector2;
+    class QBaseVector3;
+    class QBaseVector4;
+    class QVector2;
+    class QVector3;
+    class QVector4;
+    class QBaseMatrix2x2;
+    class QBaseMatrix3x3;
+    class QBaseMatrix3x4;
+    class QBaseMatrix4x3;
+    class QBaseMatrix4x4;
+    class QMatrix2x2;
+    class QMatrix3x3;
+    class QMatrix3x4;
+    class QMatrix4x3;
+    class QMatrix4x4;
+    class QRotationMatrix3x3;
+    class QScalingMatrix3x3;
+    class QTransformationMatrix3x3;
+    class QSpaceConversionMatrix;
+    class QBaseQuaternion;
+    class QQuaternion;
+    class QBaseDualQuaternion;
+    class QDualQuaternion;
+    class QBasePlane;
+    class QPlane;
+}
+
+namespace Containers
+{
+
+
+/// <summary>
+/// Provides information about the properties of a type that containers use to choose the fastest way to copy and destroy elements.
+/// </summary>
+/// <remarks>
+/// A type is trivially copyable when copying an instance is equivalent to copying its bytes, and trivially destructible when 
+/// its destructor does nothing. Both properties are obtained from the compiler when it supports it; otherwise, they are considered false. Older 
+/// compilers, which lack a trivially copyable check, are asked whether the copy constructor, the assignment operator and the destructor are trivial.<br/>
+/// Types whose copy constructor is written by the user are never considered trivially copyable by the compiler, even when they just copy
+/// every member. Such types can be declared trivially copyable by specializing this class, as it is done for the math types.
+/// </remarks>
+/// <typeparam name="T">The type to inspect.</typeparam>
+template <class T>
+class SQTypeTraits
+{
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    // Hidden
+    SQTypeTraits();
+
+
+    // CONSTANTS
+    // ---------------
+public:
+
+#if defined(QE_COMPILER_GCC) && QE_COMPILER_GCC >= 5
+
+    /// <summary>
+    /// Indicates whether the destructor of the type does nothing, so it does not need to be called.
+    /// </summary>
+#if __cplusplus >= 201103L
+    static const bool IS_TRIVIALLY_DESTRUCTIBLE = std::is_trivially_destructible<T>::value;
+#else
+    static const bool IS_TRIVIALLY_DESTRUCTIBLE = __has_trivial_destructor(T);
+#endif
+
+    /// <summary>
+    /// Indicates whether instances of the type can be copied, assigned and relocated by copying their bytes.
+    /// </summary>
+    static const bool IS_TRIVIALLY_COPYABLE = __is_trivially_copyable(T);
+
+#elif defined(QE_COMPILER_MSVC) || defined(QE_COMPILER_GCC)
+
+    /// <summary>
+    /// Indicates whether the destructor of the type does nothing, so it does not need to be called.
+    /// </summary>
+    static const bool IS_TRIVIALLY_DESTRUCTIBLE = __has_trivial_destructor(T);
+
+    /// <summary>
+    /// Indicates whether instances of the type can be copied, assigned and relocated by copying their bytes.
+    /// </summary>
+    static const bool IS_TRIVIALLY_COPYABLE = __has_trivial_copy(T) && __has_trivial_assign(T) && __has_trivial_destructor(T);
+
+#else
+
+    /// <summary>
+    /// Indicates whether the destructor of the type does nothing, so it does not need to be called.
+    /// </summary>
+    static const bool IS_TRIVIALLY_DESTRUCTIBLE = false;
+
+    /// <summary>
+    /// Indicates whether instances of the type can be copied, assigned and relocated by copying their bytes.
+    /// </summary>
+    static const bool IS_TRIVIALLY_COPYABLE = false;
+
+#endif
+};
+
+
+// Math types implement their copy constructors and assignment operators, which just copy every component
+#define QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(TypeName)                      \
+    template<>                                                              \
+    class SQTypeTraits<Kinesis::QuimeraEngine::Tools::Math::TypeName>       \
+    {                                                                       \
+    private:                                                                \
+        SQTypeTraits();                                                     \
+    public:                                                                 \
+        static const bool IS_TRIVIALLY_DESTRUCTIBLE = true;                 \
+        static const bool IS_TRIVIALLY_COPYABLE = true;                     \
+    };
+
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QBaseVector2)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QBaseVector3)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QBaseVector4)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QVector2)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QVector3)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QVector4)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QBaseMatrix2x2)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QBaseMatrix3x3)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QBaseMatrix3x4)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QBaseMatrix4x3)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QBaseMatrix4x4)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QMatrix2x2)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QMatrix3x3)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QMatrix3x4)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QMatrix4x3)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QMatrix4x4)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QRotationMatrix3x3)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QScalingMatrix3x3)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QTransformationMatrix3x3)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QSpaceConversionMatrix)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QBaseQuaternion)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QQuaternion)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QBaseDualQuaternion)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QDualQuaternion)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QBasePlane)
+QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE(QPlane)
+
+#undef QE_SQTYPETRAITS_DECLARE_TRIVIAL_TYPE
+
+} // namespace Containers
+} // namespace Tools
+} // namespace QuimeraEngine
+} // namespace Kinesis
+
+#endif // __SQTYPETRAITS__
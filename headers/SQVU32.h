@@ -0,0 +1,231 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __SQVU32__
+#define __SQVU32__
+
+#include "CommonDefinitions.h"
+#include "DataTypesDefinitions.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::vf32_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace DataTypes
+{
+
+/// <summary>
+/// Helper class that offers bitwise functionality for packs of 4 x 32-bits unsigned integers, stored in 128-bits types.
+/// </summary>
+/// <remarks>
+/// This kind of packs are used in SIMD operations. The same vf32_q type used for floating point values is used, operations only treat its content 
+/// as 128 bits, so any bit pattern is preserved.<br/>
+/// All the operations are inline so they can be used in tight loops without the cost of a function call.
+/// </remarks>
+class QE_LAYER_COMMON_SYMBOLS SQVU32
+{
+
+    // CONSTRUCTORS
+    // ---------------
+private:
+
+    /// <summary>
+    /// Default constructor (hidden).
+    /// </summary>
+    SQVU32();
+
+
+    // METHODS
+    // ---------------
+public:
+
+    /// <summary>
+    /// Packs four input unsigned integers into a 128-bits type.
+    /// </summary>
+    /// <remarks>
+    /// The order of variables in the package must be read from left to right, this is:<br/>
+    ///  | Fourth | Third | Second | First | position<br/>
+    /// 128       96     64        32      0 bit<br/>
+    /// This is endianess-independent.
+    /// </remarks>
+    /// <param name="uFirst">[IN] First value in the packet.</param>
+    /// <param name="uSecond">[IN] Second value in the packet.</param>
+    /// <param name="uThird">[IN] Third value in the packet.</param>
+    /// <param name="uFourth">[IN] Fourth value in the packet.</param>
+    /// <param name="pack">[OUT] The package containing four 32-bits unsigned integers.</param>
+    static void Pack(const u32_q uFirst, const u32_q uSecond, const u32_q uThird, const u32_q uFourth, vf32_q &pack)
+    {
+        pack.m128_u32[0] = uFirst;
+        pack.m128_u32[1] = uSecond;
+        pack.m128_u32[2] = uThird;
+        pack.m128_u32[3] = uFourth;
+    }
+
+    /// <summary>
+    /// Unpacks into four output unsigned integers stored in a 128-bits type.
+    /// </summary>
+    /// <remarks>
+    /// The order of variables in the package is read from left to right, this is:<br/>
+    ///  | Fourth | Third | Second | First | position<br/>
+    /// 128       96     64        32      0 bit<br/>
+    /// This is endianess-independent.
+    /// </remarks>
+    /// <param name="pack">[IN] The package containing four 32-bits unsigned integers.</param>
+    /// <param name="uFirst">[OUT] First value in the packet.</param>
+    /// <param name="uSecond">[OUT] Second value in the packet.</param>
+    /// <param name="uThird">[OUT] Third value in the packet.</param>
+    /// <param name="uFourth">[OUT] Fourth value in the packet.</param>
+    static void Unpack(const vf32_q &pack, u32_q &uFirst, u32_q &uSecond, u32_q &uThird, u32_q &uFourth)
+    {
+        uFirst  = pack.m128_u32[0];
+        uSecond = pack.m128_u32[1];
+        uThird  = pack.m128_u32[2];
+        uFourth = pack.m128_u32[3];
+    }
+
+    /// <summary>
+    /// Loads four contiguous unsigned integers from memory into a 128-bits type.
+    /// </summary>
+    /// <param name="pSource">[IN] The address of the first unsigned integer. It must be aligned to 16 bytes.</param>
+    /// <param name="pack">[OUT] The package containing the four unsigned integers, the first one in the lowest position.</param>
+    static void Load(const u32_q* pSource, vf32_q &pack)
+    {
+        SQVU32::_SetM128(_mm_load_ps(rcast_q(pSource, const float*)), pack);
+    }
+
+    /// <summary>
+    /// Stores the four unsigned integers of a 128-bits type contiguously into memory.
+    /// </summary>
+    /// <param name="pack">[IN] The package containing four unsigned integers.</param>
+    /// <param name="pDestination">[OUT] The address where to store the first unsigned integer. It must be aligned to 16 bytes.</param>
+    static void Store(const vf32_q &pack, u32_q* pDestination)
+    {
+        _mm_store_ps(rcast_q(pDestination, float*), SQVU32::_GetM128(pack));
+    }
+
+    /// <summary>
+    /// Calculates the bitwise AND of two packs.
+    /// </summary>
+    /// <param name="packA">[IN] The first operand.</param>
+    /// <param name="packB">[IN] The second operand.</param>
+    /// <param name="result">[OUT] The result of the operation. It can be any of the operands.</param>
+    static void And(const vf32_q &packA, const vf32_q &packB, vf32_q &result)
+    {
+        SQVU32::_SetM128(_mm_and_ps(SQVU32::_GetM128(packA), SQVU32::_GetM128(packB)), result);
+    }
+
+    /// <summary>
+    /// Calculates the bitwise OR of two packs.
+    /// </summary>
+    /// <param name="packA">[IN] The first operand.</param>
+    /// <param name="packB">[IN] The second operand.</param>
+    /// <param name="result">[OUT] The result of the operation. It can be any of the operands.</param>
+    static void Or(const vf32_q &packA, const vf32_q &packB, vf32_q &result)
+    {
+        SQVU32::_SetM128(_mm_or_ps(SQVU32::_GetM128(packA), SQVU32::_GetM128(packB)), result);
+    }
+
+    /// <summary>
+    /// Calculates the bitwise exclusive OR of two packs.
+    /// </summary>
+    /// <param name="packA">[IN] The first operand.</param>
+    /// <param name="packB">[IN] The second operand.</param>
+    /// <param name="result">[OUT] The result of the operation. It can be any of the operands.</param>
+    static void Xor(const vf32_q &packA, const vf32_q &packB, vf32_q &result)
+    {
+        SQVU32::_SetM128(_mm_xor_ps(SQVU32::_GetM128(packA), SQVU32::_GetM128(packB)), result);
+    }
+
+    /// <summary>
+    /// Calculates the bitwise AND of the complement of a pack and another pack.
+    /// </summary>
+    /// <param name="packA">[IN] The operand whose complement is used.</param>
+    /// <param name="packB">[IN] The second operand.</param>
+    /// <param name="result">[OUT] The result of the operation, (NOT packA) AND packB. It can be any of the operands.</param>
+    static void AndNot(const vf32_q &packA, const vf32_q &packB, vf32_q &result)
+    {
+        SQVU32::_SetM128(_mm_andnot_ps(SQVU32::_GetM128(packA), SQVU32::_GetM128(packB)), result);
+    }
+
+    /// <summary>
+    /// Calculates the bitwise complement of a pack.
+    /// </summary>
+    /// <param name="pack">[IN] The operand.</param>
+    /// <param name="result">[OUT] The result of the operation. It can be the operand.</param>
+    static void Not(const vf32_q &pack, vf32_q &result)
+    {
+        // All the bits of the comparison are set, whatever the content of the pack is
+        const __m128 ZERO = _mm_setzero_ps();
+        const __m128 ALL_BITS = _mm_cmpeq_ps(ZERO, ZERO);
+        SQVU32::_SetM128(_mm_xor_ps(SQVU32::_GetM128(pack), ALL_BITS), result);
+    }
+
+private:
+
+    /// <summary>
+    /// Gets the native SIMD type stored in a pack.
+    /// </summary>
+    /// <param name="pack">[IN] A pack.</param>
+    /// <returns>
+    /// The native SIMD value.
+    /// </returns>
+    static __m128 _GetM128(const vf32_q &pack)
+    {
+    #ifdef QE_COMPILER_MSVC
+        return pack;
+    #else
+        return pack.m128;
+    #endif
+    }
+
+    /// <summary>
+    /// Stores a native SIMD value in a pack.
+    /// </summary>
+    /// <param name="value">[IN] The native SIMD value.</param>
+    /// <param name="pack">[OUT] The pack.</param>
+    static void _SetM128(const __m128 value, vf32_q &pack)
+    {
+    #ifdef QE_COMPILER_MSVC
+        pack = value;
+    #else
+        pack.m128 = value;
+    #endif
+    }
+
+};
+
+} //namespace DataTypes
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __SQVU32__
@@ -26,6 +26,115 @@
 
 #include "AllocationOperators.h"
 
+// To use memcpy
+#include <cstring>
+
+#include "SQAllocationTracker.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::Memory::SQAllocationTracker;
+
+/// <summary>
+/// The size of the header that precedes every tracked block, in bytes. It keeps the blocks aligned to 16 bytes, like the system allocator does.
+/// </summary>
+static const pointer_uint_q TRACKING_HEADER_SIZE = 16U;
+
+/// <summary>
+/// Writes the size and the tag of a tracked block in the header that precedes it.
+/// </summary>
+/// <param name="pMemoryBlock">[IN] The tracked block, as returned to the user.</param>
+/// <param name="uSize">[IN] The size of the block requested by the user.</param>
+/// <param name="uTag">[IN] The tag to which the block is attributed.</param>
+static void WriteTrackingHeader(u8_q* pMemoryBlock, const pointer_uint_q uSize, const u32_q uTag)
+{
+    memcpy(pMemoryBlock - TRACKING_HEADER_SIZE, &uSize, sizeof(pointer_uint_q));
+    memcpy(pMemoryBlock - TRACKING_HEADER_SIZE + sizeof(pointer_uint_q), &uTag, sizeof(u32_q));
+}
+
+/// <summary>
+/// Reads the size and the tag of a tracked block from the header that precedes it.
+/// </summary>
+/// <param name="pMemoryBlock">[IN] The tracked block, as returned to the user.</param>
+/// <param name="uSize">[OUT] The size of the block requested by the user.</param>
+/// <param name="uTag">[OUT] The tag to which the block is attributed.</param>
+static void ReadTrackingHeader(const u8_q* pMemoryBlock, pointer_uint_q &uSize, u32_q &uTag)
+{
+    memcpy(&uSize, pMemoryBlock - TRACKING_HEADER_SIZE, sizeof(pointer_uint_q));
+    memcpy(&uTag, pMemoryBlock - TRACKING_HEADER_SIZE + sizeof(pointer_uint_q), sizeof(u32_q));
+}
+
+/// <summary>
+/// Calculates the space reserved before an aligned tracked block, which is the header padded to the alignment.
+/// </summary>
+/// <param name="alignment">[IN] The alignment of the block.</param>
+/// <returns>
+/// The size of the padded header, in bytes.
+/// </returns>
+static pointer_uint_q GetAlignedTrackingHeaderSize(const QAlignment& alignment)
+{
+    return alignment > TRACKING_HEADER_SIZE ? scast_q(alignment, pointer_uint_q) : TRACKING_HEADER_SIZE;
+}
+
+void* tracked_alloc_q(const pointer_uint_q uSize)
+{
+    u8_q* pMemoryBlock = scast_q(backend_alloc_q(uSize + TRACKING_HEADER_SIZE), u8_q*);
+
+    if(null_q != pMemoryBlock)
+    {
+        const u32_q TAG = SQAllocationTracker::GetCurrentTag();
+
+        pMemoryBlock += TRACKING_HEADER_SIZE;
+        WriteTrackingHeader(pMemoryBlock, uSize, TAG);
+        SQAllocationTracker::NotifyAllocation(TAG, uSize);
+    }
+
+    return pMemoryBlock;
+}
+
+void tracked_free_q(void* pMemoryBlock)
+{
+    if(null_q != pMemoryBlock)
+    {
+        pointer_uint_q uSize = 0;
+        u32_q uTag = 0;
+        ReadTrackingHeader(scast_q(pMemoryBlock, u8_q*), uSize, uTag);
+        SQAllocationTracker::NotifyDeallocation(uTag, uSize);
+
+        backend_free_q(scast_q(pMemoryBlock, u8_q*) - TRACKING_HEADER_SIZE);
+    }
+}
+
+void* tracked_aligned_alloc_q(const pointer_uint_q uSize, const QAlignment& alignment)
+{
+    const pointer_uint_q HEADER_SIZE = GetAlignedTrackingHeaderSize(alignment);
+    u8_q* pMemoryBlock = scast_q(backend_aligned_alloc_q(uSize + HEADER_SIZE, alignment), u8_q*);
+
+    if(null_q != pMemoryBlock)
+    {
+        const u32_q TAG = SQAllocationTracker::GetCurrentTag();
+
+        pMemoryBlock += HEADER_SIZE;
+        WriteTrackingHeader(pMemoryBlock, uSize, TAG);
+        SQAllocationTracker::NotifyAllocation(TAG, uSize);
+    }
+
+    return pMemoryBlock;
+}
+
+void tracked_aligned_free_q(void* pMemoryBlock, const QAlignment& alignment)
+{
+    if(null_q != pMemoryBlock)
+    {
+        pointer_uint_q uSize = 0;
+        u32_q uTag = 0;
+        ReadTrackingHeader(scast_q(pMemoryBlock, u8_q*), uSize, uTag);
+        SQAllocationTracker::NotifyDeallocation(uTag, uSize);
+
+        backend_aligned_free_q(scast_q(pMemoryBlock, u8_q*) - GetAlignedTrackingHeaderSize(alignment), alignment);
+    }
+}
+
 
 void* operator new(const size_t uSize, const QAlignment& alignment)
 {
@@ -40,7 +149,7 @@ void* operator new(const size_t uSize, const QAlignment& alignment)
     QE_ASSERT_ERROR (uSize > 0, "The size of the memory block to reserve cannot be zero");
 
     // If failed, a null pointer is returned from the allocation function.
-    void* p = aligned_alloc_q(uSize, alignment);
+    void* p = operator_aligned_alloc_q(uSize, alignment);
     QE_ASSERT_ERROR (null_q != p, "It was not possible to reserve memory with such alignment");
 
     // If passed, the memory block is aligned according to its corresponding alignment value.
@@ -62,7 +171,7 @@ void* operator new[](const size_t uSize, const QAlignment& alignment)
     QE_ASSERT_ERROR (uSize > 0, "The size of the memory block to reserve cannot be zero");
 
     // If failed, a null pointer is returned from the allocation function.
-    void* p = aligned_alloc_q(uSize, alignment);
+    void* p = operator_aligned_alloc_q(uSize, alignment);
     QE_ASSERT_ERROR (null_q != p, "It was not possible to reserve memory with such alignment");
 
     // If passed, the memory block is aligned according to its regarding alignment value.
@@ -77,7 +186,7 @@ void operator delete(void* pMemoryBlock, const QAlignment& alignment)
     // If failed, the memory block was not aligned according to its corresponding alignment value.
     QE_ASSERT_ERROR ( 0 == ( (rcast_q(pMemoryBlock, pointer_uint_q)) & (alignment - 1) ), "The memory address must be aligned to call this operator" );
 
-    aligned_free_q(pMemoryBlock);
+    operator_aligned_free_q(pMemoryBlock, alignment);
 }
 
 void operator delete[](void* pMemoryBlock, const QAlignment& alignment)
@@ -85,7 +194,7 @@ void operator delete[](void* pMemoryBlock, const QAlignment& alignment)
     // If failed, the memory block was not aligned according to its corresponding alignment value.
     QE_ASSERT_ERROR ( 0 == ( (rcast_q(pMemoryBlock, pointer_uint_q)) & (alignment - 1) ), "The memory address must be aligned to call this operator" );
 
-    aligned_free_q(pMemoryBlock);
+    operator_aligned_free_q(pMemoryBlock, alignment);
 }
 
 #ifdef QE_PREPROCESSOR_EXPORTLIB_COMMON
@@ -94,7 +203,7 @@ void* operator new(const size_t uSize) throw(std::bad_alloc)
 {
     QE_ASSERT_ERROR(uSize != 0, "The size of the block to allocate must be greater than zero");
 
-    void* p = malloc(uSize);
+    void* p = operator_alloc_q(uSize);
 
     QE_ASSERT_ERROR(p != null_q, "Fatal error: No memory could be allocated");
 
@@ -105,7 +214,7 @@ void* operator new(const size_t uSize, const std::nothrow_t& nothrow_value) thro
 {
     QE_ASSERT_ERROR(uSize != 0, "The size of the block to allocate must be greater than zero");
 
-    void* p = malloc(uSize);
+    void* p = operator_alloc_q(uSize);
 
     QE_ASSERT_ERROR(p != null_q, "Fatal error: No memory could be allocated");
 
@@ -116,7 +225,7 @@ void* operator new[](const size_t uSize) throw(std::bad_alloc)
 {
     QE_ASSERT_ERROR(uSize != 0, "The size of the block to allocate must be greater than zero");
 
-    void* p = malloc(uSize);
+    void* p = operator_alloc_q(uSize);
 
     QE_ASSERT_ERROR(p != null_q, "Fatal error: No memory could be allocated");
 
@@ -127,7 +236,7 @@ void* operator new[](const size_t uSize, const std::nothrow_t& nothrow_value) th
 {
     QE_ASSERT_ERROR(uSize != 0, "The size of the block to allocate must be greater than zero");
 
-    void* p = malloc(uSize);
+    void* p = operator_alloc_q(uSize);
 
     QE_ASSERT_ERROR(p != null_q, "Fatal error: No memory could be allocated");
 
@@ -136,22 +245,22 @@ void* operator new[](const size_t uSize, const std::nothrow_t& nothrow_value) th
 
 void operator delete(void* pMemoryBlock) throw()
 {
-    free(pMemoryBlock);
+    operator_free_q(pMemoryBlock);
 }
 
 void operator delete(void* pMemoryBlock, const std::nothrow_t& nothrow_constant) throw()
 {
-    free(pMemoryBlock);
+    operator_free_q(pMemoryBlock);
 }
 
 void operator delete[](void* pMemoryBlock) throw()
 {
-    free(pMemoryBlock);
+    operator_free_q(pMemoryBlock);
 }
 
 void operator delete[](void* pMemoryBlock, const std::nothrow_t& nothrow_constant) throw()
 {
-    free(pMemoryBlock);
+    operator_free_q(pMemoryBlock);
 }
 
 #endif
@@ -0,0 +1,317 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "QAllocationSnapshot.h"
+
+// To use memset and memcpy
+#include <cstring>
+
+#include "Assertions.h"
+#include "AllocationOperators.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace Memory
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QAllocationSnapshot::QAllocationSnapshot() : m_arTags(null_q),
+                                             m_uTagsCount(0)
+{
+}
+
+QAllocationSnapshot::QAllocationSnapshot(const QAllocationSnapshot &snapshot) : m_arTags(null_q),
+                                                                                m_uTagsCount(snapshot.m_uTagsCount)
+{
+    if(m_uTagsCount > 0)
+    {
+        // The statistics are not allocated with the new operator so they are not tracked themselves
+        m_arTags = scast_q(backend_alloc_q(m_uTagsCount * sizeof(QTagStatistics)), QTagStatistics*);
+        memcpy(m_arTags, snapshot.m_arTags, m_uTagsCount * sizeof(QTagStatistics));
+    }
+}
+
+QAllocationSnapshot::QAllocationSnapshot(const u32_q uTagsCount) : m_arTags(null_q),
+                                                                   m_uTagsCount(uTagsCount)
+{
+    if(m_uTagsCount > 0)
+    {
+        m_arTags = scast_q(backend_alloc_q(m_uTagsCount * sizeof(QTagStatistics)), QTagStatistics*);
+        memset(m_arTags, 0, m_uTagsCount * sizeof(QTagStatistics));
+    }
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QAllocationSnapshot::~QAllocationSnapshot()
+{
+    backend_free_q(m_arTags);
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QAllocationSnapshot& QAllocationSnapshot::operator=(const QAllocationSnapshot &snapshot)
+{
+    if(this != &snapshot)
+    {
+        if(m_uTagsCount != snapshot.m_uTagsCount)
+        {
+            backend_free_q(m_arTags);
+            m_arTags = snapshot.m_uTagsCount > 0 ? scast_q(backend_alloc_q(snapshot.m_uTagsCount * sizeof(QTagStatistics)), QTagStatistics*) : null_q;
+            m_uTagsCount = snapshot.m_uTagsCount;
+        }
+
+        if(m_uTagsCount > 0)
+            memcpy(m_arTags, snapshot.m_arTags, m_uTagsCount * sizeof(QTagStatistics));
+    }
+
+    return *this;
+}
+
+QAllocationSnapshot QAllocationSnapshot::GetDifference(const QAllocationSnapshot &previousSnapshot) const
+{
+    QE_ASSERT_ERROR(previousSnapshot.m_uTagsCount <= m_uTagsCount, "The previous snapshot must not contain more tags than this one.");
+
+    QAllocationSnapshot difference(*this);
+
+    for(u32_q uTag = 0; uTag < previousSnapshot.m_uTagsCount && uTag < m_uTagsCount; ++uTag)
+    {
+        const QTagStatistics &PREVIOUS = previousSnapshot.m_arTags[uTag];
+        QTagStatistics &tag = difference.m_arTags[uTag];
+
+        tag.m_nLiveBytes -= PREVIOUS.m_nLiveBytes;
+        tag.m_uAllocations -= PREVIOUS.m_uAllocations;
+        tag.m_uDeallocations -= PREVIOUS.m_uDeallocations;
+        tag.m_uAllocatedBytes -= PREVIOUS.m_uAllocatedBytes;
+
+        for(u32_q uBucket = 0; uBucket < SQAllocationTracker::HISTOGRAM_BUCKETS_COUNT; ++uBucket)
+            tag.m_arHistogram[uBucket] -= PREVIOUS.m_arHistogram[uBucket];
+    }
+
+    return difference;
+}
+
+string_q QAllocationSnapshot::ToString() const
+{
+    static const string_q UNTAGGED("Untagged");
+    static const string_q FILE_OPENING(" (");
+    static const string_q LINE_SEPARATOR(":");
+    static const string_q FILE_CLOSING(")");
+    static const string_q SEPARATOR(": ");
+    static const string_q LIVE_BYTES(" live bytes, high-water mark ");
+    static const string_q HIGH_WATER_MARK(" bytes, ");
+    static const string_q ALLOCATIONS(" allocations, ");
+    static const string_q DEALLOCATIONS(" deallocations, ");
+    static const string_q ALLOCATED_BYTES(" bytes allocated, sizes [");
+    static const string_q BUCKET_LIMIT("<=");
+    static const string_q LAST_BUCKET_LIMIT(">");
+    static const string_q BUCKET_SEPARATOR(", ");
+    static const string_q HISTOGRAM_CLOSING("]");
+    static const string_q NEW_LINE("\n");
+
+    string_q strResult;
+
+    for(u32_q uTag = 0; uTag < m_uTagsCount; ++uTag)
+    {
+        const QTagStatistics &TAG = m_arTags[uTag];
+
+        if(TAG.m_uAllocations == 0 && TAG.m_uDeallocations == 0)
+            continue;
+
+        if(null_q == TAG.m_szName)
+        {
+            strResult.Append(UNTAGGED);
+        }
+        else
+        {
+            strResult.Append(string_q(TAG.m_szName));
+            strResult.Append(FILE_OPENING);
+            strResult.Append(string_q(TAG.m_szFile));
+            strResult.Append(LINE_SEPARATOR);
+            strResult.Append(string_q::FromInteger(TAG.m_nLine));
+            strResult.Append(FILE_CLOSING);
+        }
+
+        strResult.Append(SEPARATOR);
+        strResult.Append(string_q::FromInteger(TAG.m_nLiveBytes));
+        strResult.Append(LIVE_BYTES);
+        strResult.Append(string_q::FromInteger(TAG.m_uHighWaterMark));
+        strResult.Append(HIGH_WATER_MARK);
+        strResult.Append(string_q::FromInteger(TAG.m_uAllocations));
+        strResult.Append(ALLOCATIONS);
+        strResult.Append(string_q::FromInteger(TAG.m_uDeallocations));
+        strResult.Append(DEALLOCATIONS);
+        strResult.Append(string_q::FromInteger(TAG.m_uAllocatedBytes));
+        strResult.Append(ALLOCATED_BYTES);
+
+        bool bFirstBucket = true;
+
+        for(u32_q uBucket = 0; uBucket < SQAllocationTracker::HISTOGRAM_BUCKETS_COUNT; ++uBucket)
+        {
+            if(TAG.m_arHistogram[uBucket] == 0)
+                continue;
+
+            if(!bFirstBucket)
+                strResult.Append(BUCKET_SEPARATOR);
+
+            strResult.Append(uBucket == SQAllocationTracker::HISTOGRAM_BUCKETS_COUNT - 1U ? LAST_BUCKET_LIMIT : BUCKET_LIMIT);
+            strResult.Append(string_q::FromInteger(scast_q(SQAllocationTracker::GetHistogramBucketLimit(uBucket), u64_q)));
+            strResult.Append(SEPARATOR);
+            strResult.Append(string_q::FromInteger(TAG.m_arHistogram[uBucket]));
+            bFirstBucket = false;
+        }
+
+        strResult.Append(HISTOGRAM_CLOSING);
+        strResult.Append(NEW_LINE);
+    }
+
+    return strResult;
+}
+
+i64_q QAllocationSnapshot::GetTotalLiveBytes() const
+{
+    i64_q nTotalLiveBytes = 0;
+
+    for(u32_q uTag = 0; uTag < m_uTagsCount; ++uTag)
+        nTotalLiveBytes += m_arTags[uTag].m_nLiveBytes;
+
+    return nTotalLiveBytes;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+u32_q QAllocationSnapshot::GetTagsCount() const
+{
+    return m_uTagsCount;
+}
+
+const char* QAllocationSnapshot::GetTagName(const u32_q uTag) const
+{
+    QE_ASSERT_ERROR(uTag < m_uTagsCount, "The tag does not exist in the snapshot.");
+
+    return m_arTags[uTag].m_szName;
+}
+
+const char* QAllocationSnapshot::GetTagFile(const u32_q uTag) const
+{
+    QE_ASSERT_ERROR(uTag < m_uTagsCount, "The tag does not exist in the snapshot.");
+
+    return m_arTags[uTag].m_szFile;
+}
+
+int QAllocationSnapshot::GetTagLine(const u32_q uTag) const
+{
+    QE_ASSERT_ERROR(uTag < m_uTagsCount, "The tag does not exist in the snapshot.");
+
+    return m_arTags[uTag].m_nLine;
+}
+
+i64_q QAllocationSnapshot::GetLiveBytes(const u32_q uTag) const
+{
+    QE_ASSERT_ERROR(uTag < m_uTagsCount, "The tag does not exist in the snapshot.");
+
+    return m_arTags[uTag].m_nLiveBytes;
+}
+
+u64_q QAllocationSnapshot::GetHighWaterMark(const u32_q uTag) const
+{
+    QE_ASSERT_ERROR(uTag < m_uTagsCount, "The tag does not exist in the snapshot.");
+
+    return m_arTags[uTag].m_uHighWaterMark;
+}
+
+u64_q QAllocationSnapshot::GetAllocations(const u32_q uTag) const
+{
+    QE_ASSERT_ERROR(uTag < m_uTagsCount, "The tag does not exist in the snapshot.");
+
+    return m_arTags[uTag].m_uAllocations;
+}
+
+u64_q QAllocationSnapshot::GetDeallocations(const u32_q uTag) const
+{
+    QE_ASSERT_ERROR(uTag < m_uTagsCount, "The tag does not exist in the snapshot.");
+
+    return m_arTags[uTag].m_uDeallocations;
+}
+
+u64_q QAllocationSnapshot::GetAllocatedBytes(const u32_q uTag) const
+{
+    QE_ASSERT_ERROR(uTag < m_uTagsCount, "The tag does not exist in the snapshot.");
+
+    return m_arTags[uTag].m_uAllocatedBytes;
+}
+
+u64_q QAllocationSnapshot::GetHistogramCount(const u32_q uTag, const u32_q uBucket) const
+{
+    QE_ASSERT_ERROR(uTag < m_uTagsCount, "The tag does not exist in the snapshot.");
+    QE_ASSERT_ERROR(uBucket < SQAllocationTracker::HISTOGRAM_BUCKETS_COUNT, "The index of the interval must be lower than the number of intervals.");
+
+    return m_arTags[uTag].m_arHistogram[uBucket];
+}
+
+} //namespace Memory
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
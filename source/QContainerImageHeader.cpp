@@ -0,0 +1,124 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "QContainerImageHeader.h"
+
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  CONSTANTS INITIALIZATION  |               ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const u32_q QContainerImageHeader::CONTAINER_TYPE_ARRAY = 1U;
+const u32_q QContainerImageHeader::CONTAINER_TYPE_NTREE = 2U;
+const u32_q QContainerImageHeader::CONTAINER_TYPE_BINARYSEARCHTREE = 3U;
+const u32_q QContainerImageHeader::NULL_POSITION = 0xFFFFFFFFU;
+const u32_q QContainerImageHeader::SIGNATURE = 0x49434551U;
+const u32_q QContainerImageHeader::VERSION = 1U;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QContainerImageHeader::QContainerImageHeader(const u32_q uContainerType, const pointer_uint_q uElementSize, const pointer_uint_q uCount, const u32_q uRoot) :
+                                                        m_uSignature(QContainerImageHeader::SIGNATURE),
+                                                        m_uVersion(QContainerImageHeader::VERSION),
+                                                        m_uContainerType(uContainerType),
+                                                        m_uElementSize(scast_q(uElementSize, u32_q)),
+                                                        m_uCount(scast_q(uCount, u32_q)),
+                                                        m_uRoot(uRoot)
+{
+    QE_ASSERT_ERROR(uCount < QContainerImageHeader::NULL_POSITION, "The number of elements does not fit in a container image.");
+
+    m_arReserved[0] = 0;
+    m_arReserved[1] = 0;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+bool QContainerImageHeader::IsCompatible(const u32_q uContainerType, const pointer_uint_q uElementSize) const
+{
+    return m_uSignature == QContainerImageHeader::SIGNATURE &&
+           m_uVersion == QContainerImageHeader::VERSION &&
+           m_uContainerType == uContainerType &&
+           m_uElementSize == uElementSize;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+pointer_uint_q QContainerImageHeader::GetCount() const
+{
+    return m_uCount;
+}
+
+u32_q QContainerImageHeader::GetRoot() const
+{
+    return m_uRoot;
+}
+
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
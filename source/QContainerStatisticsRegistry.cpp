@@ -0,0 +1,225 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "QContainerStatisticsRegistry.h"
+
+#include "Assertions.h"
+#include "QScopedExclusiveLock.h"
+#include "QScopedSharedLock.h"
+
+using Kinesis::QuimeraEngine::System::Threading::QScopedExclusiveLock;
+using Kinesis::QuimeraEngine::System::Threading::QSharedMutex;
+using Kinesis::QuimeraEngine::System::Threading::QScopedSharedLock;
+using Kinesis::QuimeraEngine::Tools::Containers::QContainerStatistics;
+using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Diagnosis
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QContainerStatisticsRegistry::QContainerStatisticsRegistry()
+{
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QContainerStatisticsRegistry* QContainerStatisticsRegistry::Get()
+{
+    static QContainerStatisticsRegistry registryInstance;
+
+    return &registryInstance;
+}
+
+void QContainerStatisticsRegistry::Add(const string_q &strContainerType, const QContainerStatistics &statistics)
+{
+    QE_ASSERT_ERROR(!strContainerType.IsEmpty(), "The name of the type of container must not be empty.");
+
+    // ---------- Critical section -----------
+    {
+        QScopedExclusiveLock<QSharedMutex> exclusiveLock(m_totalsMutex);
+
+        if(m_totals.ContainsKey(strContainerType))
+        {
+            QContainerStatistics& totals = m_totals.GetValue(strContainerType);
+            totals.AddMemoryUsage(statistics);
+            totals.SetLoadFactor(totals.GetLoadFactor() + statistics.GetLoadFactor());
+            totals.SetAverageDepth(totals.GetAverageDepth() + statistics.GetAverageDepth());
+
+            if(statistics.GetMaximumChainLength() > totals.GetMaximumChainLength())
+                totals.SetMaximumChainLength(statistics.GetMaximumChainLength());
+
+            if(statistics.GetHeight() > totals.GetHeight())
+                totals.SetHeight(statistics.GetHeight());
+
+            ++m_containerCounts.GetValue(strContainerType);
+        }
+        else
+        {
+            m_totals.Add(strContainerType, statistics);
+            m_containerCounts.Add(strContainerType, 1U);
+        }
+
+    } // --------- Critical section ----------
+}
+
+void QContainerStatisticsRegistry::Clear()
+{
+    // ---------- Critical section -----------
+    {
+        QScopedExclusiveLock<QSharedMutex> exclusiveLock(m_totalsMutex);
+
+        m_totals.Clear();
+        m_containerCounts.Clear();
+
+    } // --------- Critical section ----------
+}
+
+QContainerStatistics QContainerStatisticsRegistry::GetTotals(const string_q &strContainerType) const
+{
+    QContainerStatistics totals;
+
+    // ---------- Critical section -----------
+    {
+        QScopedSharedLock<QSharedMutex> sharedLock(m_totalsMutex);
+
+        if(m_totals.ContainsKey(strContainerType))
+        {
+            totals = m_totals.GetValue(strContainerType);
+
+            const float_q NUMBER_OF_CONTAINERS = scast_q(m_containerCounts.GetValue(strContainerType), float_q);
+            totals.SetLoadFactor(totals.GetLoadFactor() / NUMBER_OF_CONTAINERS);
+            totals.SetAverageDepth(totals.GetAverageDepth() / NUMBER_OF_CONTAINERS);
+        }
+
+    } // --------- Critical section ----------
+
+    return totals;
+}
+
+pointer_uint_q QContainerStatisticsRegistry::GetNumberOfContainers(const string_q &strContainerType) const
+{
+    pointer_uint_q uNumberOfContainers = 0;
+
+    // ---------- Critical section -----------
+    {
+        QScopedSharedLock<QSharedMutex> sharedLock(m_totalsMutex);
+
+        if(m_containerCounts.ContainsKey(strContainerType))
+            uNumberOfContainers = m_containerCounts.GetValue(strContainerType);
+
+    } // --------- Critical section ----------
+
+    return uNumberOfContainers;
+}
+
+string_q QContainerStatisticsRegistry::ToString() const
+{
+    static const string_q CONTAINERS(" containers, ");
+    static const string_q ELEMENTS(" elements, capacity ");
+    static const string_q RESERVED(", ");
+    static const string_q USED(" bytes reserved, ");
+    static const string_q UNUSED(" bytes used, ");
+    static const string_q LOAD_FACTOR(" bytes unused, load factor ");
+    static const string_q CHAIN_LENGTH(", maximum chain length ");
+    static const string_q HEIGHT(", height ");
+    static const string_q DEPTH(", average depth ");
+    static const string_q SEPARATOR(": ");
+    static const string_q NEW_LINE("\n");
+
+    string_q strResult;
+
+    // ---------- Critical section -----------
+    {
+        QScopedSharedLock<QSharedMutex> sharedLock(m_totalsMutex);
+
+        StatisticsContainer::ConstIterator itTotals = m_totals.GetFirst();
+        ContainerCountContainer::ConstIterator itCount = m_containerCounts.GetFirst();
+
+        // Both dictionaries contain the same keys, so they are traversed in the same order
+        for(; !itTotals.IsEnd(); ++itTotals, ++itCount)
+        {
+            const QContainerStatistics& TOTALS = itTotals->GetValue();
+            const pointer_uint_q NUMBER_OF_CONTAINERS = itCount->GetValue();
+
+            strResult.Append(itTotals->GetKey());
+            strResult.Append(SEPARATOR);
+            strResult.Append(string_q::FromInteger(scast_q(NUMBER_OF_CONTAINERS, u64_q)));
+            strResult.Append(CONTAINERS);
+            strResult.Append(string_q::FromInteger(scast_q(TOTALS.GetCount(), u64_q)));
+            strResult.Append(ELEMENTS);
+            strResult.Append(string_q::FromInteger(scast_q(TOTALS.GetCapacity(), u64_q)));
+            strResult.Append(RESERVED);
+            strResult.Append(string_q::FromInteger(scast_q(TOTALS.GetReservedBytes(), u64_q)));
+            strResult.Append(USED);
+            strResult.Append(string_q::FromInteger(scast_q(TOTALS.GetUsedBytes(), u64_q)));
+            strResult.Append(UNUSED);
+            strResult.Append(string_q::FromInteger(scast_q(TOTALS.GetUnusedBytes(), u64_q)));
+            strResult.Append(LOAD_FACTOR);
+            strResult.Append(string_q::FromFloat(TOTALS.GetLoadFactor() / scast_q(NUMBER_OF_CONTAINERS, float_q)));
+            strResult.Append(CHAIN_LENGTH);
+            strResult.Append(string_q::FromInteger(scast_q(TOTALS.GetMaximumChainLength(), u64_q)));
+            strResult.Append(HEIGHT);
+            strResult.Append(string_q::FromInteger(scast_q(TOTALS.GetHeight(), u64_q)));
+            strResult.Append(DEPTH);
+            strResult.Append(string_q::FromFloat(TOTALS.GetAverageDepth() / scast_q(NUMBER_OF_CONTAINERS, float_q)));
+            strResult.Append(NEW_LINE);
+        }
+
+    } // --------- Critical section ----------
+
+    return strResult;
+}
+
+} //namespace Diagnosis
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
@@ -0,0 +1,370 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "QLockFreePoolAllocator.h"
+
+#include "AllocationOperators.h"
+// To use memcpy
+#include <cstring>
+
+#include "Assertions.h"
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  CONSTANTS INITIALIZATION  |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const u32_q QLockFreePoolAllocator::END_INDEX = 0xFFFFFFFFU;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QLockFreePoolAllocator::QLockFreePoolAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const QAlignment &alignment) : 
+                                                                                        m_uTop(0),
+                                                                                        m_uAllocatedBlocks(0),
+                                                                                        m_arNextFreeBlocks(null_q),
+                                                                                        m_pFirst(null_q),
+                                                                                        m_uBlockSize(uBlockSize),
+                                                                                        m_uPoolSize(uSize),
+                                                                                        m_uBlocksCount(0),
+                                                                                        m_alignment(alignment)
+{
+    QE_ASSERT_ERROR(0 != uBlockSize, "Block size cannot be zero.");
+    QE_ASSERT_ERROR(uSize >= uBlockSize, "The size of the pool must be, at least, the size of a block.");
+    QE_ASSERT_ERROR(uSize / uBlockSize < QLockFreePoolAllocator::END_INDEX, "The pool cannot have so many blocks.");
+
+    m_pFirst = scast_q(operator new(m_uPoolSize, m_alignment), u8_q*);
+    QE_ASSERT_ERROR(null_q != m_pFirst, "Pointer to allocated memory is null.");
+
+    m_uBlocksCount = scast_q(m_uPoolSize / m_uBlockSize, u32_q);
+
+    m_arNextFreeBlocks = new boost::atomic<u32_q>[m_uBlocksCount];
+    QLockFreePoolAllocator::_LinkFreeBlocks(m_arNextFreeBlocks, 0, m_uBlocksCount, QLockFreePoolAllocator::END_INDEX);
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QLockFreePoolAllocator::~QLockFreePoolAllocator()
+{
+    operator delete(m_pFirst, m_alignment);
+    delete[] m_arNextFreeBlocks;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void* QLockFreePoolAllocator::Allocate()
+{
+    // The acquire order makes the index of the next free block, written by the thread that deallocated the block, visible
+    u64_q uTop = m_uTop.load(boost::memory_order_acquire);
+    u32_q uIndex = QLockFreePoolAllocator::_GetTopIndex(uTop);
+
+    while(uIndex != QLockFreePoolAllocator::END_INDEX)
+    {
+        // The block may be allocated by another thread at this point, in which case the value read here is discarded since the tag will have changed
+        const u32_q NEXT_INDEX = m_arNextFreeBlocks[uIndex].load(boost::memory_order_relaxed);
+        const u64_q NEW_TOP = QLockFreePoolAllocator::_MakeTop(NEXT_INDEX, QLockFreePoolAllocator::_GetTopTag(uTop) + 1U);
+
+        if(m_uTop.compare_exchange_weak(uTop, NEW_TOP, boost::memory_order_acquire, boost::memory_order_acquire))
+            break;
+
+        // uTop contains the current top now
+        uIndex = QLockFreePoolAllocator::_GetTopIndex(uTop);
+    }
+
+    if(uIndex == QLockFreePoolAllocator::END_INDEX)
+        return null_q;
+
+    m_uAllocatedBlocks.fetch_add(1U, boost::memory_order_relaxed);
+
+    return m_pFirst + scast_q(uIndex, pointer_uint_q) * m_uBlockSize;
+}
+
+void QLockFreePoolAllocator::Deallocate(const void* pBlock)
+{
+    QE_ASSERT_ERROR(null_q != pBlock, "Pointer to block to deallocate cannot be null.");
+    QE_ASSERT_ERROR(scast_q(pBlock, const u8_q*) >= m_pFirst && scast_q(pBlock, const u8_q*) < m_pFirst + m_uBlocksCount * m_uBlockSize, 
+                    "Pointer to block to deallocate must be an address provided by this pool allocator.");
+
+    const u32_q INDEX = scast_q((scast_q(pBlock, const u8_q*) - m_pFirst) / m_uBlockSize, u32_q);
+
+    m_uAllocatedBlocks.fetch_sub(1U, boost::memory_order_relaxed);
+
+    u64_q uTop = m_uTop.load(boost::memory_order_relaxed);
+
+    do
+    {
+        m_arNextFreeBlocks[INDEX].store(QLockFreePoolAllocator::_GetTopIndex(uTop), boost::memory_order_relaxed);
+    }
+    // The release order publishes both the index of the next free block and the writes made to the block before deallocating it
+    while(!m_uTop.compare_exchange_weak(uTop, 
+                                        QLockFreePoolAllocator::_MakeTop(INDEX, QLockFreePoolAllocator::_GetTopTag(uTop) + 1U), 
+                                        boost::memory_order_release, 
+                                        boost::memory_order_relaxed));
+}
+
+void QLockFreePoolAllocator::Clear()
+{
+    QLockFreePoolAllocator::_LinkFreeBlocks(m_arNextFreeBlocks, 0, m_uBlocksCount, QLockFreePoolAllocator::END_INDEX);
+
+    const u64_q TOP = m_uTop.load(boost::memory_order_relaxed);
+    m_uTop.store(QLockFreePoolAllocator::_MakeTop(0, QLockFreePoolAllocator::_GetTopTag(TOP) + 1U), boost::memory_order_release);
+    m_uAllocatedBlocks.store(0, boost::memory_order_relaxed);
+}
+
+void QLockFreePoolAllocator::CopyTo(QLockFreePoolAllocator &poolAllocator) const
+{
+    QE_ASSERT_ERROR(m_uBlockSize == poolAllocator.m_uBlockSize, "Block sizes of origin and destination pool allocators must be equal.");
+    QE_ASSERT_ERROR(m_uBlocksCount <= poolAllocator.m_uBlocksCount, "Blocks count of destination pool allocator must be greater or equal than the source pool allocator.");
+    QE_ASSERT_WARNING(m_alignment == poolAllocator.m_alignment, "The alignment of the input allocator is different from the resident allocator's.");
+
+    memcpy(poolAllocator.m_pFirst, m_pFirst, m_uBlocksCount * m_uBlockSize);
+
+    const u64_q SOURCE_TOP = m_uTop.load(boost::memory_order_acquire);
+    const u64_q DESTINATION_TOP = poolAllocator.m_uTop.load(boost::memory_order_relaxed);
+
+    const u32_q FIRST_INDEX = QLockFreePoolAllocator::_CopyFreeBlocks(m_arNextFreeBlocks, 
+                                                                      QLockFreePoolAllocator::_GetTopIndex(SOURCE_TOP), 
+                                                                      m_uBlocksCount, 
+                                                                      poolAllocator.m_arNextFreeBlocks, 
+                                                                      poolAllocator.m_uBlocksCount);
+
+    poolAllocator.m_uTop.store(QLockFreePoolAllocator::_MakeTop(FIRST_INDEX, QLockFreePoolAllocator::_GetTopTag(DESTINATION_TOP) + 1U), boost::memory_order_release);
+    poolAllocator.m_uAllocatedBlocks.store(m_uAllocatedBlocks.load(boost::memory_order_relaxed), boost::memory_order_relaxed);
+}
+
+void QLockFreePoolAllocator::Reallocate(const pointer_uint_q uNewSize)
+{
+    QE_ASSERT_WARNING(uNewSize > m_uPoolSize, "The new size must be greater than the current size of the pool.");
+    QE_ASSERT_ERROR(uNewSize / m_uBlockSize < QLockFreePoolAllocator::END_INDEX, "The pool cannot have so many blocks.");
+
+    if(uNewSize > m_uPoolSize)
+        this->_ReplaceBuffers(uNewSize);
+}
+
+void QLockFreePoolAllocator::Shrink(const pointer_uint_q uNewSize)
+{
+    QE_ASSERT_WARNING(uNewSize < m_uPoolSize, "The new size must be lower than the current size of the pool.");
+    QE_ASSERT_ERROR(uNewSize >= m_uBlockSize, "The new size must be, at least, the size of a block.");
+
+    if(uNewSize < m_uPoolSize && uNewSize >= m_uBlockSize)
+    {
+        const u32_q NEW_BLOCKS_COUNT = scast_q(uNewSize / m_uBlockSize, u32_q);
+
+        // Counts how many free blocks lie beyond the new size; all of them must be free
+        u32_q uDiscardedFreeBlocks = 0;
+
+        for(u32_q uIndex = QLockFreePoolAllocator::_GetTopIndex(m_uTop.load(boost::memory_order_relaxed)); 
+            uIndex != QLockFreePoolAllocator::END_INDEX; 
+            uIndex = m_arNextFreeBlocks[uIndex].load(boost::memory_order_relaxed))
+        {
+            if(uIndex >= NEW_BLOCKS_COUNT)
+                ++uDiscardedFreeBlocks;
+        }
+
+        const bool ALL_DISCARDED_BLOCKS_ARE_FREE = uDiscardedFreeBlocks == m_uBlocksCount - NEW_BLOCKS_COUNT;
+
+        QE_ASSERT_ERROR(ALL_DISCARDED_BLOCKS_ARE_FREE, "Some of the allocated blocks lie beyond the new size of the pool.");
+
+        if(ALL_DISCARDED_BLOCKS_ARE_FREE)
+            this->_ReplaceBuffers(uNewSize);
+    }
+}
+
+void QLockFreePoolAllocator::_ReplaceBuffers(const pointer_uint_q uNewSize)
+{
+    const u32_q NEW_BLOCKS_COUNT = scast_q(uNewSize / m_uBlockSize, u32_q);
+    const u32_q COPIED_BLOCKS_COUNT = NEW_BLOCKS_COUNT < m_uBlocksCount ? NEW_BLOCKS_COUNT : m_uBlocksCount;
+
+    u8_q* pNewFirst = scast_q(operator new(uNewSize, m_alignment), u8_q*);
+    QE_ASSERT_ERROR(null_q != pNewFirst, "Pointer to allocated memory is null.");
+
+    memcpy(pNewFirst, m_pFirst, COPIED_BLOCKS_COUNT * m_uBlockSize);
+
+    boost::atomic<u32_q>* arNewNextFreeBlocks = new boost::atomic<u32_q>[NEW_BLOCKS_COUNT];
+
+    const u64_q TOP = m_uTop.load(boost::memory_order_relaxed);
+
+    const u32_q FIRST_INDEX = QLockFreePoolAllocator::_CopyFreeBlocks(m_arNextFreeBlocks, 
+                                                                      QLockFreePoolAllocator::_GetTopIndex(TOP), 
+                                                                      m_uBlocksCount, 
+                                                                      arNewNextFreeBlocks, 
+                                                                      NEW_BLOCKS_COUNT);
+
+    operator delete(m_pFirst, m_alignment);
+    delete[] m_arNextFreeBlocks;
+
+    m_pFirst = pNewFirst;
+    m_arNextFreeBlocks = arNewNextFreeBlocks;
+    m_uBlocksCount = NEW_BLOCKS_COUNT;
+    m_uPoolSize = uNewSize;
+
+    m_uTop.store(QLockFreePoolAllocator::_MakeTop(FIRST_INDEX, QLockFreePoolAllocator::_GetTopTag(TOP) + 1U), boost::memory_order_release);
+}
+
+void QLockFreePoolAllocator::_LinkFreeBlocks(boost::atomic<u32_q>* arNextFreeBlocks, const u32_q uFirstIndex, const u32_q uEndIndex, const u32_q uNextIndex)
+{
+    for(u32_q uIndex = uFirstIndex; uIndex < uEndIndex - 1U; ++uIndex)
+        arNextFreeBlocks[uIndex].store(uIndex + 1U, boost::memory_order_relaxed);
+
+    arNextFreeBlocks[uEndIndex - 1U].store(uNextIndex, boost::memory_order_relaxed);
+}
+
+u32_q QLockFreePoolAllocator::_CopyFreeBlocks(const boost::atomic<u32_q>* arSourceNextFreeBlocks, 
+                                              const u32_q uSourceFirstIndex, 
+                                              const u32_q uSourceBlocksCount, 
+                                              boost::atomic<u32_q>* arDestinationNextFreeBlocks, 
+                                              const u32_q uDestinationBlocksCount)
+{
+    u32_q uFirstIndex = QLockFreePoolAllocator::END_INDEX;
+    u32_q uLastIndex = QLockFreePoolAllocator::END_INDEX;
+
+    // Copies the free blocks that exist in the destination, keeping their order
+    for(u32_q uIndex = uSourceFirstIndex; uIndex != QLockFreePoolAllocator::END_INDEX; uIndex = arSourceNextFreeBlocks[uIndex].load(boost::memory_order_relaxed))
+    {
+        if(uIndex < uDestinationBlocksCount)
+        {
+            if(uLastIndex == QLockFreePoolAllocator::END_INDEX)
+                uFirstIndex = uIndex;
+            else
+                arDestinationNextFreeBlocks[uLastIndex].store(uIndex, boost::memory_order_relaxed);
+
+            uLastIndex = uIndex;
+        }
+    }
+
+    // Appends the blocks that do not exist in the source
+    u32_q uAppendedIndex = QLockFreePoolAllocator::END_INDEX;
+
+    if(uSourceBlocksCount < uDestinationBlocksCount)
+    {
+        uAppendedIndex = uSourceBlocksCount;
+        QLockFreePoolAllocator::_LinkFreeBlocks(arDestinationNextFreeBlocks, uSourceBlocksCount, uDestinationBlocksCount, QLockFreePoolAllocator::END_INDEX);
+    }
+
+    if(uLastIndex == QLockFreePoolAllocator::END_INDEX)
+        uFirstIndex = uAppendedIndex;
+    else
+        arDestinationNextFreeBlocks[uLastIndex].store(uAppendedIndex, boost::memory_order_relaxed);
+
+    return uFirstIndex;
+}
+
+u64_q QLockFreePoolAllocator::_MakeTop(const u32_q uIndex, const u32_q uTag)
+{
+    return (scast_q(uTag, u64_q) << 32U) | scast_q(uIndex, u64_q);
+}
+
+u32_q QLockFreePoolAllocator::_GetTopIndex(const u64_q uTop)
+{
+    return scast_q(uTop & 0xFFFFFFFFULL, u32_q);
+}
+
+u32_q QLockFreePoolAllocator::_GetTopTag(const u64_q uTop)
+{
+    return scast_q(uTop >> 32U, u32_q);
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+pointer_uint_q QLockFreePoolAllocator::GetTotalSize() const
+{
+    return m_uPoolSize + m_uBlocksCount * sizeof(boost::atomic<u32_q>);
+}
+
+pointer_uint_q QLockFreePoolAllocator::GetPoolSize() const
+{
+    return m_uPoolSize;
+}
+
+bool QLockFreePoolAllocator::CanAllocate() const
+{
+    return QLockFreePoolAllocator::_GetTopIndex(m_uTop.load(boost::memory_order_relaxed)) != QLockFreePoolAllocator::END_INDEX;
+}
+
+pointer_uint_q QLockFreePoolAllocator::GetAllocatedBytes() const
+{
+    return m_uAllocatedBlocks.load(boost::memory_order_relaxed) * m_uBlockSize;
+}
+
+void* QLockFreePoolAllocator::GetPointer() const
+{
+    return m_pFirst;
+}
+
+QAlignment QLockFreePoolAllocator::GetAlignment() const
+{
+    return m_alignment;
+}
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
@@ -66,7 +66,31 @@ QPoolAllocator::QPoolAllocator(const pointer_uint_q uSize, const pointer_uint_q
             m_uPoolSize(uSize),
             m_uAllocatedBytes(0),
             m_uAlignment(alignment),
-            m_bNeedDestroyMemoryChunk(true)
+            m_bNeedDestroyMemoryChunk(true),
+            m_uFirstUnusedBlock(0),
+            m_bIntrusiveFreeList(false)
+{
+    QE_ASSERT_ERROR( 0 != uSize, "Size cannot be zero"  );
+    QE_ASSERT_ERROR( 0 != uBlockSize, "Block size cannot be zero" );
+
+    m_pAllocatedMemory = operator new(m_uPoolSize, alignment);
+    QE_ASSERT_ERROR( null_q != m_pAllocatedMemory, "Pointer to allocated memory is null" );
+
+    m_pFirst = m_pAllocatedMemory;
+
+    m_uBlocksCount = m_uPoolSize / uBlockSize;
+
+    this->AllocateFreeBlocksList();
+}
+
+QPoolAllocator::QPoolAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const QAlignment &alignment, const bool bUseIntrusiveFreeList) :
+            m_uBlockSize(uBlockSize),
+            m_uPoolSize(uSize),
+            m_uAllocatedBytes(0),
+            m_uAlignment(alignment),
+            m_bNeedDestroyMemoryChunk(true),
+            m_uFirstUnusedBlock(0),
+            m_bIntrusiveFreeList(bUseIntrusiveFreeList && uBlockSize >= sizeof(void**)) // The address of the next free block must fit in a block
 {
     QE_ASSERT_ERROR( 0 != uSize, "Size cannot be zero"  );
     QE_ASSERT_ERROR( 0 != uBlockSize, "Block size cannot be zero" );
@@ -86,7 +110,9 @@ QPoolAllocator::QPoolAllocator(const pointer_uint_q uSize, const pointer_uint_q
             m_uPoolSize(uSize),
             m_uAllocatedBytes(0),
             m_uAlignment(QAlignment(sizeof(void**))),
-            m_bNeedDestroyMemoryChunk(false)
+            m_bNeedDestroyMemoryChunk(false),
+            m_uFirstUnusedBlock(0),
+            m_bIntrusiveFreeList(false)
 {
     QE_ASSERT_ERROR( 0 != uSize, "Size cannot be zero" );
     QE_ASSERT_ERROR( 0 != uBlockSize, "Block size cannot be zero" );
@@ -110,7 +136,36 @@ QPoolAllocator::QPoolAllocator(const pointer_uint_q uSize, const pointer_uint_q
             m_uPoolSize(uSize),
             m_uAllocatedBytes(0),
             m_uAlignment(alignment),
-            m_bNeedDestroyMemoryChunk(false)
+            m_bNeedDestroyMemoryChunk(false),
+            m_uFirstUnusedBlock(0),
+            m_bIntrusiveFreeList(false)
+{
+    QE_ASSERT_ERROR( 0 != uSize, "Size cannot be zero" );
+    QE_ASSERT_ERROR( 0 != uBlockSize, "Block size cannot be zero" );
+    QE_ASSERT_ERROR( 0 != pBuffer, "Pointer to buffer cannot be null" );
+
+    pointer_uint_q uAdjustment = alignment - ((pointer_uint_q)pBuffer & (alignment - 1));
+
+    if(uAdjustment == alignment )
+        uAdjustment = 0;
+
+    m_pAllocatedMemory = (void**)((pointer_uint_q)pBuffer + uAdjustment);
+    m_pFirst = m_pAllocatedMemory;
+    m_uPoolSize -= uAdjustment; // Some free space is lost
+
+    m_uBlocksCount = m_uPoolSize / uBlockSize;
+
+    this->AllocateFreeBlocksList();
+}
+
+QPoolAllocator::QPoolAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const void *pBuffer, const QAlignment &alignment, const bool bUseIntrusiveFreeList) :
+            m_uBlockSize(uBlockSize),
+            m_uPoolSize(uSize),
+            m_uAllocatedBytes(0),
+            m_uAlignment(alignment),
+            m_bNeedDestroyMemoryChunk(false),
+            m_uFirstUnusedBlock(0),
+            m_bIntrusiveFreeList(bUseIntrusiveFreeList && uBlockSize >= sizeof(void**)) // The address of the next free block must fit in a block
 {
     QE_ASSERT_ERROR( 0 != uSize, "Size cannot be zero" );
     QE_ASSERT_ERROR( 0 != uBlockSize, "Block size cannot be zero" );
@@ -159,6 +214,32 @@ QPoolAllocator::~QPoolAllocator()
 
 void* QPoolAllocator::Allocate()
 {
+    if(m_bIntrusiveFreeList)
+    {
+        void* pBlock = null_q;
+
+        if(null_q != m_ppNextFreeBlock)
+        {
+            // The first bytes of a free block store the address of the next free block
+            pBlock = m_ppNextFreeBlock;
+            memcpy(&m_ppNextFreeBlock, pBlock, sizeof(void**));
+        }
+        else if(m_uFirstUnusedBlock < m_uBlocksCount)
+        {
+            // Blocks that have never been allocated are not in the list, they are taken in ascending order
+            pBlock = (void*)((pointer_uint_q)m_pFirst + m_uFirstUnusedBlock * m_uBlockSize);
+            ++m_uFirstUnusedBlock;
+        }
+        else
+        {
+            return null_q;
+        }
+
+        m_uAllocatedBytes += m_uBlockSize;
+
+        return pBlock;
+    }
+
     if( null_q == m_ppNextFreeBlock )
         return null_q;
 
@@ -181,13 +262,22 @@ void QPoolAllocator::Deallocate(const void* pBlock)
 
     m_uAllocatedBytes -= m_uBlockSize;
 
-    // Calculates the address in the blocks pointers list of the block to deallocate.
-    // ppDeallocatedBlock = m_ppFreeBlocks + Index of the block to deallocate
-    void **ppDeallocatedBlock = m_ppFreeBlocks + (((pointer_uint_q)pBlock - (pointer_uint_q)m_pFirst) / m_uBlockSize);
+    if(m_bIntrusiveFreeList)
+    {
+        // Inserts the block at the beginning of the list, storing the address of the former first free block in it
+        memcpy((void*)pBlock, &m_ppNextFreeBlock, sizeof(void**));
+        m_ppNextFreeBlock = (void**)pBlock;
+    }
+    else
+    {
+        // Calculates the address in the blocks pointers list of the block to deallocate.
+        // ppDeallocatedBlock = m_ppFreeBlocks + Index of the block to deallocate
+        void **ppDeallocatedBlock = m_ppFreeBlocks + (((pointer_uint_q)pBlock - (pointer_uint_q)m_pFirst) / m_uBlockSize);
 
-    // Inserts at the beginning of the free blocks pointers list the deallocated block.
-    *ppDeallocatedBlock = m_ppNextFreeBlock;
-    m_ppNextFreeBlock = (void**)ppDeallocatedBlock;
+        // Inserts at the beginning of the free blocks pointers list the deallocated block.
+        *ppDeallocatedBlock = m_ppNextFreeBlock;
+        m_ppNextFreeBlock = (void**)ppDeallocatedBlock;
+    }
 }
 
 
@@ -203,8 +293,20 @@ void QPoolAllocator::CopyTo(QPoolAllocator &poolAllocator) const
     QE_ASSERT_ERROR(m_uPoolSize <= poolAllocator.m_uPoolSize, "Chunk size for allocations must be greater or equal in the destination pool allocator than in the source pool allocator" );
     QE_ASSERT_ERROR(m_uBlockSize == poolAllocator.m_uBlockSize, "Block sizes of origin and destination pool allocators must be equal");
     QE_ASSERT_WARNING(poolAllocator.m_uAlignment == m_uAlignment, "The alignment of the input allocator is different from the resident allocator's.");
+    QE_ASSERT_ERROR(m_bIntrusiveFreeList == poolAllocator.m_bIntrusiveFreeList, "Both pool allocators must store the list of free blocks in the same way");
+
+    // Copies all source blocks in destination
+    memcpy(poolAllocator.m_pFirst, m_pFirst, m_uBlockSize * m_uBlocksCount);
 
-    if(null_q == m_ppNextFreeBlock)
+    if(m_bIntrusiveFreeList)
+    {
+        // The free blocks are linked again in the destination, in the same order
+        poolAllocator.m_ppNextFreeBlock = this->CopyIntrusiveFreeList(poolAllocator.m_pFirst, poolAllocator.m_uBlocksCount);
+
+        // The extra blocks of the destination are taken after the unused blocks of the source
+        poolAllocator.m_uFirstUnusedBlock = m_uFirstUnusedBlock;
+    }
+    else if(null_q == m_ppNextFreeBlock)
     {
         // No free blocks in source. Append extra destination free blocks pointers if it has more blocks count.
         if(m_uBlocksCount < poolAllocator.m_uBlocksCount)
@@ -272,9 +374,6 @@ void QPoolAllocator::CopyTo(QPoolAllocator &poolAllocator) const
         }
     }
 
-    // Copies all source blocks in destination
-    memcpy(poolAllocator.m_pFirst, m_pFirst, m_uBlockSize * m_uBlocksCount);
-
     poolAllocator.m_uAllocatedBytes = m_uAllocatedBytes;
 }
 
@@ -309,29 +408,155 @@ void QPoolAllocator::Reallocate(const pointer_uint_q uNewSize, const void* pNewL
     }
 }
 
+void QPoolAllocator::Shrink(const pointer_uint_q uNewSize)
+{
+    QE_ASSERT_WARNING(uNewSize < m_uPoolSize, "The new size must be lower than the current size of the pool.");
+    QE_ASSERT_ERROR(uNewSize >= m_uBlockSize, "The new size must be, at least, the size of a block.");
+
+    const pointer_uint_q NEW_BLOCKS_COUNT = uNewSize / m_uBlockSize;
+
+    // Counts how many free blocks lie beyond the new size; all of them must be free
+    pointer_uint_q uDiscardedFreeBlocks = 0;
+
+    if(uNewSize < m_uPoolSize && uNewSize >= m_uBlockSize && m_bIntrusiveFreeList)
+    {
+        for(void** ppFreeBlock = m_ppNextFreeBlock; ppFreeBlock != null_q; memcpy(&ppFreeBlock, ppFreeBlock, sizeof(void**)))
+        {
+            if(((pointer_uint_q)ppFreeBlock - (pointer_uint_q)m_pFirst) / m_uBlockSize >= NEW_BLOCKS_COUNT)
+                ++uDiscardedFreeBlocks;
+        }
+
+        // Blocks that have never been allocated are free too
+        uDiscardedFreeBlocks += m_uBlocksCount - (m_uFirstUnusedBlock > NEW_BLOCKS_COUNT ? m_uFirstUnusedBlock : NEW_BLOCKS_COUNT);
+    }
+    else if(uNewSize < m_uPoolSize && uNewSize >= m_uBlockSize)
+    {
+        for(void** ppFreeBlock = m_ppNextFreeBlock; ppFreeBlock != null_q; ppFreeBlock = (void**)*ppFreeBlock)
+        {
+            if(pointer_uint_q(ppFreeBlock - m_ppFreeBlocks) >= NEW_BLOCKS_COUNT)
+                ++uDiscardedFreeBlocks;
+        }
+    }
+
+    const bool ALL_DISCARDED_BLOCKS_ARE_FREE = uDiscardedFreeBlocks == m_uBlocksCount - NEW_BLOCKS_COUNT;
+
+    QE_ASSERT_ERROR(ALL_DISCARDED_BLOCKS_ARE_FREE, "Some of the allocated blocks lie beyond the new size of the pool.");
+
+    if(uNewSize < m_uPoolSize && uNewSize >= m_uBlockSize && ALL_DISCARDED_BLOCKS_ARE_FREE)
+    {
+        void* pNewLocation = operator new(uNewSize, m_uAlignment);
+
+        QE_ASSERT_ERROR( null_q != pNewLocation, "Pointer to allocated memory is null" );
+
+        memcpy(pNewLocation, m_pFirst, m_uBlockSize * NEW_BLOCKS_COUNT);
+
+        void** ppNewFreeBlockList = null_q;
+
+        if(m_bIntrusiveFreeList)
+        {
+            // Links the free blocks in the new buffer, skipping the discarded blocks
+            m_ppNextFreeBlock = this->CopyIntrusiveFreeList(pNewLocation, NEW_BLOCKS_COUNT);
+
+            if(m_uFirstUnusedBlock > NEW_BLOCKS_COUNT)
+                m_uFirstUnusedBlock = NEW_BLOCKS_COUNT;
+        }
+        else
+        {
+            // Copies the free block list, skipping the discarded blocks
+            // -----------------------------------
+            ppNewFreeBlockList = (void**) operator new(NEW_BLOCKS_COUNT * sizeof(void**));
+
+            QE_ASSERT_ERROR( null_q != ppNewFreeBlockList, "Pointer to allocated memory for internals is null" );
+
+            void** ppNewNextFreeBlock = null_q;
+            void** ppNewLastFreeBlock = null_q;
+
+            for(void** ppFreeBlock = m_ppNextFreeBlock; ppFreeBlock != null_q; ppFreeBlock = (void**)*ppFreeBlock)
+            {
+                const pointer_uint_q BLOCK_INDEX = ppFreeBlock - m_ppFreeBlocks;
+
+                if(BLOCK_INDEX < NEW_BLOCKS_COUNT)
+                {
+                    void** ppNewFreeBlock = ppNewFreeBlockList + BLOCK_INDEX;
+
+                    if(null_q == ppNewLastFreeBlock)
+                        ppNewNextFreeBlock = ppNewFreeBlock;
+                    else
+                        *ppNewLastFreeBlock = ppNewFreeBlock;
+
+                    ppNewLastFreeBlock = ppNewFreeBlock;
+                }
+            }
+
+            if(null_q != ppNewLastFreeBlock)
+                *ppNewLastFreeBlock = null_q;
+
+            m_ppNextFreeBlock = ppNewNextFreeBlock;
+        }
+
+        // Updates some additional fields
+        // ---------------------------------
+        m_uBlocksCount = NEW_BLOCKS_COUNT;
+        m_uPoolSize = uNewSize;
+        m_uSize = m_bIntrusiveFreeList ? m_uPoolSize : m_uPoolSize + sizeof(void**) * m_uBlocksCount;
+
+        // Frees the old buffers
+        // -------------------------
+        if(m_bNeedDestroyMemoryChunk)
+            operator delete(m_pAllocatedMemory, m_uAlignment);
+
+        m_pAllocatedMemory = pNewLocation;
+        m_pFirst = m_pAllocatedMemory;
+
+        operator delete(m_ppFreeBlocks);
+        m_ppFreeBlocks = ppNewFreeBlockList;
+
+        m_bNeedDestroyMemoryChunk = true;
+    }
+}
+
 void QPoolAllocator::AllocateFreeBlocksList()
 {
-    m_ppFreeBlocks = (void**) operator new(m_uBlocksCount * sizeof(void**));
-    QE_ASSERT_ERROR( null_q != m_ppFreeBlocks, "Pointer to allocated memory for internals is null" );
+    if(m_bIntrusiveFreeList)
+    {
+        // The list is stored in the free blocks themselves
+        m_ppFreeBlocks = null_q;
+        m_uSize = m_uPoolSize;
+    }
+    else
+    {
+        m_ppFreeBlocks = (void**) operator new(m_uBlocksCount * sizeof(void**));
+        QE_ASSERT_ERROR( null_q != m_ppFreeBlocks, "Pointer to allocated memory for internals is null" );
+
+        m_uSize = m_uPoolSize + m_uBlocksCount * sizeof(void**);
+    }
 
     m_ppNextFreeBlock = m_ppFreeBlocks;
-    m_uSize = m_uPoolSize + m_uBlocksCount * sizeof(void**);
 
     this->ClearFreeBlocksList();
 }
 
 void QPoolAllocator::ClearFreeBlocksList()
 {
-    void **ppNext = m_ppFreeBlocks;
-
-    // Every pointer points to the next pointer as a linked list of free blocks to allocate.
-    for( pointer_uint_q uIndex = 0; uIndex < m_uBlocksCount - 1; uIndex++ )
+    if(m_bIntrusiveFreeList)
     {
-        *ppNext = (void*)((void**)ppNext + 1);
-        ppNext = (void**)*ppNext;
+        // Nothing is written in the blocks, they are all unused and will be allocated in ascending order
+        m_ppNextFreeBlock = null_q;
+        m_uFirstUnusedBlock = 0;
     }
+    else
+    {
+        void **ppNext = m_ppFreeBlocks;
 
-    *ppNext = null_q;
+        // Every pointer points to the next pointer as a linked list of free blocks to allocate.
+        for( pointer_uint_q uIndex = 0; uIndex < m_uBlocksCount - 1; uIndex++ )
+        {
+            *ppNext = (void*)((void**)ppNext + 1);
+            ppNext = (void**)*ppNext;
+        }
+
+        *ppNext = null_q;
+    }
 
     m_uAllocatedBytes = 0;
 }
@@ -344,73 +569,83 @@ void QPoolAllocator::InternalReallocate(const pointer_uint_q uNewSize, void* pNe
 
     memcpy(pNewLocation, m_pFirst, m_uBlockSize * m_uBlocksCount);
 
-    // Copies the free block list
-    // -----------------------------------
-    void** ppNewFreeBlockList = (void**) operator new(uNewBlocksCount * sizeof(void**));
-
-    QE_ASSERT_ERROR( null_q != ppNewFreeBlockList, "Pointer to allocated memory for internals is null" );
+    void** ppNewFreeBlockList = null_q;
 
-    if(null_q == m_ppNextFreeBlock) // No free blocks in source.
+    if(m_bIntrusiveFreeList)
     {
-        // Appends extra destination free blocks pointers
-        // ppNext = first free block of remaining free blocks.
-        void** ppNext = ppNewFreeBlockList + m_uBlocksCount;
-
-        // Assigns the next free block
-        m_ppNextFreeBlock = ppNext;
-
-        // Frees remaining blocks from destination redoing the rest of the list.
-        for( pointer_uint_q uIndex = m_uBlocksCount; uIndex < uNewBlocksCount - 1U; ++uIndex )
-        {
-            *ppNext = (void*)(ppNext + 1U);
-            ++ppNext;
-        }
-
-        *ppNext = null_q;
+        // Links the free blocks in the new buffer; the new blocks are taken after the unused blocks
+        m_ppNextFreeBlock = this->CopyIntrusiveFreeList(pNewLocation, uNewBlocksCount);
     }
     else
     {
-        // Copy free blocks pointers list from source to destination
-        void** ppLastFreeBlock = m_ppNextFreeBlock;
+        // Copies the free block list
+        // -----------------------------------
+        ppNewFreeBlockList = (void**) operator new(uNewBlocksCount * sizeof(void**));
 
-        while( null_q != *ppLastFreeBlock )
+        QE_ASSERT_ERROR( null_q != ppNewFreeBlockList, "Pointer to allocated memory for internals is null" );
+
+        if(null_q == m_ppNextFreeBlock) // No free blocks in source.
         {
-            // Index of the next free block in the source = *ppLastFreeBlock - m_ppFreeBlocks
-            pointer_uint_q uLastFreeBlockPosition = (void**)(ppLastFreeBlock) - m_ppFreeBlocks;
-            pointer_uint_q uNextFreeBlockPosition = (void**)(*ppLastFreeBlock) - m_ppFreeBlocks;
-            *(ppNewFreeBlockList + uLastFreeBlockPosition) = ppNewFreeBlockList + uNextFreeBlockPosition;
+            // Appends extra destination free blocks pointers
+            // ppNext = first free block of remaining free blocks.
+            void** ppNext = ppNewFreeBlockList + m_uBlocksCount;
 
-            // Moves to the next free block
-            ppLastFreeBlock = (void**)*ppLastFreeBlock;
+            // Assigns the next free block
+            m_ppNextFreeBlock = ppNext;
+
+            // Frees remaining blocks from destination redoing the rest of the list.
+            for( pointer_uint_q uIndex = m_uBlocksCount; uIndex < uNewBlocksCount - 1U; ++uIndex )
+            {
+                *ppNext = (void*)(ppNext + 1U);
+                ++ppNext;
+            }
+
+            *ppNext = null_q;
         }
+        else
+        {
+            // Copy free blocks pointers list from source to destination
+            void** ppLastFreeBlock = m_ppNextFreeBlock;
 
-        // Assigns the next free block in the destination (same block index as in origin).
-        m_ppNextFreeBlock = ppNewFreeBlockList + (m_ppNextFreeBlock - m_ppFreeBlocks);
+            while( null_q != *ppLastFreeBlock )
+            {
+                // Index of the next free block in the source = *ppLastFreeBlock - m_ppFreeBlocks
+                pointer_uint_q uLastFreeBlockPosition = (void**)(ppLastFreeBlock) - m_ppFreeBlocks;
+                pointer_uint_q uNextFreeBlockPosition = (void**)(*ppLastFreeBlock) - m_ppFreeBlocks;
+                *(ppNewFreeBlockList + uLastFreeBlockPosition) = ppNewFreeBlockList + uNextFreeBlockPosition;
 
-        // Appends extra free blocks pointers of destination
-        // Links copied free blocks list from source to remaining free blocks from destination.
+                // Moves to the next free block
+                ppLastFreeBlock = (void**)*ppLastFreeBlock;
+            }
 
-        // ppNext = first free block of remaining free blocks.
-        void** ppNext = ppNewFreeBlockList + m_uBlocksCount;
+            // Assigns the next free block in the destination (same block index as in origin).
+            m_ppNextFreeBlock = ppNewFreeBlockList + (m_ppNextFreeBlock - m_ppFreeBlocks);
 
-        // Links two lists.
-        *(ppNewFreeBlockList + (ppLastFreeBlock - m_ppFreeBlocks)) = ppNext;
+            // Appends extra free blocks pointers of destination
+            // Links copied free blocks list from source to remaining free blocks from destination.
 
-        // Frees the rest of blocks from destination redoing the rest of the list.
-        for( pointer_uint_q uIndex = m_uBlocksCount; uIndex < uNewBlocksCount - 1U; ++uIndex )
-        {
-            *ppNext = (void*)(ppNext + 1U);
-            ++ppNext;
-        }
+            // ppNext = first free block of remaining free blocks.
+            void** ppNext = ppNewFreeBlockList + m_uBlocksCount;
 
-        *ppNext = null_q;
+            // Links two lists.
+            *(ppNewFreeBlockList + (ppLastFreeBlock - m_ppFreeBlocks)) = ppNext;
+
+            // Frees the rest of blocks from destination redoing the rest of the list.
+            for( pointer_uint_q uIndex = m_uBlocksCount; uIndex < uNewBlocksCount - 1U; ++uIndex )
+            {
+                *ppNext = (void*)(ppNext + 1U);
+                ++ppNext;
+            }
+
+            *ppNext = null_q;
+        }
     }
 
     // Updates some additional fields
     // ---------------------------------
     m_uBlocksCount = uNewBlocksCount;
     m_uPoolSize = uNewSize;
-    m_uSize = m_uPoolSize + sizeof(void**) * m_uBlocksCount;
+    m_uSize = m_bIntrusiveFreeList ? m_uPoolSize : m_uPoolSize + sizeof(void**) * m_uBlocksCount;
 
     // Frees the old buffers
     // -------------------------
@@ -424,6 +659,39 @@ void QPoolAllocator::InternalReallocate(const pointer_uint_q uNewSize, void* pNe
     m_ppFreeBlocks = ppNewFreeBlockList;
 }
 
+void** QPoolAllocator::CopyIntrusiveFreeList(void* pDestinationFirst, const pointer_uint_q uDestinationBlocksCount) const
+{
+    void** ppDestinationNextFreeBlock = null_q;
+    void** ppDestinationLastFreeBlock = null_q;
+    void** ppFreeBlock = m_ppNextFreeBlock;
+
+    while(null_q != ppFreeBlock)
+    {
+        const pointer_uint_q BLOCK_INDEX = ((pointer_uint_q)ppFreeBlock - (pointer_uint_q)m_pFirst) / m_uBlockSize;
+
+        if(BLOCK_INDEX < uDestinationBlocksCount)
+        {
+            // The block keeps its position in the destination buffer
+            void** ppDestinationFreeBlock = (void**)((pointer_uint_q)pDestinationFirst + BLOCK_INDEX * m_uBlockSize);
+
+            if(null_q == ppDestinationLastFreeBlock)
+                ppDestinationNextFreeBlock = ppDestinationFreeBlock;
+            else
+                memcpy(ppDestinationLastFreeBlock, &ppDestinationFreeBlock, sizeof(void**));
+
+            ppDestinationLastFreeBlock = ppDestinationFreeBlock;
+        }
+
+        // Moves to the next free block
+        memcpy(&ppFreeBlock, ppFreeBlock, sizeof(void**));
+    }
+
+    if(null_q != ppDestinationLastFreeBlock)
+        memcpy(ppDestinationLastFreeBlock, &ppFreeBlock, sizeof(void**)); // ppFreeBlock is null at this point
+
+    return ppDestinationNextFreeBlock;
+}
+
 
 //##################=======================================================##################
 //##################             ____________________________              ##################
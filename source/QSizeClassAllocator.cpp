@@ -0,0 +1,597 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "QSizeClassAllocator.h"
+
+#include "AllocationOperators.h"
+// To use memmove
+#include <cstring>
+// To use malloc, realloc and free
+#include <stdlib.h>
+// To use _mm_pause
+#include <xmmintrin.h>
+
+#if defined(QE_OS_WINDOWS)
+    #define NOMINMAX // This definition is necessary to bypass the min and max macros defined in Windows headers
+    #include <Windows.h> // To use SwitchToThread
+#elif defined(QE_OS_LINUX) || defined(QE_OS_MAC)
+    #include <sched.h> // To use sched_yield
+#endif
+
+#include "Assertions.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::f64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace Memory
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  CONSTANTS INITIALIZATION  |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const pointer_uint_q QSizeClassAllocator::MIN_BLOCK_SIZE = 16U;
+const pointer_uint_q QSizeClassAllocator::MAX_BLOCK_SIZE = 32768U;
+const pointer_uint_q QSizeClassAllocator::BLOCK_ALIGNMENT = 16U;
+const pointer_uint_q QSizeClassAllocator::SLAB_SIZE = 65536U;
+const pointer_uint_q QSizeClassAllocator::MIN_BLOCKS_PER_SLAB = 8U;
+const pointer_uint_q QSizeClassAllocator::END_POSITION = -1;
+const u32_q QSizeClassAllocator::SLABS_WRITER_FLAG = 0x80000000U;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QSizeClassAllocator::QSizeClassAllocator() : m_arSlabs(null_q),
+                                             m_uSlabsCount(0),
+                                             m_uSlabsCapacity(0),
+                                             m_uSlabsLock(0)
+{
+    for(u32_q i = 0; i < QSizeClassAllocator::SIZE_CLASSES_COUNT; ++i)
+    {
+        m_arSizeClasses[i].m_pFirstAvailableSlab = null_q;
+        m_arSizeClasses[i].m_bLocked.store(false, boost::memory_order_relaxed);
+    }
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QSizeClassAllocator::~QSizeClassAllocator()
+{
+    for(pointer_uint_q i = 0; i < m_uSlabsCount; ++i)
+        QSizeClassAllocator::_DestroySlab(m_arSlabs[i]);
+
+    free(m_arSlabs);
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QSizeClassAllocator* QSizeClassAllocator::Get()
+{
+    // The instance is constructed in static memory and never destroyed, so it is still usable while static objects are being destroyed
+    static union
+    {
+        u8_q  m_arBytes[sizeof(QSizeClassAllocator)];
+        f64_q m_fAlignment;
+        u64_q m_uAlignment;
+        void* m_pAlignment;
+    } instanceStorage;
+
+    static QSizeClassAllocator* pInstance = new(&instanceStorage) QSizeClassAllocator();
+
+    return pInstance;
+}
+
+// The initialization of local static variables is not thread-safe in some compilers (Visual C++ 2010), so the instance is created while 
+// static objects are initialized, before any thread can be started
+static QSizeClassAllocator* const QSIZECLASSALLOCATOR_INSTANCE = QSizeClassAllocator::Get();
+
+void* QSizeClassAllocator::Allocate(const pointer_uint_q uSize)
+{
+    QE_ASSERT_ERROR(uSize > 0, "The size of the block to allocate must be greater than zero.");
+
+    void* pBlock = null_q;
+
+    if(uSize <= QSizeClassAllocator::MAX_BLOCK_SIZE)
+        pBlock = this->_AllocateFromSizeClass(QSizeClassAllocator::_GetSizeClass(uSize));
+
+    // Big blocks, and blocks for which no slab could be created, are requested to the system
+    if(null_q == pBlock)
+        pBlock = malloc(uSize);
+
+    return pBlock;
+}
+
+void* QSizeClassAllocator::Allocate(const pointer_uint_q uSize, const QAlignment &alignment)
+{
+    QE_ASSERT_ERROR(uSize > 0, "The size of the block to allocate must be greater than zero.");
+
+    void* pBlock = null_q;
+
+    if(uSize <= QSizeClassAllocator::MAX_BLOCK_SIZE && alignment <= QSizeClassAllocator::BLOCK_ALIGNMENT)
+        pBlock = this->_AllocateFromSizeClass(QSizeClassAllocator::_GetSizeClass(uSize));
+
+    // Big blocks, blocks with a bigger alignment, and blocks for which no slab could be created, are requested to the system
+    if(null_q == pBlock)
+        pBlock = aligned_alloc_q(uSize, alignment);
+
+    return pBlock;
+}
+
+void QSizeClassAllocator::Deallocate(const void* pBlock)
+{
+    if(null_q != pBlock && !this->_DeallocateFromSlab(pBlock))
+        free(ccast_q(pBlock, void*));
+}
+
+void QSizeClassAllocator::Deallocate(const void* pBlock, const QAlignment &alignment)
+{
+    QE_ASSERT_ERROR((rcast_q(pBlock, pointer_uint_q) & (alignment - 1U)) == 0, "The block is not aligned to the given alignment, it was not allocated with it.");
+
+    if(null_q != pBlock && !this->_DeallocateFromSlab(pBlock))
+        aligned_free_q(ccast_q(pBlock, void*));
+}
+
+void QSizeClassAllocator::ReleaseEmptySlabs()
+{
+    // No block can be deallocated while the list of slabs is locked for writing, but blocks can still be allocated from the slabs
+    this->_LockSlabsForWriting();
+
+    pointer_uint_q uKeptSlabs = 0;
+
+    for(pointer_uint_q i = 0; i < m_uSlabsCount; ++i)
+    {
+        QSlab* pSlab = m_arSlabs[i];
+
+        this->_LockSizeClass(pSlab->m_uSizeClass);
+
+        const bool IS_EMPTY = pSlab->m_pPool->GetAllocatedBytes() == 0;
+
+        // Empty slabs have free blocks, so they are always in the list of their size class; once removed, no thread can allocate from them
+        if(IS_EMPTY)
+            this->_RemoveAvailableSlab(pSlab);
+
+        this->_UnlockSizeClass(pSlab->m_uSizeClass);
+
+        if(IS_EMPTY)
+        {
+            QSizeClassAllocator::_DestroySlab(pSlab);
+        }
+        else
+        {
+            // The list remains sorted
+            m_arSlabs[uKeptSlabs] = pSlab;
+            ++uKeptSlabs;
+        }
+    }
+
+    m_uSlabsCount = uKeptSlabs;
+
+    this->_UnlockSlabsForWriting();
+}
+
+pointer_uint_q QSizeClassAllocator::GetBlockSize(const pointer_uint_q uSize)
+{
+    QE_ASSERT_ERROR(uSize > 0, "The size of the request must be greater than zero.");
+
+    return uSize > QSizeClassAllocator::MAX_BLOCK_SIZE ? uSize : 
+                                                         QSizeClassAllocator::_GetSizeClassBlockSize(QSizeClassAllocator::_GetSizeClass(uSize));
+}
+
+u32_q QSizeClassAllocator::_GetSizeClass(const pointer_uint_q uSize)
+{
+    // Up to 128 bytes, there is a size class every 16 bytes
+    const pointer_uint_q SMALL_SIZE_CLASSES_LIMIT = 128U;
+    const u32_q SMALL_SIZE_CLASSES_COUNT = 8U;
+
+    if(uSize <= SMALL_SIZE_CLASSES_LIMIT)
+        return scast_q((uSize + QSizeClassAllocator::MIN_BLOCK_SIZE - 1U) / QSizeClassAllocator::MIN_BLOCK_SIZE, u32_q) - 1U;
+
+    // Position of the most significant bit of uSize - 1, so 2^P < uSize <= 2^(P+1)
+    u32_q P = 0;
+
+    for(pointer_uint_q uBits = (uSize - 1U) >> 1U; uBits != 0; uBits >>= 1U)
+        ++P;
+
+    // Every power of two, starting at 128 (2^7), is divided into 4 size classes; (uSize - 1) >> (P - 2) is a value between 4 and 7
+    return SMALL_SIZE_CLASSES_COUNT + (P - 7U) * 4U + scast_q((uSize - 1U) >> (P - 2U), u32_q) - 4U;
+}
+
+pointer_uint_q QSizeClassAllocator::_GetSizeClassBlockSize(const u32_q uSizeClass)
+{
+    const u32_q SMALL_SIZE_CLASSES_COUNT = 8U;
+
+    if(uSizeClass < SMALL_SIZE_CLASSES_COUNT)
+        return (uSizeClass + 1U) * QSizeClassAllocator::MIN_BLOCK_SIZE;
+
+    // 2^P + (N + 1) * 2^(P-2), where P is the power of two and N the position of the size class in the power of two
+    const u32_q P = 7U + (uSizeClass - SMALL_SIZE_CLASSES_COUNT) / 4U;
+    const u32_q N = (uSizeClass - SMALL_SIZE_CLASSES_COUNT) % 4U;
+
+    return (scast_q(1U, pointer_uint_q) << P) + (N + 1U) * (scast_q(1U, pointer_uint_q) << (P - 2U));
+}
+
+void* QSizeClassAllocator::_AllocateFromSizeClass(const u32_q uSizeClass)
+{
+    void* pBlock = null_q;
+
+    this->_LockSizeClass(uSizeClass);
+
+    QSlab* pSlab = m_arSizeClasses[uSizeClass].m_pFirstAvailableSlab;
+
+    if(null_q != pSlab)
+    {
+        pBlock = pSlab->m_pPool->Allocate();
+
+        if(!pSlab->m_pPool->CanAllocate())
+            this->_RemoveAvailableSlab(pSlab);
+    }
+
+    this->_UnlockSizeClass(uSizeClass);
+
+    // The slab is created once the lock of the size class is released, since the lock of the list of slabs has to be acquired first
+    if(null_q == pBlock)
+        pBlock = this->_AllocateFromNewSlab(uSizeClass);
+
+    return pBlock;
+}
+
+bool QSizeClassAllocator::_DeallocateFromSlab(const void* pBlock)
+{
+    // The list of slabs is locked for reading until the block is deallocated, so the slab cannot be released meanwhile
+    this->_LockSlabsForReading();
+
+    const pointer_uint_q SLAB_POSITION = this->_FindSlab(pBlock);
+    const bool BELONGS_TO_SLAB = SLAB_POSITION != QSizeClassAllocator::END_POSITION;
+
+    if(BELONGS_TO_SLAB)
+    {
+        QSlab* pSlab = m_arSlabs[SLAB_POSITION];
+
+        this->_LockSizeClass(pSlab->m_uSizeClass);
+
+        const bool WAS_FULL = !pSlab->m_pPool->CanAllocate();
+
+        pSlab->m_pPool->Deallocate(pBlock);
+
+        if(WAS_FULL)
+            this->_AddAvailableSlab(pSlab);
+
+        this->_UnlockSizeClass(pSlab->m_uSizeClass);
+    }
+
+    this->_UnlockSlabsForReading();
+
+    return BELONGS_TO_SLAB;
+}
+
+void* QSizeClassAllocator::_AllocateFromNewSlab(const u32_q uSizeClass)
+{
+    const pointer_uint_q BLOCK_SIZE = QSizeClassAllocator::_GetSizeClassBlockSize(uSizeClass);
+    const pointer_uint_q SLAB_BYTES = BLOCK_SIZE * QSizeClassAllocator::MIN_BLOCKS_PER_SLAB > QSizeClassAllocator::SLAB_SIZE ? 
+                                                                                          BLOCK_SIZE * QSizeClassAllocator::MIN_BLOCKS_PER_SLAB : 
+                                                                                          QSizeClassAllocator::SLAB_SIZE;
+
+    // All the memory is requested to the system directly, since the new operator may be using this allocator
+    u8_q* pMemory = scast_q(aligned_alloc_q(SLAB_BYTES, QAlignment(QSizeClassAllocator::BLOCK_ALIGNMENT)), u8_q*);
+    QSlab* pNewSlab = scast_q(malloc(sizeof(QSlab)), QSlab*);
+    void* pPoolMemory = malloc(sizeof(QPoolAllocator));
+
+    if(null_q == pMemory || null_q == pNewSlab || null_q == pPoolMemory)
+    {
+        if(null_q != pMemory)
+            aligned_free_q(pMemory);
+
+        free(pNewSlab);
+        free(pPoolMemory);
+
+        return null_q;
+    }
+
+    pNewSlab->m_pBegin = pMemory;
+    pNewSlab->m_pEnd = pMemory + SLAB_BYTES;
+    pNewSlab->m_uSizeClass = uSizeClass;
+    // The list of free blocks is stored in the blocks, so the pool does not allocate any memory
+    pNewSlab->m_pPool = new(pPoolMemory) QPoolAllocator(SLAB_BYTES, BLOCK_SIZE, pMemory, QAlignment(QSizeClassAllocator::BLOCK_ALIGNMENT), true);
+    pNewSlab->m_pPreviousAvailable = null_q;
+    pNewSlab->m_pNextAvailable = null_q;
+
+    this->_LockSlabsForWriting();
+
+    if(m_uSlabsCount == m_uSlabsCapacity)
+    {
+        const pointer_uint_q NEW_CAPACITY = m_uSlabsCapacity == 0 ? 16U : m_uSlabsCapacity * 2U;
+        QSlab** arNewSlabs = scast_q(realloc(m_arSlabs, NEW_CAPACITY * sizeof(QSlab*)), QSlab**);
+
+        if(null_q == arNewSlabs)
+        {
+            this->_UnlockSlabsForWriting();
+            QSizeClassAllocator::_DestroySlab(pNewSlab);
+
+            return null_q;
+        }
+
+        m_arSlabs = arNewSlabs;
+        m_uSlabsCapacity = NEW_CAPACITY;
+    }
+
+    // Inserts the slab keeping the list sorted by address
+    pointer_uint_q uPosition = m_uSlabsCount;
+
+    while(uPosition > 0 && m_arSlabs[uPosition - 1U]->m_pBegin > pMemory)
+        --uPosition;
+
+    memmove(m_arSlabs + uPosition + 1U, m_arSlabs + uPosition, (m_uSlabsCount - uPosition) * sizeof(QSlab*));
+    m_arSlabs[uPosition] = pNewSlab;
+    ++m_uSlabsCount;
+
+    // The block is allocated before the list of slabs is unlocked, so ReleaseEmptySlabs never finds the new slab empty
+    this->_LockSizeClass(uSizeClass);
+
+    void* pBlock = pNewSlab->m_pPool->Allocate();
+
+    if(pNewSlab->m_pPool->CanAllocate())
+        this->_AddAvailableSlab(pNewSlab);
+
+    this->_UnlockSizeClass(uSizeClass);
+
+    this->_UnlockSlabsForWriting();
+
+    return pBlock;
+}
+
+void QSizeClassAllocator::_DestroySlab(QSlab* pSlab)
+{
+    pSlab->m_pPool->~QPoolAllocator();
+    free(pSlab->m_pPool);
+    aligned_free_q(pSlab->m_pBegin);
+    free(pSlab);
+}
+
+void QSizeClassAllocator::_AddAvailableSlab(QSlab* pSlab)
+{
+    QSlab* &pFirstSlab = m_arSizeClasses[pSlab->m_uSizeClass].m_pFirstAvailableSlab;
+
+    pSlab->m_pPreviousAvailable = null_q;
+    pSlab->m_pNextAvailable = pFirstSlab;
+
+    if(null_q != pFirstSlab)
+        pFirstSlab->m_pPreviousAvailable = pSlab;
+
+    pFirstSlab = pSlab;
+}
+
+void QSizeClassAllocator::_RemoveAvailableSlab(QSlab* pSlab)
+{
+    if(null_q == pSlab->m_pPreviousAvailable)
+        m_arSizeClasses[pSlab->m_uSizeClass].m_pFirstAvailableSlab = pSlab->m_pNextAvailable;
+    else
+        pSlab->m_pPreviousAvailable->m_pNextAvailable = pSlab->m_pNextAvailable;
+
+    if(null_q != pSlab->m_pNextAvailable)
+        pSlab->m_pNextAvailable->m_pPreviousAvailable = pSlab->m_pPreviousAvailable;
+
+    pSlab->m_pPreviousAvailable = null_q;
+    pSlab->m_pNextAvailable = null_q;
+}
+
+pointer_uint_q QSizeClassAllocator::_FindSlab(const void* pBlock) const
+{
+    const u8_q* pBlockByte = scast_q(pBlock, const u8_q*);
+
+    // Binary search of the first slab that begins after the block
+    pointer_uint_q uFirst = 0;
+    pointer_uint_q uEnd = m_uSlabsCount;
+
+    while(uFirst < uEnd)
+    {
+        const pointer_uint_q MIDDLE = uFirst + (uEnd - uFirst) / 2U;
+
+        if(m_arSlabs[MIDDLE]->m_pBegin <= pBlockByte)
+            uFirst = MIDDLE + 1U;
+        else
+            uEnd = MIDDLE;
+    }
+
+    // Only the previous slab may contain the block
+    return uFirst > 0 && pBlockByte < m_arSlabs[uFirst - 1U]->m_pEnd ? uFirst - 1U : 
+                                                                      QSizeClassAllocator::END_POSITION;
+}
+
+void QSizeClassAllocator::_LockSizeClass(const u32_q uSizeClass) const
+{
+    boost::atomic<bool> &bLocked = m_arSizeClasses[uSizeClass].m_bLocked;
+
+    while(bLocked.exchange(true, boost::memory_order_acquire))
+    {
+        u32_q uSpins = 0;
+
+        // Waits reading the flag only, so the cache line is not written while another thread holds the lock
+        while(bLocked.load(boost::memory_order_relaxed))
+            QSizeClassAllocator::_SpinWait(uSpins);
+    }
+}
+
+void QSizeClassAllocator::_UnlockSizeClass(const u32_q uSizeClass) const
+{
+    m_arSizeClasses[uSizeClass].m_bLocked.store(false, boost::memory_order_release);
+}
+
+void QSizeClassAllocator::_LockSlabsForReading() const
+{
+    u32_q uSpins = 0;
+    u32_q uLock = m_uSlabsLock.load(boost::memory_order_relaxed);
+
+    // Readers are counted only while there is no writer
+    while((uLock & QSizeClassAllocator::SLABS_WRITER_FLAG) != 0 || 
+          !m_uSlabsLock.compare_exchange_weak(uLock, uLock + 1U, boost::memory_order_acquire, boost::memory_order_relaxed))
+    {
+        QSizeClassAllocator::_SpinWait(uSpins);
+        uLock = m_uSlabsLock.load(boost::memory_order_relaxed);
+    }
+}
+
+void QSizeClassAllocator::_UnlockSlabsForReading() const
+{
+    m_uSlabsLock.fetch_sub(1U, boost::memory_order_release);
+}
+
+void QSizeClassAllocator::_LockSlabsForWriting() const
+{
+    u32_q uSpins = 0;
+
+    // The flag is set first, so no new reader enters, and then the thread waits for the current readers to leave
+    while((m_uSlabsLock.fetch_or(QSizeClassAllocator::SLABS_WRITER_FLAG, boost::memory_order_acquire) & QSizeClassAllocator::SLABS_WRITER_FLAG) != 0)
+    {
+        // Waits reading the lock only, so the cache line is not written while another thread is modifying the list
+        while((m_uSlabsLock.load(boost::memory_order_relaxed) & QSizeClassAllocator::SLABS_WRITER_FLAG) != 0)
+            QSizeClassAllocator::_SpinWait(uSpins);
+    }
+
+    uSpins = 0;
+
+    while(m_uSlabsLock.load(boost::memory_order_acquire) != QSizeClassAllocator::SLABS_WRITER_FLAG)
+        QSizeClassAllocator::_SpinWait(uSpins);
+}
+
+void QSizeClassAllocator::_UnlockSlabsForWriting() const
+{
+    // Readers cannot acquire the lock while the flag is set, so the counter is zero
+    m_uSlabsLock.store(0, boost::memory_order_release);
+}
+
+void QSizeClassAllocator::_SpinWait(u32_q &uSpins)
+{
+    // The number of times the thread waits in a loop before yielding the processor
+    static const u32_q SPINS_BEFORE_YIELDING = 64U;
+
+    if(uSpins < SPINS_BEFORE_YIELDING)
+    {
+        // Tells the processor that this is a spin-wait loop, which reduces the power consumption and the penalty when leaving the loop
+        _mm_pause();
+        ++uSpins;
+    }
+    else
+    {
+        // The thread that holds the lock may be waiting for this processor
+#if defined(QE_OS_WINDOWS)
+        SwitchToThread();
+#elif defined(QE_OS_LINUX) || defined(QE_OS_MAC)
+        sched_yield();
+#endif
+    }
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+pointer_uint_q QSizeClassAllocator::GetReservedBytes() const
+{
+    pointer_uint_q uReservedBytes = 0;
+
+    this->_LockSlabsForReading();
+
+    for(pointer_uint_q i = 0; i < m_uSlabsCount; ++i)
+        uReservedBytes += m_arSlabs[i]->m_pEnd - m_arSlabs[i]->m_pBegin;
+
+    this->_UnlockSlabsForReading();
+
+    return uReservedBytes;
+}
+
+pointer_uint_q QSizeClassAllocator::GetAllocatedBytes() const
+{
+    pointer_uint_q uAllocatedBytes = 0;
+
+    this->_LockSlabsForReading();
+
+    for(pointer_uint_q i = 0; i < m_uSlabsCount; ++i)
+    {
+        // The pool of the slab may be in use by a thread allocating a block of the size class
+        this->_LockSizeClass(m_arSlabs[i]->m_uSizeClass);
+        uAllocatedBytes += m_arSlabs[i]->m_pPool->GetAllocatedBytes();
+        this->_UnlockSizeClass(m_arSlabs[i]->m_uSizeClass);
+    }
+
+    this->_UnlockSlabsForReading();
+
+    return uAllocatedBytes;
+}
+
+pointer_uint_q QSizeClassAllocator::GetSlabsCount() const
+{
+    this->_LockSlabsForReading();
+    const pointer_uint_q SLABS_COUNT = m_uSlabsCount;
+    this->_UnlockSlabsForReading();
+
+    return SLABS_COUNT;
+}
+
+} //namespace Memory
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
@@ -32,6 +32,7 @@
 #include "EQTextEncoding.h"
 #include "SQFloat.h"
 #include "SQVF32.h"
+#include "SQFastHash.h"
 
 #include <unicode/ucnv.h>
 #include <unicode/fmtable.h>
@@ -63,6 +64,7 @@ namespace DataTypes
 
 const int QStringUnicode::LENGTH_NULL_TERMINATED = -1;
 const int QStringUnicode::PATTERN_NOT_FOUND = -1;
+const u64_q QStringUnicode::HASH_NOT_CALCULATED = 0;
 
 
 //##################=======================================================##################
@@ -75,12 +77,14 @@ const int QStringUnicode::PATTERN_NOT_FOUND = -1;
 //##################=======================================================##################
 
 QStringUnicode::QStringUnicode() : m_strString(),
-                                   m_uLength(0)
+                                   m_uLength(0),
+                                   m_uHash(QStringUnicode::HASH_NOT_CALCULATED)
 {
 }
 
 QStringUnicode::QStringUnicode(const QStringUnicode &strString) : m_strString(strString.m_strString),
-                                                                  m_uLength(strString.GetLength())
+                                                                  m_uLength(strString.GetLength()),
+                                                                  m_uHash(strString.m_uHash.load(boost::memory_order_relaxed))
 {
 }
 
@@ -122,10 +126,12 @@ QStringUnicode::QStringUnicode(const i8_q* arBytes,
 
     m_strString = icu::UnicodeString(arBytes, nActualLength, pConverter, errorCode);
     m_uLength = scast_q(m_strString.countChar32(), unsigned int);
+    m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
 }
 
 QStringUnicode::QStringUnicode(const QCharUnicode &character) : m_strString(UChar32(character.GetCodePoint())),
-                                                                m_uLength(1U)
+                                                                m_uLength(1U),
+                                                                m_uHash(QStringUnicode::HASH_NOT_CALCULATED)
 {
 }
 
@@ -162,6 +168,7 @@ QStringUnicode& QStringUnicode::operator=(const QStringUnicode &strString)
     //               In the future we should look for a solution, if there is any.
     m_strString = strString.m_strString;
     m_uLength = strString.GetLength();
+    m_uHash.store(strString.m_uHash.load(boost::memory_order_relaxed), boost::memory_order_relaxed);
     return *this;
 }
 
@@ -597,6 +604,7 @@ QStringUnicode QStringUnicode::ToLowerCase() const
     // Use English as locale.
     const Locale &en = Locale::getEnglish();
     strLowerCase.m_strString.toLower(en);
+    strLowerCase.m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
     return strLowerCase;
 }
 
@@ -606,6 +614,7 @@ QStringUnicode QStringUnicode::ToUpperCase() const
     // Use English as locale.
     const Locale &en = Locale::getEnglish();
     strUpperCase.m_strString.toUpper(en);
+    strUpperCase.m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
     return strUpperCase;
 }
 
@@ -614,6 +623,7 @@ QStringUnicode QStringUnicode::ToCaseFolded() const
     QStringUnicode strFoldedCase(*this);
     strFoldedCase.m_strString.foldCase(U_FOLD_CASE_DEFAULT);
     strFoldedCase.m_uLength = scast_q(strFoldedCase.m_strString.countChar32(), unsigned int);
+    strFoldedCase.m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
     return strFoldedCase;
 }
 
@@ -636,6 +646,7 @@ void QStringUnicode::Normalize(const EQNormalizationForm &eNormalizationForm)
         {
             m_strString = strNormalized;
             m_uLength = scast_q(strNormalized.countChar32(), unsigned int);;
+            m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
         }
     }
 }
@@ -1040,6 +1051,7 @@ void QStringUnicode::Replace(const QStringUnicode &strSearchedPattern, const QSt
             this->_ReplaceCanonical(strSearchedPattern, strReplacement, eComparisonType);
 
         m_uLength = scast_q(m_strString.countChar32(), unsigned int);;
+        m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
     }
 }
 
@@ -1104,6 +1116,7 @@ void QStringUnicode::Append(const QStringUnicode &strStringToAppend)
 {
     m_strString.append(strStringToAppend.m_strString);
     m_uLength += strStringToAppend.GetLength();
+    m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
 }
 
 void QStringUnicode::Append(const char* szStringToAppend)
@@ -1116,6 +1129,7 @@ void QStringUnicode::Append(const u8_q uInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(uInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
 }
 
 void QStringUnicode::Append(const i8_q nInteger)
@@ -1123,6 +1137,7 @@ void QStringUnicode::Append(const i8_q nInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(nInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
 }
 
 void QStringUnicode::Append(const u16_q uInteger)
@@ -1130,6 +1145,7 @@ void QStringUnicode::Append(const u16_q uInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(uInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
 }
 
 void QStringUnicode::Append(const i16_q nInteger)
@@ -1137,6 +1153,7 @@ void QStringUnicode::Append(const i16_q nInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(nInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
 }
 
 void QStringUnicode::Append(const u32_q uInteger)
@@ -1144,6 +1161,7 @@ void QStringUnicode::Append(const u32_q uInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(uInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
 }
 
 void QStringUnicode::Append(const i32_q nInteger)
@@ -1151,6 +1169,7 @@ void QStringUnicode::Append(const i32_q nInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(nInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
 }
 
 void QStringUnicode::Append(const u64_q uInteger)
@@ -1158,6 +1177,7 @@ void QStringUnicode::Append(const u64_q uInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(uInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
 }
 
 void QStringUnicode::Append(const i64_q nInteger)
@@ -1165,6 +1185,7 @@ void QStringUnicode::Append(const i64_q nInteger)
     QStringUnicode strInteger = QStringUnicode::FromInteger(nInteger);
     m_strString.append(strInteger.m_strString);
     m_uLength += strInteger.GetLength();
+    m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
 }
 
 void QStringUnicode::Append(const bool bBoolean)
@@ -1172,6 +1193,7 @@ void QStringUnicode::Append(const bool bBoolean)
     QStringUnicode strBoolean = QStringUnicode::FromBoolean(bBoolean);
     m_strString.append(strBoolean.m_strString);
     m_uLength += strBoolean.GetLength();
+    m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
 }
 
 void QStringUnicode::Append(const f32_q fFloat)
@@ -1179,6 +1201,7 @@ void QStringUnicode::Append(const f32_q fFloat)
     QStringUnicode strFloat = QStringUnicode::FromFloat(fFloat);
     m_strString.append(strFloat.m_strString);
     m_uLength += strFloat.GetLength();
+    m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
 }
 
 void QStringUnicode::Append(const f64_q fFloat)
@@ -1186,6 +1209,7 @@ void QStringUnicode::Append(const f64_q fFloat)
     QStringUnicode strFloat = QStringUnicode::FromFloat(fFloat);
     m_strString.append(strFloat.m_strString);
     m_uLength += strFloat.GetLength();
+    m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
 }
 
 void QStringUnicode::Append(const vf32_q vfVector)
@@ -1193,6 +1217,7 @@ void QStringUnicode::Append(const vf32_q vfVector)
     QStringUnicode strVectorFloat = QStringUnicode::FromVF32(vfVector);
     m_strString.append(strVectorFloat.m_strString);
     m_uLength += strVectorFloat.GetLength();
+    m_uHash.store(QStringUnicode::HASH_NOT_CALCULATED, boost::memory_order_relaxed);
 }
 
 QArrayResult<QStringUnicode> QStringUnicode::Split(const QStringUnicode &strSeparator) const
@@ -1359,6 +1384,17 @@ const icu::NumberFormat* QStringUnicode::_GetFloatFormatter()
     return pNumberFormatter;
 }
 
+u64_q QStringUnicode::_CalculateHash() const
+{
+    u64_q uHash = SQFastHash::Hash(m_strString.getBuffer(), m_strString.length() * sizeof(UChar));
+
+    // The value that marks the cache as empty is replaced, otherwise the strings with that hash would be hashed every time
+    if(uHash == QStringUnicode::HASH_NOT_CALCULATED)
+        uHash = ~QStringUnicode::HASH_NOT_CALCULATED;
+
+    return uHash;
+}
+
 template<>
 QStringUnicode QStringUnicode::FromInteger<i8_q>(const i8_q nValue)
 {
@@ -1457,6 +1493,25 @@ const u16_q* QStringUnicode::GetInternalBuffer() const
     return rcast_q(m_strString.getBuffer(), const u16_q*);
 }
 
+u64_q QStringUnicode::GetHash() const
+{
+#if QE_CONFIG_STRINGHASHCACHE_DEFAULT == QE_CONFIG_STRINGHASHCACHE_ENABLED
+    // The hash is calculated into a local variable and published with a single atomic store, so threads that hash the same 
+    // constant string at the same time either calculate the same value again or read the complete value, never a part of it
+    u64_q uHash = m_uHash.load(boost::memory_order_relaxed);
+
+    if(uHash == QStringUnicode::HASH_NOT_CALCULATED)
+    {
+        uHash = this->_CalculateHash();
+        m_uHash.store(uHash, boost::memory_order_relaxed);
+    }
+
+    return uHash;
+#else
+    return this->_CalculateHash();
+#endif
+}
+
 } //namespace DataTypes
 } //namespace Common
 } //namespace QuimeraEngine
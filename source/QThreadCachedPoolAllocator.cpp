@@ -0,0 +1,327 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "QThreadCachedPoolAllocator.h"
+
+#include "Assertions.h"
+#include "QScopedExclusiveLock.h"
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace System
+{
+namespace Threading
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  CONSTANTS INITIALIZATION  |               ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const pointer_uint_q QThreadCachedPoolAllocator::DEFAULT_CACHE_CAPACITY = 32U;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |       CONSTRUCTORS         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QThreadCachedPoolAllocator::QThreadCache::QThreadCache(QSharedState* pSharedState, const pointer_uint_q uCapacity) : 
+                                                                                        m_arBlocks(new void*[uCapacity]),
+                                                                                        m_uCount(0),
+                                                                                        m_pSharedState(pSharedState),
+                                                                                        m_pNext(null_q)
+{
+}
+
+QThreadCachedPoolAllocator::QSharedState::QSharedState(QThreadCachedPoolAllocator* pOwner) : m_pOwner(pOwner),
+                                                                                           m_pFirstCache(null_q),
+                                                                                           m_uReferences(1U)
+{
+}
+
+QThreadCachedPoolAllocator::QThreadCachedPoolAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const QAlignment &alignment) : 
+                                                                                        m_centralPool(uSize, uBlockSize, alignment),
+                                                                                        m_pSharedState(new QSharedState(this)),
+                                                                                        m_threadCache(&QThreadCachedPoolAllocator::_DestroyThreadCache),
+                                                                                        m_uCacheCapacity(QThreadCachedPoolAllocator::DEFAULT_CACHE_CAPACITY),
+                                                                                        m_pPoolBegin(m_centralPool.GetPointer()),
+                                                                                        m_pPoolEnd(scast_q(m_centralPool.GetPointer(), u8_q*) + m_centralPool.GetPoolSize())
+{
+}
+
+QThreadCachedPoolAllocator::QThreadCachedPoolAllocator(const pointer_uint_q uSize, const pointer_uint_q uBlockSize, const QAlignment &alignment, const pointer_uint_q uCacheCapacity) : 
+                                                                                        m_centralPool(uSize, uBlockSize, alignment),
+                                                                                        m_pSharedState(null_q),
+                                                                                        m_threadCache(&QThreadCachedPoolAllocator::_DestroyThreadCache),
+                                                                                        m_uCacheCapacity(uCacheCapacity),
+                                                                                        m_pPoolBegin(m_centralPool.GetPointer()),
+                                                                                        m_pPoolEnd(scast_q(m_centralPool.GetPointer(), u8_q*) + m_centralPool.GetPoolSize())
+{
+    QE_ASSERT_ERROR(uCacheCapacity > 1U, "The capacity of the cache of every thread must be greater than 1.");
+
+    m_pSharedState = new QSharedState(this);
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |          DESTRUCTOR        |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+QThreadCachedPoolAllocator::QThreadCache::~QThreadCache()
+{
+    delete[] m_arBlocks;
+}
+
+QThreadCachedPoolAllocator::~QThreadCachedPoolAllocator()
+{
+    // The shared state is detached from the allocator; every thread will destroy its own cache when it finishes (the calling thread's, 
+    // when the thread-specific pointer is destroyed), without returning its blocks, and the last one will destroy the shared state
+    bool bIsLastReference = false;
+
+    {
+        QScopedExclusiveLock<QMutex> lock(m_pSharedState->m_mutex);
+        m_pSharedState->m_pOwner = null_q;
+        bIsLastReference = QThreadCachedPoolAllocator::_RemoveReference(m_pSharedState);
+    }
+
+    if(bIsLastReference)
+        delete m_pSharedState;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+void* QThreadCachedPoolAllocator::Allocate()
+{
+    QThreadCache* pCache = this->_GetThreadCache();
+
+    if(pCache->m_uCount == 0)
+    {
+        this->_Refill(pCache);
+
+        if(pCache->m_uCount == 0)
+            return null_q;
+    }
+
+    --pCache->m_uCount;
+    return pCache->m_arBlocks[pCache->m_uCount];
+}
+
+void QThreadCachedPoolAllocator::Deallocate(const void* pBlock)
+{
+    QE_ASSERT_ERROR(pBlock != null_q, "The block to deallocate cannot be null.");
+    QE_ASSERT_ERROR(pBlock >= m_pPoolBegin && pBlock < m_pPoolEnd, "The block to deallocate does not belong to this allocator.");
+
+    QThreadCache* pCache = this->_GetThreadCache();
+
+    if(pCache->m_uCount == m_uCacheCapacity)
+        this->_Flush(pCache, m_uCacheCapacity / 2U);
+
+    pCache->m_arBlocks[pCache->m_uCount] = ccast_q(pBlock, void*);
+    ++pCache->m_uCount;
+}
+
+void QThreadCachedPoolAllocator::ReleaseThreadCache()
+{
+    QThreadCache* pCache = m_threadCache.get();
+
+    if(pCache != null_q && pCache->m_pSharedState == m_pSharedState && pCache->m_uCount > 0)
+        this->_Flush(pCache, pCache->m_uCount);
+}
+
+QThreadCachedPoolAllocator::QThreadCache* QThreadCachedPoolAllocator::_GetThreadCache()
+{
+    QThreadCache* pCache = m_threadCache.get();
+
+    if(pCache == null_q || pCache->m_pSharedState != m_pSharedState)
+    {
+        // If there is a cache but it belongs to a destroyed allocator that occupied the same address, it is replaced
+        pCache = new QThreadCache(m_pSharedState, m_uCacheCapacity);
+        m_threadCache.reset(pCache);
+
+        QScopedExclusiveLock<QMutex> lock(m_pSharedState->m_mutex);
+        pCache->m_pNext = m_pSharedState->m_pFirstCache;
+        m_pSharedState->m_pFirstCache = pCache;
+        ++m_pSharedState->m_uReferences;
+    }
+
+    return pCache;
+}
+
+void QThreadCachedPoolAllocator::_Refill(QThreadCache* pCache)
+{
+    const pointer_uint_q BATCH_SIZE = m_uCacheCapacity / 2U;
+
+    QScopedExclusiveLock<QMutex> lock(m_pSharedState->m_mutex);
+
+    while(pCache->m_uCount < BATCH_SIZE && m_centralPool.CanAllocate())
+    {
+        pCache->m_arBlocks[pCache->m_uCount] = m_centralPool.Allocate();
+        ++pCache->m_uCount;
+    }
+}
+
+void QThreadCachedPoolAllocator::_Flush(QThreadCache* pCache, const pointer_uint_q uNumberOfBlocks)
+{
+    QE_ASSERT_ERROR(uNumberOfBlocks <= pCache->m_uCount, "The number of blocks to return cannot be greater than the number of blocks in the cache.");
+
+    QScopedExclusiveLock<QMutex> lock(m_pSharedState->m_mutex);
+
+    // The oldest blocks, at the bottom of the stack, are returned, so the most recently used remain in the cache
+    for(pointer_uint_q i = 0; i < uNumberOfBlocks; ++i)
+        m_centralPool.Deallocate(pCache->m_arBlocks[i]);
+
+    pCache->m_uCount -= uNumberOfBlocks;
+
+    for(pointer_uint_q i = 0; i < pCache->m_uCount; ++i)
+        pCache->m_arBlocks[i] = pCache->m_arBlocks[i + uNumberOfBlocks];
+}
+
+void QThreadCachedPoolAllocator::_UnregisterThreadCache(QThreadCache* pCache)
+{
+    QSharedState* pSharedState = pCache->m_pSharedState;
+
+    // When the allocator has been destroyed, the central pool does not exist anymore
+    if(pSharedState->m_pOwner != null_q)
+    {
+        for(pointer_uint_q i = 0; i < pCache->m_uCount; ++i)
+            pSharedState->m_pOwner->m_centralPool.Deallocate(pCache->m_arBlocks[i]);
+    }
+
+    pCache->m_uCount = 0;
+
+    if(pSharedState->m_pFirstCache == pCache)
+    {
+        pSharedState->m_pFirstCache = pCache->m_pNext;
+    }
+    else
+    {
+        QThreadCache* pPrevious = pSharedState->m_pFirstCache;
+
+        while(pPrevious->m_pNext != pCache)
+            pPrevious = pPrevious->m_pNext;
+
+        pPrevious->m_pNext = pCache->m_pNext;
+    }
+}
+
+bool QThreadCachedPoolAllocator::_RemoveReference(QSharedState* pSharedState)
+{
+    QE_ASSERT_ERROR(pSharedState->m_uReferences > 0, "There are no references to the shared state to remove.");
+
+    --pSharedState->m_uReferences;
+    return pSharedState->m_uReferences == 0;
+}
+
+void QThreadCachedPoolAllocator::_DestroyThreadCache(QThreadCache* pCache)
+{
+    // The cache keeps the shared state alive, so its mutex can be locked even if the allocator is being destroyed at the same time
+    QSharedState* pSharedState = pCache->m_pSharedState;
+    bool bIsLastReference = false;
+
+    {
+        QScopedExclusiveLock<QMutex> lock(pSharedState->m_mutex);
+        QThreadCachedPoolAllocator::_UnregisterThreadCache(pCache);
+        bIsLastReference = QThreadCachedPoolAllocator::_RemoveReference(pSharedState);
+    }
+
+    if(bIsLastReference)
+        delete pSharedState;
+
+    delete pCache;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |         PROPERTIES         |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+pointer_uint_q QThreadCachedPoolAllocator::GetPoolSize() const
+{
+    return m_centralPool.GetPoolSize();
+}
+
+pointer_uint_q QThreadCachedPoolAllocator::GetAllocatedBytes()
+{
+    QScopedExclusiveLock<QMutex> lock(m_pSharedState->m_mutex);
+    return m_centralPool.GetAllocatedBytes();
+}
+
+bool QThreadCachedPoolAllocator::CanAllocate()
+{
+    QThreadCache* pCache = m_threadCache.get();
+
+    if(pCache != null_q && pCache->m_pSharedState == m_pSharedState && pCache->m_uCount > 0)
+        return true;
+
+    QScopedExclusiveLock<QMutex> lock(m_pSharedState->m_mutex);
+    return m_centralPool.CanAllocate();
+}
+
+pointer_uint_q QThreadCachedPoolAllocator::GetCacheCapacity() const
+{
+    return m_uCacheCapacity;
+}
+
+QAlignment QThreadCachedPoolAllocator::GetAlignment() const
+{
+    return m_centralPool.GetAlignment();
+}
+
+
+} //namespace Threading
+} //namespace System
+} //namespace QuimeraEngine
+} //namespace Kinesis
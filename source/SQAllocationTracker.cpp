@@ -0,0 +1,517 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "SQAllocationTracker.h"
+
+// To use placement new
+#include <new>
+// To use strcmp
+#include <cstring>
+// To use malloc
+#include <stdlib.h>
+
+#if defined(QE_OS_WINDOWS)
+    #define NOMINMAX // This definition is necessary to bypass the min and max macros defined in Windows headers
+    #include <Windows.h> // To use FlsAlloc and FlsSetValue
+#elif defined(QE_OS_LINUX) || defined(QE_OS_MAC)
+    #include <pthread.h> // To use pthread_key_create and pthread_setspecific
+#endif
+
+#include "QAllocationSnapshot.h"
+#include "Assertions.h"
+
+// Thread-local variables cannot be members of an exported class, so they are declared in this file only
+#if defined(QE_COMPILER_MSVC)
+    #define QE_ALLOCATIONTRACKER_THREAD_LOCAL __declspec(thread)
+#elif defined(QE_COMPILER_GCC)
+    #define QE_ALLOCATIONTRACKER_THREAD_LOCAL __thread
+#endif
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace Memory
+{
+
+/// <summary>
+/// The counters of a thread. Only the owner thread writes them, so the increments do not need read-modify-write operations.
+/// </summary>
+/// <remarks>
+/// When the thread finishes, the counters are not reset but passed on to the next thread that needs them, so the totals are kept.
+/// </remarks>
+struct QAllocationTrackerThreadCounters
+{
+    boost::atomic<u64_q> m_arAllocations[SQAllocationTracker::MAX_TAGS];
+    boost::atomic<u64_q> m_arDeallocations[SQAllocationTracker::MAX_TAGS];
+    boost::atomic<u64_q> m_arAllocatedBytes[SQAllocationTracker::MAX_TAGS];
+    boost::atomic<u64_q> m_arHistogram[SQAllocationTracker::MAX_TAGS][SQAllocationTracker::HISTOGRAM_BUCKETS_COUNT];
+
+    /// <summary>
+    /// The bytes allocated minus the bytes deallocated by the thread. It is negative when the thread deallocates blocks allocated by other threads.
+    /// </summary>
+    boost::atomic<i64_q> m_arLiveBytes[SQAllocationTracker::MAX_TAGS];
+
+    /// <summary>
+    /// Whether a running thread owns the counters.
+    /// </summary>
+    boost::atomic<bool> m_bInUse;
+
+    /// <summary>
+    /// The counters created before these ones. They are never removed from the list.
+    /// </summary>
+    QAllocationTrackerThreadCounters* m_pNext;
+};
+
+/// <summary>
+/// The states of the creation of the thread-exit hook: not created yet, being created by a thread, created and not available in the platform.
+/// </summary>
+static const u32_q HOOK_NOT_CREATED = 0;
+static const u32_q HOOK_BEING_CREATED = 1U;
+static const u32_q HOOK_CREATED = 2U;
+static const u32_q HOOK_NOT_AVAILABLE = 3U;
+
+/// <summary>
+/// The tag which is active in the calling thread.
+/// </summary>
+static QE_ALLOCATIONTRACKER_THREAD_LOCAL u32_q s_uCurrentTag = 0;
+
+/// <summary>
+/// The counters of the calling thread. They are created the first time the thread allocates.
+/// </summary>
+static QE_ALLOCATIONTRACKER_THREAD_LOCAL QAllocationTrackerThreadCounters* s_pThreadCounters = null_q;
+
+/// <summary>
+/// The list of the counters of all the threads, in reverse order of creation.
+/// </summary>
+static boost::atomic<QAllocationTrackerThreadCounters*> s_pFirstThreadCounters;
+
+/// <summary>
+/// The state of the creation of the thread-exit hook. It is zero-initialized, which means it has not been created yet.
+/// </summary>
+static boost::atomic<u32_q> s_uThreadExitHookState;
+
+#if defined(QE_OS_WINDOWS)
+    /// <summary>
+    /// The fiber-local storage slot whose callback is called when a thread finishes.
+    /// </summary>
+    static DWORD s_uThreadExitHook;
+#elif defined(QE_OS_LINUX) || defined(QE_OS_MAC)
+    /// <summary>
+    /// The thread-specific key whose destructor is called when a thread finishes.
+    /// </summary>
+    static pthread_key_t s_threadExitHook;
+#endif
+
+/// <summary>
+/// Gives the counters of the calling thread up so another thread can use them. It is called when the thread finishes.
+/// </summary>
+/// <param name="pCounters">[IN] The counters of the thread.</param>
+static void ReleaseThreadCounters(void* pCounters)
+{
+    // If the thread allocates again while finishing, it will get other counters
+    if(s_pThreadCounters == pCounters)
+        s_pThreadCounters = null_q;
+
+    scast_q(pCounters, QAllocationTrackerThreadCounters*)->m_bInUse.store(false, boost::memory_order_release);
+}
+
+#if defined(QE_OS_WINDOWS)
+    /// <summary>
+    /// Calls ReleaseThreadCounters with the calling convention of fiber-local storage callbacks.
+    /// </summary>
+    /// <param name="pCounters">[IN] The counters of the thread.</param>
+    static VOID WINAPI ReleaseThreadCountersCallback(PVOID pCounters)
+    {
+        ReleaseThreadCounters(pCounters);
+    }
+#endif
+
+/// <summary>
+/// Makes sure the counters of the calling thread are released when it finishes, creating the thread-exit hook the first time.
+/// </summary>
+/// <remarks>
+/// If the hook cannot be created, the counters are never released.
+/// </remarks>
+/// <param name="pCounters">[IN] The counters of the thread.</param>
+static void RegisterThreadCounters(QAllocationTrackerThreadCounters* pCounters)
+{
+    u32_q uState = HOOK_NOT_CREATED;
+
+    if(s_uThreadExitHookState.compare_exchange_strong(uState, HOOK_BEING_CREATED, boost::memory_order_acquire, boost::memory_order_acquire))
+    {
+#if defined(QE_OS_WINDOWS)
+        s_uThreadExitHook = FlsAlloc(&ReleaseThreadCountersCallback);
+        const bool IS_HOOK_CREATED = s_uThreadExitHook != FLS_OUT_OF_INDEXES;
+#elif defined(QE_OS_LINUX) || defined(QE_OS_MAC)
+        const bool IS_HOOK_CREATED = pthread_key_create(&s_threadExitHook, &ReleaseThreadCounters) == 0;
+#else
+        const bool IS_HOOK_CREATED = false;
+#endif
+        uState = IS_HOOK_CREATED ? HOOK_CREATED : HOOK_NOT_AVAILABLE;
+        s_uThreadExitHookState.store(uState, boost::memory_order_release);
+    }
+
+    // Other thread may be creating the hook
+    while(uState == HOOK_BEING_CREATED)
+        uState = s_uThreadExitHookState.load(boost::memory_order_acquire);
+
+    if(uState == HOOK_CREATED)
+    {
+#if defined(QE_OS_WINDOWS)
+        FlsSetValue(s_uThreadExitHook, pCounters);
+#elif defined(QE_OS_LINUX) || defined(QE_OS_MAC)
+        pthread_setspecific(s_threadExitHook, pCounters);
+#endif
+    }
+}
+
+/// <summary>
+/// Adds a value to a counter of the calling thread.
+/// </summary>
+/// <param name="counter">[IN/OUT] The counter.</param>
+/// <param name="uValue">[IN] The value to add.</param>
+static void IncrementThreadCounter(boost::atomic<u64_q> &counter, const u64_q uValue)
+{
+    counter.store(counter.load(boost::memory_order_relaxed) + uValue, boost::memory_order_relaxed);
+}
+
+/// <summary>
+/// Adds a value, which may be negative, to a counter of the calling thread.
+/// </summary>
+/// <param name="counter">[IN/OUT] The counter.</param>
+/// <param name="nValue">[IN] The value to add.</param>
+static void IncrementThreadCounter(boost::atomic<i64_q> &counter, const i64_q nValue)
+{
+    counter.store(counter.load(boost::memory_order_relaxed) + nValue, boost::memory_order_relaxed);
+}
+
+/// <summary>
+/// Takes the counters that a finished thread released, if any.
+/// </summary>
+/// <returns>
+/// The counters, which now belong to the calling thread. It is null if all the counters are in use.
+/// </returns>
+static QAllocationTrackerThreadCounters* AcquireReleasedThreadCounters()
+{
+    for(QAllocationTrackerThreadCounters* pCounters = s_pFirstThreadCounters.load(boost::memory_order_acquire); null_q != pCounters; pCounters = pCounters->m_pNext)
+    {
+        bool bInUse = false;
+
+        if(pCounters->m_bInUse.compare_exchange_strong(bInUse, true, boost::memory_order_acquire, boost::memory_order_relaxed))
+            return pCounters;
+    }
+
+    return null_q;
+}
+
+/// <summary>
+/// Creates counters for the calling thread and adds them to the list of counters.
+/// </summary>
+/// <returns>
+/// The new counters. It is null if there is no memory available.
+/// </returns>
+static QAllocationTrackerThreadCounters* CreateThreadCounters()
+{
+    // The memory is requested to the system directly, since the new operator is the one being tracked
+    void* pMemory = malloc(sizeof(QAllocationTrackerThreadCounters));
+
+    if(null_q == pMemory)
+        return null_q;
+
+    QAllocationTrackerThreadCounters* pCounters = new(pMemory) QAllocationTrackerThreadCounters();
+
+    for(u32_q uTag = 0; uTag < SQAllocationTracker::MAX_TAGS; ++uTag)
+    {
+        pCounters->m_arAllocations[uTag].store(0, boost::memory_order_relaxed);
+        pCounters->m_arDeallocations[uTag].store(0, boost::memory_order_relaxed);
+        pCounters->m_arAllocatedBytes[uTag].store(0, boost::memory_order_relaxed);
+        pCounters->m_arLiveBytes[uTag].store(0, boost::memory_order_relaxed);
+
+        for(u32_q uBucket = 0; uBucket < SQAllocationTracker::HISTOGRAM_BUCKETS_COUNT; ++uBucket)
+            pCounters->m_arHistogram[uTag][uBucket].store(0, boost::memory_order_relaxed);
+    }
+
+    pCounters->m_bInUse.store(true, boost::memory_order_relaxed);
+
+    // The counters are published so the snapshots can merge them
+    QAllocationTrackerThreadCounters* pFirst = s_pFirstThreadCounters.load(boost::memory_order_relaxed);
+
+    do
+    {
+        pCounters->m_pNext = pFirst;
+    }
+    while(!s_pFirstThreadCounters.compare_exchange_weak(pFirst, pCounters, boost::memory_order_release, boost::memory_order_relaxed));
+
+    return pCounters;
+}
+
+/// <summary>
+/// Gets the counters of the calling thread, taking released counters or creating new ones the first time.
+/// </summary>
+/// <returns>
+/// The counters of the thread. It is null if they could not be created.
+/// </returns>
+static QAllocationTrackerThreadCounters* GetThreadCounters()
+{
+    if(null_q == s_pThreadCounters)
+    {
+        QAllocationTrackerThreadCounters* pCounters = AcquireReleasedThreadCounters();
+
+        if(null_q == pCounters)
+            pCounters = CreateThreadCounters();
+
+        if(null_q != pCounters)
+        {
+            s_pThreadCounters = pCounters;
+            RegisterThreadCounters(pCounters);
+        }
+    }
+
+    return s_pThreadCounters;
+}
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  CONSTANTS INITIALIZATION  |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const u32_q SQAllocationTracker::UNTAGGED = 0;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  ATTRIBUTES INITIALIZATION |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+// All the attributes are zero-initialized, which happens before any allocation of the process
+const char* SQAllocationTracker::sm_arTagNames[SQAllocationTracker::MAX_TAGS];
+const char* SQAllocationTracker::sm_arTagFiles[SQAllocationTracker::MAX_TAGS];
+int SQAllocationTracker::sm_arTagLines[SQAllocationTracker::MAX_TAGS];
+boost::atomic<u32_q> SQAllocationTracker::sm_uRegisteredTags;
+SQAllocationTracker::QSharedTagCounters SQAllocationTracker::sm_arSharedCounters[SQAllocationTracker::MAX_TAGS];
+boost::atomic<bool> SQAllocationTracker::sm_bRegistryLocked;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+u32_q SQAllocationTracker::RegisterTag(const char* szName, const char* szFile, const int nLine)
+{
+    QE_ASSERT_ERROR(null_q != szName, "The name of the tag must not be null.");
+    QE_ASSERT_ERROR(null_q != szFile, "The file of the tag must not be null.");
+
+    u32_q uTag = SQAllocationTracker::UNTAGGED;
+
+    SQAllocationTracker::_LockRegistry();
+
+    const u32_q TAGS_COUNT = sm_uRegisteredTags.load(boost::memory_order_relaxed) + 1U;
+
+    // The same tag may be registered from several threads at the same time
+    for(u32_q i = 1U; i < TAGS_COUNT && uTag == SQAllocationTracker::UNTAGGED; ++i)
+    {
+        if(sm_arTagLines[i] == nLine && strcmp(sm_arTagNames[i], szName) == 0 && strcmp(sm_arTagFiles[i], szFile) == 0)
+            uTag = i;
+    }
+
+    if(uTag == SQAllocationTracker::UNTAGGED && TAGS_COUNT < SQAllocationTracker::MAX_TAGS)
+    {
+        uTag = TAGS_COUNT;
+        sm_arTagNames[uTag] = szName;
+        sm_arTagFiles[uTag] = szFile;
+        sm_arTagLines[uTag] = nLine;
+
+        // The snapshots can read the new tag from now on
+        sm_uRegisteredTags.store(TAGS_COUNT, boost::memory_order_release);
+    }
+
+    SQAllocationTracker::_UnlockRegistry();
+
+    QE_ASSERT_WARNING(uTag != SQAllocationTracker::UNTAGGED, "The maximum number of allocation tags has been reached, the allocations will not be tagged.");
+
+    return uTag;
+}
+
+u32_q SQAllocationTracker::GetCurrentTag()
+{
+    return s_uCurrentTag;
+}
+
+void SQAllocationTracker::SetCurrentTag(const u32_q uTag)
+{
+    QE_ASSERT_ERROR(uTag <= sm_uRegisteredTags.load(boost::memory_order_relaxed), "The tag is not registered.");
+
+    s_uCurrentTag = uTag;
+}
+
+void SQAllocationTracker::EnableHighWaterMark(const u32_q uTag)
+{
+    QE_ASSERT_ERROR(uTag <= sm_uRegisteredTags.load(boost::memory_order_relaxed), "The tag is not registered.");
+
+    sm_arSharedCounters[uTag].m_bHighWaterMarkEnabled.store(true, boost::memory_order_relaxed);
+}
+
+void SQAllocationTracker::NotifyAllocation(const u32_q uTag, const pointer_uint_q uSize)
+{
+    QAllocationTrackerThreadCounters* pCounters = GetThreadCounters();
+
+    if(null_q != pCounters)
+    {
+        IncrementThreadCounter(pCounters->m_arAllocations[uTag], 1U);
+        IncrementThreadCounter(pCounters->m_arAllocatedBytes[uTag], uSize);
+        IncrementThreadCounter(pCounters->m_arHistogram[uTag][SQAllocationTracker::GetHistogramBucket(uSize)], 1U);
+        IncrementThreadCounter(pCounters->m_arLiveBytes[uTag], scast_q(uSize, i64_q));
+    }
+
+    // The live bytes must be shared by all the threads to know the high-water mark, since blocks may be deallocated by a different thread, 
+    // so it is only done for the tags that need it
+    QSharedTagCounters &sharedCounters = sm_arSharedCounters[uTag];
+
+    if(sharedCounters.m_bHighWaterMarkEnabled.load(boost::memory_order_relaxed))
+    {
+        const i64_q LIVE_BYTES = sharedCounters.m_nLiveBytes.fetch_add(scast_q(uSize, i64_q), boost::memory_order_relaxed) + scast_q(uSize, i64_q);
+        i64_q nHighWaterMark = sharedCounters.m_nHighWaterMark.load(boost::memory_order_relaxed);
+
+        while(LIVE_BYTES > nHighWaterMark && 
+              !sharedCounters.m_nHighWaterMark.compare_exchange_weak(nHighWaterMark, LIVE_BYTES, boost::memory_order_relaxed, boost::memory_order_relaxed))
+        {
+        }
+    }
+}
+
+void SQAllocationTracker::NotifyDeallocation(const u32_q uTag, const pointer_uint_q uSize)
+{
+    QAllocationTrackerThreadCounters* pCounters = GetThreadCounters();
+
+    if(null_q != pCounters)
+    {
+        IncrementThreadCounter(pCounters->m_arDeallocations[uTag], 1U);
+        IncrementThreadCounter(pCounters->m_arLiveBytes[uTag], -scast_q(uSize, i64_q));
+    }
+
+    QSharedTagCounters &sharedCounters = sm_arSharedCounters[uTag];
+
+    if(sharedCounters.m_bHighWaterMarkEnabled.load(boost::memory_order_relaxed))
+        sharedCounters.m_nLiveBytes.fetch_sub(scast_q(uSize, i64_q), boost::memory_order_relaxed);
+}
+
+QAllocationSnapshot SQAllocationTracker::TakeSnapshot()
+{
+    const u32_q TAGS_COUNT = sm_uRegisteredTags.load(boost::memory_order_acquire) + 1U;
+
+    QAllocationSnapshot snapshot(TAGS_COUNT);
+
+    for(u32_q uTag = 0; uTag < TAGS_COUNT; ++uTag)
+    {
+        QAllocationSnapshot::QTagStatistics &tag = snapshot.m_arTags[uTag];
+        tag.m_szName = sm_arTagNames[uTag];
+        tag.m_szFile = sm_arTagFiles[uTag];
+        tag.m_nLine = sm_arTagLines[uTag];
+        tag.m_uHighWaterMark = scast_q(sm_arSharedCounters[uTag].m_nHighWaterMark.load(boost::memory_order_relaxed), u64_q);
+    }
+
+    // Merges the counters of every thread
+    for(QAllocationTrackerThreadCounters* pCounters = s_pFirstThreadCounters.load(boost::memory_order_acquire); null_q != pCounters; pCounters = pCounters->m_pNext)
+    {
+        for(u32_q uTag = 0; uTag < TAGS_COUNT; ++uTag)
+        {
+            QAllocationSnapshot::QTagStatistics &tag = snapshot.m_arTags[uTag];
+            tag.m_uAllocations += pCounters->m_arAllocations[uTag].load(boost::memory_order_relaxed);
+            tag.m_uDeallocations += pCounters->m_arDeallocations[uTag].load(boost::memory_order_relaxed);
+            tag.m_uAllocatedBytes += pCounters->m_arAllocatedBytes[uTag].load(boost::memory_order_relaxed);
+            tag.m_nLiveBytes += pCounters->m_arLiveBytes[uTag].load(boost::memory_order_relaxed);
+
+            for(u32_q uBucket = 0; uBucket < SQAllocationTracker::HISTOGRAM_BUCKETS_COUNT; ++uBucket)
+                tag.m_arHistogram[uBucket] += pCounters->m_arHistogram[uTag][uBucket].load(boost::memory_order_relaxed);
+        }
+    }
+
+    return snapshot;
+}
+
+u32_q SQAllocationTracker::GetHistogramBucket(const pointer_uint_q uSize)
+{
+    const pointer_uint_q FIRST_BUCKET_LIMIT = 16U;
+
+    u32_q uBucket = 0;
+
+    if(uSize > FIRST_BUCKET_LIMIT)
+    {
+        // Every bit of (uSize - 1) / 16 is an interval
+        for(pointer_uint_q uBits = (uSize - 1U) / FIRST_BUCKET_LIMIT; uBits != 0 && uBucket < SQAllocationTracker::HISTOGRAM_BUCKETS_COUNT - 1U; uBits >>= 1U)
+            ++uBucket;
+    }
+
+    return uBucket;
+}
+
+pointer_uint_q SQAllocationTracker::GetHistogramBucketLimit(const u32_q uBucket)
+{
+    QE_ASSERT_ERROR(uBucket < SQAllocationTracker::HISTOGRAM_BUCKETS_COUNT, "The index of the interval must be lower than the number of intervals.");
+
+    const pointer_uint_q FIRST_BUCKET_LIMIT = 16U;
+    const u32_q LAST_LIMITED_BUCKET = SQAllocationTracker::HISTOGRAM_BUCKETS_COUNT - 2U;
+
+    return FIRST_BUCKET_LIMIT << (uBucket < LAST_LIMITED_BUCKET ? uBucket : LAST_LIMITED_BUCKET);
+}
+
+void SQAllocationTracker::_LockRegistry()
+{
+    while(sm_bRegistryLocked.exchange(true, boost::memory_order_acquire))
+    {
+        while(sm_bRegistryLocked.load(boost::memory_order_relaxed))
+        {
+        }
+    }
+}
+
+void SQAllocationTracker::_UnlockRegistry()
+{
+    sm_bRegistryLocked.store(false, boost::memory_order_release);
+}
+
+} //namespace Memory
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
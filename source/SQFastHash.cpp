@@ -0,0 +1,158 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "SQFastHash.h"
+
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+
+#include <string.h>
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Common
+{
+namespace DataTypes
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |  CONSTANTS INITIALIZATION  |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+const u64_q SQFastHash::SECRET0;
+const u64_q SQFastHash::SECRET1;
+const u64_q SQFastHash::SECRET2;
+const u64_q SQFastHash::SECRET3;
+
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+u64_q SQFastHash::Hash(const void* pInput, const pointer_uint_q uSize)
+{
+    return SQFastHash::Hash(pInput, uSize, 0);
+}
+
+u64_q SQFastHash::Hash(const void* pInput, const pointer_uint_q uSize, const u64_q uSeed)
+{
+    // See: https://github.com/wangyi-fudan/wyhash
+
+    QE_ASSERT_ERROR(pInput != null_q || uSize == 0, "The input sequence cannot be null unless its size is zero.");
+
+    const u8_q* pBytes = scast_q(pInput, const u8_q*);
+    u64_q uState = uSeed ^ SQFastHash::_Mix(uSeed ^ SQFastHash::SECRET0, SQFastHash::SECRET1);
+    u64_q uA = 0;
+    u64_q uB = 0;
+
+    if(uSize <= 16U)
+    {
+        if(uSize >= 4U)
+        {
+            // Two overlapping pairs of 32 bits words cover the whole sequence
+            const pointer_uint_q MIDDLE_OFFSET = (uSize >> 3U) << 2U;
+            uA = (SQFastHash::_Read32(pBytes) << 32U) | SQFastHash::_Read32(pBytes + MIDDLE_OFFSET);
+            uB = (SQFastHash::_Read32(pBytes + uSize - 4U) << 32U) | SQFastHash::_Read32(pBytes + uSize - 4U - MIDDLE_OFFSET);
+        }
+        else if(uSize > 0)
+        {
+            uA = (scast_q(pBytes[0], u64_q) << 16U) | (scast_q(pBytes[uSize >> 1U], u64_q) << 8U) | pBytes[uSize - 1U];
+        }
+    }
+    else
+    {
+        pointer_uint_q uRemainingBytes = uSize;
+
+        if(uRemainingBytes > 48U)
+        {
+            // Three independent states are updated at the same time so the multiplications can be executed in parallel
+            u64_q uState1 = uState;
+            u64_q uState2 = uState;
+
+            do
+            {
+                uState  = SQFastHash::_Mix(SQFastHash::_Read64(pBytes)       ^ SQFastHash::SECRET1, SQFastHash::_Read64(pBytes + 8U)  ^ uState);
+                uState1 = SQFastHash::_Mix(SQFastHash::_Read64(pBytes + 16U) ^ SQFastHash::SECRET2, SQFastHash::_Read64(pBytes + 24U) ^ uState1);
+                uState2 = SQFastHash::_Mix(SQFastHash::_Read64(pBytes + 32U) ^ SQFastHash::SECRET3, SQFastHash::_Read64(pBytes + 40U) ^ uState2);
+                pBytes += 48U;
+                uRemainingBytes -= 48U;
+            }
+            while(uRemainingBytes > 48U);
+
+            uState ^= uState1 ^ uState2;
+        }
+
+        while(uRemainingBytes > 16U)
+        {
+            uState = SQFastHash::_Mix(SQFastHash::_Read64(pBytes) ^ SQFastHash::SECRET1, SQFastHash::_Read64(pBytes + 8U) ^ uState);
+            pBytes += 16U;
+            uRemainingBytes -= 16U;
+        }
+
+        // The last 16 bytes are read, overlapping already processed bytes if necessary
+        uA = SQFastHash::_Read64(pBytes + uRemainingBytes - 16U);
+        uB = SQFastHash::_Read64(pBytes + uRemainingBytes - 8U);
+    }
+
+    uA ^= SQFastHash::SECRET1;
+    uB ^= uState;
+    SQFastHash::_Multiply(uA, uB);
+
+    return SQFastHash::_Mix(uA ^ SQFastHash::SECRET0 ^ uSize, uB ^ SQFastHash::SECRET1);
+}
+
+u64_q SQFastHash::_Read64(const u8_q* pInput)
+{
+    u64_q uValue = 0;
+    memcpy(&uValue, pInput, sizeof(u64_q));
+    return uValue;
+}
+
+u64_q SQFastHash::_Read32(const u8_q* pInput)
+{
+    u32_q uValue = 0;
+    memcpy(&uValue, pInput, sizeof(u32_q));
+    return uValue;
+}
+
+
+} //namespace DataTypes
+} //namespace Common
+} //namespace QuimeraEngine
+} //namespace Kinesis
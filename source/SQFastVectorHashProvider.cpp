@@ -0,0 +1,110 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include "SQFastVectorHashProvider.h"
+
+#include "Assertions.h"
+#include "StringsDefinitions.h"
+#include "SQFastHash.h"
+#include "SQFloat.h"
+#include "QBaseVector2.h"
+#include "QBaseVector3.h"
+#include "QBaseVector4.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFastHash;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Tools::Math::QBaseVector2;
+using Kinesis::QuimeraEngine::Tools::Math::QBaseVector3;
+using Kinesis::QuimeraEngine::Tools::Math::QBaseVector4;
+
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+
+//##################=======================================================##################
+//##################             ____________________________              ##################
+//##################            |                            |             ##################
+//##################            |           METHODS          |             ##################
+//##################           /|                            |\            ##################
+//##################             \/\/\/\/\/\/\/\/\/\/\/\/\/\/              ##################
+//##################                                                       ##################
+//##################=======================================================##################
+
+// Note: Adding zero to every component converts negative zero into zero, so both produce the same hash
+
+u64_q SQFastVectorHashProvider::GenerateHash(const QBaseVector2 &vInput)
+{
+    const float_q COMPONENTS[] = { vInput.x + SQFloat::_0, vInput.y + SQFloat::_0 };
+    return SQFastHash::Hash(COMPONENTS, sizeof(COMPONENTS));
+}
+
+u64_q SQFastVectorHashProvider::GenerateHash(const QBaseVector3 &vInput)
+{
+    const float_q COMPONENTS[] = { vInput.x + SQFloat::_0, vInput.y + SQFloat::_0, vInput.z + SQFloat::_0 };
+    return SQFastHash::Hash(COMPONENTS, sizeof(COMPONENTS));
+}
+
+u64_q SQFastVectorHashProvider::GenerateHash(const QBaseVector4 &vInput)
+{
+    const float_q COMPONENTS[] = { vInput.x + SQFloat::_0, vInput.y + SQFloat::_0, vInput.z + SQFloat::_0, vInput.w + SQFloat::_0 };
+    return SQFastHash::Hash(COMPONENTS, sizeof(COMPONENTS));
+}
+
+pointer_uint_q SQFastVectorHashProvider::GenerateHashKey(const QBaseVector2 &vInput, const pointer_uint_q uBucketsInTable)
+{
+    QE_ASSERT_ERROR(uBucketsInTable > 0, "The input number of buckets must be greater than zero.");
+
+    return scast_q(SQFastVectorHashProvider::GenerateHash(vInput) % uBucketsInTable, pointer_uint_q);
+}
+
+pointer_uint_q SQFastVectorHashProvider::GenerateHashKey(const QBaseVector3 &vInput, const pointer_uint_q uBucketsInTable)
+{
+    QE_ASSERT_ERROR(uBucketsInTable > 0, "The input number of buckets must be greater than zero.");
+
+    return scast_q(SQFastVectorHashProvider::GenerateHash(vInput) % uBucketsInTable, pointer_uint_q);
+}
+
+pointer_uint_q SQFastVectorHashProvider::GenerateHashKey(const QBaseVector4 &vInput, const pointer_uint_q uBucketsInTable)
+{
+    QE_ASSERT_ERROR(uBucketsInTable > 0, "The input number of buckets must be greater than zero.");
+
+    return scast_q(SQFastVectorHashProvider::GenerateHash(vInput) % uBucketsInTable, pointer_uint_q);
+}
+
+
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
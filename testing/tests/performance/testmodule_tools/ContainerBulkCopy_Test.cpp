@@ -0,0 +1,193 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QArrayDynamic.h"
+#include "QList.h"
+#include "QVector3.h"
+#include "QStopwatch.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+using Kinesis::QuimeraEngine::Tools::Containers::QList;
+using Kinesis::QuimeraEngine::Tools::Math::QVector3;
+using Kinesis::QuimeraEngine::System::Timing::QStopwatch;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+
+/// <summary>
+/// The number of elements stored in the containers in every performance test.
+/// </summary>
+static const pointer_uint_q CONTAINERBULKCOPY_PERFORMANCETEST_NUMBER_OF_ELEMENTS = 1000000U;
+
+/// <summary>
+/// The number of times every copy is repeated.
+/// </summary>
+static const pointer_uint_q CONTAINERBULKCOPY_PERFORMANCETEST_REPETITIONS = 20U;
+
+/// <summary>
+/// An element with the same layout as a QVector3 that is not declared trivially copyable, so containers copy it element by element.
+/// </summary>
+class ContainerBulkCopyTestElement
+{
+public:
+
+    /// <summary>
+    /// Constructor that receives the value of every component.
+    /// </summary>
+    /// <param name="fValue">[IN] The value of every component.</param>
+    explicit ContainerBulkCopyTestElement(const float_q fValue) : m_vValue(fValue, fValue, fValue)
+    {
+    }
+
+    /// <summary>
+    /// Copy constructor.
+    /// </summary>
+    /// <param name="element">[IN] The element to copy.</param>
+    ContainerBulkCopyTestElement(const ContainerBulkCopyTestElement &element) : m_vValue(element.m_vValue)
+    {
+    }
+
+    /// <summary>
+    /// Included to be able to use this type inside containers with SQComparatorDefault.
+    /// </summary>
+    /// <param name="element">[IN] Another element.</param>
+    /// <returns>
+    /// True if the first component of this element is lower than the other's; False otherwise.
+    /// </returns>
+    bool operator<(const ContainerBulkCopyTestElement &element) const
+    {
+        return m_vValue.x < element.m_vValue.x;
+    }
+
+    /// <summary>
+    /// Included to be able to use this type inside containers with SQComparatorDefault.
+    /// </summary>
+    /// <param name="element">[IN] Another element.</param>
+    /// <returns>
+    /// True if both elements are equal; False otherwise.
+    /// </returns>
+    bool operator==(const ContainerBulkCopyTestElement &element) const
+    {
+        return m_vValue == element.m_vValue;
+    }
+
+    /// <summary>
+    /// The stored vector.
+    /// </summary>
+    QVector3 m_vValue;
+};
+
+
+QTEST_SUITE_BEGIN( ContainerBulkCopy_TestSuite )
+
+/// <summary>
+/// Compares the time spent when copying a dynamic array of 1M trivially copyable elements and of 1M elements that are copied one by one.
+/// </summary>
+QTEST_CASE ( QArrayDynamic_CopyConstructorTriviallyCopyableVersusElementByElement_Test )
+{
+    const pointer_uint_q NUMBER_OF_ELEMENTS = CONTAINERBULKCOPY_PERFORMANCETEST_NUMBER_OF_ELEMENTS;
+    const pointer_uint_q REPETITIONS = CONTAINERBULKCOPY_PERFORMANCETEST_REPETITIONS;
+    QStopwatch stopwatch;
+
+    QArrayDynamic<QVector3> arTrivialElements(NUMBER_OF_ELEMENTS);
+    QArrayDynamic<ContainerBulkCopyTestElement> arNonTrivialElements(NUMBER_OF_ELEMENTS);
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        arTrivialElements.Add(QVector3(scast_q(i, float_q), scast_q(i, float_q), scast_q(i, float_q)));
+        arNonTrivialElements.Add(ContainerBulkCopyTestElement(scast_q(i, float_q)));
+    }
+
+    pointer_uint_q uCopiedElements = 0;
+
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < REPETITIONS; ++i)
+    {
+        QArrayDynamic<QVector3> arCopy(arTrivialElements);
+        uCopiedElements += arCopy.GetCount();
+    }
+    const float_q TRIVIAL_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < REPETITIONS; ++i)
+    {
+        QArrayDynamic<ContainerBulkCopyTestElement> arCopy(arNonTrivialElements);
+        uCopiedElements += arCopy.GetCount();
+    }
+    const float_q NON_TRIVIAL_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    BOOST_CHECK_EQUAL(uCopiedElements, 2U * REPETITIONS * NUMBER_OF_ELEMENTS);
+    BOOST_TEST_MESSAGE("QArrayDynamic copy (" << NUMBER_OF_ELEMENTS << " elements x " << REPETITIONS << "): trivially copyable " << TRIVIAL_TIME << 
+                       " ms; element by element " << NON_TRIVIAL_TIME << " ms");
+}
+
+/// <summary>
+/// Compares the time spent when copying a list of 1M trivially copyable elements and of 1M elements that are copied one by one.
+/// </summary>
+QTEST_CASE ( QList_CopyConstructorTriviallyCopyableVersusElementByElement_Test )
+{
+    const pointer_uint_q NUMBER_OF_ELEMENTS = CONTAINERBULKCOPY_PERFORMANCETEST_NUMBER_OF_ELEMENTS;
+    const pointer_uint_q REPETITIONS = CONTAINERBULKCOPY_PERFORMANCETEST_REPETITIONS;
+    QStopwatch stopwatch;
+
+    QList<QVector3> trivialElements(NUMBER_OF_ELEMENTS);
+    QList<ContainerBulkCopyTestElement> nonTrivialElements(NUMBER_OF_ELEMENTS);
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        trivialElements.Add(QVector3(scast_q(i, float_q), scast_q(i, float_q), scast_q(i, float_q)));
+        nonTrivialElements.Add(ContainerBulkCopyTestElement(scast_q(i, float_q)));
+    }
+
+    pointer_uint_q uCopiedElements = 0;
+
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < REPETITIONS; ++i)
+    {
+        QList<QVector3> copy(trivialElements);
+        uCopiedElements += copy.GetCount();
+    }
+    const float_q TRIVIAL_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < REPETITIONS; ++i)
+    {
+        QList<ContainerBulkCopyTestElement> copy(nonTrivialElements);
+        uCopiedElements += copy.GetCount();
+    }
+    const float_q NON_TRIVIAL_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    BOOST_CHECK_EQUAL(uCopiedElements, 2U * REPETITIONS * NUMBER_OF_ELEMENTS);
+    BOOST_TEST_MESSAGE("QList copy (" << NUMBER_OF_ELEMENTS << " elements x " << REPETITIONS << "): trivially copyable " << TRIVIAL_TIME << 
+                       " ms; element by element " << NON_TRIVIAL_TIME << " ms");
+}
+
+// End - Test Suite: ContainerBulkCopy
+QTEST_SUITE_END()
@@ -0,0 +1,251 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QArrayDynamic.h"
+#include "QList.h"
+#include "QStopwatch.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+using Kinesis::QuimeraEngine::Tools::Containers::QList;
+using Kinesis::QuimeraEngine::System::Timing::QStopwatch;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+
+/// <summary>
+/// The number of elements added to the containers in every performance test.
+/// </summary>
+static const pointer_uint_q CONTAINEREMPLACE_PERFORMANCETEST_NUMBER_OF_ELEMENTS = 1000000U;
+
+/// <summary>
+/// An element that owns a heap buffer, like strings or nested containers do, and counts how many buffers are allocated.
+/// </summary>
+class ContainerEmplaceTestElement
+{
+public:
+
+    /// <summary>
+    /// Constructor that allocates a buffer and fills it with a value.
+    /// </summary>
+    /// <param name="uValue">[IN] The value to store.</param>
+    /// <param name="uLength">[IN] The length of the buffer.</param>
+    ContainerEmplaceTestElement(const unsigned int uValue, const unsigned int uLength) : m_puBuffer(new unsigned int[uLength]),
+                                                                                         m_uLength(uLength)
+    {
+        ++ContainerEmplaceTestElement::sm_uAllocations;
+
+        for(unsigned int i = 0; i < uLength; ++i)
+            m_puBuffer[i] = uValue;
+    }
+
+    /// <summary>
+    /// Copy constructor that allocates a new buffer and copies the content of the input element.
+    /// </summary>
+    /// <param name="element">[IN] The element to copy.</param>
+    ContainerEmplaceTestElement(const ContainerEmplaceTestElement &element) : m_puBuffer(new unsigned int[element.m_uLength]),
+                                                                             m_uLength(element.m_uLength)
+    {
+        ++ContainerEmplaceTestElement::sm_uAllocations;
+        memcpy(m_puBuffer, element.m_puBuffer, m_uLength * sizeof(unsigned int));
+    }
+
+    /// <summary>
+    /// Destructor that frees the buffer.
+    /// </summary>
+    ~ContainerEmplaceTestElement()
+    {
+        delete[] m_puBuffer;
+    }
+
+    /// <summary>
+    /// Included to be able to use this type inside containers with SQComparatorDefault.
+    /// </summary>
+    /// <param name="element">[IN] Another element.</param>
+    /// <returns>
+    /// True if the first value of this element is lower than the other's; False otherwise.
+    /// </returns>
+    bool operator<(const ContainerEmplaceTestElement &element) const
+    {
+        return m_puBuffer[0] < element.m_puBuffer[0];
+    }
+
+    /// <summary>
+    /// Included to be able to use this type inside containers with SQComparatorDefault.
+    /// </summary>
+    /// <param name="element">[IN] Another element.</param>
+    /// <returns>
+    /// True if the first value of both elements is the same; False otherwise.
+    /// </returns>
+    bool operator==(const ContainerEmplaceTestElement &element) const
+    {
+        return m_puBuffer[0] == element.m_puBuffer[0];
+    }
+
+private:
+
+    // Hidden
+    ContainerEmplaceTestElement& operator=(const ContainerEmplaceTestElement&);
+
+public:
+
+    /// <summary>
+    /// The number of buffers allocated by all the instances since the last reset.
+    /// </summary>
+    static pointer_uint_q sm_uAllocations;
+
+private:
+
+    /// <summary>
+    /// The buffer.
+    /// </summary>
+    unsigned int* m_puBuffer;
+
+    /// <summary>
+    /// The length of the buffer.
+    /// </summary>
+    unsigned int m_uLength;
+};
+
+pointer_uint_q ContainerEmplaceTestElement::sm_uAllocations = 0;
+
+
+QTEST_SUITE_BEGIN( ContainerEmplace_TestSuite )
+
+/// <summary>
+/// Compares the number of buffer allocations and the time spent when adding 1M elements to a dynamic array by copy and by in-place construction.
+/// </summary>
+QTEST_CASE ( QArrayDynamic_AddVersusEmplace_Test )
+{
+    const pointer_uint_q NUMBER_OF_ELEMENTS = CONTAINEREMPLACE_PERFORMANCETEST_NUMBER_OF_ELEMENTS;
+    const unsigned int BUFFER_LENGTH = 8U;
+    QStopwatch stopwatch;
+
+    ContainerEmplaceTestElement::sm_uAllocations = 0;
+    stopwatch.Set();
+    {
+        // The capacity grows as elements are added, so reallocations are included in the measures
+        QArrayDynamic<ContainerEmplaceTestElement> arElements(1U);
+
+        for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+            arElements.Add(ContainerEmplaceTestElement(scast_q(i, unsigned int), BUFFER_LENGTH));
+    }
+    const float_q ADD_TIME = stopwatch.GetElapsedTimeAsFloat();
+    const pointer_uint_q ADD_ALLOCATIONS = ContainerEmplaceTestElement::sm_uAllocations;
+
+    ContainerEmplaceTestElement::sm_uAllocations = 0;
+    stopwatch.Set();
+    {
+        QArrayDynamic<ContainerEmplaceTestElement> arElements(1U);
+
+        for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+            arElements.Emplace(scast_q(i, unsigned int), BUFFER_LENGTH);
+    }
+    const float_q EMPLACE_TIME = stopwatch.GetElapsedTimeAsFloat();
+    const pointer_uint_q EMPLACE_ALLOCATIONS = ContainerEmplaceTestElement::sm_uAllocations;
+
+    // Reallocations move elements bitwise, so every element is allocated only once when it is constructed in place
+    BOOST_CHECK_EQUAL(EMPLACE_ALLOCATIONS, NUMBER_OF_ELEMENTS);
+    BOOST_CHECK_EQUAL(ADD_ALLOCATIONS, 2U * NUMBER_OF_ELEMENTS);
+    BOOST_TEST_MESSAGE("QArrayDynamic (" << NUMBER_OF_ELEMENTS << " elements): Add " << ADD_TIME << " ms, " << ADD_ALLOCATIONS << 
+                       " allocations; Emplace " << EMPLACE_TIME << " ms, " << EMPLACE_ALLOCATIONS << " allocations");
+}
+
+/// <summary>
+/// Compares the number of buffer allocations and the time spent when adding 1M elements to a list by copy and by in-place construction.
+/// </summary>
+QTEST_CASE ( QList_AddVersusEmplace_Test )
+{
+    const pointer_uint_q NUMBER_OF_ELEMENTS = CONTAINEREMPLACE_PERFORMANCETEST_NUMBER_OF_ELEMENTS;
+    const unsigned int BUFFER_LENGTH = 8U;
+    QStopwatch stopwatch;
+
+    ContainerEmplaceTestElement::sm_uAllocations = 0;
+    stopwatch.Set();
+    {
+        QList<ContainerEmplaceTestElement> elements(1U);
+
+        for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+            elements.Add(ContainerEmplaceTestElement(scast_q(i, unsigned int), BUFFER_LENGTH));
+    }
+    const float_q ADD_TIME = stopwatch.GetElapsedTimeAsFloat();
+    const pointer_uint_q ADD_ALLOCATIONS = ContainerEmplaceTestElement::sm_uAllocations;
+
+    ContainerEmplaceTestElement::sm_uAllocations = 0;
+    stopwatch.Set();
+    {
+        QList<ContainerEmplaceTestElement> elements(1U);
+
+        for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+            elements.Emplace(scast_q(i, unsigned int), BUFFER_LENGTH);
+    }
+    const float_q EMPLACE_TIME = stopwatch.GetElapsedTimeAsFloat();
+    const pointer_uint_q EMPLACE_ALLOCATIONS = ContainerEmplaceTestElement::sm_uAllocations;
+
+    BOOST_CHECK_EQUAL(EMPLACE_ALLOCATIONS, NUMBER_OF_ELEMENTS);
+    BOOST_CHECK_EQUAL(ADD_ALLOCATIONS, 2U * NUMBER_OF_ELEMENTS);
+    BOOST_TEST_MESSAGE("QList (" << NUMBER_OF_ELEMENTS << " elements): Add " << ADD_TIME << " ms, " << ADD_ALLOCATIONS << 
+                       " allocations; Emplace " << EMPLACE_TIME << " ms, " << EMPLACE_ALLOCATIONS << " allocations");
+}
+
+/// <summary>
+/// Compares the time spent when adding 1M strings to a dynamic array by copy and by in-place construction.
+/// </summary>
+QTEST_CASE ( QArrayDynamic_AddVersusEmplaceUsingStrings_Test )
+{
+    const pointer_uint_q NUMBER_OF_ELEMENTS = CONTAINEREMPLACE_PERFORMANCETEST_NUMBER_OF_ELEMENTS;
+    const char* SOURCE_TEXT = "The quick brown fox jumps over the lazy dog";
+    QStopwatch stopwatch;
+
+    stopwatch.Set();
+    {
+        QArrayDynamic<string_q> arStrings(1U);
+
+        for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+            arStrings.Add(string_q(SOURCE_TEXT));
+    }
+    const float_q ADD_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    stopwatch.Set();
+    {
+        QArrayDynamic<string_q> arStrings(1U);
+
+        for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+            arStrings.Emplace(SOURCE_TEXT);
+
+        BOOST_CHECK_EQUAL(arStrings.GetCount(), NUMBER_OF_ELEMENTS);
+    }
+    const float_q EMPLACE_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    BOOST_TEST_MESSAGE("QArrayDynamic<string_q> (" << NUMBER_OF_ELEMENTS << " elements): Add " << ADD_TIME << " ms; Emplace " << EMPLACE_TIME << " ms");
+}
+
+// End - Test Suite: ContainerEmplace
+QTEST_SUITE_END()
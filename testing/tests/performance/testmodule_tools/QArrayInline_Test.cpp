@@ -0,0 +1,92 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QArrayDynamic.h"
+#include "QArrayInline.h"
+#include "QStopwatch.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayInline;
+using Kinesis::QuimeraEngine::System::Timing::QStopwatch;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+/// <summary>
+/// The number of short-lived arrays created in every performance test.
+/// </summary>
+static const pointer_uint_q QARRAYINLINE_PERFORMANCETEST_NUMBER_OF_ARRAYS = 1000000U;
+
+
+QTEST_SUITE_BEGIN( QArrayInline_TestSuite )
+
+/// <summary>
+/// Compares the time spent when creating 1M short-lived arrays of 6 elements, as dynamic arrays and as inline arrays that can store 8 elements.
+/// </summary>
+QTEST_CASE ( ShortLivedArrays_DynamicVersusInline_Test )
+{
+    const pointer_uint_q NUMBER_OF_ARRAYS = QARRAYINLINE_PERFORMANCETEST_NUMBER_OF_ARRAYS;
+    const u32_q NUMBER_OF_ELEMENTS = 6U;
+    QStopwatch stopwatch;
+
+    u32_q uDynamicSum = 0;
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < NUMBER_OF_ARRAYS; ++i)
+    {
+        QArrayDynamic<u32_q> arElements(8U);
+
+        for(u32_q j = 0; j < NUMBER_OF_ELEMENTS; ++j)
+            arElements.Add(j);
+
+        uDynamicSum += arElements[NUMBER_OF_ELEMENTS - 1U];
+    }
+    const float_q DYNAMIC_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    u32_q uInlineSum = 0;
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < NUMBER_OF_ARRAYS; ++i)
+    {
+        QArrayInline<u32_q, 8U> arElements;
+
+        for(u32_q j = 0; j < NUMBER_OF_ELEMENTS; ++j)
+            arElements.Add(j);
+
+        uInlineSum += arElements[NUMBER_OF_ELEMENTS - 1U];
+    }
+    const float_q INLINE_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    BOOST_CHECK_EQUAL(uDynamicSum, uInlineSum);
+    BOOST_TEST_MESSAGE("Short-lived arrays (" << NUMBER_OF_ARRAYS << " arrays of " << NUMBER_OF_ELEMENTS << " elements): QArrayDynamic " << 
+                       DYNAMIC_TIME << " ms; QArrayInline " << INLINE_TIME << " ms");
+}
+
+// End - Test Suite: QArrayInline
+QTEST_SUITE_END()
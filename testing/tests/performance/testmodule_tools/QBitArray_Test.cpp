@@ -0,0 +1,231 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QBitArray.h"
+#include "QArrayDynamic.h"
+#include "QStopwatch.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QBitArray;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+using Kinesis::QuimeraEngine::System::Timing::QStopwatch;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+
+/// <summary>
+/// The number of bits stored in the containers in every performance test.
+/// </summary>
+static const pointer_uint_q QBITARRAY_PERFORMANCETEST_NUMBER_OF_BITS = 1000000U;
+
+/// <summary>
+/// The number of times every operation is repeated.
+/// </summary>
+static const pointer_uint_q QBITARRAY_PERFORMANCETEST_REPETITIONS = 20U;
+
+/// <summary>
+/// The distance between the bits that are set in the sparse containers.
+/// </summary>
+static const pointer_uint_q QBITARRAY_PERFORMANCETEST_SPARSE_DISTANCE = 64U;
+
+
+QTEST_SUITE_BEGIN( QBitArray_TestSuite )
+
+/// <summary>
+/// Compares the time spent when adding 1M bits, one by one, to a bit array and to a dynamic array of booleans, and the memory they occupy.
+/// </summary>
+QTEST_CASE ( Add_QBitArrayVersusArrayOfBooleans_Test )
+{
+    const pointer_uint_q NUMBER_OF_BITS = QBITARRAY_PERFORMANCETEST_NUMBER_OF_BITS;
+    const pointer_uint_q REPETITIONS = QBITARRAY_PERFORMANCETEST_REPETITIONS;
+    QStopwatch stopwatch;
+
+    pointer_uint_q uBitArrayBytes = 0;
+    pointer_uint_q uBooleanArrayBytes = 0;
+    pointer_uint_q uAddedBits = 0;
+
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < REPETITIONS; ++i)
+    {
+        QBitArray<> bits;
+
+        for(pointer_uint_q j = 0; j < NUMBER_OF_BITS; ++j)
+            bits.Add(j % 3U == 0);
+
+        uAddedBits += bits.GetCount();
+        uBitArrayBytes = bits.GetCapacity() / 8U;
+    }
+    const float_q BIT_ARRAY_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < REPETITIONS; ++i)
+    {
+        QArrayDynamic<bool> arBooleans;
+
+        for(pointer_uint_q j = 0; j < NUMBER_OF_BITS; ++j)
+            arBooleans.Add(j % 3U == 0);
+
+        uAddedBits += arBooleans.GetCount();
+        uBooleanArrayBytes = arBooleans.GetCapacity() * sizeof(bool);
+    }
+    const float_q BOOLEAN_ARRAY_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    BOOST_CHECK_EQUAL(uAddedBits, 2U * REPETITIONS * NUMBER_OF_BITS);
+    BOOST_TEST_MESSAGE("Add (" << NUMBER_OF_BITS << " bits x " << REPETITIONS << "): QBitArray " << BIT_ARRAY_TIME << " ms, " << uBitArrayBytes << 
+                       " bytes; QArrayDynamic<bool> " << BOOLEAN_ARRAY_TIME << " ms, " << uBooleanArrayBytes << " bytes");
+}
+
+/// <summary>
+/// Compares the time spent when combining two sequences of 1M bits with a bitwise AND, using bit arrays and dynamic arrays of booleans.
+/// </summary>
+QTEST_CASE ( And_QBitArrayVersusArrayOfBooleans_Test )
+{
+    const pointer_uint_q NUMBER_OF_BITS = QBITARRAY_PERFORMANCETEST_NUMBER_OF_BITS;
+    const pointer_uint_q REPETITIONS = QBITARRAY_PERFORMANCETEST_REPETITIONS;
+    QStopwatch stopwatch;
+
+    QBitArray<> bits1(NUMBER_OF_BITS, true);
+    QBitArray<> bits2(NUMBER_OF_BITS, false);
+    QArrayDynamic<bool> arBooleans1(NUMBER_OF_BITS);
+    QArrayDynamic<bool> arBooleans2(NUMBER_OF_BITS);
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BITS; ++i)
+    {
+        bits2.SetBit(i, i % 2U == 0);
+        arBooleans1.Add(true);
+        arBooleans2.Add(i % 2U == 0);
+    }
+
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < REPETITIONS; ++i)
+        bits1.And(bits2);
+    const float_q BIT_ARRAY_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < REPETITIONS; ++i)
+    {
+        for(pointer_uint_q j = 0; j < NUMBER_OF_BITS; ++j)
+            arBooleans1[j] = arBooleans1[j] && arBooleans2[j];
+    }
+    const float_q BOOLEAN_ARRAY_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    BOOST_CHECK_EQUAL(bits1.GetBit(NUMBER_OF_BITS - 2U), arBooleans1[NUMBER_OF_BITS - 2U]);
+    BOOST_TEST_MESSAGE("And (" << NUMBER_OF_BITS << " bits x " << REPETITIONS << "): QBitArray " << BIT_ARRAY_TIME << 
+                       " ms; QArrayDynamic<bool> " << BOOLEAN_ARRAY_TIME << " ms");
+}
+
+/// <summary>
+/// Compares the time spent when counting the set bits among 1M bits, using a bit array and a dynamic array of booleans.
+/// </summary>
+QTEST_CASE ( CountSetBits_QBitArrayVersusArrayOfBooleans_Test )
+{
+    const pointer_uint_q NUMBER_OF_BITS = QBITARRAY_PERFORMANCETEST_NUMBER_OF_BITS;
+    const pointer_uint_q REPETITIONS = QBITARRAY_PERFORMANCETEST_REPETITIONS;
+    QStopwatch stopwatch;
+
+    QBitArray<> bits(NUMBER_OF_BITS, false);
+    QArrayDynamic<bool> arBooleans(NUMBER_OF_BITS);
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BITS; ++i)
+    {
+        bits.SetBit(i, i % 3U == 0);
+        arBooleans.Add(i % 3U == 0);
+    }
+
+    pointer_uint_q uBitArrayCount = 0;
+    pointer_uint_q uBooleanArrayCount = 0;
+
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < REPETITIONS; ++i)
+        uBitArrayCount += bits.CountSetBits();
+    const float_q BIT_ARRAY_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < REPETITIONS; ++i)
+    {
+        for(pointer_uint_q j = 0; j < NUMBER_OF_BITS; ++j)
+        {
+            if(arBooleans[j])
+                ++uBooleanArrayCount;
+        }
+    }
+    const float_q BOOLEAN_ARRAY_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    BOOST_CHECK_EQUAL(uBitArrayCount, uBooleanArrayCount);
+    BOOST_TEST_MESSAGE("CountSetBits (" << NUMBER_OF_BITS << " bits x " << REPETITIONS << "): QBitArray " << BIT_ARRAY_TIME << 
+                       " ms; QArrayDynamic<bool> " << BOOLEAN_ARRAY_TIME << " ms");
+}
+
+/// <summary>
+/// Compares the time spent when visiting the set bits among 1M bits, of which one out of 64 is set, using a bit array and a dynamic array of booleans.
+/// </summary>
+QTEST_CASE ( FindNextSetBit_QBitArrayVersusArrayOfBooleans_Test )
+{
+    const pointer_uint_q NUMBER_OF_BITS = QBITARRAY_PERFORMANCETEST_NUMBER_OF_BITS;
+    const pointer_uint_q REPETITIONS = QBITARRAY_PERFORMANCETEST_REPETITIONS;
+    QStopwatch stopwatch;
+
+    QBitArray<> bits(NUMBER_OF_BITS, false);
+    QArrayDynamic<bool> arBooleans(NUMBER_OF_BITS);
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BITS; ++i)
+    {
+        bits.SetBit(i, i % QBITARRAY_PERFORMANCETEST_SPARSE_DISTANCE == 0);
+        arBooleans.Add(i % QBITARRAY_PERFORMANCETEST_SPARSE_DISTANCE == 0);
+    }
+
+    pointer_uint_q uBitArraySum = 0;
+    pointer_uint_q uBooleanArraySum = 0;
+
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < REPETITIONS; ++i)
+    {
+        for(pointer_uint_q uPosition = bits.FindFirstSetBit(); uPosition != QBitArray<>::END_POSITION; uPosition = bits.FindNextSetBit(uPosition + 1U))
+            uBitArraySum += uPosition;
+    }
+    const float_q BIT_ARRAY_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < REPETITIONS; ++i)
+    {
+        for(pointer_uint_q j = 0; j < NUMBER_OF_BITS; ++j)
+        {
+            if(arBooleans[j])
+                uBooleanArraySum += j;
+        }
+    }
+    const float_q BOOLEAN_ARRAY_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    BOOST_CHECK_EQUAL(uBitArraySum, uBooleanArraySum);
+    BOOST_TEST_MESSAGE("FindNextSetBit (" << NUMBER_OF_BITS << " bits, 1 out of " << QBITARRAY_PERFORMANCETEST_SPARSE_DISTANCE << " set, x " << REPETITIONS << 
+                       "): QBitArray " << BIT_ARRAY_TIME << " ms; QArrayDynamic<bool> " << BOOLEAN_ARRAY_TIME << " ms");
+}
+
+// End - Test Suite: QBitArray
+QTEST_SUITE_END()
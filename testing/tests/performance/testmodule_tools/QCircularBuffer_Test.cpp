@@ -0,0 +1,172 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QCircularBufferFixed.h"
+#include "QArrayDynamic.h"
+#include "QList.h"
+#include "QStopwatch.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QCircularBufferFixed;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+using Kinesis::QuimeraEngine::Tools::Containers::QList;
+using Kinesis::QuimeraEngine::System::Timing::QStopwatch;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+
+/// <summary>
+/// The number of samples kept in the window.
+/// </summary>
+static const u32_q QCIRCULARBUFFER_PERFORMANCETEST_WINDOW_SIZE = 512U;
+
+/// <summary>
+/// The number of samples added to every window.
+/// </summary>
+static const u32_q QCIRCULARBUFFER_PERFORMANCETEST_NUMBER_OF_SAMPLES = 2000000U;
+
+
+QTEST_SUITE_BEGIN( QCircularBuffer_TestSuite )
+
+/// <summary>
+/// Compares the time it takes to keep a window of the most recent samples, adding a sample at the back and removing the oldest one 
+/// at the front every time, using a dynamic array, a list and a fixed circular buffer.
+/// </summary>
+QTEST_CASE ( SlidingWindow_ArrayDynamicVersusListVersusCircularBuffer_Test )
+{
+    QStopwatch stopwatch;
+
+    // Dynamic array
+    QArrayDynamic<u32_q> arWindow(QCIRCULARBUFFER_PERFORMANCETEST_WINDOW_SIZE);
+    u64_q uArrayChecksum = 0;
+
+    stopwatch.Set();
+    for(u32_q i = 0; i < QCIRCULARBUFFER_PERFORMANCETEST_NUMBER_OF_SAMPLES; ++i)
+    {
+        if(arWindow.GetCount() == QCIRCULARBUFFER_PERFORMANCETEST_WINDOW_SIZE)
+            arWindow.Remove(0);
+
+        arWindow.Add(i);
+        uArrayChecksum += arWindow[0];
+    }
+    const float_q ARRAY_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    // List
+    QList<u32_q> listWindow(QCIRCULARBUFFER_PERFORMANCETEST_WINDOW_SIZE);
+    u64_q uListChecksum = 0;
+
+    stopwatch.Set();
+    for(u32_q i = 0; i < QCIRCULARBUFFER_PERFORMANCETEST_NUMBER_OF_SAMPLES; ++i)
+    {
+        if(listWindow.GetCount() == QCIRCULARBUFFER_PERFORMANCETEST_WINDOW_SIZE)
+            listWindow.Remove(listWindow.GetFirst());
+
+        listWindow.Add(i);
+        uListChecksum += *listWindow.GetFirst();
+    }
+    const float_q LIST_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    // Circular buffer
+    QCircularBufferFixed<u32_q> bufferWindow(QCIRCULARBUFFER_PERFORMANCETEST_WINDOW_SIZE);
+    u64_q uBufferChecksum = 0;
+
+    stopwatch.Set();
+    for(u32_q i = 0; i < QCIRCULARBUFFER_PERFORMANCETEST_NUMBER_OF_SAMPLES; ++i)
+    {
+        bufferWindow.PushBack(i);
+        uBufferChecksum += bufferWindow.GetFront();
+    }
+    const float_q BUFFER_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    BOOST_CHECK_EQUAL(uArrayChecksum, uBufferChecksum);
+    BOOST_CHECK_EQUAL(uListChecksum, uBufferChecksum);
+
+    BOOST_TEST_MESSAGE("Sliding window of " << QCIRCULARBUFFER_PERFORMANCETEST_WINDOW_SIZE << " elements, " << QCIRCULARBUFFER_PERFORMANCETEST_NUMBER_OF_SAMPLES << " samples:");
+    BOOST_TEST_MESSAGE("QArrayDynamic (Remove(0) + Add):    " << ARRAY_TIME << " ms");
+    BOOST_TEST_MESSAGE("QList (Remove(GetFirst()) + Add):   " << LIST_TIME << " ms");
+    BOOST_TEST_MESSAGE("QCircularBufferFixed (PushBack):    " << BUFFER_TIME << " ms");
+}
+
+/// <summary>
+/// Compares the time it takes to copy all the elements of a window to an external buffer, element by element using the index and 
+/// in two bulk copies using the contiguous ranges.
+/// </summary>
+QTEST_CASE ( CopyElements_IndexedAccessVersusContiguousRanges_Test )
+{
+    static const u32_q NUMBER_OF_COPIES = 50000U;
+
+    QStopwatch stopwatch;
+    QCircularBufferFixed<u32_q> buffer(QCIRCULARBUFFER_PERFORMANCETEST_WINDOW_SIZE);
+
+    // The sequence wraps around the end of the internal buffer
+    for(u32_q i = 0; i < QCIRCULARBUFFER_PERFORMANCETEST_WINDOW_SIZE + QCIRCULARBUFFER_PERFORMANCETEST_WINDOW_SIZE / 3U; ++i)
+        buffer.PushBack(i);
+
+    u32_q arDestination[QCIRCULARBUFFER_PERFORMANCETEST_WINDOW_SIZE];
+    u64_q uIndexedChecksum = 0;
+
+    stopwatch.Set();
+    for(u32_q uCopy = 0; uCopy < NUMBER_OF_COPIES; ++uCopy)
+    {
+        for(u32_q i = 0; i < QCIRCULARBUFFER_PERFORMANCETEST_WINDOW_SIZE; ++i)
+            arDestination[i] = buffer[i];
+
+        uIndexedChecksum += arDestination[uCopy % QCIRCULARBUFFER_PERFORMANCETEST_WINDOW_SIZE];
+    }
+    const float_q INDEXED_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    u64_q uRangesChecksum = 0;
+
+    stopwatch.Set();
+    for(u32_q uCopy = 0; uCopy < NUMBER_OF_COPIES; ++uCopy)
+    {
+        const u32_q* pFirstRange = null_q;
+        const u32_q* pSecondRange = null_q;
+        pointer_uint_q uFirstRangeCount = 0;
+        pointer_uint_q uSecondRangeCount = 0;
+        buffer.GetContiguousRanges(pFirstRange, uFirstRangeCount, pSecondRange, uSecondRangeCount);
+
+        memcpy(arDestination, pFirstRange, uFirstRangeCount * sizeof(u32_q));
+        memcpy(arDestination + uFirstRangeCount, pSecondRange, uSecondRangeCount * sizeof(u32_q));
+
+        uRangesChecksum += arDestination[uCopy % QCIRCULARBUFFER_PERFORMANCETEST_WINDOW_SIZE];
+    }
+    const float_q RANGES_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    BOOST_CHECK_EQUAL(uIndexedChecksum, uRangesChecksum);
+
+    BOOST_TEST_MESSAGE("Copying " << QCIRCULARBUFFER_PERFORMANCETEST_WINDOW_SIZE << " elements " << NUMBER_OF_COPIES << " times:");
+    BOOST_TEST_MESSAGE("Indexed access:     " << INDEXED_TIME << " ms");
+    BOOST_TEST_MESSAGE("Contiguous ranges:  " << RANGES_TIME << " ms");
+}
+
+// End - Test Suite: QCircularBuffer
+QTEST_SUITE_END()
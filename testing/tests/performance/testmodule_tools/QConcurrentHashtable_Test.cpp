@@ -0,0 +1,201 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QConcurrentHashtable.h"
+#include "QHashtable.h"
+#include "QSharedMutex.h"
+#include "QScopedExclusiveLock.h"
+#include "QScopedSharedLock.h"
+#include "QThread.h"
+#include "QDelegate.h"
+#include "QStopwatch.h"
+
+using Kinesis::QuimeraEngine::System::Threading::QConcurrentHashtable;
+using Kinesis::QuimeraEngine::System::Threading::QSharedMutex;
+using Kinesis::QuimeraEngine::System::Threading::QScopedExclusiveLock;
+using Kinesis::QuimeraEngine::System::Threading::QScopedSharedLock;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::Tools::Containers::QHashtable;
+using Kinesis::QuimeraEngine::System::Timing::QStopwatch;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+/// <summary>
+/// The number of keys stored in the tables before the threads start.
+/// </summary>
+static const u32_q QCONCURRENTHASHTABLE_PERFORMANCETEST_NUMBER_OF_KEYS = 100000U;
+
+/// <summary>
+/// The number of operations performed by every thread. One out of ten is a write (AddOrUpdate), the rest are lookups.
+/// </summary>
+static const u32_q QCONCURRENTHASHTABLE_PERFORMANCETEST_OPERATIONS_PER_THREAD = 500000U;
+
+/// <summary>
+/// The numbers of threads used to measure the throughput.
+/// </summary>
+static const u32_q QCONCURRENTHASHTABLE_PERFORMANCETEST_THREADS[] = { 1U, 2U, 4U, 8U, 16U };
+
+/// <summary>
+/// The number of segments of the concurrent table.
+/// </summary>
+static const pointer_uint_q QCONCURRENTHASHTABLE_PERFORMANCETEST_NUMBER_OF_SEGMENTS = 64U;
+
+/// <summary>
+/// A hashtable protected by a single shared mutex, which is how shared registries are protected without a concurrent table.
+/// </summary>
+struct QConcurrentHashtable_PerformanceTest_LockedHashtable
+{
+    QConcurrentHashtable_PerformanceTest_LockedHashtable() : m_hashtable(QCONCURRENTHASHTABLE_PERFORMANCETEST_NUMBER_OF_KEYS, 1U)
+    {
+    }
+
+    QHashtable<u32_q, u32_q> m_hashtable;
+    QSharedMutex m_mutex;
+};
+
+/// <summary>
+/// Performs lookups and writes on a hashtable protected by a single shared mutex.
+/// </summary>
+/// <param name="pTable">[IN/OUT] The table.</param>
+/// <param name="uSeed">[IN] The seed used to generate the keys.</param>
+static void QConcurrentHashtable_PerformanceTest_UseLockedHashtable(QConcurrentHashtable_PerformanceTest_LockedHashtable* pTable, const u32_q uSeed)
+{
+    u32_q uRandom = uSeed;
+    u32_q uValue = 0;
+
+    for(u32_q i = 0; i < QCONCURRENTHASHTABLE_PERFORMANCETEST_OPERATIONS_PER_THREAD; ++i)
+    {
+        uRandom = uRandom * 1664525U + 1013904223U;
+        const u32_q KEY = (uRandom >> 8U) % QCONCURRENTHASHTABLE_PERFORMANCETEST_NUMBER_OF_KEYS;
+
+        if(i % 10U == 0)
+        {
+            QScopedExclusiveLock<QSharedMutex> exclusiveLock(pTable->m_mutex);
+            pTable->m_hashtable.SetValue(KEY, i);
+        }
+        else
+        {
+            QScopedSharedLock<QSharedMutex> sharedLock(pTable->m_mutex);
+            uValue += pTable->m_hashtable.GetValue(KEY);
+        }
+    }
+}
+
+/// <summary>
+/// Performs lookups and writes on a concurrent hashtable.
+/// </summary>
+/// <param name="pTable">[IN/OUT] The table.</param>
+/// <param name="uSeed">[IN] The seed used to generate the keys.</param>
+static void QConcurrentHashtable_PerformanceTest_UseConcurrentHashtable(QConcurrentHashtable<u32_q, u32_q>* pTable, const u32_q uSeed)
+{
+    u32_q uRandom = uSeed;
+    u32_q uValue = 0;
+
+    for(u32_q i = 0; i < QCONCURRENTHASHTABLE_PERFORMANCETEST_OPERATIONS_PER_THREAD; ++i)
+    {
+        uRandom = uRandom * 1664525U + 1013904223U;
+        const u32_q KEY = (uRandom >> 8U) % QCONCURRENTHASHTABLE_PERFORMANCETEST_NUMBER_OF_KEYS;
+
+        if(i % 10U == 0)
+            pTable->AddOrUpdate(KEY, i);
+        else
+            pTable->TryGetValue(KEY, uValue);
+    }
+}
+
+
+QTEST_SUITE_BEGIN( QConcurrentHashtable_TestSuite )
+
+/// <summary>
+/// Compares the throughput of a hashtable protected by one shared mutex and a concurrent hashtable, when several threads perform lookups (90%) 
+/// and writes (10%) on them at the same time.
+/// </summary>
+QTEST_CASE ( Throughput_SingleLockVersusLockStriping_Test )
+{
+    const pointer_uint_q NUMBER_OF_KEYS = QCONCURRENTHASHTABLE_PERFORMANCETEST_NUMBER_OF_KEYS;
+    const u32_q OPERATIONS_PER_THREAD = QCONCURRENTHASHTABLE_PERFORMANCETEST_OPERATIONS_PER_THREAD;
+    QStopwatch stopwatch;
+
+    QConcurrentHashtable_PerformanceTest_LockedHashtable lockedHashtable;
+    QConcurrentHashtable<u32_q, u32_q> concurrentHashtable(QCONCURRENTHASHTABLE_PERFORMANCETEST_NUMBER_OF_SEGMENTS, NUMBER_OF_KEYS, 1U);
+
+    for(u32_q uKey = 0; uKey < NUMBER_OF_KEYS; ++uKey)
+    {
+        lockedHashtable.m_hashtable.Add(uKey, uKey);
+        concurrentHashtable.AddOrUpdate(uKey, uKey);
+    }
+
+    QDelegate<void (QConcurrentHashtable_PerformanceTest_LockedHashtable*, const u32_q)> lockedFunction(&QConcurrentHashtable_PerformanceTest_UseLockedHashtable);
+    QDelegate<void (QConcurrentHashtable<u32_q, u32_q>*, const u32_q)> concurrentFunction(&QConcurrentHashtable_PerformanceTest_UseConcurrentHashtable);
+
+    for(pointer_uint_q uThreads = 0; uThreads < sizeof(QCONCURRENTHASHTABLE_PERFORMANCETEST_THREADS) / sizeof(u32_q); ++uThreads)
+    {
+        const u32_q NUMBER_OF_THREADS = QCONCURRENTHASHTABLE_PERFORMANCETEST_THREADS[uThreads];
+        QThread** arThreads = new QThread*[NUMBER_OF_THREADS];
+
+        stopwatch.Set();
+        for(u32_q i = 0; i < NUMBER_OF_THREADS; ++i)
+            arThreads[i] = new QThread(lockedFunction, &lockedHashtable, i + 1U);
+
+        for(u32_q i = 0; i < NUMBER_OF_THREADS; ++i)
+        {
+            arThreads[i]->Join();
+            delete arThreads[i];
+        }
+        const float_q LOCKED_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+        stopwatch.Set();
+        for(u32_q i = 0; i < NUMBER_OF_THREADS; ++i)
+            arThreads[i] = new QThread(concurrentFunction, &concurrentHashtable, i + 1U);
+
+        for(u32_q i = 0; i < NUMBER_OF_THREADS; ++i)
+        {
+            arThreads[i]->Join();
+            delete arThreads[i];
+        }
+        const float_q CONCURRENT_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+        delete[] arThreads;
+
+        const float_q TOTAL_OPERATIONS = scast_q(NUMBER_OF_THREADS * OPERATIONS_PER_THREAD, float_q);
+
+        BOOST_TEST_MESSAGE("Hashtable throughput (" << NUMBER_OF_THREADS << " threads, " << OPERATIONS_PER_THREAD << " operations per thread): QHashtable + QSharedMutex " << 
+                           LOCKED_TIME << " ms (" << TOTAL_OPERATIONS / LOCKED_TIME << " ops/ms); QConcurrentHashtable " << 
+                           CONCURRENT_TIME << " ms (" << TOTAL_OPERATIONS / CONCURRENT_TIME << " ops/ms)");
+    }
+
+    BOOST_CHECK_EQUAL(concurrentHashtable.GetCount(), NUMBER_OF_KEYS);
+}
+
+// End - Test Suite: QConcurrentHashtable
+QTEST_SUITE_END()
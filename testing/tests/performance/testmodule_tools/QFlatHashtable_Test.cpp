@@ -0,0 +1,196 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QFlatHashtable.h"
+#include "QHashtable.h"
+#include "QStopwatch.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QFlatHashtable;
+using Kinesis::QuimeraEngine::Tools::Containers::QHashtable;
+using Kinesis::QuimeraEngine::System::Timing::QStopwatch;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+
+/// <summary>
+/// The numbers of elements used in every performance test, from 1K to 10M.
+/// </summary>
+static const pointer_uint_q QFLATHASHTABLE_PERFORMANCETEST_SIZES[] = { 1000U, 10000U, 100000U, 1000000U, 10000000U };
+
+/// <summary>
+/// Generates the Nth key of a sequence of unique keys spread across all the range of 32-bits integers.
+/// </summary>
+/// <param name="uIndex">[IN] The position of the key in the sequence.</param>
+/// <returns>
+/// A unique key.
+/// </returns>
+static u32_q QFlatHashtable_PerformanceTest_GenerateKey(const pointer_uint_q uIndex)
+{
+    // Multiplying by an odd number is a bijection modulo 2^32, so keys are never repeated
+    return scast_q(uIndex, u32_q) * 2654435761U;
+}
+
+/// <summary>
+/// Generates a random permutation of the positions of a sequence.
+/// </summary>
+/// <remarks>
+/// It is used to search for and remove elements in a different order than they were added, so the order in which the hashtable stores them
+/// does not benefit any implementation.
+/// </remarks>
+/// <param name="uCount">[IN] The length of the sequence. It must be greater than zero.</param>
+/// <returns>
+/// An array that contains every position once. It must be deleted by the caller.
+/// </returns>
+static pointer_uint_q* QFlatHashtable_PerformanceTest_GeneratePermutation(const pointer_uint_q uCount)
+{
+    pointer_uint_q* arPositions = new pointer_uint_q[uCount];
+
+    for(pointer_uint_q i = 0; i < uCount; ++i)
+        arPositions[i] = i;
+
+    // Fisher-Yates shuffle, using a linear congruential generator with a fixed seed so all the executions are equal
+    u32_q uRandom = 12345U;
+
+    for(pointer_uint_q i = uCount - 1U; i > 0; --i)
+    {
+        uRandom = uRandom * 1664525U + 1013904223U;
+        const pointer_uint_q SWAPPED = scast_q((scast_q(uRandom, u64_q) * (i + 1U)) >> 32U, pointer_uint_q);
+        const pointer_uint_q AUXILIARY = arPositions[i];
+        arPositions[i] = arPositions[SWAPPED];
+        arPositions[SWAPPED] = AUXILIARY;
+    }
+
+    return arPositions;
+}
+
+/// <summary>
+/// Adds, searches for and removes a number of elements in a hashtable, measuring the time spent by every operation.
+/// </summary>
+/// <typeparam name="HashtableT">The type of the hashtable.</typeparam>
+/// <param name="hashtable">[IN/OUT] An empty hashtable.</param>
+/// <param name="uNumberOfElements">[IN] The number of elements to add.</param>
+/// <param name="szHashtableName">[IN] The name of the hashtable, to be shown in the log.</param>
+template<class HashtableT>
+static void QFlatHashtable_PerformanceTest_Measure(HashtableT &hashtable, const pointer_uint_q uNumberOfElements, const char* szHashtableName)
+{
+    QStopwatch stopwatch;
+    pointer_uint_q* arPermutation = QFlatHashtable_PerformanceTest_GeneratePermutation(uNumberOfElements);
+
+    // Additions
+    stopwatch.Set();
+
+    for(pointer_uint_q i = 0; i < uNumberOfElements; ++i)
+        hashtable.Add(QFlatHashtable_PerformanceTest_GenerateKey(i), scast_q(i, u32_q));
+
+    const float_q ADD_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    // Successful lookups
+    u32_q uChecksum = 0;
+    stopwatch.Set();
+
+    for(pointer_uint_q i = 0; i < uNumberOfElements; ++i)
+        uChecksum += hashtable.GetValue(QFlatHashtable_PerformanceTest_GenerateKey(arPermutation[i]));
+
+    const float_q HIT_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    // Failed lookups
+    pointer_uint_q uFound = 0;
+    stopwatch.Set();
+
+    for(pointer_uint_q i = uNumberOfElements; i < uNumberOfElements * 2U; ++i)
+        uFound += hashtable.ContainsKey(QFlatHashtable_PerformanceTest_GenerateKey(i)) ? 1U : 0;
+
+    const float_q MISS_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    // Removals
+    stopwatch.Set();
+
+    for(pointer_uint_q i = 0; i < uNumberOfElements; ++i)
+        hashtable.Remove(QFlatHashtable_PerformanceTest_GenerateKey(arPermutation[i]));
+
+    const float_q REMOVE_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    delete[] arPermutation;
+
+    BOOST_TEST_MESSAGE(szHashtableName << " (" << uNumberOfElements << " elements): Add " << ADD_TIME << " ms, GetValue " << HIT_TIME <<
+                       " ms, ContainsKey (missing keys) " << MISS_TIME << " ms, Remove " << REMOVE_TIME << " ms [checksum " << uChecksum << "]");
+    BOOST_CHECK_EQUAL(uFound, 0U);
+    BOOST_CHECK(hashtable.IsEmpty());
+}
+
+
+QTEST_SUITE_BEGIN( QFlatHashtable_TestSuite )
+
+/// <summary>
+/// Measures the time spent by QHashtable and QFlatHashtable to add, search for and remove elements when the capacity was reserved beforehand.
+/// </summary>
+QTEST_CASE ( AddGetValueRemove_CompareToQHashtableWhenCapacityIsReserved_Test )
+{
+    for(pointer_uint_q uSize = 0; uSize < sizeof(QFLATHASHTABLE_PERFORMANCETEST_SIZES) / sizeof(pointer_uint_q); ++uSize)
+    {
+        const pointer_uint_q NUMBER_OF_ELEMENTS = QFLATHASHTABLE_PERFORMANCETEST_SIZES[uSize];
+
+        {
+            QHashtable<u32_q, u32_q> hashtable(NUMBER_OF_ELEMENTS, 1U);
+            QFlatHashtable_PerformanceTest_Measure(hashtable, NUMBER_OF_ELEMENTS, "QHashtable");
+        }
+
+        {
+            QFlatHashtable<u32_q, u32_q> hashtable(NUMBER_OF_ELEMENTS);
+            QFlatHashtable_PerformanceTest_Measure(hashtable, NUMBER_OF_ELEMENTS, "QFlatHashtable");
+        }
+    }
+}
+
+/// <summary>
+/// Measures the time spent by QHashtable and QFlatHashtable to add, search for and remove elements when they have to grow while adding.
+/// </summary>
+QTEST_CASE ( AddGetValueRemove_CompareToQHashtableWhenHashtablesGrow_Test )
+{
+    for(pointer_uint_q uSize = 0; uSize < sizeof(QFLATHASHTABLE_PERFORMANCETEST_SIZES) / sizeof(pointer_uint_q); ++uSize)
+    {
+        const pointer_uint_q NUMBER_OF_ELEMENTS = QFLATHASHTABLE_PERFORMANCETEST_SIZES[uSize];
+
+        {
+            QHashtable<u32_q, u32_q> hashtable(16U, 1U);
+            QFlatHashtable_PerformanceTest_Measure(hashtable, NUMBER_OF_ELEMENTS, "QHashtable");
+        }
+
+        {
+            QFlatHashtable<u32_q, u32_q> hashtable(16U);
+            QFlatHashtable_PerformanceTest_Measure(hashtable, NUMBER_OF_ELEMENTS, "QFlatHashtable");
+        }
+    }
+}
+
+// End - Test Suite: QFlatHashtable
+QTEST_SUITE_END()
@@ -0,0 +1,104 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QList.h"
+#include "QStopwatch.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QList;
+using Kinesis::QuimeraEngine::System::Timing::QStopwatch;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+/// <summary>
+/// The number of elements stored in the list used in every performance test.
+/// </summary>
+static const pointer_uint_q QLISTCOMPACT_PERFORMANCETEST_NUMBER_OF_ELEMENTS = 1000000U;
+
+/// <summary>
+/// The number of times the list is traversed in every performance test.
+/// </summary>
+static const pointer_uint_q QLISTCOMPACT_PERFORMANCETEST_NUMBER_OF_PASSES = 20U;
+
+
+QTEST_SUITE_BEGIN( QListCompact_TestSuite )
+
+/// <summary>
+/// Compares the time spent when traversing a list of 1M elements whose traversal order differs from their order in memory, 
+/// before and after compacting it.
+/// </summary>
+QTEST_CASE ( Traversal_FragmentedVersusCompacted_Test )
+{
+    const pointer_uint_q NUMBER_OF_ELEMENTS = QLISTCOMPACT_PERFORMANCETEST_NUMBER_OF_ELEMENTS;
+    const pointer_uint_q NUMBER_OF_PASSES = QLISTCOMPACT_PERFORMANCETEST_NUMBER_OF_PASSES;
+    QStopwatch stopwatch;
+
+    // Sorting pseudo-random values only changes the links, so consecutive elements end up far from each other in memory
+    QList<u32_q> list(NUMBER_OF_ELEMENTS);
+    u32_q uSeed = 12345U;
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        uSeed = uSeed * 1664525U + 1013904223U;
+        list.Add(uSeed);
+    }
+
+    list.Sort();
+
+    u32_q uFragmentedSum = 0;
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < NUMBER_OF_PASSES; ++i)
+    {
+        for(QList<u32_q>::QConstListIterator it = list.GetFirst(); !it.IsEnd(); ++it)
+            uFragmentedSum += *it;
+    }
+    const float_q FRAGMENTED_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    stopwatch.Set();
+    list.Compact();
+    const float_q COMPACT_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    u32_q uCompactedSum = 0;
+    stopwatch.Set();
+    for(pointer_uint_q i = 0; i < NUMBER_OF_PASSES; ++i)
+    {
+        for(QList<u32_q>::QConstListIterator it = list.GetFirst(); !it.IsEnd(); ++it)
+            uCompactedSum += *it;
+    }
+    const float_q COMPACTED_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    BOOST_CHECK_EQUAL(uFragmentedSum, uCompactedSum);
+    BOOST_TEST_MESSAGE("List traversal (" << NUMBER_OF_PASSES << " passes over " << NUMBER_OF_ELEMENTS << " elements): fragmented " << 
+                       FRAGMENTED_TIME << " ms; compacted " << COMPACTED_TIME << " ms; Compact() took " << COMPACT_TIME << " ms");
+}
+
+// End - Test Suite: QListCompact
+QTEST_SUITE_END()
@@ -0,0 +1,187 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QPriorityQueue.h"
+#include "QBinarySearchTree.h"
+#include "QStopwatch.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QPriorityQueue;
+using Kinesis::QuimeraEngine::Tools::Containers::QBinarySearchTree;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+using Kinesis::QuimeraEngine::Tools::Containers::SQComparatorDefault;
+using Kinesis::QuimeraEngine::Tools::Containers::EQTreeTraversalOrder;
+using Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator;
+using Kinesis::QuimeraEngine::System::Timing::QStopwatch;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+/// <summary>
+/// The number of elements added to every container.
+/// </summary>
+static const u32_q QPRIORITYQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS = 500000U;
+
+/// <summary>
+/// Fills an array with pseudo-random numbers, all of them different.
+/// </summary>
+/// <param name="arElements">[OUT] The array to fill.</param>
+static void QPriorityQueue_PerformanceTest_GenerateElements(QArrayDynamic<u32_q> &arElements)
+{
+    u32_q uRandom = 12345U;
+
+    // The generator has full period, so the numbers do not repeat
+    for(u32_q i = 0; i < QPRIORITYQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS; ++i)
+    {
+        uRandom = uRandom * 1664525U + 1013904223U;
+        arElements.Add(uRandom);
+    }
+}
+
+/// <summary>
+/// Adds all the elements of an array to a priority queue and then extracts them, measuring the time it takes.
+/// </summary>
+/// <typeparam name="QueueT">The type of the priority queue.</typeparam>
+/// <param name="arElements">[IN] The elements to add.</param>
+/// <param name="fPushTime">[OUT] The time spent adding the elements, in milliseconds.</param>
+/// <param name="fPopTime">[OUT] The time spent extracting the elements, in milliseconds.</param>
+template<class QueueT>
+static void QPriorityQueue_PerformanceTest_PushAndPop(const QArrayDynamic<u32_q> &arElements, float_q &fPushTime, float_q &fPopTime)
+{
+    QStopwatch stopwatch;
+    QueueT queue;
+    u32_q uChecksum = 0;
+
+    stopwatch.Set();
+    for(u32_q i = 0; i < QPRIORITYQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS; ++i)
+        queue.Push(arElements[i]);
+    fPushTime = stopwatch.GetElapsedTimeAsFloat();
+
+    stopwatch.Set();
+    while(!queue.IsEmpty())
+    {
+        uChecksum += queue.GetTop();
+        queue.Pop();
+    }
+    fPopTime = stopwatch.GetElapsedTimeAsFloat();
+
+    BOOST_CHECK(uChecksum != 0);
+}
+
+
+QTEST_SUITE_BEGIN( QPriorityQueue_TestSuite )
+
+/// <summary>
+/// Compares the time it takes to add many elements and then extract them in order using a binary search tree, a binary heap and a 4-ary heap.
+/// </summary>
+QTEST_CASE ( PushPop_BinarySearchTreeVersusBinaryHeapVersusQuaternaryHeap_Test )
+{
+    QStopwatch stopwatch;
+    QArrayDynamic<u32_q> arElements(QPRIORITYQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS);
+    QPriorityQueue_PerformanceTest_GenerateElements(arElements);
+
+    // Binary search tree
+    QBinarySearchTree<u32_q> tree;
+    u32_q uTreeChecksum = 0;
+
+    stopwatch.Set();
+    for(u32_q i = 0; i < QPRIORITYQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS; ++i)
+        tree.Add(arElements[i], EQTreeTraversalOrder::E_DepthFirstInOrder);
+    const float_q TREE_PUSH_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    stopwatch.Set();
+    while(!tree.IsEmpty())
+    {
+        QBinarySearchTree<u32_q>::QConstBinarySearchTreeIterator itLowest = tree.GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
+        uTreeChecksum += *itLowest;
+        tree.Remove(itLowest);
+    }
+    const float_q TREE_POP_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    BOOST_CHECK(uTreeChecksum != 0);
+
+    // Heaps
+    float_q fBinaryPushTime = 0;
+    float_q fBinaryPopTime = 0;
+    QPriorityQueue_PerformanceTest_PushAndPop< QPriorityQueue<u32_q> >(arElements, fBinaryPushTime, fBinaryPopTime);
+
+    float_q fQuaternaryPushTime = 0;
+    float_q fQuaternaryPopTime = 0;
+    QPriorityQueue_PerformanceTest_PushAndPop< QPriorityQueue<u32_q, QPoolAllocator, SQComparatorDefault<u32_q>, 4U> >(arElements, fQuaternaryPushTime, fQuaternaryPopTime);
+
+    BOOST_TEST_MESSAGE("Push/Pop (" << QPRIORITYQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS << " elements): QBinarySearchTree " << TREE_PUSH_TIME << " / " << TREE_POP_TIME << 
+                       " ms; QPriorityQueue (binary) " << fBinaryPushTime << " / " << fBinaryPopTime << 
+                       " ms; QPriorityQueue (4-ary) " << fQuaternaryPushTime << " / " << fQuaternaryPopTime << " ms");
+}
+
+/// <summary>
+/// Compares the time it takes to build a priority queue adding the elements one by one and heapifying all of them at once, both when elements are 
+/// in random order and when they are in descending order, which is the worst case for adding them one by one.
+/// </summary>
+QTEST_CASE ( Heapify_PushingOneByOneVersusHeapify_Test )
+{
+    typedef QPriorityQueue<u32_q, QPoolAllocator, SQComparatorDefault<u32_q>, 4U> QuaternaryQueue;
+
+    QStopwatch stopwatch;
+    QArrayDynamic<u32_q> arRandomElements(QPRIORITYQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS);
+    QPriorityQueue_PerformanceTest_GenerateElements(arRandomElements);
+
+    QArrayDynamic<u32_q> arDescendingElements(QPRIORITYQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS);
+
+    for(u32_q i = 0; i < QPRIORITYQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS; ++i)
+        arDescendingElements.Add(QPRIORITYQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS - i);
+
+    const QArrayDynamic<u32_q>* arInputs[] = { &arRandomElements, &arDescendingElements };
+    const char* arInputNames[] = { "random", "descending" };
+
+    for(u32_q uInput = 0; uInput < 2U; ++uInput)
+    {
+        const QArrayDynamic<u32_q>& arElements = *arInputs[uInput];
+        QuaternaryQueue pushedQueue(QPRIORITYQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS);
+        QuaternaryQueue heapifiedQueue(QPRIORITYQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS);
+
+        stopwatch.Set();
+        for(u32_q i = 0; i < QPRIORITYQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS; ++i)
+            pushedQueue.Push(arElements[i]);
+        const float_q PUSH_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+        stopwatch.Set();
+        heapifiedQueue.Heapify(arElements);
+        const float_q HEAPIFY_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+        BOOST_TEST_MESSAGE("Building a 4-ary heap (" << QPRIORITYQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS << " elements, " << arInputNames[uInput] << " order): Push one by one " << 
+                           PUSH_TIME << " ms; Heapify " << HEAPIFY_TIME << " ms");
+
+        BOOST_CHECK_EQUAL(pushedQueue.GetTop(), heapifiedQueue.GetTop());
+    }
+}
+
+// End - Test Suite: QPriorityQueue
+QTEST_SUITE_END()
@@ -0,0 +1,172 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QSPSCQueue.h"
+#include "QMPMCQueue.h"
+#include "QList.h"
+#include "QMutex.h"
+#include "QScopedExclusiveLock.h"
+#include "QConditionVariable.h"
+#include "QThread.h"
+#include "QDelegate.h"
+#include "QStopwatch.h"
+
+using Kinesis::QuimeraEngine::System::Threading::QSPSCQueue;
+using Kinesis::QuimeraEngine::System::Threading::QMPMCQueue;
+using Kinesis::QuimeraEngine::System::Threading::QMutex;
+using Kinesis::QuimeraEngine::System::Threading::QScopedExclusiveLock;
+using Kinesis::QuimeraEngine::System::Threading::QConditionVariable;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::Tools::Containers::QList;
+using Kinesis::QuimeraEngine::System::Timing::QStopwatch;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+
+/// <summary>
+/// The number of elements passed from the producer to the consumer.
+/// </summary>
+static const u32_q QSPSCQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS = 2000000U;
+
+/// <summary>
+/// The maximum number of elements in every queue.
+/// </summary>
+static const pointer_uint_q QSPSCQUEUE_PERFORMANCETEST_CAPACITY = 1024U;
+
+/// <summary>
+/// A list protected by a mutex, with two condition variables to wait while it is full or empty, which is how work is passed between threads without a queue.
+/// </summary>
+struct QSPSCQueue_PerformanceTest_LockedList
+{
+    QSPSCQueue_PerformanceTest_LockedList() : m_list(QSPSCQUEUE_PERFORMANCETEST_CAPACITY)
+    {
+    }
+
+    void Push(const u32_q uValue)
+    {
+        QScopedExclusiveLock<QMutex> lock(m_mutex);
+
+        while(m_list.GetCount() == QSPSCQUEUE_PERFORMANCETEST_CAPACITY)
+            m_notFullCondition.Wait(lock);
+
+        m_list.Add(uValue);
+        m_notEmptyCondition.NotifyOne();
+    }
+
+    void Pop(u32_q &uValue)
+    {
+        QScopedExclusiveLock<QMutex> lock(m_mutex);
+
+        while(m_list.IsEmpty())
+            m_notEmptyCondition.Wait(lock);
+
+        uValue = m_list[0];
+        m_list.Remove(0);
+        m_notFullCondition.NotifyOne();
+    }
+
+    QList<u32_q> m_list;
+    QMutex m_mutex;
+    QConditionVariable m_notFullCondition;
+    QConditionVariable m_notEmptyCondition;
+};
+
+/// <summary>
+/// Adds consecutive numbers to a queue, waiting when it is full.
+/// </summary>
+/// <typeparam name="QueueT">The type of the queue.</typeparam>
+/// <param name="pQueue">[IN/OUT] The queue.</param>
+/// <param name="uCount">[IN] The amount of numbers to add.</param>
+template<class QueueT>
+static void QSPSCQueue_PerformanceTest_PushNumbers(QueueT* pQueue, const u32_q uCount)
+{
+    for(u32_q i = 0; i < uCount; ++i)
+        pQueue->Push(i);
+}
+
+/// <summary>
+/// Passes numbers from a producer thread to the calling thread through a queue and measures the time it takes.
+/// </summary>
+/// <typeparam name="QueueT">The type of the queue.</typeparam>
+/// <param name="queue">[IN/OUT] The queue.</param>
+/// <returns>
+/// The elapsed time, in milliseconds.
+/// </returns>
+template<class QueueT>
+static float_q QSPSCQueue_PerformanceTest_TransferNumbers(QueueT &queue)
+{
+    QStopwatch stopwatch;
+    stopwatch.Set();
+
+    QThread producer(QDelegate<void (QueueT*, const u32_q)>(&QSPSCQueue_PerformanceTest_PushNumbers<QueueT>), &queue, QSPSCQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS);
+
+    u64_q uSum = 0;
+
+    for(u32_q i = 0; i < QSPSCQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS; ++i)
+    {
+        u32_q uValue = 0;
+        queue.Pop(uValue);
+        uSum += uValue;
+    }
+
+    producer.Join();
+
+    const float_q ELAPSED_TIME = stopwatch.GetElapsedTimeAsFloat();
+    BOOST_CHECK_EQUAL(uSum, scast_q(QSPSCQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS, u64_q) * (QSPSCQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS - 1U) / 2U);
+
+    return ELAPSED_TIME;
+}
+
+
+QTEST_SUITE_BEGIN( QSPSCQueue_TestSuite )
+
+/// <summary>
+/// Compares the time it takes to pass elements from one thread to another through a list protected by a mutex, a single-producer single-consumer queue and 
+/// a multiple-producer multiple-consumer queue.
+/// </summary>
+QTEST_CASE ( Push_Pop_LockedListVersusLockFreeQueues_Test )
+{
+    QSPSCQueue_PerformanceTest_LockedList lockedList;
+    QSPSCQueue<u32_q> spscQueue(QSPSCQUEUE_PERFORMANCETEST_CAPACITY);
+    QMPMCQueue<u32_q> mpmcQueue(QSPSCQUEUE_PERFORMANCETEST_CAPACITY);
+
+    const float_q LOCKED_TIME = QSPSCQueue_PerformanceTest_TransferNumbers(lockedList);
+    const float_q SPSC_TIME = QSPSCQueue_PerformanceTest_TransferNumbers(spscQueue);
+    const float_q MPMC_TIME = QSPSCQueue_PerformanceTest_TransferNumbers(mpmcQueue);
+
+    BOOST_TEST_MESSAGE("Producer to consumer (" << QSPSCQUEUE_PERFORMANCETEST_NUMBER_OF_ELEMENTS << " elements, capacity " << QSPSCQUEUE_PERFORMANCETEST_CAPACITY << 
+                       "): QList + QMutex + QConditionVariable " << LOCKED_TIME << " ms; QSPSCQueue " << SPSC_TIME << " ms; QMPMCQueue " << MPMC_TIME << " ms");
+}
+
+// End - Test Suite: QSPSCQueue
+QTEST_SUITE_END()
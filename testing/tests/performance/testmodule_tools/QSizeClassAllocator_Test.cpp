@@ -0,0 +1,385 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QSizeClassAllocator.h"
+#include "QThread.h"
+#include "QDelegate.h"
+#include "QStopwatch.h"
+
+#if defined(QE_OS_LINUX) && defined(QE_COMPILER_GCC)
+    #include <malloc.h> // mallinfo
+#endif
+
+using Kinesis::QuimeraEngine::Common::Memory::QSizeClassAllocator;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::System::Timing::QStopwatch;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+/// <summary>
+/// The number of operations (allocations or deallocations) of every trace.
+/// </summary>
+static const u32_q QSIZECLASSALLOCATOR_PERFORMANCETEST_OPERATIONS = 2000000U;
+
+/// <summary>
+/// The maximum number of blocks alive at the same time.
+/// </summary>
+static const u32_q QSIZECLASSALLOCATOR_PERFORMANCETEST_SLOTS = 16384U;
+
+/// <summary>
+/// The seed of the pseudo-random number generator, so every execution uses the same traces.
+/// </summary>
+static const u32_q QSIZECLASSALLOCATOR_PERFORMANCETEST_SEED = 0x5EED1234U;
+
+/// <summary>
+/// The number of operations (allocations or deallocations) executed by every thread when several threads use the allocator at the same time.
+/// </summary>
+static const u32_q QSIZECLASSALLOCATOR_PERFORMANCETEST_OPERATIONS_PER_THREAD = 500000U;
+
+/// <summary>
+/// The numbers of threads used to measure the throughput when several threads use the allocator at the same time.
+/// </summary>
+static const u32_q QSIZECLASSALLOCATOR_PERFORMANCETEST_THREADS[] = { 1U, 2U, 4U, 8U };
+
+/// <summary>
+/// An allocation trace: a sequence of operations over a set of slots. Every operation allocates a block in the slot if it is empty or 
+/// deallocates it otherwise.
+/// </summary>
+/// <remarks>
+/// Traces are generated synthetically, imitating the sizes and lifetimes usually found in the engine: many small objects (strings, list nodes, 
+/// delegates), some medium buffers (arrays, hashtables) and a few big buffers.
+/// </remarks>
+struct QSizeClassAllocator_PerformanceTest_Trace
+{
+    QSizeClassAllocator_PerformanceTest_Trace(const u32_q uOperations, const bool bPhased) : m_arSlots(new u32_q[uOperations]),
+                                                                                            m_arSizes(new u32_q[uOperations]),
+                                                                                            m_uOperations(uOperations)
+    {
+        u32_q uRandom = QSIZECLASSALLOCATOR_PERFORMANCETEST_SEED;
+
+        for(u32_q i = 0; i < uOperations; ++i)
+        {
+            uRandom = uRandom * 1664525U + 1013904223U;
+            const u32_q SIZE_TYPE = (uRandom >> 8U) % 100U;
+            uRandom = uRandom * 1664525U + 1013904223U;
+            const u32_q SIZE_VALUE = uRandom >> 8U;
+
+            if(SIZE_TYPE < 70U)
+                m_arSizes[i] = 8U + SIZE_VALUE % 121U;      // [8, 128]
+            else if(SIZE_TYPE < 95U)
+                m_arSizes[i] = 129U + SIZE_VALUE % 3968U;   // [129, 4096]
+            else if(SIZE_TYPE < 99U)
+                m_arSizes[i] = 4097U + SIZE_VALUE % 28672U; // [4097, 32768]
+            else
+                m_arSizes[i] = 32769U + SIZE_VALUE % 98304U; // [32769, 131072]
+
+            uRandom = uRandom * 1664525U + 1013904223U;
+
+            // Phased traces allocate in the first half of the slots and free the second half alternately, so the set of alive blocks changes
+            // completely every phase
+            if(bPhased)
+            {
+                const u32_q PHASE = (i / (uOperations / 8U)) % 2U;
+                m_arSlots[i] = ((uRandom >> 8U) % (QSIZECLASSALLOCATOR_PERFORMANCETEST_SLOTS / 2U)) + PHASE * (QSIZECLASSALLOCATOR_PERFORMANCETEST_SLOTS / 2U);
+            }
+            else
+            {
+                m_arSlots[i] = (uRandom >> 8U) % QSIZECLASSALLOCATOR_PERFORMANCETEST_SLOTS;
+            }
+        }
+    }
+
+    ~QSizeClassAllocator_PerformanceTest_Trace()
+    {
+        delete[] m_arSlots;
+        delete[] m_arSizes;
+    }
+
+    u32_q* m_arSlots;
+    u32_q* m_arSizes;
+    u32_q m_uOperations;
+};
+
+/// <summary>
+/// The system allocator, malloc and free, with the same interface as QSizeClassAllocator.
+/// </summary>
+struct QSizeClassAllocator_PerformanceTest_SystemAllocator
+{
+    void* Allocate(const pointer_uint_q uSize)
+    {
+        return malloc(uSize);
+    }
+
+    void Deallocate(const void* pBlock)
+    {
+        free(ccast_q(pBlock, void*));
+    }
+};
+
+/// <summary>
+/// Gets the amount of memory the system allocator has obtained from the operating system.
+/// </summary>
+/// <returns>
+/// The number of bytes, or zero if it cannot be known in the current platform.
+/// </returns>
+static pointer_uint_q QSizeClassAllocator_PerformanceTest_GetSystemReservedBytes()
+{
+#if defined(QE_OS_LINUX) && defined(QE_COMPILER_GCC)
+    const struct mallinfo INFO = mallinfo();
+    return scast_q(scast_q(INFO.arena, unsigned int), pointer_uint_q) + scast_q(scast_q(INFO.hblkhd, unsigned int), pointer_uint_q);
+#else
+    return 0;
+#endif
+}
+
+/// <summary>
+/// Executes a trace and measures the time it takes. The blocks still alive at the end are not deallocated.
+/// </summary>
+/// <typeparam name="AllocatorT">The type of the allocator.</typeparam>
+/// <param name="allocator">[IN/OUT] The allocator.</param>
+/// <param name="trace">[IN] The trace to execute.</param>
+/// <param name="arBlocks">[IN/OUT] The slots, which must be all null at the beginning.</param>
+/// <param name="uPeakRequestedBytes">[OUT] The maximum amount of bytes requested by the blocks alive at the same time.</param>
+/// <returns>
+/// The elapsed time, in milliseconds.
+/// </returns>
+template<class AllocatorT>
+static float_q QSizeClassAllocator_PerformanceTest_Run(AllocatorT &allocator, 
+                                                       const QSizeClassAllocator_PerformanceTest_Trace &trace, 
+                                                       void** arBlocks, 
+                                                       pointer_uint_q &uPeakRequestedBytes)
+{
+    u32_q* arRequestedSizes = new u32_q[QSIZECLASSALLOCATOR_PERFORMANCETEST_SLOTS];
+    pointer_uint_q uRequestedBytes = 0;
+    uPeakRequestedBytes = 0;
+
+    QStopwatch stopwatch;
+    stopwatch.Set();
+
+    for(u32_q i = 0; i < trace.m_uOperations; ++i)
+    {
+        const u32_q SLOT = trace.m_arSlots[i];
+
+        if(null_q == arBlocks[SLOT])
+        {
+            arBlocks[SLOT] = allocator.Allocate(trace.m_arSizes[i]);
+            arRequestedSizes[SLOT] = trace.m_arSizes[i];
+            uRequestedBytes += trace.m_arSizes[i];
+            uPeakRequestedBytes = uRequestedBytes > uPeakRequestedBytes ? uRequestedBytes : uPeakRequestedBytes;
+        }
+        else
+        {
+            allocator.Deallocate(arBlocks[SLOT]);
+            arBlocks[SLOT] = null_q;
+            uRequestedBytes -= arRequestedSizes[SLOT];
+        }
+    }
+
+    const float_q ELAPSED_TIME = stopwatch.GetElapsedTimeAsFloat();
+    delete[] arRequestedSizes;
+
+    return ELAPSED_TIME;
+}
+
+/// <summary>
+/// Deallocates all the blocks that are still alive.
+/// </summary>
+/// <typeparam name="AllocatorT">The type of the allocator.</typeparam>
+/// <param name="allocator">[IN/OUT] The allocator.</param>
+/// <param name="arBlocks">[IN/OUT] The slots.</param>
+template<class AllocatorT>
+static void QSizeClassAllocator_PerformanceTest_DeallocateAll(AllocatorT &allocator, void** arBlocks)
+{
+    for(u32_q i = 0; i < QSIZECLASSALLOCATOR_PERFORMANCETEST_SLOTS; ++i)
+    {
+        allocator.Deallocate(arBlocks[i]);
+        arBlocks[i] = null_q;
+    }
+}
+
+/// <summary>
+/// Executes a trace and deallocates all the blocks that are still alive at the end. It is the function executed by every thread when several 
+/// threads use the allocator at the same time.
+/// </summary>
+/// <typeparam name="AllocatorT">The type of the allocator.</typeparam>
+/// <param name="pAllocator">[IN/OUT] The allocator.</param>
+/// <param name="pTrace">[IN] The trace to execute.</param>
+template<class AllocatorT>
+static void QSizeClassAllocator_PerformanceTest_RunAndDeallocateAll(AllocatorT* pAllocator, const QSizeClassAllocator_PerformanceTest_Trace* pTrace)
+{
+    void** arBlocks = new void*[QSIZECLASSALLOCATOR_PERFORMANCETEST_SLOTS];
+    memset(arBlocks, 0, QSIZECLASSALLOCATOR_PERFORMANCETEST_SLOTS * sizeof(void*));
+
+    pointer_uint_q uPeakRequestedBytes = 0;
+    QSizeClassAllocator_PerformanceTest_Run(*pAllocator, *pTrace, arBlocks, uPeakRequestedBytes);
+    QSizeClassAllocator_PerformanceTest_DeallocateAll(*pAllocator, arBlocks);
+
+    delete[] arBlocks;
+}
+
+/// <summary>
+/// Runs several threads that execute the same trace at the same time, each one with its own blocks, and measures the time it takes.
+/// </summary>
+/// <typeparam name="AllocatorT">The type of the allocator.</typeparam>
+/// <param name="allocator">[IN/OUT] The allocator.</param>
+/// <param name="trace">[IN] The trace to execute.</param>
+/// <param name="uNumberOfThreads">[IN] The number of threads.</param>
+/// <returns>
+/// The elapsed time, in milliseconds.
+/// </returns>
+template<class AllocatorT>
+static float_q QSizeClassAllocator_PerformanceTest_RunThreads(AllocatorT &allocator, 
+                                                              const QSizeClassAllocator_PerformanceTest_Trace &trace, 
+                                                              const u32_q uNumberOfThreads)
+{
+    QDelegate<void (AllocatorT*, const QSizeClassAllocator_PerformanceTest_Trace*)> function(&QSizeClassAllocator_PerformanceTest_RunAndDeallocateAll<AllocatorT>);
+    QThread** arThreads = new QThread*[uNumberOfThreads];
+
+    QStopwatch stopwatch;
+    stopwatch.Set();
+
+    for(u32_q i = 0; i < uNumberOfThreads; ++i)
+        arThreads[i] = new QThread(function, &allocator, &trace);
+
+    for(u32_q i = 0; i < uNumberOfThreads; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    const float_q ELAPSED_TIME = stopwatch.GetElapsedTimeAsFloat();
+    delete[] arThreads;
+
+    return ELAPSED_TIME;
+}
+
+/// <summary>
+/// Executes a trace with both malloc and QSizeClassAllocator and writes their throughput and memory usage.
+/// </summary>
+/// <param name="trace">[IN] The trace to execute.</param>
+/// <param name="szTraceName">[IN] The name of the trace, for the output.</param>
+static void QSizeClassAllocator_PerformanceTest_Compare(const QSizeClassAllocator_PerformanceTest_Trace &trace, const char* szTraceName)
+{
+    void** arBlocks = new void*[QSIZECLASSALLOCATOR_PERFORMANCETEST_SLOTS];
+    memset(arBlocks, 0, QSIZECLASSALLOCATOR_PERFORMANCETEST_SLOTS * sizeof(void*));
+
+    const float_q TOTAL_OPERATIONS = scast_q(trace.m_uOperations, float_q);
+
+    // System allocator
+    QSizeClassAllocator_PerformanceTest_SystemAllocator systemAllocator;
+    pointer_uint_q uSystemPeakRequestedBytes = 0;
+    const pointer_uint_q SYSTEM_RESERVED_BYTES_BEFORE = QSizeClassAllocator_PerformanceTest_GetSystemReservedBytes();
+    const float_q SYSTEM_TIME = QSizeClassAllocator_PerformanceTest_Run(systemAllocator, trace, arBlocks, uSystemPeakRequestedBytes);
+    const pointer_uint_q SYSTEM_RESERVED_BYTES = QSizeClassAllocator_PerformanceTest_GetSystemReservedBytes() - SYSTEM_RESERVED_BYTES_BEFORE;
+    QSizeClassAllocator_PerformanceTest_DeallocateAll(systemAllocator, arBlocks);
+
+    // Size-class allocator
+    QSizeClassAllocator sizeClassAllocator;
+    pointer_uint_q uPeakRequestedBytes = 0;
+    const float_q SIZECLASS_TIME = QSizeClassAllocator_PerformanceTest_Run(sizeClassAllocator, trace, arBlocks, uPeakRequestedBytes);
+    const pointer_uint_q SIZECLASS_RESERVED_BYTES = sizeClassAllocator.GetReservedBytes();
+    const pointer_uint_q SIZECLASS_ALLOCATED_BYTES = sizeClassAllocator.GetAllocatedBytes();
+    QSizeClassAllocator_PerformanceTest_DeallocateAll(sizeClassAllocator, arBlocks);
+
+    BOOST_TEST_MESSAGE("Throughput (" << szTraceName << " trace, " << trace.m_uOperations << " operations): malloc " << 
+                       SYSTEM_TIME << " ms (" << TOTAL_OPERATIONS / SYSTEM_TIME << " ops/ms); QSizeClassAllocator " << 
+                       SIZECLASS_TIME << " ms (" << TOTAL_OPERATIONS / SIZECLASS_TIME << " ops/ms)");
+
+    // Blocks bigger than the maximum block size are not included in the slabs, so the fragmentation refers to the slabs only
+    BOOST_TEST_MESSAGE("Memory (" << szTraceName << " trace): peak requested " << uPeakRequestedBytes << " bytes; malloc heap growth " << 
+                       SYSTEM_RESERVED_BYTES << " bytes; QSizeClassAllocator slabs " << SIZECLASS_RESERVED_BYTES << " bytes, with " << 
+                       SIZECLASS_ALLOCATED_BYTES << " bytes in use at the end (" << 
+                       100.0 - scast_q(SIZECLASS_ALLOCATED_BYTES, double) * 100.0 / scast_q(SIZECLASS_RESERVED_BYTES, double) << "% of the slabs unused)");
+
+    sizeClassAllocator.ReleaseEmptySlabs();
+    BOOST_CHECK_EQUAL(sizeClassAllocator.GetAllocatedBytes(), 0U);
+    BOOST_CHECK_EQUAL(sizeClassAllocator.GetSlabsCount(), 0U);
+
+    delete[] arBlocks;
+}
+
+
+QTEST_SUITE_BEGIN( QSizeClassAllocator_TestSuite )
+
+/// <summary>
+/// Compares the throughput and memory usage of malloc and the size-class allocator when blocks are allocated and deallocated randomly.
+/// </summary>
+QTEST_CASE ( Throughput_MallocVersusSizeClassAllocatorWithSteadyTrace_Test )
+{
+    const QSizeClassAllocator_PerformanceTest_Trace TRACE(QSIZECLASSALLOCATOR_PERFORMANCETEST_OPERATIONS, false);
+
+    QSizeClassAllocator_PerformanceTest_Compare(TRACE, "steady");
+}
+
+/// <summary>
+/// Compares the throughput and memory usage of malloc and the size-class allocator when the set of alive blocks changes completely from time to time.
+/// </summary>
+QTEST_CASE ( Throughput_MallocVersusSizeClassAllocatorWithPhasedTrace_Test )
+{
+    const QSizeClassAllocator_PerformanceTest_Trace TRACE(QSIZECLASSALLOCATOR_PERFORMANCETEST_OPERATIONS, true);
+
+    QSizeClassAllocator_PerformanceTest_Compare(TRACE, "phased");
+}
+
+/// <summary>
+/// Compares the throughput of malloc and the size-class allocator when several threads allocate and deallocate blocks at the same time.
+/// </summary>
+/// <remarks>
+/// All the threads execute the same trace, so they compete for the same size classes.
+/// </remarks>
+QTEST_CASE ( Throughput_MallocVersusSizeClassAllocatorWithSeveralThreads_Test )
+{
+    const QSizeClassAllocator_PerformanceTest_Trace TRACE(QSIZECLASSALLOCATOR_PERFORMANCETEST_OPERATIONS_PER_THREAD, false);
+
+    for(pointer_uint_q uThreads = 0; uThreads < sizeof(QSIZECLASSALLOCATOR_PERFORMANCETEST_THREADS) / sizeof(u32_q); ++uThreads)
+    {
+        const u32_q NUMBER_OF_THREADS = QSIZECLASSALLOCATOR_PERFORMANCETEST_THREADS[uThreads];
+
+        QSizeClassAllocator_PerformanceTest_SystemAllocator systemAllocator;
+        QSizeClassAllocator sizeClassAllocator;
+
+        const float_q SYSTEM_TIME = QSizeClassAllocator_PerformanceTest_RunThreads(systemAllocator, TRACE, NUMBER_OF_THREADS);
+        const float_q SIZECLASS_TIME = QSizeClassAllocator_PerformanceTest_RunThreads(sizeClassAllocator, TRACE, NUMBER_OF_THREADS);
+
+        const float_q TOTAL_OPERATIONS = scast_q(NUMBER_OF_THREADS * TRACE.m_uOperations, float_q);
+
+        BOOST_TEST_MESSAGE("Throughput (" << NUMBER_OF_THREADS << " threads, " << TRACE.m_uOperations << " operations per thread): malloc " << 
+                           SYSTEM_TIME << " ms (" << TOTAL_OPERATIONS / SYSTEM_TIME << " ops/ms); QSizeClassAllocator " << 
+                           SIZECLASS_TIME << " ms (" << TOTAL_OPERATIONS / SIZECLASS_TIME << " ops/ms)");
+
+        BOOST_CHECK_EQUAL(sizeClassAllocator.GetAllocatedBytes(), 0U);
+    }
+}
+
+// End - Test Suite: QSizeClassAllocator
+QTEST_SUITE_END()
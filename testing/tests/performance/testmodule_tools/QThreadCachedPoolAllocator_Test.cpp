@@ -0,0 +1,187 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QThreadCachedPoolAllocator.h"
+#include "QPoolAllocator.h"
+#include "QMutex.h"
+#include "QScopedExclusiveLock.h"
+#include "QThread.h"
+#include "QDelegate.h"
+#include "QStopwatch.h"
+
+using Kinesis::QuimeraEngine::System::Threading::QThreadCachedPoolAllocator;
+using Kinesis::QuimeraEngine::System::Threading::QMutex;
+using Kinesis::QuimeraEngine::System::Threading::QScopedExclusiveLock;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::System::Timing::QStopwatch;
+using Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+/// <summary>
+/// The number of blocks allocated and deallocated by every thread.
+/// </summary>
+static const u32_q QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_BLOCKS_PER_THREAD = 1000000U;
+
+/// <summary>
+/// The number of blocks every thread keeps allocated before deallocating them.
+/// </summary>
+static const u32_q QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_BURST_SIZE = 16U;
+
+/// <summary>
+/// The size of every block, in bytes.
+/// </summary>
+static const pointer_uint_q QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_BLOCK_SIZE = 64U;
+
+/// <summary>
+/// The numbers of threads used to measure the throughput.
+/// </summary>
+static const u32_q QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_THREADS[] = { 1U, 2U, 4U, 8U, 16U, 32U };
+
+/// <summary>
+/// A pool allocator protected by a mutex, which is how a pool is shared among threads without a thread cache.
+/// </summary>
+struct QThreadCachedPoolAllocator_PerformanceTest_LockedPool
+{
+    QThreadCachedPoolAllocator_PerformanceTest_LockedPool(const pointer_uint_q uSize) : m_pool(uSize, QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_BLOCK_SIZE, QAlignment(16U))
+    {
+    }
+
+    void* Allocate()
+    {
+        QScopedExclusiveLock<QMutex> lock(m_mutex);
+        return m_pool.Allocate();
+    }
+
+    void Deallocate(const void* pBlock)
+    {
+        QScopedExclusiveLock<QMutex> lock(m_mutex);
+        m_pool.Deallocate(pBlock);
+    }
+
+    QPoolAllocator m_pool;
+    QMutex m_mutex;
+};
+
+/// <summary>
+/// Allocates and deallocates blocks in bursts.
+/// </summary>
+/// <typeparam name="AllocatorT">The type of the allocator.</typeparam>
+/// <param name="pAllocator">[IN/OUT] The allocator.</param>
+template<class AllocatorT>
+static void QThreadCachedPoolAllocator_PerformanceTest_AllocateAndDeallocate(AllocatorT* pAllocator)
+{
+    void* arBlocks[QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_BURST_SIZE];
+
+    for(u32_q uBurst = 0; uBurst < QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_BLOCKS_PER_THREAD / QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_BURST_SIZE; ++uBurst)
+    {
+        for(u32_q i = 0; i < QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_BURST_SIZE; ++i)
+            arBlocks[i] = pAllocator->Allocate();
+
+        for(u32_q i = 0; i < QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_BURST_SIZE; ++i)
+            pAllocator->Deallocate(arBlocks[i]);
+    }
+}
+
+/// <summary>
+/// Runs several threads that allocate and deallocate blocks at the same time and measures the time it takes.
+/// </summary>
+/// <typeparam name="AllocatorT">The type of the allocator.</typeparam>
+/// <param name="allocator">[IN/OUT] The allocator.</param>
+/// <param name="uNumberOfThreads">[IN] The number of threads.</param>
+/// <returns>
+/// The elapsed time, in milliseconds.
+/// </returns>
+template<class AllocatorT>
+static float_q QThreadCachedPoolAllocator_PerformanceTest_Run(AllocatorT &allocator, const u32_q uNumberOfThreads)
+{
+    QDelegate<void (AllocatorT*)> function(&QThreadCachedPoolAllocator_PerformanceTest_AllocateAndDeallocate<AllocatorT>);
+    QThread** arThreads = new QThread*[uNumberOfThreads];
+
+    QStopwatch stopwatch;
+    stopwatch.Set();
+
+    for(u32_q i = 0; i < uNumberOfThreads; ++i)
+        arThreads[i] = new QThread(function, &allocator);
+
+    for(u32_q i = 0; i < uNumberOfThreads; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    const float_q ELAPSED_TIME = stopwatch.GetElapsedTimeAsFloat();
+    delete[] arThreads;
+
+    return ELAPSED_TIME;
+}
+
+
+QTEST_SUITE_BEGIN( QThreadCachedPoolAllocator_TestSuite )
+
+/// <summary>
+/// Compares the throughput of a pool allocator protected by a mutex and a thread-cached pool allocator, when several threads allocate and deallocate 
+/// blocks at the same time.
+/// </summary>
+QTEST_CASE ( Throughput_LockedPoolVersusThreadCachedPool_Test )
+{
+    const u32_q BLOCKS_PER_THREAD = QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_BLOCKS_PER_THREAD;
+
+    for(pointer_uint_q uThreads = 0; uThreads < sizeof(QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_THREADS) / sizeof(u32_q); ++uThreads)
+    {
+        const u32_q NUMBER_OF_THREADS = QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_THREADS[uThreads];
+
+        // Every thread may keep a whole burst plus a full cache
+        const pointer_uint_q POOL_SIZE = NUMBER_OF_THREADS * (QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_BURST_SIZE + QThreadCachedPoolAllocator::DEFAULT_CACHE_CAPACITY) * 
+                                         QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_BLOCK_SIZE;
+
+        QThreadCachedPoolAllocator_PerformanceTest_LockedPool lockedPool(POOL_SIZE);
+        QThreadCachedPoolAllocator cachedPool(POOL_SIZE, QTHREADCACHEDPOOLALLOCATOR_PERFORMANCETEST_BLOCK_SIZE, QAlignment(16U));
+
+        const float_q LOCKED_TIME = QThreadCachedPoolAllocator_PerformanceTest_Run(lockedPool, NUMBER_OF_THREADS);
+        const float_q CACHED_TIME = QThreadCachedPoolAllocator_PerformanceTest_Run(cachedPool, NUMBER_OF_THREADS);
+
+        const float_q TOTAL_OPERATIONS = scast_q(NUMBER_OF_THREADS * BLOCKS_PER_THREAD * 2U, float_q);
+
+        BOOST_TEST_MESSAGE("Pool throughput (" << NUMBER_OF_THREADS << " threads, " << BLOCKS_PER_THREAD << " allocations per thread): QPoolAllocator + QMutex " << 
+                           LOCKED_TIME << " ms (" << TOTAL_OPERATIONS / LOCKED_TIME << " ops/ms); QThreadCachedPoolAllocator " << 
+                           CACHED_TIME << " ms (" << TOTAL_OPERATIONS / CACHED_TIME << " ops/ms)");
+
+        cachedPool.ReleaseThreadCache();
+        BOOST_CHECK_EQUAL(cachedPool.GetAllocatedBytes(), 0U);
+    }
+}
+
+// End - Test Suite: QThreadCachedPoolAllocator
+QTEST_SUITE_END()
@@ -0,0 +1,267 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "AllocationOperators.h"
+#include "SQAllocationTracker.h"
+#include "QAllocationSnapshot.h"
+#include "QThread.h"
+#include "QDelegate.h"
+#include "QStopwatch.h"
+
+using Kinesis::QuimeraEngine::Common::Memory::SQAllocationTracker;
+using Kinesis::QuimeraEngine::Common::Memory::QAllocationSnapshot;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::System::Timing::QStopwatch;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+
+/// <summary>
+/// The number of blocks allocated and deallocated by every thread.
+/// </summary>
+static const u32_q SQALLOCATIONTRACKER_PERFORMANCETEST_BLOCKS_PER_THREAD = 1000000U;
+
+/// <summary>
+/// The number of blocks every thread keeps allocated before deallocating them.
+/// </summary>
+static const u32_q SQALLOCATIONTRACKER_PERFORMANCETEST_BURST_SIZE = 16U;
+
+/// <summary>
+/// The sizes of the blocks, in bytes, which are used in turns.
+/// </summary>
+static const pointer_uint_q SQALLOCATIONTRACKER_PERFORMANCETEST_BLOCK_SIZES[] = { 16U, 24U, 48U, 64U, 100U, 256U, 512U, 1024U };
+
+/// <summary>
+/// The numbers of threads used to measure the throughput.
+/// </summary>
+static const u32_q SQALLOCATIONTRACKER_PERFORMANCETEST_THREADS[] = { 1U, 2U, 4U, 8U };
+
+/// <summary>
+/// The number of threads that are started, one after another, to measure how finished threads affect the snapshots.
+/// </summary>
+static const u32_q SQALLOCATIONTRACKER_PERFORMANCETEST_SHORT_LIVED_THREADS = 256U;
+
+/// <summary>
+/// The number of snapshots taken to measure the time it takes to take one.
+/// </summary>
+static const u32_q SQALLOCATIONTRACKER_PERFORMANCETEST_SNAPSHOTS = 100000U;
+
+/// <summary>
+/// The functions used by the global operators when the allocation tracking is disabled.
+/// </summary>
+struct SQAllocationTracker_PerformanceTest_Untracked
+{
+    static void* Allocate(const pointer_uint_q uSize)
+    {
+        return backend_alloc_q(uSize);
+    }
+
+    static void Deallocate(void* pBlock)
+    {
+        backend_free_q(pBlock);
+    }
+};
+
+/// <summary>
+/// The functions used by the global operators when the allocation tracking is enabled.
+/// </summary>
+struct SQAllocationTracker_PerformanceTest_Tracked
+{
+    static void* Allocate(const pointer_uint_q uSize)
+    {
+        return tracked_alloc_q(uSize);
+    }
+
+    static void Deallocate(void* pBlock)
+    {
+        tracked_free_q(pBlock);
+    }
+};
+
+/// <summary>
+/// Allocates and deallocates blocks of several sizes in bursts, attributing them to a tag.
+/// </summary>
+/// <typeparam name="FunctionsT">The allocation and deallocation functions.</typeparam>
+/// <param name="uTag">[IN] The tag of the allocations.</param>
+template<class FunctionsT>
+static void SQAllocationTracker_PerformanceTest_AllocateAndDeallocate(const u32_q uTag)
+{
+    const pointer_uint_q SIZES_COUNT = sizeof(SQALLOCATIONTRACKER_PERFORMANCETEST_BLOCK_SIZES) / sizeof(pointer_uint_q);
+    void* arBlocks[SQALLOCATIONTRACKER_PERFORMANCETEST_BURST_SIZE];
+
+    SQAllocationTracker::SetCurrentTag(uTag);
+
+    for(u32_q uBurst = 0; uBurst < SQALLOCATIONTRACKER_PERFORMANCETEST_BLOCKS_PER_THREAD / SQALLOCATIONTRACKER_PERFORMANCETEST_BURST_SIZE; ++uBurst)
+    {
+        for(u32_q i = 0; i < SQALLOCATIONTRACKER_PERFORMANCETEST_BURST_SIZE; ++i)
+            arBlocks[i] = FunctionsT::Allocate(SQALLOCATIONTRACKER_PERFORMANCETEST_BLOCK_SIZES[(uBurst + i) % SIZES_COUNT]);
+
+        for(u32_q i = 0; i < SQALLOCATIONTRACKER_PERFORMANCETEST_BURST_SIZE; ++i)
+            FunctionsT::Deallocate(arBlocks[i]);
+    }
+
+    SQAllocationTracker::SetCurrentTag(SQAllocationTracker::UNTAGGED);
+}
+
+/// <summary>
+/// Allocates and deallocates one tracked block, attributing it to a tag.
+/// </summary>
+/// <param name="uTag">[IN] The tag of the allocation.</param>
+static void SQAllocationTracker_PerformanceTest_AllocateOnce(const u32_q uTag)
+{
+    SQAllocationTracker::SetCurrentTag(uTag);
+    tracked_free_q(tracked_alloc_q(64U));
+    SQAllocationTracker::SetCurrentTag(SQAllocationTracker::UNTAGGED);
+}
+
+/// <summary>
+/// Runs several threads that allocate and deallocate blocks at the same time and measures the time it takes.
+/// </summary>
+/// <typeparam name="FunctionsT">The allocation and deallocation functions.</typeparam>
+/// <param name="uNumberOfThreads">[IN] The number of threads.</param>
+/// <param name="arTags">[IN] The tag used by every thread.</param>
+/// <returns>
+/// The elapsed time, in milliseconds.
+/// </returns>
+template<class FunctionsT>
+static float_q SQAllocationTracker_PerformanceTest_Run(const u32_q uNumberOfThreads, const u32_q* arTags)
+{
+    QDelegate<void (const u32_q)> function(&SQAllocationTracker_PerformanceTest_AllocateAndDeallocate<FunctionsT>);
+    QThread** arThreads = new QThread*[uNumberOfThreads];
+
+    QStopwatch stopwatch;
+    stopwatch.Set();
+
+    for(u32_q i = 0; i < uNumberOfThreads; ++i)
+        arThreads[i] = new QThread(function, arTags[i]);
+
+    for(u32_q i = 0; i < uNumberOfThreads; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    const float_q ELAPSED_TIME = stopwatch.GetElapsedTimeAsFloat();
+    delete[] arThreads;
+
+    return ELAPSED_TIME;
+}
+
+/// <summary>
+/// Takes several snapshots and measures the time it takes.
+/// </summary>
+/// <returns>
+/// The elapsed time, in milliseconds.
+/// </returns>
+static float_q SQAllocationTracker_PerformanceTest_MeasureSnapshot()
+{
+    QStopwatch stopwatch;
+    stopwatch.Set();
+
+    for(u32_q i = 0; i < SQALLOCATIONTRACKER_PERFORMANCETEST_SNAPSHOTS; ++i)
+        SQAllocationTracker::TakeSnapshot();
+
+    return stopwatch.GetElapsedTimeAsFloat();
+}
+
+
+QTEST_SUITE_BEGIN( SQAllocationTracker_TestSuite )
+
+/// <summary>
+/// Compares the throughput of the allocation functions used by the global operators when the allocation tracking is disabled and enabled, 
+/// when several threads allocate and deallocate blocks at the same time. With tracking enabled, the threads use either a tag each or the same tag.
+/// </summary>
+QTEST_CASE ( Throughput_TrackingDisabledVersusEnabled_Test )
+{
+    const u32_q MAX_THREADS = 8U;
+    u32_q arOwnTags[MAX_THREADS];
+    u32_q arSharedTags[MAX_THREADS];
+
+    for(u32_q i = 0; i < MAX_THREADS; ++i)
+    {
+        // Every tag is registered at a different "line"
+        arOwnTags[i] = SQAllocationTracker::RegisterTag("SQAllocationTracker_PerformanceTest_Thread", __FILE__, scast_q(i, int));
+        arSharedTags[i] = SQAllocationTracker::UNTAGGED;
+    }
+
+    for(pointer_uint_q uThreads = 0; uThreads < sizeof(SQALLOCATIONTRACKER_PERFORMANCETEST_THREADS) / sizeof(u32_q); ++uThreads)
+    {
+        const u32_q NUMBER_OF_THREADS = SQALLOCATIONTRACKER_PERFORMANCETEST_THREADS[uThreads];
+
+        const float_q UNTRACKED_TIME = SQAllocationTracker_PerformanceTest_Run<SQAllocationTracker_PerformanceTest_Untracked>(NUMBER_OF_THREADS, arSharedTags);
+        const float_q OWN_TAGS_TIME = SQAllocationTracker_PerformanceTest_Run<SQAllocationTracker_PerformanceTest_Tracked>(NUMBER_OF_THREADS, arOwnTags);
+        const float_q SHARED_TAG_TIME = SQAllocationTracker_PerformanceTest_Run<SQAllocationTracker_PerformanceTest_Tracked>(NUMBER_OF_THREADS, arSharedTags);
+
+        const float_q TOTAL_OPERATIONS = scast_q(NUMBER_OF_THREADS * SQALLOCATIONTRACKER_PERFORMANCETEST_BLOCKS_PER_THREAD * 2U, float_q);
+
+        BOOST_TEST_MESSAGE("Allocation throughput (" << NUMBER_OF_THREADS << " threads, " << SQALLOCATIONTRACKER_PERFORMANCETEST_BLOCKS_PER_THREAD << " allocations per thread): " << 
+                           "tracking disabled " << UNTRACKED_TIME << " ms (" << TOTAL_OPERATIONS / UNTRACKED_TIME << " ops/ms); " << 
+                           "tracking enabled, a tag per thread " << OWN_TAGS_TIME << " ms (" << TOTAL_OPERATIONS / OWN_TAGS_TIME << " ops/ms, " << 
+                           OWN_TAGS_TIME / UNTRACKED_TIME << " times as long); " << 
+                           "tracking enabled, the same tag " << SHARED_TAG_TIME << " ms (" << TOTAL_OPERATIONS / SHARED_TAG_TIME << " ops/ms, " << 
+                           SHARED_TAG_TIME / UNTRACKED_TIME << " times as long)");
+
+        for(u32_q i = 0; i < NUMBER_OF_THREADS; ++i)
+            BOOST_CHECK_EQUAL(SQAllocationTracker::TakeSnapshot().GetLiveBytes(arOwnTags[i]), 0);
+    }
+}
+
+/// <summary>
+/// Measures the time it takes to take a snapshot before and after many threads have allocated and finished, one after another. The counters of 
+/// finished threads are reused, so the time should not grow.
+/// </summary>
+QTEST_CASE ( TakeSnapshot_FinishedThreadsDoNotSlowSnapshotsDown_Test )
+{
+    const u32_q TAG = SQAllocationTracker::RegisterTag("SQAllocationTracker_PerformanceTest_ShortLivedThreads", __FILE__, __LINE__);
+    const u64_q EXPECTED_ALLOCATIONS = SQAllocationTracker::TakeSnapshot().GetAllocations(TAG) + SQALLOCATIONTRACKER_PERFORMANCETEST_SHORT_LIVED_THREADS;
+    QDelegate<void (const u32_q)> function(&SQAllocationTracker_PerformanceTest_AllocateOnce);
+
+    const float_q TIME_BEFORE = SQAllocationTracker_PerformanceTest_MeasureSnapshot();
+
+    for(u32_q i = 0; i < SQALLOCATIONTRACKER_PERFORMANCETEST_SHORT_LIVED_THREADS; ++i)
+    {
+        QThread thread(function, TAG);
+        thread.Join();
+    }
+
+    const float_q TIME_AFTER = SQAllocationTracker_PerformanceTest_MeasureSnapshot();
+
+    BOOST_TEST_MESSAGE("Time to take " << SQALLOCATIONTRACKER_PERFORMANCETEST_SNAPSHOTS << " snapshots: " << TIME_BEFORE << " ms before and " << TIME_AFTER << " ms after " << 
+                       SQALLOCATIONTRACKER_PERFORMANCETEST_SHORT_LIVED_THREADS << " threads have allocated and finished");
+
+    // The allocations of the finished threads are kept
+    BOOST_CHECK_EQUAL(SQAllocationTracker::TakeSnapshot().GetAllocations(TAG), EXPECTED_ALLOCATIONS);
+}
+
+// End - Test Suite: SQAllocationTracker
+QTEST_SUITE_END()
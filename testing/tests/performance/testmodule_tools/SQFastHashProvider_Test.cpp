@@ -0,0 +1,167 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QHashtable.h"
+#include "QFlatHashtable.h"
+#include "QArrayDynamic.h"
+#include "SQStringHashProvider.h"
+#include "SQIntegerHashProvider.h"
+#include "SQFastStringHashProvider.h"
+#include "SQFastIntegerHashProvider.h"
+#include "QStopwatch.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QHashtable;
+using Kinesis::QuimeraEngine::Tools::Containers::QFlatHashtable;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+using Kinesis::QuimeraEngine::Tools::Containers::SQStringHashProvider;
+using Kinesis::QuimeraEngine::Tools::Containers::SQIntegerHashProvider;
+using Kinesis::QuimeraEngine::Tools::Containers::SQFastStringHashProvider;
+using Kinesis::QuimeraEngine::Tools::Containers::SQFastIntegerHashProvider;
+using Kinesis::QuimeraEngine::System::Timing::QStopwatch;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+
+/// <summary>
+/// The number of keys stored in the hashtables.
+/// </summary>
+static const u32_q SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_KEYS = 20000U;
+
+/// <summary>
+/// The number of times every key is searched for.
+/// </summary>
+static const u32_q SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_LOOKUPS = 50U;
+
+/// <summary>
+/// The number of buckets of the hashtables.
+/// </summary>
+static const pointer_uint_q SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_BUCKETS = 8192U;
+
+
+QTEST_SUITE_BEGIN( SQFastHashProvider_TestSuite )
+
+/// <summary>
+/// Compares the time it takes to search for string keys, similar to resource paths, in a hashtable that uses the one-at-a-time string hash 
+/// provider and in another that uses the fast string hash provider, which reuses the hash cached in every key.
+/// </summary>
+QTEST_CASE ( StringLookup_StringHashProviderVersusFastStringHashProvider_Test )
+{
+    QStopwatch stopwatch;
+
+    QArrayDynamic<string_q> arKeys(SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_KEYS);
+
+    for(u32_q i = 0; i < SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_KEYS; ++i)
+        arKeys.Add(string_q("resources/textures/characters/character_") + string_q::FromInteger(i) + string_q("_diffuse.png"));
+
+    QHashtable<string_q, u32_q, SQStringHashProvider> jenkinsTable(SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_BUCKETS, 2U);
+    QHashtable<string_q, u32_q, SQFastStringHashProvider> fastTable(SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_BUCKETS, 2U);
+
+    for(u32_q i = 0; i < SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_KEYS; ++i)
+    {
+        jenkinsTable.Add(arKeys[i], i);
+        fastTable.Add(arKeys[i], i);
+    }
+
+    // One-at-a-time
+    u64_q uJenkinsChecksum = 0;
+
+    stopwatch.Set();
+    for(u32_q uLookup = 0; uLookup < SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_LOOKUPS; ++uLookup)
+        for(u32_q i = 0; i < SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_KEYS; ++i)
+            uJenkinsChecksum += jenkinsTable.GetValue(arKeys[i]);
+    const float_q JENKINS_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    // Fast
+    u64_q uFastChecksum = 0;
+
+    stopwatch.Set();
+    for(u32_q uLookup = 0; uLookup < SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_LOOKUPS; ++uLookup)
+        for(u32_q i = 0; i < SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_KEYS; ++i)
+            uFastChecksum += fastTable.GetValue(arKeys[i]);
+    const float_q FAST_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    BOOST_CHECK_EQUAL(uJenkinsChecksum, uFastChecksum);
+
+    BOOST_TEST_MESSAGE("Searching for " << SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_KEYS << " string keys " << SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_LOOKUPS << " times:");
+    BOOST_TEST_MESSAGE("SQStringHashProvider:        " << JENKINS_TIME << " ms");
+    BOOST_TEST_MESSAGE("SQFastStringHashProvider:    " << FAST_TIME << " ms");
+}
+
+/// <summary>
+/// Compares the time it takes to search for 64-bits integer keys that only differ in their highest 32 bits, like handles that store the index 
+/// in the upper half, in a flat hashtable that uses the modulo-based integer hash provider and in another that uses the fast integer hash provider. 
+/// The flat hashtable keeps only 32 bits of the hash, so the first provider makes all the keys collide.
+/// </summary>
+QTEST_CASE ( HighBitsIntegerLookup_IntegerHashProviderVersusFastIntegerHashProvider_Test )
+{
+    static const u32_q NUMBER_OF_KEYS = 4000U;
+    static const u32_q KEY_SHIFT = 32U;
+
+    QStopwatch stopwatch;
+
+    QFlatHashtable<u64_q, u32_q, SQIntegerHashProvider> moduloTable(NUMBER_OF_KEYS);
+    QFlatHashtable<u64_q, u32_q, SQFastIntegerHashProvider> fastTable(NUMBER_OF_KEYS);
+
+    for(u32_q i = 0; i < NUMBER_OF_KEYS; ++i)
+    {
+        moduloTable.Add(scast_q(i, u64_q) << KEY_SHIFT, i);
+        fastTable.Add(scast_q(i, u64_q) << KEY_SHIFT, i);
+    }
+
+    // Modulo
+    u64_q uModuloChecksum = 0;
+
+    stopwatch.Set();
+    for(u32_q uLookup = 0; uLookup < SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_LOOKUPS; ++uLookup)
+        for(u32_q i = 0; i < NUMBER_OF_KEYS; ++i)
+            uModuloChecksum += moduloTable.GetValue(scast_q(i, u64_q) << KEY_SHIFT);
+    const float_q MODULO_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    // Fast
+    u64_q uFastChecksum = 0;
+
+    stopwatch.Set();
+    for(u32_q uLookup = 0; uLookup < SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_LOOKUPS; ++uLookup)
+        for(u32_q i = 0; i < NUMBER_OF_KEYS; ++i)
+            uFastChecksum += fastTable.GetValue(scast_q(i, u64_q) << KEY_SHIFT);
+    const float_q FAST_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    BOOST_CHECK_EQUAL(uModuloChecksum, uFastChecksum);
+
+    BOOST_TEST_MESSAGE("Searching for " << NUMBER_OF_KEYS << " integer keys that differ in their highest 32 bits " << SQFASTHASHPROVIDER_PERFORMANCETEST_NUMBER_OF_LOOKUPS << " times:");
+    BOOST_TEST_MESSAGE("SQIntegerHashProvider:       " << MODULO_TIME << " ms");
+    BOOST_TEST_MESSAGE("SQFastIntegerHashProvider:   " << FAST_TIME << " ms");
+}
+
+// End - Test Suite: SQFastHashProvider
+QTEST_SUITE_END()
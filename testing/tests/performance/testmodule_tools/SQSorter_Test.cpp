@@ -0,0 +1,191 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "SQSorter.h"
+#include "SQParallelSorter.h"
+#include "QList.h"
+#include "QStopwatch.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::SQSorter;
+using Kinesis::QuimeraEngine::Tools::Containers::QList;
+using Kinesis::QuimeraEngine::System::Threading::SQParallelSorter;
+using Kinesis::QuimeraEngine::System::Timing::QStopwatch;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+/// <summary>
+/// The number of elements sorted in every performance test.
+/// </summary>
+static const pointer_uint_q SQSORTER_PERFORMANCETEST_NUMBER_OF_ELEMENTS = 10000000U;
+
+/// <summary>
+/// The numbers of threads used to measure the parallel sort.
+/// </summary>
+static const unsigned int SQSORTER_PERFORMANCETEST_THREADS[] = { 1U, 2U, 4U, 8U };
+
+/// <summary>
+/// Fills a sequence with pseudo-random numbers using a linear congruential generator with a fixed seed, so all the executions are equal.
+/// </summary>
+/// <param name="arElements">[OUT] The sequence to fill.</param>
+/// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+static void SQSorter_PerformanceTest_FillWithRandomNumbers(u32_q* arElements, const pointer_uint_q uNumberOfElements)
+{
+    u32_q uRandom = 12345U;
+
+    for(pointer_uint_q i = 0; i < uNumberOfElements; ++i)
+    {
+        uRandom = uRandom * 1664525U + 1013904223U;
+        arElements[i] = uRandom;
+    }
+}
+
+/// <summary>
+/// Checks whether a sequence of numbers is sorted in ascending order.
+/// </summary>
+/// <param name="arElements">[IN] The sequence to check.</param>
+/// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+/// <returns>
+/// True if every element is lower than or equal to the next one; False otherwise.
+/// </returns>
+static bool SQSorter_PerformanceTest_IsSorted(const u32_q* arElements, const pointer_uint_q uNumberOfElements)
+{
+    bool bIsSorted = true;
+
+    for(pointer_uint_q i = 1U; i < uNumberOfElements && bIsSorted; ++i)
+        bIsSorted = arElements[i - 1U] <= arElements[i];
+
+    return bIsSorted;
+}
+
+
+QTEST_SUITE_BEGIN( SQSorter_TestSuite )
+
+/// <summary>
+/// Measures the time spent by the introsort and the merge sort to sort 10M random integers.
+/// </summary>
+QTEST_CASE ( SortStableSort_SortTenMillionIntegers_Test )
+{
+    const pointer_uint_q NUMBER_OF_ELEMENTS = SQSORTER_PERFORMANCETEST_NUMBER_OF_ELEMENTS;
+    u32_q* arElements = new u32_q[NUMBER_OF_ELEMENTS];
+    QStopwatch stopwatch;
+
+    SQSorter_PerformanceTest_FillWithRandomNumbers(arElements, NUMBER_OF_ELEMENTS);
+    stopwatch.Set();
+    SQSorter<u32_q>::Sort(arElements, NUMBER_OF_ELEMENTS);
+    const float_q SORT_TIME = stopwatch.GetElapsedTimeAsFloat();
+    BOOST_CHECK(SQSorter_PerformanceTest_IsSorted(arElements, NUMBER_OF_ELEMENTS));
+
+    // Already sorted sequences must not degrade the introsort
+    stopwatch.Set();
+    SQSorter<u32_q>::Sort(arElements, NUMBER_OF_ELEMENTS);
+    const float_q SORTED_INPUT_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    SQSorter_PerformanceTest_FillWithRandomNumbers(arElements, NUMBER_OF_ELEMENTS);
+    stopwatch.Set();
+    SQSorter<u32_q>::StableSort(arElements, NUMBER_OF_ELEMENTS);
+    const float_q STABLE_SORT_TIME = stopwatch.GetElapsedTimeAsFloat();
+    BOOST_CHECK(SQSorter_PerformanceTest_IsSorted(arElements, NUMBER_OF_ELEMENTS));
+
+    delete[] arElements;
+
+    BOOST_TEST_MESSAGE("SQSorter (" << NUMBER_OF_ELEMENTS << " elements): Sort " << SORT_TIME << " ms, Sort (sorted input) " << SORTED_INPUT_TIME << 
+                       " ms, StableSort " << STABLE_SORT_TIME << " ms");
+}
+
+/// <summary>
+/// Measures the time spent by the parallel sort to sort 10M random integers using different numbers of threads.
+/// </summary>
+QTEST_CASE ( ParallelSort_SortTenMillionIntegersUsingSeveralThreads_Test )
+{
+    const pointer_uint_q NUMBER_OF_ELEMENTS = SQSORTER_PERFORMANCETEST_NUMBER_OF_ELEMENTS;
+    u32_q* arElements = new u32_q[NUMBER_OF_ELEMENTS];
+    QStopwatch stopwatch;
+
+    for(pointer_uint_q uThreads = 0; uThreads < sizeof(SQSORTER_PERFORMANCETEST_THREADS) / sizeof(unsigned int); ++uThreads)
+    {
+        const unsigned int NUMBER_OF_THREADS = SQSORTER_PERFORMANCETEST_THREADS[uThreads];
+
+        SQSorter_PerformanceTest_FillWithRandomNumbers(arElements, NUMBER_OF_ELEMENTS);
+        stopwatch.Set();
+        SQParallelSorter<u32_q>::Sort(arElements, NUMBER_OF_ELEMENTS, NUMBER_OF_THREADS);
+        const float_q SORT_TIME = stopwatch.GetElapsedTimeAsFloat();
+        BOOST_CHECK(SQSorter_PerformanceTest_IsSorted(arElements, NUMBER_OF_ELEMENTS));
+
+        SQSorter_PerformanceTest_FillWithRandomNumbers(arElements, NUMBER_OF_ELEMENTS);
+        stopwatch.Set();
+        SQParallelSorter<u32_q>::StableSort(arElements, NUMBER_OF_ELEMENTS, NUMBER_OF_THREADS);
+        const float_q STABLE_SORT_TIME = stopwatch.GetElapsedTimeAsFloat();
+        BOOST_CHECK(SQSorter_PerformanceTest_IsSorted(arElements, NUMBER_OF_ELEMENTS));
+
+        BOOST_TEST_MESSAGE("SQParallelSorter (" << NUMBER_OF_ELEMENTS << " elements, " << NUMBER_OF_THREADS << " threads): Sort " << SORT_TIME << 
+                           " ms, StableSort " << STABLE_SORT_TIME << " ms");
+    }
+
+    delete[] arElements;
+}
+
+/// <summary>
+/// Measures the time spent by the list to sort 10M random integers by relinking them.
+/// </summary>
+QTEST_CASE ( QListStableSort_SortTenMillionIntegers_Test )
+{
+    const pointer_uint_q NUMBER_OF_ELEMENTS = SQSORTER_PERFORMANCETEST_NUMBER_OF_ELEMENTS;
+    u32_q* arElements = new u32_q[NUMBER_OF_ELEMENTS];
+    SQSorter_PerformanceTest_FillWithRandomNumbers(arElements, NUMBER_OF_ELEMENTS);
+
+    QList<u32_q> list(NUMBER_OF_ELEMENTS);
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        list.Add(arElements[i]);
+
+    delete[] arElements;
+
+    QStopwatch stopwatch;
+    stopwatch.Set();
+    list.StableSort();
+    const float_q STABLE_SORT_TIME = stopwatch.GetElapsedTimeAsFloat();
+
+    bool bIsSorted = true;
+    u32_q uPrevious = 0;
+
+    for(QList<u32_q>::QConstListIterator it = list.GetFirst(); !it.IsEnd() && bIsSorted; ++it)
+    {
+        bIsSorted = uPrevious <= *it;
+        uPrevious = *it;
+    }
+
+    BOOST_CHECK(bIsSorted);
+    BOOST_TEST_MESSAGE("QList (" << NUMBER_OF_ELEMENTS << " elements): StableSort " << STABLE_SORT_TIME << " ms");
+}
+
+// End - Test Suite: SQSorter
+QTEST_SUITE_END()
@@ -30,14 +30,24 @@ using namespace boost::unit_test;
 
 #include "../../testsystem/TestingExternalDefinitions.h"
 
+// To use memset
+#include <cstring>
+
 #include "AllocationOperators.h"
 #include "QAlignment.h"
 #include "QAssertException.h"
+#include "SQAllocationTracker.h"
+#include "QAllocationSnapshot.h"
 
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
 using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::char_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::i64_q;
 using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+using Kinesis::QuimeraEngine::Common::Memory::SQAllocationTracker;
+using Kinesis::QuimeraEngine::Common::Memory::QAllocationSnapshot;
 
 // --------------------------------------------------------------------------------------------------------
 // Eight bytes size supporting struct for allocation and deallocation of memory blocks.
@@ -176,5 +186,175 @@ QTEST_CASE ( OperatorDeleteArray_AssertionFailsWhenReceivedANonAlignedMemoryBloc
 
 #endif // QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
 
+/// <summary>
+/// Checks that the allocation is attributed to the tag which is active in the calling thread.
+/// </summary>
+QTEST_CASE ( tracked_alloc_q_AllocationIsAttributedToTheCurrentTag_Test )
+{
+    // [Preparation]
+    const u32_q TAG = SQAllocationTracker::RegisterTag("tracked_alloc_q_CurrentTag", "File.cpp", 10);
+    const pointer_uint_q BLOCK_SIZE = 100U;
+    const i64_q EXPECTED_LIVE_BYTES = 100;
+    const u64_q EXPECTED_ALLOCATIONS = 1U;
+    SQAllocationTracker::SetCurrentTag(TAG);
+
+    // [Execution]
+    char_q* pBlock = scast_q(tracked_alloc_q(BLOCK_SIZE), char_q*);
+    SQAllocationTracker::SetCurrentTag(SQAllocationTracker::UNTAGGED);
+
+    // [Verification]
+    QAllocationSnapshot snapshot = SQAllocationTracker::TakeSnapshot();
+    BOOST_CHECK(pBlock != null_q);
+    BOOST_CHECK_EQUAL(snapshot.GetLiveBytes(TAG), EXPECTED_LIVE_BYTES);
+    BOOST_CHECK_EQUAL(snapshot.GetAllocations(TAG), EXPECTED_ALLOCATIONS);
+
+    // [Cleaning]
+    tracked_free_q(pBlock);
+}
+
+/// <summary>
+/// Checks that the whole block can be written without corrupting the header that stores its size and tag.
+/// </summary>
+QTEST_CASE ( tracked_alloc_q_WholeBlockCanBeUsed_Test )
+{
+    // [Preparation]
+    const u32_q TAG = SQAllocationTracker::RegisterTag("tracked_alloc_q_WholeBlockCanBeUsed", "File.cpp", 10);
+    const pointer_uint_q BLOCK_SIZE = 33U;
+    const i64_q EXPECTED_LIVE_BYTES = 0;
+    const u64_q EXPECTED_DEALLOCATIONS = 1U;
+    SQAllocationTracker::SetCurrentTag(TAG);
+    char_q* pBlock = scast_q(tracked_alloc_q(BLOCK_SIZE), char_q*);
+    SQAllocationTracker::SetCurrentTag(SQAllocationTracker::UNTAGGED);
+
+    // [Execution]
+    memset(pBlock, 0xFF, BLOCK_SIZE);
+    tracked_free_q(pBlock);
+
+    // [Verification]
+    QAllocationSnapshot snapshot = SQAllocationTracker::TakeSnapshot();
+    BOOST_CHECK_EQUAL(snapshot.GetLiveBytes(TAG), EXPECTED_LIVE_BYTES);
+    BOOST_CHECK_EQUAL(snapshot.GetDeallocations(TAG), EXPECTED_DEALLOCATIONS);
+}
+
+/// <summary>
+/// Checks that the deallocation is attributed to the tag of the allocation, even if another tag is active.
+/// </summary>
+QTEST_CASE ( tracked_free_q_DeallocationIsAttributedToTheTagOfTheAllocation_Test )
+{
+    // [Preparation]
+    const u32_q ALLOCATION_TAG = SQAllocationTracker::RegisterTag("tracked_free_q_AllocationTag", "File.cpp", 10);
+    const u32_q OTHER_TAG = SQAllocationTracker::RegisterTag("tracked_free_q_OtherTag", "File.cpp", 20);
+    const i64_q EXPECTED_LIVE_BYTES = 0;
+    const u64_q EXPECTED_DEALLOCATIONS = 1U;
+    const u64_q EXPECTED_OTHER_DEALLOCATIONS = 0;
+    SQAllocationTracker::SetCurrentTag(ALLOCATION_TAG);
+    void* pBlock = tracked_alloc_q(64U);
+
+    // [Execution]
+    SQAllocationTracker::SetCurrentTag(OTHER_TAG);
+    tracked_free_q(pBlock);
+    SQAllocationTracker::SetCurrentTag(SQAllocationTracker::UNTAGGED);
+
+    // [Verification]
+    QAllocationSnapshot snapshot = SQAllocationTracker::TakeSnapshot();
+    BOOST_CHECK_EQUAL(snapshot.GetLiveBytes(ALLOCATION_TAG), EXPECTED_LIVE_BYTES);
+    BOOST_CHECK_EQUAL(snapshot.GetDeallocations(ALLOCATION_TAG), EXPECTED_DEALLOCATIONS);
+    BOOST_CHECK_EQUAL(snapshot.GetDeallocations(OTHER_TAG), EXPECTED_OTHER_DEALLOCATIONS);
+}
+
+/// <summary>
+/// Checks that nothing happens when the block is null.
+/// </summary>
+QTEST_CASE ( tracked_free_q_NothingHappensWhenBlockIsNull_Test )
+{
+    // [Preparation]
+    const u64_q EXPECTED_DEALLOCATIONS = SQAllocationTracker::TakeSnapshot().GetDeallocations(SQAllocationTracker::UNTAGGED);
+
+    // [Execution]
+    tracked_free_q(null_q);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(SQAllocationTracker::TakeSnapshot().GetDeallocations(SQAllocationTracker::UNTAGGED), EXPECTED_DEALLOCATIONS);
+}
+
+/// <summary>
+/// Checks that the block is aligned even when the alignment is bigger than the header.
+/// </summary>
+QTEST_CASE ( tracked_aligned_alloc_q_BlockIsAligned_Test )
+{
+    // [Preparation]
+    const u32_q TAG = SQAllocationTracker::RegisterTag("tracked_aligned_alloc_q_BlockIsAligned", "File.cpp", 10);
+    const QAlignment ALIGNMENT(64U);
+    const pointer_uint_q BLOCK_SIZE = 100U;
+    const pointer_uint_q EXPECTED_REMAINDER = 0;
+    const i64_q EXPECTED_LIVE_BYTES = 100;
+    SQAllocationTracker::SetCurrentTag(TAG);
+
+    // [Execution]
+    char_q* pBlock = scast_q(tracked_aligned_alloc_q(BLOCK_SIZE, ALIGNMENT), char_q*);
+    SQAllocationTracker::SetCurrentTag(SQAllocationTracker::UNTAGGED);
+
+    // [Verification]
+    QAllocationSnapshot snapshot = SQAllocationTracker::TakeSnapshot();
+    BOOST_CHECK_EQUAL(rcast_q(pBlock, pointer_uint_q) % ALIGNMENT, EXPECTED_REMAINDER);
+    BOOST_CHECK_EQUAL(snapshot.GetLiveBytes(TAG), EXPECTED_LIVE_BYTES);
+
+    // [Cleaning]
+    tracked_aligned_free_q(pBlock, ALIGNMENT);
+}
+
+/// <summary>
+/// Checks that the deallocation of an aligned block is attributed to the tag of the allocation.
+/// </summary>
+QTEST_CASE ( tracked_aligned_free_q_DeallocationIsAttributedToTheTagOfTheAllocation_Test )
+{
+    // [Preparation]
+    const u32_q TAG = SQAllocationTracker::RegisterTag("tracked_aligned_free_q_TagOfTheAllocation", "File.cpp", 10);
+    const QAlignment ALIGNMENT(32U);
+    const pointer_uint_q BLOCK_SIZE = 40U;
+    const i64_q EXPECTED_LIVE_BYTES = 0;
+    const u64_q EXPECTED_DEALLOCATIONS = 1U;
+    SQAllocationTracker::SetCurrentTag(TAG);
+    char_q* pBlock = scast_q(tracked_aligned_alloc_q(BLOCK_SIZE, ALIGNMENT), char_q*);
+    SQAllocationTracker::SetCurrentTag(SQAllocationTracker::UNTAGGED);
+    memset(pBlock, 0xFF, BLOCK_SIZE);
+
+    // [Execution]
+    tracked_aligned_free_q(pBlock, ALIGNMENT);
+
+    // [Verification]
+    QAllocationSnapshot snapshot = SQAllocationTracker::TakeSnapshot();
+    BOOST_CHECK_EQUAL(snapshot.GetLiveBytes(TAG), EXPECTED_LIVE_BYTES);
+    BOOST_CHECK_EQUAL(snapshot.GetDeallocations(TAG), EXPECTED_DEALLOCATIONS);
+}
+
+/// <summary>
+/// Checks that the new operator notifies the allocation tracker only when the allocation tracking is enabled in the configuration.
+/// </summary>
+QTEST_CASE ( OperatorNew_AllocationsAreTrackedOnlyWhenTrackingIsEnabled_Test )
+{
+    // [Preparation]
+    const u32_q TAG = SQAllocationTracker::RegisterTag("OperatorNew_TrackedOnlyWhenEnabled", "File.cpp", 10);
+#if QE_CONFIG_ALLOCATIONTRACKING_DEFAULT == QE_CONFIG_ALLOCATIONTRACKING_ENABLED
+    const u64_q EXPECTED_ALLOCATIONS = 1U;
+    const u64_q EXPECTED_DEALLOCATIONS = 1U;
+#else
+    const u64_q EXPECTED_ALLOCATIONS = 0;
+    const u64_q EXPECTED_DEALLOCATIONS = 0;
+#endif
+    SQAllocationTracker::SetCurrentTag(TAG);
+
+    // [Execution]
+    // The pointer is volatile so the compiler cannot remove the allocation
+    TFooEightBytesSize* volatile pFoo = new TFooEightBytesSize();
+    delete pFoo;
+    SQAllocationTracker::SetCurrentTag(SQAllocationTracker::UNTAGGED);
+
+    // [Verification]
+    QAllocationSnapshot snapshot = SQAllocationTracker::TakeSnapshot();
+    BOOST_CHECK_EQUAL(snapshot.GetAllocations(TAG), EXPECTED_ALLOCATIONS);
+    BOOST_CHECK_EQUAL(snapshot.GetDeallocations(TAG), EXPECTED_DEALLOCATIONS);
+}
+
 // End - Test Suite: AllocationAndDeallocationOperators
 QTEST_SUITE_END()
@@ -0,0 +1,332 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QAllocationSnapshot.h"
+#include "SQAllocationTracker.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::i64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::EQComparisonType;
+using Kinesis::QuimeraEngine::Common::Memory::SQAllocationTracker;
+using Kinesis::QuimeraEngine::Common::Memory::QAllocationSnapshot;
+
+
+QTEST_SUITE_BEGIN( QAllocationSnapshot_TestSuite )
+
+/// <summary>
+/// Checks that the default snapshot contains no tags.
+/// </summary>
+QTEST_CASE( Constructor1_SnapshotContainsNoTags_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_TAGS_COUNT = 0;
+    const i64_q EXPECTED_LIVE_BYTES = 0;
+
+    // [Execution]
+    QAllocationSnapshot snapshot;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(snapshot.GetTagsCount(), EXPECTED_TAGS_COUNT);
+    BOOST_CHECK_EQUAL(snapshot.GetTotalLiveBytes(), EXPECTED_LIVE_BYTES);
+    BOOST_CHECK(snapshot.ToString().IsEmpty());
+}
+
+/// <summary>
+/// Checks that all the statistics are copied.
+/// </summary>
+QTEST_CASE( Constructor2_StatisticsAreCopied_Test )
+{
+    // [Preparation]
+    const u32_q TAG = SQAllocationTracker::RegisterTag("QAllocationSnapshot_Constructor2", "File.cpp", 10);
+    SQAllocationTracker::NotifyAllocation(TAG, 64U);
+    const QAllocationSnapshot ORIGINAL = SQAllocationTracker::TakeSnapshot();
+
+    // [Execution]
+    QAllocationSnapshot snapshot(ORIGINAL);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(snapshot.GetTagsCount(), ORIGINAL.GetTagsCount());
+    BOOST_CHECK_EQUAL(snapshot.GetLiveBytes(TAG), ORIGINAL.GetLiveBytes(TAG));
+    BOOST_CHECK_EQUAL(snapshot.GetAllocations(TAG), ORIGINAL.GetAllocations(TAG));
+    BOOST_CHECK_EQUAL(snapshot.GetTagName(TAG), ORIGINAL.GetTagName(TAG));
+
+    // [Cleaning]
+    SQAllocationTracker::NotifyDeallocation(TAG, 64U);
+}
+
+/// <summary>
+/// Checks that all the statistics are copied.
+/// </summary>
+QTEST_CASE( OperatorAssignation_StatisticsAreCopied_Test )
+{
+    // [Preparation]
+    const u32_q TAG = SQAllocationTracker::RegisterTag("QAllocationSnapshot_OperatorAssignation", "File.cpp", 10);
+    SQAllocationTracker::NotifyAllocation(TAG, 64U);
+    const QAllocationSnapshot ORIGINAL = SQAllocationTracker::TakeSnapshot();
+    QAllocationSnapshot snapshot;
+
+    // [Execution]
+    snapshot = ORIGINAL;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(snapshot.GetTagsCount(), ORIGINAL.GetTagsCount());
+    BOOST_CHECK_EQUAL(snapshot.GetLiveBytes(TAG), ORIGINAL.GetLiveBytes(TAG));
+    BOOST_CHECK_EQUAL(snapshot.GetAllocations(TAG), ORIGINAL.GetAllocations(TAG));
+    BOOST_CHECK_EQUAL(snapshot.GetTagName(TAG), ORIGINAL.GetTagName(TAG));
+
+    // [Cleaning]
+    SQAllocationTracker::NotifyDeallocation(TAG, 64U);
+}
+
+/// <summary>
+/// Checks that the difference contains what happened between both snapshots, and the high-water mark of the latest one.
+/// </summary>
+QTEST_CASE( GetDifference_ContainsWhatHappenedBetweenSnapshots_Test )
+{
+    // [Preparation]
+    const u32_q TAG = SQAllocationTracker::RegisterTag("QAllocationSnapshot_GetDifference", "File.cpp", 10);
+    SQAllocationTracker::EnableHighWaterMark(TAG);
+    SQAllocationTracker::NotifyAllocation(TAG, 1000U);
+    SQAllocationTracker::NotifyAllocation(TAG, 24U);
+    const QAllocationSnapshot PREVIOUS = SQAllocationTracker::TakeSnapshot();
+
+    SQAllocationTracker::NotifyDeallocation(TAG, 1000U);
+    SQAllocationTracker::NotifyAllocation(TAG, 24U);
+    SQAllocationTracker::NotifyAllocation(TAG, 24U);
+    const QAllocationSnapshot LATEST = SQAllocationTracker::TakeSnapshot();
+
+    const i64_q EXPECTED_LIVE_BYTES = -1000 + 24 + 24;
+    const u64_q EXPECTED_HIGH_WATER_MARK = 1024U;
+    const u64_q EXPECTED_ALLOCATIONS = 2U;
+    const u64_q EXPECTED_DEALLOCATIONS = 1U;
+    const u64_q EXPECTED_ALLOCATED_BYTES = 48U;
+    const u64_q EXPECTED_SMALL_BLOCKS = 2U;
+    const u64_q EXPECTED_BIG_BLOCKS = 0;
+
+    // [Execution]
+    QAllocationSnapshot difference = LATEST.GetDifference(PREVIOUS);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(difference.GetLiveBytes(TAG), EXPECTED_LIVE_BYTES);
+    BOOST_CHECK_EQUAL(difference.GetHighWaterMark(TAG), EXPECTED_HIGH_WATER_MARK);
+    BOOST_CHECK_EQUAL(difference.GetAllocations(TAG), EXPECTED_ALLOCATIONS);
+    BOOST_CHECK_EQUAL(difference.GetDeallocations(TAG), EXPECTED_DEALLOCATIONS);
+    BOOST_CHECK_EQUAL(difference.GetAllocatedBytes(TAG), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(difference.GetHistogramCount(TAG, SQAllocationTracker::GetHistogramBucket(24U)), EXPECTED_SMALL_BLOCKS);
+    BOOST_CHECK_EQUAL(difference.GetHistogramCount(TAG, SQAllocationTracker::GetHistogramBucket(1000U)), EXPECTED_BIG_BLOCKS);
+
+    // [Cleaning]
+    SQAllocationTracker::NotifyDeallocation(TAG, 24U);
+    SQAllocationTracker::NotifyDeallocation(TAG, 24U);
+    SQAllocationTracker::NotifyDeallocation(TAG, 24U);
+}
+
+/// <summary>
+/// Checks that the tags registered after the previous snapshot are compared to zero.
+/// </summary>
+QTEST_CASE( GetDifference_NewTagsAreComparedToZero_Test )
+{
+    // [Preparation]
+    const QAllocationSnapshot PREVIOUS = SQAllocationTracker::TakeSnapshot();
+    const u32_q TAG = SQAllocationTracker::RegisterTag("QAllocationSnapshot_GetDifference_NewTag", "File.cpp", 10);
+    SQAllocationTracker::NotifyAllocation(TAG, 32U);
+    const QAllocationSnapshot LATEST = SQAllocationTracker::TakeSnapshot();
+
+    const i64_q EXPECTED_LIVE_BYTES = 32;
+    const u64_q EXPECTED_ALLOCATIONS = 1U;
+
+    // [Execution]
+    QAllocationSnapshot difference = LATEST.GetDifference(PREVIOUS);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(difference.GetTagsCount(), LATEST.GetTagsCount());
+    BOOST_CHECK_EQUAL(difference.GetLiveBytes(TAG), EXPECTED_LIVE_BYTES);
+    BOOST_CHECK_EQUAL(difference.GetAllocations(TAG), EXPECTED_ALLOCATIONS);
+
+    // [Cleaning]
+    SQAllocationTracker::NotifyDeallocation(TAG, 32U);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the previous snapshot contains more tags.
+/// </summary>
+QTEST_CASE( GetDifference_AssertionFailsWhenPreviousSnapshotContainsMoreTags_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QAllocationSnapshot PREVIOUS = SQAllocationTracker::TakeSnapshot();
+    const QAllocationSnapshot LATEST;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        LATEST.GetDifference(PREVIOUS);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the tag does not exist in the snapshot.
+/// </summary>
+QTEST_CASE( GetLiveBytes_AssertionFailsWhenTagDoesNotExist_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QAllocationSnapshot SNAPSHOT = SQAllocationTracker::TakeSnapshot();
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SNAPSHOT.GetLiveBytes(SNAPSHOT.GetTagsCount());
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the text contains a line with the expected format for a tag with allocations.
+/// </summary>
+QTEST_CASE( ToString_ContainsTheStatisticsOfTagsWithAllocations_Test )
+{
+    // [Preparation]
+    const QAllocationSnapshot PREVIOUS = SQAllocationTracker::TakeSnapshot();
+    const u32_q TAG = SQAllocationTracker::RegisterTag("QAllocationSnapshot_ToString", "File.cpp", 12);
+    SQAllocationTracker::EnableHighWaterMark(TAG);
+    SQAllocationTracker::NotifyAllocation(TAG, 10U);
+    SQAllocationTracker::NotifyAllocation(TAG, 300U);
+    SQAllocationTracker::NotifyDeallocation(TAG, 10U);
+    const QAllocationSnapshot DIFFERENCE = SQAllocationTracker::TakeSnapshot().GetDifference(PREVIOUS);
+
+    const string_q EXPECTED_RESULT("QAllocationSnapshot_ToString (File.cpp:12): 300 live bytes, high-water mark 310 bytes, 2 allocations, 1 deallocations, "
+                                   "310 bytes allocated, sizes [<=16: 1, <=512: 1]\n");
+
+    // [Execution]
+    string_q strResult = DIFFERENCE.ToString();
+
+    // [Verification]
+    BOOST_CHECK(strResult == EXPECTED_RESULT);
+
+    // [Cleaning]
+    SQAllocationTracker::NotifyDeallocation(TAG, 300U);
+}
+
+/// <summary>
+/// Checks that the untagged group is named "Untagged" and the biggest blocks are shown in the last interval.
+/// </summary>
+QTEST_CASE( ToString_UntaggedGroupAndBiggestBlocksAreShownAsExpected_Test )
+{
+    // [Preparation]
+    const QAllocationSnapshot PREVIOUS = SQAllocationTracker::TakeSnapshot();
+    SQAllocationTracker::NotifyAllocation(SQAllocationTracker::UNTAGGED, 1000000U);
+    SQAllocationTracker::NotifyDeallocation(SQAllocationTracker::UNTAGGED, 1000000U);
+    const QAllocationSnapshot DIFFERENCE = SQAllocationTracker::TakeSnapshot().GetDifference(PREVIOUS);
+
+    const string_q EXPECTED_PREFIX("Untagged: 0 live bytes");
+    const string_q EXPECTED_SUFFIX("1000000 bytes allocated, sizes [>262144: 1]\n");
+
+    // [Execution]
+    string_q strResult = DIFFERENCE.ToString();
+
+    // [Verification]
+    BOOST_CHECK(strResult.Contains(EXPECTED_PREFIX, EQComparisonType::E_BinaryCaseSensitive));
+    BOOST_CHECK(strResult.Contains(EXPECTED_SUFFIX, EQComparisonType::E_BinaryCaseSensitive));
+}
+
+/// <summary>
+/// Checks that the tags without allocations nor deallocations are omitted.
+/// </summary>
+QTEST_CASE( ToString_TagsWithoutActivityAreOmitted_Test )
+{
+    // [Preparation]
+    SQAllocationTracker::RegisterTag("QAllocationSnapshot_ToString_NoActivity", "File.cpp", 10);
+    const QAllocationSnapshot SNAPSHOT = SQAllocationTracker::TakeSnapshot();
+    const QAllocationSnapshot DIFFERENCE = SNAPSHOT.GetDifference(SNAPSHOT);
+
+    // [Execution]
+    string_q strResult = DIFFERENCE.ToString();
+
+    // [Verification]
+    BOOST_CHECK(strResult.IsEmpty());
+}
+
+/// <summary>
+/// Checks that the total live bytes are the sum of the live bytes of all the tags.
+/// </summary>
+QTEST_CASE( GetTotalLiveBytes_ReturnsTheSumOfAllTheTags_Test )
+{
+    // [Preparation]
+    const QAllocationSnapshot PREVIOUS = SQAllocationTracker::TakeSnapshot();
+    const u32_q TAG1 = SQAllocationTracker::RegisterTag("QAllocationSnapshot_GetTotalLiveBytes1", "File.cpp", 10);
+    const u32_q TAG2 = SQAllocationTracker::RegisterTag("QAllocationSnapshot_GetTotalLiveBytes2", "File.cpp", 10);
+    SQAllocationTracker::NotifyAllocation(TAG1, 100U);
+    SQAllocationTracker::NotifyAllocation(TAG2, 50U);
+    const QAllocationSnapshot DIFFERENCE = SQAllocationTracker::TakeSnapshot().GetDifference(PREVIOUS);
+
+    const i64_q EXPECTED_TOTAL_LIVE_BYTES = 150;
+
+    // [Execution]
+    i64_q nTotalLiveBytes = DIFFERENCE.GetTotalLiveBytes();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(nTotalLiveBytes, EXPECTED_TOTAL_LIVE_BYTES);
+
+    // [Cleaning]
+    SQAllocationTracker::NotifyDeallocation(TAG1, 100U);
+    SQAllocationTracker::NotifyDeallocation(TAG2, 50U);
+}
+
+// End - Test Suite: QAllocationSnapshot
+QTEST_SUITE_END()
@@ -1321,6 +1321,494 @@ QTEST_CASE( Reallocate2_AssertionFailsWhenInputBufferIsNull_Test )
 
 #endif
 
+/// <summary>
+/// Checks that the data of the blocks that are kept is correctly copied.
+/// </summary>
+QTEST_CASE( Shrink_PoolContentIsCorrectlyCopied_Test )
+{
+    // [Preparation]
+    const bool IS_SAME_DATA = true;
+    const pointer_uint_q BLOCK_SIZE = sizeof(unsigned int);
+    const pointer_uint_q BLOCKS_COUNT = 4;
+    const pointer_uint_q NEW_BLOCKS_COUNT = 2;
+    const pointer_uint_q POOL_SIZE = BLOCKS_COUNT * BLOCK_SIZE;
+    QPoolAllocator allocator(POOL_SIZE, BLOCK_SIZE, QAlignment(alignof_q(unsigned int)));
+    for(pointer_uint_q i = 0; i < NEW_BLOCKS_COUNT; ++i)
+        *(unsigned int*)allocator.Allocate() = i;
+
+    // [Execution]
+    allocator.Shrink(BLOCK_SIZE * NEW_BLOCKS_COUNT);
+
+    // [Verification]
+    bool bIsSameData = true;
+
+    for(pointer_uint_q i = 0; i < NEW_BLOCKS_COUNT; ++i)
+        bIsSameData = bIsSameData && *((unsigned int*)allocator.GetPointer() + i) == i;
+
+    BOOST_CHECK_EQUAL(bIsSameData, IS_SAME_DATA);
+}
+
+/// <summary>
+/// Checks that the size of the pool, the total size and the allocated bytes are correct after shrinking.
+/// </summary>
+QTEST_CASE( Shrink_SizesAreCorrectAfterShrinking_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = sizeof(int);
+    const pointer_uint_q BLOCKS_COUNT = 4;
+    const pointer_uint_q NEW_BLOCKS_COUNT = 3;
+    const pointer_uint_q POOL_SIZE = BLOCKS_COUNT * BLOCK_SIZE;
+
+    QPoolAllocator allocator(POOL_SIZE, BLOCK_SIZE, QAlignment(alignof_q(int)));
+    for(pointer_uint_q i = 0; i < NEW_BLOCKS_COUNT - 1U; ++i)
+        *(int*)allocator.Allocate() = i;
+
+    const pointer_uint_q EXPECTED_POOL_SIZE       = NEW_BLOCKS_COUNT * BLOCK_SIZE;
+    const pointer_uint_q EXPECTED_TOTAL_SIZE      = EXPECTED_POOL_SIZE + sizeof(void**) * NEW_BLOCKS_COUNT;
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = allocator.GetAllocatedBytes();
+
+    // [Execution]
+    allocator.Shrink(EXPECTED_POOL_SIZE);
+
+    // [Verification]
+    pointer_uint_q uTotalSize      = allocator.GetTotalSize();
+    pointer_uint_q uPoolSize       = allocator.GetPoolSize();
+    pointer_uint_q uAllocatedBytes = allocator.GetAllocatedBytes();
+
+    BOOST_CHECK_EQUAL(uTotalSize,      EXPECTED_TOTAL_SIZE);
+    BOOST_CHECK_EQUAL(uPoolSize,       EXPECTED_POOL_SIZE);
+    BOOST_CHECK_EQUAL(uAllocatedBytes, EXPECTED_ALLOCATED_BYTES);
+}
+
+/// <summary>
+/// Checks that only the free blocks that are kept can be allocated after shrinking, in the same order they would have been allocated before.
+/// </summary>
+QTEST_CASE( Shrink_OnlyRemainingFreeBlocksCanBeAllocatedAfterShrinking_Test )
+{
+    // [Preparation]
+    void* NULL_POINTER = null_q;
+    const pointer_uint_q BLOCK_SIZE = sizeof(int);
+    const pointer_uint_q BLOCKS_COUNT = 6;
+    const pointer_uint_q NEW_BLOCKS_COUNT = 4;
+    const pointer_uint_q POOL_SIZE = BLOCKS_COUNT * BLOCK_SIZE;
+    QPoolAllocator allocator(POOL_SIZE, BLOCK_SIZE, QAlignment(alignof_q(int)));
+    void* arBlocks[BLOCKS_COUNT];
+    for(pointer_uint_q i = 0; i < BLOCKS_COUNT; ++i)
+        arBlocks[i] = allocator.Allocate();
+
+    allocator.Deallocate(arBlocks[1]);
+    allocator.Deallocate(arBlocks[5]);
+    allocator.Deallocate(arBlocks[2]);
+    allocator.Deallocate(arBlocks[4]);
+
+    const pointer_uint_q EXPECTED_FIRST_OFFSET  = 2 * BLOCK_SIZE;
+    const pointer_uint_q EXPECTED_SECOND_OFFSET = 1 * BLOCK_SIZE;
+
+    // [Execution]
+    allocator.Shrink(NEW_BLOCKS_COUNT * BLOCK_SIZE);
+
+    // [Verification]
+    void* pFirstAllocation  = allocator.Allocate();
+    void* pSecondAllocation = allocator.Allocate();
+    void* pThirdAllocation  = allocator.Allocate();
+    pointer_uint_q uFirstOffset  = (pointer_uint_q)pFirstAllocation - (pointer_uint_q)allocator.GetPointer();
+    pointer_uint_q uSecondOffset = (pointer_uint_q)pSecondAllocation - (pointer_uint_q)allocator.GetPointer();
+
+    BOOST_CHECK_EQUAL(uFirstOffset,  EXPECTED_FIRST_OFFSET);
+    BOOST_CHECK_EQUAL(uSecondOffset, EXPECTED_SECOND_OFFSET);
+    BOOST_CHECK_EQUAL(pThirdAllocation, NULL_POINTER);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input size is not lower than the current pool size.
+/// </summary>
+QTEST_CASE( Shrink_AssertionFailsWhenInputSizeIsNotLowerThanCurrentPoolSize_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const pointer_uint_q BLOCK_SIZE = sizeof(int);
+    const pointer_uint_q BLOCKS_COUNT = 4;
+    const pointer_uint_q CURRENT_POOL_SIZE = BLOCKS_COUNT * BLOCK_SIZE;
+    QPoolAllocator allocator(CURRENT_POOL_SIZE, BLOCK_SIZE, QAlignment(alignof_q(int)));
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Shrink(CURRENT_POOL_SIZE);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input size is lower than the size of a block.
+/// </summary>
+QTEST_CASE( Shrink_AssertionFailsWhenInputSizeIsLowerThanBlockSize_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const pointer_uint_q BLOCK_SIZE = sizeof(int);
+    const pointer_uint_q BLOCKS_COUNT = 4;
+    const pointer_uint_q CURRENT_POOL_SIZE = BLOCKS_COUNT * BLOCK_SIZE;
+    QPoolAllocator allocator(CURRENT_POOL_SIZE, BLOCK_SIZE, QAlignment(alignof_q(int)));
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Shrink(BLOCK_SIZE - 1U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when there are allocated blocks beyond the new size.
+/// </summary>
+QTEST_CASE( Shrink_AssertionFailsWhenAllocatedBlocksLieBeyondNewSize_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const pointer_uint_q BLOCK_SIZE = sizeof(int);
+    const pointer_uint_q BLOCKS_COUNT = 4;
+    const pointer_uint_q CURRENT_POOL_SIZE = BLOCKS_COUNT * BLOCK_SIZE;
+    QPoolAllocator allocator(CURRENT_POOL_SIZE, BLOCK_SIZE, QAlignment(alignof_q(int)));
+    void* pFirstBlock = allocator.Allocate();
+    allocator.Allocate();
+    allocator.Allocate();
+    allocator.Deallocate(pFirstBlock);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Shrink(2 * BLOCK_SIZE);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that no memory is reserved for internals when the free list is intrusive.
+/// </summary>
+QTEST_CASE( Constructor4_TotalSizeEqualsPoolSizeWhenFreeListIsIntrusive_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = sizeof(void*) * 2U;
+    const pointer_uint_q POOL_SIZE = BLOCK_SIZE * 4U;
+    const pointer_uint_q EXPECTED_TOTAL_SIZE = POOL_SIZE;
+    const bool EXPECTED_INTRUSIVE = true;
+
+    // [Execution]
+    QPoolAllocator allocator(POOL_SIZE, BLOCK_SIZE, QAlignment(sizeof(void*)), true);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetTotalSize(), EXPECTED_TOTAL_SIZE);
+    BOOST_CHECK_EQUAL(allocator.IsFreeListIntrusive(), EXPECTED_INTRUSIVE);
+}
+
+/// <summary>
+/// Checks that a separate free list is used when a pointer does not fit in a block, even if the intrusive free list is requested.
+/// </summary>
+QTEST_CASE( Constructor4_FreeListIsNotIntrusiveWhenPointerDoesNotFitInBlock_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = sizeof(void*) / 2U;
+    const pointer_uint_q BLOCKS_COUNT = 4U;
+    const pointer_uint_q EXPECTED_TOTAL_SIZE = BLOCK_SIZE * BLOCKS_COUNT + sizeof(void**) * BLOCKS_COUNT;
+    const bool EXPECTED_INTRUSIVE = false;
+
+    // [Execution]
+    QPoolAllocator allocator(BLOCK_SIZE * BLOCKS_COUNT, BLOCK_SIZE, QAlignment(BLOCK_SIZE), true);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetTotalSize(), EXPECTED_TOTAL_SIZE);
+    BOOST_CHECK_EQUAL(allocator.IsFreeListIntrusive(), EXPECTED_INTRUSIVE);
+}
+
+/// <summary>
+/// Checks that all the blocks are allocated from the passed buffer when the free list is intrusive.
+/// </summary>
+QTEST_CASE( Constructor5_BlocksAreAllocatedFromPassedBufferWhenFreeListIsIntrusive_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = sizeof(void*) * 2U;
+    const pointer_uint_q BLOCKS_COUNT = 4U;
+    const pointer_uint_q POOL_SIZE = BLOCK_SIZE * BLOCKS_COUNT;
+    const pointer_uint_q EXPECTED_TOTAL_SIZE = POOL_SIZE;
+    const bool EXPECTED_INTRUSIVE = true;
+    void* pBuffer = malloc(POOL_SIZE);
+    const u8_q* pBufferBegin = scast_q(pBuffer, u8_q*);
+    const u8_q* pBufferEnd = pBufferBegin + POOL_SIZE;
+
+    // [Execution]
+    QPoolAllocator allocator(POOL_SIZE, BLOCK_SIZE, pBuffer, QAlignment(sizeof(void*)), true);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetTotalSize(), EXPECTED_TOTAL_SIZE);
+    BOOST_CHECK_EQUAL(allocator.IsFreeListIntrusive(), EXPECTED_INTRUSIVE);
+
+    for(pointer_uint_q i = 0; i < BLOCKS_COUNT; ++i)
+    {
+        const u8_q* pBlock = scast_q(allocator.Allocate(), u8_q*);
+        BOOST_CHECK(pBlock >= pBufferBegin && pBlock + BLOCK_SIZE <= pBufferEnd);
+    }
+
+    BOOST_CHECK(!allocator.CanAllocate());
+
+    // [Cleaning]
+    allocator.Clear();
+    free(pBuffer);
+}
+
+/// <summary>
+/// Checks that blocks are allocated in the same order whether the free list is intrusive or not.
+/// </summary>
+QTEST_CASE( Allocate_BlocksAreAllocatedInTheSameOrderWhenFreeListIsIntrusive_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = sizeof(void*);
+    const pointer_uint_q BLOCKS_COUNT = 6U;
+    const pointer_uint_q FREE_BLOCKS_COUNT = 4U;
+    QPoolAllocator allocator(BLOCK_SIZE * BLOCKS_COUNT, BLOCK_SIZE, QAlignment(sizeof(void*)));
+    QPoolAllocator intrusiveAllocator(BLOCK_SIZE * BLOCKS_COUNT, BLOCK_SIZE, QAlignment(sizeof(void*)), true);
+    void* arBlocks[BLOCKS_COUNT];
+    void* arIntrusiveBlocks[BLOCKS_COUNT];
+
+    for(pointer_uint_q i = 0; i < 4U; ++i)
+    {
+        arBlocks[i] = allocator.Allocate();
+        arIntrusiveBlocks[i] = intrusiveAllocator.Allocate();
+    }
+
+    allocator.Deallocate(arBlocks[2]);
+    allocator.Deallocate(arBlocks[0]);
+    intrusiveAllocator.Deallocate(arIntrusiveBlocks[2]);
+    intrusiveAllocator.Deallocate(arIntrusiveBlocks[0]);
+
+    // [Execution]
+    for(pointer_uint_q i = 0; i < FREE_BLOCKS_COUNT; ++i)
+    {
+        arBlocks[i] = allocator.Allocate();
+        arIntrusiveBlocks[i] = intrusiveAllocator.Allocate();
+    }
+
+    // [Verification]
+    for(pointer_uint_q i = 0; i < FREE_BLOCKS_COUNT; ++i)
+    {
+        pointer_uint_q uOffset = (pointer_uint_q)arBlocks[i] - (pointer_uint_q)allocator.GetPointer();
+        pointer_uint_q uIntrusiveOffset = (pointer_uint_q)arIntrusiveBlocks[i] - (pointer_uint_q)intrusiveAllocator.GetPointer();
+        BOOST_CHECK_EQUAL(uIntrusiveOffset, uOffset);
+    }
+
+    BOOST_CHECK_EQUAL(intrusiveAllocator.GetAllocatedBytes(), allocator.GetAllocatedBytes());
+    BOOST_CHECK_EQUAL(intrusiveAllocator.CanAllocate(), allocator.CanAllocate());
+}
+
+/// <summary>
+/// Checks that clearing the pool does not modify the content of the blocks when the free list is intrusive, and that they are allocated in ascending order.
+/// </summary>
+QTEST_CASE( Clear_BlocksAreNotModifiedWhenFreeListIsIntrusive_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = sizeof(void*);
+    const pointer_uint_q BLOCKS_COUNT = 4U;
+    const pointer_uint_q EXPECTED_VALUE = 12345U;
+    QPoolAllocator intrusiveAllocator(BLOCK_SIZE * BLOCKS_COUNT, BLOCK_SIZE, QAlignment(sizeof(void*)), true);
+
+    for(pointer_uint_q i = 0; i < BLOCKS_COUNT; ++i)
+        *(pointer_uint_q*)intrusiveAllocator.Allocate() = EXPECTED_VALUE + i;
+
+    // [Execution]
+    intrusiveAllocator.Clear();
+
+    // [Verification]
+    for(pointer_uint_q i = 0; i < BLOCKS_COUNT; ++i)
+    {
+        pointer_uint_q* pBlock = (pointer_uint_q*)intrusiveAllocator.Allocate();
+        BOOST_CHECK(pBlock == (pointer_uint_q*)intrusiveAllocator.GetPointer() + i);
+        BOOST_CHECK_EQUAL(*pBlock, EXPECTED_VALUE + i);
+    }
+}
+
+/// <summary>
+/// Checks that the free blocks and their order are copied to the destination when the free list is intrusive, and the extra blocks are allocated after them.
+/// </summary>
+QTEST_CASE( CopyTo_FreeBlocksAreCopiedWhenFreeListIsIntrusive_Test )
+{
+    // [Preparation]
+    void* NULL_POINTER = null_q;
+    const pointer_uint_q BLOCK_SIZE = sizeof(void*);
+    const pointer_uint_q EXPECTED_VALUE = 12345U;
+    QPoolAllocator source(BLOCK_SIZE * 4U, BLOCK_SIZE, QAlignment(sizeof(void*)), true);
+    QPoolAllocator destination(BLOCK_SIZE * 6U, BLOCK_SIZE, QAlignment(sizeof(void*)), true);
+    void* arBlocks[4];
+
+    for(pointer_uint_q i = 0; i < 4U; ++i)
+        arBlocks[i] = source.Allocate();
+
+    *(pointer_uint_q*)arBlocks[1] = EXPECTED_VALUE;
+    source.Deallocate(arBlocks[0]);
+    source.Deallocate(arBlocks[2]);
+
+    // [Execution]
+    source.CopyTo(destination);
+
+    // [Verification]
+    pointer_uint_q* pFirst = (pointer_uint_q*)destination.GetPointer();
+    BOOST_CHECK_EQUAL(destination.GetAllocatedBytes(), source.GetAllocatedBytes());
+    BOOST_CHECK_EQUAL(pFirst[1], EXPECTED_VALUE);
+    BOOST_CHECK(destination.Allocate() == pFirst + 2U);
+    BOOST_CHECK(destination.Allocate() == pFirst);
+    BOOST_CHECK(destination.Allocate() == pFirst + 4U);
+    BOOST_CHECK(destination.Allocate() == pFirst + 5U);
+    BOOST_CHECK_EQUAL(destination.Allocate(), NULL_POINTER);
+}
+
+/// <summary>
+/// Checks that the free blocks are kept and the new blocks can be allocated after reallocating when the free list is intrusive.
+/// </summary>
+QTEST_CASE( Reallocate1_FreeBlocksArePreservedWhenFreeListIsIntrusive_Test )
+{
+    // [Preparation]
+    void* NULL_POINTER = null_q;
+    const pointer_uint_q BLOCK_SIZE = sizeof(void*);
+    const pointer_uint_q EXPECTED_VALUE = 12345U;
+    const pointer_uint_q EXPECTED_TOTAL_SIZE = BLOCK_SIZE * 5U;
+    QPoolAllocator allocator(BLOCK_SIZE * 3U, BLOCK_SIZE, QAlignment(sizeof(void*)), true);
+    void* pFirstBlock = allocator.Allocate();
+    *(pointer_uint_q*)allocator.Allocate() = EXPECTED_VALUE;
+    allocator.Allocate();
+    allocator.Deallocate(pFirstBlock);
+
+    // [Execution]
+    allocator.Reallocate(EXPECTED_TOTAL_SIZE);
+
+    // [Verification]
+    pointer_uint_q* pFirst = (pointer_uint_q*)allocator.GetPointer();
+    BOOST_CHECK_EQUAL(allocator.GetTotalSize(), EXPECTED_TOTAL_SIZE);
+    BOOST_CHECK_EQUAL(pFirst[1], EXPECTED_VALUE);
+    BOOST_CHECK(allocator.Allocate() == pFirst);
+    BOOST_CHECK(allocator.Allocate() == pFirst + 3U);
+    BOOST_CHECK(allocator.Allocate() == pFirst + 4U);
+    BOOST_CHECK_EQUAL(allocator.Allocate(), NULL_POINTER);
+}
+
+/// <summary>
+/// Checks that only the free blocks that are kept can be allocated after shrinking when the free list is intrusive.
+/// </summary>
+QTEST_CASE( Shrink_OnlyRemainingFreeBlocksCanBeAllocatedWhenFreeListIsIntrusive_Test )
+{
+    // [Preparation]
+    void* NULL_POINTER = null_q;
+    const pointer_uint_q BLOCK_SIZE = sizeof(void*);
+    const pointer_uint_q BLOCKS_COUNT = 6U;
+    const pointer_uint_q NEW_BLOCKS_COUNT = 4U;
+    QPoolAllocator allocator(BLOCK_SIZE * BLOCKS_COUNT, BLOCK_SIZE, QAlignment(sizeof(void*)), true);
+    void* arBlocks[5];
+
+    for(pointer_uint_q i = 0; i < 5U; ++i)
+        arBlocks[i] = allocator.Allocate();
+
+    allocator.Deallocate(arBlocks[1]);
+    allocator.Deallocate(arBlocks[4]);
+    allocator.Deallocate(arBlocks[2]);
+
+    // [Execution]
+    allocator.Shrink(NEW_BLOCKS_COUNT * BLOCK_SIZE);
+
+    // [Verification]
+    pointer_uint_q* pFirst = (pointer_uint_q*)allocator.GetPointer();
+    BOOST_CHECK_EQUAL(allocator.GetTotalSize(), NEW_BLOCKS_COUNT * BLOCK_SIZE);
+    BOOST_CHECK(allocator.Allocate() == pFirst + 2U);
+    BOOST_CHECK(allocator.Allocate() == pFirst + 1U);
+    BOOST_CHECK_EQUAL(allocator.Allocate(), NULL_POINTER);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when there are allocated blocks beyond the new size and the free list is intrusive.
+/// </summary>
+QTEST_CASE( Shrink_AssertionFailsWhenAllocatedBlocksLieBeyondNewSizeAndFreeListIsIntrusive_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const pointer_uint_q BLOCK_SIZE = sizeof(void*);
+    QPoolAllocator allocator(BLOCK_SIZE * 4U, BLOCK_SIZE, QAlignment(sizeof(void*)), true);
+    void* pFirstBlock = allocator.Allocate();
+    allocator.Allocate();
+    allocator.Allocate();
+    allocator.Deallocate(pFirstBlock);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Shrink(2 * BLOCK_SIZE);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when only one of the allocators uses an intrusive free list.
+/// </summary>
+QTEST_CASE( CopyTo_AssertionFailsWhenOnlyOneFreeListIsIntrusive_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const pointer_uint_q BLOCK_SIZE = sizeof(void*);
+    QPoolAllocator source(BLOCK_SIZE * 4U, BLOCK_SIZE, QAlignment(sizeof(void*)), true);
+    QPoolAllocator destination(BLOCK_SIZE * 4U, BLOCK_SIZE, QAlignment(sizeof(void*)));
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        source.CopyTo(destination);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
 
 // End - Test Suite: QPoolAllocator
 QTEST_SUITE_END()
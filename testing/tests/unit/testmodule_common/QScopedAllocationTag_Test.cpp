@@ -0,0 +1,90 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QScopedAllocationTag.h"
+#include "SQAllocationTracker.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::Memory::SQAllocationTracker;
+using Kinesis::QuimeraEngine::Common::Memory::QScopedAllocationTag;
+
+
+QTEST_SUITE_BEGIN( QScopedAllocationTag_TestSuite )
+
+/// <summary>
+/// Checks that the tag becomes the current tag of the thread.
+/// </summary>
+QTEST_CASE( Constructor_TagBecomesTheCurrentTag_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_TAG = SQAllocationTracker::RegisterTag("QScopedAllocationTag_Constructor", "File.cpp", 10);
+
+    // [Execution]
+    QScopedAllocationTag scopedTag(EXPECTED_TAG);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(SQAllocationTracker::GetCurrentTag(), EXPECTED_TAG);
+}
+
+/// <summary>
+/// Checks that the previous tag becomes the current tag again when the instance is destroyed.
+/// </summary>
+QTEST_CASE( Destructor_PreviousTagIsRestored_Test )
+{
+    // [Preparation]
+    const u32_q OUTER_TAG = SQAllocationTracker::RegisterTag("QScopedAllocationTag_Destructor_Outer", "File.cpp", 10);
+    const u32_q INNER_TAG = SQAllocationTracker::RegisterTag("QScopedAllocationTag_Destructor_Inner", "File.cpp", 10);
+    const u32_q EXPECTED_TAG_AFTER_INNER = OUTER_TAG;
+    const u32_q EXPECTED_TAG_AFTER_OUTER = SQAllocationTracker::UNTAGGED;
+
+    u32_q uTagAfterInner = SQAllocationTracker::UNTAGGED;
+
+    // [Execution]
+    {
+        QScopedAllocationTag outerTag(OUTER_TAG);
+
+        {
+            QScopedAllocationTag innerTag(INNER_TAG);
+        }
+
+        uTagAfterInner = SQAllocationTracker::GetCurrentTag();
+    }
+
+    u32_q uTagAfterOuter = SQAllocationTracker::GetCurrentTag();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uTagAfterInner, EXPECTED_TAG_AFTER_INNER);
+    BOOST_CHECK_EQUAL(uTagAfterOuter, EXPECTED_TAG_AFTER_OUTER);
+}
+
+// End - Test Suite: QScopedAllocationTag
+QTEST_SUITE_END()
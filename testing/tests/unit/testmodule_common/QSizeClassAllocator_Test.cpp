@@ -0,0 +1,565 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QSizeClassAllocator.h"
+#include "QAlignment.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::Memory::QSizeClassAllocator;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+
+
+QTEST_SUITE_BEGIN( QSizeClassAllocator_TestSuite )
+
+/// <summary>
+/// Checks that the same instance is always returned.
+/// </summary>
+QTEST_CASE( Get_ReturnsAlwaysTheSameInstance_Test )
+{
+    // [Preparation]
+    QSizeClassAllocator* pExpectedInstance = QSizeClassAllocator::Get();
+
+    // [Execution]
+    QSizeClassAllocator* pInstance = QSizeClassAllocator::Get();
+
+    // [Verification]
+    BOOST_CHECK(pInstance == pExpectedInstance);
+    BOOST_CHECK(pInstance != null_q);
+}
+
+/// <summary>
+/// Checks that requests are rounded up to the size of their size class.
+/// </summary>
+QTEST_CASE( GetBlockSize_RequestsAreRoundedUpToTheirSizeClass_Test )
+{
+    // [Preparation]
+    const pointer_uint_q REQUESTS[]            = { 1U, 16U, 17U, 100U, 128U, 129U, 160U, 161U, 256U, 257U, 1000U, 32768U };
+    const pointer_uint_q EXPECTED_BLOCK_SIZES[] = { 16U, 16U, 32U, 112U, 128U, 160U, 160U, 192U, 256U, 320U, 1024U, 32768U };
+    const pointer_uint_q REQUESTS_COUNT = sizeof(REQUESTS) / sizeof(pointer_uint_q);
+
+    // [Execution]
+    pointer_uint_q arBlockSizes[REQUESTS_COUNT];
+
+    for(pointer_uint_q i = 0; i < REQUESTS_COUNT; ++i)
+        arBlockSizes[i] = QSizeClassAllocator::GetBlockSize(REQUESTS[i]);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arBlockSizes, arBlockSizes + REQUESTS_COUNT, EXPECTED_BLOCK_SIZES, EXPECTED_BLOCK_SIZES + REQUESTS_COUNT);
+}
+
+/// <summary>
+/// Checks that the block size of requests bigger than the maximum block size is not rounded.
+/// </summary>
+QTEST_CASE( GetBlockSize_BigRequestsAreNotRounded_Test )
+{
+    // [Preparation]
+    const pointer_uint_q REQUEST = QSizeClassAllocator::MAX_BLOCK_SIZE + 1U;
+    const pointer_uint_q EXPECTED_BLOCK_SIZE = REQUEST;
+
+    // [Execution]
+    pointer_uint_q uBlockSize = QSizeClassAllocator::GetBlockSize(REQUEST);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uBlockSize, EXPECTED_BLOCK_SIZE);
+}
+
+/// <summary>
+/// Checks that the returned blocks are aligned to the block alignment, whatever their size.
+/// </summary>
+QTEST_CASE( Allocate1_BlocksAreAlignedToBlockAlignment_Test )
+{
+    // [Preparation]
+    const pointer_uint_q SIZES[] = { 1U, 24U, 100U, 200U, 3000U, 32768U };
+    const pointer_uint_q SIZES_COUNT = sizeof(SIZES) / sizeof(pointer_uint_q);
+    const pointer_uint_q EXPECTED_REMAINDER = 0;
+    QSizeClassAllocator allocator;
+
+    // [Execution]
+    void* arBlocks[SIZES_COUNT];
+
+    for(pointer_uint_q i = 0; i < SIZES_COUNT; ++i)
+        arBlocks[i] = allocator.Allocate(SIZES[i]);
+
+    // [Verification]
+    for(pointer_uint_q i = 0; i < SIZES_COUNT; ++i)
+    {
+        BOOST_CHECK_EQUAL(rcast_q(arBlocks[i], pointer_uint_q) % QSizeClassAllocator::BLOCK_ALIGNMENT, EXPECTED_REMAINDER);
+        allocator.Deallocate(arBlocks[i]);
+    }
+}
+
+/// <summary>
+/// Checks that blocks of the same size class are allocated from the same slab.
+/// </summary>
+QTEST_CASE( Allocate1_BlocksOfTheSameSizeClassShareTheSlab_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_SLABS_COUNT = 1U;
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 64U;
+    QSizeClassAllocator allocator;
+
+    // [Execution]
+    void* pBlock1 = allocator.Allocate(20U);
+    void* pBlock2 = allocator.Allocate(30U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetSlabsCount(), EXPECTED_SLABS_COUNT);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK(pBlock1 != pBlock2);
+
+    // [Cleaning]
+    allocator.Deallocate(pBlock1);
+    allocator.Deallocate(pBlock2);
+}
+
+/// <summary>
+/// Checks that blocks of different size classes are allocated from different slabs.
+/// </summary>
+QTEST_CASE( Allocate1_BlocksOfDifferentSizeClassesUseDifferentSlabs_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_SLABS_COUNT = 2U;
+    QSizeClassAllocator allocator;
+
+    // [Execution]
+    void* pBlock1 = allocator.Allocate(16U);
+    void* pBlock2 = allocator.Allocate(17U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetSlabsCount(), EXPECTED_SLABS_COUNT);
+
+    // [Cleaning]
+    allocator.Deallocate(pBlock1);
+    allocator.Deallocate(pBlock2);
+}
+
+/// <summary>
+/// Checks that a new slab is created when all the blocks of the existing slab are in use.
+/// </summary>
+QTEST_CASE( Allocate1_NewSlabIsCreatedWhenSlabIsFull_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = QSizeClassAllocator::MAX_BLOCK_SIZE;
+    const pointer_uint_q BLOCKS_PER_SLAB = QSizeClassAllocator::MIN_BLOCKS_PER_SLAB;
+    const pointer_uint_q EXPECTED_SLABS_COUNT_BEFORE = 1U;
+    const pointer_uint_q EXPECTED_SLABS_COUNT_AFTER = 2U;
+    QSizeClassAllocator allocator;
+
+    void* arBlocks[BLOCKS_PER_SLAB + 1U];
+
+    for(pointer_uint_q i = 0; i < BLOCKS_PER_SLAB; ++i)
+        arBlocks[i] = allocator.Allocate(BLOCK_SIZE);
+
+    const pointer_uint_q SLABS_COUNT_BEFORE = allocator.GetSlabsCount();
+
+    // [Execution]
+    arBlocks[BLOCKS_PER_SLAB] = allocator.Allocate(BLOCK_SIZE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(SLABS_COUNT_BEFORE, EXPECTED_SLABS_COUNT_BEFORE);
+    BOOST_CHECK_EQUAL(allocator.GetSlabsCount(), EXPECTED_SLABS_COUNT_AFTER);
+
+    // [Cleaning]
+    for(pointer_uint_q i = 0; i < BLOCKS_PER_SLAB + 1U; ++i)
+        allocator.Deallocate(arBlocks[i]);
+}
+
+/// <summary>
+/// Checks that blocks bigger than the maximum block size are not allocated from slabs.
+/// </summary>
+QTEST_CASE( Allocate1_BigBlocksAreNotAllocatedFromSlabs_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = QSizeClassAllocator::MAX_BLOCK_SIZE + 1U;
+    const pointer_uint_q EXPECTED_SLABS_COUNT = 0;
+    QSizeClassAllocator allocator;
+
+    // [Execution]
+    void* pBlock = allocator.Allocate(BLOCK_SIZE);
+
+    // [Verification]
+    BOOST_CHECK(pBlock != null_q);
+    BOOST_CHECK_EQUAL(allocator.GetSlabsCount(), EXPECTED_SLABS_COUNT);
+
+    // [Cleaning]
+    allocator.Deallocate(pBlock);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the size is zero.
+/// </summary>
+QTEST_CASE( Allocate1_AssertionFailsWhenSizeIsZero_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QSizeClassAllocator allocator;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Allocate(0);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that blocks whose alignment is not bigger than the block alignment are allocated from slabs.
+/// </summary>
+QTEST_CASE( Allocate2_BlocksWithSmallAlignmentAreAllocatedFromSlabs_Test )
+{
+    // [Preparation]
+    const QAlignment ALIGNMENT(QSizeClassAllocator::BLOCK_ALIGNMENT);
+    const pointer_uint_q EXPECTED_SLABS_COUNT = 1U;
+    const pointer_uint_q EXPECTED_REMAINDER = 0;
+    QSizeClassAllocator allocator;
+
+    // [Execution]
+    void* pBlock = allocator.Allocate(40U, ALIGNMENT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetSlabsCount(), EXPECTED_SLABS_COUNT);
+    BOOST_CHECK_EQUAL(rcast_q(pBlock, pointer_uint_q) % ALIGNMENT, EXPECTED_REMAINDER);
+
+    // [Cleaning]
+    allocator.Deallocate(pBlock, ALIGNMENT);
+}
+
+/// <summary>
+/// Checks that blocks whose alignment is bigger than the block alignment are not allocated from slabs, and are correctly aligned.
+/// </summary>
+QTEST_CASE( Allocate2_BlocksWithBigAlignmentAreNotAllocatedFromSlabs_Test )
+{
+    // [Preparation]
+    const QAlignment ALIGNMENT(QSizeClassAllocator::BLOCK_ALIGNMENT * 4U);
+    const pointer_uint_q EXPECTED_SLABS_COUNT = 0;
+    const pointer_uint_q EXPECTED_REMAINDER = 0;
+    QSizeClassAllocator allocator;
+
+    // [Execution]
+    void* pBlock = allocator.Allocate(40U, ALIGNMENT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetSlabsCount(), EXPECTED_SLABS_COUNT);
+    BOOST_CHECK_EQUAL(rcast_q(pBlock, pointer_uint_q) % ALIGNMENT, EXPECTED_REMAINDER);
+
+    // [Cleaning]
+    allocator.Deallocate(pBlock, ALIGNMENT);
+}
+
+/// <summary>
+/// Checks that a deallocated block is returned again by the next allocation of the same size class.
+/// </summary>
+QTEST_CASE( Deallocate1_DeallocatedBlockIsReused_Test )
+{
+    // [Preparation]
+    QSizeClassAllocator allocator;
+    void* pExpectedBlock = allocator.Allocate(48U);
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 0;
+
+    // [Execution]
+    allocator.Deallocate(pExpectedBlock);
+    const pointer_uint_q ALLOCATED_BYTES = allocator.GetAllocatedBytes();
+    void* pBlock = allocator.Allocate(40U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(ALLOCATED_BYTES, EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK(pBlock == pExpectedBlock);
+
+    // [Cleaning]
+    allocator.Deallocate(pBlock);
+}
+
+/// <summary>
+/// Checks that nothing happens when the block is null.
+/// </summary>
+QTEST_CASE( Deallocate1_NothingHappensWhenBlockIsNull_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = false;
+    QSizeClassAllocator allocator;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Deallocate(null_q);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that a block is returned to its slab, and that the slab is used to allocate when the other slabs of the size class are full.
+/// </summary>
+QTEST_CASE( Deallocate1_BlockIsReturnedToItsSlab_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = QSizeClassAllocator::MAX_BLOCK_SIZE;
+    const pointer_uint_q BLOCKS_COUNT = QSizeClassAllocator::MIN_BLOCKS_PER_SLAB * 2U;
+    QSizeClassAllocator allocator;
+
+    void* arBlocks[BLOCKS_COUNT];
+
+    for(pointer_uint_q i = 0; i < BLOCKS_COUNT; ++i)
+        arBlocks[i] = allocator.Allocate(BLOCK_SIZE);
+
+    void* pExpectedBlock = arBlocks[0];
+
+    // [Execution]
+    allocator.Deallocate(arBlocks[0]);
+    arBlocks[0] = allocator.Allocate(BLOCK_SIZE);
+
+    // [Verification]
+    BOOST_CHECK(arBlocks[0] == pExpectedBlock);
+
+    // [Cleaning]
+    for(pointer_uint_q i = 0; i < BLOCKS_COUNT; ++i)
+        allocator.Deallocate(arBlocks[i]);
+}
+
+/// <summary>
+/// Checks that the free blocks of all the slabs of a size class are used before creating a new slab.
+/// </summary>
+QTEST_CASE( Deallocate1_FreeBlocksOfAllTheSlabsAreUsedBeforeCreatingNewSlabs_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = QSizeClassAllocator::MAX_BLOCK_SIZE;
+    const pointer_uint_q BLOCKS_PER_SLAB = QSizeClassAllocator::MIN_BLOCKS_PER_SLAB;
+    const pointer_uint_q BLOCKS_COUNT = BLOCKS_PER_SLAB * 3U;
+    const pointer_uint_q EXPECTED_SLABS_COUNT = 3U;
+    QSizeClassAllocator allocator;
+
+    void* arBlocks[BLOCKS_COUNT];
+
+    for(pointer_uint_q i = 0; i < BLOCKS_COUNT; ++i)
+        arBlocks[i] = allocator.Allocate(BLOCK_SIZE);
+
+    // One block of every slab is freed
+    void* pExpectedBlock1 = arBlocks[0];
+    void* pExpectedBlock2 = arBlocks[BLOCKS_PER_SLAB];
+    void* pExpectedBlock3 = arBlocks[BLOCKS_PER_SLAB * 2U];
+    allocator.Deallocate(pExpectedBlock1);
+    allocator.Deallocate(pExpectedBlock2);
+    allocator.Deallocate(pExpectedBlock3);
+
+    // [Execution]
+    arBlocks[0] = allocator.Allocate(BLOCK_SIZE);
+    arBlocks[BLOCKS_PER_SLAB] = allocator.Allocate(BLOCK_SIZE);
+    arBlocks[BLOCKS_PER_SLAB * 2U] = allocator.Allocate(BLOCK_SIZE);
+
+    // [Verification]
+    const bool BLOCK1_REUSED = arBlocks[0] == pExpectedBlock1 || arBlocks[BLOCKS_PER_SLAB] == pExpectedBlock1 || arBlocks[BLOCKS_PER_SLAB * 2U] == pExpectedBlock1;
+    const bool BLOCK2_REUSED = arBlocks[0] == pExpectedBlock2 || arBlocks[BLOCKS_PER_SLAB] == pExpectedBlock2 || arBlocks[BLOCKS_PER_SLAB * 2U] == pExpectedBlock2;
+    const bool BLOCK3_REUSED = arBlocks[0] == pExpectedBlock3 || arBlocks[BLOCKS_PER_SLAB] == pExpectedBlock3 || arBlocks[BLOCKS_PER_SLAB * 2U] == pExpectedBlock3;
+    BOOST_CHECK(BLOCK1_REUSED);
+    BOOST_CHECK(BLOCK2_REUSED);
+    BOOST_CHECK(BLOCK3_REUSED);
+    BOOST_CHECK_EQUAL(allocator.GetSlabsCount(), EXPECTED_SLABS_COUNT);
+
+    // [Cleaning]
+    for(pointer_uint_q i = 0; i < BLOCKS_COUNT; ++i)
+        allocator.Deallocate(arBlocks[i]);
+}
+
+/// <summary>
+/// Checks that a block allocated with an alignment is returned to its slab when it is deallocated with the same alignment.
+/// </summary>
+QTEST_CASE( Deallocate2_BlockIsReturnedToItsSlab_Test )
+{
+    // [Preparation]
+    const QAlignment ALIGNMENT(QSizeClassAllocator::BLOCK_ALIGNMENT);
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 0;
+    QSizeClassAllocator allocator;
+    void* pBlock = allocator.Allocate(40U, ALIGNMENT);
+
+    // [Execution]
+    allocator.Deallocate(pBlock, ALIGNMENT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the block is not aligned to the given alignment.
+/// </summary>
+QTEST_CASE( Deallocate2_AssertionFailsWhenBlockIsNotAlignedToAlignment_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const QAlignment ALIGNMENT(QSizeClassAllocator::BLOCK_ALIGNMENT * 4U);
+    QSizeClassAllocator allocator;
+    void* pBlock = allocator.Allocate(40U, ALIGNMENT);
+    void* pMisalignedBlock = rcast_q(rcast_q(pBlock, pointer_uint_q) + QSizeClassAllocator::BLOCK_ALIGNMENT, void*);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Deallocate(pMisalignedBlock, ALIGNMENT);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+
+    // [Cleaning]
+    allocator.Deallocate(pBlock, ALIGNMENT);
+}
+
+#endif
+
+/// <summary>
+/// Checks that only the slabs with no blocks in use are released.
+/// </summary>
+QTEST_CASE( ReleaseEmptySlabs_OnlySlabsWithoutBlocksInUseAreReleased_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_SLABS_COUNT = 1U;
+    QSizeClassAllocator allocator;
+    void* pBlock1 = allocator.Allocate(16U);
+    void* pBlock2 = allocator.Allocate(64U);
+    void* pBlock3 = allocator.Allocate(1024U);
+    allocator.Deallocate(pBlock1);
+    allocator.Deallocate(pBlock3);
+
+    // [Execution]
+    allocator.ReleaseEmptySlabs();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetSlabsCount(), EXPECTED_SLABS_COUNT);
+    BOOST_CHECK_EQUAL(allocator.GetReservedBytes(), QSizeClassAllocator::SLAB_SIZE);
+
+    // [Cleaning]
+    allocator.Deallocate(pBlock2);
+}
+
+/// <summary>
+/// Checks that the size classes whose slabs were released can allocate again.
+/// </summary>
+QTEST_CASE( ReleaseEmptySlabs_SizeClassesCanAllocateAfterReleasingTheirSlabs_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_SLABS_COUNT = 1U;
+    QSizeClassAllocator allocator;
+    allocator.Deallocate(allocator.Allocate(16U));
+    allocator.ReleaseEmptySlabs();
+
+    // [Execution]
+    void* pBlock = allocator.Allocate(16U);
+
+    // [Verification]
+    BOOST_CHECK(pBlock != null_q);
+    BOOST_CHECK_EQUAL(allocator.GetSlabsCount(), EXPECTED_SLABS_COUNT);
+
+    // [Cleaning]
+    allocator.Deallocate(pBlock);
+}
+
+/// <summary>
+/// Checks that the reserved bytes are the sum of the sizes of all the slabs.
+/// </summary>
+QTEST_CASE( GetReservedBytes_ReturnsTheSizeOfAllTheSlabs_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_RESERVED_BYTES = QSizeClassAllocator::SLAB_SIZE * 2U + 
+                                                   QSizeClassAllocator::MAX_BLOCK_SIZE * QSizeClassAllocator::MIN_BLOCKS_PER_SLAB;
+    QSizeClassAllocator allocator;
+    void* pBlock1 = allocator.Allocate(16U);
+    void* pBlock2 = allocator.Allocate(64U);
+    void* pBlock3 = allocator.Allocate(QSizeClassAllocator::MAX_BLOCK_SIZE);
+
+    // [Execution]
+    pointer_uint_q uReservedBytes = allocator.GetReservedBytes();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uReservedBytes, EXPECTED_RESERVED_BYTES);
+
+    // [Cleaning]
+    allocator.Deallocate(pBlock1);
+    allocator.Deallocate(pBlock2);
+    allocator.Deallocate(pBlock3);
+}
+
+/// <summary>
+/// Checks that the allocated bytes are the sum of the sizes of the blocks in use, rounded up to their size class.
+/// </summary>
+QTEST_CASE( GetAllocatedBytes_ReturnsTheSizeOfTheBlocksInUse_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 16U + 160U + 2560U;
+    QSizeClassAllocator allocator;
+    void* pBlock1 = allocator.Allocate(10U);
+    void* pBlock2 = allocator.Allocate(150U);
+    void* pBlock3 = allocator.Allocate(2500U);
+    void* pBigBlock = allocator.Allocate(QSizeClassAllocator::MAX_BLOCK_SIZE * 2U);
+
+    // [Execution]
+    pointer_uint_q uAllocatedBytes = allocator.GetAllocatedBytes();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uAllocatedBytes, EXPECTED_ALLOCATED_BYTES);
+
+    // [Cleaning]
+    allocator.Deallocate(pBlock1);
+    allocator.Deallocate(pBlock2);
+    allocator.Deallocate(pBlock3);
+    allocator.Deallocate(pBigBlock);
+}
+
+// End - Test Suite: QSizeClassAllocator
+QTEST_SUITE_END()
@@ -9203,6 +9203,163 @@ QTEST_CASE ( GetInternalBuffer_ReturnedBufferIsNotNullWhenStringIsEmpty_Test )
     BOOST_CHECK(szCharacters != null_q);
 }
 
+/// <summary>
+/// Checks that equal strings have the same hash, even if they were built in different ways.
+/// </summary>
+QTEST_CASE ( GetHash_EqualStringsHaveSameHash_Test )
+{
+    // [Preparation]
+    const QStringUnicode STRING_A("abcdefghijklmnopqrstuvwxyz");
+    QStringUnicode strB("abcdefghijklm");
+    strB.Append("nopqrstuvwxyz");
+
+	// [Execution]
+    u64_q uHashA = STRING_A.GetHash();
+    u64_q uHashB = strB.GetHash();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHashA, uHashB);
+}
+
+/// <summary>
+/// Checks that strings that differ in only one character have different hashes.
+/// </summary>
+QTEST_CASE ( GetHash_DifferentStringsHaveDifferentHashes_Test )
+{
+    // [Preparation]
+    const QStringUnicode STRING_A("abcdefghijklmnopqrstuvwxyz");
+    const QStringUnicode STRING_B("abcdefghijklmnopqrstuvwxyZ");
+    const QStringUnicode STRING_C("");
+
+	// [Execution]
+    u64_q uHashA = STRING_A.GetHash();
+    u64_q uHashB = STRING_B.GetHash();
+    u64_q uHashC = STRING_C.GetHash();
+
+    // [Verification]
+    BOOST_CHECK(uHashA != uHashB);
+    BOOST_CHECK(uHashA != uHashC);
+}
+
+/// <summary>
+/// Checks that the hash is calculated again when the string is modified by appending text.
+/// </summary>
+QTEST_CASE ( GetHash_HashChangesWhenTextIsAppended_Test )
+{
+    // [Preparation]
+    const QStringUnicode EXPECTED_STRING("abc123");
+    QStringUnicode strString("abc");
+    strString.GetHash();
+
+	// [Execution]
+    strString.Append(123U);
+    u64_q uHash = strString.GetHash();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHash, EXPECTED_STRING.GetHash());
+}
+
+/// <summary>
+/// Checks that the hash is calculated again when a pattern of the string is replaced.
+/// </summary>
+QTEST_CASE ( GetHash_HashChangesWhenTextIsReplaced_Test )
+{
+    // [Preparation]
+    const QStringUnicode EXPECTED_STRING("aXc");
+    QStringUnicode strString("abc");
+    strString.GetHash();
+
+	// [Execution]
+    strString.Replace("b", "X");
+    u64_q uHash = strString.GetHash();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHash, EXPECTED_STRING.GetHash());
+}
+
+/// <summary>
+/// Checks that the hash is calculated again when the string is normalized.
+/// </summary>
+QTEST_CASE ( GetHash_HashChangesWhenStringIsNormalized_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::EQNormalizationForm;
+
+    // [Preparation]
+    const u16_q DECOMPOSED_CHARACTERS[] = { 'e', 0x0301 }; // e + combining acute accent
+    const u16_q COMPOSED_CHARACTERS[] = { 0x00E9 };       // e with acute accent
+    QStringUnicode strString(rcast_q(DECOMPOSED_CHARACTERS, const i8_q*), sizeof(DECOMPOSED_CHARACTERS), string_q::GetLocalEncodingUTF16());
+    const QStringUnicode EXPECTED_STRING(rcast_q(COMPOSED_CHARACTERS, const i8_q*), sizeof(COMPOSED_CHARACTERS), string_q::GetLocalEncodingUTF16());
+    strString.GetHash();
+
+	// [Execution]
+    strString.Normalize(EQNormalizationForm::E_C);
+    u64_q uHash = strString.GetHash();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHash, EXPECTED_STRING.GetHash());
+}
+
+/// <summary>
+/// Checks that the hash is calculated again when a character is changed using an iterator.
+/// </summary>
+QTEST_CASE ( GetHash_HashChangesWhenCharacterIsSetUsingIterator_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::QCharUnicode;
+
+    // [Preparation]
+    const QStringUnicode EXPECTED_STRING("Xbc");
+    QStringUnicode strString("abc");
+    strString.GetHash();
+
+	// [Execution]
+    QStringUnicode::QCharIterator it = strString.GetCharIterator();
+    it.SetChar(QCharUnicode('X'));
+    u64_q uHash = strString.GetHash();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHash, EXPECTED_STRING.GetHash());
+}
+
+/// <summary>
+/// Checks that the hash of the assigned string is used after an assignment.
+/// </summary>
+QTEST_CASE ( GetHash_HashChangesWhenStringIsAssigned_Test )
+{
+    // [Preparation]
+    const QStringUnicode EXPECTED_STRING("def");
+    QStringUnicode strString("abc");
+    strString.GetHash();
+
+	// [Execution]
+    strString = EXPECTED_STRING;
+    u64_q uHash = strString.GetHash();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHash, QStringUnicode("def").GetHash());
+}
+
+/// <summary>
+/// Checks that strings obtained by converting the case of another string do not keep the hash of the original string.
+/// </summary>
+QTEST_CASE ( GetHash_CaseConversionsDoNotKeepTheHashOfOriginalString_Test )
+{
+    // [Preparation]
+    const QStringUnicode EXPECTED_UPPER_CASE("ABC");
+    const QStringUnicode EXPECTED_LOWER_CASE("abc");
+    const QStringUnicode ORIGINAL_STRING("aBc");
+    ORIGINAL_STRING.GetHash();
+
+	// [Execution]
+    u64_q uUpperCaseHash = ORIGINAL_STRING.ToUpperCase().GetHash();
+    u64_q uLowerCaseHash = ORIGINAL_STRING.ToLowerCase().GetHash();
+    u64_q uFoldedCaseHash = ORIGINAL_STRING.ToCaseFolded().GetHash();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uUpperCaseHash, EXPECTED_UPPER_CASE.GetHash());
+    BOOST_CHECK_EQUAL(uLowerCaseHash, EXPECTED_LOWER_CASE.GetHash());
+    BOOST_CHECK_EQUAL(uFoldedCaseHash, EXPECTED_LOWER_CASE.GetHash());
+}
+
 /// <summary>
 /// Checks that it's an empty string, a string whose length is zero.
 /// </summary>
@@ -0,0 +1,364 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "SQAllocationTracker.h"
+#include "QAllocationSnapshot.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::i64_q;
+using Kinesis::QuimeraEngine::Common::Memory::SQAllocationTracker;
+using Kinesis::QuimeraEngine::Common::Memory::QAllocationSnapshot;
+
+
+QTEST_SUITE_BEGIN( SQAllocationTracker_TestSuite )
+
+/// <summary>
+/// Checks that the same identifier is returned when a tag is registered twice.
+/// </summary>
+QTEST_CASE( RegisterTag_SameIdentifierIsReturnedForTheSameTag_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_TAG = SQAllocationTracker::RegisterTag("RegisterTag_SameTag", "File.cpp", 10);
+
+    // [Execution]
+    u32_q uTag = SQAllocationTracker::RegisterTag("RegisterTag_SameTag", "File.cpp", 10);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uTag, EXPECTED_TAG);
+    BOOST_CHECK(uTag != SQAllocationTracker::UNTAGGED);
+}
+
+/// <summary>
+/// Checks that different identifiers are returned when the name, the file or the line of the tags are different.
+/// </summary>
+QTEST_CASE( RegisterTag_DifferentIdentifiersAreReturnedForDifferentTags_Test )
+{
+    // [Preparation]
+    const u32_q TAG = SQAllocationTracker::RegisterTag("RegisterTag_DifferentTags", "File.cpp", 10);
+
+    // [Execution]
+    u32_q uTagWithDifferentName = SQAllocationTracker::RegisterTag("RegisterTag_DifferentTags2", "File.cpp", 10);
+    u32_q uTagWithDifferentFile = SQAllocationTracker::RegisterTag("RegisterTag_DifferentTags", "File2.cpp", 10);
+    u32_q uTagWithDifferentLine = SQAllocationTracker::RegisterTag("RegisterTag_DifferentTags", "File.cpp", 11);
+
+    // [Verification]
+    BOOST_CHECK(uTagWithDifferentName != TAG);
+    BOOST_CHECK(uTagWithDifferentFile != TAG);
+    BOOST_CHECK(uTagWithDifferentLine != TAG);
+    BOOST_CHECK(uTagWithDifferentName != uTagWithDifferentFile);
+    BOOST_CHECK(uTagWithDifferentName != uTagWithDifferentLine);
+    BOOST_CHECK(uTagWithDifferentFile != uTagWithDifferentLine);
+}
+
+/// <summary>
+/// Checks that the registered tags appear in the snapshots with their name, file and line.
+/// </summary>
+QTEST_CASE( RegisterTag_TagAppearsInSnapshots_Test )
+{
+    // [Preparation]
+    const char* EXPECTED_NAME = "RegisterTag_TagAppearsInSnapshots";
+    const char* EXPECTED_FILE = "File.cpp";
+    const int EXPECTED_LINE = 25;
+
+    // [Execution]
+    u32_q uTag = SQAllocationTracker::RegisterTag(EXPECTED_NAME, EXPECTED_FILE, EXPECTED_LINE);
+
+    // [Verification]
+    QAllocationSnapshot snapshot = SQAllocationTracker::TakeSnapshot();
+    BOOST_CHECK(uTag < snapshot.GetTagsCount());
+    BOOST_CHECK_EQUAL(snapshot.GetTagName(uTag), EXPECTED_NAME);
+    BOOST_CHECK_EQUAL(snapshot.GetTagFile(uTag), EXPECTED_FILE);
+    BOOST_CHECK_EQUAL(snapshot.GetTagLine(uTag), EXPECTED_LINE);
+}
+
+/// <summary>
+/// Checks that the current tag is the untagged group by default.
+/// </summary>
+QTEST_CASE( GetCurrentTag_UntaggedByDefault_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_TAG = SQAllocationTracker::UNTAGGED;
+
+    // [Execution]
+    u32_q uTag = SQAllocationTracker::GetCurrentTag();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uTag, EXPECTED_TAG);
+}
+
+/// <summary>
+/// Checks that the current tag is changed.
+/// </summary>
+QTEST_CASE( SetCurrentTag_CurrentTagIsChanged_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_TAG = SQAllocationTracker::RegisterTag("SetCurrentTag_CurrentTagIsChanged", "File.cpp", 10);
+
+    // [Execution]
+    SQAllocationTracker::SetCurrentTag(EXPECTED_TAG);
+    u32_q uTag = SQAllocationTracker::GetCurrentTag();
+    SQAllocationTracker::SetCurrentTag(SQAllocationTracker::UNTAGGED);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uTag, EXPECTED_TAG);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the tag is not registered.
+/// </summary>
+QTEST_CASE( SetCurrentTag_AssertionFailsWhenTagIsNotRegistered_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const u32_q NOT_REGISTERED_TAG = SQAllocationTracker::MAX_TAGS;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQAllocationTracker::SetCurrentTag(NOT_REGISTERED_TAG);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the high-water mark of a tag is zero unless it is enabled, while the rest of counters are updated.
+/// </summary>
+QTEST_CASE( EnableHighWaterMark_HighWaterMarkIsZeroWhenNotEnabled_Test )
+{
+    // [Preparation]
+    const u32_q TAG = SQAllocationTracker::RegisterTag("EnableHighWaterMark_HighWaterMarkIsZero", "File.cpp", 10);
+    const i64_q EXPECTED_LIVE_BYTES = 100;
+    const u64_q EXPECTED_HIGH_WATER_MARK = 0;
+
+    // [Execution]
+    SQAllocationTracker::NotifyAllocation(TAG, 100U);
+
+    // [Verification]
+    QAllocationSnapshot snapshot = SQAllocationTracker::TakeSnapshot();
+    BOOST_CHECK_EQUAL(snapshot.GetLiveBytes(TAG), EXPECTED_LIVE_BYTES);
+    BOOST_CHECK_EQUAL(snapshot.GetHighWaterMark(TAG), EXPECTED_HIGH_WATER_MARK);
+
+    // [Cleaning]
+    SQAllocationTracker::NotifyDeallocation(TAG, 100U);
+}
+
+/// <summary>
+/// Checks that the blocks allocated before the high-water mark is enabled are not counted in it.
+/// </summary>
+QTEST_CASE( EnableHighWaterMark_PreviousAllocationsAreNotCounted_Test )
+{
+    // [Preparation]
+    const u32_q TAG = SQAllocationTracker::RegisterTag("EnableHighWaterMark_PreviousAllocationsAreNotCounted", "File.cpp", 10);
+    const i64_q EXPECTED_LIVE_BYTES = 100 + 20;
+    const u64_q EXPECTED_HIGH_WATER_MARK = 20U;
+    SQAllocationTracker::NotifyAllocation(TAG, 100U);
+
+    // [Execution]
+    SQAllocationTracker::EnableHighWaterMark(TAG);
+    SQAllocationTracker::NotifyAllocation(TAG, 20U);
+
+    // [Verification]
+    QAllocationSnapshot snapshot = SQAllocationTracker::TakeSnapshot();
+    BOOST_CHECK_EQUAL(snapshot.GetLiveBytes(TAG), EXPECTED_LIVE_BYTES);
+    BOOST_CHECK_EQUAL(snapshot.GetHighWaterMark(TAG), EXPECTED_HIGH_WATER_MARK);
+
+    // [Cleaning]
+    SQAllocationTracker::NotifyDeallocation(TAG, 100U);
+    SQAllocationTracker::NotifyDeallocation(TAG, 20U);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the tag is not registered.
+/// </summary>
+QTEST_CASE( EnableHighWaterMark_AssertionFailsWhenTagIsNotRegistered_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const u32_q NOT_REGISTERED_TAG = SQAllocationTracker::MAX_TAGS;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQAllocationTracker::EnableHighWaterMark(NOT_REGISTERED_TAG);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that allocations update all the counters of the tag.
+/// </summary>
+QTEST_CASE( NotifyAllocation_CountersOfTheTagAreUpdated_Test )
+{
+    // [Preparation]
+    const u32_q TAG = SQAllocationTracker::RegisterTag("NotifyAllocation_CountersAreUpdated", "File.cpp", 10);
+    SQAllocationTracker::EnableHighWaterMark(TAG);
+    const i64_q EXPECTED_LIVE_BYTES = 100 + 20;
+    const u64_q EXPECTED_HIGH_WATER_MARK = 120U;
+    const u64_q EXPECTED_ALLOCATIONS = 2U;
+    const u64_q EXPECTED_DEALLOCATIONS = 0;
+    const u64_q EXPECTED_ALLOCATED_BYTES = 120U;
+    const u64_q EXPECTED_HISTOGRAM_COUNT = 1U;
+
+    // [Execution]
+    SQAllocationTracker::NotifyAllocation(TAG, 100U);
+    SQAllocationTracker::NotifyAllocation(TAG, 20U);
+
+    // [Verification]
+    QAllocationSnapshot snapshot = SQAllocationTracker::TakeSnapshot();
+    BOOST_CHECK_EQUAL(snapshot.GetLiveBytes(TAG), EXPECTED_LIVE_BYTES);
+    BOOST_CHECK_EQUAL(snapshot.GetHighWaterMark(TAG), EXPECTED_HIGH_WATER_MARK);
+    BOOST_CHECK_EQUAL(snapshot.GetAllocations(TAG), EXPECTED_ALLOCATIONS);
+    BOOST_CHECK_EQUAL(snapshot.GetDeallocations(TAG), EXPECTED_DEALLOCATIONS);
+    BOOST_CHECK_EQUAL(snapshot.GetAllocatedBytes(TAG), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(snapshot.GetHistogramCount(TAG, SQAllocationTracker::GetHistogramBucket(100U)), EXPECTED_HISTOGRAM_COUNT);
+    BOOST_CHECK_EQUAL(snapshot.GetHistogramCount(TAG, SQAllocationTracker::GetHistogramBucket(20U)), EXPECTED_HISTOGRAM_COUNT);
+
+    // [Cleaning]
+    SQAllocationTracker::NotifyDeallocation(TAG, 100U);
+    SQAllocationTracker::NotifyDeallocation(TAG, 20U);
+}
+
+/// <summary>
+/// Checks that deallocations reduce the live bytes but not the high-water mark.
+/// </summary>
+QTEST_CASE( NotifyDeallocation_LiveBytesAreReducedAndHighWaterMarkIsKept_Test )
+{
+    // [Preparation]
+    const u32_q TAG = SQAllocationTracker::RegisterTag("NotifyDeallocation_HighWaterMarkIsKept", "File.cpp", 10);
+    SQAllocationTracker::EnableHighWaterMark(TAG);
+    const i64_q EXPECTED_LIVE_BYTES = 50;
+    const u64_q EXPECTED_HIGH_WATER_MARK = 250U;
+    const u64_q EXPECTED_DEALLOCATIONS = 2U;
+    SQAllocationTracker::NotifyAllocation(TAG, 200U);
+    SQAllocationTracker::NotifyAllocation(TAG, 50U);
+
+    // [Execution]
+    SQAllocationTracker::NotifyDeallocation(TAG, 200U);
+    SQAllocationTracker::NotifyAllocation(TAG, 30U);
+    SQAllocationTracker::NotifyDeallocation(TAG, 30U);
+
+    // [Verification]
+    QAllocationSnapshot snapshot = SQAllocationTracker::TakeSnapshot();
+    BOOST_CHECK_EQUAL(snapshot.GetLiveBytes(TAG), EXPECTED_LIVE_BYTES);
+    BOOST_CHECK_EQUAL(snapshot.GetHighWaterMark(TAG), EXPECTED_HIGH_WATER_MARK);
+    BOOST_CHECK_EQUAL(snapshot.GetDeallocations(TAG), EXPECTED_DEALLOCATIONS);
+
+    // [Cleaning]
+    SQAllocationTracker::NotifyDeallocation(TAG, 50U);
+}
+
+/// <summary>
+/// Checks that the snapshot always contains the untagged group as the first tag.
+/// </summary>
+QTEST_CASE( TakeSnapshot_UntaggedGroupIsTheFirstTag_Test )
+{
+    // [Preparation]
+    const char* EXPECTED_NAME = null_q;
+
+    // [Execution]
+    QAllocationSnapshot snapshot = SQAllocationTracker::TakeSnapshot();
+
+    // [Verification]
+    BOOST_CHECK(snapshot.GetTagsCount() > 0);
+    BOOST_CHECK(snapshot.GetTagName(SQAllocationTracker::UNTAGGED) == EXPECTED_NAME);
+}
+
+/// <summary>
+/// Checks that sizes are assigned to the expected intervals of the histogram.
+/// </summary>
+QTEST_CASE( GetHistogramBucket_SizesAreAssignedToTheExpectedIntervals_Test )
+{
+    // [Preparation]
+    const pointer_uint_q SIZES[]            = { 1U, 16U, 17U, 32U, 33U, 1000U, 1024U, 1025U, 262144U, 262145U, 100000000U };
+    const u32_q          EXPECTED_BUCKETS[] = { 0,  0,   1U,  1U,  2U,  6U,    6U,    7U,    14U,     15U,     15U };
+    const pointer_uint_q SIZES_COUNT = sizeof(SIZES) / sizeof(pointer_uint_q);
+
+    // [Execution]
+    u32_q arBuckets[SIZES_COUNT];
+
+    for(pointer_uint_q i = 0; i < SIZES_COUNT; ++i)
+        arBuckets[i] = SQAllocationTracker::GetHistogramBucket(SIZES[i]);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arBuckets, arBuckets + SIZES_COUNT, EXPECTED_BUCKETS, EXPECTED_BUCKETS + SIZES_COUNT);
+}
+
+/// <summary>
+/// Checks that the limit of every interval is the biggest size assigned to it, and that the last one shares the limit with the previous one.
+/// </summary>
+QTEST_CASE( GetHistogramBucketLimit_LimitIsTheBiggestSizeOfTheInterval_Test )
+{
+    // [Preparation]
+    const u32_q LAST_BUCKET = SQAllocationTracker::HISTOGRAM_BUCKETS_COUNT - 1U;
+
+    // [Execution]
+    // [Verification]
+    for(u32_q uBucket = 0; uBucket < LAST_BUCKET; ++uBucket)
+    {
+        const pointer_uint_q LIMIT = SQAllocationTracker::GetHistogramBucketLimit(uBucket);
+        BOOST_CHECK_EQUAL(SQAllocationTracker::GetHistogramBucket(LIMIT), uBucket);
+        BOOST_CHECK_EQUAL(SQAllocationTracker::GetHistogramBucket(LIMIT + 1U), uBucket + 1U);
+    }
+
+    BOOST_CHECK_EQUAL(SQAllocationTracker::GetHistogramBucketLimit(LAST_BUCKET), SQAllocationTracker::GetHistogramBucketLimit(LAST_BUCKET - 1U));
+}
+
+// End - Test Suite: SQAllocationTracker
+QTEST_SUITE_END()
@@ -0,0 +1,209 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "SQFastHash.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFastHash;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+
+/// <summary>
+/// The maximum size of the sequences used in the tests, in bytes. It is large enough to use all the code paths of the hash function.
+/// </summary>
+static const pointer_uint_q SQFASTHASH_TEST_MAX_SIZE = 120U;
+
+
+QTEST_SUITE_BEGIN( SQFastHash_TestSuite )
+
+/// <summary>
+/// Checks that the same sequence always produces the same hash.
+/// </summary>
+QTEST_CASE ( Hash1_SameSequenceProducesSameHash_Test )
+{
+    // [Preparation]
+    const char INPUT_SEQUENCE[] = "A text to be used to generate a hash, long enough to use all the code paths of the function";
+
+    // [Execution]
+    u64_q uHash1 = SQFastHash::Hash(INPUT_SEQUENCE, sizeof(INPUT_SEQUENCE));
+    u64_q uHash2 = SQFastHash::Hash(INPUT_SEQUENCE, sizeof(INPUT_SEQUENCE));
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHash1, uHash2);
+}
+
+/// <summary>
+/// Checks that sequences of zeros whose sizes are different produce different hashes.
+/// </summary>
+QTEST_CASE ( Hash1_SequencesWithDifferentSizeProduceDifferentHashes_Test )
+{
+    // [Preparation]
+    const u8_q INPUT_SEQUENCE[SQFASTHASH_TEST_MAX_SIZE] = { 0 };
+    u64_q arHashes[SQFASTHASH_TEST_MAX_SIZE + 1U];
+
+    // [Execution]
+    for(pointer_uint_q uSize = 0; uSize <= SQFASTHASH_TEST_MAX_SIZE; ++uSize)
+        arHashes[uSize] = SQFastHash::Hash(INPUT_SEQUENCE, uSize);
+
+    // [Verification]
+    bool bAllHashesAreDifferent = true;
+
+    for(pointer_uint_q i = 0; i <= SQFASTHASH_TEST_MAX_SIZE; ++i)
+        for(pointer_uint_q j = i + 1U; j <= SQFASTHASH_TEST_MAX_SIZE; ++j)
+            bAllHashesAreDifferent = bAllHashesAreDifferent && arHashes[i] != arHashes[j];
+
+    BOOST_CHECK(bAllHashesAreDifferent);
+}
+
+/// <summary>
+/// Checks that changing any byte of a sequence changes its hash, for all the sizes.
+/// </summary>
+QTEST_CASE ( Hash1_EveryByteAffectsTheHash_Test )
+{
+    // [Preparation]
+    u8_q arSequence[SQFASTHASH_TEST_MAX_SIZE];
+
+    for(pointer_uint_q i = 0; i < SQFASTHASH_TEST_MAX_SIZE; ++i)
+        arSequence[i] = scast_q(i * 7U, u8_q);
+
+    // [Execution]
+    bool bEveryByteAffectsTheHash = true;
+
+    for(pointer_uint_q uSize = 1U; uSize <= SQFASTHASH_TEST_MAX_SIZE; ++uSize)
+    {
+        const u64_q ORIGINAL_HASH = SQFastHash::Hash(arSequence, uSize);
+
+        for(pointer_uint_q uByte = 0; uByte < uSize; ++uByte)
+        {
+            arSequence[uByte] ^= 0x10U;
+            bEveryByteAffectsTheHash = bEveryByteAffectsTheHash && SQFastHash::Hash(arSequence, uSize) != ORIGINAL_HASH;
+            arSequence[uByte] ^= 0x10U;
+        }
+    }
+
+    // [Verification]
+    BOOST_CHECK(bEveryByteAffectsTheHash);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the sequence is null and its size is not zero.
+/// </summary>
+QTEST_CASE ( Hash1_AssertionFailsWhenSequenceIsNullAndSizeIsNotZero_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INPUT_SIZE = 4U;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQFastHash::Hash(null_q, INPUT_SIZE);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the same sequence produces different hashes when using different seeds.
+/// </summary>
+QTEST_CASE ( Hash2_DifferentSeedsProduceDifferentHashes_Test )
+{
+    // [Preparation]
+    const char INPUT_SEQUENCE[] = "Common text";
+    const u64_q SEED_A = 1U;
+    const u64_q SEED_B = 2U;
+
+    // [Execution]
+    u64_q uHashA = SQFastHash::Hash(INPUT_SEQUENCE, sizeof(INPUT_SEQUENCE), SEED_A);
+    u64_q uHashB = SQFastHash::Hash(INPUT_SEQUENCE, sizeof(INPUT_SEQUENCE), SEED_B);
+
+    // [Verification]
+    BOOST_CHECK(uHashA != uHashB);
+}
+
+/// <summary>
+/// Checks that numbers that only differ in their highest bits are spread across all the buckets when calculating the remainder.
+/// </summary>
+QTEST_CASE ( HashInteger_AlignedNumbersAreSpreadAcrossAllBuckets_Test )
+{
+    // [Preparation]
+    const u32_q NUMBER_OF_BUCKETS = 64U;
+    const u32_q NUMBERS_PER_BUCKET = 64U;
+    const u64_q ALIGNMENT = 4096U;
+    const u32_q MAX_EXPECTED_NUMBERS_PER_BUCKET = NUMBERS_PER_BUCKET * 2U;
+    u32_q arBuckets[NUMBER_OF_BUCKETS] = { 0 };
+
+    // [Execution]
+    for(u64_q i = 0; i < NUMBER_OF_BUCKETS * NUMBERS_PER_BUCKET; ++i)
+        ++arBuckets[SQFastHash::HashInteger(i * ALIGNMENT) % NUMBER_OF_BUCKETS];
+
+    // [Verification]
+    bool bNumbersAreSpread = true;
+
+    for(u32_q i = 0; i < NUMBER_OF_BUCKETS; ++i)
+        bNumbersAreSpread = bNumbersAreSpread && arBuckets[i] > 0 && arBuckets[i] < MAX_EXPECTED_NUMBERS_PER_BUCKET;
+
+    BOOST_CHECK(bNumbersAreSpread);
+}
+
+/// <summary>
+/// Checks that the result depends on the order of the operands.
+/// </summary>
+QTEST_CASE ( Combine_ResultDependsOnTheOrderOfOperands_Test )
+{
+    // [Preparation]
+    const u64_q HASH_A = SQFastHash::HashInteger(1U);
+    const u64_q HASH_B = SQFastHash::HashInteger(2U);
+
+    // [Execution]
+    u64_q uCombinationAB = SQFastHash::Combine(HASH_A, HASH_B);
+    u64_q uCombinationBA = SQFastHash::Combine(HASH_B, HASH_A);
+
+    // [Verification]
+    BOOST_CHECK(uCombinationAB != uCombinationBA);
+}
+
+// End - Test Suite: SQFastHash
+QTEST_SUITE_END()
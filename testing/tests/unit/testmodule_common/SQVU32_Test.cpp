@@ -0,0 +1,249 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "SQVU32.h"
+#include "QAlignment.h"
+#include "AllocationOperators.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::SQVU32;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::vf32_q;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+
+QTEST_SUITE_BEGIN( SQVU32_TestSuite )
+
+/// <summary>
+/// Checks if every unsigned integer is set in the correct place into the vector.
+/// </summary>
+QTEST_CASE ( Pack_EveryValueIsSetInTheRightPlace_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_VALUE_FOR_UINT1 = 1U;
+    const u32_q EXPECTED_VALUE_FOR_UINT2 = 0xFFFFFFFFU;
+    const u32_q EXPECTED_VALUE_FOR_UINT3 = 0x7FC00000U; // A NaN, when read as a float
+    const u32_q EXPECTED_VALUE_FOR_UINT4 = 4U;
+
+	// [Execution]
+    vf32_q vectorUT;
+    SQVU32::Pack(EXPECTED_VALUE_FOR_UINT1,
+                 EXPECTED_VALUE_FOR_UINT2,
+                 EXPECTED_VALUE_FOR_UINT3,
+                 EXPECTED_VALUE_FOR_UINT4,
+                 vectorUT);
+
+    // [Verification]
+    u32_q uValueInPosition1;
+    u32_q uValueInPosition2;
+    u32_q uValueInPosition3;
+    u32_q uValueInPosition4;
+    SQVU32::Unpack(vectorUT,
+                   uValueInPosition1,
+                   uValueInPosition2,
+                   uValueInPosition3,
+                   uValueInPosition4);
+
+    BOOST_CHECK_EQUAL(uValueInPosition1, EXPECTED_VALUE_FOR_UINT1);
+    BOOST_CHECK_EQUAL(uValueInPosition2, EXPECTED_VALUE_FOR_UINT2);
+    BOOST_CHECK_EQUAL(uValueInPosition3, EXPECTED_VALUE_FOR_UINT3);
+    BOOST_CHECK_EQUAL(uValueInPosition4, EXPECTED_VALUE_FOR_UINT4);
+}
+
+/// <summary>
+/// Not tested. It's the same as Pack so it's not repeated.
+/// </summary>
+QTEST_CASE ( Unpack_NotTested_Test )
+{
+    BOOST_MESSAGE(QE_L("It's the same as Pack so it's not repeated"));
+}
+
+/// <summary>
+/// Checks that the values stored in memory are the same that were loaded, in the same order.
+/// </summary>
+QTEST_CASE ( Load_ValuesAreLoadedAndStoredInTheSameOrder_Test )
+{
+    // [Preparation]
+    u32_q* arSource = new(QAlignment(16U)) u32_q[4];
+    u32_q* arDestination = new(QAlignment(16U)) u32_q[4];
+    arSource[0] = 1U;
+    arSource[1] = 2U;
+    arSource[2] = 0xFFFFFFFFU;
+    arSource[3] = 0x7FC00001U;
+
+	// [Execution]
+    vf32_q vectorUT;
+    SQVU32::Load(arSource, vectorUT);
+    SQVU32::Store(vectorUT, arDestination);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(arDestination[0], arSource[0]);
+    BOOST_CHECK_EQUAL(arDestination[1], arSource[1]);
+    BOOST_CHECK_EQUAL(arDestination[2], arSource[2]);
+    BOOST_CHECK_EQUAL(arDestination[3], arSource[3]);
+
+    // [Cleaning]
+    operator delete[](arSource, QAlignment(16U));
+    operator delete[](arDestination, QAlignment(16U));
+}
+
+/// <summary>
+/// Not tested. It's tested along with Load.
+/// </summary>
+QTEST_CASE ( Store_NotTested_Test )
+{
+    BOOST_MESSAGE(QE_L("It's tested along with Load"));
+}
+
+/// <summary>
+/// Checks that every bit of the result is the AND of the bits of the operands.
+/// </summary>
+QTEST_CASE ( And_ResultIsCorrect_Test )
+{
+    // [Preparation]
+    vf32_q packA;
+    vf32_q packB;
+    SQVU32::Pack(0xFFFF0000U, 0x0F0F0F0FU, 0xFFFFFFFFU, 0U, packA);
+    SQVU32::Pack(0xFF00FF00U, 0x33333333U, 0x7FC00000U, 0xFFFFFFFFU, packB);
+
+	// [Execution]
+    vf32_q result;
+    SQVU32::And(packA, packB, result);
+
+    // [Verification]
+    u32_q u1, u2, u3, u4;
+    SQVU32::Unpack(result, u1, u2, u3, u4);
+
+    BOOST_CHECK_EQUAL(u1, 0xFF000000U);
+    BOOST_CHECK_EQUAL(u2, 0x03030303U);
+    BOOST_CHECK_EQUAL(u3, 0x7FC00000U);
+    BOOST_CHECK_EQUAL(u4, 0U);
+}
+
+/// <summary>
+/// Checks that every bit of the result is the OR of the bits of the operands.
+/// </summary>
+QTEST_CASE ( Or_ResultIsCorrect_Test )
+{
+    // [Preparation]
+    vf32_q packA;
+    vf32_q packB;
+    SQVU32::Pack(0xFFFF0000U, 0x0F0F0F0FU, 0xFFFFFFFFU, 0U, packA);
+    SQVU32::Pack(0xFF00FF00U, 0x33333333U, 0x7FC00000U, 0x00800001U, packB);
+
+	// [Execution]
+    vf32_q result;
+    SQVU32::Or(packA, packB, result);
+
+    // [Verification]
+    u32_q u1, u2, u3, u4;
+    SQVU32::Unpack(result, u1, u2, u3, u4);
+
+    BOOST_CHECK_EQUAL(u1, 0xFFFFFF00U);
+    BOOST_CHECK_EQUAL(u2, 0x3F3F3F3FU);
+    BOOST_CHECK_EQUAL(u3, 0xFFFFFFFFU);
+    BOOST_CHECK_EQUAL(u4, 0x00800001U);
+}
+
+/// <summary>
+/// Checks that every bit of the result is the exclusive OR of the bits of the operands.
+/// </summary>
+QTEST_CASE ( Xor_ResultIsCorrect_Test )
+{
+    // [Preparation]
+    vf32_q packA;
+    vf32_q packB;
+    SQVU32::Pack(0xFFFF0000U, 0x0F0F0F0FU, 0xFFFFFFFFU, 0U, packA);
+    SQVU32::Pack(0xFF00FF00U, 0x33333333U, 0x7FC00000U, 0x00800001U, packB);
+
+	// [Execution]
+    vf32_q result;
+    SQVU32::Xor(packA, packB, result);
+
+    // [Verification]
+    u32_q u1, u2, u3, u4;
+    SQVU32::Unpack(result, u1, u2, u3, u4);
+
+    BOOST_CHECK_EQUAL(u1, 0x00FFFF00U);
+    BOOST_CHECK_EQUAL(u2, 0x3C3C3C3CU);
+    BOOST_CHECK_EQUAL(u3, 0x803FFFFFU);
+    BOOST_CHECK_EQUAL(u4, 0x00800001U);
+}
+
+/// <summary>
+/// Checks that every bit of the result is the AND of the complement of the bits of the first operand and the bits of the second one.
+/// </summary>
+QTEST_CASE ( AndNot_ResultIsCorrect_Test )
+{
+    // [Preparation]
+    vf32_q packA;
+    vf32_q packB;
+    SQVU32::Pack(0xFFFF0000U, 0x0F0F0F0FU, 0xFFFFFFFFU, 0U, packA);
+    SQVU32::Pack(0xFF00FF00U, 0x33333333U, 0x7FC00000U, 0x00800001U, packB);
+
+	// [Execution]
+    vf32_q result;
+    SQVU32::AndNot(packA, packB, result);
+
+    // [Verification]
+    u32_q u1, u2, u3, u4;
+    SQVU32::Unpack(result, u1, u2, u3, u4);
+
+    BOOST_CHECK_EQUAL(u1, 0x0000FF00U);
+    BOOST_CHECK_EQUAL(u2, 0x30303030U);
+    BOOST_CHECK_EQUAL(u3, 0U);
+    BOOST_CHECK_EQUAL(u4, 0x00800001U);
+}
+
+/// <summary>
+/// Checks that every bit of the result is the complement of the bit of the operand.
+/// </summary>
+QTEST_CASE ( Not_ResultIsCorrect_Test )
+{
+    // [Preparation]
+    vf32_q pack;
+    SQVU32::Pack(0xFFFF0000U, 0x0F0F0F0FU, 0x7FC00000U, 0U, pack);
+
+	// [Execution]
+    vf32_q result;
+    SQVU32::Not(pack, result);
+
+    // [Verification]
+    u32_q u1, u2, u3, u4;
+    SQVU32::Unpack(result, u1, u2, u3, u4);
+
+    BOOST_CHECK_EQUAL(u1, 0x0000FFFFU);
+    BOOST_CHECK_EQUAL(u2, 0xF0F0F0F0U);
+    BOOST_CHECK_EQUAL(u3, 0x803FFFFFU);
+    BOOST_CHECK_EQUAL(u4, 0xFFFFFFFFU);
+}
+
+// End - Test Suite: SQVU32
+QTEST_SUITE_END()
@@ -0,0 +1,422 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QConcurrentHashtable.h"
+#include "QThread.h"
+#include "QDelegate.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::System::Threading::QConcurrentHashtable;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+/// <summary>
+/// The number of keys added by every thread in the multi-threaded tests.
+/// </summary>
+static const u32_q QCONCURRENTHASHTABLE_TEST_KEYS_PER_THREAD = 2000U;
+
+/// <summary>
+/// Adds a range of consecutive keys to a table, whose values are twice the keys.
+/// </summary>
+/// <param name="pHashtable">[IN/OUT] The table.</param>
+/// <param name="uFirstKey">[IN] The first key of the range.</param>
+static void QConcurrentHashtable_Test_AddKeys(QConcurrentHashtable<u32_q, u32_q>* pHashtable, const u32_q uFirstKey)
+{
+    for(u32_q uKey = uFirstKey; uKey < uFirstKey + QCONCURRENTHASHTABLE_TEST_KEYS_PER_THREAD; ++uKey)
+        pHashtable->AddOrUpdate(uKey, uKey * 2U);
+}
+
+/// <summary>
+/// Removes the even keys of a range of consecutive keys from a table.
+/// </summary>
+/// <param name="pHashtable">[IN/OUT] The table.</param>
+/// <param name="uFirstKey">[IN] The first key of the range.</param>
+static void QConcurrentHashtable_Test_RemoveEvenKeys(QConcurrentHashtable<u32_q, u32_q>* pHashtable, const u32_q uFirstKey)
+{
+    for(u32_q uKey = uFirstKey; uKey < uFirstKey + QCONCURRENTHASHTABLE_TEST_KEYS_PER_THREAD; uKey += 2U)
+        pHashtable->Remove(uKey);
+}
+
+
+QTEST_SUITE_BEGIN( QConcurrentHashtable_TestSuite )
+
+/// <summary>
+/// Checks that the table is divided into the expected number of segments.
+/// </summary>
+QTEST_CASE ( Constructor_TableIsDividedIntoTheExpectedNumberOfSegments_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_SEGMENTS = 8U;
+
+    // [Execution]
+    QConcurrentHashtable<u32_q, u32_q> hashtable(EXPECTED_SEGMENTS, 64U, 2U);
+
+    // [Verification]
+    pointer_uint_q uSegments = hashtable.GetNumberOfSegments();
+    bool bIsEmpty = hashtable.IsEmpty();
+
+    BOOST_CHECK_EQUAL(uSegments, EXPECTED_SEGMENTS);
+    BOOST_CHECK(bIsEmpty);
+}
+
+/// <summary>
+/// Checks that the table can be created when there are less buckets than segments.
+/// </summary>
+QTEST_CASE ( Constructor_EverySegmentHasOneBucketWhenThereAreLessBucketsThanSegments_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_VALUE = 5U;
+    QConcurrentHashtable<u32_q, u32_q> hashtable(16U, 1U, 1U);
+
+    // [Execution]
+    hashtable.AddOrUpdate(1U, EXPECTED_VALUE);
+
+    // [Verification]
+    u32_q uValue = 0;
+    hashtable.TryGetValue(1U, uValue);
+    BOOST_CHECK_EQUAL(uValue, EXPECTED_VALUE);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the number of segments is not a power of two.
+/// </summary>
+QTEST_CASE ( Constructor_AssertionFailsWhenNumberOfSegmentsIsNotPowerOfTwo_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QConcurrentHashtable<u32_q, u32_q> hashtable(6U, 64U, 2U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the number of segments is zero.
+/// </summary>
+QTEST_CASE ( Constructor_AssertionFailsWhenNumberOfSegmentsIsZero_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QConcurrentHashtable<u32_q, u32_q> hashtable(0, 64U, 2U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the key is added and True is returned when the key did not exist.
+/// </summary>
+QTEST_CASE ( AddOrUpdate_KeyIsAddedAndTrueIsReturnedWhenKeyDoesNotExist_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_KEY = 7U;
+    const u32_q EXPECTED_VALUE = 70U;
+    const pointer_uint_q EXPECTED_COUNT = 1U;
+    QConcurrentHashtable<u32_q, u32_q> hashtable(4U, 16U, 2U);
+
+    // [Execution]
+    bool bResult = hashtable.AddOrUpdate(INPUT_KEY, EXPECTED_VALUE);
+
+    // [Verification]
+    u32_q uValue = 0;
+    hashtable.TryGetValue(INPUT_KEY, uValue);
+    pointer_uint_q uCount = hashtable.GetCount();
+
+    BOOST_CHECK(bResult);
+    BOOST_CHECK_EQUAL(uValue, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the value is replaced and False is returned when the key already existed.
+/// </summary>
+QTEST_CASE ( AddOrUpdate_ValueIsReplacedAndFalseIsReturnedWhenKeyExists_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_KEY = 7U;
+    const u32_q EXPECTED_VALUE = 71U;
+    const pointer_uint_q EXPECTED_COUNT = 1U;
+    QConcurrentHashtable<u32_q, u32_q> hashtable(4U, 16U, 2U);
+    hashtable.AddOrUpdate(INPUT_KEY, 70U);
+
+    // [Execution]
+    bool bResult = hashtable.AddOrUpdate(INPUT_KEY, EXPECTED_VALUE);
+
+    // [Verification]
+    u32_q uValue = 0;
+    hashtable.TryGetValue(INPUT_KEY, uValue);
+    pointer_uint_q uCount = hashtable.GetCount();
+
+    BOOST_CHECK(!bResult);
+    BOOST_CHECK_EQUAL(uValue, EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that all the elements added from several threads at the same time are stored.
+/// </summary>
+QTEST_CASE ( AddOrUpdate_ElementsAddedFromSeveralThreadsAreStored_Test )
+{
+    using Kinesis::QuimeraEngine::System::Threading::QThread;
+    using Kinesis::QuimeraEngine::Common::QDelegate;
+
+    // [Preparation]
+    const u32_q NUMBER_OF_THREADS = 4U;
+    const pointer_uint_q EXPECTED_COUNT = NUMBER_OF_THREADS * QCONCURRENTHASHTABLE_TEST_KEYS_PER_THREAD;
+    const bool EXPECTED_VALUES_ARE_CORRECT = true;
+    QConcurrentHashtable<u32_q, u32_q> hashtable(8U, 16U, 2U);
+    QDelegate<void (QConcurrentHashtable<u32_q, u32_q>*, const u32_q)> addFunction(&QConcurrentHashtable_Test_AddKeys);
+    QThread* arThreads[NUMBER_OF_THREADS];
+
+    // [Execution]
+    for(u32_q i = 0; i < NUMBER_OF_THREADS; ++i)
+        arThreads[i] = new QThread(addFunction, &hashtable, i * QCONCURRENTHASHTABLE_TEST_KEYS_PER_THREAD);
+
+    for(u32_q i = 0; i < NUMBER_OF_THREADS; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    // [Verification]
+    bool bValuesAreCorrect = true;
+
+    for(u32_q uKey = 0; uKey < EXPECTED_COUNT; ++uKey)
+    {
+        u32_q uValue = 0;
+        bValuesAreCorrect = bValuesAreCorrect && hashtable.TryGetValue(uKey, uValue) && uValue == uKey * 2U;
+    }
+
+    pointer_uint_q uCount = hashtable.GetCount();
+
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(bValuesAreCorrect, EXPECTED_VALUES_ARE_CORRECT);
+}
+
+/// <summary>
+/// Checks that True is returned and the value is obtained when the key exists.
+/// </summary>
+QTEST_CASE ( TryGetValue_TrueIsReturnedAndValueIsObtainedWhenKeyExists_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_KEY = 12U;
+    const u32_q EXPECTED_VALUE = 120U;
+    QConcurrentHashtable<u32_q, u32_q> hashtable(4U, 16U, 2U);
+    hashtable.AddOrUpdate(11U, 110U);
+    hashtable.AddOrUpdate(INPUT_KEY, EXPECTED_VALUE);
+    hashtable.AddOrUpdate(13U, 130U);
+
+    // [Execution]
+    u32_q uValue = 0;
+    bool bResult = hashtable.TryGetValue(INPUT_KEY, uValue);
+
+    // [Verification]
+    BOOST_CHECK(bResult);
+    BOOST_CHECK_EQUAL(uValue, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that False is returned and the output value is not modified when the key does not exist.
+/// </summary>
+QTEST_CASE ( TryGetValue_FalseIsReturnedAndValueIsNotModifiedWhenKeyDoesNotExist_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_VALUE = 99U;
+    QConcurrentHashtable<u32_q, u32_q> hashtable(4U, 16U, 2U);
+    hashtable.AddOrUpdate(11U, 110U);
+
+    // [Execution]
+    u32_q uValue = EXPECTED_VALUE;
+    bool bResult = hashtable.TryGetValue(12U, uValue);
+
+    // [Verification]
+    BOOST_CHECK(!bResult);
+    BOOST_CHECK_EQUAL(uValue, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that it returns whether the key exists or not.
+/// </summary>
+QTEST_CASE ( ContainsKey_ReturnsWhetherTheKeyExists_Test )
+{
+    // [Preparation]
+    QConcurrentHashtable<u32_q, u32_q> hashtable(4U, 16U, 2U);
+    hashtable.AddOrUpdate(11U, 110U);
+
+    // [Execution]
+    bool bExistingKeyIsContained = hashtable.ContainsKey(11U);
+    bool bNonExistingKeyIsContained = hashtable.ContainsKey(12U);
+
+    // [Verification]
+    BOOST_CHECK(bExistingKeyIsContained);
+    BOOST_CHECK(!bNonExistingKeyIsContained);
+}
+
+/// <summary>
+/// Checks that the key is removed and True is returned when the key exists.
+/// </summary>
+QTEST_CASE ( Remove_KeyIsRemovedAndTrueIsReturnedWhenKeyExists_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_KEY = 12U;
+    const pointer_uint_q EXPECTED_COUNT = 1U;
+    QConcurrentHashtable<u32_q, u32_q> hashtable(4U, 16U, 2U);
+    hashtable.AddOrUpdate(11U, 110U);
+    hashtable.AddOrUpdate(INPUT_KEY, 120U);
+
+    // [Execution]
+    bool bResult = hashtable.Remove(INPUT_KEY);
+
+    // [Verification]
+    bool bKeyIsContained = hashtable.ContainsKey(INPUT_KEY);
+    pointer_uint_q uCount = hashtable.GetCount();
+
+    BOOST_CHECK(bResult);
+    BOOST_CHECK(!bKeyIsContained);
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that nothing is removed and False is returned when the key does not exist.
+/// </summary>
+QTEST_CASE ( Remove_FalseIsReturnedWhenKeyDoesNotExist_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_COUNT = 1U;
+    QConcurrentHashtable<u32_q, u32_q> hashtable(4U, 16U, 2U);
+    hashtable.AddOrUpdate(11U, 110U);
+
+    // [Execution]
+    bool bResult = hashtable.Remove(12U);
+
+    // [Verification]
+    pointer_uint_q uCount = hashtable.GetCount();
+
+    BOOST_CHECK(!bResult);
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that elements removed from several threads at the same time, while other threads add elements, are removed.
+/// </summary>
+QTEST_CASE ( Remove_ElementsRemovedFromSeveralThreadsAreRemoved_Test )
+{
+    using Kinesis::QuimeraEngine::System::Threading::QThread;
+    using Kinesis::QuimeraEngine::Common::QDelegate;
+
+    // [Preparation]
+    const u32_q NUMBER_OF_THREADS = 4U;
+    const pointer_uint_q EXPECTED_COUNT = NUMBER_OF_THREADS * QCONCURRENTHASHTABLE_TEST_KEYS_PER_THREAD;
+    const bool EXPECTED_KEYS_ARE_CORRECT = true;
+    QConcurrentHashtable<u32_q, u32_q> hashtable(8U, 16U, 2U);
+    QDelegate<void (QConcurrentHashtable<u32_q, u32_q>*, const u32_q)> addFunction(&QConcurrentHashtable_Test_AddKeys);
+    QDelegate<void (QConcurrentHashtable<u32_q, u32_q>*, const u32_q)> removeFunction(&QConcurrentHashtable_Test_RemoveEvenKeys);
+    QThread* arThreads[NUMBER_OF_THREADS * 2U];
+
+    // The first half of the keys are added before, the second half are added while the first half is being removed
+    for(u32_q i = 0; i < NUMBER_OF_THREADS; ++i)
+        QConcurrentHashtable_Test_AddKeys(&hashtable, i * QCONCURRENTHASHTABLE_TEST_KEYS_PER_THREAD);
+
+    // [Execution]
+    for(u32_q i = 0; i < NUMBER_OF_THREADS; ++i)
+    {
+        arThreads[i * 2U] = new QThread(removeFunction, &hashtable, i * QCONCURRENTHASHTABLE_TEST_KEYS_PER_THREAD);
+        arThreads[i * 2U + 1U] = new QThread(addFunction, &hashtable, (NUMBER_OF_THREADS + i) * QCONCURRENTHASHTABLE_TEST_KEYS_PER_THREAD);
+    }
+
+    for(u32_q i = 0; i < NUMBER_OF_THREADS * 2U; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    // [Verification]
+    bool bKeysAreCorrect = true;
+
+    for(u32_q uKey = 0; uKey < EXPECTED_COUNT; ++uKey)
+        bKeysAreCorrect = bKeysAreCorrect && hashtable.ContainsKey(uKey) == (uKey % 2U == 1U);
+
+    for(u32_q uKey = EXPECTED_COUNT; uKey < EXPECTED_COUNT * 2U; ++uKey)
+        bKeysAreCorrect = bKeysAreCorrect && hashtable.ContainsKey(uKey);
+
+    pointer_uint_q uCount = hashtable.GetCount();
+
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT / 2U + EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(bKeysAreCorrect, EXPECTED_KEYS_ARE_CORRECT);
+}
+
+/// <summary>
+/// Checks that it returns True only when there are no elements in any segment.
+/// </summary>
+QTEST_CASE ( IsEmpty_ReturnsTrueOnlyWhenThereAreNoElements_Test )
+{
+    // [Preparation]
+    QConcurrentHashtable<u32_q, u32_q> hashtable(4U, 16U, 2U);
+    bool bIsEmptyBeforeAdding = hashtable.IsEmpty();
+    hashtable.AddOrUpdate(11U, 110U);
+
+    // [Execution]
+    bool bIsEmptyAfterAdding = hashtable.IsEmpty();
+
+    // [Verification]
+    BOOST_CHECK(bIsEmptyBeforeAdding);
+    BOOST_CHECK(!bIsEmptyAfterAdding);
+}
+
+// End - Test Suite: QConcurrentHashtable
+QTEST_SUITE_END()
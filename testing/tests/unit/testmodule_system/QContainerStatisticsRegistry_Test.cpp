@@ -0,0 +1,268 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QContainerStatisticsRegistry.h"
+
+#include "QArrayDynamic.h"
+#include "SQFloat.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::System::Diagnosis::QContainerStatisticsRegistry;
+using Kinesis::QuimeraEngine::Tools::Containers::QContainerStatistics;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+
+
+QTEST_SUITE_BEGIN( QContainerStatisticsRegistry_TestSuite )
+
+/// <summary>
+/// Creates container statistics with the given values.
+/// </summary>
+QContainerStatistics CreateStatistics_TestMethod(const pointer_uint_q uCount, const pointer_uint_q uBytes, const float_q fLoadFactor, const pointer_uint_q uMaximumChainLength)
+{
+    QContainerStatistics statistics;
+    statistics.SetCount(uCount);
+    statistics.SetCapacity(uCount * 2U);
+    statistics.SetReservedBytes(uBytes * 2U);
+    statistics.SetUsedBytes(uBytes);
+    statistics.SetLoadFactor(fLoadFactor);
+    statistics.SetMaximumChainLength(uMaximumChainLength);
+    statistics.SetHeight(uMaximumChainLength + 1U);
+    statistics.SetAverageDepth(fLoadFactor);
+    return statistics;
+}
+
+/// <summary>
+/// Checks that the number of elements, the capacity and the bytes of the containers of the same type are summed.
+/// </summary>
+QTEST_CASE ( Add_MemoryUsageOfContainersOfSameTypeIsSummed_Test )
+{
+    // [Preparation]
+    const string_q CONTAINER_TYPE("Type1");
+    const pointer_uint_q EXPECTED_COUNT = 5U;
+    const pointer_uint_q EXPECTED_CAPACITY = 10U;
+    const pointer_uint_q EXPECTED_RESERVED_BYTES = 80U;
+    const pointer_uint_q EXPECTED_USED_BYTES = 40U;
+    QContainerStatisticsRegistry::Get()->Clear();
+
+    // [Execution]
+    QContainerStatisticsRegistry::Get()->Add(CONTAINER_TYPE, CreateStatistics_TestMethod(2U, 16U, SQFloat::_1, 1U));
+    QContainerStatisticsRegistry::Get()->Add(CONTAINER_TYPE, CreateStatistics_TestMethod(3U, 24U, SQFloat::_1, 1U));
+
+    // [Verification]
+    QContainerStatistics totals = QContainerStatisticsRegistry::Get()->GetTotals(CONTAINER_TYPE);
+    BOOST_CHECK_EQUAL(totals.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(totals.GetCapacity(), EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(totals.GetReservedBytes(), EXPECTED_RESERVED_BYTES);
+    BOOST_CHECK_EQUAL(totals.GetUsedBytes(), EXPECTED_USED_BYTES);
+}
+
+/// <summary>
+/// Checks that the maximum chain length and the height are the maximum values and the load factor and the average depth are averaged.
+/// </summary>
+QTEST_CASE ( Add_ShapePropertiesAreMaximizedOrAveraged_Test )
+{
+    // [Preparation]
+    const string_q CONTAINER_TYPE("Type1");
+    const float_q EXPECTED_LOAD_FACTOR = SQFloat::_1;
+    const pointer_uint_q EXPECTED_MAXIMUM_CHAIN_LENGTH = 6U;
+    const pointer_uint_q EXPECTED_HEIGHT = 7U;
+    const float_q EXPECTED_AVERAGE_DEPTH = SQFloat::_1;
+    QContainerStatisticsRegistry::Get()->Clear();
+
+    // [Execution]
+    QContainerStatisticsRegistry::Get()->Add(CONTAINER_TYPE, CreateStatistics_TestMethod(2U, 16U, SQFloat::_0_5, 6U));
+    QContainerStatisticsRegistry::Get()->Add(CONTAINER_TYPE, CreateStatistics_TestMethod(3U, 24U, SQFloat::_1 + SQFloat::_0_5, 2U));
+
+    // [Verification]
+    QContainerStatistics totals = QContainerStatisticsRegistry::Get()->GetTotals(CONTAINER_TYPE);
+    BOOST_CHECK_EQUAL(totals.GetLoadFactor(), EXPECTED_LOAD_FACTOR);
+    BOOST_CHECK_EQUAL(totals.GetMaximumChainLength(), EXPECTED_MAXIMUM_CHAIN_LENGTH);
+    BOOST_CHECK_EQUAL(totals.GetHeight(), EXPECTED_HEIGHT);
+    BOOST_CHECK_EQUAL(totals.GetAverageDepth(), EXPECTED_AVERAGE_DEPTH);
+}
+
+/// <summary>
+/// Checks that the statistics of different container types are not mixed.
+/// </summary>
+QTEST_CASE ( Add_ContainerTypesAreKeptSeparately_Test )
+{
+    // [Preparation]
+    const string_q CONTAINER_TYPE1("Type1");
+    const string_q CONTAINER_TYPE2("Type2");
+    const pointer_uint_q EXPECTED_COUNT1 = 2U;
+    const pointer_uint_q EXPECTED_COUNT2 = 7U;
+    const pointer_uint_q EXPECTED_NUMBER_OF_CONTAINERS1 = 1U;
+    const pointer_uint_q EXPECTED_NUMBER_OF_CONTAINERS2 = 2U;
+    QContainerStatisticsRegistry::Get()->Clear();
+
+    // [Execution]
+    QContainerStatisticsRegistry::Get()->Add(CONTAINER_TYPE1, CreateStatistics_TestMethod(2U, 16U, SQFloat::_1, 1U));
+    QContainerStatisticsRegistry::Get()->Add(CONTAINER_TYPE2, CreateStatistics_TestMethod(3U, 24U, SQFloat::_1, 1U));
+    QContainerStatisticsRegistry::Get()->Add(CONTAINER_TYPE2, CreateStatistics_TestMethod(4U, 32U, SQFloat::_1, 1U));
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(QContainerStatisticsRegistry::Get()->GetTotals(CONTAINER_TYPE1).GetCount(), EXPECTED_COUNT1);
+    BOOST_CHECK_EQUAL(QContainerStatisticsRegistry::Get()->GetTotals(CONTAINER_TYPE2).GetCount(), EXPECTED_COUNT2);
+    BOOST_CHECK_EQUAL(QContainerStatisticsRegistry::Get()->GetNumberOfContainers(CONTAINER_TYPE1), EXPECTED_NUMBER_OF_CONTAINERS1);
+    BOOST_CHECK_EQUAL(QContainerStatisticsRegistry::Get()->GetNumberOfContainers(CONTAINER_TYPE2), EXPECTED_NUMBER_OF_CONTAINERS2);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the name of the container type is empty.
+/// </summary>
+QTEST_CASE ( Add_AssertionFailsWhenContainerTypeIsEmpty_Test )
+{
+    // [Preparation]
+    const string_q CONTAINER_TYPE = string_q::GetEmpty();
+    const bool ASSERTION_FAILED = true;
+    QContainerStatisticsRegistry::Get()->Clear();
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QContainerStatisticsRegistry::Get()->Add(CONTAINER_TYPE, QContainerStatistics());
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the statistics obtained from a container are added.
+/// </summary>
+QTEST_CASE ( AddContainer_StatisticsOfContainerAreAdded_Test )
+{
+    // [Preparation]
+    const string_q CONTAINER_TYPE("QArrayDynamic<int>");
+    const pointer_uint_q EXPECTED_COUNT = 3U;
+    const pointer_uint_q EXPECTED_NUMBER_OF_CONTAINERS = 1U;
+    QArrayDynamic<int> arElements(10U);
+    arElements.Add(1);
+    arElements.Add(2);
+    arElements.Add(3);
+    const pointer_uint_q EXPECTED_USED_BYTES = arElements.GetStatistics().GetUsedBytes();
+    QContainerStatisticsRegistry::Get()->Clear();
+
+    // [Execution]
+    QContainerStatisticsRegistry::Get()->AddContainer(CONTAINER_TYPE, arElements);
+
+    // [Verification]
+    QContainerStatistics totals = QContainerStatisticsRegistry::Get()->GetTotals(CONTAINER_TYPE);
+    BOOST_CHECK_EQUAL(totals.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(totals.GetUsedBytes(), EXPECTED_USED_BYTES);
+    BOOST_CHECK_EQUAL(QContainerStatisticsRegistry::Get()->GetNumberOfContainers(CONTAINER_TYPE), EXPECTED_NUMBER_OF_CONTAINERS);
+}
+
+/// <summary>
+/// Checks that all the statistics are removed.
+/// </summary>
+QTEST_CASE ( Clear_AllStatisticsAreRemoved_Test )
+{
+    // [Preparation]
+    const string_q CONTAINER_TYPE("Type1");
+    const pointer_uint_q EXPECTED_COUNT = 0;
+    const pointer_uint_q EXPECTED_NUMBER_OF_CONTAINERS = 0;
+    QContainerStatisticsRegistry::Get()->Add(CONTAINER_TYPE, CreateStatistics_TestMethod(2U, 16U, SQFloat::_1, 1U));
+
+    // [Execution]
+    QContainerStatisticsRegistry::Get()->Clear();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(QContainerStatisticsRegistry::Get()->GetTotals(CONTAINER_TYPE).GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(QContainerStatisticsRegistry::Get()->GetNumberOfContainers(CONTAINER_TYPE), EXPECTED_NUMBER_OF_CONTAINERS);
+    BOOST_CHECK(QContainerStatisticsRegistry::Get()->ToString().IsEmpty());
+}
+
+/// <summary>
+/// Checks that all the properties are zero when no statistics were added for the container type.
+/// </summary>
+QTEST_CASE ( GetTotals_AllPropertiesAreZeroWhenTypeIsUnknown_Test )
+{
+    // [Preparation]
+    const string_q CONTAINER_TYPE("Unknown");
+    const pointer_uint_q EXPECTED_VALUE = 0;
+    const float_q EXPECTED_FLOAT_VALUE = SQFloat::_0;
+    QContainerStatisticsRegistry::Get()->Clear();
+
+    // [Execution]
+    QContainerStatistics totals = QContainerStatisticsRegistry::Get()->GetTotals(CONTAINER_TYPE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(totals.GetCount(), EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(totals.GetReservedBytes(), EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(totals.GetLoadFactor(), EXPECTED_FLOAT_VALUE);
+    BOOST_CHECK_EQUAL(totals.GetAverageDepth(), EXPECTED_FLOAT_VALUE);
+    BOOST_CHECK_EQUAL(QContainerStatisticsRegistry::Get()->GetNumberOfContainers(CONTAINER_TYPE), EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the text contains one line per container type, sorted by name.
+/// </summary>
+QTEST_CASE ( ToString_OneLinePerContainerTypeIsGenerated_Test )
+{
+    // [Preparation]
+    const string_q CONTAINER_TYPE1("B");
+    const string_q CONTAINER_TYPE2("A");
+    const string_q EXPECTED_TEXT = string_q("A: 1 containers, 3 elements, capacity 6, 48 bytes reserved, 24 bytes used, 24 bytes unused, load factor ") + 
+                                   string_q::FromFloat(SQFloat::_1) + 
+                                   ", maximum chain length 1, height 2, average depth " + 
+                                   string_q::FromFloat(SQFloat::_1) + "\n" + 
+                                   "B: 1 containers, 2 elements, capacity 4, 32 bytes reserved, 16 bytes used, 16 bytes unused, load factor " + 
+                                   string_q::FromFloat(SQFloat::_0_5) + 
+                                   ", maximum chain length 3, height 4, average depth " + 
+                                   string_q::FromFloat(SQFloat::_0_5) + "\n";
+    QContainerStatisticsRegistry::Get()->Clear();
+    QContainerStatisticsRegistry::Get()->Add(CONTAINER_TYPE1, CreateStatistics_TestMethod(2U, 16U, SQFloat::_0_5, 3U));
+    QContainerStatisticsRegistry::Get()->Add(CONTAINER_TYPE2, CreateStatistics_TestMethod(3U, 24U, SQFloat::_1, 1U));
+
+    // [Execution]
+    string_q strText = QContainerStatisticsRegistry::Get()->ToString();
+
+    // [Verification]
+    BOOST_CHECK(strText == EXPECTED_TEXT);
+}
+
+// End - Test Suite: QContainerStatisticsRegistry
+QTEST_SUITE_END()
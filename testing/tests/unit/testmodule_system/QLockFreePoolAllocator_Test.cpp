@@ -0,0 +1,458 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QLockFreePoolAllocator.h"
+#include "QThread.h"
+#include "QDelegate.h"
+#include "QList.h"
+#include "QHashtable.h"
+#include "SQIntegerHashProvider.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::System::Threading::QLockFreePoolAllocator;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+using Kinesis::QuimeraEngine::Tools::Containers::QList;
+using Kinesis::QuimeraEngine::Tools::Containers::QHashtable;
+using Kinesis::QuimeraEngine::Tools::Containers::SQIntegerHashProvider;
+
+/// <summary>
+/// The number of blocks allocated and deallocated by every thread in the multi-threaded tests.
+/// </summary>
+static const u32_q QLOCKFREEPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD = 16U;
+
+/// <summary>
+/// Allocates blocks, writes a value in each of them, checks that no other thread has overwritten them and deallocates them, several times.
+/// </summary>
+/// <param name="pAllocator">[IN/OUT] The allocator.</param>
+/// <param name="pbSucceeded">[OUT] False if any block could not be allocated or was overwritten by another thread; not modified otherwise.</param>
+static void QLockFreePoolAllocator_Test_AllocateAndDeallocate(QLockFreePoolAllocator* pAllocator, bool* pbSucceeded)
+{
+    u32_q* arBlocks[QLOCKFREEPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD];
+
+    for(u32_q uRound = 0; uRound < 1000U; ++uRound)
+    {
+        for(u32_q i = 0; i < QLOCKFREEPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD; ++i)
+        {
+            arBlocks[i] = scast_q(pAllocator->Allocate(), u32_q*);
+
+            if(arBlocks[i] == null_q)
+            {
+                *pbSucceeded = false;
+                return;
+            }
+
+            *arBlocks[i] = uRound * QLOCKFREEPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD + i;
+        }
+
+        for(u32_q i = 0; i < QLOCKFREEPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD; ++i)
+        {
+            if(*arBlocks[i] != uRound * QLOCKFREEPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD + i)
+                *pbSucceeded = false;
+
+            pAllocator->Deallocate(arBlocks[i]);
+        }
+    }
+}
+
+/// <summary>
+/// Deallocates a list of blocks.
+/// </summary>
+/// <param name="pAllocator">[IN/OUT] The allocator.</param>
+/// <param name="arBlocks">[IN] The blocks to deallocate, QLOCKFREEPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD blocks.</param>
+static void QLockFreePoolAllocator_Test_Deallocate(QLockFreePoolAllocator* pAllocator, void** arBlocks)
+{
+    for(u32_q i = 0; i < QLOCKFREEPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD; ++i)
+        pAllocator->Deallocate(arBlocks[i]);
+}
+
+
+QTEST_SUITE_BEGIN( QLockFreePoolAllocator_TestSuite )
+
+/// <summary>
+/// Checks that the properties are correctly initialized.
+/// </summary>
+QTEST_CASE ( Constructor_PropertiesAreCorrectlyInitialized_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_POOL_SIZE = 256U;
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 0;
+    const bool EXPECTED_CAN_ALLOCATE = true;
+    const QAlignment EXPECTED_ALIGNMENT(16U);
+
+    // [Execution]
+    QLockFreePoolAllocator allocator(EXPECTED_POOL_SIZE, 16U, EXPECTED_ALIGNMENT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetPoolSize(), EXPECTED_POOL_SIZE);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(allocator.CanAllocate(), EXPECTED_CAN_ALLOCATE);
+    BOOST_CHECK(allocator.GetAlignment() == EXPECTED_ALIGNMENT);
+    BOOST_CHECK(allocator.GetPointer() != null_q);
+    BOOST_CHECK(allocator.GetTotalSize() > EXPECTED_POOL_SIZE);
+}
+
+/// <summary>
+/// Checks that every block is different, aligned and belongs to the pool, and that blocks are allocated in ascending order.
+/// </summary>
+QTEST_CASE ( Allocate_BlocksAreAllocatedInAscendingOrderAndAligned_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = 16U;
+    const pointer_uint_q NUMBER_OF_BLOCKS = 8U;
+    const pointer_uint_q ALIGNMENT = 16U;
+    QLockFreePoolAllocator allocator(BLOCK_SIZE * NUMBER_OF_BLOCKS, BLOCK_SIZE, QAlignment(ALIGNMENT));
+    void* arBlocks[NUMBER_OF_BLOCKS];
+
+    // [Execution]
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BLOCKS; ++i)
+        arBlocks[i] = allocator.Allocate();
+
+    // [Verification]
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BLOCKS; ++i)
+    {
+        BOOST_CHECK(arBlocks[i] == scast_q(allocator.GetPointer(), u8_q*) + i * BLOCK_SIZE);
+        BOOST_CHECK_EQUAL(rcast_q(arBlocks[i], pointer_uint_q) % ALIGNMENT, 0U);
+    }
+}
+
+/// <summary>
+/// Checks that null is returned when all the blocks are allocated.
+/// </summary>
+QTEST_CASE ( Allocate_ReturnsNullWhenThereAreNoFreeBlocks_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = 16U;
+    const pointer_uint_q NUMBER_OF_BLOCKS = 4U;
+    const bool EXPECTED_CAN_ALLOCATE = false;
+    QLockFreePoolAllocator allocator(BLOCK_SIZE * NUMBER_OF_BLOCKS, BLOCK_SIZE, QAlignment(16U));
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BLOCKS; ++i)
+        allocator.Allocate();
+
+    // [Execution]
+    void* pBlock = allocator.Allocate();
+
+    // [Verification]
+    BOOST_CHECK(pBlock == null_q);
+    BOOST_CHECK_EQUAL(allocator.CanAllocate(), EXPECTED_CAN_ALLOCATE);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), BLOCK_SIZE * NUMBER_OF_BLOCKS);
+}
+
+/// <summary>
+/// Checks that the last deallocated block is the next one to be allocated.
+/// </summary>
+QTEST_CASE ( Deallocate_LastDeallocatedBlockIsAllocatedFirst_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = 16U;
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = BLOCK_SIZE * 2U;
+    QLockFreePoolAllocator allocator(BLOCK_SIZE * 4U, BLOCK_SIZE, QAlignment(16U));
+    void* pBlock1 = allocator.Allocate();
+    void* pBlock2 = allocator.Allocate();
+    allocator.Allocate();
+
+    // [Execution]
+    allocator.Deallocate(pBlock1);
+    allocator.Deallocate(pBlock2);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), BLOCK_SIZE);
+    BOOST_CHECK(allocator.Allocate() == pBlock2);
+    BOOST_CHECK(allocator.Allocate() == pBlock1);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES + BLOCK_SIZE);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the block does not belong to the allocator.
+/// </summary>
+QTEST_CASE ( Deallocate_AssertionFailsWhenBlockDoesNotBelongToTheAllocator_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QLockFreePoolAllocator allocator(64U, 16U, QAlignment(16U));
+    QLockFreePoolAllocator otherAllocator(64U, 16U, QAlignment(16U));
+    void* pBlock = otherAllocator.Allocate();
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Deallocate(pBlock);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the pool is shrunk while some of the discarded blocks are allocated.
+/// </summary>
+QTEST_CASE ( Shrink_AssertionFailsWhenDiscardedBlocksAreAllocated_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QLockFreePoolAllocator allocator(64U, 16U, QAlignment(16U));
+    allocator.Allocate();
+    allocator.Allocate();
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Shrink(16U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that all the blocks are free and allocated in ascending order after clearing the allocator.
+/// </summary>
+QTEST_CASE ( Clear_AllBlocksAreFreeAndAllocatedInAscendingOrder_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = 16U;
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 0;
+    QLockFreePoolAllocator allocator(BLOCK_SIZE * 4U, BLOCK_SIZE, QAlignment(16U));
+    void* pBlock1 = allocator.Allocate();
+    void* pBlock2 = allocator.Allocate();
+    allocator.Deallocate(pBlock1);
+
+    // [Execution]
+    allocator.Clear();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK(allocator.Allocate() == pBlock1);
+    BOOST_CHECK(allocator.Allocate() == pBlock2);
+}
+
+/// <summary>
+/// Checks that the content of the blocks and the free blocks are copied, and that the additional blocks of the destination are free.
+/// </summary>
+QTEST_CASE ( CopyTo_ContentAndFreeBlocksAreCopied_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = sizeof(u32_q);
+    const u32_q EXPECTED_VALUE = 0x12345678U;
+    QLockFreePoolAllocator source(BLOCK_SIZE * 3U, BLOCK_SIZE, QAlignment(4U));
+    QLockFreePoolAllocator destination(BLOCK_SIZE * 5U, BLOCK_SIZE, QAlignment(4U));
+    u32_q* pBlock1 = scast_q(source.Allocate(), u32_q*);
+    u32_q* pBlock2 = scast_q(source.Allocate(), u32_q*);
+    source.Allocate();
+    *pBlock2 = EXPECTED_VALUE;
+    source.Deallocate(pBlock1);
+    u32_q* pDestinationFirst = scast_q(destination.GetPointer(), u32_q*);
+
+    // [Execution]
+    source.CopyTo(destination);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(destination.GetAllocatedBytes(), source.GetAllocatedBytes());
+    BOOST_CHECK_EQUAL(pDestinationFirst[1], EXPECTED_VALUE);
+    BOOST_CHECK(destination.Allocate() == pDestinationFirst);
+    BOOST_CHECK(destination.Allocate() == pDestinationFirst + 3U);
+    BOOST_CHECK(destination.Allocate() == pDestinationFirst + 4U);
+    BOOST_CHECK(destination.Allocate() == null_q);
+}
+
+/// <summary>
+/// Checks that the allocated blocks keep their content and position, and that the new blocks are free, when the pool grows.
+/// </summary>
+QTEST_CASE ( Reallocate_AllocatedBlocksArePreservedAndNewBlocksAreFree_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = sizeof(u32_q);
+    const pointer_uint_q EXPECTED_POOL_SIZE = BLOCK_SIZE * 4U;
+    const u32_q EXPECTED_VALUE = 0x12345678U;
+    QLockFreePoolAllocator allocator(BLOCK_SIZE * 2U, BLOCK_SIZE, QAlignment(4U));
+    allocator.Allocate();
+    u32_q* pBlock = scast_q(allocator.Allocate(), u32_q*);
+    *pBlock = EXPECTED_VALUE;
+
+    // [Execution]
+    allocator.Reallocate(EXPECTED_POOL_SIZE);
+
+    // [Verification]
+    u32_q* pFirst = scast_q(allocator.GetPointer(), u32_q*);
+    BOOST_CHECK_EQUAL(allocator.GetPoolSize(), EXPECTED_POOL_SIZE);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), BLOCK_SIZE * 2U);
+    BOOST_CHECK_EQUAL(pFirst[1], EXPECTED_VALUE);
+    BOOST_CHECK(allocator.Allocate() == pFirst + 2U);
+    BOOST_CHECK(allocator.Allocate() == pFirst + 3U);
+    BOOST_CHECK(allocator.Allocate() == null_q);
+}
+
+/// <summary>
+/// Checks that the allocated blocks keep their content and the discarded free blocks cannot be allocated when the pool is shrunk.
+/// </summary>
+QTEST_CASE ( Shrink_AllocatedBlocksArePreservedAndDiscardedBlocksAreRemoved_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = sizeof(u32_q);
+    const pointer_uint_q EXPECTED_POOL_SIZE = BLOCK_SIZE * 2U;
+    const u32_q EXPECTED_VALUE = 0x12345678U;
+    QLockFreePoolAllocator allocator(BLOCK_SIZE * 4U, BLOCK_SIZE, QAlignment(4U));
+    u32_q* pBlock = scast_q(allocator.Allocate(), u32_q*);
+    *pBlock = EXPECTED_VALUE;
+
+    // [Execution]
+    allocator.Shrink(EXPECTED_POOL_SIZE);
+
+    // [Verification]
+    u32_q* pFirst = scast_q(allocator.GetPointer(), u32_q*);
+    BOOST_CHECK_EQUAL(allocator.GetPoolSize(), EXPECTED_POOL_SIZE);
+    BOOST_CHECK_EQUAL(pFirst[0], EXPECTED_VALUE);
+    BOOST_CHECK(allocator.Allocate() == pFirst + 1U);
+    BOOST_CHECK(allocator.Allocate() == null_q);
+}
+
+/// <summary>
+/// Checks that blocks are never allocated twice when several threads allocate and deallocate blocks at the same time.
+/// </summary>
+QTEST_CASE ( Allocate_BlocksAreNotSharedWhenUsedFromSeveralThreads_Test )
+{
+    // [Preparation]
+    const u32_q NUMBER_OF_THREADS = 4U;
+    const pointer_uint_q BLOCK_SIZE = sizeof(u32_q);
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 0;
+    QLockFreePoolAllocator allocator(BLOCK_SIZE * QLOCKFREEPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD * NUMBER_OF_THREADS, BLOCK_SIZE, QAlignment(4U));
+    bool bSucceeded = true;
+    QThread* arThreads[NUMBER_OF_THREADS];
+
+    // [Execution]
+    for(u32_q i = 0; i < NUMBER_OF_THREADS; ++i)
+        arThreads[i] = new QThread(QDelegate<void (QLockFreePoolAllocator*, bool*)>(&QLockFreePoolAllocator_Test_AllocateAndDeallocate), &allocator, &bSucceeded);
+
+    for(u32_q i = 0; i < NUMBER_OF_THREADS; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    // [Verification]
+    BOOST_CHECK(bSucceeded);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+}
+
+/// <summary>
+/// Checks that blocks deallocated by other threads can be allocated again.
+/// </summary>
+QTEST_CASE ( Deallocate_BlocksDeallocatedByOtherThreadsCanBeAllocatedAgain_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = 16U;
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = BLOCK_SIZE * QLOCKFREEPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD;
+    QLockFreePoolAllocator allocator(BLOCK_SIZE * QLOCKFREEPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD, BLOCK_SIZE, QAlignment(16U));
+    void* arBlocks[QLOCKFREEPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD];
+
+    for(u32_q i = 0; i < QLOCKFREEPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD; ++i)
+        arBlocks[i] = allocator.Allocate();
+
+    // [Execution]
+    QThread thread(QDelegate<void (QLockFreePoolAllocator*, void**)>(&QLockFreePoolAllocator_Test_Deallocate), &allocator, arBlocks);
+    thread.Join();
+
+    for(u32_q i = 0; i < QLOCKFREEPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD; ++i)
+        allocator.Allocate();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK(allocator.Allocate() == null_q);
+}
+
+/// <summary>
+/// Checks that the allocator can be used by lists, including operations that resize and copy the allocator.
+/// </summary>
+QTEST_CASE ( Allocator_CanBeUsedByLists_Test )
+{
+    // [Preparation]
+    const u32_q NUMBER_OF_ELEMENTS = 100U;
+    QList<u32_q, QLockFreePoolAllocator> list(2U);
+
+    // [Execution]
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        list.Add(i);
+
+    list.Remove(0);
+    list.Insert(0, 0);
+    QList<u32_q, QLockFreePoolAllocator> listCopy(list);
+    listCopy.ShrinkToFit();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(listCopy.GetCount(), NUMBER_OF_ELEMENTS);
+
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        BOOST_CHECK_EQUAL(listCopy[i], i);
+}
+
+/// <summary>
+/// Checks that the allocator can be used by hashtables.
+/// </summary>
+QTEST_CASE ( Allocator_CanBeUsedByHashtables_Test )
+{
+    // [Preparation]
+    const u32_q NUMBER_OF_ELEMENTS = 100U;
+    QHashtable<u32_q, u32_q, SQIntegerHashProvider, QLockFreePoolAllocator> hashtable(4U, 2U);
+
+    // [Execution]
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        hashtable.Add(i, i * 2U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(hashtable.GetCount(), NUMBER_OF_ELEMENTS);
+
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        BOOST_CHECK_EQUAL(hashtable[i], i * 2U);
+}
+
+// End - Test Suite: QLockFreePoolAllocator
+QTEST_SUITE_END()
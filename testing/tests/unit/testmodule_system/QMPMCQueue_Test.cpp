@@ -0,0 +1,390 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QMPMCQueue.h"
+#include "QThread.h"
+#include "SQThisThread.h"
+#include "QDelegate.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::System::Threading::QMPMCQueue;
+using Kinesis::QuimeraEngine::System::Threading::SQThisThread;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+
+/// <summary>
+/// The number of elements added by every producer thread in the multi-threaded tests.
+/// </summary>
+static const u32_q QMPMCQUEUE_TEST_ELEMENTS_PER_THREAD = 5000U;
+
+/// <summary>
+/// The number of producer threads and of consumer threads in the multi-threaded tests.
+/// </summary>
+static const u32_q QMPMCQUEUE_TEST_NUMBER_OF_THREADS = 4U;
+
+/// <summary>
+/// Adds a range of consecutive numbers to a queue, waiting when it is full.
+/// </summary>
+/// <param name="pQueue">[IN/OUT] The queue.</param>
+/// <param name="uFirstNumber">[IN] The first number of the range.</param>
+static void QMPMCQueue_Test_PushNumbers(QMPMCQueue<u32_q>* pQueue, const u32_q uFirstNumber)
+{
+    for(u32_q i = uFirstNumber; i < uFirstNumber + QMPMCQUEUE_TEST_ELEMENTS_PER_THREAD; ++i)
+        pQueue->Push(i);
+}
+
+/// <summary>
+/// Adds a range of consecutive numbers to a queue, retrying when it is full.
+/// </summary>
+/// <param name="pQueue">[IN/OUT] The queue.</param>
+/// <param name="uFirstNumber">[IN] The first number of the range.</param>
+static void QMPMCQueue_Test_TryPushNumbers(QMPMCQueue<u32_q>* pQueue, const u32_q uFirstNumber)
+{
+    for(u32_q i = uFirstNumber; i < uFirstNumber + QMPMCQUEUE_TEST_ELEMENTS_PER_THREAD; ++i)
+    {
+        while(!pQueue->TryPush(i))
+            SQThisThread::Yield();
+    }
+}
+
+/// <summary>
+/// Extracts as many numbers from a queue as a producer adds, waiting when it is empty, and counts how many times every number is received.
+/// </summary>
+/// <param name="pQueue">[IN/OUT] The queue.</param>
+/// <param name="arTimesReceived">[IN/OUT] The number of times every number has been received, indexed by the number.</param>
+static void QMPMCQueue_Test_PopNumbers(QMPMCQueue<u32_q>* pQueue, u32_q* arTimesReceived)
+{
+    for(u32_q i = 0; i < QMPMCQUEUE_TEST_ELEMENTS_PER_THREAD; ++i)
+    {
+        u32_q uNumber = 0;
+        pQueue->Pop(uNumber);
+        ++arTimesReceived[uNumber];
+    }
+}
+
+/// <summary>
+/// Extracts as many numbers from a queue as a producer adds, retrying when it is empty, and counts how many times every number is received.
+/// </summary>
+/// <param name="pQueue">[IN/OUT] The queue.</param>
+/// <param name="arTimesReceived">[IN/OUT] The number of times every number has been received, indexed by the number.</param>
+static void QMPMCQueue_Test_TryPopNumbers(QMPMCQueue<u32_q>* pQueue, u32_q* arTimesReceived)
+{
+    for(u32_q i = 0; i < QMPMCQUEUE_TEST_ELEMENTS_PER_THREAD; ++i)
+    {
+        u32_q uNumber = 0;
+
+        while(!pQueue->TryPop(uNumber))
+            SQThisThread::Yield();
+
+        ++arTimesReceived[uNumber];
+    }
+}
+
+/// <summary>
+/// Runs several producer threads and several consumer threads on the same queue and checks that every number has been received exactly once.
+/// </summary>
+/// <param name="pushFunction">[IN] The function executed by producers.</param>
+/// <param name="popFunction">[IN] The function executed by consumers.</param>
+/// <returns>
+/// True if every number added by the producers has been received once; False otherwise.
+/// </returns>
+static bool QMPMCQueue_Test_TransferNumbers(const QDelegate<void (QMPMCQueue<u32_q>*, const u32_q)> &pushFunction, 
+                                            const QDelegate<void (QMPMCQueue<u32_q>*, u32_q*)> &popFunction)
+{
+    using Kinesis::QuimeraEngine::System::Threading::QThread;
+
+    const u32_q NUMBER_OF_ELEMENTS = QMPMCQUEUE_TEST_NUMBER_OF_THREADS * QMPMCQUEUE_TEST_ELEMENTS_PER_THREAD;
+    QMPMCQueue<u32_q> queue(16U);
+    u32_q arTimesReceived[NUMBER_OF_ELEMENTS];
+    memset(arTimesReceived, 0, sizeof(arTimesReceived));
+    QThread* arThreads[QMPMCQUEUE_TEST_NUMBER_OF_THREADS * 2U];
+
+    for(u32_q i = 0; i < QMPMCQUEUE_TEST_NUMBER_OF_THREADS; ++i)
+    {
+        arThreads[i * 2U] = new QThread(popFunction, &queue, arTimesReceived);
+        arThreads[i * 2U + 1U] = new QThread(pushFunction, &queue, i * QMPMCQUEUE_TEST_ELEMENTS_PER_THREAD);
+    }
+
+    for(u32_q i = 0; i < QMPMCQUEUE_TEST_NUMBER_OF_THREADS * 2U; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    bool bEveryNumberReceivedOnce = queue.IsEmpty();
+
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        bEveryNumberReceivedOnce = bEveryNumberReceivedOnce && arTimesReceived[i] == 1U;
+
+    return bEveryNumberReceivedOnce;
+}
+
+
+QTEST_SUITE_BEGIN( QMPMCQueue_TestSuite )
+
+/// <summary>
+/// Checks that the capacity is correctly stored and the queue is empty.
+/// </summary>
+QTEST_CASE ( Constructor_CapacityIsCorrectAndQueueIsEmpty_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 16U;
+    const pointer_uint_q EXPECTED_COUNT = 0;
+
+    // [Execution]
+    QMPMCQueue<u32_q> queue(EXPECTED_CAPACITY);
+
+    // [Verification]
+    pointer_uint_q uCapacity = queue.GetCapacity();
+    pointer_uint_q uCount = queue.GetCount();
+
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the capacity is not a power of two.
+/// </summary>
+QTEST_CASE ( Constructor_AssertionFailsWhenCapacityIsNotPowerOfTwo_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QMPMCQueue<u32_q> queue(12U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the capacity is one.
+/// </summary>
+QTEST_CASE ( Constructor_AssertionFailsWhenCapacityIsOne_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QMPMCQueue<u32_q> queue(1U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that elements are extracted in the same order they were added, also when the positions wrap around the end of the buffer.
+/// </summary>
+QTEST_CASE ( TryPop_ElementsAreExtractedInTheSameOrderTheyWereAdded_Test )
+{
+    // [Preparation]
+    const u32_q ELEMENTS_TO_ADD = 10U;
+    const bool EXPECTED_ORDER_IS_CORRECT = true;
+    QMPMCQueue<u32_q> queue(4U);
+
+    // [Execution]
+    bool bOrderIsCorrect = true;
+    u32_q uNextExpectedElement = 0;
+
+    for(u32_q i = 0; i < ELEMENTS_TO_ADD; ++i)
+    {
+        queue.TryPush(i);
+
+        if(i % 2U == 1U)
+        {
+            u32_q uFirstElement = 0;
+            u32_q uSecondElement = 0;
+            queue.TryPop(uFirstElement);
+            queue.TryPop(uSecondElement);
+            bOrderIsCorrect = bOrderIsCorrect && uFirstElement == uNextExpectedElement && uSecondElement == uNextExpectedElement + 1U;
+            uNextExpectedElement += 2U;
+        }
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bOrderIsCorrect, EXPECTED_ORDER_IS_CORRECT);
+}
+
+/// <summary>
+/// Checks that it returns False and the element is not added when the queue is full.
+/// </summary>
+QTEST_CASE ( TryPush_ReturnsFalseWhenQueueIsFull_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT_WHEN_NOT_FULL = true;
+    const bool EXPECTED_RESULT_WHEN_FULL = false;
+    const pointer_uint_q EXPECTED_COUNT = 4U;
+    QMPMCQueue<u32_q> queue(4U);
+    queue.TryPush(0U);
+    queue.TryPush(1U);
+    queue.TryPush(2U);
+
+    // [Execution]
+    bool bResultWhenNotFull = queue.TryPush(3U);
+    bool bResultWhenFull = queue.TryPush(4U);
+
+    // [Verification]
+    pointer_uint_q uCount = queue.GetCount();
+
+    BOOST_CHECK_EQUAL(bResultWhenNotFull, EXPECTED_RESULT_WHEN_NOT_FULL);
+    BOOST_CHECK_EQUAL(bResultWhenFull, EXPECTED_RESULT_WHEN_FULL);
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that it returns False and the output element is not modified when the queue is empty.
+/// </summary>
+QTEST_CASE ( TryPop_ReturnsFalseAndElementIsNotModifiedWhenQueueIsEmpty_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = false;
+    const u32_q EXPECTED_ELEMENT = 123U;
+    QMPMCQueue<u32_q> queue(4U);
+    queue.TryPush(1U);
+    u32_q uElement = 0;
+    queue.TryPop(uElement);
+    uElement = EXPECTED_ELEMENT;
+
+    // [Execution]
+    bool bResult = queue.TryPop(uElement);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(uElement, EXPECTED_ELEMENT);
+}
+
+/// <summary>
+/// Checks that the elements that remain in the queue are destroyed along with it.
+/// </summary>
+QTEST_CASE ( Destructor_RemainingElementsAreDestroyed_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+
+    // [Preparation]
+    const string_q EXPECTED_ELEMENT("A string long enough to be stored out of the instance");
+    QMPMCQueue<string_q>* pQueue = new QMPMCQueue<string_q>(4U);
+    string_q strElement;
+
+    // The positions of the remaining elements wrap around the end of the buffer
+    for(u32_q i = 0; i < 3U; ++i)
+        pQueue->TryPush(EXPECTED_ELEMENT);
+
+    pQueue->TryPop(strElement);
+    pQueue->TryPop(strElement);
+    pQueue->TryPush(EXPECTED_ELEMENT);
+    pQueue->TryPush(EXPECTED_ELEMENT);
+
+    // [Execution]
+    delete pQueue;
+
+    // [Verification]
+    // Memory leaks are detected by memory analysis tools
+    BOOST_CHECK(strElement == EXPECTED_ELEMENT);
+}
+
+/// <summary>
+/// Checks that every element added by several threads is extracted once by several other threads when the queue is used without blocking.
+/// </summary>
+QTEST_CASE ( TryPop_ElementsAddedBySeveralThreadsAreExtractedOnceBySeveralThreads_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = true;
+    QDelegate<void (QMPMCQueue<u32_q>*, const u32_q)> pushFunction(&QMPMCQueue_Test_TryPushNumbers);
+    QDelegate<void (QMPMCQueue<u32_q>*, u32_q*)> popFunction(&QMPMCQueue_Test_TryPopNumbers);
+
+    // [Execution]
+    bool bResult = QMPMCQueue_Test_TransferNumbers(pushFunction, popFunction);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that every element added by several threads is extracted once by several other threads when the threads wait for each other.
+/// </summary>
+QTEST_CASE ( Pop_ElementsAddedBySeveralThreadsAreExtractedOnceBySeveralThreadsWhenThreadsWait_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = true;
+    QDelegate<void (QMPMCQueue<u32_q>*, const u32_q)> pushFunction(&QMPMCQueue_Test_PushNumbers);
+    QDelegate<void (QMPMCQueue<u32_q>*, u32_q*)> popFunction(&QMPMCQueue_Test_PopNumbers);
+
+    // [Execution]
+    bool bResult = QMPMCQueue_Test_TransferNumbers(pushFunction, popFunction);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that it returns whether there are elements in the queue.
+/// </summary>
+QTEST_CASE ( IsEmpty_ReturnsTrueOnlyWhenThereAreNoElements_Test )
+{
+    // [Preparation]
+    QMPMCQueue<u32_q> queue(4U);
+    bool bIsEmptyBeforeAdding = queue.IsEmpty();
+    queue.TryPush(1U);
+
+    // [Execution]
+    bool bIsEmptyAfterAdding = queue.IsEmpty();
+
+    // [Verification]
+    BOOST_CHECK(bIsEmptyBeforeAdding);
+    BOOST_CHECK(!bIsEmptyAfterAdding);
+}
+
+// End - Test Suite: QMPMCQueue
+QTEST_SUITE_END()
@@ -0,0 +1,344 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QSPSCQueue.h"
+#include "QThread.h"
+#include "SQThisThread.h"
+#include "QDelegate.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::System::Threading::QSPSCQueue;
+using Kinesis::QuimeraEngine::System::Threading::SQThisThread;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+
+/// <summary>
+/// The number of elements passed from one thread to another in the multi-threaded tests.
+/// </summary>
+static const u32_q QSPSCQUEUE_TEST_ELEMENTS_TO_TRANSFER = 20000U;
+
+/// <summary>
+/// Adds consecutive numbers to a queue, starting at zero, waiting when it is full.
+/// </summary>
+/// <param name="pQueue">[IN/OUT] The queue.</param>
+/// <param name="uCount">[IN] The amount of numbers to add.</param>
+static void QSPSCQueue_Test_PushNumbers(QSPSCQueue<u32_q>* pQueue, const u32_q uCount)
+{
+    for(u32_q i = 0; i < uCount; ++i)
+        pQueue->Push(i);
+}
+
+/// <summary>
+/// Adds consecutive numbers to a queue, starting at zero, retrying when it is full.
+/// </summary>
+/// <param name="pQueue">[IN/OUT] The queue.</param>
+/// <param name="uCount">[IN] The amount of numbers to add.</param>
+static void QSPSCQueue_Test_TryPushNumbers(QSPSCQueue<u32_q>* pQueue, const u32_q uCount)
+{
+    for(u32_q i = 0; i < uCount; ++i)
+    {
+        while(!pQueue->TryPush(i))
+            SQThisThread::Yield();
+    }
+}
+
+
+QTEST_SUITE_BEGIN( QSPSCQueue_TestSuite )
+
+/// <summary>
+/// Checks that the capacity is correctly stored and the queue is empty.
+/// </summary>
+QTEST_CASE ( Constructor_CapacityIsCorrectAndQueueIsEmpty_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 16U;
+    const pointer_uint_q EXPECTED_COUNT = 0;
+
+    // [Execution]
+    QSPSCQueue<u32_q> queue(EXPECTED_CAPACITY);
+
+    // [Verification]
+    pointer_uint_q uCapacity = queue.GetCapacity();
+    pointer_uint_q uCount = queue.GetCount();
+
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the capacity is not a power of two.
+/// </summary>
+QTEST_CASE ( Constructor_AssertionFailsWhenCapacityIsNotPowerOfTwo_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QSPSCQueue<u32_q> queue(12U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the capacity is one.
+/// </summary>
+QTEST_CASE ( Constructor_AssertionFailsWhenCapacityIsOne_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QSPSCQueue<u32_q> queue(1U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that elements are extracted in the same order they were added, also when the positions wrap around the end of the buffer.
+/// </summary>
+QTEST_CASE ( TryPop_ElementsAreExtractedInTheSameOrderTheyWereAdded_Test )
+{
+    // [Preparation]
+    const u32_q ELEMENTS_TO_ADD = 10U;
+    const bool EXPECTED_ORDER_IS_CORRECT = true;
+    QSPSCQueue<u32_q> queue(4U);
+
+    // [Execution]
+    bool bOrderIsCorrect = true;
+    u32_q uNextExpectedElement = 0;
+
+    for(u32_q i = 0; i < ELEMENTS_TO_ADD; ++i)
+    {
+        queue.TryPush(i);
+
+        if(i % 2U == 1U)
+        {
+            u32_q uFirstElement = 0;
+            u32_q uSecondElement = 0;
+            queue.TryPop(uFirstElement);
+            queue.TryPop(uSecondElement);
+            bOrderIsCorrect = bOrderIsCorrect && uFirstElement == uNextExpectedElement && uSecondElement == uNextExpectedElement + 1U;
+            uNextExpectedElement += 2U;
+        }
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bOrderIsCorrect, EXPECTED_ORDER_IS_CORRECT);
+}
+
+/// <summary>
+/// Checks that it returns False and the element is not added when the queue is full.
+/// </summary>
+QTEST_CASE ( TryPush_ReturnsFalseWhenQueueIsFull_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT_WHEN_NOT_FULL = true;
+    const bool EXPECTED_RESULT_WHEN_FULL = false;
+    const pointer_uint_q EXPECTED_COUNT = 4U;
+    QSPSCQueue<u32_q> queue(4U);
+    queue.TryPush(0U);
+    queue.TryPush(1U);
+    queue.TryPush(2U);
+
+    // [Execution]
+    bool bResultWhenNotFull = queue.TryPush(3U);
+    bool bResultWhenFull = queue.TryPush(4U);
+
+    // [Verification]
+    pointer_uint_q uCount = queue.GetCount();
+
+    BOOST_CHECK_EQUAL(bResultWhenNotFull, EXPECTED_RESULT_WHEN_NOT_FULL);
+    BOOST_CHECK_EQUAL(bResultWhenFull, EXPECTED_RESULT_WHEN_FULL);
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that it returns False and the output element is not modified when the queue is empty.
+/// </summary>
+QTEST_CASE ( TryPop_ReturnsFalseAndElementIsNotModifiedWhenQueueIsEmpty_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = false;
+    const u32_q EXPECTED_ELEMENT = 123U;
+    QSPSCQueue<u32_q> queue(4U);
+    queue.TryPush(1U);
+    u32_q uElement = 0;
+    queue.TryPop(uElement);
+    uElement = EXPECTED_ELEMENT;
+
+    // [Execution]
+    bool bResult = queue.TryPop(uElement);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(uElement, EXPECTED_ELEMENT);
+}
+
+/// <summary>
+/// Checks that the elements that remain in the queue are destroyed along with it.
+/// </summary>
+QTEST_CASE ( Destructor_RemainingElementsAreDestroyed_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+
+    // [Preparation]
+    const string_q EXPECTED_ELEMENT("A string long enough to be stored out of the instance");
+    QSPSCQueue<string_q>* pQueue = new QSPSCQueue<string_q>(4U);
+    string_q strElement;
+
+    // The positions of the remaining elements wrap around the end of the buffer
+    for(u32_q i = 0; i < 3U; ++i)
+        pQueue->TryPush(EXPECTED_ELEMENT);
+
+    pQueue->TryPop(strElement);
+    pQueue->TryPop(strElement);
+    pQueue->TryPush(EXPECTED_ELEMENT);
+    pQueue->TryPush(EXPECTED_ELEMENT);
+
+    // [Execution]
+    delete pQueue;
+
+    // [Verification]
+    // Memory leaks are detected by memory analysis tools
+    BOOST_CHECK(strElement == EXPECTED_ELEMENT);
+}
+
+/// <summary>
+/// Checks that all the elements added by a thread are extracted by another thread in the same order when the queue is used without blocking.
+/// </summary>
+QTEST_CASE ( TryPop_ElementsAddedByAnotherThreadAreExtractedInOrder_Test )
+{
+    using Kinesis::QuimeraEngine::System::Threading::QThread;
+
+    // [Preparation]
+    const bool EXPECTED_ORDER_IS_CORRECT = true;
+    QSPSCQueue<u32_q> queue(64U);
+    QDelegate<void (QSPSCQueue<u32_q>*, const u32_q)> pushFunction(&QSPSCQueue_Test_TryPushNumbers);
+
+    // [Execution]
+    QThread producer(pushFunction, &queue, QSPSCQUEUE_TEST_ELEMENTS_TO_TRANSFER);
+
+    bool bOrderIsCorrect = true;
+
+    for(u32_q i = 0; i < QSPSCQUEUE_TEST_ELEMENTS_TO_TRANSFER; ++i)
+    {
+        u32_q uElement = 0;
+
+        while(!queue.TryPop(uElement))
+            SQThisThread::Yield();
+
+        bOrderIsCorrect = bOrderIsCorrect && uElement == i;
+    }
+
+    producer.Join();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bOrderIsCorrect, EXPECTED_ORDER_IS_CORRECT);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that all the elements added by a thread are extracted by another thread in the same order when both threads wait for each other.
+/// </summary>
+QTEST_CASE ( Pop_ElementsAddedByAnotherThreadAreExtractedInOrderWhenThreadsWait_Test )
+{
+    using Kinesis::QuimeraEngine::System::Threading::QThread;
+
+    // [Preparation]
+    const bool EXPECTED_ORDER_IS_CORRECT = true;
+    QSPSCQueue<u32_q> queue(4U);
+    QDelegate<void (QSPSCQueue<u32_q>*, const u32_q)> pushFunction(&QSPSCQueue_Test_PushNumbers);
+
+    // [Execution]
+    QThread producer(pushFunction, &queue, QSPSCQUEUE_TEST_ELEMENTS_TO_TRANSFER);
+
+    bool bOrderIsCorrect = true;
+
+    for(u32_q i = 0; i < QSPSCQUEUE_TEST_ELEMENTS_TO_TRANSFER; ++i)
+    {
+        u32_q uElement = 0;
+        queue.Pop(uElement);
+        bOrderIsCorrect = bOrderIsCorrect && uElement == i;
+    }
+
+    producer.Join();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bOrderIsCorrect, EXPECTED_ORDER_IS_CORRECT);
+    BOOST_CHECK(queue.IsEmpty());
+}
+
+/// <summary>
+/// Checks that it returns whether there are elements in the queue.
+/// </summary>
+QTEST_CASE ( IsEmpty_ReturnsTrueOnlyWhenThereAreNoElements_Test )
+{
+    // [Preparation]
+    QSPSCQueue<u32_q> queue(4U);
+    bool bIsEmptyBeforeAdding = queue.IsEmpty();
+    queue.TryPush(1U);
+
+    // [Execution]
+    bool bIsEmptyAfterAdding = queue.IsEmpty();
+
+    // [Verification]
+    BOOST_CHECK(bIsEmptyBeforeAdding);
+    BOOST_CHECK(!bIsEmptyAfterAdding);
+}
+
+// End - Test Suite: QSPSCQueue
+QTEST_SUITE_END()
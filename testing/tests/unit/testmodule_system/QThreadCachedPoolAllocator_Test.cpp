@@ -0,0 +1,428 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include <boost/atomic.hpp>
+
+#include "QThreadCachedPoolAllocator.h"
+#include "QThread.h"
+#include "SQThisThread.h"
+#include "QDelegate.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::System::Threading::QThreadCachedPoolAllocator;
+using Kinesis::QuimeraEngine::System::Threading::QThread;
+using Kinesis::QuimeraEngine::System::Threading::SQThisThread;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::QDelegate;
+
+/// <summary>
+/// The number of blocks allocated and deallocated by every thread in the multi-threaded tests.
+/// </summary>
+static const u32_q QTHREADCACHEDPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD = 16U;
+
+/// <summary>
+/// Allocates blocks, writes a value in each of them, checks that no other thread has overwritten them and deallocates them, several times.
+/// </summary>
+/// <param name="pAllocator">[IN/OUT] The allocator.</param>
+/// <param name="pbSucceeded">[OUT] False if any block could not be allocated or was overwritten by another thread; not modified otherwise.</param>
+static void QThreadCachedPoolAllocator_Test_AllocateAndDeallocate(QThreadCachedPoolAllocator* pAllocator, bool* pbSucceeded)
+{
+    u32_q* arBlocks[QTHREADCACHEDPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD];
+
+    for(u32_q uRound = 0; uRound < 1000U; ++uRound)
+    {
+        for(u32_q i = 0; i < QTHREADCACHEDPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD; ++i)
+        {
+            arBlocks[i] = scast_q(pAllocator->Allocate(), u32_q*);
+
+            if(arBlocks[i] == null_q)
+            {
+                *pbSucceeded = false;
+                return;
+            }
+
+            *arBlocks[i] = uRound * QTHREADCACHEDPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD + i;
+        }
+
+        for(u32_q i = 0; i < QTHREADCACHEDPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD; ++i)
+        {
+            if(*arBlocks[i] != uRound * QTHREADCACHEDPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD + i)
+                *pbSucceeded = false;
+
+            pAllocator->Deallocate(arBlocks[i]);
+        }
+    }
+}
+
+/// <summary>
+/// Deallocates a list of blocks.
+/// </summary>
+/// <param name="pAllocator">[IN/OUT] The allocator.</param>
+/// <param name="arBlocks">[IN] The blocks to deallocate, QTHREADCACHEDPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD blocks.</param>
+static void QThreadCachedPoolAllocator_Test_Deallocate(QThreadCachedPoolAllocator* pAllocator, void** arBlocks)
+{
+    for(u32_q i = 0; i < QTHREADCACHEDPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD; ++i)
+        pAllocator->Deallocate(arBlocks[i]);
+}
+
+/// <summary>
+/// Allocates and deallocates a block, so the calling thread keeps a cache with blocks, notifies that it will not use the allocator anymore and 
+/// waits until the allocator is about to be destroyed, so the thread finishes while it is being destroyed.
+/// </summary>
+/// <param name="pAllocator">[IN/OUT] The allocator.</param>
+/// <param name="puFinishedThreads">[IN/OUT] The number of threads that will not use the allocator anymore, which is incremented.</param>
+/// <param name="pbIsBeingDestroyed">[IN] Indicates whether the allocator is about to be destroyed.</param>
+static void QThreadCachedPoolAllocator_Test_AllocateAndFinish(QThreadCachedPoolAllocator* pAllocator, boost::atomic<u32_q>* puFinishedThreads, boost::atomic<bool>* pbIsBeingDestroyed)
+{
+    pAllocator->Deallocate(pAllocator->Allocate());
+    ++(*puFinishedThreads);
+
+    while(!*pbIsBeingDestroyed)
+        SQThisThread::Yield();
+}
+
+
+QTEST_SUITE_BEGIN( QThreadCachedPoolAllocator_TestSuite )
+
+/// <summary>
+/// Checks that the properties are correctly initialized.
+/// </summary>
+QTEST_CASE ( Constructor1_PropertiesAreCorrectlyInitialized_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_POOL_SIZE = 256U;
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 0;
+    const pointer_uint_q EXPECTED_CACHE_CAPACITY = QThreadCachedPoolAllocator::DEFAULT_CACHE_CAPACITY;
+    const QAlignment EXPECTED_ALIGNMENT(16U);
+
+    // [Execution]
+    QThreadCachedPoolAllocator allocator(EXPECTED_POOL_SIZE, 16U, EXPECTED_ALIGNMENT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetPoolSize(), EXPECTED_POOL_SIZE);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL(allocator.GetCacheCapacity(), EXPECTED_CACHE_CAPACITY);
+    BOOST_CHECK(allocator.GetAlignment() == EXPECTED_ALIGNMENT);
+}
+
+/// <summary>
+/// Checks that the capacity of the cache is correctly stored.
+/// </summary>
+QTEST_CASE ( Constructor2_CacheCapacityIsCorrectlyStored_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CACHE_CAPACITY = 8U;
+
+    // [Execution]
+    QThreadCachedPoolAllocator allocator(256U, 16U, QAlignment(16U), EXPECTED_CACHE_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetCacheCapacity(), EXPECTED_CACHE_CAPACITY);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the capacity of the cache is lower than 2.
+/// </summary>
+QTEST_CASE ( Constructor2_AssertionFailsWhenCacheCapacityIsLowerThanTwo_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QThreadCachedPoolAllocator allocator(256U, 16U, QAlignment(16U), 1U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the allocator can be destroyed while the threads that used it are finishing and destroying their caches.
+/// </summary>
+QTEST_CASE ( Destructor_AllocatorCanBeDestroyedWhileThreadsAreFinishing_Test )
+{
+    // [Preparation]
+    const u32_q NUMBER_OF_THREADS = 4U;
+    const u32_q NUMBER_OF_ROUNDS = 100U;
+    const pointer_uint_q BLOCK_SIZE = 16U;
+    const pointer_uint_q CACHE_CAPACITY = 8U;
+    const bool NOTHING_HAPPENS = true;
+
+    // [Execution]
+    for(u32_q uRound = 0; uRound < NUMBER_OF_ROUNDS; ++uRound)
+    {
+        QThreadCachedPoolAllocator* pAllocator = new QThreadCachedPoolAllocator(BLOCK_SIZE * CACHE_CAPACITY * NUMBER_OF_THREADS, BLOCK_SIZE, QAlignment(16U), CACHE_CAPACITY);
+        boost::atomic<u32_q> uFinishedThreads(0);
+        boost::atomic<bool> bIsBeingDestroyed(false);
+        QThread* arThreads[NUMBER_OF_THREADS];
+
+        for(u32_q i = 0; i < NUMBER_OF_THREADS; ++i)
+            arThreads[i] = new QThread(QDelegate<void (QThreadCachedPoolAllocator*, boost::atomic<u32_q>*, boost::atomic<bool>*)>(&QThreadCachedPoolAllocator_Test_AllocateAndFinish), 
+                                       pAllocator, 
+                                       &uFinishedThreads, 
+                                       &bIsBeingDestroyed);
+
+        // The threads do not use the allocator when it is destroyed, but they destroy their caches at the same time
+        while(uFinishedThreads < NUMBER_OF_THREADS)
+            SQThisThread::Yield();
+
+        bIsBeingDestroyed = true;
+        delete pAllocator;
+
+        for(u32_q i = 0; i < NUMBER_OF_THREADS; ++i)
+        {
+            arThreads[i]->Join();
+            delete arThreads[i];
+        }
+    }
+
+    // [Verification]
+    BOOST_CHECK(NOTHING_HAPPENS);
+}
+
+/// <summary>
+/// Checks that every block is different, aligned and belongs to the pool.
+/// </summary>
+QTEST_CASE ( Allocate_BlocksAreDifferentAlignedAndInsideThePool_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = 16U;
+    const pointer_uint_q NUMBER_OF_BLOCKS = 8U;
+    const pointer_uint_q ALIGNMENT = 16U;
+    QThreadCachedPoolAllocator allocator(BLOCK_SIZE * NUMBER_OF_BLOCKS, BLOCK_SIZE, QAlignment(ALIGNMENT), 4U);
+    void* arBlocks[NUMBER_OF_BLOCKS];
+
+    // [Execution]
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BLOCKS; ++i)
+        arBlocks[i] = allocator.Allocate();
+
+    // [Verification]
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BLOCKS; ++i)
+    {
+        BOOST_CHECK(arBlocks[i] != null_q);
+        BOOST_CHECK_EQUAL(rcast_q(arBlocks[i], pointer_uint_q) % ALIGNMENT, 0U);
+
+        for(pointer_uint_q j = i + 1U; j < NUMBER_OF_BLOCKS; ++j)
+            BOOST_CHECK(arBlocks[i] != arBlocks[j]);
+    }
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BLOCKS; ++i)
+        allocator.Deallocate(arBlocks[i]);
+}
+
+/// <summary>
+/// Checks that null is returned when all the blocks are allocated.
+/// </summary>
+QTEST_CASE ( Allocate_ReturnsNullWhenThereAreNoFreeBlocks_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = 16U;
+    const pointer_uint_q NUMBER_OF_BLOCKS = 4U;
+    QThreadCachedPoolAllocator allocator(BLOCK_SIZE * NUMBER_OF_BLOCKS, BLOCK_SIZE, QAlignment(16U), 4U);
+    void* arBlocks[NUMBER_OF_BLOCKS];
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BLOCKS; ++i)
+        arBlocks[i] = allocator.Allocate();
+
+    // [Execution]
+    void* pBlock = allocator.Allocate();
+
+    // [Verification]
+    BOOST_CHECK(pBlock == null_q);
+    BOOST_CHECK(!allocator.CanAllocate());
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BLOCKS; ++i)
+        allocator.Deallocate(arBlocks[i]);
+}
+
+/// <summary>
+/// Checks that the last deallocated block is the next one to be allocated by the same thread.
+/// </summary>
+QTEST_CASE ( Deallocate_DeallocatedBlockIsReused_Test )
+{
+    // [Preparation]
+    QThreadCachedPoolAllocator allocator(256U, 16U, QAlignment(16U), 4U);
+    void* pFirstBlock = allocator.Allocate();
+    void* pSecondBlock = allocator.Allocate();
+
+    // [Execution]
+    allocator.Deallocate(pFirstBlock);
+    void* pReusedBlock = allocator.Allocate();
+
+    // [Verification]
+    BOOST_CHECK(pReusedBlock == pFirstBlock);
+
+    allocator.Deallocate(pReusedBlock);
+    allocator.Deallocate(pSecondBlock);
+}
+
+/// <summary>
+/// Checks that the blocks exceeding the capacity of the cache are returned to the central pool.
+/// </summary>
+QTEST_CASE ( Deallocate_BlocksAreReturnedToCentralPoolWhenCacheIsFull_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = 16U;
+    const pointer_uint_q NUMBER_OF_BLOCKS = 8U;
+    const pointer_uint_q CACHE_CAPACITY = 4U;
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = CACHE_CAPACITY * BLOCK_SIZE;
+    QThreadCachedPoolAllocator allocator(BLOCK_SIZE * NUMBER_OF_BLOCKS, BLOCK_SIZE, QAlignment(16U), CACHE_CAPACITY);
+    void* arBlocks[NUMBER_OF_BLOCKS];
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BLOCKS; ++i)
+        arBlocks[i] = allocator.Allocate();
+
+    // [Execution]
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BLOCKS; ++i)
+        allocator.Deallocate(arBlocks[i]);
+
+    // [Verification]
+    // The cache got full twice, returning half of its capacity each time, and it ends full; only the cached blocks remain taken from the central pool
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+}
+
+/// <summary>
+/// Checks that blocks allocated by one thread can be deallocated by another thread.
+/// </summary>
+QTEST_CASE ( Deallocate_BlocksCanBeDeallocatedByAnotherThread_Test )
+{
+    // [Preparation]
+    const pointer_uint_q BLOCK_SIZE = 16U;
+    const pointer_uint_q NUMBER_OF_BLOCKS = QTHREADCACHEDPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD;
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 0;
+    QThreadCachedPoolAllocator allocator(BLOCK_SIZE * NUMBER_OF_BLOCKS, BLOCK_SIZE, QAlignment(16U), 4U);
+    void* arBlocks[NUMBER_OF_BLOCKS];
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BLOCKS; ++i)
+        arBlocks[i] = allocator.Allocate();
+
+    // [Execution]
+    QThread thread(QDelegate<void (QThreadCachedPoolAllocator*, void**)>(&QThreadCachedPoolAllocator_Test_Deallocate), &allocator, arBlocks);
+    thread.Join();
+
+    // [Verification]
+    // The other thread finished, so its cache was returned to the central pool
+    allocator.ReleaseThreadCache();
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+}
+
+/// <summary>
+/// Checks that several threads can allocate and deallocate blocks at the same time without getting the same block.
+/// </summary>
+QTEST_CASE ( Allocate_SeveralThreadsDoNotGetTheSameBlock_Test )
+{
+    // [Preparation]
+    const u32_q NUMBER_OF_THREADS = 4U;
+    const pointer_uint_q BLOCK_SIZE = 16U;
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 0;
+    QThreadCachedPoolAllocator allocator(BLOCK_SIZE * QTHREADCACHEDPOOLALLOCATOR_TEST_BLOCKS_PER_THREAD * NUMBER_OF_THREADS * 2U, BLOCK_SIZE, QAlignment(16U), 8U);
+    bool bSucceeded = true;
+    QThread* arThreads[NUMBER_OF_THREADS];
+
+    // [Execution]
+    for(u32_q i = 0; i < NUMBER_OF_THREADS; ++i)
+        arThreads[i] = new QThread(QDelegate<void (QThreadCachedPoolAllocator*, bool*)>(&QThreadCachedPoolAllocator_Test_AllocateAndDeallocate), &allocator, &bSucceeded);
+
+    for(u32_q i = 0; i < NUMBER_OF_THREADS; ++i)
+    {
+        arThreads[i]->Join();
+        delete arThreads[i];
+    }
+
+    // [Verification]
+    BOOST_CHECK(bSucceeded);
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+}
+
+/// <summary>
+/// Checks that the blocks in the cache of the calling thread are returned to the central pool.
+/// </summary>
+QTEST_CASE ( ReleaseThreadCache_BlocksAreReturnedToCentralPool_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 0;
+    QThreadCachedPoolAllocator allocator(256U, 16U, QAlignment(16U), 4U);
+    allocator.Deallocate(allocator.Allocate());
+
+    // [Execution]
+    allocator.ReleaseThreadCache();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(allocator.GetAllocatedBytes(), EXPECTED_ALLOCATED_BYTES);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the block does not belong to the allocator.
+/// </summary>
+QTEST_CASE ( Deallocate_AssertionFailsWhenBlockDoesNotBelongToAllocator_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QThreadCachedPoolAllocator allocator(256U, 16U, QAlignment(16U), 4U);
+    u32_q uNotABlock = 0;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Deallocate(&uNotABlock);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: QThreadCachedPoolAllocator
+QTEST_SUITE_END()
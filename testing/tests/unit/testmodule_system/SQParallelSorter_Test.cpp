@@ -0,0 +1,309 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "SQParallelSorter.h"
+
+#include "QArrayDynamic.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::System::Threading::SQParallelSorter;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::i8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+/// <summary>
+/// Element used to check that equal elements keep their relative order. Only the key is used when comparing elements.
+/// </summary>
+struct SQParallelSorterTestElement
+{
+    u32_q m_uKey;
+    u32_q m_uOrder;
+};
+
+/// <summary>
+/// Comparator that only compares the key of the elements.
+/// </summary>
+class SQParallelSorterTestComparator
+{
+public:
+
+    static i8_q Compare(const SQParallelSorterTestElement &leftOperand, const SQParallelSorterTestElement &rightOperand)
+    {
+        return leftOperand.m_uKey < rightOperand.m_uKey ? -1 : (leftOperand.m_uKey == rightOperand.m_uKey ? 0 : 1);
+    }
+};
+
+/// <summary>
+/// Generates a sequence of pseudo-random numbers using a linear congruential generator, so all the executions are equal.
+/// </summary>
+/// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+/// <param name="uMaximumValue">[IN] The values will be lower than this value.</param>
+/// <returns>
+/// The sequence of numbers. It must be deleted by the caller.
+/// </returns>
+static u32_q* SQParallelSorter_Test_GenerateRandomNumbers(const pointer_uint_q uNumberOfElements, const u32_q uMaximumValue)
+{
+    u32_q* arElements = new u32_q[uNumberOfElements];
+    u32_q uRandom = 12345U;
+
+    for(pointer_uint_q i = 0; i < uNumberOfElements; ++i)
+    {
+        uRandom = uRandom * 1664525U + 1013904223U;
+        arElements[i] = (uRandom >> 8U) % uMaximumValue;
+    }
+
+    return arElements;
+}
+
+/// <summary>
+/// Checks whether a sequence of numbers is sorted in ascending order.
+/// </summary>
+/// <param name="arElements">[IN] The sequence to check.</param>
+/// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+/// <returns>
+/// True if every element is lower than or equal to the next one; False otherwise.
+/// </returns>
+static bool SQParallelSorter_Test_IsSorted(const u32_q* arElements, const pointer_uint_q uNumberOfElements)
+{
+    bool bIsSorted = true;
+
+    for(pointer_uint_q i = 1U; i < uNumberOfElements && bIsSorted; ++i)
+        bIsSorted = arElements[i - 1U] <= arElements[i];
+
+    return bIsSorted;
+}
+
+
+QTEST_SUITE_BEGIN( SQParallelSorter_TestSuite )
+
+/// <summary>
+/// Checks that elements are sorted in ascending order when they are split among several threads.
+/// </summary>
+QTEST_CASE ( Sort1_ElementsAreSortedWhenUsingSeveralThreads_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 100000U;
+    const unsigned int NUMBER_OF_THREADS = 4U;
+    const bool EXPECTED_RESULT = true;
+    u32_q* arElements = SQParallelSorter_Test_GenerateRandomNumbers(NUMBER_OF_ELEMENTS, 1000000U);
+
+    // [Execution]
+    SQParallelSorter<u32_q>::Sort(arElements, NUMBER_OF_ELEMENTS, NUMBER_OF_THREADS);
+
+    // [Verification]
+    bool bIsSorted = SQParallelSorter_Test_IsSorted(arElements, NUMBER_OF_ELEMENTS);
+    BOOST_CHECK_EQUAL(bIsSorted, EXPECTED_RESULT);
+
+    // [Cleaning]
+    delete[] arElements;
+}
+
+/// <summary>
+/// Checks that elements are sorted when the number of threads does not divide the number of elements exactly.
+/// </summary>
+QTEST_CASE ( Sort1_ElementsAreSortedWhenNumberOfElementsIsNotMultipleOfNumberOfThreads_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 100003U;
+    const unsigned int NUMBER_OF_THREADS = 7U;
+    const bool EXPECTED_RESULT = true;
+    u32_q* arElements = SQParallelSorter_Test_GenerateRandomNumbers(NUMBER_OF_ELEMENTS, 1000000U);
+
+    // [Execution]
+    SQParallelSorter<u32_q>::Sort(arElements, NUMBER_OF_ELEMENTS, NUMBER_OF_THREADS);
+
+    // [Verification]
+    bool bIsSorted = SQParallelSorter_Test_IsSorted(arElements, NUMBER_OF_ELEMENTS);
+    BOOST_CHECK_EQUAL(bIsSorted, EXPECTED_RESULT);
+
+    // [Cleaning]
+    delete[] arElements;
+}
+
+/// <summary>
+/// Checks that elements are sorted when there are too few elements to use several threads.
+/// </summary>
+QTEST_CASE ( Sort1_ElementsAreSortedWhenThereAreFewElements_Test )
+{
+    // [Preparation]
+    u32_q arElements[] = { 5U, 3U, 8U, 1U, 9U, 2U, 7U, 4U, 6U, 0U };
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U };
+    const pointer_uint_q NUMBER_OF_ELEMENTS = sizeof(arElements) / sizeof(u32_q);
+    const unsigned int NUMBER_OF_THREADS = 4U;
+
+    // [Execution]
+    SQParallelSorter<u32_q>::Sort(arElements, NUMBER_OF_ELEMENTS, NUMBER_OF_THREADS);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arElements, arElements + NUMBER_OF_ELEMENTS, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + NUMBER_OF_ELEMENTS);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the number of threads is zero.
+/// </summary>
+QTEST_CASE ( Sort1_AssertionFailsWhenNumberOfThreadsIsZero_Test )
+{
+    // [Preparation]
+    u32_q arElements[] = { 2U, 1U };
+    const pointer_uint_q NUMBER_OF_ELEMENTS = sizeof(arElements) / sizeof(u32_q);
+    const unsigned int ZERO_THREADS = 0;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQParallelSorter<u32_q>::Sort(arElements, NUMBER_OF_ELEMENTS, ZERO_THREADS);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the elements of a dynamic array are sorted in ascending order.
+/// </summary>
+QTEST_CASE ( Sort2_ArrayIsSorted_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 50000U;
+    const unsigned int NUMBER_OF_THREADS = 3U;
+    const bool EXPECTED_RESULT = true;
+    u32_q* arElements = SQParallelSorter_Test_GenerateRandomNumbers(NUMBER_OF_ELEMENTS, 1000000U);
+    QArrayDynamic<u32_q> arrayToSort(NUMBER_OF_ELEMENTS);
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        arrayToSort.Add(arElements[i]);
+
+    // [Execution]
+    SQParallelSorter<u32_q>::Sort(arrayToSort, NUMBER_OF_THREADS);
+
+    // [Verification]
+    bool bIsSorted = SQParallelSorter_Test_IsSorted(&arrayToSort[0], NUMBER_OF_ELEMENTS);
+    BOOST_CHECK_EQUAL(bIsSorted, EXPECTED_RESULT);
+
+    // [Cleaning]
+    delete[] arElements;
+}
+
+/// <summary>
+/// Checks that nothing happens when the array is empty.
+/// </summary>
+QTEST_CASE ( Sort2_NothingHappensWhenArrayIsEmpty_Test )
+{
+    // [Preparation]
+    const unsigned int NUMBER_OF_THREADS = 2U;
+    QArrayDynamic<u32_q> arrayToSort;
+
+    // [Execution]
+    SQParallelSorter<u32_q>::Sort(arrayToSort, NUMBER_OF_THREADS);
+
+    // [Verification]
+    BOOST_CHECK(arrayToSort.IsEmpty());
+}
+
+/// <summary>
+/// Checks that equal elements keep their relative order when they are split among several threads.
+/// </summary>
+QTEST_CASE ( StableSort1_EqualElementsKeepTheirRelativeOrder_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 100000U;
+    const unsigned int NUMBER_OF_THREADS = 4U;
+    const bool EXPECTED_RESULT = true;
+    u32_q* arKeys = SQParallelSorter_Test_GenerateRandomNumbers(NUMBER_OF_ELEMENTS, 100U);
+    SQParallelSorterTestElement* arElements = new SQParallelSorterTestElement[NUMBER_OF_ELEMENTS];
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        arElements[i].m_uKey = arKeys[i];
+        arElements[i].m_uOrder = scast_q(i, u32_q);
+    }
+
+    // [Execution]
+    SQParallelSorter<SQParallelSorterTestElement, SQParallelSorterTestComparator>::StableSort(arElements, NUMBER_OF_ELEMENTS, NUMBER_OF_THREADS);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+
+    for(pointer_uint_q i = 1U; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        bResultIsWhatEspected = bResultIsWhatEspected && 
+                                (arElements[i - 1U].m_uKey < arElements[i].m_uKey || 
+                                 (arElements[i - 1U].m_uKey == arElements[i].m_uKey && arElements[i - 1U].m_uOrder < arElements[i].m_uOrder));
+    }
+
+    BOOST_CHECK_EQUAL(bResultIsWhatEspected, EXPECTED_RESULT);
+
+    // [Cleaning]
+    delete[] arKeys;
+    delete[] arElements;
+}
+
+/// <summary>
+/// Checks that the elements of a dynamic array are sorted in ascending order.
+/// </summary>
+QTEST_CASE ( StableSort2_ArrayIsSorted_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 50000U;
+    const unsigned int NUMBER_OF_THREADS = 3U;
+    const bool EXPECTED_RESULT = true;
+    u32_q* arElements = SQParallelSorter_Test_GenerateRandomNumbers(NUMBER_OF_ELEMENTS, 1000000U);
+    QArrayDynamic<u32_q> arrayToSort(NUMBER_OF_ELEMENTS);
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        arrayToSort.Add(arElements[i]);
+
+    // [Execution]
+    SQParallelSorter<u32_q>::StableSort(arrayToSort, NUMBER_OF_THREADS);
+
+    // [Verification]
+    bool bIsSorted = SQParallelSorter_Test_IsSorted(&arrayToSort[0], NUMBER_OF_ELEMENTS);
+    BOOST_CHECK_EQUAL(bIsSorted, EXPECTED_RESULT);
+
+    // [Cleaning]
+    delete[] arElements;
+}
+
+// End - Test Suite: SQParallelSorter
+QTEST_SUITE_END()
@@ -0,0 +1,126 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#ifndef __BINARYSTREAMWRITERMOCK__
+#define __BINARYSTREAMWRITERMOCK__
+
+#include <cstring>
+
+#include "DataTypesDefinitions.h"
+#include "QAlignment.h"
+#include "AllocationOperators.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+
+namespace Kinesis
+{
+namespace QuimeraEngine
+{
+namespace Tools
+{
+namespace Containers
+{
+namespace Test
+{
+
+/// <summary>
+/// Class that provides the same writing methods as QBinaryStreamWriter, storing the data in an aligned buffer, so container 
+/// images can be tested without depending on the System layer.
+/// </summary>
+class BinaryStreamWriterMock
+{
+	// CONSTRUCTORS
+	// ---------------
+public:
+
+    // Receives the maximum number of bytes to be written
+    BinaryStreamWriterMock(const pointer_uint_q uCapacity) : m_pBuffer(new(QAlignment(16U)) u8_q[uCapacity]),
+                                                             m_uCapacity(uCapacity),
+                                                             m_uSize(0)
+    {
+    }
+
+    // Destructor necessary for testing
+    ~BinaryStreamWriterMock()
+    {
+        operator delete[](m_pBuffer, QAlignment(16U));
+    }
+
+	// METHODS
+	// ---------------
+public:
+
+    // Same as QBinaryStreamWriter::WriteBytes
+    void WriteBytes(const void* pBuffer, const pointer_uint_q uSize)
+    {
+        BOOST_REQUIRE(m_uSize + uSize <= m_uCapacity);
+        memcpy(m_pBuffer + m_uSize, pBuffer, uSize);
+        m_uSize += uSize;
+    }
+
+    // Same as QBinaryStreamWriter::Write
+    template<class T>
+    void Write(const T &value)
+    {
+        this->WriteBytes(&value, sizeof(T));
+    }
+
+    // Exposed member.
+    const u8_q* GetBuffer() const
+    {
+        return m_pBuffer;
+    }
+
+    // Exposed member.
+    pointer_uint_q GetSize() const
+    {
+        return m_uSize;
+    }
+
+    // ATTRIBUTES
+	// ---------------
+private:
+
+    // The written bytes.
+    u8_q* m_pBuffer;
+
+    // The size of the buffer.
+    pointer_uint_q m_uCapacity;
+
+    // The number of bytes written.
+    pointer_uint_q m_uSize;
+
+};
+
+} //namespace Test
+} //namespace Containers
+} //namespace Tools
+} //namespace QuimeraEngine
+} //namespace Kinesis
+
+#endif // __BINARYSTREAMWRITERMOCK__
@@ -31,12 +31,16 @@ using namespace boost::unit_test;
 #include "../../testsystem/TestingExternalDefinitions.h"
 
 #include "QArrayDynamic.h"
+#include "SQPowerOfTwoGrowthPolicy.h"
+#include "SQFixedChunkGrowthPolicy.h"
 
 #include "CallCounter.h"
 #include "QAssertException.h"
 
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
 using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+using Kinesis::QuimeraEngine::Tools::Containers::QContainerStatistics;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
 
 
 QTEST_SUITE_BEGIN( QArrayDynamic_TestSuite )
@@ -3949,5 +3953,340 @@ QTEST_CASE ( GetRange2_AssertionFailsWhenLastPositionIsNotLowerThanCount_Test )
 
 #endif
 
+/// <summary>
+/// Checks that elements are sorted in ascending order.
+/// </summary>
+QTEST_CASE ( Sort_ElementsAreSortedInAscendingOrder_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 1U, 2U, 3U, 4U };
+    const pointer_uint_q ARRAY_COUNT = sizeof(EXPECTED_ELEMENTS) / sizeof(u32_q);
+    QArrayDynamic<u32_q> arrayToSort(ARRAY_COUNT);
+    arrayToSort.Add(3U);
+    arrayToSort.Add(0U);
+    arrayToSort.Add(4U);
+    arrayToSort.Add(2U);
+    arrayToSort.Add(1U);
+
+    // [Execution]
+    arrayToSort.Sort();
+
+    // [Verification]
+    for(pointer_uint_q i = 0; i < ARRAY_COUNT; ++i)
+        BOOST_CHECK_EQUAL(arrayToSort[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that nothing happens when the array is empty.
+/// </summary>
+QTEST_CASE ( Sort_NothingHappensWhenArrayIsEmpty_Test )
+{
+    // [Preparation]
+    QArrayDynamic<u32_q> arrayToSort;
+
+    // [Execution]
+    arrayToSort.Sort();
+    arrayToSort.StableSort();
+
+    // [Verification]
+    BOOST_CHECK(arrayToSort.IsEmpty());
+}
+
+/// <summary>
+/// Checks that elements are sorted in ascending order.
+/// </summary>
+QTEST_CASE ( StableSort_ElementsAreSortedInAscendingOrder_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 1U, 2U, 3U, 4U };
+    const pointer_uint_q ARRAY_COUNT = sizeof(EXPECTED_ELEMENTS) / sizeof(u32_q);
+    QArrayDynamic<u32_q> arrayToSort(ARRAY_COUNT);
+    arrayToSort.Add(3U);
+    arrayToSort.Add(0U);
+    arrayToSort.Add(4U);
+    arrayToSort.Add(2U);
+    arrayToSort.Add(1U);
+
+    // [Execution]
+    arrayToSort.StableSort();
+
+    // [Verification]
+    for(pointer_uint_q i = 0; i < ARRAY_COUNT; ++i)
+        BOOST_CHECK_EQUAL(arrayToSort[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that the array remains sorted after inserting elements in any order.
+/// </summary>
+QTEST_CASE ( SortedInsert_ArrayRemainsSortedAfterInsertingElements_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 5U, 3U, 8U, 1U, 9U, 2U, 7U, 4U, 6U, 0U };
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U };
+    const pointer_uint_q ARRAY_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(u32_q);
+    QArrayDynamic<u32_q> sortedArray(2U);
+
+    // [Execution]
+    for(pointer_uint_q i = 0; i < ARRAY_COUNT; ++i)
+        sortedArray.SortedInsert(INPUT_ELEMENTS[i]);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(sortedArray.GetCount(), ARRAY_COUNT);
+
+    for(pointer_uint_q i = 0; i < ARRAY_COUNT; ++i)
+        BOOST_CHECK_EQUAL(sortedArray[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that the new element is placed after the elements that are equal to it.
+/// </summary>
+QTEST_CASE ( SortedInsert_ElementIsPlacedAfterEqualElements_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 1U, 3U, 3U, 5U };
+    const pointer_uint_q ARRAY_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(u32_q);
+    QArrayDynamic<u32_q> sortedArray(INPUT_ELEMENTS, ARRAY_COUNT);
+    const pointer_uint_q EXPECTED_INDEX = 3U;
+
+    // [Execution]
+    pointer_uint_q uIndex = sortedArray.SortedInsert(3U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uIndex, EXPECTED_INDEX);
+    BOOST_CHECK_EQUAL(sortedArray[EXPECTED_INDEX], 3U);
+    BOOST_CHECK_EQUAL(sortedArray[EXPECTED_INDEX + 1U], 5U);
+}
+
+/// <summary>
+/// Checks that the element is added when the array is empty.
+/// </summary>
+QTEST_CASE ( SortedInsert_ElementIsAddedWhenArrayIsEmpty_Test )
+{
+    // [Preparation]
+    QArrayDynamic<u32_q> sortedArray;
+    const pointer_uint_q EXPECTED_INDEX = 0;
+    const pointer_uint_q EXPECTED_COUNT = 1U;
+    const u32_q NEW_ELEMENT = 7U;
+
+    // [Execution]
+    pointer_uint_q uIndex = sortedArray.SortedInsert(NEW_ELEMENT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uIndex, EXPECTED_INDEX);
+    BOOST_CHECK_EQUAL(sortedArray.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(sortedArray[0], NEW_ELEMENT);
+}
+
+/// <summary>
+/// Checks that elements inserted in order can be found using binary search.
+/// </summary>
+QTEST_CASE ( BinarySearch_FindsElementsInsertedWithSortedInsert_Test )
+{
+    // [Preparation]
+    const pointer_uint_q ARRAY_COUNT = 1000U;
+    QArrayDynamic<u32_q> sortedArray;
+
+    for(pointer_uint_q i = 0; i < ARRAY_COUNT; ++i)
+        sortedArray.SortedInsert(scast_q((i * 7919U) % ARRAY_COUNT, u32_q) * 2U);
+    const pointer_uint_q EXPECTED_RESULT = QArrayDynamic<u32_q>::ELEMENT_NOT_FOUND;
+
+    // [Execution]
+    for(pointer_uint_q i = 0; i < ARRAY_COUNT; ++i)
+    {
+        pointer_uint_q uFoundIndex = sortedArray.BinarySearch(scast_q(i, u32_q) * 2U);
+        pointer_uint_q uMissingIndex = sortedArray.BinarySearch(scast_q(i, u32_q) * 2U + 1U);
+
+        // [Verification]
+        BOOST_CHECK_EQUAL(uFoundIndex, i);
+        BOOST_CHECK_EQUAL(uMissingIndex, EXPECTED_RESULT);
+    }
+}
+
+/// <summary>
+/// Checks that the element is constructed in place, calling the default constructor and not the copy constructor.
+/// </summary>
+QTEST_CASE ( Emplace1_ElementIsDefaultConstructedWithoutCallingCopyConstructor_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+    // [Preparation]
+    const unsigned int EXPECTED_CONSTRUCTOR_CALLS = 1U;
+    const unsigned int EXPECTED_COPY_CONSTRUCTOR_CALLS = 0;
+    const pointer_uint_q EXPECTED_COUNT = 1U;
+    QArrayDynamic<CallCounter> arrayToFill(1U);
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    arrayToFill.Emplace();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(CallCounter::GetConstructorCallsCount(), EXPECTED_CONSTRUCTOR_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetCopyConstructorCallsCount(), EXPECTED_COPY_CONSTRUCTOR_CALLS);
+    BOOST_CHECK_EQUAL(arrayToFill.GetCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the input argument is passed to the constructor of the element.
+/// </summary>
+QTEST_CASE ( Emplace2_ArgumentIsPassedToTheConstructor_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+
+    // [Preparation]
+    const string_q EXPECTED_VALUE("ABC");
+    QArrayDynamic<string_q> arrayToFill;
+    arrayToFill.Add("XYZ");
+
+    // [Execution]
+    arrayToFill.Emplace("ABC");
+
+    // [Verification]
+    BOOST_CHECK(arrayToFill[arrayToFill.GetCount() - 1U] == EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that all the input arguments are passed to the constructor of the element, in the same order.
+/// </summary>
+QTEST_CASE ( Emplace3_ArgumentsArePassedToTheConstructorInTheSameOrder_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+
+    // [Preparation]
+    const string_q EXPECTED_VALUE("ABC");
+    QArrayDynamic<string_q> arrayToFill;
+    arrayToFill.Add("XYZ");
+
+    // [Execution]
+    arrayToFill.Emplace("ABCDEF", 3);
+
+    // [Verification]
+    BOOST_CHECK(arrayToFill[arrayToFill.GetCount() - 1U] == EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the statistics contain the number of elements, the capacity and the bytes reserved and used by the array.
+/// </summary>
+QTEST_CASE ( GetStatistics_MemoryUsageIsCorrect_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_COUNT = 3U;
+    const pointer_uint_q EXPECTED_CAPACITY = 10U;
+    const pointer_uint_q EXPECTED_RESERVED_BYTES = EXPECTED_CAPACITY * sizeof(u32_q);
+    const pointer_uint_q EXPECTED_USED_BYTES = EXPECTED_COUNT * sizeof(u32_q);
+    const pointer_uint_q EXPECTED_UNUSED_BYTES = EXPECTED_RESERVED_BYTES - EXPECTED_USED_BYTES;
+    const pointer_uint_q EXPECTED_HEIGHT = 0;
+    QArrayDynamic<u32_q> ARRAY(EXPECTED_CAPACITY);
+
+    for(pointer_uint_q i = 0; i < EXPECTED_COUNT; ++i)
+        ARRAY.Add(i);
+
+    // [Execution]
+    QContainerStatistics statistics = ARRAY.GetStatistics();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(statistics.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetCapacity(), EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(statistics.GetReservedBytes(), EXPECTED_RESERVED_BYTES);
+    BOOST_CHECK_EQUAL(statistics.GetUsedBytes(), EXPECTED_USED_BYTES);
+    BOOST_CHECK_EQUAL(statistics.GetUnusedBytes(), EXPECTED_UNUSED_BYTES);
+    BOOST_CHECK_EQUAL(statistics.GetHeight(), EXPECTED_HEIGHT);
+}
+
+
+/// <summary>
+/// Checks that the capacity is reduced to the number of elements and the elements are kept.
+/// </summary>
+QTEST_CASE ( ShrinkToFit_CapacityIsReducedToTheNumberOfElements_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 1U, 2U };
+    const pointer_uint_q EXPECTED_CAPACITY = 3U;
+    QArrayDynamic<u32_q> arDynamicArray(10U);
+
+    for(u32_q i = 0; i < 6U; ++i)
+        arDynamicArray.Add(i);
+
+    arDynamicArray.RemoveRange(3U, 5U);
+
+    // [Execution]
+    arDynamicArray.ShrinkToFit();
+
+    // [Verification]
+    pointer_uint_q uCapacity = arDynamicArray.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL_COLLECTIONS(&arDynamicArray[0], &arDynamicArray[0] + arDynamicArray.GetCount(), EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the capacity of an empty array is reduced to one element.
+/// </summary>
+QTEST_CASE ( ShrinkToFit_CapacityOfEmptyArrayIsReducedToOneElement_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 1U;
+    QArrayDynamic<u32_q> arDynamicArray(10U);
+
+    // [Execution]
+    arDynamicArray.ShrinkToFit();
+
+    // [Verification]
+    pointer_uint_q uCapacity = arDynamicArray.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that elements can be added after shrinking the array.
+/// </summary>
+QTEST_CASE ( ShrinkToFit_ElementsCanBeAddedAfterShrinking_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 1U, 2U, 3U };
+    const pointer_uint_q EXPECTED_COUNT = 4U;
+    QArrayDynamic<u32_q> arDynamicArray(10U);
+    arDynamicArray.Add(0U);
+    arDynamicArray.Add(1U);
+    arDynamicArray.Add(2U);
+    arDynamicArray.ShrinkToFit();
+
+    // [Execution]
+    arDynamicArray.Add(3U);
+
+    // [Verification]
+    pointer_uint_q uCount = arDynamicArray.GetCount();
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL_COLLECTIONS(&arDynamicArray[0], &arDynamicArray[0] + uCount, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the capacity grows as the growth policy indicates when it is exceeded.
+/// </summary>
+QTEST_CASE ( Add_CapacityGrowsAccordingToGrowthPolicy_Test )
+{
+    using Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator;
+    using Kinesis::QuimeraEngine::Tools::Containers::SQComparatorDefault;
+    using Kinesis::QuimeraEngine::Tools::Containers::SQPowerOfTwoGrowthPolicy;
+    using Kinesis::QuimeraEngine::Tools::Containers::SQFixedChunkGrowthPolicy;
+
+    // [Preparation]
+    const pointer_uint_q EXPECTED_POWER_OF_TWO_CAPACITY = 8U;
+    const pointer_uint_q EXPECTED_FIXED_CHUNK_CAPACITY = 10U;
+    QArrayDynamic<u32_q, QPoolAllocator, SQComparatorDefault<u32_q>, SQPowerOfTwoGrowthPolicy> arPowerOfTwoArray(1U);
+    QArrayDynamic<u32_q, QPoolAllocator, SQComparatorDefault<u32_q>, SQFixedChunkGrowthPolicy<5U> > arFixedChunkArray(1U);
+
+    // [Execution]
+    for(u32_q i = 0; i < 6U; ++i)
+    {
+        arPowerOfTwoArray.Add(i);
+        arFixedChunkArray.Add(i);
+    }
+
+    // [Verification]
+    pointer_uint_q uPowerOfTwoCapacity = arPowerOfTwoArray.GetCapacity();
+    pointer_uint_q uFixedChunkCapacity = arFixedChunkArray.GetCapacity();
+    BOOST_CHECK_EQUAL(uPowerOfTwoCapacity, EXPECTED_POWER_OF_TWO_CAPACITY);
+    BOOST_CHECK_EQUAL(uFixedChunkCapacity, EXPECTED_FIXED_CHUNK_CAPACITY);
+}
+
+
 // End - Test Suite: QArrayDynamic
 QTEST_SUITE_END()
@@ -41,6 +41,7 @@ using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
 using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
 using Kinesis::QuimeraEngine::Tools::Containers::QArrayFixed;
+using Kinesis::QuimeraEngine::Tools::Containers::QContainerStatistics;
 using Kinesis::QuimeraEngine::Tools::Containers::Test::QArrayFixedWhiteBox;
 using Kinesis::QuimeraEngine::Tools::Containers::Test::ArrayElementMock;
 using Kinesis::QuimeraEngine::Tools::Containers::Test::QArrayFixedTestClass;
@@ -2243,6 +2244,251 @@ QTEST_CASE( IsEmpty_ReturnsFalseWhenTheArrayIsNotEmpty_Test )
     BOOST_CHECK_EQUAL( bIsEmpty, ARRAY_NOT_EMPTY );
 }
 
+/// <summary>
+/// Checks that elements are sorted in ascending order.
+/// </summary>
+QTEST_CASE ( Sort_ElementsAreSortedInAscendingOrder_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 5U, 3U, 8U, 1U, 9U, 2U, 7U, 4U, 6U, 0U };
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U };
+    const pointer_uint_q ARRAY_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(u32_q);
+    QArrayFixed<u32_q> fixedArray(INPUT_ELEMENTS, ARRAY_COUNT);
+
+    // [Execution]
+    fixedArray.Sort();
+
+    // [Verification]
+    for(pointer_uint_q i = 0; i < ARRAY_COUNT; ++i)
+        BOOST_CHECK_EQUAL(fixedArray[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that elements are sorted in ascending order.
+/// </summary>
+QTEST_CASE ( StableSort_ElementsAreSortedInAscendingOrder_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 5U, 3U, 8U, 1U, 9U, 2U, 7U, 4U, 6U, 0U, 15U, 13U, 18U, 11U, 19U, 12U, 17U, 14U, 16U, 10U };
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U, 11U, 12U, 13U, 14U, 15U, 16U, 17U, 18U, 19U };
+    const pointer_uint_q ARRAY_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(u32_q);
+    QArrayFixed<u32_q> fixedArray(INPUT_ELEMENTS, ARRAY_COUNT);
+
+    // [Execution]
+    fixedArray.StableSort();
+
+    // [Verification]
+    for(pointer_uint_q i = 0; i < ARRAY_COUNT; ++i)
+        BOOST_CHECK_EQUAL(fixedArray[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that it returns the index of the element when it is in the array.
+/// </summary>
+QTEST_CASE ( BinarySearch_ReturnsTheIndexOfTheElementWhenItIsInTheArray_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 1U, 3U, 5U, 7U, 9U, 11U, 13U };
+    const pointer_uint_q ARRAY_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(u32_q);
+    QArrayFixed<u32_q> fixedArray(INPUT_ELEMENTS, ARRAY_COUNT);
+
+    // [Execution]
+    for(pointer_uint_q i = 0; i < ARRAY_COUNT; ++i)
+    {
+        pointer_uint_q uIndex = fixedArray.BinarySearch(INPUT_ELEMENTS[i]);
+        
+        // [Verification]
+        BOOST_CHECK_EQUAL(uIndex, i);
+    }
+}
+
+/// <summary>
+/// Checks that it returns ELEMENT_NOT_FOUND when the element is not in the array.
+/// </summary>
+QTEST_CASE ( BinarySearch_ReturnsElementNotFoundWhenTheElementIsNotInTheArray_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 1U, 3U, 5U, 7U, 9U, 11U, 13U };
+    const u32_q MISSING_ELEMENTS[] = { 0U, 2U, 6U, 12U, 14U };
+    const pointer_uint_q ARRAY_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(u32_q);
+    const pointer_uint_q MISSING_COUNT = sizeof(MISSING_ELEMENTS) / sizeof(u32_q);
+    QArrayFixed<u32_q> fixedArray(INPUT_ELEMENTS, ARRAY_COUNT);
+    const pointer_uint_q EXPECTED_RESULT = QArrayFixed<u32_q>::ELEMENT_NOT_FOUND;
+
+    // [Execution]
+    for(pointer_uint_q i = 0; i < MISSING_COUNT; ++i)
+    {
+        pointer_uint_q uIndex = fixedArray.BinarySearch(MISSING_ELEMENTS[i]);
+        
+        // [Verification]
+        BOOST_CHECK_EQUAL(uIndex, EXPECTED_RESULT);
+    }
+}
+
+/// <summary>
+/// Checks that it returns the index of the first element when there are several equal elements.
+/// </summary>
+QTEST_CASE ( BinarySearch_ReturnsTheFirstElementWhenThereAreSeveralEqualElements_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 1U, 3U, 3U, 3U, 3U, 5U, 7U };
+    const pointer_uint_q ARRAY_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(u32_q);
+    QArrayFixed<u32_q> fixedArray(INPUT_ELEMENTS, ARRAY_COUNT);
+    const pointer_uint_q EXPECTED_INDEX = 1U;
+
+    // [Execution]
+    pointer_uint_q uIndex = fixedArray.BinarySearch(3U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uIndex, EXPECTED_INDEX);
+}
+
+/// <summary>
+/// Checks that it returns the first element that is not lower than the input one.
+/// </summary>
+QTEST_CASE ( LowerBound_ReturnsTheFirstElementThatIsNotLowerThanTheInputOne_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 1U, 3U, 3U, 3U, 5U, 7U };
+    const pointer_uint_q ARRAY_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(u32_q);
+    QArrayFixed<u32_q> fixedArray(INPUT_ELEMENTS, ARRAY_COUNT);
+    const QArrayFixed<u32_q>::QArrayIterator EXPECTED_POSITION_EQUAL = fixedArray.GetIterator(1U);
+    const QArrayFixed<u32_q>::QArrayIterator EXPECTED_POSITION_MISSING = fixedArray.GetIterator(4U);
+
+    // [Execution]
+    QArrayFixed<u32_q>::QArrayIterator positionEqual = fixedArray.LowerBound(3U);
+    QArrayFixed<u32_q>::QArrayIterator positionMissing = fixedArray.LowerBound(4U);
+
+    // [Verification]
+    BOOST_CHECK(positionEqual == EXPECTED_POSITION_EQUAL);
+    BOOST_CHECK(positionMissing == EXPECTED_POSITION_MISSING);
+}
+
+/// <summary>
+/// Checks that it returns the end position when all the elements are lower than the input one.
+/// </summary>
+QTEST_CASE ( LowerBound_ReturnsEndPositionWhenAllElementsAreLower_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 1U, 3U, 5U, 7U };
+    const pointer_uint_q ARRAY_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(u32_q);
+    QArrayFixed<u32_q> fixedArray(INPUT_ELEMENTS, ARRAY_COUNT);
+
+    // [Execution]
+    QArrayFixed<u32_q>::QArrayIterator position = fixedArray.LowerBound(8U);
+
+    // [Verification]
+    BOOST_CHECK(position.IsEnd());
+}
+
+/// <summary>
+/// Checks that it returns the first element that is greater than the input one.
+/// </summary>
+QTEST_CASE ( UpperBound_ReturnsTheFirstElementThatIsGreaterThanTheInputOne_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 1U, 3U, 3U, 3U, 5U, 7U };
+    const pointer_uint_q ARRAY_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(u32_q);
+    QArrayFixed<u32_q> fixedArray(INPUT_ELEMENTS, ARRAY_COUNT);
+    const QArrayFixed<u32_q>::QArrayIterator EXPECTED_POSITION_EQUAL = fixedArray.GetIterator(4U);
+    const QArrayFixed<u32_q>::QArrayIterator EXPECTED_POSITION_LOWEST = fixedArray.GetIterator(0);
+
+    // [Execution]
+    QArrayFixed<u32_q>::QArrayIterator positionEqual = fixedArray.UpperBound(3U);
+    QArrayFixed<u32_q>::QArrayIterator positionLowest = fixedArray.UpperBound(0);
+
+    // [Verification]
+    BOOST_CHECK(positionEqual == EXPECTED_POSITION_EQUAL);
+    BOOST_CHECK(positionLowest == EXPECTED_POSITION_LOWEST);
+}
+
+/// <summary>
+/// Checks that it returns the end position when no element is greater than the input one.
+/// </summary>
+QTEST_CASE ( UpperBound_ReturnsEndPositionWhenNoElementIsGreater_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 1U, 3U, 5U, 7U };
+    const pointer_uint_q ARRAY_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(u32_q);
+    QArrayFixed<u32_q> fixedArray(INPUT_ELEMENTS, ARRAY_COUNT);
+
+    // [Execution]
+    QArrayFixed<u32_q>::QArrayIterator position = fixedArray.UpperBound(7U);
+
+    // [Verification]
+    BOOST_CHECK(position.IsEnd());
+}
+
+/// <summary>
+/// Checks that it returns the first and last positions of the elements that are equal to the input one.
+/// </summary>
+QTEST_CASE ( EqualRange_ReturnsFirstAndLastEqualElements_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 1U, 3U, 3U, 3U, 5U, 7U };
+    const pointer_uint_q ARRAY_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(u32_q);
+    QArrayFixed<u32_q> fixedArray(INPUT_ELEMENTS, ARRAY_COUNT);
+    const QArrayFixed<u32_q>::QArrayIterator EXPECTED_FIRST = fixedArray.GetIterator(1U);
+    const QArrayFixed<u32_q>::QArrayIterator EXPECTED_LAST = fixedArray.GetIterator(3U);
+    const pointer_uint_q EXPECTED_COUNT = 3U;
+
+    // [Execution]
+    QArrayFixed<u32_q>::QArrayIterator first = fixedArray.GetFirst();
+    QArrayFixed<u32_q>::QArrayIterator last = fixedArray.GetFirst();
+    pointer_uint_q uCount = fixedArray.EqualRange(3U, first, last);
+
+    // [Verification]
+    BOOST_CHECK(first == EXPECTED_FIRST);
+    BOOST_CHECK(last == EXPECTED_LAST);
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that both positions point to the end position and zero is returned when the element is not in the array.
+/// </summary>
+QTEST_CASE ( EqualRange_ReturnsEndPositionsWhenTheElementIsNotInTheArray_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 1U, 3U, 5U, 7U };
+    const pointer_uint_q ARRAY_COUNT = sizeof(INPUT_ELEMENTS) / sizeof(u32_q);
+    QArrayFixed<u32_q> fixedArray(INPUT_ELEMENTS, ARRAY_COUNT);
+    const pointer_uint_q EXPECTED_COUNT = 0;
+
+    // [Execution]
+    QArrayFixed<u32_q>::QArrayIterator first = fixedArray.GetFirst();
+    QArrayFixed<u32_q>::QArrayIterator last = fixedArray.GetFirst();
+    pointer_uint_q uCount = fixedArray.EqualRange(4U, first, last);
+
+    // [Verification]
+    BOOST_CHECK(first.IsEnd());
+    BOOST_CHECK(last.IsEnd());
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that all the reserved bytes are used, since all the elements of a fixed array are constructed.
+/// </summary>
+QTEST_CASE ( GetStatistics_AllReservedBytesAreUsed_Test )
+{
+    // [Preparation]
+    const pointer_uint_q ARRAY_COUNT = 5U;
+    const u64_q INITIAL_VALUE = 1U;
+    const pointer_uint_q EXPECTED_BYTES = ARRAY_COUNT * sizeof(u64_q);
+    const pointer_uint_q EXPECTED_UNUSED_BYTES = 0;
+    QArrayFixed<u64_q> ARRAY(ARRAY_COUNT, INITIAL_VALUE);
+
+    // [Execution]
+    QContainerStatistics statistics = ARRAY.GetStatistics();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(statistics.GetCount(), ARRAY_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetCapacity(), ARRAY_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetReservedBytes(), EXPECTED_BYTES);
+    BOOST_CHECK_EQUAL(statistics.GetUsedBytes(), EXPECTED_BYTES);
+    BOOST_CHECK_EQUAL(statistics.GetUnusedBytes(), EXPECTED_UNUSED_BYTES);
+}
+
+
 // End - Test Suite: QArrayFixed
 QTEST_SUITE_END()
 
@@ -0,0 +1,285 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QArrayImageView.h"
+#include "QArrayFixed.h"
+#include "QArrayDynamic.h"
+#include "QList.h"
+#include "QBinarySearchTree.h"
+#include "BinaryStreamWriterMock.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayImageView;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayFixed;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+using Kinesis::QuimeraEngine::Tools::Containers::QList;
+using Kinesis::QuimeraEngine::Tools::Containers::QBinarySearchTree;
+using Kinesis::QuimeraEngine::Tools::Containers::EQTreeTraversalOrder;
+using Kinesis::QuimeraEngine::Tools::Containers::Test::BinaryStreamWriterMock;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::u16_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+
+QTEST_SUITE_BEGIN( QArrayImageView_TestSuite )
+
+/// <summary>
+/// Checks that the elements of an array image are read in the same order as they were in the array.
+/// </summary>
+QTEST_CASE ( Constructor_ElementsOfArrayImageAreRead_Test )
+{
+    // [Preparation]
+    const u32_q ARRAY_ELEMENTS[] = { 5U, 3U, 9U, 1U, 7U };
+    const pointer_uint_q EXPECTED_COUNT = 5U;
+    QArrayFixed<u32_q> arOriginal(ARRAY_ELEMENTS, EXPECTED_COUNT);
+    BinaryStreamWriterMock writer(256U);
+    arOriginal.WriteImage(writer);
+
+    // [Execution]
+    QArrayImageView<u32_q> view(writer.GetBuffer());
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(view.GetCount(), EXPECTED_COUNT);
+
+    for(pointer_uint_q i = 0; i < EXPECTED_COUNT; ++i)
+        BOOST_CHECK_EQUAL(view[i], ARRAY_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that the elements of a list image are read in the same order as they are traversed in the list, regardless of where they were stored.
+/// </summary>
+QTEST_CASE ( Constructor_ElementsOfListImageAreReadInListOrder_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 4U, 2U, 1U, 3U };
+    const pointer_uint_q EXPECTED_COUNT = 4U;
+    QList<u32_q> list;
+    list.Add(1U);
+    list.Add(3U);
+    list.Insert(2U, 0);
+    list.Insert(4U, 0);
+    BinaryStreamWriterMock writer(256U);
+    list.WriteImage(writer);
+
+    // [Execution]
+    QArrayImageView<u32_q> view(writer.GetBuffer());
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(view.GetCount(), EXPECTED_COUNT);
+
+    for(pointer_uint_q i = 0; i < EXPECTED_COUNT; ++i)
+        BOOST_CHECK_EQUAL(view.GetValue(i), EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that the image can be read after being moved to a different address.
+/// </summary>
+QTEST_CASE ( Constructor_ImageCanBeReadAfterBeingMoved_Test )
+{
+    // [Preparation]
+    const u32_q ARRAY_ELEMENTS[] = { 5U, 3U, 9U };
+    const pointer_uint_q EXPECTED_COUNT = 3U;
+    QArrayDynamic<u32_q> arOriginal(ARRAY_ELEMENTS, EXPECTED_COUNT);
+    BinaryStreamWriterMock writer(256U);
+    arOriginal.WriteImage(writer);
+    BinaryStreamWriterMock destination(256U);
+    destination.WriteBytes(writer.GetBuffer(), writer.GetSize());
+
+    // [Execution]
+    QArrayImageView<u32_q> view(destination.GetBuffer());
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(view.GetCount(), EXPECTED_COUNT);
+
+    for(pointer_uint_q i = 0; i < EXPECTED_COUNT; ++i)
+        BOOST_CHECK_EQUAL(view[i], ARRAY_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that the image of an empty array is empty.
+/// </summary>
+QTEST_CASE ( IsEmpty_ReturnsTrueWhenImageIsEmpty_Test )
+{
+    // [Preparation]
+    const bool IS_EMPTY = true;
+    const pointer_uint_q EXPECTED_COUNT = 0;
+    QArrayDynamic<u32_q> arOriginal;
+    BinaryStreamWriterMock writer(256U);
+    arOriginal.WriteImage(writer);
+
+    // [Execution]
+    QArrayImageView<u32_q> view(writer.GetBuffer());
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(view.IsEmpty(), IS_EMPTY);
+    BOOST_CHECK_EQUAL(view.GetCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the image only contains the header and the bytes of the elements.
+/// </summary>
+QTEST_CASE ( WriteImage_ImageOccupiesHeaderAndElements_Test )
+{
+    // [Preparation]
+    const u32_q ARRAY_ELEMENTS[] = { 5U, 3U, 9U };
+    const pointer_uint_q EXPECTED_SIZE = 32U + 3U * sizeof(u32_q);
+    QArrayFixed<u32_q> arOriginal(ARRAY_ELEMENTS, 3U);
+    BinaryStreamWriterMock writer(256U);
+
+    // [Execution]
+    arOriginal.WriteImage(writer);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(writer.GetSize(), EXPECTED_SIZE);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the image does not belong to an array.
+/// </summary>
+QTEST_CASE ( Constructor_AssertionFailsWhenImageIsNotArray_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QBinarySearchTree<u32_q> tree;
+    tree.Add(1U, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    BinaryStreamWriterMock writer(256U);
+    tree.WriteImage(writer);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QArrayImageView<u32_q> view(writer.GetBuffer());
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the size of the elements in the image is different from the size of the type.
+/// </summary>
+QTEST_CASE ( Constructor_AssertionFailsWhenElementSizeIsDifferent_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const u32_q ARRAY_ELEMENTS[] = { 5U, 3U };
+    QArrayFixed<u32_q> arOriginal(ARRAY_ELEMENTS, 2U);
+    BinaryStreamWriterMock writer(256U);
+    arOriginal.WriteImage(writer);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QArrayImageView<u16_q> view(writer.GetBuffer());
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the image is aligned to 4 bytes but not to the alignment of the elements.
+/// </summary>
+QTEST_CASE ( Constructor_AssertionFailsWhenImageIsNotAlignedToTheAlignmentOfTheElements_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const u64_q ARRAY_ELEMENTS[] = { 5U, 3U };
+    QArrayFixed<u64_q> arOriginal(ARRAY_ELEMENTS, 2U);
+    BinaryStreamWriterMock writer(256U);
+    const u32_q PADDING = 0;
+    writer.WriteBytes(&PADDING, sizeof(u32_q)); // The buffer is aligned to 16 bytes, so the image is only aligned to 4 bytes
+    arOriginal.WriteImage(writer);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QArrayImageView<u64_q> view(writer.GetBuffer() + sizeof(u32_q));
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the index is out of bounds.
+/// </summary>
+QTEST_CASE ( GetValue_AssertionFailsWhenIndexIsOutOfBounds_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const u32_q ARRAY_ELEMENTS[] = { 5U, 3U };
+    QArrayFixed<u32_q> arOriginal(ARRAY_ELEMENTS, 2U);
+    BinaryStreamWriterMock writer(256U);
+    arOriginal.WriteImage(writer);
+    QArrayImageView<u32_q> view(writer.GetBuffer());
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        view.GetValue(2U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: QArrayImageView
+QTEST_SUITE_END()
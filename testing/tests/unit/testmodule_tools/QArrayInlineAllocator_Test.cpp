@@ -0,0 +1,396 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QArrayInlineAllocator.h"
+
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayInlineAllocator;
+using Kinesis::QuimeraEngine::Common::Memory::QAlignment;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+/// <summary>
+/// The type of the allocator used in most of the tests, whose internal buffer can store 4 blocks.
+/// </summary>
+typedef QArrayInlineAllocator<u32_q, 4U> QArrayInlineAllocatorTestType;
+
+
+QTEST_SUITE_BEGIN( QArrayInlineAllocator_TestSuite )
+
+/// <summary>
+/// Checks that the internal buffer is used when the size fits in it.
+/// </summary>
+QTEST_CASE ( Constructor_InternalBufferIsUsedWhenSizeFits_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INPUT_SIZE = 2U * sizeof(u32_q);
+    const pointer_uint_q EXPECTED_POOL_SIZE = 4U * sizeof(u32_q);
+    const bool IS_USING_INLINE_BUFFER = true;
+
+    // [Execution]
+    QArrayInlineAllocatorTestType allocator(INPUT_SIZE, sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+
+    // [Verification]
+    bool bIsUsingInlineBuffer = allocator.IsUsingInlineBuffer();
+    pointer_uint_q uPoolSize = allocator.GetPoolSize();
+    BOOST_CHECK_EQUAL(bIsUsingInlineBuffer, IS_USING_INLINE_BUFFER);
+    BOOST_CHECK_EQUAL(uPoolSize, EXPECTED_POOL_SIZE);
+}
+
+/// <summary>
+/// Checks that the external allocator is used when the size does not fit in the internal buffer.
+/// </summary>
+QTEST_CASE ( Constructor_ExternalAllocatorIsUsedWhenSizeDoesNotFit_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INPUT_SIZE = 8U * sizeof(u32_q);
+    const bool IS_USING_INLINE_BUFFER = false;
+
+    // [Execution]
+    QArrayInlineAllocatorTestType allocator(INPUT_SIZE, sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+
+    // [Verification]
+    bool bIsUsingInlineBuffer = allocator.IsUsingInlineBuffer();
+    pointer_uint_q uPoolSize = allocator.GetPoolSize();
+    BOOST_CHECK_EQUAL(bIsUsingInlineBuffer, IS_USING_INLINE_BUFFER);
+    BOOST_CHECK_EQUAL(uPoolSize, INPUT_SIZE);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the size is zero.
+/// </summary>
+QTEST_CASE ( Constructor_AssertionFailsWhenSizeIsZero_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QArrayInlineAllocatorTestType allocator(0, sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that blocks are contiguous and returned in ascending order.
+/// </summary>
+QTEST_CASE ( Allocate_BlocksAreContiguousAndInAscendingOrder_Test )
+{
+    // [Preparation]
+    QArrayInlineAllocatorTestType allocator(sizeof(u32_q), sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+    u32_q* pFirst = scast_q(allocator.GetPointer(), u32_q*);
+
+    // [Execution]
+    void* pBlock1 = allocator.Allocate();
+    void* pBlock2 = allocator.Allocate();
+    void* pBlock3 = allocator.Allocate();
+
+    // [Verification]
+    BOOST_CHECK(pBlock1 == pFirst);
+    BOOST_CHECK(pBlock2 == pFirst + 1U);
+    BOOST_CHECK(pBlock3 == pFirst + 2U);
+}
+
+/// <summary>
+/// Checks that null is returned when the internal buffer is full.
+/// </summary>
+QTEST_CASE ( Allocate_ReturnsNullWhenInternalBufferIsFull_Test )
+{
+    // [Preparation]
+    void* EXPECTED_RESULT = null_q;
+    const bool CAN_ALLOCATE = false;
+    QArrayInlineAllocatorTestType allocator(sizeof(u32_q), sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+
+    for(pointer_uint_q i = 0; i < 4U; ++i)
+        allocator.Allocate();
+
+    // [Execution]
+    void* pBlock = allocator.Allocate();
+
+    // [Verification]
+    bool bCanAllocate = allocator.CanAllocate();
+    BOOST_CHECK(pBlock == EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(bCanAllocate, CAN_ALLOCATE);
+}
+
+/// <summary>
+/// Checks that the last block can be allocated again after it is deallocated.
+/// </summary>
+QTEST_CASE ( Deallocate_LastBlockIsAllocatedAgain_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 2U * sizeof(u32_q);
+    QArrayInlineAllocatorTestType allocator(sizeof(u32_q), sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+    allocator.Allocate();
+    allocator.Allocate();
+    void* pLastBlock = allocator.Allocate();
+
+    // [Execution]
+    allocator.Deallocate(pLastBlock);
+
+    // [Verification]
+    pointer_uint_q uAllocatedBytes = allocator.GetAllocatedBytes();
+    void* pNewBlock = allocator.Allocate();
+    BOOST_CHECK_EQUAL(uAllocatedBytes, EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK(pNewBlock == pLastBlock);
+}
+
+/// <summary>
+/// Checks that all the blocks are free after clearing the allocator.
+/// </summary>
+QTEST_CASE ( Clear_AllBlocksAreFree_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 0;
+    QArrayInlineAllocatorTestType allocator(sizeof(u32_q), sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+    void* pFirstBlock = allocator.Allocate();
+    allocator.Allocate();
+
+    // [Execution]
+    allocator.Clear();
+
+    // [Verification]
+    pointer_uint_q uAllocatedBytes = allocator.GetAllocatedBytes();
+    BOOST_CHECK_EQUAL(uAllocatedBytes, EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK(allocator.Allocate() == pFirstBlock);
+}
+
+/// <summary>
+/// Checks that the allocated blocks are moved to the external allocator, keeping their content and order.
+/// </summary>
+QTEST_CASE ( Reallocate_BlocksAreMovedToExternalAllocator_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_VALUES[] = { 10U, 20U, 30U };
+    const pointer_uint_q NEW_SIZE = 10U * sizeof(u32_q);
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 3U * sizeof(u32_q);
+    const bool IS_USING_INLINE_BUFFER = false;
+    QArrayInlineAllocatorTestType allocator(sizeof(u32_q), sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+    *scast_q(allocator.Allocate(), u32_q*) = 10U;
+    *scast_q(allocator.Allocate(), u32_q*) = 20U;
+    *scast_q(allocator.Allocate(), u32_q*) = 30U;
+
+    // [Execution]
+    allocator.Reallocate(NEW_SIZE);
+
+    // [Verification]
+    bool bIsUsingInlineBuffer = allocator.IsUsingInlineBuffer();
+    pointer_uint_q uPoolSize = allocator.GetPoolSize();
+    pointer_uint_q uAllocatedBytes = allocator.GetAllocatedBytes();
+    u32_q* pFirst = scast_q(allocator.GetPointer(), u32_q*);
+    void* pNextBlock = allocator.Allocate();
+    BOOST_CHECK_EQUAL(bIsUsingInlineBuffer, IS_USING_INLINE_BUFFER);
+    BOOST_CHECK_EQUAL(uPoolSize, NEW_SIZE);
+    BOOST_CHECK_EQUAL(uAllocatedBytes, EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL_COLLECTIONS(pFirst, pFirst + 3U, EXPECTED_VALUES, EXPECTED_VALUES + 3U);
+    BOOST_CHECK(pNextBlock == pFirst + 3U);
+}
+
+/// <summary>
+/// Checks that nothing changes when the new size fits in the internal buffer.
+/// </summary>
+QTEST_CASE ( Reallocate_NothingHappensWhenNewSizeFitsInInternalBuffer_Test )
+{
+    // [Preparation]
+    const bool IS_USING_INLINE_BUFFER = true;
+    QArrayInlineAllocatorTestType allocator(sizeof(u32_q), sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+    void* pInternalBuffer = allocator.GetPointer();
+
+    // [Execution]
+    try
+    {
+        allocator.Reallocate(2U * sizeof(u32_q));
+    }
+    catch(const QAssertException&)
+    {
+    }
+
+    // [Verification]
+    bool bIsUsingInlineBuffer = allocator.IsUsingInlineBuffer();
+    BOOST_CHECK_EQUAL(bIsUsingInlineBuffer, IS_USING_INLINE_BUFFER);
+    BOOST_CHECK(allocator.GetPointer() == pInternalBuffer);
+}
+
+/// <summary>
+/// Checks that the allocated blocks are copied from the internal buffer to an allocator that uses the external allocator.
+/// </summary>
+QTEST_CASE ( CopyTo_BlocksAreCopiedFromInternalBufferToExternalAllocator_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_VALUES[] = { 10U, 20U };
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 2U * sizeof(u32_q);
+    QArrayInlineAllocatorTestType allocator(sizeof(u32_q), sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+    *scast_q(allocator.Allocate(), u32_q*) = 10U;
+    *scast_q(allocator.Allocate(), u32_q*) = 20U;
+    QArrayInlineAllocatorTestType destination(10U * sizeof(u32_q), sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+    destination.Allocate();
+
+    // [Execution]
+    allocator.CopyTo(destination);
+
+    // [Verification]
+    pointer_uint_q uAllocatedBytes = destination.GetAllocatedBytes();
+    u32_q* pFirst = scast_q(destination.GetPointer(), u32_q*);
+    BOOST_CHECK_EQUAL(uAllocatedBytes, EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL_COLLECTIONS(pFirst, pFirst + 2U, EXPECTED_VALUES, EXPECTED_VALUES + 2U);
+}
+
+/// <summary>
+/// Checks that the allocated blocks are copied between internal buffers.
+/// </summary>
+QTEST_CASE ( CopyTo_BlocksAreCopiedBetweenInternalBuffers_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_VALUES[] = { 10U, 20U, 30U };
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 3U * sizeof(u32_q);
+    QArrayInlineAllocatorTestType allocator(sizeof(u32_q), sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+    *scast_q(allocator.Allocate(), u32_q*) = 10U;
+    *scast_q(allocator.Allocate(), u32_q*) = 20U;
+    *scast_q(allocator.Allocate(), u32_q*) = 30U;
+    QArrayInlineAllocatorTestType destination(sizeof(u32_q), sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+
+    // [Execution]
+    allocator.CopyTo(destination);
+
+    // [Verification]
+    pointer_uint_q uAllocatedBytes = destination.GetAllocatedBytes();
+    u32_q* pFirst = scast_q(destination.GetPointer(), u32_q*);
+    BOOST_CHECK_EQUAL(uAllocatedBytes, EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL_COLLECTIONS(pFirst, pFirst + 3U, EXPECTED_VALUES, EXPECTED_VALUES + 3U);
+}
+
+/// <summary>
+/// Checks that the allocated blocks are moved back to the internal buffer, keeping their content and order, when the new size fits in it.
+/// </summary>
+QTEST_CASE ( Shrink_BlocksAreMovedBackToInternalBufferWhenNewSizeFits_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_VALUES[] = { 10U, 20U, 30U };
+    const pointer_uint_q EXPECTED_ALLOCATED_BYTES = 3U * sizeof(u32_q);
+    const pointer_uint_q EXPECTED_POOL_SIZE = 4U * sizeof(u32_q);
+    const bool IS_USING_INLINE_BUFFER = true;
+    QArrayInlineAllocatorTestType allocator(10U * sizeof(u32_q), sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+    *scast_q(allocator.Allocate(), u32_q*) = 10U;
+    *scast_q(allocator.Allocate(), u32_q*) = 20U;
+    *scast_q(allocator.Allocate(), u32_q*) = 30U;
+
+    // [Execution]
+    allocator.Shrink(3U * sizeof(u32_q));
+
+    // [Verification]
+    bool bIsUsingInlineBuffer = allocator.IsUsingInlineBuffer();
+    pointer_uint_q uPoolSize = allocator.GetPoolSize();
+    pointer_uint_q uAllocatedBytes = allocator.GetAllocatedBytes();
+    u32_q* pFirst = scast_q(allocator.GetPointer(), u32_q*);
+    void* pNextBlock = allocator.Allocate();
+    BOOST_CHECK_EQUAL(bIsUsingInlineBuffer, IS_USING_INLINE_BUFFER);
+    BOOST_CHECK_EQUAL(uPoolSize, EXPECTED_POOL_SIZE);
+    BOOST_CHECK_EQUAL(uAllocatedBytes, EXPECTED_ALLOCATED_BYTES);
+    BOOST_CHECK_EQUAL_COLLECTIONS(pFirst, pFirst + 3U, EXPECTED_VALUES, EXPECTED_VALUES + 3U);
+    BOOST_CHECK(pNextBlock == pFirst + 3U);
+}
+
+/// <summary>
+/// Checks that the external allocator is shrunk when the new size does not fit in the internal buffer.
+/// </summary>
+QTEST_CASE ( Shrink_ExternalAllocatorIsShrunkWhenNewSizeDoesNotFitInInternalBuffer_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_VALUES[] = { 10U, 20U, 30U };
+    const pointer_uint_q NEW_SIZE = 6U * sizeof(u32_q);
+    const bool IS_USING_INLINE_BUFFER = false;
+    QArrayInlineAllocatorTestType allocator(10U * sizeof(u32_q), sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+    *scast_q(allocator.Allocate(), u32_q*) = 10U;
+    *scast_q(allocator.Allocate(), u32_q*) = 20U;
+    *scast_q(allocator.Allocate(), u32_q*) = 30U;
+
+    // [Execution]
+    allocator.Shrink(NEW_SIZE);
+
+    // [Verification]
+    bool bIsUsingInlineBuffer = allocator.IsUsingInlineBuffer();
+    pointer_uint_q uPoolSize = allocator.GetPoolSize();
+    u32_q* pFirst = scast_q(allocator.GetPointer(), u32_q*);
+    BOOST_CHECK_EQUAL(bIsUsingInlineBuffer, IS_USING_INLINE_BUFFER);
+    BOOST_CHECK_EQUAL(uPoolSize, NEW_SIZE);
+    BOOST_CHECK_EQUAL_COLLECTIONS(pFirst, pFirst + 3U, EXPECTED_VALUES, EXPECTED_VALUES + 3U);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the allocated blocks do not fit in the internal buffer.
+/// </summary>
+QTEST_CASE ( Shrink_AssertionFailsWhenAllocatedBlocksDoNotFitInNewSize_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QArrayInlineAllocatorTestType allocator(10U * sizeof(u32_q), sizeof(u32_q), QAlignment(alignof_q(u32_q)));
+
+    for(pointer_uint_q i = 0; i < 5U; ++i)
+        allocator.Allocate();
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        allocator.Shrink(4U * sizeof(u32_q));
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+
+// End - Test Suite: QArrayInlineAllocator
+QTEST_SUITE_END()
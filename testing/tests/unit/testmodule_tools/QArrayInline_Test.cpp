@@ -0,0 +1,533 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QArrayInline.h"
+
+#include "CallCounter.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayInline;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+
+QTEST_SUITE_BEGIN( QArrayInline_TestSuite )
+
+/// <summary>
+/// Checks that an empty array is correctly created and its elements are stored inside the instance.
+/// </summary>
+QTEST_CASE ( Constructor1_CreatesAnEmptyInlineArray_Test )
+{
+    // [Preparation]
+    const bool IS_EMPTY = true;
+    const bool IS_INLINE = true;
+
+    // [Execution]
+    QArrayInline<u32_q, 4U> arInlineArray;
+    
+    // [Verification]
+    bool bIsEmpty = arInlineArray.IsEmpty();
+    bool bIsInline = arInlineArray.IsInline();
+    BOOST_CHECK_EQUAL(bIsEmpty, IS_EMPTY);
+    BOOST_CHECK_EQUAL(bIsInline, IS_INLINE);
+}
+
+/// <summary>
+/// Checks that the capacity equals the number of elements that can be stored inside the instance.
+/// </summary>
+QTEST_CASE ( Constructor1_CapacityEqualsInlineCapacity_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 4U;
+
+    // [Execution]
+    QArrayInline<u32_q, 4U> arInlineArray;
+    
+    // [Verification]
+    pointer_uint_q uCapacity = arInlineArray.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the elements are stored inside the instance when the input capacity is not greater than the inline capacity.
+/// </summary>
+QTEST_CASE ( Constructor2_ElementsAreInlineWhenCapacityIsNotGreaterThanInlineCapacity_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INPUT_CAPACITY = 3U;
+    const pointer_uint_q EXPECTED_CAPACITY = 4U;
+    const bool IS_INLINE = true;
+
+    // [Execution]
+    QArrayInline<u32_q, 4U> arInlineArray(INPUT_CAPACITY);
+    
+    // [Verification]
+    pointer_uint_q uCapacity = arInlineArray.GetCapacity();
+    bool bIsInline = arInlineArray.IsInline();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(bIsInline, IS_INLINE);
+}
+
+/// <summary>
+/// Checks that memory is reserved from the allocator when the input capacity is greater than the inline capacity.
+/// </summary>
+QTEST_CASE ( Constructor2_ElementsAreNotInlineWhenCapacityIsGreaterThanInlineCapacity_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INPUT_CAPACITY = 10U;
+    const bool IS_INLINE = false;
+
+    // [Execution]
+    QArrayInline<u32_q, 4U> arInlineArray(INPUT_CAPACITY);
+    
+    // [Verification]
+    pointer_uint_q uCapacity = arInlineArray.GetCapacity();
+    bool bIsInline = arInlineArray.IsInline();
+    BOOST_CHECK_EQUAL(uCapacity, INPUT_CAPACITY);
+    BOOST_CHECK_EQUAL(bIsInline, IS_INLINE);
+}
+
+/// <summary>
+/// Checks that elements are copied in order and stored inside the instance when they fit.
+/// </summary>
+QTEST_CASE ( Constructor3_ElementsAreCopiedInOrderAndStoredInline_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 1U, 2U, 3U };
+    const pointer_uint_q EXPECTED_COUNT = 3U;
+    const bool IS_INLINE = true;
+    QArrayInline<u32_q, 4U> arOriginalArray;
+    arOriginalArray.Add(1U);
+    arOriginalArray.Add(2U);
+    arOriginalArray.Add(3U);
+
+    // [Execution]
+    QArrayInline<u32_q, 4U> arInlineArray(arOriginalArray);
+    
+    // [Verification]
+    pointer_uint_q uCount = arInlineArray.GetCount();
+    bool bIsInline = arInlineArray.IsInline();
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(bIsInline, IS_INLINE);
+    BOOST_CHECK(arInlineArray.GetAllocator()->GetPointer() != arOriginalArray.GetAllocator()->GetPointer());
+    BOOST_CHECK_EQUAL_COLLECTIONS(&arInlineArray[0], &arInlineArray[0] + uCount, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that elements are copied in order when they do not fit inside the instance.
+/// </summary>
+QTEST_CASE ( Constructor3_ElementsAreCopiedInOrderWhenTheyAreNotInline_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 1U, 2U, 3U, 4U, 5U, 6U };
+    const pointer_uint_q EXPECTED_COUNT = 6U;
+    const bool IS_INLINE = false;
+    QArrayInline<u32_q, 4U> arOriginalArray;
+
+    for(u32_q i = 1U; i <= EXPECTED_COUNT; ++i)
+        arOriginalArray.Add(i);
+
+    // [Execution]
+    QArrayInline<u32_q, 4U> arInlineArray(arOriginalArray);
+    
+    // [Verification]
+    pointer_uint_q uCount = arInlineArray.GetCount();
+    bool bIsInline = arInlineArray.IsInline();
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(bIsInline, IS_INLINE);
+    BOOST_CHECK_EQUAL_COLLECTIONS(&arInlineArray[0], &arInlineArray[0] + uCount, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the copy constructor of every element is called.
+/// </summary>
+QTEST_CASE ( Constructor3_CopyConstructorOfEveryElementIsCalled_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+    // [Preparation]
+    const unsigned int EXPECTED_CALLS = 3U;
+    QArrayInline<CallCounter, 4U> arOriginalArray;
+    arOriginalArray.Add(CallCounter());
+    arOriginalArray.Add(CallCounter());
+    arOriginalArray.Add(CallCounter());
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    QArrayInline<CallCounter, 4U> arInlineArray(arOriginalArray);
+    
+    // [Verification]
+    unsigned int uCopyConstructorCalls = CallCounter::GetCopyConstructorCallsCount();
+    BOOST_CHECK_EQUAL(uCopyConstructorCalls, EXPECTED_CALLS);
+}
+
+/// <summary>
+/// Checks that the elements of a common array are copied in order.
+/// </summary>
+QTEST_CASE ( Constructor4_ElementsAreCopiedFromCommonArray_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 1U, 2U };
+    const pointer_uint_q INPUT_COUNT = 2U;
+    const bool IS_INLINE = true;
+
+    // [Execution]
+    QArrayInline<u32_q, 4U> arInlineArray(INPUT_ELEMENTS, INPUT_COUNT);
+    
+    // [Verification]
+    pointer_uint_q uCount = arInlineArray.GetCount();
+    bool bIsInline = arInlineArray.IsInline();
+    BOOST_CHECK_EQUAL(uCount, INPUT_COUNT);
+    BOOST_CHECK_EQUAL(bIsInline, IS_INLINE);
+    BOOST_CHECK_EQUAL_COLLECTIONS(&arInlineArray[0], &arInlineArray[0] + uCount, INPUT_ELEMENTS, INPUT_ELEMENTS + INPUT_COUNT);
+}
+
+/// <summary>
+/// Checks that elements are correctly copied when the resident array has less elements than the input array.
+/// </summary>
+QTEST_CASE ( AssignmentOperator_ElementsAreCopiedWhenResidentArrayHasLessElements_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 1U, 2U, 3U, 4U, 5U };
+    const pointer_uint_q EXPECTED_COUNT = 5U;
+    QArrayInline<u32_q, 4U> arOriginalArray;
+
+    for(u32_q i = 1U; i <= EXPECTED_COUNT; ++i)
+        arOriginalArray.Add(i);
+
+    QArrayInline<u32_q, 4U> arInlineArray;
+    arInlineArray.Add(7U);
+
+    // [Execution]
+    arInlineArray = arOriginalArray;
+    
+    // [Verification]
+    pointer_uint_q uCount = arInlineArray.GetCount();
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL_COLLECTIONS(&arInlineArray[0], &arInlineArray[0] + uCount, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that elements are correctly copied when the resident array has more elements than the input array.
+/// </summary>
+QTEST_CASE ( AssignmentOperator_ElementsAreCopiedWhenResidentArrayHasMoreElements_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 1U, 2U };
+    const pointer_uint_q EXPECTED_COUNT = 2U;
+    QArrayInline<u32_q, 4U> arOriginalArray;
+    arOriginalArray.Add(1U);
+    arOriginalArray.Add(2U);
+
+    QArrayInline<u32_q, 4U> arInlineArray;
+
+    for(u32_q i = 0; i < 6U; ++i)
+        arInlineArray.Add(i + 10U);
+
+    // [Execution]
+    arInlineArray = arOriginalArray;
+    
+    // [Verification]
+    pointer_uint_q uCount = arInlineArray.GetCount();
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL_COLLECTIONS(&arInlineArray[0], &arInlineArray[0] + uCount, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that elements stay inside the instance while they fit.
+/// </summary>
+QTEST_CASE ( Add_ElementsAreInlineWhileTheyFit_Test )
+{
+    // [Preparation]
+    const bool IS_INLINE = true;
+    const pointer_uint_q EXPECTED_CAPACITY = 4U;
+    QArrayInline<u32_q, 4U> arInlineArray;
+    const void* INLINE_BUFFER = arInlineArray.GetAllocator()->GetPointer();
+
+    // [Execution]
+    for(u32_q i = 0; i < 4U; ++i)
+        arInlineArray.Add(i);
+    
+    // [Verification]
+    bool bIsInline = arInlineArray.IsInline();
+    pointer_uint_q uCapacity = arInlineArray.GetCapacity();
+    BOOST_CHECK_EQUAL(bIsInline, IS_INLINE);
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+    BOOST_CHECK(&arInlineArray[0] == INLINE_BUFFER);
+}
+
+/// <summary>
+/// Checks that elements are moved to the allocator, keeping their order, when they do not fit inside the instance.
+/// </summary>
+QTEST_CASE ( Add_ElementsAreMovedToAllocatorWhenTheyDoNotFit_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 1U, 2U, 3U, 4U };
+    const pointer_uint_q EXPECTED_COUNT = 5U;
+    const bool IS_INLINE = false;
+    QArrayInline<u32_q, 4U> arInlineArray;
+
+    for(u32_q i = 0; i < 4U; ++i)
+        arInlineArray.Add(i);
+
+    // [Execution]
+    arInlineArray.Add(4U);
+    
+    // [Verification]
+    pointer_uint_q uCount = arInlineArray.GetCount();
+    bool bIsInline = arInlineArray.IsInline();
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(bIsInline, IS_INLINE);
+    BOOST_CHECK_EQUAL_COLLECTIONS(&arInlineArray[0], &arInlineArray[0] + uCount, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that elements are not copied when they are moved to the allocator.
+/// </summary>
+QTEST_CASE ( Add_ElementsAreNotCopiedWhenMovedToAllocator_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+    // [Preparation]
+    const unsigned int EXPECTED_COPIES = 1U; // Only the added element
+    const unsigned int EXPECTED_DESTRUCTIONS = 1U; // Only the temporary element
+    QArrayInline<CallCounter, 2U> arInlineArray;
+    arInlineArray.Add(CallCounter());
+    arInlineArray.Add(CallCounter());
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    arInlineArray.Add(CallCounter());
+    
+    // [Verification]
+    unsigned int uCopyConstructorCalls = CallCounter::GetCopyConstructorCallsCount();
+    unsigned int uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    BOOST_CHECK_EQUAL(uCopyConstructorCalls, EXPECTED_COPIES);
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_DESTRUCTIONS);
+}
+
+/// <summary>
+/// Checks that elements can be inserted and removed while they are stored inside the instance.
+/// </summary>
+QTEST_CASE ( InsertAndRemove_ElementsAreCorrectlyInsertedAndRemovedWhenInline_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 5U, 1U, 3U };
+    const pointer_uint_q EXPECTED_COUNT = 3U;
+    const bool IS_INLINE = true;
+    QArrayInline<u32_q, 4U> arInlineArray;
+    arInlineArray.Add(1U);
+    arInlineArray.Add(2U);
+    arInlineArray.Add(3U);
+
+    // [Execution]
+    arInlineArray.Insert(5U, 0);
+    arInlineArray.Remove(2U);
+    
+    // [Verification]
+    pointer_uint_q uCount = arInlineArray.GetCount();
+    bool bIsInline = arInlineArray.IsInline();
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(bIsInline, IS_INLINE);
+    BOOST_CHECK_EQUAL_COLLECTIONS(&arInlineArray[0], &arInlineArray[0] + uCount, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the destructor of every element is called when the array is cleared.
+/// </summary>
+QTEST_CASE ( Clear_DestructorOfEveryElementIsCalled_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+    // [Preparation]
+    const unsigned int EXPECTED_CALLS = 3U;
+    const bool IS_EMPTY = true;
+    QArrayInline<CallCounter, 4U> arInlineArray;
+    arInlineArray.Add(CallCounter());
+    arInlineArray.Add(CallCounter());
+    arInlineArray.Add(CallCounter());
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    arInlineArray.Clear();
+    
+    // [Verification]
+    unsigned int uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    bool bIsEmpty = arInlineArray.IsEmpty();
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(bIsEmpty, IS_EMPTY);
+}
+
+/// <summary>
+/// Checks that the elements can be added again after clearing the array.
+/// </summary>
+QTEST_CASE ( Clear_ElementsCanBeAddedAfterClearing_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 7U, 8U };
+    const pointer_uint_q EXPECTED_COUNT = 2U;
+    QArrayInline<u32_q, 4U> arInlineArray;
+    arInlineArray.Add(1U);
+    arInlineArray.Add(2U);
+    arInlineArray.Add(3U);
+    arInlineArray.Clear();
+
+    // [Execution]
+    arInlineArray.Add(7U);
+    arInlineArray.Add(8U);
+    
+    // [Verification]
+    pointer_uint_q uCount = arInlineArray.GetCount();
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL_COLLECTIONS(&arInlineArray[0], &arInlineArray[0] + uCount, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the elements are correctly cloned from an inline array to an array whose elements are not inline.
+/// </summary>
+QTEST_CASE ( Clone_ElementsAreClonedFromInlineArrayToNonInlineArray_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 1U, 2U, 3U };
+    const pointer_uint_q EXPECTED_COUNT = 3U;
+    QArrayInline<u32_q, 4U> arOriginalArray;
+    arOriginalArray.Add(1U);
+    arOriginalArray.Add(2U);
+    arOriginalArray.Add(3U);
+    QArrayInline<u32_q, 4U> arDestinationArray(8U);
+
+    // [Execution]
+    arOriginalArray.Clone(arDestinationArray);
+    
+    // [Verification]
+    pointer_uint_q uCount = arDestinationArray.GetCount();
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL_COLLECTIONS(&arDestinationArray[0], &arDestinationArray[0] + uCount, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the elements are correctly cloned from an array whose elements are not inline to an inline array.
+/// </summary>
+QTEST_CASE ( Clone_ElementsAreClonedFromNonInlineArrayToInlineArray_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 1U, 2U, 3U, 4U, 5U, 6U };
+    const pointer_uint_q EXPECTED_COUNT = 6U;
+    QArrayInline<u32_q, 4U> arOriginalArray;
+
+    for(u32_q i = 1U; i <= EXPECTED_COUNT; ++i)
+        arOriginalArray.Add(i);
+
+    QArrayInline<u32_q, 4U> arDestinationArray;
+    arDestinationArray.Add(9U);
+
+    // [Execution]
+    arOriginalArray.Clone(arDestinationArray);
+    
+    // [Verification]
+    pointer_uint_q uCount = arDestinationArray.GetCount();
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL_COLLECTIONS(&arDestinationArray[0], &arDestinationArray[0] + uCount, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the capacity is increased and elements are kept when reserving more memory than the inline capacity.
+/// </summary>
+QTEST_CASE ( Reserve_ElementsAreKeptWhenCapacityExceedsInlineCapacity_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 1U, 2U };
+    const pointer_uint_q EXPECTED_COUNT = 2U;
+    const pointer_uint_q EXPECTED_CAPACITY = 20U;
+    const bool IS_INLINE = false;
+    QArrayInline<u32_q, 4U> arInlineArray;
+    arInlineArray.Add(1U);
+    arInlineArray.Add(2U);
+
+    // [Execution]
+    arInlineArray.Reserve(EXPECTED_CAPACITY);
+    
+    // [Verification]
+    pointer_uint_q uCount = arInlineArray.GetCount();
+    pointer_uint_q uCapacity = arInlineArray.GetCapacity();
+    bool bIsInline = arInlineArray.IsInline();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(bIsInline, IS_INLINE);
+    BOOST_CHECK_EQUAL_COLLECTIONS(&arInlineArray[0], &arInlineArray[0] + uCount, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that elements are stored correctly aligned inside the instance.
+/// </summary>
+QTEST_CASE ( Add_InlineElementsAreCorrectlyAligned_Test )
+{
+    // [Preparation]
+    const pointer_uint_q ALIGNMENT = alignof_q(double);
+    const pointer_uint_q ZERO = 0;
+    QArrayInline<double, 3U> arInlineArray;
+
+    // [Execution]
+    arInlineArray.Add(1.0);
+    
+    // [Verification]
+    pointer_uint_q uMisalignment = rcast_q(&arInlineArray[0], pointer_uint_q) % ALIGNMENT;
+    BOOST_CHECK_EQUAL(uMisalignment, ZERO);
+}
+
+/// <summary>
+/// Checks that elements are moved back inside the instance, keeping their order, when the capacity is reduced so they fit.
+/// </summary>
+QTEST_CASE ( ShrinkToFit_ElementsAreMovedBackInsideTheInstanceWhenTheyFit_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 1U, 2U };
+    const pointer_uint_q EXPECTED_COUNT = 3U;
+    const bool IS_INLINE = true;
+    QArrayInline<u32_q, 4U> arInlineArray;
+
+    for(u32_q i = 0; i < 6U; ++i)
+        arInlineArray.Add(i);
+
+    arInlineArray.RemoveRange(3U, 5U);
+
+    // [Execution]
+    arInlineArray.ShrinkToFit();
+    
+    // [Verification]
+    pointer_uint_q uCount = arInlineArray.GetCount();
+    bool bIsInline = arInlineArray.IsInline();
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(bIsInline, IS_INLINE);
+    BOOST_CHECK_EQUAL_COLLECTIONS(&arInlineArray[0], &arInlineArray[0] + uCount, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + EXPECTED_COUNT);
+}
+
+
+// End - Test Suite: QArrayInline
+QTEST_SUITE_END()
@@ -0,0 +1,181 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QBinarySearchTreeImageView.h"
+#include "QBinarySearchTree.h"
+#include "QArrayFixed.h"
+#include "BinaryStreamWriterMock.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QBinarySearchTreeImageView;
+using Kinesis::QuimeraEngine::Tools::Containers::QBinarySearchTree;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayFixed;
+using Kinesis::QuimeraEngine::Tools::Containers::EQTreeTraversalOrder;
+using Kinesis::QuimeraEngine::Tools::Containers::Test::BinaryStreamWriterMock;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+QTEST_SUITE_BEGIN( QBinarySearchTreeImageView_TestSuite )
+
+/// <summary>
+/// Checks that the elements of the image are stored in ascending order.
+/// </summary>
+QTEST_CASE ( Constructor_ElementsAreStoredInAscendingOrder_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 5U, 2U, 8U, 1U, 9U, 3U };
+    const u32_q EXPECTED_ELEMENTS[] = { 1U, 2U, 3U, 5U, 8U, 9U };
+    const pointer_uint_q EXPECTED_COUNT = 6U;
+    QBinarySearchTree<u32_q> tree;
+
+    for(pointer_uint_q i = 0; i < EXPECTED_COUNT; ++i)
+        tree.Add(INPUT_ELEMENTS[i], EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    BinaryStreamWriterMock writer(512U);
+    tree.WriteImage(writer);
+
+    // [Execution]
+    QBinarySearchTreeImageView<u32_q> view(writer.GetBuffer());
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(view.GetCount(), EXPECTED_COUNT);
+
+    for(pointer_uint_q i = 0; i < EXPECTED_COUNT; ++i)
+        BOOST_CHECK_EQUAL(view.GetValue(i), EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that every element is found and its position is its index in ascending order.
+/// </summary>
+QTEST_CASE ( Find_ReturnsPositionInAscendingOrderWhenElementExists_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_ELEMENTS[] = { 5U, 2U, 8U, 1U, 9U, 3U, 7U, 4U, 6U };
+    const pointer_uint_q COUNT = 9U;
+    QBinarySearchTree<u32_q> tree;
+
+    for(pointer_uint_q i = 0; i < COUNT; ++i)
+        tree.Add(INPUT_ELEMENTS[i], EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    BinaryStreamWriterMock writer(512U);
+    tree.WriteImage(writer);
+    QBinarySearchTreeImageView<u32_q> view(writer.GetBuffer());
+
+    for(pointer_uint_q i = 0; i < COUNT; ++i)
+    {
+        // [Execution]
+        pointer_uint_q uPosition = view.Find(INPUT_ELEMENTS[i]);
+
+        // [Verification]
+        BOOST_CHECK_EQUAL(uPosition, scast_q(INPUT_ELEMENTS[i] - 1U, pointer_uint_q));
+    }
+}
+
+/// <summary>
+/// Checks that the end position is returned when the element does not exist.
+/// </summary>
+QTEST_CASE ( Find_ReturnsEndPositionWhenElementDoesNotExist_Test )
+{
+    // [Preparation]
+    const pointer_uint_q END_POSITION = QBinarySearchTreeImageView<u32_q>::END_POSITION;
+    QBinarySearchTree<u32_q> tree;
+    tree.Add(5U, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    tree.Add(2U, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    tree.Add(8U, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    BinaryStreamWriterMock writer(512U);
+    tree.WriteImage(writer);
+    QBinarySearchTreeImageView<u32_q> view(writer.GetBuffer());
+
+    // [Execution]
+    pointer_uint_q uPosition = view.Find(6U);
+    bool bContains = view.Contains(6U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uPosition, END_POSITION);
+    BOOST_CHECK(!bContains);
+}
+
+/// <summary>
+/// Checks that nothing is found in the image of an empty tree.
+/// </summary>
+QTEST_CASE ( Find_ReturnsEndPositionWhenImageIsEmpty_Test )
+{
+    // [Preparation]
+    const pointer_uint_q END_POSITION = QBinarySearchTreeImageView<u32_q>::END_POSITION;
+    const bool IS_EMPTY = true;
+    QBinarySearchTree<u32_q> tree;
+    BinaryStreamWriterMock writer(512U);
+    tree.WriteImage(writer);
+    QBinarySearchTreeImageView<u32_q> view(writer.GetBuffer());
+
+    // [Execution]
+    pointer_uint_q uPosition = view.Find(1U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uPosition, END_POSITION);
+    BOOST_CHECK_EQUAL(view.IsEmpty(), IS_EMPTY);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the image does not belong to a binary search tree.
+/// </summary>
+QTEST_CASE ( Constructor_AssertionFailsWhenImageIsNotBinarySearchTree_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    const u32_q ARRAY_ELEMENTS[] = { 1U, 2U };
+    QArrayFixed<u32_q> arOriginal(ARRAY_ELEMENTS, 2U);
+    BinaryStreamWriterMock writer(512U);
+    arOriginal.WriteImage(writer);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QBinarySearchTreeImageView<u32_q> view(writer.GetBuffer());
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: QBinarySearchTreeImageView
+QTEST_SUITE_END()
@@ -89,6 +89,47 @@ public:
         return QBinarySearchTree<T, AllocatorT>::END_POSITION_FORWARD;
     }
 
+    const QBinaryNode* GetNode(const pointer_uint_q uPosition) const
+    {
+        return QBinarySearchTree<T, AllocatorT, ComparatorT>::m_pNodeBasePointer + uPosition;
+    }
+
+    // Gets the number of levels of the subtree whose root is the given node
+    pointer_uint_q GetHeight(const pointer_uint_q uPosition) const
+    {
+        if(uPosition == QBinarySearchTreeWhiteBox::GetEndPositionForward())
+            return 0;
+
+        const pointer_uint_q LEFT_HEIGHT = this->GetHeight(this->GetNode(uPosition)->GetLeftChild());
+        const pointer_uint_q RIGHT_HEIGHT = this->GetHeight(this->GetNode(uPosition)->GetRightChild());
+
+        return 1U + (LEFT_HEIGHT > RIGHT_HEIGHT ? LEFT_HEIGHT : RIGHT_HEIGHT);
+    }
+
+    // Gets the number of black nodes in every path from the given node to a leaf; it returns -1 if either the paths do not have
+    // the same number of black nodes or there is a red node with a red child
+    int GetBlackHeight(const pointer_uint_q uPosition) const
+    {
+        if(uPosition == QBinarySearchTreeWhiteBox::GetEndPositionForward())
+            return 0;
+
+        const QBinaryNode* pNode = this->GetNode(uPosition);
+        const pointer_uint_q LEFT_CHILD = pNode->GetLeftChild();
+        const pointer_uint_q RIGHT_CHILD = pNode->GetRightChild();
+
+        if(pNode->IsRed() && ((LEFT_CHILD != QBinarySearchTreeWhiteBox::GetEndPositionForward() && this->GetNode(LEFT_CHILD)->IsRed()) ||
+                              (RIGHT_CHILD != QBinarySearchTreeWhiteBox::GetEndPositionForward() && this->GetNode(RIGHT_CHILD)->IsRed())))
+            return -1;
+
+        const int LEFT_BLACK_HEIGHT = this->GetBlackHeight(LEFT_CHILD);
+        const int RIGHT_BLACK_HEIGHT = this->GetBlackHeight(RIGHT_CHILD);
+
+        if(LEFT_BLACK_HEIGHT == -1 || LEFT_BLACK_HEIGHT != RIGHT_BLACK_HEIGHT)
+            return -1;
+
+        return LEFT_BLACK_HEIGHT + (pNode->IsRed() ? 0 : 1);
+    }
+
 };
 
 } //namespace Test
@@ -34,10 +34,14 @@ using namespace boost::unit_test;
 #include "QBinarySearchTreeWhiteBox.h"
 #include "CallCounter.h"
 #include "QAssertException.h"
+#include "SQFloat.h"
 
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
 using Kinesis::QuimeraEngine::Tools::Containers::QBinarySearchTree;
 using Kinesis::QuimeraEngine::Tools::Containers::Test::QBinarySearchTreeWhiteBox;
+using Kinesis::QuimeraEngine::Tools::Containers::QContainerStatistics;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
 
 
 QTEST_SUITE_BEGIN( QBinarySearchTree_TestSuite )
@@ -544,23 +548,23 @@ QTEST_CASE( OperatorEquality_ReturnsFalseWhenTreesHaveSameStructureButElementsAr
 QTEST_CASE( OperatorEquality_ReturnsFalseWhenTreesAreHaveSameValuesButDifferentStructure_Test )
 {
     // [Preparation]
-    QBinarySearchTree<int> TREE1(8);
-    TREE1.Add(5, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE1.Add(3, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE1.Add(7, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    // Note: The tree is balanced after every addition, so the insertion order must produce different balanced structures
+    //       TREE1:  2          TREE2:    3
+    //              / \                  / \
+    //             1   3                2   4
+    //                  \              /
+    //                   4            1
+    QBinarySearchTree<int> TREE1(4);
+    TREE1.Add(2, EQTreeTraversalOrder::E_DepthFirstInOrder);
     TREE1.Add(1, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE1.Add(3, EQTreeTraversalOrder::E_DepthFirstInOrder);
     TREE1.Add(4, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE1.Add(6, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE1.Add(9, EQTreeTraversalOrder::E_DepthFirstInOrder);
 
-    QBinarySearchTree<int> TREE2(8);
+    QBinarySearchTree<int> TREE2(4);
     TREE2.Add(3, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE2.Add(5, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE2.Add(7, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE2.Add(1, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE2.Add(2, EQTreeTraversalOrder::E_DepthFirstInOrder);
     TREE2.Add(4, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE2.Add(6, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE2.Add(9, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE2.Add(1, EQTreeTraversalOrder::E_DepthFirstInOrder);
 
     const bool EXPECTED_RESULT = false;
 
@@ -689,23 +693,23 @@ QTEST_CASE( OperatorInequality_ReturnsTrueWhenTreesHaveSameStructureButElementsA
 QTEST_CASE( OperatorInequality_ReturnsTrueWhenTreesAreHaveSameValuesButDifferentStructure_Test )
 {
     // [Preparation]
-    QBinarySearchTree<int> TREE1(8);
-    TREE1.Add(5, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE1.Add(3, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE1.Add(7, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    // Note: The tree is balanced after every addition, so the insertion order must produce different balanced structures
+    //       TREE1:  2          TREE2:    3
+    //              / \                  / \
+    //             1   3                2   4
+    //                  \              /
+    //                   4            1
+    QBinarySearchTree<int> TREE1(4);
+    TREE1.Add(2, EQTreeTraversalOrder::E_DepthFirstInOrder);
     TREE1.Add(1, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE1.Add(3, EQTreeTraversalOrder::E_DepthFirstInOrder);
     TREE1.Add(4, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE1.Add(6, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE1.Add(9, EQTreeTraversalOrder::E_DepthFirstInOrder);
 
-    QBinarySearchTree<int> TREE2(8);
+    QBinarySearchTree<int> TREE2(4);
     TREE2.Add(3, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE2.Add(5, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE2.Add(7, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE2.Add(1, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE2.Add(2, EQTreeTraversalOrder::E_DepthFirstInOrder);
     TREE2.Add(4, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE2.Add(6, EQTreeTraversalOrder::E_DepthFirstInOrder);
-    TREE2.Add(9, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE2.Add(1, EQTreeTraversalOrder::E_DepthFirstInOrder);
 
     const bool EXPECTED_RESULT = true;
 
@@ -1125,6 +1129,46 @@ QTEST_CASE ( Add_CapacityIsIncrementedWhenNecessary_Test )
     BOOST_CHECK(uCapacityAfterAdding > CAPACITY_BEFORE_ADDING);
 }
 
+/// <summary>
+/// Checks that the tree remains balanced when elements are added in ascending order, which is the worst case for a non-balanced tree.
+/// </summary>
+QTEST_CASE ( Add_TreeRemainsBalancedWhenElementsAreAddedInAscendingOrder_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 1023;
+    const pointer_uint_q MAXIMUM_EXPECTED_HEIGHT = 20U; // 2 * log2(n + 1)
+    QBinarySearchTreeWhiteBox<int> TREE(NUMBER_OF_ELEMENTS);
+
+    // [Execution]
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        TREE.Add(i, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    pointer_uint_q uHeight = TREE.GetHeight(TREE.GetRootPosition());
+    BOOST_CHECK(uHeight <= MAXIMUM_EXPECTED_HEIGHT);
+}
+
+/// <summary>
+/// Checks that the tree fulfills the red-black properties (black root, no red node with red children and the same number of black nodes in every path) after adding elements.
+/// </summary>
+QTEST_CASE ( Add_RedBlackPropertiesAreFulfilledAfterAddingElements_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 500;
+    const int NOT_FULFILLED = -1;
+    QBinarySearchTreeWhiteBox<int> TREE(NUMBER_OF_ELEMENTS);
+
+    // [Execution]
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        TREE.Add((i * 37) % NUMBER_OF_ELEMENTS, EQTreeTraversalOrder::E_DepthFirstInOrder); // Elements are not added in order
+
+    // [Verification]
+    bool bRootIsBlack = !TREE.GetNode(TREE.GetRootPosition())->IsRed();
+    int nBlackHeight = TREE.GetBlackHeight(TREE.GetRootPosition());
+    BOOST_CHECK(bRootIsBlack);
+    BOOST_CHECK_NE(nBlackHeight, NOT_FULFILLED);
+}
+
 #if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
 
 /// <summary>
@@ -1461,6 +1505,66 @@ QTEST_CASE ( Remove_ReturnedIteratorPointsToNextElement_Test )
     BOOST_CHECK(itResult == EXPECTED_ITERATOR);
 }
 
+/// <summary>
+/// Checks that the tree fulfills the red-black properties and contains the expected elements after removing elements.
+/// </summary>
+QTEST_CASE ( Remove_RedBlackPropertiesAreFulfilledAfterRemovingElements_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 500;
+    const int NOT_FULFILLED = -1;
+    QBinarySearchTreeWhiteBox<int> TREE(NUMBER_OF_ELEMENTS);
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        TREE.Add((i * 37) % NUMBER_OF_ELEMENTS, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    // Odd elements are removed, including the root and both leaf and inner nodes
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        const int ELEMENT = (i * 13) % NUMBER_OF_ELEMENTS;
+
+        if(ELEMENT % 2 == 1)
+            TREE.Remove(TREE.PositionOf(ELEMENT, EQTreeTraversalOrder::E_DepthFirstInOrder));
+    }
+
+    // [Verification]
+    bool bRootIsBlack = !TREE.GetNode(TREE.GetRootPosition())->IsRed();
+    int nBlackHeight = TREE.GetBlackHeight(TREE.GetRootPosition());
+    BOOST_CHECK(bRootIsBlack);
+    BOOST_CHECK_NE(nBlackHeight, NOT_FULFILLED);
+
+    bool bResultIsWhatEspected = TREE.GetCount() == NUMBER_OF_ELEMENTS / 2;
+    QBinarySearchTree<int>::QConstBinarySearchTreeIterator it = TREE.GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    for(int i = 0; !it.IsEnd(); ++it, i += 2)
+        bResultIsWhatEspected = bResultIsWhatEspected && *it == i;
+
+    BOOST_CHECK(bResultIsWhatEspected);
+}
+
+/// <summary>
+/// Checks that the remaining elements keep their physical position when an element with both children is removed, so iterators to them are still valid.
+/// </summary>
+QTEST_CASE ( Remove_RemainingElementsDoNotChangeTheirPositionWhenElementHasBothChildren_Test )
+{
+    // [Preparation]
+    QBinarySearchTree<int> TREE(5);
+    TREE.Add(5, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    QBinarySearchTree<int>::QConstBinarySearchTreeIterator itElementToRemove = TREE.Add(3, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    const QBinarySearchTree<int>::QConstBinarySearchTreeIterator LEFT_CHILD = TREE.Add(1, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    const QBinarySearchTree<int>::QConstBinarySearchTreeIterator RIGHT_CHILD = TREE.Add(4, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    const QBinarySearchTree<int>::QConstBinarySearchTreeIterator ROOT = TREE.PositionOf(5, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    TREE.Remove(itElementToRemove);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(*LEFT_CHILD, 1);
+    BOOST_CHECK_EQUAL(*RIGHT_CHILD, 4);
+    BOOST_CHECK_EQUAL(*ROOT, 5);
+}
+
 #if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
 
 /// <summary>
@@ -2000,6 +2104,247 @@ QTEST_CASE ( IsEmpty_ReturnsFalseWhenTreeIsNotEmpty_Test )
     BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
 }
 
+/// <summary>
+/// Checks that the element is constructed in place, calling the default constructor and not the copy constructor.
+/// </summary>
+QTEST_CASE ( Emplace1_ElementIsDefaultConstructedWithoutCallingCopyConstructor_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+    // [Preparation]
+    const unsigned int EXPECTED_CONSTRUCTOR_CALLS = 1U;
+    const unsigned int EXPECTED_COPY_CONSTRUCTOR_CALLS = 0;
+    const pointer_uint_q EXPECTED_COUNT = 1U;
+    QBinarySearchTree<CallCounter> TREE(3);
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    QBinarySearchTree<CallCounter>::QConstBinarySearchTreeIterator it = TREE.Emplace(EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(CallCounter::GetConstructorCallsCount(), EXPECTED_CONSTRUCTOR_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetCopyConstructorCallsCount(), EXPECTED_COPY_CONSTRUCTOR_CALLS);
+    BOOST_CHECK_EQUAL(TREE.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK(!it.IsEnd());
+}
+
+/// <summary>
+/// Checks that the elements constructed from the input arguments are placed in order.
+/// </summary>
+QTEST_CASE ( Emplace2_ElementsAreCorrectlyPlacedInOrder_Test )
+{
+    // [Preparation]
+    const int INPUT_ELEMENTS[] = {4, 2, 6, 1, 3, 5, 7};
+    const int EXPECTED_VALUES[] = {1, 2, 3, 4, 5, 6, 7};
+    QBinarySearchTree<int> TREE(3);
+
+    // [Execution]
+    for(int i = 0; i < 7; ++i)
+        TREE.Emplace(EQTreeTraversalOrder::E_DepthFirstInOrder, INPUT_ELEMENTS[i]);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+
+    QBinarySearchTree<int>::QConstBinarySearchTreeIterator it = QBinarySearchTree<int>::QConstBinarySearchTreeIterator(&TREE, 0, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    int i = 0;
+
+    for(it.MoveFirst(); !it.IsEnd(); ++it, ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && *it == EXPECTED_VALUES[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(i, 7);
+}
+
+/// <summary>
+/// Checks that all the input arguments are passed to the constructor of the element, in the same order.
+/// </summary>
+QTEST_CASE ( Emplace3_ArgumentsArePassedToTheConstructorInTheSameOrder_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+
+    // [Preparation]
+    const string_q EXPECTED_VALUE("ABC");
+    QBinarySearchTree<string_q> TREE(3);
+    TREE.Add("XYZ", EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    QBinarySearchTree<string_q>::QConstBinarySearchTreeIterator it = TREE.Emplace(EQTreeTraversalOrder::E_DepthFirstInOrder, "ABCDEF", 3);
+
+    // [Verification]
+    BOOST_CHECK(*it == EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the height and the average depth of the nodes are correct.
+/// </summary>
+QTEST_CASE ( GetStatistics_HeightAndAverageDepthAreCorrect_Test )
+{
+    //       4
+    //     /   \
+    //    2     6
+    //   / \   / \
+    //  1   3 5   7
+
+    // [Preparation]
+    const pointer_uint_q EXPECTED_COUNT = 7U;
+    const pointer_uint_q EXPECTED_HEIGHT = 3U;
+    const float_q EXPECTED_AVERAGE_DEPTH = scast_q(10, float_q) / scast_q(EXPECTED_COUNT, float_q);
+    QBinarySearchTree<int> TREE(EXPECTED_COUNT);
+    TREE.Add(4, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(2, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(6, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(1, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(3, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(5, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(7, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    QContainerStatistics statistics = TREE.GetStatistics();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(statistics.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetHeight(), EXPECTED_HEIGHT);
+    BOOST_CHECK_EQUAL(statistics.GetAverageDepth(), EXPECTED_AVERAGE_DEPTH);
+}
+
+/// <summary>
+/// Checks that the height and the average depth are zero when the tree is empty.
+/// </summary>
+QTEST_CASE ( GetStatistics_HeightAndAverageDepthAreZeroWhenTreeIsEmpty_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_HEIGHT = 0;
+    const float_q EXPECTED_AVERAGE_DEPTH = SQFloat::_0;
+    QBinarySearchTree<int> TREE(4U);
+
+    // [Execution]
+    QContainerStatistics statistics = TREE.GetStatistics();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(statistics.GetHeight(), EXPECTED_HEIGHT);
+    BOOST_CHECK_EQUAL(statistics.GetAverageDepth(), EXPECTED_AVERAGE_DEPTH);
+}
+
+/// <summary>
+/// Checks that the used bytes are proportional to the number of elements, since every element occupies a block of both allocators.
+/// </summary>
+QTEST_CASE ( GetStatistics_UsedBytesAreProportionalToNumberOfElements_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 8U;
+    const pointer_uint_q EXPECTED_COUNT = 3U;
+    QBinarySearchTree<int> TREE(EXPECTED_CAPACITY);
+    TREE.Add(1, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(2, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(3, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    // [Execution]
+    QContainerStatistics statistics = TREE.GetStatistics();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(statistics.GetCapacity(), EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(statistics.GetUsedBytes() * EXPECTED_CAPACITY, statistics.GetReservedBytes() * EXPECTED_COUNT);
+}
+
+
+/// <summary>
+/// Checks that the capacity is reduced to the number of elements and the elements keep their order.
+/// </summary>
+QTEST_CASE ( ShrinkToFit_CapacityIsReducedAndElementsKeepTheirOrder_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 100;
+    const pointer_uint_q EXPECTED_CAPACITY = NUMBER_OF_ELEMENTS / 2;
+    QBinarySearchTree<int> TREE(NUMBER_OF_ELEMENTS);
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        TREE.Add((i * 37) % NUMBER_OF_ELEMENTS, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    for(int i = 1; i < NUMBER_OF_ELEMENTS; i += 2)
+        TREE.Remove(TREE.PositionOf(i, EQTreeTraversalOrder::E_DepthFirstInOrder));
+
+    // [Execution]
+    TREE.ShrinkToFit();
+
+    // [Verification]
+    pointer_uint_q uCapacity = TREE.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+
+    bool bResultIsWhatEspected = TREE.GetCount() == NUMBER_OF_ELEMENTS / 2;
+    QBinarySearchTree<int>::QConstBinarySearchTreeIterator it = TREE.GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    for(int i = 0; !it.IsEnd(); ++it, i += 2)
+        bResultIsWhatEspected = bResultIsWhatEspected && *it == i;
+
+    BOOST_CHECK(bResultIsWhatEspected);
+}
+
+/// <summary>
+/// Checks that elements are stored in consecutive memory positions, in ascending order, and the tree keeps its red-black properties.
+/// </summary>
+QTEST_CASE ( ShrinkToFit_ElementsAreStoredInAscendingOrderAndTreeIsStillBalanced_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 50;
+    const int NOT_FULFILLED = -1;
+    QBinarySearchTreeWhiteBox<int> TREE(NUMBER_OF_ELEMENTS * 2);
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        TREE.Add((i * 13) % NUMBER_OF_ELEMENTS, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    TREE.Remove(TREE.PositionOf(25, EQTreeTraversalOrder::E_DepthFirstInOrder));
+
+    // [Execution]
+    TREE.ShrinkToFit();
+
+    // [Verification]
+    bool bRootIsBlack = !TREE.GetNode(TREE.GetRootPosition())->IsRed();
+    int nBlackHeight = TREE.GetBlackHeight(TREE.GetRootPosition());
+    BOOST_CHECK(bRootIsBlack);
+    BOOST_CHECK_NE(nBlackHeight, NOT_FULFILLED);
+
+    bool bElementsAreConsecutive = true;
+    QBinarySearchTree<int>::QConstBinarySearchTreeIterator it = TREE.GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
+    const int* pFirst = &*it;
+
+    for(pointer_uint_q uIndex = 0; !it.IsEnd(); ++it, ++uIndex)
+        bElementsAreConsecutive = bElementsAreConsecutive && &*it == pFirst + uIndex;
+
+    BOOST_CHECK(bElementsAreConsecutive);
+}
+
+/// <summary>
+/// Checks that the capacity of an empty tree is reduced to one element and elements can be added afterwards.
+/// </summary>
+QTEST_CASE ( ShrinkToFit_CapacityOfEmptyTreeIsReducedToOneElement_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 1U;
+    const int EXPECTED_VALUES[] = {1, 2, 3};
+    QBinarySearchTree<int> TREE(10);
+
+    // [Execution]
+    TREE.ShrinkToFit();
+
+    // [Verification]
+    pointer_uint_q uCapacity = TREE.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+
+    TREE.Add(2, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(3, EQTreeTraversalOrder::E_DepthFirstInOrder);
+    TREE.Add(1, EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    bool bResultIsWhatEspected = true;
+    QBinarySearchTree<int>::QConstBinarySearchTreeIterator it = TREE.GetFirst(EQTreeTraversalOrder::E_DepthFirstInOrder);
+
+    for(int i = 0; !it.IsEnd(); ++it, ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && *it == EXPECTED_VALUES[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+}
+
+
 // End - Test Suite: QBinarySearchTree
 
 QTEST_SUITE_END()
@@ -0,0 +1,519 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QBitArray.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QBitArray;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+
+QTEST_SUITE_BEGIN( QBitArray_TestSuite )
+
+/// <summary>
+/// Checks that the bit array is empty after being created and its capacity is one lane.
+/// </summary>
+QTEST_CASE ( Constructor1_BitArrayIsEmpty_Test )
+{
+    // [Preparation]
+    const bool IS_EMPTY = true;
+    const pointer_uint_q EXPECTED_CAPACITY = 128U;
+
+    // [Execution]
+    QBitArray<> bitArray;
+
+    // [Verification]
+    bool bIsEmpty = bitArray.IsEmpty();
+    pointer_uint_q uCapacity = bitArray.GetCapacity();
+
+    BOOST_CHECK_EQUAL(bIsEmpty, IS_EMPTY);
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that all the bits have the value passed to the constructor.
+/// </summary>
+QTEST_CASE ( Constructor2_AllBitsHaveTheInputValue_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_COUNT = 200U;
+    const pointer_uint_q EXPECTED_CAPACITY = 256U;
+
+    // [Execution]
+    QBitArray<> bitArray(EXPECTED_COUNT, true);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bitArray.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(bitArray.GetCapacity(), EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(bitArray.CountSetBits(), EXPECTED_COUNT);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the number of bits is zero.
+/// </summary>
+QTEST_CASE ( Constructor2_AssertionFailsWhenCountIsZero_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QBitArray<> bitArray(0, false);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the copy has the same bits as the original.
+/// </summary>
+QTEST_CASE ( Constructor3_BitsAreCopied_Test )
+{
+    // [Preparation]
+    QBitArray<> originalBitArray(70U, false);
+    originalBitArray.SetBit(3U, true);
+    originalBitArray.SetBit(69U, true);
+
+    // [Execution]
+    QBitArray<> bitArray(originalBitArray);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bitArray.GetCount(), originalBitArray.GetCount());
+    BOOST_CHECK_EQUAL(bitArray.CountSetBits(), 2U);
+    BOOST_CHECK(bitArray.GetBit(3U));
+    BOOST_CHECK(bitArray.GetBit(69U));
+}
+
+/// <summary>
+/// Checks that bits added beyond the capacity are stored and previous bits are preserved.
+/// </summary>
+QTEST_CASE ( Add_BitsArePreservedWhenCapacityIsExceeded_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_BITS = 1000U;
+    const bool ALL_BITS_ARE_CORRECT = true;
+    QBitArray<> bitArray;
+
+    // [Execution]
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BITS; ++i)
+        bitArray.Add(i % 3U == 0);
+
+    // [Verification]
+    bool bAllBitsAreCorrect = bitArray.GetCount() == NUMBER_OF_BITS;
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BITS; ++i)
+        bAllBitsAreCorrect = bAllBitsAreCorrect && bitArray.GetBit(i) == (i % 3U == 0);
+
+    BOOST_CHECK_EQUAL(bAllBitsAreCorrect, ALL_BITS_ARE_CORRECT);
+    BOOST_CHECK_EQUAL(bitArray.GetCapacity() % 128U, 0U);
+}
+
+/// <summary>
+/// Checks that a bit can be set and reset without affecting its neighbours.
+/// </summary>
+QTEST_CASE ( SetBit_OnlyTheBitIsModified_Test )
+{
+    // [Preparation]
+    QBitArray<> bitArray(64U, false);
+
+    // [Execution]
+    bitArray.SetBit(31U, true);
+    bitArray.SetBit(32U, true);
+    bitArray.SetBit(32U, false);
+
+    // [Verification]
+    BOOST_CHECK(!bitArray.GetBit(30U));
+    BOOST_CHECK(bitArray.GetBit(31U));
+    BOOST_CHECK(!bitArray.GetBit(32U));
+    BOOST_CHECK_EQUAL(bitArray.CountSetBits(), 1U);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the position is out of bounds.
+/// </summary>
+QTEST_CASE ( GetBit_AssertionFailsWhenPositionIsOutOfBounds_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QBitArray<> bitArray(10U, false);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        bitArray.GetBit(10U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that bits added when the bit array grows are zero and removed bits are not restored when it grows again.
+/// </summary>
+QTEST_CASE ( Resize_NewBitsAreZero_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_COUNT = 300U;
+    QBitArray<> bitArray(100U, true);
+
+    // [Execution]
+    bitArray.Resize(40U);
+    bitArray.Resize(EXPECTED_COUNT);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bitArray.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(bitArray.CountSetBits(), 40U);
+    BOOST_CHECK(bitArray.GetBit(39U));
+    BOOST_CHECK(!bitArray.GetBit(40U));
+}
+
+/// <summary>
+/// Checks that the capacity is rounded up to a multiple of 128 bits and bits are preserved.
+/// </summary>
+QTEST_CASE ( Reserve_CapacityIsRoundedUpAndBitsArePreserved_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 384U;
+    QBitArray<> bitArray(5U, false);
+    bitArray.SetBit(4U, true);
+
+    // [Execution]
+    bitArray.Reserve(300U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bitArray.GetCapacity(), EXPECTED_CAPACITY);
+    BOOST_CHECK(bitArray.GetBit(4U));
+    BOOST_CHECK_EQUAL(bitArray.CountSetBits(), 1U);
+}
+
+/// <summary>
+/// Checks that the bit array is empty after clearing it and new bits are zero.
+/// </summary>
+QTEST_CASE ( Clear_BitArrayIsEmpty_Test )
+{
+    // [Preparation]
+    const bool IS_EMPTY = true;
+    QBitArray<> bitArray(50U, true);
+
+    // [Execution]
+    bitArray.Clear();
+
+    // [Verification]
+    bool bIsEmpty = bitArray.IsEmpty();
+    bitArray.Resize(50U);
+
+    BOOST_CHECK_EQUAL(bIsEmpty, IS_EMPTY);
+    BOOST_CHECK_EQUAL(bitArray.CountSetBits(), 0U);
+}
+
+/// <summary>
+/// Checks that bits beyond the last one are not set when all the bits are set.
+/// </summary>
+QTEST_CASE ( SetAll_OnlyExistingBitsAreSet_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_COUNT = 45U;
+    QBitArray<> bitArray(EXPECTED_COUNT, false);
+
+    // [Execution]
+    bitArray.SetAll(true);
+
+    // [Verification]
+    pointer_uint_q uSetBits = bitArray.CountSetBits();
+    bitArray.Resize(128U);
+
+    BOOST_CHECK_EQUAL(uSetBits, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(bitArray.CountSetBits(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the result of the AND operation is correct in every lane.
+/// </summary>
+QTEST_CASE ( And_ResultIsCorrect_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_BITS = 300U;
+    const bool ALL_BITS_ARE_CORRECT = true;
+    QBitArray<> bitArray(NUMBER_OF_BITS, false);
+    QBitArray<> otherBitArray(NUMBER_OF_BITS, false);
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BITS; ++i)
+    {
+        bitArray.SetBit(i, i % 2U == 0);
+        otherBitArray.SetBit(i, i % 3U == 0);
+    }
+
+    // [Execution]
+    bitArray.And(otherBitArray);
+
+    // [Verification]
+    bool bAllBitsAreCorrect = true;
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BITS; ++i)
+        bAllBitsAreCorrect = bAllBitsAreCorrect && bitArray.GetBit(i) == (i % 2U == 0 && i % 3U == 0);
+
+    BOOST_CHECK_EQUAL(bAllBitsAreCorrect, ALL_BITS_ARE_CORRECT);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the number of bits of both bit arrays is different.
+/// </summary>
+QTEST_CASE ( And_AssertionFailsWhenCountsAreDifferent_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QBitArray<> bitArray(10U, false);
+    QBitArray<> otherBitArray(11U, false);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        bitArray.And(otherBitArray);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the result of the OR operation is correct in every lane.
+/// </summary>
+QTEST_CASE ( Or_ResultIsCorrect_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_BITS = 300U;
+    const bool ALL_BITS_ARE_CORRECT = true;
+    QBitArray<> bitArray(NUMBER_OF_BITS, false);
+    QBitArray<> otherBitArray(NUMBER_OF_BITS, false);
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BITS; ++i)
+    {
+        bitArray.SetBit(i, i % 2U == 0);
+        otherBitArray.SetBit(i, i % 3U == 0);
+    }
+
+    // [Execution]
+    bitArray.Or(otherBitArray);
+
+    // [Verification]
+    bool bAllBitsAreCorrect = true;
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BITS; ++i)
+        bAllBitsAreCorrect = bAllBitsAreCorrect && bitArray.GetBit(i) == (i % 2U == 0 || i % 3U == 0);
+
+    BOOST_CHECK_EQUAL(bAllBitsAreCorrect, ALL_BITS_ARE_CORRECT);
+}
+
+/// <summary>
+/// Checks that the result of the XOR operation is correct in every lane.
+/// </summary>
+QTEST_CASE ( Xor_ResultIsCorrect_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_BITS = 300U;
+    const bool ALL_BITS_ARE_CORRECT = true;
+    QBitArray<> bitArray(NUMBER_OF_BITS, false);
+    QBitArray<> otherBitArray(NUMBER_OF_BITS, false);
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BITS; ++i)
+    {
+        bitArray.SetBit(i, i % 2U == 0);
+        otherBitArray.SetBit(i, i % 3U == 0);
+    }
+
+    // [Execution]
+    bitArray.Xor(otherBitArray);
+
+    // [Verification]
+    bool bAllBitsAreCorrect = true;
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BITS; ++i)
+        bAllBitsAreCorrect = bAllBitsAreCorrect && bitArray.GetBit(i) == ((i % 2U == 0) != (i % 3U == 0));
+
+    BOOST_CHECK_EQUAL(bAllBitsAreCorrect, ALL_BITS_ARE_CORRECT);
+}
+
+/// <summary>
+/// Checks that every bit is inverted and bits beyond the last one remain zero.
+/// </summary>
+QTEST_CASE ( Not_EveryBitIsInvertedAndBitsBeyondTheLastOneAreZero_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_BITS = 70U;
+    const pointer_uint_q EXPECTED_SET_BITS = 69U;
+    QBitArray<> bitArray(NUMBER_OF_BITS, false);
+    bitArray.SetBit(5U, true);
+
+    // [Execution]
+    bitArray.Not();
+
+    // [Verification]
+    pointer_uint_q uSetBits = bitArray.CountSetBits();
+    bool bBitIsSet = bitArray.GetBit(5U);
+    bitArray.Resize(256U);
+
+    BOOST_CHECK_EQUAL(uSetBits, EXPECTED_SET_BITS);
+    BOOST_CHECK(!bBitIsSet);
+    BOOST_CHECK_EQUAL(bitArray.CountSetBits(), EXPECTED_SET_BITS);
+}
+
+/// <summary>
+/// Checks that the first set bit is found in any word.
+/// </summary>
+QTEST_CASE ( FindFirstSetBit_FirstSetBitIsFound_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_POSITION = 161U;
+    QBitArray<> bitArray(300U, false);
+    bitArray.SetBit(EXPECTED_POSITION, true);
+    bitArray.SetBit(250U, true);
+
+    // [Execution]
+    pointer_uint_q uPosition = bitArray.FindFirstSetBit();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uPosition, EXPECTED_POSITION);
+}
+
+/// <summary>
+/// Checks that the end position is returned when no bit is set.
+/// </summary>
+QTEST_CASE ( FindFirstSetBit_ReturnsEndPositionWhenNoBitIsSet_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_POSITION = QBitArray<>::END_POSITION;
+    QBitArray<> bitArray(300U, false);
+
+    // [Execution]
+    pointer_uint_q uPosition = bitArray.FindFirstSetBit();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uPosition, EXPECTED_POSITION);
+}
+
+/// <summary>
+/// Checks that all the set bits are visited, in ascending order, when iterating with FindNextSetBit.
+/// </summary>
+QTEST_CASE ( FindNextSetBit_AllSetBitsAreVisitedInOrder_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_POSITIONS[] = { 0, 31U, 32U, 63U, 127U, 128U, 299U };
+    const pointer_uint_q EXPECTED_COUNT = sizeof(EXPECTED_POSITIONS) / sizeof(pointer_uint_q);
+    const bool ALL_POSITIONS_ARE_CORRECT = true;
+    QBitArray<> bitArray(300U, false);
+
+    for(pointer_uint_q i = 0; i < EXPECTED_COUNT; ++i)
+        bitArray.SetBit(EXPECTED_POSITIONS[i], true);
+
+    // [Execution]
+    bool bAllPositionsAreCorrect = true;
+    pointer_uint_q uVisitedCount = 0;
+
+    for(pointer_uint_q uPosition = bitArray.FindFirstSetBit(); uPosition != QBitArray<>::END_POSITION; uPosition = bitArray.FindNextSetBit(uPosition + 1U))
+    {
+        bAllPositionsAreCorrect = bAllPositionsAreCorrect && uVisitedCount < EXPECTED_COUNT && uPosition == EXPECTED_POSITIONS[uVisitedCount];
+        ++uVisitedCount;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAllPositionsAreCorrect, ALL_POSITIONS_ARE_CORRECT);
+    BOOST_CHECK_EQUAL(uVisitedCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the end position is returned when the start position is not lower than the number of bits.
+/// </summary>
+QTEST_CASE ( FindNextSetBit_ReturnsEndPositionWhenPositionIsOutOfBounds_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_POSITION = QBitArray<>::END_POSITION;
+    QBitArray<> bitArray(10U, true);
+
+    // [Execution]
+    pointer_uint_q uPosition = bitArray.FindNextSetBit(10U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uPosition, EXPECTED_POSITION);
+}
+
+/// <summary>
+/// Checks that the bits of the other bit array are copied, even when the capacity is exceeded.
+/// </summary>
+QTEST_CASE ( OperatorAssignment_BitsAreCopied_Test )
+{
+    // [Preparation]
+    QBitArray<> originalBitArray(400U, false);
+    originalBitArray.SetBit(399U, true);
+    QBitArray<> bitArray(10U, true);
+
+    // [Execution]
+    bitArray = originalBitArray;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bitArray.GetCount(), originalBitArray.GetCount());
+    BOOST_CHECK_EQUAL(bitArray.CountSetBits(), 1U);
+    BOOST_CHECK(bitArray.GetBit(399U));
+}
+
+// End - Test Suite: QBitArray
+QTEST_SUITE_END()
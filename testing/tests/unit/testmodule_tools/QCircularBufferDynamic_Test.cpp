@@ -0,0 +1,331 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QCircularBufferDynamic.h"
+#include "SQPowerOfTwoGrowthPolicy.h"
+#include "SQFixedChunkGrowthPolicy.h"
+#include "QAssertException.h"
+#include "CallCounter.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QCircularBufferDynamic;
+using Kinesis::QuimeraEngine::Tools::Containers::QCircularBufferFixed;
+using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+/// <summary>
+/// Fills a buffer whose capacity is 5 so its sequence wraps around the end of the internal buffer. The result is {2, 3, 4, 5, 6}, 
+/// where the first 3 elements are at the end of the internal buffer.
+/// </summary>
+/// <typeparam name="BufferT">The type of the buffer.</typeparam>
+/// <param name="buffer">[OUT] An empty buffer whose capacity is 5.</param>
+template<class BufferT>
+static void QCircularBufferDynamic_Test_FillWrappedBuffer(BufferT &buffer)
+{
+    for(u32_q i = 0; i < 5U; ++i)
+        buffer.PushBack(i);
+
+    buffer.PopFront();
+    buffer.PopFront();
+    buffer.PushBack(5U);
+    buffer.PushBack(6U);
+}
+
+
+QTEST_SUITE_BEGIN( QCircularBufferDynamic_TestSuite )
+
+/// <summary>
+/// Checks that the buffer is empty and its capacity is the default one after being created.
+/// </summary>
+QTEST_CASE ( Constructor1_BufferIsEmptyAndHasDefaultCapacity_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 1U;
+    const bool IS_EMPTY = true;
+
+    // [Execution]
+    QCircularBufferDynamic<u32_q> buffer;
+
+    // [Verification]
+    pointer_uint_q uCapacity = buffer.GetCapacity();
+    bool bIsEmpty = buffer.IsEmpty();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(bIsEmpty, IS_EMPTY);
+}
+
+/// <summary>
+/// Checks that the capacity is the expected one.
+/// </summary>
+QTEST_CASE ( Constructor2_CapacityIsCorrect_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 20U;
+
+    // [Execution]
+    QCircularBufferDynamic<u32_q> buffer(EXPECTED_CAPACITY);
+
+    // [Verification]
+    pointer_uint_q uCapacity = buffer.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the initial capacity is zero.
+/// </summary>
+QTEST_CASE ( Constructor2_AssertionFailsWhenCapacityIsZero_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INPUT_CAPACITY = 0;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QCircularBufferDynamic<u32_q> buffer(INPUT_CAPACITY);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the elements of a fixed buffer are copied in the same order.
+/// </summary>
+QTEST_CASE ( Constructor3_ElementsAreCopied_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 2U, 3U, 4U, 5U, 6U };
+    QCircularBufferFixed<u32_q> originalBuffer(5U);
+    QCircularBufferDynamic_Test_FillWrappedBuffer(originalBuffer);
+
+    // [Execution]
+    QCircularBufferDynamic<u32_q> buffer(originalBuffer);
+
+    // [Verification]
+    BOOST_REQUIRE_EQUAL(buffer.GetCount(), 5U);
+
+    for(pointer_uint_q i = 0; i < buffer.GetCount(); ++i)
+        BOOST_CHECK_EQUAL(buffer[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that all the elements are copied and the capacity is increased when it is not enough.
+/// </summary>
+QTEST_CASE ( OperatorAssignment_AllElementsAreCopiedWhenCapacityIsNotEnough_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 2U, 3U, 4U, 5U, 6U };
+    QCircularBufferDynamic<u32_q> originalBuffer(5U);
+    QCircularBufferDynamic_Test_FillWrappedBuffer(originalBuffer);
+    QCircularBufferDynamic<u32_q> buffer(2U);
+    buffer.PushBack(10U);
+    buffer.PushFront(11U);
+
+    // [Execution]
+    buffer = originalBuffer;
+
+    // [Verification]
+    BOOST_REQUIRE_EQUAL(buffer.GetCount(), 5U);
+
+    for(pointer_uint_q i = 0; i < buffer.GetCount(); ++i)
+        BOOST_CHECK_EQUAL(buffer[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that the capacity is increased and no element is lost when the buffer is full.
+/// </summary>
+QTEST_CASE ( PushBack_CapacityIsIncreasedWhenBufferIsFull_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 2U, 3U, 4U, 5U, 6U, 7U };
+    QCircularBufferDynamic<u32_q> buffer(5U);
+    QCircularBufferDynamic_Test_FillWrappedBuffer(buffer);
+
+    // [Execution]
+    buffer.PushBack(7U);
+
+    // [Verification]
+    BOOST_CHECK(buffer.GetCapacity() > 5U);
+    BOOST_REQUIRE_EQUAL(buffer.GetCount(), 6U);
+
+    for(pointer_uint_q i = 0; i < buffer.GetCount(); ++i)
+        BOOST_CHECK_EQUAL(buffer[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that the capacity is increased and no element is lost when the buffer is full.
+/// </summary>
+QTEST_CASE ( PushFront_CapacityIsIncreasedWhenBufferIsFull_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 1U, 2U, 3U, 4U, 5U, 6U };
+    QCircularBufferDynamic<u32_q> buffer(5U);
+    QCircularBufferDynamic_Test_FillWrappedBuffer(buffer);
+
+    // [Execution]
+    buffer.PushFront(1U);
+
+    // [Verification]
+    BOOST_CHECK(buffer.GetCapacity() > 5U);
+    BOOST_REQUIRE_EQUAL(buffer.GetCount(), 6U);
+
+    for(pointer_uint_q i = 0; i < buffer.GetCount(); ++i)
+        BOOST_CHECK_EQUAL(buffer[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that the capacity grows as the growth policy indicates when it is exceeded.
+/// </summary>
+QTEST_CASE ( PushBack_CapacityGrowsAccordingToGrowthPolicy_Test )
+{
+    using Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator;
+    using Kinesis::QuimeraEngine::Tools::Containers::SQPowerOfTwoGrowthPolicy;
+    using Kinesis::QuimeraEngine::Tools::Containers::SQFixedChunkGrowthPolicy;
+
+    // [Preparation]
+    const pointer_uint_q EXPECTED_POWER_OF_TWO_CAPACITY = 8U;
+    const pointer_uint_q EXPECTED_FIXED_CHUNK_CAPACITY = 10U;
+    QCircularBufferDynamic<u32_q, QPoolAllocator, SQPowerOfTwoGrowthPolicy> powerOfTwoBuffer(1U);
+    QCircularBufferDynamic<u32_q, QPoolAllocator, SQFixedChunkGrowthPolicy<5U> > fixedChunkBuffer(1U);
+
+    // [Execution]
+    for(u32_q i = 0; i < 6U; ++i)
+    {
+        powerOfTwoBuffer.PushBack(i);
+        fixedChunkBuffer.PushBack(i);
+    }
+
+    // [Verification]
+    pointer_uint_q uPowerOfTwoCapacity = powerOfTwoBuffer.GetCapacity();
+    pointer_uint_q uFixedChunkCapacity = fixedChunkBuffer.GetCapacity();
+    BOOST_CHECK_EQUAL(uPowerOfTwoCapacity, EXPECTED_POWER_OF_TWO_CAPACITY);
+    BOOST_CHECK_EQUAL(uFixedChunkCapacity, EXPECTED_FIXED_CHUNK_CAPACITY);
+}
+
+/// <summary>
+/// Checks that elements keep their order when adding many of them at both ends, starting from the default capacity.
+/// </summary>
+QTEST_CASE ( PushFront_ElementsKeepTheirOrderWhenAddingAtBothEnds_Test )
+{
+    // [Preparation]
+    const u32_q HALF_COUNT = 100U;
+    QCircularBufferDynamic<u32_q> buffer;
+
+    // [Execution]
+    for(u32_q i = 0; i < HALF_COUNT; ++i)
+    {
+        buffer.PushBack(HALF_COUNT + i);
+        buffer.PushFront(HALF_COUNT - 1U - i);
+    }
+
+    // [Verification]
+    BOOST_REQUIRE_EQUAL(buffer.GetCount(), HALF_COUNT * 2U);
+
+    bool bOrderIsCorrect = true;
+
+    for(pointer_uint_q i = 0; i < buffer.GetCount(); ++i)
+        bOrderIsCorrect = bOrderIsCorrect && buffer[i] == i;
+
+    BOOST_CHECK(bOrderIsCorrect);
+}
+
+/// <summary>
+/// Checks that elements keep their order after increasing the capacity when the sequence wraps around the end of the internal buffer.
+/// </summary>
+QTEST_CASE ( Reserve_ElementsKeepTheirOrderWhenSequenceWraps_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 2U, 3U, 4U, 5U, 6U };
+    const pointer_uint_q EXPECTED_CAPACITY = 12U;
+    QCircularBufferDynamic<u32_q> buffer(5U);
+    QCircularBufferDynamic_Test_FillWrappedBuffer(buffer);
+
+    // [Execution]
+    buffer.Reserve(EXPECTED_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(buffer.GetCapacity(), EXPECTED_CAPACITY);
+    BOOST_REQUIRE_EQUAL(buffer.GetCount(), 5U);
+
+    for(pointer_uint_q i = 0; i < buffer.GetCount(); ++i)
+        BOOST_CHECK_EQUAL(buffer[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that the capacity does not change when the requested number of elements is not greater than the current capacity.
+/// </summary>
+QTEST_CASE ( Reserve_CapacityDoesNotChangeWhenItIsNotGreater_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 8U;
+    QCircularBufferDynamic<u32_q> buffer(EXPECTED_CAPACITY);
+
+    // [Execution]
+    buffer.Reserve(4U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(buffer.GetCapacity(), EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that no element is copied, constructed nor destroyed when the capacity is increased.
+/// </summary>
+QTEST_CASE ( Reserve_ElementsAreNotCopiedNorDestroyed_Test )
+{
+    // [Preparation]
+    const unsigned int EXPECTED_CALLS = 0;
+    QCircularBufferDynamic<CallCounter> buffer(2U);
+    buffer.PushBack(CallCounter());
+    buffer.PushFront(CallCounter());
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    buffer.Reserve(10U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(CallCounter::GetCopyConstructorCallsCount(), EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetDestructorCallsCount(), EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetAssignmentCallsCount(), EXPECTED_CALLS);
+}
+
+// End - Test Suite: QCircularBufferDynamic
+QTEST_SUITE_END()
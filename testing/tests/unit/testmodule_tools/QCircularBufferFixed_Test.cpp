@@ -0,0 +1,609 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QCircularBufferFixed.h"
+#include "QAssertException.h"
+#include "CallCounter.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QCircularBufferFixed;
+using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+/// <summary>
+/// Fills a buffer whose capacity is 5 so its sequence wraps around the end of the internal buffer. The result is {2, 3, 4, 5, 6}, 
+/// where the first 3 elements are at the end of the internal buffer.
+/// </summary>
+/// <param name="buffer">[OUT] An empty buffer whose capacity is 5.</param>
+static void QCircularBufferFixed_Test_FillWrappedBuffer(QCircularBufferFixed<u32_q> &buffer)
+{
+    for(u32_q i = 0; i < 7U; ++i)
+        buffer.PushBack(i);
+}
+
+
+QTEST_SUITE_BEGIN( QCircularBufferFixed_TestSuite )
+
+/// <summary>
+/// Checks that the buffer is empty and its capacity is the expected one after being created.
+/// </summary>
+QTEST_CASE ( Constructor1_BufferIsEmptyAndCapacityIsCorrect_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 8U;
+    const bool IS_EMPTY = true;
+
+    // [Execution]
+    QCircularBufferFixed<u32_q> buffer(EXPECTED_CAPACITY);
+
+    // [Verification]
+    pointer_uint_q uCapacity = buffer.GetCapacity();
+    bool bIsEmpty = buffer.IsEmpty();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(bIsEmpty, IS_EMPTY);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the capacity is zero.
+/// </summary>
+QTEST_CASE ( Constructor1_AssertionFailsWhenCapacityIsZero_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INPUT_CAPACITY = 0;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QCircularBufferFixed<u32_q> buffer(INPUT_CAPACITY);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the elements are copied in the same order and the capacity is the same, even if the sequence of the input buffer wraps.
+/// </summary>
+QTEST_CASE ( Constructor2_ElementsAndCapacityAreCopied_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 2U, 3U, 4U, 5U, 6U };
+    const pointer_uint_q EXPECTED_CAPACITY = 5U;
+    QCircularBufferFixed<u32_q> originalBuffer(EXPECTED_CAPACITY);
+    QCircularBufferFixed_Test_FillWrappedBuffer(originalBuffer);
+
+    // [Execution]
+    QCircularBufferFixed<u32_q> buffer(originalBuffer);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(buffer.GetCapacity(), EXPECTED_CAPACITY);
+    BOOST_REQUIRE_EQUAL(buffer.GetCount(), 5U);
+
+    for(pointer_uint_q i = 0; i < buffer.GetCount(); ++i)
+        BOOST_CHECK_EQUAL(buffer[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that the copy constructor of every element is called.
+/// </summary>
+QTEST_CASE ( Constructor2_CopyConstructorIsCalledForEveryElement_Test )
+{
+    // [Preparation]
+    const unsigned int EXPECTED_COPY_CONSTRUCTOR_CALLS = 3U;
+    QCircularBufferFixed<CallCounter> originalBuffer(4U);
+    originalBuffer.PushBack(CallCounter());
+    originalBuffer.PushBack(CallCounter());
+    originalBuffer.PushBack(CallCounter());
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    QCircularBufferFixed<CallCounter> buffer(originalBuffer);
+
+    // [Verification]
+    unsigned int uCopyConstructorCalls = CallCounter::GetCopyConstructorCallsCount();
+    BOOST_CHECK_EQUAL(uCopyConstructorCalls, EXPECTED_COPY_CONSTRUCTOR_CALLS);
+}
+
+/// <summary>
+/// Checks that the destructor of every element is called, and only once.
+/// </summary>
+QTEST_CASE ( Destructor_DestructorIsCalledForEveryElement_Test )
+{
+    // [Preparation]
+    const unsigned int EXPECTED_DESTRUCTOR_CALLS = 3U;
+
+    {
+        QCircularBufferFixed<CallCounter> buffer(4U);
+        buffer.PushBack(CallCounter());
+        buffer.PushBack(CallCounter());
+        buffer.PushFront(CallCounter());
+        CallCounter::ResetCounters();
+
+    // [Execution]
+    } // Destructor called
+
+    // [Verification]
+    unsigned int uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_DESTRUCTOR_CALLS);
+}
+
+/// <summary>
+/// Checks that the elements are copied in the same order and the capacity does not change.
+/// </summary>
+QTEST_CASE ( OperatorAssignment_ElementsAreCopiedAndCapacityDoesNotChange_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 2U, 3U, 4U, 5U, 6U };
+    const pointer_uint_q EXPECTED_CAPACITY = 10U;
+    QCircularBufferFixed<u32_q> originalBuffer(5U);
+    QCircularBufferFixed_Test_FillWrappedBuffer(originalBuffer);
+    QCircularBufferFixed<u32_q> buffer(EXPECTED_CAPACITY);
+    buffer.PushBack(10U);
+
+    // [Execution]
+    buffer = originalBuffer;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(buffer.GetCapacity(), EXPECTED_CAPACITY);
+    BOOST_REQUIRE_EQUAL(buffer.GetCount(), 5U);
+
+    for(pointer_uint_q i = 0; i < buffer.GetCount(); ++i)
+        BOOST_CHECK_EQUAL(buffer[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that only the elements at the back of the input buffer are copied when the capacity of the resident buffer is not enough.
+/// </summary>
+QTEST_CASE ( OperatorAssignment_OnlyElementsAtTheBackAreCopiedWhenCapacityIsNotEnough_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 4U, 5U, 6U };
+    QCircularBufferFixed<u32_q> originalBuffer(5U);
+    QCircularBufferFixed_Test_FillWrappedBuffer(originalBuffer);
+    QCircularBufferFixed<u32_q> buffer(3U);
+
+    // [Execution]
+    buffer = originalBuffer;
+
+    // [Verification]
+    BOOST_REQUIRE_EQUAL(buffer.GetCount(), 3U);
+
+    for(pointer_uint_q i = 0; i < buffer.GetCount(); ++i)
+        BOOST_CHECK_EQUAL(buffer[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that the element is added at the back.
+/// </summary>
+QTEST_CASE ( PushBack_ElementIsAddedAtTheBack_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_BACK = 7U;
+    const pointer_uint_q EXPECTED_COUNT = 2U;
+    QCircularBufferFixed<u32_q> buffer(4U);
+    buffer.PushBack(1U);
+
+    // [Execution]
+    buffer.PushBack(EXPECTED_BACK);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(buffer.GetBack(), EXPECTED_BACK);
+    BOOST_CHECK_EQUAL(buffer.GetCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the element at the front is replaced when the buffer is full.
+/// </summary>
+QTEST_CASE ( PushBack_FrontIsReplacedWhenBufferIsFull_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 1U, 2U, 3U };
+    QCircularBufferFixed<u32_q> buffer(3U);
+    buffer.PushBack(0U);
+    buffer.PushBack(1U);
+    buffer.PushBack(2U);
+
+    // [Execution]
+    buffer.PushBack(3U);
+
+    // [Verification]
+    BOOST_CHECK(buffer.IsFull());
+    BOOST_REQUIRE_EQUAL(buffer.GetCount(), 3U);
+
+    for(pointer_uint_q i = 0; i < buffer.GetCount(); ++i)
+        BOOST_CHECK_EQUAL(buffer[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that the element is added at the front.
+/// </summary>
+QTEST_CASE ( PushFront_ElementIsAddedAtTheFront_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 2U, 1U, 0U };
+    QCircularBufferFixed<u32_q> buffer(4U);
+    buffer.PushBack(0U);
+    buffer.PushFront(1U);
+
+    // [Execution]
+    buffer.PushFront(2U);
+
+    // [Verification]
+    BOOST_REQUIRE_EQUAL(buffer.GetCount(), 3U);
+
+    for(pointer_uint_q i = 0; i < buffer.GetCount(); ++i)
+        BOOST_CHECK_EQUAL(buffer[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that the element at the back is replaced when the buffer is full.
+/// </summary>
+QTEST_CASE ( PushFront_BackIsReplacedWhenBufferIsFull_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 3U, 0U, 1U };
+    QCircularBufferFixed<u32_q> buffer(3U);
+    buffer.PushBack(0U);
+    buffer.PushBack(1U);
+    buffer.PushBack(2U);
+
+    // [Execution]
+    buffer.PushFront(3U);
+
+    // [Verification]
+    BOOST_REQUIRE_EQUAL(buffer.GetCount(), 3U);
+
+    for(pointer_uint_q i = 0; i < buffer.GetCount(); ++i)
+        BOOST_CHECK_EQUAL(buffer[i], EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that elements are not constructed but assigned when the buffer is full.
+/// </summary>
+QTEST_CASE ( PushBack_ElementIsAssignedWhenBufferIsFull_Test )
+{
+    // [Preparation]
+    const unsigned int EXPECTED_ASSIGNMENT_CALLS = 1U;
+    const unsigned int EXPECTED_COPY_CONSTRUCTOR_CALLS = 0;
+    QCircularBufferFixed<CallCounter> buffer(1U);
+    CallCounter element;
+    buffer.PushBack(element);
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    buffer.PushBack(element);
+
+    // [Verification]
+    unsigned int uAssignmentCalls = CallCounter::GetAssignmentCallsCount();
+    unsigned int uCopyConstructorCalls = CallCounter::GetCopyConstructorCallsCount();
+    BOOST_CHECK_EQUAL(uAssignmentCalls, EXPECTED_ASSIGNMENT_CALLS);
+    BOOST_CHECK_EQUAL(uCopyConstructorCalls, EXPECTED_COPY_CONSTRUCTOR_CALLS);
+}
+
+/// <summary>
+/// Checks that the element at the back is removed and destroyed.
+/// </summary>
+QTEST_CASE ( PopBack_ElementAtTheBackIsRemoved_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_BACK = 5U;
+    const unsigned int EXPECTED_DESTRUCTOR_CALLS = 1U;
+    QCircularBufferFixed<u32_q> buffer(5U);
+    QCircularBufferFixed_Test_FillWrappedBuffer(buffer);
+    QCircularBufferFixed<CallCounter> counterBuffer(2U);
+    counterBuffer.PushBack(CallCounter());
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    buffer.PopBack();
+    counterBuffer.PopBack();
+
+    // [Verification]
+    unsigned int uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    BOOST_CHECK_EQUAL(buffer.GetBack(), EXPECTED_BACK);
+    BOOST_CHECK_EQUAL(buffer.GetCount(), 4U);
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_DESTRUCTOR_CALLS);
+}
+
+/// <summary>
+/// Checks that the element at the front is removed and destroyed, even when it is at the end of the internal buffer.
+/// </summary>
+QTEST_CASE ( PopFront_ElementAtTheFrontIsRemoved_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 5U, 6U };
+    const unsigned int EXPECTED_DESTRUCTOR_CALLS = 1U;
+    QCircularBufferFixed<u32_q> buffer(5U);
+    QCircularBufferFixed_Test_FillWrappedBuffer(buffer);
+    QCircularBufferFixed<CallCounter> counterBuffer(2U);
+    counterBuffer.PushBack(CallCounter());
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    buffer.PopFront();
+    buffer.PopFront();
+    buffer.PopFront();
+    counterBuffer.PopFront();
+
+    // [Verification]
+    unsigned int uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_DESTRUCTOR_CALLS);
+    BOOST_REQUIRE_EQUAL(buffer.GetCount(), 2U);
+
+    for(pointer_uint_q i = 0; i < buffer.GetCount(); ++i)
+        BOOST_CHECK_EQUAL(buffer[i], EXPECTED_ELEMENTS[i]);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the buffer is empty.
+/// </summary>
+QTEST_CASE ( PopBack_AssertionFailsWhenBufferIsEmpty_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QCircularBufferFixed<u32_q> buffer(2U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        buffer.PopBack();
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the buffer is empty.
+/// </summary>
+QTEST_CASE ( PopFront_AssertionFailsWhenBufferIsEmpty_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QCircularBufferFixed<u32_q> buffer(2U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        buffer.PopFront();
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the index is not lower than the number of elements.
+/// </summary>
+QTEST_CASE ( GetValue_AssertionFailsWhenIndexIsOutOfBounds_Test )
+{
+    // [Preparation]
+    const pointer_uint_q OUT_OF_BOUNDS_INDEX = 1U;
+    const bool ASSERTION_FAILED = true;
+    QCircularBufferFixed<u32_q> buffer(2U);
+    buffer.PushBack(0U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        buffer.GetValue(OUT_OF_BOUNDS_INDEX);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the buffer is empty.
+/// </summary>
+QTEST_CASE ( GetFront_AssertionFailsWhenBufferIsEmpty_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QCircularBufferFixed<u32_q> buffer(2U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        buffer.GetFront();
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that all the elements are removed and destroyed, and the capacity does not change.
+/// </summary>
+QTEST_CASE ( Clear_AllElementsAreRemovedAndDestroyed_Test )
+{
+    // [Preparation]
+    const unsigned int EXPECTED_DESTRUCTOR_CALLS = 3U;
+    const pointer_uint_q EXPECTED_CAPACITY = 3U;
+    QCircularBufferFixed<CallCounter> buffer(EXPECTED_CAPACITY);
+    buffer.PushBack(CallCounter());
+    buffer.PushBack(CallCounter());
+    buffer.PushFront(CallCounter());
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    buffer.Clear();
+
+    // [Verification]
+    unsigned int uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_DESTRUCTOR_CALLS);
+    BOOST_CHECK(buffer.IsEmpty());
+    BOOST_CHECK_EQUAL(buffer.GetCapacity(), EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that only the first range is used when the sequence does not wrap around the end of the internal buffer.
+/// </summary>
+QTEST_CASE ( GetContiguousRanges_OnlyFirstRangeIsUsedWhenSequenceDoesNotWrap_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 1U, 2U, 3U };
+    const pointer_uint_q EXPECTED_FIRST_COUNT = 3U;
+    const pointer_uint_q EXPECTED_SECOND_COUNT = 0;
+    QCircularBufferFixed<u32_q> buffer(5U);
+    buffer.PushBack(0U);
+    buffer.PushBack(1U);
+    buffer.PushBack(2U);
+    buffer.PushBack(3U);
+    buffer.PopFront();
+
+    // [Execution]
+    const u32_q* pFirstRange = null_q;
+    const u32_q* pSecondRange = null_q;
+    pointer_uint_q uFirstRangeCount = 0;
+    pointer_uint_q uSecondRangeCount = 0;
+    buffer.GetContiguousRanges(pFirstRange, uFirstRangeCount, pSecondRange, uSecondRangeCount);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uSecondRangeCount, EXPECTED_SECOND_COUNT);
+    BOOST_CHECK(pSecondRange == null_q);
+    BOOST_REQUIRE_EQUAL(uFirstRangeCount, EXPECTED_FIRST_COUNT);
+    BOOST_CHECK(memcmp(pFirstRange, EXPECTED_ELEMENTS, sizeof(EXPECTED_ELEMENTS)) == 0);
+}
+
+/// <summary>
+/// Checks that both ranges together contain all the elements in order when the sequence wraps around the end of the internal buffer.
+/// </summary>
+QTEST_CASE ( GetContiguousRanges_BothRangesContainAllElementsInOrderWhenSequenceWraps_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 2U, 3U, 4U, 5U, 6U };
+    const pointer_uint_q EXPECTED_FIRST_COUNT = 3U;
+    const pointer_uint_q EXPECTED_SECOND_COUNT = 2U;
+    QCircularBufferFixed<u32_q> buffer(5U);
+    QCircularBufferFixed_Test_FillWrappedBuffer(buffer);
+
+    // [Execution]
+    const u32_q* pFirstRange = null_q;
+    const u32_q* pSecondRange = null_q;
+    pointer_uint_q uFirstRangeCount = 0;
+    pointer_uint_q uSecondRangeCount = 0;
+    buffer.GetContiguousRanges(pFirstRange, uFirstRangeCount, pSecondRange, uSecondRangeCount);
+
+    // [Verification]
+    BOOST_REQUIRE_EQUAL(uFirstRangeCount, EXPECTED_FIRST_COUNT);
+    BOOST_REQUIRE_EQUAL(uSecondRangeCount, EXPECTED_SECOND_COUNT);
+
+    u32_q arCopiedElements[5];
+    memcpy(arCopiedElements, pFirstRange, uFirstRangeCount * sizeof(u32_q));
+    memcpy(arCopiedElements + uFirstRangeCount, pSecondRange, uSecondRangeCount * sizeof(u32_q));
+    BOOST_CHECK(memcmp(arCopiedElements, EXPECTED_ELEMENTS, sizeof(EXPECTED_ELEMENTS)) == 0);
+}
+
+/// <summary>
+/// Checks that both ranges are null when the buffer is empty.
+/// </summary>
+QTEST_CASE ( GetContiguousRanges_BothRangesAreNullWhenBufferIsEmpty_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_COUNT = 0;
+    QCircularBufferFixed<u32_q> buffer(5U);
+
+    // [Execution]
+    const u32_q* pFirstRange = null_q;
+    const u32_q* pSecondRange = null_q;
+    pointer_uint_q uFirstRangeCount = 1U;
+    pointer_uint_q uSecondRangeCount = 1U;
+    buffer.GetContiguousRanges(pFirstRange, uFirstRangeCount, pSecondRange, uSecondRangeCount);
+
+    // [Verification]
+    BOOST_CHECK(pFirstRange == null_q);
+    BOOST_CHECK(pSecondRange == null_q);
+    BOOST_CHECK_EQUAL(uFirstRangeCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(uSecondRangeCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the buffer is full only when the number of elements equals the capacity.
+/// </summary>
+QTEST_CASE ( IsFull_ReturnsTrueOnlyWhenCountEqualsCapacity_Test )
+{
+    // [Preparation]
+    QCircularBufferFixed<u32_q> buffer(2U);
+    buffer.PushBack(0U);
+
+    // [Execution]
+    bool bIsFullBefore = buffer.IsFull();
+    buffer.PushFront(1U);
+    bool bIsFullAfter = buffer.IsFull();
+
+    // [Verification]
+    BOOST_CHECK(!bIsFullBefore);
+    BOOST_CHECK(bIsFullAfter);
+}
+
+// End - Test Suite: QCircularBufferFixed
+QTEST_SUITE_END()
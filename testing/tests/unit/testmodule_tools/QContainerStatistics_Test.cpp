@@ -0,0 +1,148 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QContainerStatistics.h"
+
+#include "SQFloat.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QContainerStatistics;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+
+
+QTEST_SUITE_BEGIN( QContainerStatistics_TestSuite )
+
+/// <summary>
+/// Checks that all the properties are zero by default.
+/// </summary>
+QTEST_CASE ( Constructor_AllPropertiesAreZero_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_VALUE = 0;
+    const float_q EXPECTED_FLOAT_VALUE = SQFloat::_0;
+
+    // [Execution]
+    QContainerStatistics statistics;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(statistics.GetCount(), EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(statistics.GetCapacity(), EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(statistics.GetReservedBytes(), EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(statistics.GetUsedBytes(), EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(statistics.GetLoadFactor(), EXPECTED_FLOAT_VALUE);
+    BOOST_CHECK_EQUAL(statistics.GetMaximumChainLength(), EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(statistics.GetHeight(), EXPECTED_VALUE);
+    BOOST_CHECK_EQUAL(statistics.GetAverageDepth(), EXPECTED_FLOAT_VALUE);
+}
+
+/// <summary>
+/// Checks that the number of elements, the capacity and the bytes of the input statistics are added.
+/// </summary>
+QTEST_CASE ( AddMemoryUsage_CountCapacityAndBytesAreAdded_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_COUNT = 5U;
+    const pointer_uint_q EXPECTED_CAPACITY = 12U;
+    const pointer_uint_q EXPECTED_RESERVED_BYTES = 48U;
+    const pointer_uint_q EXPECTED_USED_BYTES = 20U;
+    QContainerStatistics statistics;
+    statistics.SetCount(2U);
+    statistics.SetCapacity(4U);
+    statistics.SetReservedBytes(16U);
+    statistics.SetUsedBytes(8U);
+    QContainerStatistics otherStatistics;
+    otherStatistics.SetCount(3U);
+    otherStatistics.SetCapacity(8U);
+    otherStatistics.SetReservedBytes(32U);
+    otherStatistics.SetUsedBytes(12U);
+
+    // [Execution]
+    statistics.AddMemoryUsage(otherStatistics);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(statistics.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetCapacity(), EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(statistics.GetReservedBytes(), EXPECTED_RESERVED_BYTES);
+    BOOST_CHECK_EQUAL(statistics.GetUsedBytes(), EXPECTED_USED_BYTES);
+}
+
+/// <summary>
+/// Checks that the shape properties are not modified when adding the memory usage of other statistics.
+/// </summary>
+QTEST_CASE ( AddMemoryUsage_ShapePropertiesAreNotModified_Test )
+{
+    // [Preparation]
+    const float_q EXPECTED_LOAD_FACTOR = SQFloat::_0_5;
+    const pointer_uint_q EXPECTED_MAXIMUM_CHAIN_LENGTH = 2U;
+    const pointer_uint_q EXPECTED_HEIGHT = 3U;
+    const float_q EXPECTED_AVERAGE_DEPTH = SQFloat::_1;
+    QContainerStatistics statistics;
+    statistics.SetLoadFactor(EXPECTED_LOAD_FACTOR);
+    statistics.SetMaximumChainLength(EXPECTED_MAXIMUM_CHAIN_LENGTH);
+    statistics.SetHeight(EXPECTED_HEIGHT);
+    statistics.SetAverageDepth(EXPECTED_AVERAGE_DEPTH);
+    QContainerStatistics otherStatistics;
+    otherStatistics.SetLoadFactor(SQFloat::_2);
+    otherStatistics.SetMaximumChainLength(7U);
+    otherStatistics.SetHeight(9U);
+    otherStatistics.SetAverageDepth(SQFloat::_4);
+
+    // [Execution]
+    statistics.AddMemoryUsage(otherStatistics);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(statistics.GetLoadFactor(), EXPECTED_LOAD_FACTOR);
+    BOOST_CHECK_EQUAL(statistics.GetMaximumChainLength(), EXPECTED_MAXIMUM_CHAIN_LENGTH);
+    BOOST_CHECK_EQUAL(statistics.GetHeight(), EXPECTED_HEIGHT);
+    BOOST_CHECK_EQUAL(statistics.GetAverageDepth(), EXPECTED_AVERAGE_DEPTH);
+}
+
+/// <summary>
+/// Checks that the unused bytes are the difference between the reserved bytes and the used bytes.
+/// </summary>
+QTEST_CASE ( GetUnusedBytes_ReturnsDifferenceBetweenReservedAndUsedBytes_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_UNUSED_BYTES = 24U;
+    QContainerStatistics statistics;
+    statistics.SetReservedBytes(32U);
+    statistics.SetUsedBytes(8U);
+
+    // [Execution]
+    pointer_uint_q uUnusedBytes = statistics.GetUnusedBytes();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uUnusedBytes, EXPECTED_UNUSED_BYTES);
+}
+
+// End - Test Suite: QContainerStatistics
+QTEST_SUITE_END()
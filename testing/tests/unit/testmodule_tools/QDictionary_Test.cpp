@@ -39,6 +39,8 @@ using namespace boost::unit_test;
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
 using Kinesis::QuimeraEngine::Tools::Containers::QDictionary;
 using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
+using Kinesis::QuimeraEngine::Tools::Containers::QContainerStatistics;
 
 
 QTEST_SUITE_BEGIN( QDictionary_TestSuite )
@@ -1830,5 +1832,61 @@ QTEST_CASE ( GetCapacity_IsCorrectlyCalculated_Test )
     BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
 }
 
+/// <summary>
+/// Checks that the statistics describe the shape of the internal tree.
+/// </summary>
+QTEST_CASE ( GetStatistics_ShapeOfInternalTreeIsReturned_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_COUNT = 7U;
+    const pointer_uint_q EXPECTED_HEIGHT = 3U;
+    const float_q EXPECTED_AVERAGE_DEPTH = scast_q(10, float_q) / scast_q(EXPECTED_COUNT, float_q);
+    QDictionary<int, int> DICTIONARY(EXPECTED_COUNT);
+    DICTIONARY.Add(4, 4);
+    DICTIONARY.Add(2, 2);
+    DICTIONARY.Add(6, 6);
+    DICTIONARY.Add(1, 1);
+    DICTIONARY.Add(3, 3);
+    DICTIONARY.Add(5, 5);
+    DICTIONARY.Add(7, 7);
+
+    // [Execution]
+    QContainerStatistics statistics = DICTIONARY.GetStatistics();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(statistics.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetCapacity(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetHeight(), EXPECTED_HEIGHT);
+    BOOST_CHECK_EQUAL(statistics.GetAverageDepth(), EXPECTED_AVERAGE_DEPTH);
+}
+
+
+/// <summary>
+/// Checks that the capacity is reduced to the number of elements and all the keys can still be found.
+/// </summary>
+QTEST_CASE ( ShrinkToFit_CapacityIsReducedAndAllKeysAreFound_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 3U;
+    QDictionary<int, int> DICTIONARY(10U);
+    DICTIONARY.Add(3, 30);
+    DICTIONARY.Add(1, 10);
+    DICTIONARY.Add(4, 40);
+    DICTIONARY.Add(2, 20);
+    DICTIONARY.Remove(3);
+
+    // [Execution]
+    DICTIONARY.ShrinkToFit();
+
+    // [Verification]
+    pointer_uint_q uCapacity = DICTIONARY.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+    BOOST_CHECK_EQUAL(DICTIONARY.GetValue(1), 10);
+    BOOST_CHECK_EQUAL(DICTIONARY.GetValue(2), 20);
+    BOOST_CHECK_EQUAL(DICTIONARY.GetValue(4), 40);
+    BOOST_CHECK(!DICTIONARY.ContainsKey(3));
+}
+
+
 // End - Test Suite: QDictionary
 QTEST_SUITE_END()
@@ -0,0 +1,859 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QFlatHashtable.h"
+
+#include "QAssertException.h"
+#include "CallCounter.h"
+#include "SQStringHashProvider.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QFlatHashtable;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Tools::Containers::SQStringHashProvider;
+
+
+QTEST_SUITE_BEGIN( QFlatHashtable_TestSuite )
+
+/// <summary>
+/// Checks that the capacity of the container is, at least, the initial capacity.
+/// </summary>
+QTEST_CASE ( Constructor1_CapacityIsNotLowerThanInitialCapacity_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INITIAL_CAPACITY = 50;
+
+    // [Execution]
+    QFlatHashtable<int, int> hashtable(INITIAL_CAPACITY);
+
+    // [Verification]
+    pointer_uint_q uCapacity = hashtable.GetCapacity();
+    BOOST_CHECK(uCapacity >= INITIAL_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the number of slots is a power of two multiple of 16.
+/// </summary>
+QTEST_CASE ( Constructor1_NumberOfSlotsIsPowerOfTwoMultipleOfSixteen_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INITIAL_CAPACITY = 100;
+    const pointer_uint_q EXPECTED_NUMBER_OF_SLOTS = 128;
+
+    // [Execution]
+    QFlatHashtable<int, int> hashtable(INITIAL_CAPACITY);
+
+    // [Verification]
+    pointer_uint_q uNumberOfSlots = hashtable.GetNumberOfSlots();
+    BOOST_CHECK_EQUAL(uNumberOfSlots, EXPECTED_NUMBER_OF_SLOTS);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the initial capacity equals zero.
+/// </summary>
+QTEST_CASE ( Constructor1_AssertionFailsWhenInitialCapacityEqualsZero_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INPUT_ZERO = 0;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QFlatHashtable<string_q, int> hashtable(INPUT_ZERO);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // #if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that every key and value is copied.
+/// </summary>
+QTEST_CASE ( Constructor2_EveryKeyAndValueIsCopied_Test )
+{
+    // [Preparation]
+    const int EXPECTED_KEYS[] = { 0, 1, 2, 3, 4, 5 };
+    const int EXPECTED_VALUES[] = { 10, 11, 12, 13, 14, 15 };
+    QFlatHashtable<int, int> HASHTABLE(2);
+
+    for(unsigned int i = 0; i < sizeof(EXPECTED_KEYS) / sizeof(int); ++i)
+        HASHTABLE.Add(EXPECTED_KEYS[i], EXPECTED_VALUES[i]);
+
+    // [Execution]
+    QFlatHashtable<int, int> hashtableCopy = HASHTABLE;
+
+    // [Verification]
+    bool bResultIsWhatEspected = hashtableCopy.GetCount() == HASHTABLE.GetCount();
+
+    for(unsigned int i = 0; i < sizeof(EXPECTED_KEYS) / sizeof(int); ++i)
+    {
+        bResultIsWhatEspected = bResultIsWhatEspected && hashtableCopy[EXPECTED_KEYS[i]] == EXPECTED_VALUES[i];
+    }
+
+    BOOST_CHECK(bResultIsWhatEspected);
+}
+
+/// <summary>
+/// Checks that an empty hashtable is correctly copied.
+/// </summary>
+QTEST_CASE ( Constructor2_ItIsCorrectlyCopiedWhenItIsEmpty_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> HASHTABLE(10);
+
+    // [Execution]
+    QFlatHashtable<int, int> hashtableCopy = HASHTABLE;
+
+    // [Verification]
+    bool bCopyIsEmpty = hashtableCopy.IsEmpty();
+    BOOST_CHECK(bCopyIsEmpty);
+}
+
+/// <summary>
+/// Checks that the destructor of every key and value is called.
+/// </summary>
+QTEST_CASE ( Destructor_TheDestructorOfEveryKeyAndValueIsCalled_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+    // [Preparation]
+    const unsigned int EXPECTED_CALLS = 6;
+
+    {
+        QFlatHashtable<CallCounter, CallCounter> HASHTABLE(10);
+        HASHTABLE.Add(CallCounter(), CallCounter());
+        HASHTABLE.Add(CallCounter(), CallCounter());
+        HASHTABLE.Add(CallCounter(), CallCounter());
+        CallCounter::ResetCounters();
+
+    // [Execution]
+    // Destructor is called when the execution flow leaves this block
+    }
+
+    // [Verification]
+    unsigned int uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_CALLS);
+}
+
+/// <summary>
+/// Checks that the capacity is correctly increased.
+/// </summary>
+QTEST_CASE ( Reserve_CapacityIsCorrectlyIncreased_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INPUT_CAPACITY = 200U;
+    QFlatHashtable<int, int> hashtable(1);
+
+    // [Execution]
+    hashtable.Reserve(INPUT_CAPACITY);
+
+    // [Verification]
+    pointer_uint_q uStoredCapacity = hashtable.GetCapacity();
+    BOOST_CHECK(uStoredCapacity >= INPUT_CAPACITY);
+}
+
+/// <summary>
+/// Checks that elements are correctly moved when the capacity is increased.
+/// </summary>
+QTEST_CASE ( Reserve_ElementsAreCorrectlyReallocated_Test )
+{
+    // [Preparation]
+    const int EXPECTED_KEYS[] = { 0, 1, 2, 3 };
+    const int EXPECTED_VALUES[] = { 10, 11, 12, 13 };
+    QFlatHashtable<int, int> hashtable(1);
+
+    for(unsigned int i = 0; i < sizeof(EXPECTED_KEYS) / sizeof(int); ++i)
+        hashtable.Add(EXPECTED_KEYS[i], EXPECTED_VALUES[i]);
+
+    // [Execution]
+    hashtable.Reserve(1000U);
+
+    // [Verification]
+    bool bResultIsWhatEspected = hashtable.GetCount() == sizeof(EXPECTED_KEYS) / sizeof(int);
+
+    for(unsigned int i = 0; i < sizeof(EXPECTED_KEYS) / sizeof(int); ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && hashtable[EXPECTED_KEYS[i]] == EXPECTED_VALUES[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+}
+
+/// <summary>
+/// Checks that nothing changes when the input capacity is not greater than the current one.
+/// </summary>
+QTEST_CASE ( Reserve_NothingHappensWhenInputCapacityIsNotGreaterThanCurrentCapacity_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> hashtable(100);
+    const pointer_uint_q EXPECTED_NUMBER_OF_SLOTS = hashtable.GetNumberOfSlots();
+
+    // [Execution]
+    hashtable.Reserve(10U);
+
+    // [Verification]
+    pointer_uint_q uNumberOfSlots = hashtable.GetNumberOfSlots();
+    BOOST_CHECK_EQUAL(uNumberOfSlots, EXPECTED_NUMBER_OF_SLOTS);
+}
+
+/// <summary>
+/// Checks that elements are correctly added.
+/// </summary>
+QTEST_CASE ( Add_ElementsAreCorrectlyAdded_Test )
+{
+    // [Preparation]
+    const string_q EXPECTED_KEYS[] = { "A", "B", "C", "D" };
+    const int EXPECTED_VALUES[] = { 10, 11, 12, 13 };
+    QFlatHashtable<string_q, int, SQStringHashProvider> hashtable(4);
+
+    // [Execution]
+    for(unsigned int i = 0; i < sizeof(EXPECTED_VALUES) / sizeof(int); ++i)
+        hashtable.Add(EXPECTED_KEYS[i], EXPECTED_VALUES[i]);
+
+    // [Verification]
+    bool bResultIsWhatEspected = hashtable.GetCount() == sizeof(EXPECTED_VALUES) / sizeof(int);
+
+    for(unsigned int i = 0; i < sizeof(EXPECTED_VALUES) / sizeof(int); ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && hashtable[EXPECTED_KEYS[i]] == EXPECTED_VALUES[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+}
+
+/// <summary>
+/// Checks that the returned iterator points to the added element.
+/// </summary>
+QTEST_CASE ( Add_ReturnedIteratorPointsToAddedElement_Test )
+{
+    // [Preparation]
+    const int EXPECTED_KEY = 5;
+    const int EXPECTED_VALUE = 50;
+    QFlatHashtable<int, int> hashtable(4);
+    hashtable.Add(1, 10);
+    hashtable.Add(2, 20);
+
+    // [Execution]
+    QFlatHashtable<int, int>::ConstIterator itResult = hashtable.Add(EXPECTED_KEY, EXPECTED_VALUE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(itResult->GetKey(), EXPECTED_KEY);
+    BOOST_CHECK_EQUAL(itResult->GetValue(), EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the hashtable grows when the capacity is exceeded and all the elements are still accessible.
+/// </summary>
+QTEST_CASE ( Add_HashtableGrowsWhenCapacityIsExceeded_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 1000;
+    QFlatHashtable<int, int> hashtable(1);
+    const pointer_uint_q INITIAL_CAPACITY = hashtable.GetCapacity();
+
+    // [Execution]
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        hashtable.Add(i, i * 2);
+
+    // [Verification]
+    bool bResultIsWhatEspected = hashtable.GetCount() == scast_q(NUMBER_OF_ELEMENTS, pointer_uint_q);
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && hashtable[i] == i * 2;
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK(hashtable.GetCapacity() > INITIAL_CAPACITY);
+    BOOST_CHECK(hashtable.GetLoadFactor() <= 0.875f);
+}
+
+/// <summary>
+/// Checks that the slots of removed elements are reused and the hashtable does not grow indefinitely when elements are added and removed repeatedly.
+/// </summary>
+QTEST_CASE ( Add_HashtableDoesNotGrowWhenElementsAreAddedAndRemovedRepeatedly_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> hashtable(32);
+    const pointer_uint_q EXPECTED_NUMBER_OF_SLOTS = hashtable.GetNumberOfSlots();
+
+    // [Execution]
+    for(int i = 0; i < 10000; ++i)
+    {
+        hashtable.Add(i, i);
+
+        if(i >= 16)
+            hashtable.Remove(i - 16);
+    }
+
+    // [Verification]
+    bool bResultIsWhatEspected = hashtable.GetCount() == 16U;
+
+    for(int i = 10000 - 16; i < 10000; ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && hashtable[i] == i;
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(hashtable.GetNumberOfSlots(), EXPECTED_NUMBER_OF_SLOTS);
+}
+
+/// <summary>
+/// Checks that the copy constructor of both the key and the value are called.
+/// </summary>
+QTEST_CASE ( Add_CopyConstructorsAreCalled_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+    // [Preparation]
+    QFlatHashtable<CallCounter, CallCounter> hashtable(10);
+    const CallCounter KEY;
+    const CallCounter VALUE;
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    hashtable.Add(KEY, VALUE);
+
+    // [Verification]
+    unsigned int uCopyConstructorCalls = CallCounter::GetCopyConstructorCallsCount();
+    BOOST_CHECK(uCopyConstructorCalls >= 2U);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the key already exists.
+/// </summary>
+QTEST_CASE ( Add_AssertionFailsWhenKeyAlreadyExists_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> hashtable(4);
+    hashtable.Add(1, 10);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        hashtable.Add(1, 20);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // #if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that the value is correctly replaced.
+/// </summary>
+QTEST_CASE ( SetValue_ValueIsCorrectlySet_Test )
+{
+    // [Preparation]
+    const int INPUT_KEY = 3;
+    const int EXPECTED_VALUE = 100;
+    QFlatHashtable<int, int> hashtable(4);
+    hashtable.Add(1, 10);
+    hashtable.Add(INPUT_KEY, 30);
+
+    // [Execution]
+    hashtable.SetValue(INPUT_KEY, EXPECTED_VALUE);
+
+    // [Verification]
+    int nValue = hashtable.GetValue(INPUT_KEY);
+    BOOST_CHECK_EQUAL(nValue, EXPECTED_VALUE);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the key does not exist.
+/// </summary>
+QTEST_CASE ( GetValue_AssertionFailsWhenKeyDoesNotExist_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> hashtable(4);
+    hashtable.Add(1, 10);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        hashtable.GetValue(2);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // #if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that it returns True when the key exists.
+/// </summary>
+QTEST_CASE ( ContainsKey_ReturnsTrueWhenKeyExists_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = true;
+    QFlatHashtable<string_q, int, SQStringHashProvider> hashtable(4);
+    hashtable.Add("A", 10);
+    hashtable.Add("B", 20);
+
+    // [Execution]
+    bool bResult = hashtable.ContainsKey("B");
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that it returns False when the key does not exist.
+/// </summary>
+QTEST_CASE ( ContainsKey_ReturnsFalseWhenKeyDoesNotExist_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = false;
+    QFlatHashtable<string_q, int, SQStringHashProvider> hashtable(4);
+    hashtable.Add("A", 10);
+    hashtable.Add("B", 20);
+
+    // [Execution]
+    bool bResult = hashtable.ContainsKey("C");
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that it returns False when the hashtable is empty.
+/// </summary>
+QTEST_CASE ( ContainsKey_ReturnsFalseWhenHashtableIsEmpty_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = false;
+    QFlatHashtable<int, int> hashtable(4);
+
+    // [Execution]
+    bool bResult = hashtable.ContainsKey(0);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that the element is correctly removed and the others remain accessible.
+/// </summary>
+QTEST_CASE ( Remove_ElementIsCorrectlyRemoved_Test )
+{
+    // [Preparation]
+    const int INPUT_KEY = 2;
+    QFlatHashtable<int, int> hashtable(4);
+    hashtable.Add(1, 10);
+    hashtable.Add(INPUT_KEY, 20);
+    hashtable.Add(3, 30);
+
+    // [Execution]
+    hashtable.Remove(INPUT_KEY);
+
+    // [Verification]
+    BOOST_CHECK(!hashtable.ContainsKey(INPUT_KEY));
+    BOOST_CHECK_EQUAL(hashtable.GetCount(), 2U);
+    BOOST_CHECK_EQUAL(hashtable[1], 10);
+    BOOST_CHECK_EQUAL(hashtable[3], 30);
+}
+
+/// <summary>
+/// Checks that elements that were added after colliding with a removed element are still accessible.
+/// </summary>
+QTEST_CASE ( Remove_CollidingElementsRemainAccessibleWhenGroupsAreFull_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 100;
+    QFlatHashtable<int, int> hashtable(NUMBER_OF_ELEMENTS);
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        hashtable.Add(i, i);
+
+    // [Execution]
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; i += 2)
+        hashtable.Remove(i);
+
+    // [Verification]
+    bool bResultIsWhatEspected = hashtable.GetCount() == scast_q(NUMBER_OF_ELEMENTS / 2, pointer_uint_q);
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && hashtable.ContainsKey(i) == (i % 2 != 0);
+
+    BOOST_CHECK(bResultIsWhatEspected);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the key does not exist.
+/// </summary>
+QTEST_CASE ( Remove_AssertionFailsWhenKeyDoesNotExist_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> hashtable(4);
+    hashtable.Add(1, 10);
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        hashtable.Remove(2);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif // #if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that all the elements are removed and the capacity does not change.
+/// </summary>
+QTEST_CASE ( Clear_AllElementsAreRemoved_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> hashtable(4);
+    hashtable.Add(1, 10);
+    hashtable.Add(2, 20);
+    const pointer_uint_q EXPECTED_CAPACITY = hashtable.GetCapacity();
+
+    // [Execution]
+    hashtable.Clear();
+
+    // [Verification]
+    BOOST_CHECK(hashtable.IsEmpty());
+    BOOST_CHECK(!hashtable.ContainsKey(1));
+    BOOST_CHECK(hashtable.GetFirst().IsEnd());
+    BOOST_CHECK_EQUAL(hashtable.GetCapacity(), EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the destructor of every key and value is called.
+/// </summary>
+QTEST_CASE ( Clear_DestructorOfEveryKeyAndValueIsCalled_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+    // [Preparation]
+    const unsigned int EXPECTED_CALLS = 4U;
+    QFlatHashtable<CallCounter, CallCounter> hashtable(10);
+    hashtable.Add(CallCounter(), CallCounter());
+    hashtable.Add(CallCounter(), CallCounter());
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    hashtable.Clear();
+
+    // [Verification]
+    unsigned int uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_CALLS);
+}
+
+/// <summary>
+/// Checks that every element is visited once when iterating forward.
+/// </summary>
+QTEST_CASE ( GetFirst_EveryElementIsVisitedOnceWhenIteratingForward_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 50;
+    QFlatHashtable<int, int> hashtable(4);
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        hashtable.Add(i, i);
+
+    // [Execution]
+    int nSum = 0;
+    int nVisited = 0;
+
+    for(QFlatHashtable<int, int>::ConstIterator it = hashtable.GetFirst(); !it.IsEnd(); ++it, ++nVisited)
+        nSum += it->GetKey();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(nVisited, NUMBER_OF_ELEMENTS);
+    BOOST_CHECK_EQUAL(nSum, NUMBER_OF_ELEMENTS * (NUMBER_OF_ELEMENTS - 1) / 2);
+}
+
+/// <summary>
+/// Checks that every element is visited once when iterating backward.
+/// </summary>
+QTEST_CASE ( GetLast_EveryElementIsVisitedOnceWhenIteratingBackward_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 50;
+    QFlatHashtable<int, int> hashtable(4);
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        hashtable.Add(i, i);
+
+    // [Execution]
+    int nSum = 0;
+    int nVisited = 0;
+
+    for(QFlatHashtable<int, int>::ConstIterator it = hashtable.GetLast(); !it.IsEnd(); --it, ++nVisited)
+        nSum += it->GetKey();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(nVisited, NUMBER_OF_ELEMENTS);
+    BOOST_CHECK_EQUAL(nSum, NUMBER_OF_ELEMENTS * (NUMBER_OF_ELEMENTS - 1) / 2);
+}
+
+/// <summary>
+/// Checks that the iterator points to the end position when the hashtable is empty.
+/// </summary>
+QTEST_CASE ( GetFirst_IteratorPointsToEndPositionWhenHashtableIsEmpty_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> hashtable(4);
+
+    // [Execution]
+    QFlatHashtable<int, int>::ConstIterator itFirst = hashtable.GetFirst();
+    QFlatHashtable<int, int>::ConstIterator itLast = hashtable.GetLast();
+
+    // [Verification]
+    BOOST_CHECK(itFirst.IsEnd());
+    BOOST_CHECK(itLast.IsEnd());
+}
+
+/// <summary>
+/// Checks that the iterator points to the element with the given key.
+/// </summary>
+QTEST_CASE ( PositionOfKey_IteratorPointsToElementWhenKeyExists_Test )
+{
+    // [Preparation]
+    const int INPUT_KEY = 7;
+    const int EXPECTED_VALUE = 70;
+    QFlatHashtable<int, int> hashtable(4);
+    hashtable.Add(1, 10);
+    hashtable.Add(INPUT_KEY, EXPECTED_VALUE);
+
+    // [Execution]
+    QFlatHashtable<int, int>::ConstIterator it = hashtable.PositionOfKey(INPUT_KEY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(it->GetKey(), INPUT_KEY);
+    BOOST_CHECK_EQUAL(it->GetValue(), EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the iterator points to the end position when the key does not exist.
+/// </summary>
+QTEST_CASE ( PositionOfKey_IteratorPointsToEndPositionWhenKeyDoesNotExist_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> hashtable(4);
+    hashtable.Add(1, 10);
+
+    // [Execution]
+    QFlatHashtable<int, int>::ConstIterator it = hashtable.PositionOfKey(2);
+
+    // [Verification]
+    BOOST_CHECK(it.IsEnd());
+}
+
+/// <summary>
+/// Checks that it returns True when both hashtables contain the same keys and values, in a different order.
+/// </summary>
+QTEST_CASE ( OperatorEquality_ReturnsTrueWhenHashtablesContainSameElements_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = true;
+    QFlatHashtable<int, int> hashtable1(4);
+    hashtable1.Add(1, 10);
+    hashtable1.Add(2, 20);
+    hashtable1.Add(3, 30);
+    QFlatHashtable<int, int> hashtable2(100);
+    hashtable2.Add(3, 30);
+    hashtable2.Add(1, 10);
+    hashtable2.Add(2, 20);
+
+    // [Execution]
+    bool bResult = hashtable1 == hashtable2;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that it returns False when any value is different.
+/// </summary>
+QTEST_CASE ( OperatorEquality_ReturnsFalseWhenValuesAreDifferent_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = false;
+    QFlatHashtable<int, int> hashtable1(4);
+    hashtable1.Add(1, 10);
+    hashtable1.Add(2, 20);
+    QFlatHashtable<int, int> hashtable2(4);
+    hashtable2.Add(1, 10);
+    hashtable2.Add(2, 21);
+
+    // [Execution]
+    bool bResult = hashtable1 == hashtable2;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that it returns True when any key is different.
+/// </summary>
+QTEST_CASE ( OperatorInequality_ReturnsTrueWhenKeysAreDifferent_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = true;
+    QFlatHashtable<int, int> hashtable1(4);
+    hashtable1.Add(1, 10);
+    hashtable1.Add(2, 20);
+    QFlatHashtable<int, int> hashtable2(4);
+    hashtable2.Add(1, 10);
+    hashtable2.Add(3, 20);
+
+    // [Execution]
+    bool bResult = hashtable1 != hashtable2;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that the elements of the input hashtable are copied and the previous ones are removed.
+/// </summary>
+QTEST_CASE ( OperatorAssignment_ElementsAreCopiedAndPreviousElementsAreRemoved_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> HASHTABLE(4);
+
+    for(int i = 0; i < 40; ++i)
+        HASHTABLE.Add(i, i + 1);
+
+    QFlatHashtable<int, int> hashtable(2);
+    hashtable.Add(100, 100);
+
+    // [Execution]
+    hashtable = HASHTABLE;
+
+    // [Verification]
+    BOOST_CHECK(hashtable == HASHTABLE);
+    BOOST_CHECK(!hashtable.ContainsKey(100));
+}
+
+/// <summary>
+/// Checks that the load factor is the number of elements divided by the number of slots.
+/// </summary>
+QTEST_CASE ( GetLoadFactor_ReturnsNumberOfElementsDividedByNumberOfSlots_Test )
+{
+    // [Preparation]
+    QFlatHashtable<int, int> hashtable(4);
+    hashtable.Add(1, 10);
+    hashtable.Add(2, 20);
+    hashtable.Add(3, 30);
+    hashtable.Add(4, 40);
+    const float EXPECTED_LOAD_FACTOR = 4.0f / scast_q(hashtable.GetNumberOfSlots(), float);
+
+    // [Execution]
+    float fLoadFactor = hashtable.GetLoadFactor();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(fLoadFactor, EXPECTED_LOAD_FACTOR);
+}
+
+/// <summary>
+/// Checks that all the keys are returned.
+/// </summary>
+QTEST_CASE ( GetKeys_AllKeysAreReturned_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::QArrayResult;
+
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 20;
+    QFlatHashtable<int, int> hashtable(4);
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        hashtable.Add(i, i);
+
+    // [Execution]
+    QArrayResult<int> arKeys = hashtable.GetKeys();
+
+    // [Verification]
+    int nSum = 0;
+
+    for(pointer_uint_q i = 0; i < arKeys.GetCount(); ++i)
+        nSum += arKeys.Get()[i];
+
+    BOOST_CHECK_EQUAL(arKeys.GetCount(), scast_q(NUMBER_OF_ELEMENTS, pointer_uint_q));
+    BOOST_CHECK_EQUAL(nSum, NUMBER_OF_ELEMENTS * (NUMBER_OF_ELEMENTS - 1) / 2);
+}
+
+/// <summary>
+/// Checks that a null pointer is returned when the hashtable is empty.
+/// </summary>
+QTEST_CASE ( GetKeys_ReturnsNullWhenHashtableIsEmpty_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::QArrayResult;
+
+    // [Preparation]
+    QFlatHashtable<int, int> hashtable(4);
+
+    // [Execution]
+    QArrayResult<int> arKeys = hashtable.GetKeys();
+
+    // [Verification]
+    BOOST_CHECK(arKeys.Get() == null_q);
+    BOOST_CHECK_EQUAL(arKeys.GetCount(), 0U);
+}
+
+// End - Test Suite: QFlatHashtable
+QTEST_SUITE_END()
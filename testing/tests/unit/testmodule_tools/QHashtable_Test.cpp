@@ -35,10 +35,14 @@ using namespace boost::unit_test;
 #include "QAssertException.h"
 #include "CallCounter.h"
 #include "SQStringHashProvider.h"
+#include "SQFloat.h"
 
 using Kinesis::QuimeraEngine::Tools::Containers::QHashtable;
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
 using Kinesis::QuimeraEngine::Tools::Containers::SQStringHashProvider;
+using Kinesis::QuimeraEngine::Tools::Containers::QContainerStatistics;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
 
 
 QTEST_SUITE_BEGIN( QHashtable_TestSuite )
@@ -436,6 +440,57 @@ QTEST_CASE ( Add_CapacityIsIncrementedWhenNecessary_Test )
     BOOST_CHECK(uCapacityAfterAdding > CAPACITY_BEFORE_ADDING);
 }
 
+/// <summary>
+/// Checks that the number of buckets grows when the maximum load factor is exceeded.
+/// </summary>
+QTEST_CASE ( Add_NumberOfBucketsGrowsWhenMaxLoadFactorIsExceeded_Test )
+{
+    // [Preparation]
+    QHashtable<int, int> HASHTABLE(4, 1);
+    HASHTABLE.SetMaxLoadFactor(1.0f);
+    HASHTABLE.Add(1, 1);
+    HASHTABLE.Add(2, 2);
+    HASHTABLE.Add(3, 3);
+    HASHTABLE.Add(4, 4);
+    const pointer_uint_q BUCKETS_BEFORE_ADDING = HASHTABLE.GetNumberOfBuckets();
+
+    // [Execution]
+    HASHTABLE.Add(5, 5);
+
+    // [Verification]
+    pointer_uint_q uBucketsAfterAdding = HASHTABLE.GetNumberOfBuckets();
+    BOOST_CHECK(uBucketsAfterAdding > BUCKETS_BEFORE_ADDING);
+}
+
+/// <summary>
+/// Checks that all the elements can be found when many of them are added and the buckets are rehashed several times.
+/// </summary>
+QTEST_CASE ( Add_AllElementsAreAccessibleWhenBucketsAreRehashedProgressively_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 500;
+    QHashtable<int, int> HASHTABLE(1, 1);
+
+    // [Execution]
+    bool bResultIsWhatEspected = true;
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        HASHTABLE.Add(i, i * 2);
+
+        // Elements must be accessible even if the rehash is in progress
+        bResultIsWhatEspected = bResultIsWhatEspected && HASHTABLE.ContainsKey(i / 2) && HASHTABLE[i / 2] == (i / 2) * 2;
+    }
+
+    // [Verification]
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && HASHTABLE.ContainsKey(i) && HASHTABLE[i] == i * 2;
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(HASHTABLE.GetCount(), scast_q(NUMBER_OF_ELEMENTS, pointer_uint_q));
+    BOOST_CHECK(HASHTABLE.GetLoadFactor() <= HASHTABLE.GetMaxLoadFactor());
+}
+
 #if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
 
 /// <summary>
@@ -686,6 +741,52 @@ QTEST_CASE( SetValue_AssertionFailsWhenKeyDoesNotExist_Test )
 
 #endif
 
+/// <summary>
+/// Checks that the value is replaced and it returns True when the key exists, even if there is more than one element in its bucket.
+/// </summary>
+QTEST_CASE ( TrySetValue_ValueIsReplacedAndReturnsTrueWhenKeyExists_Test )
+{
+    // [Preparation]
+    const int INPUT_KEY = 11;
+    const int EXPECTED_VALUE = 2;
+    const bool EXPECTED_RESULT = true;
+    QHashtable<int, int> HASHTABLE(10, 2);
+    HASHTABLE.Add(1, 1);
+    HASHTABLE.Add(INPUT_KEY, 0);
+    HASHTABLE.Add(21, 3);
+
+    // [Execution]
+    bool bResult = HASHTABLE.TrySetValue(INPUT_KEY, EXPECTED_VALUE);
+
+    // [Verification]
+    int nValue = HASHTABLE[INPUT_KEY];
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(nValue, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that nothing is modified and it returns False when the key does not exist.
+/// </summary>
+QTEST_CASE ( TrySetValue_NothingIsModifiedAndReturnsFalseWhenKeyDoesNotExist_Test )
+{
+    // [Preparation]
+    const int NON_EXISTING_KEY = 11;
+    const pointer_uint_q EXPECTED_COUNT = 2U;
+    const bool EXPECTED_RESULT = false;
+    QHashtable<int, int> HASHTABLE(10, 2);
+    HASHTABLE.Add(1, 1);
+    HASHTABLE.Add(21, 3);
+
+    // [Execution]
+    bool bResult = HASHTABLE.TrySetValue(NON_EXISTING_KEY, 2);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(HASHTABLE.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(HASHTABLE[1], 1);
+    BOOST_CHECK_EQUAL(HASHTABLE[21], 3);
+}
+
 /// <summary>
 /// Checks that it returns True when the hashtable contains the key.
 /// </summary>
@@ -851,6 +952,55 @@ QTEST_CASE ( Remove_ElementIsCorrectlyRemovedWhenThereIsMoreThanOneElementInBuck
     BOOST_CHECK(bResultIsWhatEspected);
 }
 
+/// <summary>
+/// Checks that the other slots of a bucket are still accessible after removing the first slot of the bucket.
+/// </summary>
+QTEST_CASE ( Remove_OtherElementsInBucketAreAccessibleWhenFirstSlotIsRemoved_Test )
+{
+    // [Preparation]
+    const int INPUT_KEY = 21; // It is the first slot of the bucket because it was the last to be added
+    QHashtable<int, int> HASHTABLE(10, 2);
+    HASHTABLE.Add(1, 1);
+    HASHTABLE.Add(11, 2);
+    HASHTABLE.Add(INPUT_KEY, 3);
+
+    // [Execution]
+    HASHTABLE.Remove(INPUT_KEY);
+    HASHTABLE.Add(31, 4);
+
+    // [Verification]
+    BOOST_CHECK(!HASHTABLE.ContainsKey(INPUT_KEY));
+    BOOST_CHECK_EQUAL(HASHTABLE[1], 1);
+    BOOST_CHECK_EQUAL(HASHTABLE[11], 2);
+    BOOST_CHECK_EQUAL(HASHTABLE[31], 4);
+}
+
+/// <summary>
+/// Checks that elements can be removed while the buckets are being rehashed and that the others remain accessible.
+/// </summary>
+QTEST_CASE ( Remove_ElementsAreCorrectlyRemovedWhileRehashIsInProgress_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 200;
+    QHashtable<int, int> HASHTABLE(1, 1);
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        HASHTABLE.Add(i, i);
+
+    // [Execution]
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; i += 2)
+        HASHTABLE.Remove(i);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && (HASHTABLE.ContainsKey(i) == (i % 2 != 0));
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(HASHTABLE.GetCount(), scast_q(NUMBER_OF_ELEMENTS / 2, pointer_uint_q));
+}
+
 #if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
 
 /// <summary>
@@ -883,6 +1033,51 @@ QTEST_CASE ( Remove_AssertionFailsWhenTheInputKeyDoesNotExist_Test )
 
 #endif
 
+/// <summary>
+/// Checks that the pair is removed and it returns True when the key exists, and that the rest of elements in the bucket are still accessible.
+/// </summary>
+QTEST_CASE ( TryRemove_PairIsRemovedAndReturnsTrueWhenKeyExists_Test )
+{
+    // [Preparation]
+    const int INPUT_KEY = 1;
+    const pointer_uint_q EXPECTED_COUNT = 2U;
+    const bool EXPECTED_RESULT = true;
+    QHashtable<int, int> HASHTABLE(10, 2);
+    HASHTABLE.Add(INPUT_KEY, 1);
+    HASHTABLE.Add(11, 2);
+    HASHTABLE.Add(21, 3);
+
+    // [Execution]
+    bool bResult = HASHTABLE.TryRemove(INPUT_KEY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(HASHTABLE.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK(!HASHTABLE.ContainsKey(INPUT_KEY));
+    BOOST_CHECK_EQUAL(HASHTABLE[11], 2);
+    BOOST_CHECK_EQUAL(HASHTABLE[21], 3);
+}
+
+/// <summary>
+/// Checks that nothing is removed and it returns False when the key does not exist.
+/// </summary>
+QTEST_CASE ( TryRemove_NothingIsRemovedAndReturnsFalseWhenKeyDoesNotExist_Test )
+{
+    // [Preparation]
+    const string_q NON_EXISTING_KEY("key2");
+    const pointer_uint_q EXPECTED_COUNT = 1U;
+    const bool EXPECTED_RESULT = false;
+    QHashtable<string_q, int, SQStringHashProvider> HASHTABLE(2, 2);
+    HASHTABLE.Add("key1", 1);
+
+    // [Execution]
+    bool bResult = HASHTABLE.TryRemove(NON_EXISTING_KEY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(HASHTABLE.GetCount(), EXPECTED_COUNT);
+}
+
 /// <sumary>
 /// Checks that the iterator is obtained.
 /// </sumary>
@@ -1600,6 +1795,150 @@ QTEST_CASE ( Clone_ClonedHashtableHasSameValuesThanTheOriginalHashtableWhenInput
     BOOST_CHECK(sourceHashtable == destinationHashtable);
 }
 
+/// <summary>
+/// Checks that the clone keeps all the elements accessible when the original hashtable is being rehashed.
+/// </summary>
+QTEST_CASE ( Clone_ClonedHashtableHasSameValuesThanTheOriginalHashtableWhenRehashIsInProgress_Test )
+{
+    // [Preparation]
+    QHashtable<int, int> sourceHashtable(8, 1);
+
+    for(int i = 0; i < 9; ++i)
+        sourceHashtable.Add(i, i);
+
+    QHashtable<int, int> destinationHashtable(3, 2);
+
+    // [Execution]
+    sourceHashtable.Clone(destinationHashtable);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+
+    for(int i = 0; i < 9; ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && destinationHashtable.ContainsKey(i) && destinationHashtable[i] == i;
+
+    BOOST_CHECK(sourceHashtable.IsRehashing());
+    BOOST_CHECK(bResultIsWhatEspected);
+}
+
+/// <summary>
+/// Checks that the number of buckets is changed.
+/// </summary>
+QTEST_CASE ( Rehash_NumberOfBucketsIsChanged_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_BUCKETS = 20;
+    QHashtable<int, int> HASHTABLE(5, 2);
+    HASHTABLE.Add(1, 1);
+
+    // [Execution]
+    HASHTABLE.Rehash(EXPECTED_BUCKETS);
+
+    // [Verification]
+    pointer_uint_q uBuckets = HASHTABLE.GetNumberOfBuckets();
+    BOOST_CHECK_EQUAL(uBuckets, EXPECTED_BUCKETS);
+}
+
+/// <summary>
+/// Checks that all the elements are still accessible after rehashing, both when the number of buckets grows and when it shrinks.
+/// </summary>
+QTEST_CASE ( Rehash_AllElementsAreAccessibleAfterRehashing_Test )
+{
+    // [Preparation]
+    const int NUMBER_OF_ELEMENTS = 30;
+    QHashtable<string_q, int, SQStringHashProvider> HASHTABLE(10, 3);
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        HASHTABLE.Add(string_q::FromInteger(i), i);
+
+    // [Execution]
+    HASHTABLE.Rehash(64);
+    bool bResultIsWhatEspected = true;
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && HASHTABLE[string_q::FromInteger(i)] == i;
+
+    HASHTABLE.Rehash(3);
+
+    for(int i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && HASHTABLE[string_q::FromInteger(i)] == i;
+
+    // [Verification]
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(HASHTABLE.GetCount(), scast_q(NUMBER_OF_ELEMENTS, pointer_uint_q));
+}
+
+/// <summary>
+/// Checks that no rehash remains in progress after calling the method.
+/// </summary>
+QTEST_CASE ( Rehash_RehashIsCompleted_Test )
+{
+    // [Preparation]
+    QHashtable<int, int> HASHTABLE(8, 1);
+
+    for(int i = 0; i < 9; ++i)
+        HASHTABLE.Add(i, i);
+
+    const bool WAS_REHASHING = HASHTABLE.IsRehashing();
+
+    // [Execution]
+    HASHTABLE.Rehash(40);
+
+    // [Verification]
+    BOOST_CHECK(WAS_REHASHING);
+    BOOST_CHECK(!HASHTABLE.IsRehashing());
+}
+
+/// <summary>
+/// Checks that iterators still point to the same elements after rehashing.
+/// </summary>
+QTEST_CASE ( Rehash_IteratorsRemainValid_Test )
+{
+    // [Preparation]
+    const int INPUT_KEY = 7;
+    QHashtable<int, int> HASHTABLE(3, 2);
+
+    for(int i = 0; i < 6; ++i)
+        HASHTABLE.Add(i * INPUT_KEY, i);
+
+    QHashtable<int, int>::QConstHashtableIterator itElement = HASHTABLE.PositionOfKey(INPUT_KEY);
+
+    // [Execution]
+    HASHTABLE.Rehash(11);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(itElement->GetKey(), INPUT_KEY);
+    BOOST_CHECK(HASHTABLE.PositionOfKey(INPUT_KEY) == itElement);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the number of buckets is zero.
+/// </summary>
+QTEST_CASE ( Rehash_AssertionFailsWhenNumberOfBucketsIsZero_Test )
+{
+    // [Preparation]
+    QHashtable<int, int> HASHTABLE(5, 2);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        HASHTABLE.Rehash(0);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
 /// <summary>
 /// Checks if the result contains all existing keys.
 /// </summary>
@@ -1670,5 +2009,303 @@ QTEST_CASE ( GetKeys_ReturnsNullWhenHashtableIsEmpty_Test )
     BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
 }
 
+/// <summary>
+/// Checks that the number of buckets is the one passed to the constructor.
+/// </summary>
+QTEST_CASE ( GetNumberOfBuckets_ReturnsNumberOfBucketsPassedToConstructor_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_BUCKETS = 7;
+    QHashtable<int, int> HASHTABLE(EXPECTED_BUCKETS, 2);
+
+    // [Execution]
+    pointer_uint_q uBuckets = HASHTABLE.GetNumberOfBuckets();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uBuckets, EXPECTED_BUCKETS);
+}
+
+/// <summary>
+/// Checks that the load factor is the number of elements divided by the number of buckets.
+/// </summary>
+QTEST_CASE ( GetLoadFactor_ReturnsNumberOfElementsDividedByNumberOfBuckets_Test )
+{
+    // [Preparation]
+    const float EXPECTED_LOAD_FACTOR = 0.75f;
+    QHashtable<int, int> HASHTABLE(4, 2);
+    HASHTABLE.Add(1, 1);
+    HASHTABLE.Add(2, 2);
+    HASHTABLE.Add(3, 3);
+
+    // [Execution]
+    float fLoadFactor = HASHTABLE.GetLoadFactor();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(fLoadFactor, EXPECTED_LOAD_FACTOR);
+}
+
+/// <summary>
+/// Checks that the default maximum load factor is used when it is not specified.
+/// </summary>
+QTEST_CASE ( GetMaxLoadFactor_ReturnsDefaultValueWhenNotSpecified_Test )
+{
+    // [Preparation]
+    const float EXPECTED_MAX_LOAD_FACTOR = QHashtable<int, int>::DEFAULT_MAX_LOAD_FACTOR;
+    QHashtable<int, int> HASHTABLE(4, 2);
+
+    // [Execution]
+    float fMaxLoadFactor = HASHTABLE.GetMaxLoadFactor();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(fMaxLoadFactor, EXPECTED_MAX_LOAD_FACTOR);
+}
+
+/// <summary>
+/// Checks that the maximum load factor is correctly set.
+/// </summary>
+QTEST_CASE ( SetMaxLoadFactor_MaxLoadFactorIsCorrectlySet_Test )
+{
+    // [Preparation]
+    const float EXPECTED_MAX_LOAD_FACTOR = 3.5f;
+    QHashtable<int, int> HASHTABLE(4, 2);
+
+    // [Execution]
+    HASHTABLE.SetMaxLoadFactor(EXPECTED_MAX_LOAD_FACTOR);
+
+    // [Verification]
+    float fMaxLoadFactor = HASHTABLE.GetMaxLoadFactor();
+    BOOST_CHECK_EQUAL(fMaxLoadFactor, EXPECTED_MAX_LOAD_FACTOR);
+}
+
+/// <summary>
+/// Checks that the number of buckets does not grow while the maximum load factor is not exceeded.
+/// </summary>
+QTEST_CASE ( SetMaxLoadFactor_NumberOfBucketsDoesNotGrowWhenMaxLoadFactorIsNotExceeded_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_BUCKETS = 2;
+    QHashtable<int, int> HASHTABLE(EXPECTED_BUCKETS, 4);
+
+    // [Execution]
+    HASHTABLE.SetMaxLoadFactor(4.0f);
+
+    for(int i = 0; i < 8; ++i)
+        HASHTABLE.Add(i, i);
+
+    // [Verification]
+    pointer_uint_q uBuckets = HASHTABLE.GetNumberOfBuckets();
+    BOOST_CHECK_EQUAL(uBuckets, EXPECTED_BUCKETS);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the maximum load factor is not greater than zero.
+/// </summary>
+QTEST_CASE ( SetMaxLoadFactor_AssertionFailsWhenValueIsNotGreaterThanZero_Test )
+{
+    // [Preparation]
+    QHashtable<int, int> HASHTABLE(4, 2);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        HASHTABLE.SetMaxLoadFactor(0.0f);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the rehash is progressive and it finishes after some operations.
+/// </summary>
+QTEST_CASE ( IsRehashing_RehashFinishesAfterSomeOperations_Test )
+{
+    // [Preparation]
+    QHashtable<int, int> HASHTABLE(8, 1);
+
+    for(int i = 0; i < 8; ++i)
+        HASHTABLE.Add(i, i);
+
+    // [Execution]
+    HASHTABLE.Add(8, 8);
+    bool bIsRehashingAfterGrowing = HASHTABLE.IsRehashing();
+    HASHTABLE.Add(9, 9);
+
+    // [Verification]
+    BOOST_CHECK(bIsRehashingAfterGrowing);
+    BOOST_CHECK(!HASHTABLE.IsRehashing());
+}
+
+/// <summary>
+/// Checks that the load factor and the length of the longest chain of colliding key-value pairs are correct.
+/// </summary>
+QTEST_CASE ( GetStatistics_LoadFactorAndMaximumChainLengthAreCorrect_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_BUCKETS = 4U;
+    const pointer_uint_q EXPECTED_COUNT = 4U;
+    const pointer_uint_q EXPECTED_MAXIMUM_CHAIN_LENGTH = 3U;
+    const float_q EXPECTED_LOAD_FACTOR = SQFloat::_1;
+    QHashtable<int, int> HASHTABLE(NUMBER_OF_BUCKETS, 2U);
+    HASHTABLE.Add(0, 0);
+    HASHTABLE.Add(4, 4);
+    HASHTABLE.Add(8, 8);
+    HASHTABLE.Add(1, 1);
+
+    // [Execution]
+    QContainerStatistics statistics = HASHTABLE.GetStatistics();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(statistics.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetMaximumChainLength(), EXPECTED_MAXIMUM_CHAIN_LENGTH);
+    BOOST_CHECK_EQUAL(statistics.GetLoadFactor(), EXPECTED_LOAD_FACTOR);
+}
+
+/// <summary>
+/// Checks that the longest chain is found while there is a rehash in progress, when some slots are still in the previous array of buckets.
+/// </summary>
+QTEST_CASE ( GetStatistics_MaximumChainLengthIsCorrectWhileRehashing_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_BUCKETS = 8U;
+    const pointer_uint_q EXPECTED_MAXIMUM_CHAIN_LENGTH = 5U;
+    QHashtable<int, int> HASHTABLE(NUMBER_OF_BUCKETS, 2U);
+
+    // All the keys belong to the last bucket, which is rehashed after the first ones
+    HASHTABLE.Add(7, 7);
+    HASHTABLE.Add(15, 15);
+    HASHTABLE.Add(23, 23);
+    HASHTABLE.Add(31, 31);
+    HASHTABLE.SetMaxLoadFactor(0.6f);
+    HASHTABLE.Add(39, 39);
+
+    // [Execution]
+    QContainerStatistics statistics = HASHTABLE.GetStatistics();
+
+    // [Verification]
+    BOOST_CHECK(HASHTABLE.IsRehashing());
+    BOOST_CHECK_EQUAL(statistics.GetMaximumChainLength(), EXPECTED_MAXIMUM_CHAIN_LENGTH);
+}
+
+/// <summary>
+/// Checks that the used bytes include the array of buckets, even if the hashtable is empty, and grow when key-value pairs are added.
+/// </summary>
+QTEST_CASE ( GetStatistics_UsedBytesIncludeBucketsAndSlots_Test )
+{
+    // [Preparation]
+    QHashtable<int, int> HASHTABLE(4U, 2U);
+    const QContainerStatistics STATISTICS_WHEN_EMPTY = HASHTABLE.GetStatistics();
+    HASHTABLE.Add(1, 1);
+
+    // [Execution]
+    QContainerStatistics statistics = HASHTABLE.GetStatistics();
+
+    // [Verification]
+    BOOST_CHECK(STATISTICS_WHEN_EMPTY.GetUsedBytes() > 0);
+    BOOST_CHECK(statistics.GetUsedBytes() > STATISTICS_WHEN_EMPTY.GetUsedBytes());
+    BOOST_CHECK_EQUAL(statistics.GetReservedBytes(), STATISTICS_WHEN_EMPTY.GetReservedBytes());
+}
+
+
+/// <summary>
+/// Checks that the capacity is reduced to the number of key-value pairs and all the keys can still be found.
+/// </summary>
+QTEST_CASE ( ShrinkToFit_CapacityIsReducedAndAllKeysAreFound_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 4U;
+    const int EXPECTED_KEYS[] = { 0, 2, 4, 5 };
+    QHashtable<int, int> HASHTABLE(4U, 4U);
+
+    for(int i = 0; i < 6; ++i)
+        HASHTABLE.Add(i, i * 10);
+
+    HASHTABLE.Remove(1);
+    HASHTABLE.Remove(3);
+
+    // [Execution]
+    HASHTABLE.ShrinkToFit();
+
+    // [Verification]
+    pointer_uint_q uCapacity = HASHTABLE.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+
+    for(pointer_uint_q i = 0; i < sizeof(EXPECTED_KEYS) / sizeof(int); ++i)
+    {
+        BOOST_CHECK(HASHTABLE.ContainsKey(EXPECTED_KEYS[i]));
+        BOOST_CHECK_EQUAL(HASHTABLE.GetValue(EXPECTED_KEYS[i]), EXPECTED_KEYS[i] * 10);
+    }
+
+    BOOST_CHECK(!HASHTABLE.ContainsKey(1));
+    BOOST_CHECK(!HASHTABLE.ContainsKey(3));
+}
+
+/// <summary>
+/// Checks that key-value pairs can be added and removed after shrinking the hashtable.
+/// </summary>
+QTEST_CASE ( ShrinkToFit_PairsCanBeAddedAndRemovedAfterShrinking_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_COUNT = 4U;
+    QHashtable<int, int> HASHTABLE(4U, 4U);
+    HASHTABLE.Add(0, 0);
+    HASHTABLE.Add(4, 40);
+    HASHTABLE.Add(1, 10);
+    HASHTABLE.ShrinkToFit();
+
+    // [Execution]
+    HASHTABLE.Add(8, 80);
+    HASHTABLE.Add(5, 50);
+    HASHTABLE.Remove(0);
+
+    // [Verification]
+    pointer_uint_q uCount = HASHTABLE.GetCount();
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(HASHTABLE.GetValue(4), 40);
+    BOOST_CHECK_EQUAL(HASHTABLE.GetValue(8), 80);
+    BOOST_CHECK_EQUAL(HASHTABLE.GetValue(1), 10);
+    BOOST_CHECK_EQUAL(HASHTABLE.GetValue(5), 50);
+}
+
+/// <summary>
+/// Checks that the rehash in progress is completed before shrinking the hashtable.
+/// </summary>
+QTEST_CASE ( ShrinkToFit_RehashInProgressIsCompleted_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 5U;
+    const bool IS_REHASHING = false;
+    QHashtable<int, int> HASHTABLE(8U, 2U);
+    HASHTABLE.Add(7, 7);
+    HASHTABLE.Add(15, 15);
+    HASHTABLE.Add(23, 23);
+    HASHTABLE.Add(31, 31);
+    HASHTABLE.SetMaxLoadFactor(0.6f);
+    HASHTABLE.Add(39, 39);
+
+    // [Execution]
+    HASHTABLE.ShrinkToFit();
+
+    // [Verification]
+    bool bIsRehashing = HASHTABLE.IsRehashing();
+    pointer_uint_q uCapacity = HASHTABLE.GetCapacity();
+    BOOST_CHECK_EQUAL(bIsRehashing, IS_REHASHING);
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+
+    for(int i = 7; i <= 39; i += 8)
+        BOOST_CHECK_EQUAL(HASHTABLE.GetValue(i), i);
+}
+
+
 // End - Test Suite: QHashtable
 QTEST_SUITE_END()
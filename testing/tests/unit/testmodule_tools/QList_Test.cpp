@@ -38,11 +38,25 @@ using namespace boost::unit_test;
 
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
 using Kinesis::QuimeraEngine::Tools::Containers::QList;
+using Kinesis::QuimeraEngine::Tools::Containers::QContainerStatistics;
 using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
 using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
 using Kinesis::QuimeraEngine::Tools::Containers::Test::QListWhiteBox;
 using Kinesis::QuimeraEngine::Tools::Containers::Test::ListElementMock;
 
+/// <summary>
+/// Comparator that only compares the tens of the numbers, used to check that equal elements keep their relative order when sorting.
+/// </summary>
+class QListTestTensComparator
+{
+public:
+
+    static Kinesis::QuimeraEngine::Common::DataTypes::i8_q Compare(const u32_q &uLeftOperand, const u32_q &uRightOperand)
+    {
+        return uLeftOperand / 10U < uRightOperand / 10U ? -1 : (uLeftOperand / 10U == uRightOperand / 10U ? 0 : 1);
+    }
+};
+
 
 QTEST_SUITE_BEGIN( QList_TestSuite )
 
@@ -1373,6 +1387,206 @@ QTEST_CASE ( Reserve_NothingHappensWhenTheAmountToReserveIsNoGreaterThanCurrentC
     BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
 }
 
+/// <summary>
+/// Checks that elements keep the same order after compacting the list.
+/// </summary>
+QTEST_CASE ( Compact_ElementsKeepTheirOrder_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 2U, 4U, 6U, 7U, 8U };
+    const pointer_uint_q EXPECTED_COUNT = sizeof(EXPECTED_ELEMENTS) / sizeof(u32_q);
+    QList<u32_q> list(10U);
+    list.Add(8U);
+    list.Add(1U);
+    list.Add(6U);
+    list.Add(3U);
+    list.Add(4U);
+    list.Add(2U);
+    list.Add(0U);
+    list.Sort();
+    list.Remove(1U);
+    list.Remove(2U);
+    list.Insert(7U, 4U);
+
+    // [Execution]
+    list.Compact();
+
+    // [Verification]
+    QList<u32_q>::QConstListIterator it = list.GetFirst();
+    pointer_uint_q uCount = 0;
+
+    for(; !it.IsEnd(); ++it, ++uCount)
+        BOOST_CHECK_EQUAL(*it, EXPECTED_ELEMENTS[uCount]);
+
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that elements are stored in consecutive memory positions, in the same order they are traversed.
+/// </summary>
+QTEST_CASE ( Compact_ElementsAreStoredInTraversalOrder_Test )
+{
+    // [Preparation]
+    const bool ELEMENTS_ARE_IN_TRAVERSAL_ORDER = true;
+    QList<u32_q> list(10U);
+    list.Add(5U);
+    list.Add(3U);
+    list.Add(8U);
+    list.Add(1U);
+    list.Add(9U);
+    list.Add(2U);
+    list.Sort();
+    list.Remove(0U);
+
+    // [Execution]
+    list.Compact();
+
+    // [Verification]
+    const u32_q* pBasePointer = scast_q(list.GetAllocator()->GetPointer(), const u32_q*);
+    bool bElementsAreInTraversalOrder = true;
+    pointer_uint_q i = 0;
+
+    for(QList<u32_q>::QConstListIterator it = list.GetFirst(); !it.IsEnd(); ++it, ++i)
+        bElementsAreInTraversalOrder = bElementsAreInTraversalOrder && &*it == pBasePointer + i;
+
+    BOOST_CHECK_EQUAL(bElementsAreInTraversalOrder, ELEMENTS_ARE_IN_TRAVERSAL_ORDER);
+}
+
+/// <summary>
+/// Checks that the capacity is reduced to the number of elements.
+/// </summary>
+QTEST_CASE ( Compact_CapacityIsReducedToTheNumberOfElements_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 3U;
+    QList<u32_q> list(10U);
+
+    for(u32_q i = 0; i < EXPECTED_CAPACITY; ++i)
+        list.Add(i);
+
+    // [Execution]
+    list.Compact();
+
+    // [Verification]
+    pointer_uint_q uCapacity = list.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the capacity of an empty list is reduced to one element.
+/// </summary>
+QTEST_CASE ( Compact_CapacityOfEmptyListIsReducedToOneElement_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 1U;
+    QList<u32_q> list(10U);
+
+    // [Execution]
+    list.Compact();
+
+    // [Verification]
+    pointer_uint_q uCapacity = list.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the returned value equals the number of bytes released by both the element and the link allocators.
+/// </summary>
+QTEST_CASE ( Compact_ReturnsTheNumberOfReleasedBytes_Test )
+{
+    // [Preparation]
+    QListWhiteBox<u32_q> list(10U);
+    list.Add(1U);
+    list.Add(2U);
+    list.Add(3U);
+    const pointer_uint_q ORIGINAL_SIZE = list.GetAllocator()->GetPoolSize() + list.GetLinkAllocator()->GetPoolSize();
+
+    // [Execution]
+    pointer_uint_q uReleasedBytes = list.Compact();
+
+    // [Verification]
+    const pointer_uint_q EXPECTED_RELEASED_BYTES = ORIGINAL_SIZE - list.GetAllocator()->GetPoolSize() - list.GetLinkAllocator()->GetPoolSize();
+    const pointer_uint_q ZERO = 0;
+    BOOST_CHECK_EQUAL(uReleasedBytes, EXPECTED_RELEASED_BYTES);
+    BOOST_CHECK_NE(uReleasedBytes, ZERO);
+}
+
+/// <summary>
+/// Checks that nothing is released when the capacity already equals the number of elements.
+/// </summary>
+QTEST_CASE ( Compact_NothingIsReleasedWhenCapacityEqualsNumberOfElements_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_RELEASED_BYTES = 0;
+    QList<u32_q> list(3U);
+    list.Add(1U);
+    list.Add(2U);
+    list.Add(3U);
+
+    // [Execution]
+    pointer_uint_q uReleasedBytes = list.Compact();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uReleasedBytes, EXPECTED_RELEASED_BYTES);
+}
+
+/// <summary>
+/// Checks that elements can be added after compacting the list and the order is correct.
+/// </summary>
+QTEST_CASE ( Compact_ElementsCanBeAddedAfterCompacting_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 1U, 2U, 3U, 4U };
+    const pointer_uint_q EXPECTED_COUNT = sizeof(EXPECTED_ELEMENTS) / sizeof(u32_q);
+    QList<u32_q> list(10U);
+    list.Add(2U);
+    list.Add(0U);
+    list.Add(1U);
+    list.Sort();
+    list.Compact();
+
+    // [Execution]
+    list.Add(4U);
+    list.Insert(3U, 3U);
+
+    // [Verification]
+    QList<u32_q>::QConstListIterator it = list.GetFirst();
+    pointer_uint_q uCount = 0;
+
+    for(; !it.IsEnd(); ++it, ++uCount)
+        BOOST_CHECK_EQUAL(*it, EXPECTED_ELEMENTS[uCount]);
+
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that neither copy constructors nor destructors are called.
+/// </summary>
+QTEST_CASE ( Compact_NoCopyConstructorsNorDestructorsAreCalled_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CALLS = 0;
+    QList<CallCounter> list(10U);
+    list.Add(CallCounter());
+    list.Add(CallCounter());
+    list.Add(CallCounter());
+    list.Remove(0U);
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    list.Compact();
+
+    // [Verification]
+    pointer_uint_q uCopyConstructorCalls = CallCounter::GetCopyConstructorCallsCount();
+    pointer_uint_q uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    pointer_uint_q uAssignmentCalls = CallCounter::GetAssignmentCallsCount();
+    BOOST_CHECK_EQUAL(uCopyConstructorCalls, EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(uAssignmentCalls, EXPECTED_CALLS);
+}
+
 /// <summary>
 /// Checks if the method returns the correct number of elements in the list.
 /// </summary>
@@ -1512,6 +1726,29 @@ QTEST_CASE ( Add_CopyConstructorIsCalledForAddedElements_Test )
     BOOST_CHECK_EQUAL(uCopyConstructorCalls, EXPECTED_CALLS);
 }
 
+/// <summary>
+/// Checks that the element is the first one when it is added to a list that has become empty after removing elements from the front.
+/// </summary>
+QTEST_CASE ( Add_ElementIsFirstWhenAddedToListThatBecameEmptyAfterRemovingElements_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INITIAL_CAPACITY = 4U;
+    const int EXPECTED_FIRST_ELEMENT = 2;
+    QList<int> commonList(INITIAL_CAPACITY);
+    commonList.Add(0);
+    commonList.Add(1);
+    commonList.Remove(0);
+    commonList.Remove(0);
+
+    // [Execution]
+    commonList.Add(2);
+    commonList.Add(3);
+
+    // [Verification]
+    int nFirstElement = commonList[0];
+    BOOST_CHECK_EQUAL(nFirstElement, EXPECTED_FIRST_ELEMENT);
+}
+
 /// <summary>
 /// Checks that elements can be inserted at the first position.
 /// </summary>
@@ -3084,6 +3321,167 @@ QTEST_CASE( Swap2_NothingHappensWhenSwappingTheSameElement_Test )
 
 #endif
 
+/// <sumary>
+/// Checks that the element is moved before the target position when it is placed posteriorly.
+/// </sumary>
+QTEST_CASE( Move_ElementIsMovedBeforeAnteriorPosition_Test )
+{
+    // [Preparation]
+    u32_q arValues[] = {0, 1U, 2U, 3U, 4U, 5U};
+    const u32_q EXPECTED_VALUES[] = {0, 4U, 1U, 2U, 3U, 5U};
+    QList<u32_q> list(arValues, sizeof(arValues) / sizeof(u32_q));
+    const QList<u32_q>::QListIterator ELEMENT = list.GetIterator(4U);
+    const QList<u32_q>::QListIterator POSITION = list.GetIterator(1U);
+
+    // [Execution]
+    list.Move(ELEMENT, POSITION);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+    QList<u32_q>::QConstListIterator it = list.GetFirst();
+
+    for(pointer_uint_q i = 0; !it.IsEnd(); ++it, ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && *it == EXPECTED_VALUES[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(list.GetCount(), sizeof(arValues) / sizeof(u32_q));
+}
+
+/// <sumary>
+/// Checks that the element is moved to the first position when the target position is the first one.
+/// </sumary>
+QTEST_CASE( Move_ElementIsMovedToTheBeginningWhenTargetIsTheFirst_Test )
+{
+    // [Preparation]
+    u32_q arValues[] = {0, 1U, 2U, 3U};
+    const u32_q EXPECTED_VALUES[] = {3U, 0, 1U, 2U};
+    QList<u32_q> list(arValues, sizeof(arValues) / sizeof(u32_q));
+    const QList<u32_q>::QListIterator ELEMENT = list.GetLast();
+    const QList<u32_q>::QListIterator POSITION = list.GetFirst();
+
+    // [Execution]
+    list.Move(ELEMENT, POSITION);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+    QList<u32_q>::QConstListIterator it = list.GetFirst();
+
+    for(pointer_uint_q i = 0; !it.IsEnd(); ++it, ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && *it == EXPECTED_VALUES[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK(list.GetFirst() == ELEMENT);
+}
+
+/// <sumary>
+/// Checks that the element is moved to the last position when the target position is the end position.
+/// </sumary>
+QTEST_CASE( Move_ElementIsMovedToTheEndWhenTargetIsEndPosition_Test )
+{
+    // [Preparation]
+    u32_q arValues[] = {0, 1U, 2U, 3U};
+    const u32_q EXPECTED_VALUES[] = {1U, 2U, 3U, 0};
+    QList<u32_q> list(arValues, sizeof(arValues) / sizeof(u32_q));
+    const QList<u32_q>::QListIterator ELEMENT = list.GetFirst();
+    QList<u32_q>::QListIterator POSITION = list.GetLast();
+    ++POSITION;
+
+    // [Execution]
+    list.Move(ELEMENT, POSITION);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+    QList<u32_q>::QConstListIterator it = list.GetFirst();
+
+    for(pointer_uint_q i = 0; !it.IsEnd(); ++it, ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && *it == EXPECTED_VALUES[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK(list.GetLast() == ELEMENT);
+}
+
+/// <sumary>
+/// Checks that the list can be traversed backward after moving an element.
+/// </sumary>
+QTEST_CASE( Move_BackwardLinksAreCorrectlyUpdated_Test )
+{
+    // [Preparation]
+    u32_q arValues[] = {0, 1U, 2U, 3U, 4U};
+    const u32_q EXPECTED_VALUES[] = {4U, 3U, 1U, 2U, 0};
+    QList<u32_q> list(arValues, sizeof(arValues) / sizeof(u32_q));
+    const QList<u32_q>::QListIterator ELEMENT = list.GetIterator(1U);
+    const QList<u32_q>::QListIterator POSITION = list.GetIterator(3U);
+
+    // [Execution]
+    list.Move(ELEMENT, POSITION);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+    QList<u32_q>::QConstListIterator it = list.GetLast();
+
+    for(pointer_uint_q i = 0; !it.IsEnd(); --it, ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && *it == EXPECTED_VALUES[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+}
+
+/// <sumary>
+/// Checks that nothing changes when the element is already placed just before the target position.
+/// </sumary>
+QTEST_CASE( Move_NothingChangesWhenElementIsAlreadyBeforeTargetPosition_Test )
+{
+    // [Preparation]
+    u32_q arValues[] = {0, 1U, 2U};
+    QList<u32_q> list(arValues, sizeof(arValues) / sizeof(u32_q));
+    const QList<u32_q>::QListIterator ELEMENT = list.GetIterator(1U);
+    const QList<u32_q>::QListIterator POSITION = list.GetIterator(2U);
+
+    // [Execution]
+    list.Move(ELEMENT, POSITION);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+    QList<u32_q>::QConstListIterator it = list.GetFirst();
+
+    for(pointer_uint_q i = 0; !it.IsEnd(); ++it, ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && *it == arValues[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <sumary>
+/// Checks that an assertion fails when the element to move is an end position.
+/// </sumary>
+QTEST_CASE( Move_AssertionFailsWhenElementIsEndPosition_Test )
+{
+    // [Preparation]
+    u32_q arValues[] = {0, 1U, 2U};
+    QList<u32_q> list(arValues, sizeof(arValues) / sizeof(u32_q));
+    QList<u32_q>::QListIterator ELEMENT = list.GetLast();
+    ++ELEMENT;
+    const QList<u32_q>::QListIterator POSITION = list.GetFirst();
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        list.Move(ELEMENT, POSITION);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL( bAssertionFailed, ASSERTION_FAILED );
+}
+
+#endif
+
 /// <sumary>
 /// Checks that it returns True when the element appears the first.
 /// </sumary>
@@ -5156,6 +5554,269 @@ QTEST_CASE( GetCapacity_ReturnsTheCapacityOfTheList_Test )
 }
 
 
+/// <summary>
+/// Checks that elements are sorted in ascending order.
+/// </summary>
+QTEST_CASE ( Sort_ElementsAreSortedInAscendingOrder_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 1U, 2U, 3U, 4U };
+    QList<u32_q> listToSort(5U);
+    listToSort.Add(3U);
+    listToSort.Add(0U);
+    listToSort.Add(4U);
+    listToSort.Add(2U);
+    listToSort.Add(1U);
+
+    // [Execution]
+    listToSort.Sort();
+
+    // [Verification]
+    QList<u32_q>::QConstListIterator it = listToSort.GetFirst();
+
+    for(pointer_uint_q i = 0; !it.IsEnd(); ++it, ++i)
+        BOOST_CHECK_EQUAL(*it, EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that elements are sorted when the list is traversed backward.
+/// </summary>
+QTEST_CASE ( StableSort_ElementsAreSortedWhenTraversingBackward_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U };
+    const pointer_uint_q EXPECTED_COUNT = sizeof(EXPECTED_ELEMENTS) / sizeof(u32_q);
+    QList<u32_q> listToSort(EXPECTED_COUNT);
+    listToSort.Add(5U);
+    listToSort.Add(3U);
+    listToSort.Add(8U);
+    listToSort.Add(1U);
+    listToSort.Add(9U);
+    listToSort.Add(2U);
+    listToSort.Add(7U);
+    listToSort.Add(4U);
+    listToSort.Add(6U);
+    listToSort.Add(0U);
+
+    // [Execution]
+    listToSort.StableSort();
+
+    // [Verification]
+    QList<u32_q>::QConstListIterator it = listToSort.GetLast();
+    pointer_uint_q uCount = 0;
+
+    for(; !it.IsEnd(); --it, ++uCount)
+        BOOST_CHECK_EQUAL(*it, EXPECTED_ELEMENTS[EXPECTED_COUNT - uCount - 1U]);
+
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that equal elements keep their relative order.
+/// </summary>
+QTEST_CASE ( StableSort_EqualElementsKeepTheirRelativeOrder_Test )
+{
+    // [Preparation]
+    // The comparator only compares the tens, so 21 and 25 are equal
+    const u32_q EXPECTED_ELEMENTS[] = { 13U, 11U, 17U, 21U, 25U, 20U, 32U };
+    QList<u32_q, Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, QListTestTensComparator> listToSort(7U);
+    listToSort.Add(21U);
+    listToSort.Add(13U);
+    listToSort.Add(32U);
+    listToSort.Add(25U);
+    listToSort.Add(11U);
+    listToSort.Add(20U);
+    listToSort.Add(17U);
+
+    // [Execution]
+    listToSort.StableSort();
+
+    // [Verification]
+    QList<u32_q, Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator, QListTestTensComparator>::QConstListIterator it = listToSort.GetFirst();
+
+    for(pointer_uint_q i = 0; !it.IsEnd(); ++it, ++i)
+        BOOST_CHECK_EQUAL(*it, EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that elements are not moved in memory, so iterators point to the same elements after sorting.
+/// </summary>
+QTEST_CASE ( StableSort_IteratorsPointToTheSameElementsAfterSorting_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENT = 3U;
+    QList<u32_q> listToSort(3U);
+    listToSort.Add(2U);
+    listToSort.Add(EXPECTED_ELEMENT);
+    listToSort.Add(1U);
+    QList<u32_q>::QConstListIterator itElement = listToSort.GetFirst();
+    ++itElement;
+
+    // [Execution]
+    listToSort.StableSort();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(*itElement, EXPECTED_ELEMENT);
+    BOOST_CHECK(itElement == listToSort.GetLast());
+}
+
+/// <summary>
+/// Checks that nothing happens when the list is empty.
+/// </summary>
+QTEST_CASE ( StableSort_NothingHappensWhenListIsEmpty_Test )
+{
+    // [Preparation]
+    QList<u32_q> listToSort;
+
+    // [Execution]
+    listToSort.StableSort();
+
+    // [Verification]
+    BOOST_CHECK(listToSort.IsEmpty());
+    BOOST_CHECK(listToSort.GetFirst().IsEnd());
+}
+
+/// <summary>
+/// Checks that the element is constructed in place, calling the default constructor and not the copy constructor.
+/// </summary>
+QTEST_CASE ( Emplace1_ElementIsDefaultConstructedWithoutCallingCopyConstructor_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+    // [Preparation]
+    const unsigned int EXPECTED_CONSTRUCTOR_CALLS = 1U;
+    const unsigned int EXPECTED_COPY_CONSTRUCTOR_CALLS = 0;
+    const pointer_uint_q EXPECTED_COUNT = 1U;
+    QList<CallCounter> listToFill(1U);
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    listToFill.Emplace();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(CallCounter::GetConstructorCallsCount(), EXPECTED_CONSTRUCTOR_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetCopyConstructorCallsCount(), EXPECTED_COPY_CONSTRUCTOR_CALLS);
+    BOOST_CHECK_EQUAL(listToFill.GetCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the input argument is passed to the constructor of the element.
+/// </summary>
+QTEST_CASE ( Emplace2_ArgumentIsPassedToTheConstructor_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+
+    // [Preparation]
+    const string_q EXPECTED_VALUE("ABC");
+    QList<string_q> listToFill;
+    listToFill.Add("XYZ");
+
+    // [Execution]
+    listToFill.Emplace("ABC");
+
+    // [Verification]
+    BOOST_CHECK(*listToFill.GetLast() == EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the element is the first one when it is constructed in a list that has become empty after removing elements from the front.
+/// </summary>
+QTEST_CASE ( Emplace2_ElementIsFirstWhenConstructedInListThatBecameEmptyAfterRemovingElements_Test )
+{
+    // [Preparation]
+    const pointer_uint_q INITIAL_CAPACITY = 4U;
+    const int EXPECTED_FIRST_ELEMENT = 2;
+    QList<int> listToFill(INITIAL_CAPACITY);
+    listToFill.Add(0);
+    listToFill.Add(1);
+    listToFill.Remove(0);
+    listToFill.Remove(0);
+
+    // [Execution]
+    listToFill.Emplace(2);
+    listToFill.Emplace(3);
+
+    // [Verification]
+    int nFirstElement = listToFill[0];
+    BOOST_CHECK_EQUAL(nFirstElement, EXPECTED_FIRST_ELEMENT);
+}
+
+/// <summary>
+/// Checks that all the input arguments are passed to the constructor of the element, in the same order.
+/// </summary>
+QTEST_CASE ( Emplace3_ArgumentsArePassedToTheConstructorInTheSameOrder_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+
+    // [Preparation]
+    const string_q EXPECTED_VALUE("ABC");
+    QList<string_q> listToFill;
+    listToFill.Add("XYZ");
+
+    // [Execution]
+    listToFill.Emplace("ABCDEF", 3);
+
+    // [Verification]
+    BOOST_CHECK(*listToFill.GetLast() == EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the statistics contain the number of elements, the capacity and the bytes used by the elements and their links.
+/// </summary>
+QTEST_CASE ( GetStatistics_MemoryUsageIsCorrect_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_COUNT = 3U;
+    const pointer_uint_q EXPECTED_CAPACITY = 8U;
+    const pointer_uint_q MINIMUM_EXPECTED_RESERVED_BYTES = EXPECTED_CAPACITY * sizeof(u32_q);
+    QList<u32_q> LIST(EXPECTED_CAPACITY);
+
+    for(u32_q i = 0; i < EXPECTED_COUNT; ++i)
+        LIST.Add(i);
+
+    // [Execution]
+    QContainerStatistics statistics = LIST.GetStatistics();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(statistics.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetCapacity(), EXPECTED_CAPACITY);
+    BOOST_CHECK(statistics.GetReservedBytes() > MINIMUM_EXPECTED_RESERVED_BYTES);
+    BOOST_CHECK_EQUAL(statistics.GetUsedBytes() * EXPECTED_CAPACITY, statistics.GetReservedBytes() * EXPECTED_COUNT);
+}
+
+
+/// <summary>
+/// Checks that the capacity is reduced to the number of elements and the elements keep their order.
+/// </summary>
+QTEST_CASE ( ShrinkToFit_CapacityIsReducedAndElementsKeepTheirOrder_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 2U, 1U };
+    const pointer_uint_q EXPECTED_COUNT = sizeof(EXPECTED_ELEMENTS) / sizeof(u32_q);
+    const pointer_uint_q EXPECTED_CAPACITY = EXPECTED_COUNT;
+    QList<u32_q> list(10U);
+    list.Add(3U);
+    list.Add(1U);
+    list.Insert(0U, 0U);
+    list.Insert(2U, 2U);
+    list.Remove(1U);
+
+    // [Execution]
+    list.ShrinkToFit();
+
+    // [Verification]
+    QList<u32_q>::QConstListIterator it = list.GetFirst();
+    pointer_uint_q uCount = 0;
+
+    for(; !it.IsEnd(); ++it, ++uCount)
+        BOOST_CHECK_EQUAL(*it, EXPECTED_ELEMENTS[uCount]);
+
+    pointer_uint_q uCapacity = list.GetCapacity();
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+
 // End - Test Suite: QList
 
 QTEST_SUITE_END()
@@ -0,0 +1,173 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QNTreeImageView.h"
+#include "QNTree.h"
+#include "BinaryStreamWriterMock.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QNTreeImageView;
+using Kinesis::QuimeraEngine::Tools::Containers::QNTree;
+using Kinesis::QuimeraEngine::Tools::Containers::EQTreeTraversalOrder;
+using Kinesis::QuimeraEngine::Tools::Containers::Test::BinaryStreamWriterMock;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+QTEST_SUITE_BEGIN( QNTreeImageView_TestSuite )
+
+/// <summary>
+/// Checks that the nodes of the image are stored in depth-first pre-order and their links are translated, regardless of where they were stored in the tree.
+/// </summary>
+QTEST_CASE ( Constructor_NodesAreStoredInPreOrder_Test )
+{
+    // [Preparation]
+    // Tree:   0
+    //       /   \
+    //      1     2
+    //      |
+    //      3
+    // Pre-order: 0, 1, 3, 2
+    const u32_q EXPECTED_ELEMENTS[] = { 0, 1U, 3U, 2U };
+    const pointer_uint_q EXPECTED_COUNT = 4U;
+    const pointer_uint_q END_POSITION = QNTreeImageView<u32_q>::END_POSITION;
+
+    QNTree<u32_q> tree(2U, 4U);
+    tree.SetRootValue(0);
+    QNTree<u32_q>::QNTreeIterator itChild1 = tree.AddChild(tree.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder), 1U);
+    tree.AddChild(tree.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder), 2U);
+    tree.AddChild(itChild1, 3U);
+    BinaryStreamWriterMock writer(512U);
+    tree.WriteImage(writer);
+
+    // [Execution]
+    QNTreeImageView<u32_q> view(writer.GetBuffer());
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(view.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(view.GetRoot(), 0U);
+
+    for(pointer_uint_q i = 0; i < EXPECTED_COUNT; ++i)
+        BOOST_CHECK_EQUAL(view.GetValue(i), EXPECTED_ELEMENTS[i]);
+
+    BOOST_CHECK_EQUAL(view.GetParent(0), END_POSITION);
+    BOOST_CHECK_EQUAL(view.GetFirstChild(0), 1U);
+    BOOST_CHECK_EQUAL(view.GetNextSibling(0), END_POSITION);
+    BOOST_CHECK_EQUAL(view.GetParent(1U), 0U);
+    BOOST_CHECK_EQUAL(view.GetFirstChild(1U), 2U);
+    BOOST_CHECK_EQUAL(view.GetNextSibling(1U), 3U);
+    BOOST_CHECK_EQUAL(view.GetPreviousSibling(1U), END_POSITION);
+    BOOST_CHECK_EQUAL(view.GetParent(2U), 1U);
+    BOOST_CHECK_EQUAL(view.GetFirstChild(2U), END_POSITION);
+    BOOST_CHECK_EQUAL(view.GetParent(3U), 0U);
+    BOOST_CHECK_EQUAL(view.GetPreviousSibling(3U), 1U);
+    BOOST_CHECK_EQUAL(view.GetNextSibling(3U), END_POSITION);
+}
+
+/// <summary>
+/// Checks that writing an image does not modify the tree.
+/// </summary>
+QTEST_CASE ( WriteImage_TreeIsNotModified_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 0, 1U, 3U, 2U };
+    QNTree<u32_q> tree(2U, 4U);
+    tree.SetRootValue(0);
+    QNTree<u32_q>::QNTreeIterator itChild1 = tree.AddChild(tree.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder), 1U);
+    tree.AddChild(tree.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder), 2U);
+    tree.AddChild(itChild1, 3U);
+    BinaryStreamWriterMock writer(512U);
+
+    // [Execution]
+    tree.WriteImage(writer);
+
+    // [Verification]
+    QNTree<u32_q>::QNTreeIterator it = tree.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+
+    for(pointer_uint_q i = 0; !it.IsEnd(); ++i, ++it)
+        BOOST_CHECK_EQUAL(*it, EXPECTED_ELEMENTS[i]);
+}
+
+/// <summary>
+/// Checks that the image of an empty tree has no root.
+/// </summary>
+QTEST_CASE ( GetRoot_ReturnsEndPositionWhenImageIsEmpty_Test )
+{
+    // [Preparation]
+    const bool IS_EMPTY = true;
+    const pointer_uint_q END_POSITION = QNTreeImageView<u32_q>::END_POSITION;
+    QNTree<u32_q> tree(2U, 4U);
+    BinaryStreamWriterMock writer(512U);
+    tree.WriteImage(writer);
+
+    // [Execution]
+    QNTreeImageView<u32_q> view(writer.GetBuffer());
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(view.IsEmpty(), IS_EMPTY);
+    BOOST_CHECK_EQUAL(view.GetRoot(), END_POSITION);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the node does not exist.
+/// </summary>
+QTEST_CASE ( GetParent_AssertionFailsWhenNodeDoesNotExist_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QNTree<u32_q> tree(2U, 4U);
+    tree.SetRootValue(0);
+    BinaryStreamWriterMock writer(512U);
+    tree.WriteImage(writer);
+    QNTreeImageView<u32_q> view(writer.GetBuffer());
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        view.GetParent(1U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: QNTreeImageView
+QTEST_SUITE_END()
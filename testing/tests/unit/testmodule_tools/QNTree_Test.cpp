@@ -34,11 +34,15 @@ using namespace boost::unit_test;
 #include "QNTreeWhiteBox.h"
 #include "CallCounter.h"
 #include "QAssertException.h"
+#include "SQFloat.h"
 
 using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
 using Kinesis::QuimeraEngine::Tools::Containers::QNTree;
 using Kinesis::QuimeraEngine::Tools::Containers::Test::QNTreeWhiteBox;
 using Kinesis::QuimeraEngine::Tools::Containers::EQTreeTraversalOrder;
+using Kinesis::QuimeraEngine::Tools::Containers::QContainerStatistics;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Common::DataTypes::float_q;
 
 
 QTEST_SUITE_BEGIN( QNTree_TestSuite )
@@ -937,6 +941,261 @@ QTEST_CASE ( Reserve_NothingHappensWhenTheAmountToReserveIsNoGreaterThanCurrentC
     BOOST_CHECK_EQUAL(pLocationOfElement, EXPECTED_LOCATION_OF_ELEMENT);
 }
 
+/// <summary>
+/// Checks that elements keep the same depth-first pre-order after compacting the tree.
+/// </summary>
+QTEST_CASE ( Compact_ElementsKeepTheirOrder_Test )
+{
+    //        0
+    //      / | \
+    //     1  4  6
+    //    / \    |
+    //   2   3   7
+
+    // [Preparation]
+    const int EXPECTED_ELEMENTS[] = { 0, 1, 2, 3, 4, 6, 7 };
+    const pointer_uint_q EXPECTED_COUNT = sizeof(EXPECTED_ELEMENTS) / sizeof(int);
+    QNTree<int> TREE(3, 10);
+    TREE.SetRootValue(0);
+    QNTree<int>::QNTreeIterator itRoot = TREE.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    TREE.AddChild(itRoot, 6);
+    TREE.AddChild(itRoot, 5);
+    TREE.InsertChild(itRoot, 4, 0);
+    TREE.RemoveChild(itRoot, 2);
+    TREE.InsertChild(itRoot, 1, 0);
+    TREE.AddChild(TREE.GetChild(itRoot, 0), 2);
+    TREE.AddChild(TREE.GetChild(itRoot, 2), 7);
+    TREE.AddChild(TREE.GetChild(itRoot, 0), 3);
+
+    // [Execution]
+    TREE.Compact(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+
+    // [Verification]
+    QNTree<int>::QConstNTreeIterator it = TREE.GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    pointer_uint_q uCount = 0;
+
+    for(; !it.IsEnd(); ++it, ++uCount)
+        BOOST_CHECK_EQUAL(*it, EXPECTED_ELEMENTS[uCount]);
+
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that parent and child relations are preserved when the tree is compacted.
+/// </summary>
+QTEST_CASE ( Compact_RelationsBetweenNodesArePreserved_Test )
+{
+    //      0
+    //     / \
+    //    1   2
+    //        |
+    //        3
+
+    // [Preparation]
+    const int EXPECTED_ROOT = 0;
+    const int EXPECTED_FIRST_CHILD = 1;
+    const int EXPECTED_SECOND_CHILD = 2;
+    const int EXPECTED_GRANDCHILD = 3;
+    const pointer_uint_q EXPECTED_CHILD_COUNT = 2;
+    QNTree<int> TREE(2, 8);
+    TREE.SetRootValue(EXPECTED_ROOT);
+    QNTree<int>::QNTreeIterator itRoot = TREE.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    TREE.AddChild(itRoot, EXPECTED_SECOND_CHILD);
+    TREE.AddChild(TREE.GetChild(itRoot, 0), EXPECTED_GRANDCHILD);
+    TREE.InsertChild(itRoot, EXPECTED_FIRST_CHILD, 0);
+
+    // [Execution]
+    TREE.Compact(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+
+    // [Verification]
+    itRoot = TREE.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    QNTree<int>::QNTreeIterator itFirstChild = TREE.GetChild(itRoot, 0);
+    QNTree<int>::QNTreeIterator itSecondChild = TREE.GetChild(itRoot, 1);
+    QNTree<int>::QNTreeIterator itGrandchild = TREE.GetChild(itSecondChild, 0);
+    QNTree<int>::QNTreeIterator itParentOfGrandchild = TREE.GetParent(itGrandchild);
+    pointer_uint_q uChildCount = TREE.GetChildrenCount(itRoot);
+
+    BOOST_CHECK_EQUAL(*itRoot, EXPECTED_ROOT);
+    BOOST_CHECK_EQUAL(*itFirstChild, EXPECTED_FIRST_CHILD);
+    BOOST_CHECK_EQUAL(*itSecondChild, EXPECTED_SECOND_CHILD);
+    BOOST_CHECK_EQUAL(*itGrandchild, EXPECTED_GRANDCHILD);
+    BOOST_CHECK(itParentOfGrandchild == itSecondChild);
+    BOOST_CHECK_EQUAL(uChildCount, EXPECTED_CHILD_COUNT);
+}
+
+/// <summary>
+/// Checks that elements are stored in consecutive memory positions, in the same order they are traversed.
+/// </summary>
+QTEST_CASE ( Compact_ElementsAreStoredInTraversalOrder_Test )
+{
+    // [Preparation]
+    const bool ELEMENTS_ARE_IN_TRAVERSAL_ORDER = true;
+    QNTree<int> TREE(3, 10);
+    TREE.SetRootValue(0);
+    QNTree<int>::QNTreeIterator itRoot = TREE.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    TREE.AddChild(itRoot, 3);
+    TREE.AddChild(itRoot, 9);
+    TREE.InsertChild(itRoot, 1, 0);
+    TREE.AddChild(TREE.GetChild(itRoot, 0), 2);
+    TREE.RemoveChild(itRoot, 2);
+    TREE.AddChild(TREE.GetChild(itRoot, 1), 4);
+
+    // [Execution]
+    TREE.Compact(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+
+    // [Verification]
+    const int* pBasePointer = scast_q(TREE.GetAllocator()->GetPointer(), const int*);
+    bool bElementsAreInTraversalOrder = true;
+    pointer_uint_q i = 0;
+
+    for(QNTree<int>::QConstNTreeIterator it = TREE.GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder); !it.IsEnd(); ++it, ++i)
+        bElementsAreInTraversalOrder = bElementsAreInTraversalOrder && &*it == pBasePointer + i;
+
+    BOOST_CHECK_EQUAL(bElementsAreInTraversalOrder, ELEMENTS_ARE_IN_TRAVERSAL_ORDER);
+}
+
+/// <summary>
+/// Checks that the capacity is reduced to the number of elements.
+/// </summary>
+QTEST_CASE ( Compact_CapacityIsReducedToTheNumberOfElements_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 3;
+    QNTree<int> TREE(2, 10);
+    TREE.SetRootValue(0);
+    TREE.AddChild(TREE.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder), 1);
+    TREE.AddChild(TREE.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder), 2);
+
+    // [Execution]
+    TREE.Compact(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+
+    // [Verification]
+    pointer_uint_q uCapacity = TREE.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the capacity of an empty tree is reduced to one element.
+/// </summary>
+QTEST_CASE ( Compact_CapacityOfEmptyTreeIsReducedToOneElement_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 1;
+    QNTree<int> TREE(2, 10);
+
+    // [Execution]
+    TREE.Compact(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+
+    // [Verification]
+    pointer_uint_q uCapacity = TREE.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the returned value equals the number of bytes released by both the element and the node allocators.
+/// </summary>
+QTEST_CASE ( Compact_ReturnsTheNumberOfReleasedBytes_Test )
+{
+    // [Preparation]
+    QNTreeWhiteBox<int> TREE(2, 10);
+    TREE.SetRootValue(0);
+    TREE.AddChild(TREE.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder), 1);
+    const pointer_uint_q ORIGINAL_SIZE = TREE.GetAllocator()->GetPoolSize() + TREE.GetNodeAllocator().GetPoolSize();
+
+    // [Execution]
+    pointer_uint_q uReleasedBytes = TREE.Compact(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+
+    // [Verification]
+    const pointer_uint_q EXPECTED_RELEASED_BYTES = ORIGINAL_SIZE - TREE.GetAllocator()->GetPoolSize() - TREE.GetNodeAllocator().GetPoolSize();
+    const pointer_uint_q ZERO = 0;
+    BOOST_CHECK_EQUAL(uReleasedBytes, EXPECTED_RELEASED_BYTES);
+    BOOST_CHECK_NE(uReleasedBytes, ZERO);
+}
+
+/// <summary>
+/// Checks that elements can be added after compacting the tree.
+/// </summary>
+QTEST_CASE ( Compact_ElementsCanBeAddedAfterCompacting_Test )
+{
+    // [Preparation]
+    const int EXPECTED_ELEMENTS[] = { 0, 1, 3, 2 };
+    const pointer_uint_q EXPECTED_COUNT = sizeof(EXPECTED_ELEMENTS) / sizeof(int);
+    QNTree<int> TREE(2, 10);
+    TREE.SetRootValue(0);
+    TREE.AddChild(TREE.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder), 2);
+    TREE.InsertChild(TREE.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder), 1, 0);
+    TREE.Compact(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+
+    // [Execution]
+    TREE.AddChild(TREE.GetChild(TREE.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder), 0), 3);
+
+    // [Verification]
+    QNTree<int>::QConstNTreeIterator it = TREE.GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    pointer_uint_q uCount = 0;
+
+    for(; !it.IsEnd(); ++it, ++uCount)
+        BOOST_CHECK_EQUAL(*it, EXPECTED_ELEMENTS[uCount]);
+
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that neither copy constructors nor destructors are called.
+/// </summary>
+QTEST_CASE ( Compact_NoCopyConstructorsNorDestructorsAreCalled_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CALLS = 0;
+    QNTree<CallCounter> TREE(2, 10);
+    TREE.SetRootValue(CallCounter());
+    TREE.AddChild(TREE.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder), CallCounter());
+    TREE.InsertChild(TREE.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder), CallCounter(), 0);
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    TREE.Compact(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+
+    // [Verification]
+    pointer_uint_q uCopyConstructorCalls = CallCounter::GetCopyConstructorCallsCount();
+    pointer_uint_q uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    pointer_uint_q uAssignmentCalls = CallCounter::GetAssignmentCallsCount();
+    BOOST_CHECK_EQUAL(uCopyConstructorCalls, EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_CALLS);
+    BOOST_CHECK_EQUAL(uAssignmentCalls, EXPECTED_CALLS);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the traversal order is not supported.
+/// </summary>
+QTEST_CASE ( Compact_AssertionFailsWhenTraversalOrderIsNotSupported_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QNTree<int> TREE(2, 10);
+    TREE.SetRootValue(0);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        TREE.Compact(EQTreeTraversalOrder::E_DepthFirstInOrder);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
 /// <summary>
 /// Checks that the element is correctly copied when the tree is empty.
 /// </summary>
@@ -3771,6 +4030,194 @@ QTEST_CASE ( IsEmpty_ReturnsFalseWhenTreeIsNotEmpty_Test )
     BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
 }
 
+/// <summary>
+/// Checks that the element is constructed in place, calling the default constructor and not the copy constructor.
+/// </summary>
+QTEST_CASE ( EmplaceChild1_ElementIsDefaultConstructedWithoutCallingCopyConstructor_Test )
+{
+    using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+    // [Preparation]
+    const unsigned int EXPECTED_CONSTRUCTOR_CALLS = 1U;
+    const unsigned int EXPECTED_COPY_CONSTRUCTOR_CALLS = 0;
+    const pointer_uint_q EXPECTED_COUNT = 2U;
+    QNTree<CallCounter> TREE(3, 3);
+    TREE.SetRootValue(CallCounter());
+    QNTree<CallCounter>::QNTreeIterator itParent = TREE.GetIterator(0, EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    QNTree<CallCounter>::QNTreeIterator itChild = TREE.EmplaceChild(itParent);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(CallCounter::GetConstructorCallsCount(), EXPECTED_CONSTRUCTOR_CALLS);
+    BOOST_CHECK_EQUAL(CallCounter::GetCopyConstructorCallsCount(), EXPECTED_COPY_CONSTRUCTOR_CALLS);
+    BOOST_CHECK_EQUAL(TREE.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK(!itChild.IsEnd());
+}
+
+/// <summary>
+/// Checks that the input argument is passed to the constructor of the element and that the element is added as the last child.
+/// </summary>
+QTEST_CASE ( EmplaceChild2_ArgumentIsPassedToTheConstructorAndElementIsTheLastChild_Test )
+{
+    // [Preparation]
+    const char EXPECTED_VALUES[] = {'A', 'B', 'C'};
+    QNTree<char> TREE(3, 3);
+    TREE.SetRootValue('A');
+    QNTree<char>::QNTreeIterator itParent = TREE.GetIterator(0, EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    TREE.AddChild(itParent, 'B');
+
+    // [Execution]
+    QNTree<char>::QNTreeIterator itChild = TREE.EmplaceChild(itParent, 'C');
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+
+    QNTree<char>::QNTreeIterator it = TREE.GetIterator(0, EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    int i = 0;
+
+    for(; !it.IsEnd(); ++it, ++i)
+        bResultIsWhatEspected = bResultIsWhatEspected && *it == EXPECTED_VALUES[i];
+
+    BOOST_CHECK(bResultIsWhatEspected);
+    BOOST_CHECK_EQUAL(*itChild, EXPECTED_VALUES[2]);
+}
+
+/// <summary>
+/// Checks that all the input arguments are passed to the constructor of the element, in the same order.
+/// </summary>
+QTEST_CASE ( EmplaceChild3_ArgumentsArePassedToTheConstructorInTheSameOrder_Test )
+{
+    using Kinesis::QuimeraEngine::Common::DataTypes::string_q;
+
+    // [Preparation]
+    const string_q EXPECTED_VALUE("ABC");
+    QNTree<string_q> TREE(3, 3);
+    TREE.SetRootValue("XYZ");
+    QNTree<string_q>::QNTreeIterator itParent = TREE.GetIterator(0, EQTreeTraversalOrder::E_DepthFirstPreOrder);
+
+    // [Execution]
+    QNTree<string_q>::QNTreeIterator itChild = TREE.EmplaceChild(itParent, "ABCDEF", 3);
+
+    // [Verification]
+    BOOST_CHECK(*itChild == EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the height and the average depth of the nodes are correct when a node has siblings after a deep subtree.
+/// </summary>
+QTEST_CASE ( GetStatistics_HeightAndAverageDepthAreCorrect_Test )
+{
+    //      0
+    //     / \
+    //    1   2
+    //    |
+    //    3
+    //    |
+    //    4
+
+    // [Preparation]
+    const pointer_uint_q EXPECTED_COUNT = 5U;
+    const pointer_uint_q EXPECTED_HEIGHT = 4U;
+    const float_q EXPECTED_AVERAGE_DEPTH = scast_q(7, float_q) / scast_q(EXPECTED_COUNT, float_q);
+    QNTree<int> TREE(2, 8);
+    TREE.SetRootValue(0);
+    QNTree<int>::QNTreeIterator itRoot = TREE.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    TREE.AddChild(itRoot, 1);
+    TREE.AddChild(itRoot, 2);
+    QNTree<int>::QNTreeIterator itFirstChild = TREE.GetChild(itRoot, 0);
+    TREE.AddChild(itFirstChild, 3);
+    TREE.AddChild(TREE.GetChild(itFirstChild, 0), 4);
+
+    // [Execution]
+    QContainerStatistics statistics = TREE.GetStatistics();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(statistics.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(statistics.GetHeight(), EXPECTED_HEIGHT);
+    BOOST_CHECK_EQUAL(statistics.GetAverageDepth(), EXPECTED_AVERAGE_DEPTH);
+}
+
+/// <summary>
+/// Checks that the height is one and the average depth is zero when the tree only contains the root node.
+/// </summary>
+QTEST_CASE ( GetStatistics_HeightIsOneWhenTreeOnlyContainsRoot_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_HEIGHT = 1U;
+    const float_q EXPECTED_AVERAGE_DEPTH = SQFloat::_0;
+    QNTree<int> TREE(2, 8);
+    TREE.SetRootValue(0);
+
+    // [Execution]
+    QContainerStatistics statistics = TREE.GetStatistics();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(statistics.GetHeight(), EXPECTED_HEIGHT);
+    BOOST_CHECK_EQUAL(statistics.GetAverageDepth(), EXPECTED_AVERAGE_DEPTH);
+}
+
+/// <summary>
+/// Checks that the height is zero and no bytes are used when the tree is empty.
+/// </summary>
+QTEST_CASE ( GetStatistics_HeightIsZeroWhenTreeIsEmpty_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_HEIGHT = 0;
+    const pointer_uint_q EXPECTED_USED_BYTES = 0;
+    QNTree<int> TREE(2, 8);
+
+    // [Execution]
+    QContainerStatistics statistics = TREE.GetStatistics();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(statistics.GetHeight(), EXPECTED_HEIGHT);
+    BOOST_CHECK_EQUAL(statistics.GetUsedBytes(), EXPECTED_USED_BYTES);
+    BOOST_CHECK(statistics.GetReservedBytes() > 0);
+}
+
+
+/// <summary>
+/// Checks that the capacity is reduced to the number of elements and the relations between nodes are preserved.
+/// </summary>
+QTEST_CASE ( ShrinkToFit_CapacityIsReducedAndRelationsBetweenNodesArePreserved_Test )
+{
+    //      0
+    //     / \
+    //    1   2
+    //    |
+    //    3
+
+    // [Preparation]
+    const int EXPECTED_ELEMENTS[] = { 0, 1, 3, 2 };
+    const pointer_uint_q EXPECTED_COUNT = sizeof(EXPECTED_ELEMENTS) / sizeof(int);
+    const pointer_uint_q EXPECTED_CAPACITY = EXPECTED_COUNT;
+    QNTree<int> TREE(2, 10);
+    TREE.SetRootValue(0);
+    QNTree<int>::QNTreeIterator itRoot = TREE.GetRoot(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    TREE.AddChild(itRoot, 1);
+    TREE.AddChild(itRoot, 5);
+    TREE.RemoveChild(itRoot, 1);
+    TREE.AddChild(itRoot, 2);
+    TREE.AddChild(TREE.GetChild(itRoot, 0), 3);
+
+    // [Execution]
+    TREE.ShrinkToFit();
+
+    // [Verification]
+    QNTree<int>::QConstNTreeIterator it = TREE.GetFirst(EQTreeTraversalOrder::E_DepthFirstPreOrder);
+    pointer_uint_q uCount = 0;
+
+    for(; !it.IsEnd(); ++it, ++uCount)
+        BOOST_CHECK_EQUAL(*it, EXPECTED_ELEMENTS[uCount]);
+
+    pointer_uint_q uCapacity = TREE.GetCapacity();
+    BOOST_CHECK_EQUAL(uCount, EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+
 // End - Test Suite: QNTree
 
 QTEST_SUITE_END()
@@ -0,0 +1,554 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QPriorityQueue.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QPriorityQueue;
+using Kinesis::QuimeraEngine::Tools::Containers::QArrayDynamic;
+using Kinesis::QuimeraEngine::Tools::Containers::SQComparatorDefault;
+using Kinesis::QuimeraEngine::Common::Memory::QPoolAllocator;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+
+/// <summary>
+/// A priority queue whose elements have up to 4 children.
+/// </summary>
+typedef QPriorityQueue<u32_q, QPoolAllocator, SQComparatorDefault<u32_q>, 4U> QPriorityQueue_Test_QuaternaryQueue;
+
+/// <summary>
+/// Adds pseudo-random numbers to a queue, extracts all of them and checks whether they were extracted in ascending order.
+/// </summary>
+/// <typeparam name="QueueT">The type of the queue.</typeparam>
+/// <param name="queue">[IN/OUT] An empty queue.</param>
+/// <returns>
+/// True if all the numbers were extracted in ascending order; False otherwise.
+/// </returns>
+template<class QueueT>
+static bool QPriorityQueue_Test_ElementsAreExtractedInAscendingOrder(QueueT &queue)
+{
+    const u32_q NUMBER_OF_ELEMENTS = 500U;
+    u32_q uRandom = 7U;
+
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        uRandom = uRandom * 1664525U + 1013904223U;
+        queue.Push((uRandom >> 8U) % 1000U);
+    }
+
+    bool bOrderIsCorrect = queue.GetCount() == NUMBER_OF_ELEMENTS;
+    u32_q uPreviousElement = 0;
+
+    while(!queue.IsEmpty())
+    {
+        bOrderIsCorrect = bOrderIsCorrect && queue.GetTop() >= uPreviousElement;
+        uPreviousElement = queue.GetTop();
+        queue.Pop();
+    }
+
+    return bOrderIsCorrect;
+}
+
+
+QTEST_SUITE_BEGIN( QPriorityQueue_TestSuite )
+
+/// <summary>
+/// Checks that the queue is empty after being created.
+/// </summary>
+QTEST_CASE ( Constructor1_QueueIsEmpty_Test )
+{
+    // [Preparation]
+    const bool IS_EMPTY = true;
+
+    // [Execution]
+    QPriorityQueue<u32_q> queue;
+
+    // [Verification]
+    bool bIsEmpty = queue.IsEmpty();
+    BOOST_CHECK_EQUAL(bIsEmpty, IS_EMPTY);
+}
+
+/// <summary>
+/// Checks that the capacity is the expected one.
+/// </summary>
+QTEST_CASE ( Constructor2_CapacityIsCorrect_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 20U;
+
+    // [Execution]
+    QPriorityQueue<u32_q> queue(EXPECTED_CAPACITY);
+
+    // [Verification]
+    pointer_uint_q uCapacity = queue.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when every element can only have one child.
+/// </summary>
+QTEST_CASE ( Constructor1_AssertionFailsWhenArityIsOne_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        QPriorityQueue<u32_q, QPoolAllocator, SQComparatorDefault<u32_q>, 1U> queue;
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the top element is always the lowest one added.
+/// </summary>
+QTEST_CASE ( Push_TopIsTheLowestElement_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_TOP_AFTER_FIRST = 5U;
+    const u32_q EXPECTED_TOP_AFTER_GREATER = 5U;
+    const u32_q EXPECTED_TOP_AFTER_LOWER = 2U;
+    QPriorityQueue<u32_q> queue;
+
+    // [Execution]
+    queue.Push(5U);
+    u32_q uTopAfterFirst = queue.GetTop();
+    queue.Push(8U);
+    u32_q uTopAfterGreater = queue.GetTop();
+    queue.Push(2U);
+    u32_q uTopAfterLower = queue.GetTop();
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uTopAfterFirst, EXPECTED_TOP_AFTER_FIRST);
+    BOOST_CHECK_EQUAL(uTopAfterGreater, EXPECTED_TOP_AFTER_GREATER);
+    BOOST_CHECK_EQUAL(uTopAfterLower, EXPECTED_TOP_AFTER_LOWER);
+}
+
+/// <summary>
+/// Checks that the returned handles refer to the added elements.
+/// </summary>
+QTEST_CASE ( Push_ReturnedHandlesReferToTheAddedElements_Test )
+{
+    // [Preparation]
+    const u32_q ELEMENT_A = 30U;
+    const u32_q ELEMENT_B = 10U;
+    const u32_q ELEMENT_C = 20U;
+    QPriorityQueue<u32_q> queue;
+
+    // [Execution]
+    pointer_uint_q uHandleA = queue.Push(ELEMENT_A);
+    pointer_uint_q uHandleB = queue.Push(ELEMENT_B);
+    pointer_uint_q uHandleC = queue.Push(ELEMENT_C);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue.GetValue(uHandleA), ELEMENT_A);
+    BOOST_CHECK_EQUAL(queue.GetValue(uHandleB), ELEMENT_B);
+    BOOST_CHECK_EQUAL(queue.GetValue(uHandleC), ELEMENT_C);
+    BOOST_CHECK_EQUAL(queue.GetTopHandle(), uHandleB);
+}
+
+/// <summary>
+/// Checks that elements are extracted in ascending order.
+/// </summary>
+QTEST_CASE ( Pop_ElementsAreExtractedInAscendingOrder_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_ORDER_IS_CORRECT = true;
+    QPriorityQueue<u32_q> queue;
+
+    // [Execution]
+    bool bOrderIsCorrect = QPriorityQueue_Test_ElementsAreExtractedInAscendingOrder(queue);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bOrderIsCorrect, EXPECTED_ORDER_IS_CORRECT);
+}
+
+/// <summary>
+/// Checks that elements are extracted in ascending order when every element can have 4 children.
+/// </summary>
+QTEST_CASE ( Pop_ElementsAreExtractedInAscendingOrderWhenHeapIsQuaternary_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_ORDER_IS_CORRECT = true;
+    QPriorityQueue_Test_QuaternaryQueue queue;
+
+    // [Execution]
+    bool bOrderIsCorrect = QPriorityQueue_Test_ElementsAreExtractedInAscendingOrder(queue);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bOrderIsCorrect, EXPECTED_ORDER_IS_CORRECT);
+}
+
+/// <summary>
+/// Checks that the handles of the remaining elements still refer to them after extracting the top element.
+/// </summary>
+QTEST_CASE ( Pop_HandlesOfRemainingElementsAreNotAffected_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_HANDLES_ARE_CORRECT = true;
+    const u32_q NUMBER_OF_ELEMENTS = 50U;
+    QPriorityQueue<u32_q> queue;
+    pointer_uint_q arHandles[NUMBER_OF_ELEMENTS];
+
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        arHandles[i] = queue.Push((i * 37U) % NUMBER_OF_ELEMENTS);
+
+    // [Execution]
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS / 2U; ++i)
+        queue.Pop();
+
+    // [Verification]
+    bool bHandlesAreCorrect = true;
+
+    // The lowest half of the values has been extracted
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        const u32_q VALUE = (i * 37U) % NUMBER_OF_ELEMENTS;
+
+        if(VALUE >= NUMBER_OF_ELEMENTS / 2U)
+            bHandlesAreCorrect = bHandlesAreCorrect && queue.GetValue(arHandles[i]) == VALUE;
+    }
+
+    BOOST_CHECK_EQUAL(bHandlesAreCorrect, EXPECTED_HANDLES_ARE_CORRECT);
+}
+
+/// <summary>
+/// Checks that the handle of an extracted element is reused by the next added element.
+/// </summary>
+QTEST_CASE ( Pop_HandleOfExtractedElementIsReused_Test )
+{
+    // [Preparation]
+    QPriorityQueue<u32_q> queue;
+    queue.Push(3U);
+    const pointer_uint_q EXPECTED_HANDLE = queue.Push(1U);
+    queue.Push(2U);
+
+    // [Execution]
+    queue.Pop();
+    pointer_uint_q uHandle = queue.Push(4U);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHandle, EXPECTED_HANDLE);
+    BOOST_CHECK_EQUAL(queue.GetValue(uHandle), 4U);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the queue is empty.
+/// </summary>
+QTEST_CASE ( Pop_AssertionFailsWhenQueueIsEmpty_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QPriorityQueue<u32_q> queue;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        queue.Pop();
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that an element becomes the top when its value is decreased below the others.
+/// </summary>
+QTEST_CASE ( DecreaseKey_ElementBecomesTopWhenItIsTheLowest_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_TOP = 1U;
+    QPriorityQueue<u32_q> queue;
+    queue.Push(10U);
+    queue.Push(20U);
+    pointer_uint_q uHandle = queue.Push(30U);
+    queue.Push(40U);
+
+    // [Execution]
+    queue.DecreaseKey(uHandle, EXPECTED_TOP);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue.GetTop(), EXPECTED_TOP);
+    BOOST_CHECK_EQUAL(queue.GetTopHandle(), uHandle);
+}
+
+/// <summary>
+/// Checks that elements are still extracted in ascending order after decreasing several of them.
+/// </summary>
+QTEST_CASE ( DecreaseKey_ElementsAreExtractedInAscendingOrderAfterDecreasingThem_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_ORDER_IS_CORRECT = true;
+    const u32_q NUMBER_OF_ELEMENTS = 100U;
+    QPriorityQueue_Test_QuaternaryQueue queue;
+    pointer_uint_q arHandles[NUMBER_OF_ELEMENTS];
+
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        arHandles[i] = queue.Push(1000U + i);
+
+    // [Execution]
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; i += 3U)
+        queue.DecreaseKey(arHandles[i], (i * 7U) % NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    bool bOrderIsCorrect = true;
+    u32_q uPreviousElement = 0;
+
+    while(!queue.IsEmpty())
+    {
+        bOrderIsCorrect = bOrderIsCorrect && queue.GetTop() >= uPreviousElement;
+        uPreviousElement = queue.GetTop();
+        queue.Pop();
+    }
+
+    BOOST_CHECK_EQUAL(bOrderIsCorrect, EXPECTED_ORDER_IS_CORRECT);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the new value is greater than the current one.
+/// </summary>
+QTEST_CASE ( DecreaseKey_AssertionFailsWhenNewValueIsGreater_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QPriorityQueue<u32_q> queue;
+    pointer_uint_q uHandle = queue.Push(5U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        queue.DecreaseKey(uHandle, 6U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the handle belongs to an element that has been extracted.
+/// </summary>
+QTEST_CASE ( DecreaseKey_AssertionFailsWhenHandleIsNotValid_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QPriorityQueue<u32_q> queue;
+    pointer_uint_q uHandle = queue.Push(1U);
+    queue.Push(2U);
+    queue.Pop();
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        queue.DecreaseKey(uHandle, 0U);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the elements of the array are extracted in ascending order.
+/// </summary>
+QTEST_CASE ( Heapify_ElementsAreExtractedInAscendingOrder_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_ORDER_IS_CORRECT = true;
+    const u32_q NUMBER_OF_ELEMENTS = 101U;
+    QArrayDynamic<u32_q> arElements(NUMBER_OF_ELEMENTS);
+
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        arElements.Add((i * 53U) % NUMBER_OF_ELEMENTS);
+
+    QPriorityQueue_Test_QuaternaryQueue queue;
+
+    // [Execution]
+    queue.Heapify(arElements);
+
+    // [Verification]
+    bool bOrderIsCorrect = queue.GetCount() == NUMBER_OF_ELEMENTS;
+    u32_q uExpectedElement = 0;
+
+    while(!queue.IsEmpty())
+    {
+        bOrderIsCorrect = bOrderIsCorrect && queue.GetTop() == uExpectedElement;
+        ++uExpectedElement;
+        queue.Pop();
+    }
+
+    BOOST_CHECK_EQUAL(bOrderIsCorrect, EXPECTED_ORDER_IS_CORRECT);
+}
+
+/// <summary>
+/// Checks that the handle of every element is its index in the input array.
+/// </summary>
+QTEST_CASE ( Heapify_HandleOfEveryElementIsItsIndexInTheArray_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_HANDLES_ARE_CORRECT = true;
+    const u32_q NUMBER_OF_ELEMENTS = 20U;
+    QArrayDynamic<u32_q> arElements(NUMBER_OF_ELEMENTS);
+
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        arElements.Add(NUMBER_OF_ELEMENTS - i);
+
+    QPriorityQueue<u32_q> queue;
+
+    // [Execution]
+    queue.Heapify(arElements);
+
+    // [Verification]
+    bool bHandlesAreCorrect = true;
+
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        bHandlesAreCorrect = bHandlesAreCorrect && queue.GetValue(i) == arElements[i];
+
+    BOOST_CHECK_EQUAL(bHandlesAreCorrect, EXPECTED_HANDLES_ARE_CORRECT);
+}
+
+/// <summary>
+/// Checks that the previous elements of the queue are removed.
+/// </summary>
+QTEST_CASE ( Heapify_PreviousElementsAreRemoved_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_COUNT = 2U;
+    const u32_q EXPECTED_TOP = 8U;
+    QArrayDynamic<u32_q> arElements;
+    arElements.Add(9U);
+    arElements.Add(8U);
+    QPriorityQueue<u32_q> queue;
+    queue.Push(1U);
+    queue.Push(2U);
+    queue.Push(3U);
+
+    // [Execution]
+    queue.Heapify(arElements);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(queue.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(queue.GetTop(), EXPECTED_TOP);
+}
+
+/// <summary>
+/// Checks that the queue is empty after clearing it and new elements can be added.
+/// </summary>
+QTEST_CASE ( Clear_QueueIsEmpty_Test )
+{
+    // [Preparation]
+    const bool IS_EMPTY = true;
+    const u32_q EXPECTED_TOP = 7U;
+    QPriorityQueue<u32_q> queue;
+    queue.Push(1U);
+    queue.Push(2U);
+    queue.Pop();
+
+    // [Execution]
+    queue.Clear();
+
+    // [Verification]
+    bool bIsEmpty = queue.IsEmpty();
+    queue.Push(EXPECTED_TOP);
+
+    BOOST_CHECK_EQUAL(bIsEmpty, IS_EMPTY);
+    BOOST_CHECK_EQUAL(queue.GetTop(), EXPECTED_TOP);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the queue is empty.
+/// </summary>
+QTEST_CASE ( GetTop_AssertionFailsWhenQueueIsEmpty_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QPriorityQueue<u32_q> queue;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        queue.GetTop();
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: QPriorityQueue
+QTEST_SUITE_END()
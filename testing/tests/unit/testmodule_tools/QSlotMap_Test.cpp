@@ -0,0 +1,408 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "QSlotMap.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::QSlotMap;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+
+QTEST_SUITE_BEGIN( QSlotMap_TestSuite )
+
+/// <summary>
+/// Checks that the slot map is empty after being created.
+/// </summary>
+QTEST_CASE ( Constructor1_SlotMapIsEmpty_Test )
+{
+    // [Preparation]
+    const bool IS_EMPTY = true;
+
+    // [Execution]
+    QSlotMap<u32_q> slotMap;
+
+    // [Verification]
+    bool bIsEmpty = slotMap.IsEmpty();
+    BOOST_CHECK_EQUAL(bIsEmpty, IS_EMPTY);
+}
+
+/// <summary>
+/// Checks that the capacity is the expected one.
+/// </summary>
+QTEST_CASE ( Constructor2_CapacityIsCorrect_Test )
+{
+    // [Preparation]
+    const pointer_uint_q EXPECTED_CAPACITY = 20U;
+
+    // [Execution]
+    QSlotMap<u32_q> slotMap(EXPECTED_CAPACITY);
+
+    // [Verification]
+    pointer_uint_q uCapacity = slotMap.GetCapacity();
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the returned handles refer to the added elements.
+/// </summary>
+QTEST_CASE ( Add_ReturnedHandlesReferToTheAddedElements_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_FIRST = 5U;
+    const u32_q EXPECTED_SECOND = 3U;
+    const u32_q EXPECTED_THIRD = 8U;
+    const pointer_uint_q EXPECTED_COUNT = 3U;
+    QSlotMap<u32_q> slotMap;
+
+    // [Execution]
+    u32_q uFirstHandle = slotMap.Add(EXPECTED_FIRST);
+    u32_q uSecondHandle = slotMap.Add(EXPECTED_SECOND);
+    u32_q uThirdHandle = slotMap.Add(EXPECTED_THIRD);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(slotMap.GetValue(uFirstHandle), EXPECTED_FIRST);
+    BOOST_CHECK_EQUAL(slotMap.GetValue(uSecondHandle), EXPECTED_SECOND);
+    BOOST_CHECK_EQUAL(slotMap.GetValue(uThirdHandle), EXPECTED_THIRD);
+    BOOST_CHECK_EQUAL(slotMap.GetCount(), EXPECTED_COUNT);
+}
+
+/// <summary>
+/// Checks that the returned handle is never the null handle.
+/// </summary>
+QTEST_CASE ( Add_ReturnedHandleIsNotNull_Test )
+{
+    // [Preparation]
+    QSlotMap<u32_q> slotMap;
+
+    // [Execution]
+    u32_q uHandle = slotMap.Add(0);
+
+    // [Verification]
+    BOOST_CHECK_NE(uHandle, QSlotMap<u32_q>::NULL_HANDLE);
+}
+
+/// <summary>
+/// Checks that handles keep referring to their elements after the slot map is reallocated.
+/// </summary>
+QTEST_CASE ( Add_HandlesAreNotAffectedByReallocations_Test )
+{
+    // [Preparation]
+    const u32_q NUMBER_OF_ELEMENTS = 100U;
+    const bool ALL_HANDLES_ARE_VALID = true;
+    QSlotMap<u32_q> slotMap(2U);
+    u32_q arHandles[NUMBER_OF_ELEMENTS];
+
+    // [Execution]
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        arHandles[i] = slotMap.Add(i);
+
+    // [Verification]
+    bool bAllHandlesAreValid = true;
+
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        bAllHandlesAreValid = bAllHandlesAreValid && slotMap.GetValue(arHandles[i]) == i;
+
+    BOOST_CHECK_EQUAL(bAllHandlesAreValid, ALL_HANDLES_ARE_VALID);
+}
+
+/// <summary>
+/// Checks that elements are stored contiguously, in the same order they were added.
+/// </summary>
+QTEST_CASE ( Add_ElementsAreStoredContiguously_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 5U, 3U, 8U };
+    QSlotMap<u32_q> slotMap;
+
+    // [Execution]
+    slotMap.Add(EXPECTED_ELEMENTS[0]);
+    slotMap.Add(EXPECTED_ELEMENTS[1]);
+    slotMap.Add(EXPECTED_ELEMENTS[2]);
+
+    // [Verification]
+    const u32_q* arElements = &slotMap.GetElements()[0];
+
+    BOOST_CHECK_EQUAL(arElements[0], EXPECTED_ELEMENTS[0]);
+    BOOST_CHECK_EQUAL(arElements[1], EXPECTED_ELEMENTS[1]);
+    BOOST_CHECK_EQUAL(arElements[2], EXPECTED_ELEMENTS[2]);
+}
+
+/// <summary>
+/// Checks that 64-bits handles refer to the added elements.
+/// </summary>
+QTEST_CASE ( Add_64BitsHandlesReferToTheAddedElements_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_FIRST = 5U;
+    const u32_q EXPECTED_SECOND = 3U;
+    QSlotMap<u32_q, u64_q> slotMap;
+
+    // [Execution]
+    u64_q uFirstHandle = slotMap.Add(EXPECTED_FIRST);
+    slotMap.Remove(uFirstHandle);
+    u64_q uSecondHandle = slotMap.Add(EXPECTED_SECOND);
+
+    // [Verification]
+    BOOST_CHECK(!slotMap.Contains(uFirstHandle));
+    BOOST_CHECK_EQUAL(slotMap.GetValue(uSecondHandle), EXPECTED_SECOND);
+}
+
+/// <summary>
+/// Checks that the last element fills the gap left by the removed one, so elements remain contiguous.
+/// </summary>
+QTEST_CASE ( Remove_LastElementIsMovedToThePositionOfTheRemovedOne_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ELEMENTS[] = { 8U, 3U };
+    const pointer_uint_q EXPECTED_COUNT = 2U;
+    QSlotMap<u32_q> slotMap;
+    u32_q uFirstHandle = slotMap.Add(5U);
+    slotMap.Add(EXPECTED_ELEMENTS[1]);
+    u32_q uThirdHandle = slotMap.Add(EXPECTED_ELEMENTS[0]);
+
+    // [Execution]
+    slotMap.Remove(uFirstHandle);
+
+    // [Verification]
+    const u32_q* arElements = &slotMap.GetElements()[0];
+
+    BOOST_CHECK_EQUAL(slotMap.GetCount(), EXPECTED_COUNT);
+    BOOST_CHECK_EQUAL(arElements[0], EXPECTED_ELEMENTS[0]);
+    BOOST_CHECK_EQUAL(arElements[1], EXPECTED_ELEMENTS[1]);
+    BOOST_CHECK_EQUAL(slotMap.GetHandleAt(0), uThirdHandle);
+}
+
+/// <summary>
+/// Checks that the handles of the remaining elements keep referring to them after a removal.
+/// </summary>
+QTEST_CASE ( Remove_HandlesOfRemainingElementsAreNotAffected_Test )
+{
+    // [Preparation]
+    const u32_q NUMBER_OF_ELEMENTS = 50U;
+    const bool ALL_HANDLES_ARE_VALID = true;
+    QSlotMap<u32_q> slotMap;
+    u32_q arHandles[NUMBER_OF_ELEMENTS];
+
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        arHandles[i] = slotMap.Add(i);
+
+    // [Execution]
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; i += 3U)
+        slotMap.Remove(arHandles[i]);
+
+    // [Verification]
+    bool bAllHandlesAreValid = true;
+
+    for(u32_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        if(i % 3U == 0)
+            bAllHandlesAreValid = bAllHandlesAreValid && !slotMap.Contains(arHandles[i]);
+        else
+            bAllHandlesAreValid = bAllHandlesAreValid && slotMap.GetValue(arHandles[i]) == i;
+    }
+
+    BOOST_CHECK_EQUAL(bAllHandlesAreValid, ALL_HANDLES_ARE_VALID);
+}
+
+/// <summary>
+/// Checks that the handle of a removed element is rejected even when its slot is reused by a new element.
+/// </summary>
+QTEST_CASE ( Remove_StaleHandleIsRejectedWhenSlotIsReused_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_VALUE = 7U;
+    const bool STALE_HANDLE_IS_VALID = false;
+    QSlotMap<u32_q> slotMap;
+    slotMap.Add(1U);
+    u32_q uStaleHandle = slotMap.Add(2U);
+
+    // [Execution]
+    slotMap.Remove(uStaleHandle);
+    u32_q uNewHandle = slotMap.Add(EXPECTED_VALUE);
+
+    // [Verification]
+    bool bStaleHandleIsValid = slotMap.Contains(uStaleHandle);
+
+    BOOST_CHECK_EQUAL(bStaleHandleIsValid, STALE_HANDLE_IS_VALID);
+    BOOST_CHECK_NE(uNewHandle, uStaleHandle);
+    BOOST_CHECK_EQUAL(slotMap.GetValue(uNewHandle), EXPECTED_VALUE);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the handle does not refer to any element.
+/// </summary>
+QTEST_CASE ( Remove_AssertionFailsWhenHandleIsNotValid_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QSlotMap<u32_q> slotMap;
+    u32_q uHandle = slotMap.Add(1U);
+    slotMap.Remove(uHandle);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        slotMap.Remove(uHandle);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the null handle is never contained.
+/// </summary>
+QTEST_CASE ( Contains_ReturnsFalseWhenHandleIsNull_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = false;
+    QSlotMap<u32_q> slotMap;
+    slotMap.Add(1U);
+
+    // [Execution]
+    bool bResult = slotMap.Contains(QSlotMap<u32_q>::NULL_HANDLE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that a handle whose slot is free is not contained, even if its generation matches the one of the slot.
+/// </summary>
+QTEST_CASE ( Contains_ReturnsFalseWhenSlotIsFreeAndGenerationMatches_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = false;
+    QSlotMap<u32_q> slotMap;
+    u32_q uHandle = slotMap.Add(1U);
+    slotMap.Remove(uHandle);
+
+    // The next handle of the slot would have the next generation
+    const u32_q NEXT_HANDLE = uHandle + (1U << 20U);
+
+    // [Execution]
+    bool bResult = slotMap.Contains(NEXT_HANDLE);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bResult, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that the value of an element can be modified through its handle.
+/// </summary>
+QTEST_CASE ( GetValue_ElementCanBeModified_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_VALUE = 9U;
+    QSlotMap<u32_q> slotMap;
+    u32_q uHandle = slotMap.Add(1U);
+
+    // [Execution]
+    slotMap.GetValue(uHandle) = EXPECTED_VALUE;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(slotMap.GetValue(uHandle), EXPECTED_VALUE);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the handle belongs to a removed element.
+/// </summary>
+QTEST_CASE ( GetValue_AssertionFailsWhenHandleIsStale_Test )
+{
+    // [Preparation]
+    const bool ASSERTION_FAILED = true;
+    QSlotMap<u32_q> slotMap;
+    u32_q uHandle = slotMap.Add(1U);
+    slotMap.Remove(uHandle);
+    slotMap.Add(2U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        slotMap.GetValue(uHandle);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that the slot map is empty after clearing it and previous handles are rejected.
+/// </summary>
+QTEST_CASE ( Clear_SlotMapIsEmptyAndHandlesAreRejected_Test )
+{
+    // [Preparation]
+    const bool IS_EMPTY = true;
+    const bool HANDLE_IS_VALID = false;
+    const u32_q EXPECTED_VALUE = 7U;
+    QSlotMap<u32_q> slotMap;
+    u32_q uFirstHandle = slotMap.Add(1U);
+    u32_q uSecondHandle = slotMap.Add(2U);
+
+    // [Execution]
+    slotMap.Clear();
+
+    // [Verification]
+    bool bIsEmpty = slotMap.IsEmpty();
+    bool bFirstHandleIsValid = slotMap.Contains(uFirstHandle);
+    bool bSecondHandleIsValid = slotMap.Contains(uSecondHandle);
+    u32_q uNewHandle = slotMap.Add(EXPECTED_VALUE);
+
+    BOOST_CHECK_EQUAL(bIsEmpty, IS_EMPTY);
+    BOOST_CHECK_EQUAL(bFirstHandleIsValid, HANDLE_IS_VALID);
+    BOOST_CHECK_EQUAL(bSecondHandleIsValid, HANDLE_IS_VALID);
+    BOOST_CHECK_EQUAL(slotMap.GetValue(uNewHandle), EXPECTED_VALUE);
+}
+
+// End - Test Suite: QSlotMap
+QTEST_SUITE_END()
@@ -0,0 +1,182 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "SQBulkElementOperations.h"
+
+#include "QVector3.h"
+#include "CallCounter.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::u8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Tools::Math::QVector3;
+using Kinesis::QuimeraEngine::Tools::Containers::SQBulkElementOperations;
+using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+
+QTEST_SUITE_BEGIN( SQBulkElementOperations_TestSuite )
+
+/// <summary>
+/// Checks that trivially copyable elements are correctly copied.
+/// </summary>
+QTEST_CASE ( CopyConstruct_TriviallyCopyableElementsAreCorrectlyCopied_Test )
+{
+    // [Preparation]
+    const u32_q SOURCE[] = { 1U, 2U, 3U, 4U, 5U };
+    const pointer_uint_q NUMBER_OF_ELEMENTS = sizeof(SOURCE) / sizeof(u32_q);
+    u32_q arDestination[NUMBER_OF_ELEMENTS] = { 0 };
+
+    // [Execution]
+    SQBulkElementOperations<u32_q>::CopyConstruct(arDestination, SOURCE, NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arDestination, arDestination + NUMBER_OF_ELEMENTS, SOURCE, SOURCE + NUMBER_OF_ELEMENTS);
+}
+
+/// <summary>
+/// Checks that math types, which are declared trivially copyable, are correctly copied.
+/// </summary>
+QTEST_CASE ( CopyConstruct_MathTypesAreCorrectlyCopied_Test )
+{
+    // [Preparation]
+    const QVector3 SOURCE[] = { QVector3(1.0f, 2.0f, 3.0f), QVector3(4.0f, 5.0f, 6.0f), QVector3(7.0f, 8.0f, 9.0f) };
+    const pointer_uint_q NUMBER_OF_ELEMENTS = sizeof(SOURCE) / sizeof(QVector3);
+    QVector3 arDestination[NUMBER_OF_ELEMENTS];
+
+    // [Execution]
+    SQBulkElementOperations<QVector3>::CopyConstruct(arDestination, SOURCE, NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    BOOST_CHECK(arDestination[0] == SOURCE[0]);
+    BOOST_CHECK(arDestination[1] == SOURCE[1]);
+    BOOST_CHECK(arDestination[2] == SOURCE[2]);
+}
+
+/// <summary>
+/// Checks that the copy constructor is called for every element when the type is not trivially copyable.
+/// </summary>
+QTEST_CASE ( CopyConstruct_CopyConstructorIsCalledForEveryElementWhenTypeIsNotTriviallyCopyable_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 3U;
+    const unsigned int EXPECTED_CALLS = 3U;
+    CallCounter arSource[NUMBER_OF_ELEMENTS];
+    u8_q arDestination[NUMBER_OF_ELEMENTS * sizeof(CallCounter)];
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    SQBulkElementOperations<CallCounter>::CopyConstruct(rcast_q(arDestination, CallCounter*), arSource, NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    unsigned int uCopyConstructorCalls = CallCounter::GetCopyConstructorCallsCount();
+    BOOST_CHECK_EQUAL(uCopyConstructorCalls, EXPECTED_CALLS);
+}
+
+/// <summary>
+/// Checks that nothing is copied when the number of elements is zero.
+/// </summary>
+QTEST_CASE ( CopyConstruct_NothingIsCopiedWhenNumberOfElementsIsZero_Test )
+{
+    // [Preparation]
+    const u32_q SOURCE[] = { 1U, 2U };
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 0U };
+    u32_q arDestination[] = { 0U, 0U };
+
+    // [Execution]
+    SQBulkElementOperations<u32_q>::CopyConstruct(arDestination, SOURCE, 0);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arDestination, arDestination + 2U, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + 2U);
+}
+
+/// <summary>
+/// Checks that trivially copyable elements are correctly assigned.
+/// </summary>
+QTEST_CASE ( Assign_TriviallyCopyableElementsAreCorrectlyAssigned_Test )
+{
+    // [Preparation]
+    const u32_q SOURCE[] = { 1U, 2U, 3U, 4U, 5U };
+    const pointer_uint_q NUMBER_OF_ELEMENTS = sizeof(SOURCE) / sizeof(u32_q);
+    u32_q arDestination[] = { 6U, 7U, 8U, 9U, 10U };
+
+    // [Execution]
+    SQBulkElementOperations<u32_q>::Assign(arDestination, SOURCE, NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arDestination, arDestination + NUMBER_OF_ELEMENTS, SOURCE, SOURCE + NUMBER_OF_ELEMENTS);
+}
+
+/// <summary>
+/// Checks that the assignment operator is called for every element when the type is not trivially copyable.
+/// </summary>
+QTEST_CASE ( Assign_AssignmentOperatorIsCalledForEveryElementWhenTypeIsNotTriviallyCopyable_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 3U;
+    const unsigned int EXPECTED_CALLS = 3U;
+    CallCounter arSource[NUMBER_OF_ELEMENTS];
+    CallCounter arDestination[NUMBER_OF_ELEMENTS];
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    SQBulkElementOperations<CallCounter>::Assign(arDestination, arSource, NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    unsigned int uAssignmentCalls = CallCounter::GetAssignmentCallsCount();
+    BOOST_CHECK_EQUAL(uAssignmentCalls, EXPECTED_CALLS);
+}
+
+/// <summary>
+/// Checks that the destructor is called for every element when the type is not trivially destructible.
+/// </summary>
+QTEST_CASE ( Destroy_DestructorIsCalledForEveryElementWhenTypeIsNotTriviallyDestructible_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 3U;
+    const unsigned int EXPECTED_CALLS = 3U;
+    u8_q arElements[NUMBER_OF_ELEMENTS * sizeof(CallCounter)];
+    CallCounter* pElements = rcast_q(arElements, CallCounter*);
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        new(pElements + i) CallCounter();
+
+    CallCounter::ResetCounters();
+
+    // [Execution]
+    SQBulkElementOperations<CallCounter>::Destroy(pElements, NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    unsigned int uDestructorCalls = CallCounter::GetDestructorCallsCount();
+    BOOST_CHECK_EQUAL(uDestructorCalls, EXPECTED_CALLS);
+}
+
+// End - Test Suite: SQBulkElementOperations
+QTEST_SUITE_END()
@@ -0,0 +1,133 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "SQFastIntegerHashProvider.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::SQFastIntegerHashProvider;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFastHash;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+
+
+QTEST_SUITE_BEGIN( SQFastIntegerHashProvider_TestSuite )
+
+/// <summary>
+/// Checks that the hash is the remainder of dividing the hash of the integer by the number of buckets.
+/// </summary>
+QTEST_CASE ( GenerateHashKey_ItReturnsTheRemainderOfTheHashOfTheInteger_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_VALUE = 123456U;
+    const pointer_uint_q NUMBER_OF_BUCKETS = 500U;
+    const pointer_uint_q EXPECTED_VALUE = scast_q(SQFastHash::HashInteger(INPUT_VALUE) % NUMBER_OF_BUCKETS, pointer_uint_q);
+
+    // [Execution]
+    pointer_uint_q uHashKey = SQFastIntegerHashProvider::GenerateHashKey(INPUT_VALUE, NUMBER_OF_BUCKETS);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHashKey, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that multiples of the number of buckets do not fall into the same bucket.
+/// </summary>
+QTEST_CASE ( GenerateHashKey_MultiplesOfTheNumberOfBucketsFallIntoDifferentBuckets_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_BUCKETS = 16U;
+    const u32_q NUMBER_OF_VALUES = 64U;
+    const u32_q MIN_EXPECTED_USED_BUCKETS = 12U;
+    bool arUsedBuckets[NUMBER_OF_BUCKETS] = { false };
+
+    // [Execution]
+    for(u32_q i = 0; i < NUMBER_OF_VALUES; ++i)
+        arUsedBuckets[SQFastIntegerHashProvider::GenerateHashKey(i * NUMBER_OF_BUCKETS, NUMBER_OF_BUCKETS)] = true;
+
+    // [Verification]
+    u32_q uUsedBuckets = 0;
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BUCKETS; ++i)
+        uUsedBuckets += arUsedBuckets[i] ? 1U : 0;
+
+    BOOST_CHECK(uUsedBuckets >= MIN_EXPECTED_USED_BUCKETS);
+}
+
+/// <summary>
+/// Checks that the same number produces the same hash regardless of its integer type.
+/// </summary>
+QTEST_CASE ( GenerateHash_SameNumberProducesSameHashRegardlessOfType_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_VALUE32 = 77U;
+    const u64_q INPUT_VALUE64 = 77U;
+
+    // [Execution]
+    u64_q uHash32 = SQFastIntegerHashProvider::GenerateHash(INPUT_VALUE32);
+    u64_q uHash64 = SQFastIntegerHashProvider::GenerateHash(INPUT_VALUE64);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHash32, uHash64);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the number of buckets is zero.
+/// </summary>
+QTEST_CASE ( GenerateHashKey_AssertionFailsWhenNumberOfBucketsIsZero_Test )
+{
+    // [Preparation]
+    const u32_q INPUT_VALUE = 5U;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQFastIntegerHashProvider::GenerateHashKey(INPUT_VALUE, 0);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+    
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+// End - Test Suite: SQFastIntegerHashProvider
+QTEST_SUITE_END()
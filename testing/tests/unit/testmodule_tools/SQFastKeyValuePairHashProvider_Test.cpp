@@ -0,0 +1,143 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "SQFastKeyValuePairHashProvider.h"
+#include "SQFastIntegerHashProvider.h"
+#include "SQFastStringHashProvider.h"
+#include "QKeyValuePair.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::SQFastKeyValuePairHashProvider;
+using Kinesis::QuimeraEngine::Tools::Containers::SQFastIntegerHashProvider;
+using Kinesis::QuimeraEngine::Tools::Containers::SQFastStringHashProvider;
+using Kinesis::QuimeraEngine::Tools::Containers::QKeyValuePair;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+
+/// <summary>
+/// Hash provider for pairs whose key is a string and whose value is an integer.
+/// </summary>
+typedef SQFastKeyValuePairHashProvider<SQFastStringHashProvider, SQFastIntegerHashProvider> SQFastKeyValuePairHashProvider_Test_Provider;
+
+
+QTEST_SUITE_BEGIN( SQFastKeyValuePairHashProvider_TestSuite )
+
+/// <summary>
+/// Checks that equal pairs produce the same hash and pairs that differ in either the key or the value produce different hashes.
+/// </summary>
+QTEST_CASE ( GenerateHash_EqualPairsProduceSameHash_Test )
+{
+    // [Preparation]
+    const QKeyValuePair<string_q, u32_q> PAIR_A(string_q("key"), 1U);
+    const QKeyValuePair<string_q, u32_q> PAIR_B(string_q("key"), 1U);
+    const QKeyValuePair<string_q, u32_q> PAIR_C(string_q("key"), 2U);
+    const QKeyValuePair<string_q, u32_q> PAIR_D(string_q("kez"), 1U);
+
+    // [Execution]
+    u64_q uHashA = SQFastKeyValuePairHashProvider_Test_Provider::GenerateHash(PAIR_A);
+    u64_q uHashB = SQFastKeyValuePairHashProvider_Test_Provider::GenerateHash(PAIR_B);
+    u64_q uHashC = SQFastKeyValuePairHashProvider_Test_Provider::GenerateHash(PAIR_C);
+    u64_q uHashD = SQFastKeyValuePairHashProvider_Test_Provider::GenerateHash(PAIR_D);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHashA, uHashB);
+    BOOST_CHECK(uHashA != uHashC);
+    BOOST_CHECK(uHashA != uHashD);
+}
+
+/// <summary>
+/// Checks that pairs whose key and value are swapped produce different hashes.
+/// </summary>
+QTEST_CASE ( GenerateHash_SwappedKeyAndValueProduceDifferentHashes_Test )
+{
+    // [Preparation]
+    typedef SQFastKeyValuePairHashProvider<SQFastIntegerHashProvider, SQFastIntegerHashProvider> ProviderType;
+    const QKeyValuePair<u32_q, u32_q> PAIR_A(1U, 2U);
+    const QKeyValuePair<u32_q, u32_q> PAIR_B(2U, 1U);
+
+    // [Execution]
+    u64_q uHashA = ProviderType::GenerateHash(PAIR_A);
+    u64_q uHashB = ProviderType::GenerateHash(PAIR_B);
+
+    // [Verification]
+    BOOST_CHECK(uHashA != uHashB);
+}
+
+/// <summary>
+/// Checks that the hash key is the remainder of dividing the hash of the pair by the number of buckets.
+/// </summary>
+QTEST_CASE ( GenerateHashKey_ItReturnsTheRemainderOfTheHashOfThePair_Test )
+{
+    // [Preparation]
+    const QKeyValuePair<string_q, u32_q> INPUT_VALUE(string_q("key"), 1U);
+    const pointer_uint_q NUMBER_OF_BUCKETS = 500U;
+    const pointer_uint_q EXPECTED_VALUE = scast_q(SQFastKeyValuePairHashProvider_Test_Provider::GenerateHash(INPUT_VALUE) % NUMBER_OF_BUCKETS, pointer_uint_q);
+
+    // [Execution]
+    pointer_uint_q uHashKey = SQFastKeyValuePairHashProvider_Test_Provider::GenerateHashKey(INPUT_VALUE, NUMBER_OF_BUCKETS);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHashKey, EXPECTED_VALUE);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the number of buckets is zero.
+/// </summary>
+QTEST_CASE ( GenerateHashKey_AssertionFailsWhenNumberOfBucketsIsZero_Test )
+{
+    // [Preparation]
+    const QKeyValuePair<string_q, u32_q> INPUT_VALUE(string_q("key"), 1U);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQFastKeyValuePairHashProvider_Test_Provider::GenerateHashKey(INPUT_VALUE, 0);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+    
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+// End - Test Suite: SQFastKeyValuePairHashProvider
+QTEST_SUITE_END()
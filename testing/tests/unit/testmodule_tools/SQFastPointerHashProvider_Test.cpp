@@ -0,0 +1,117 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "SQFastPointerHashProvider.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::SQFastPointerHashProvider;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+
+
+QTEST_SUITE_BEGIN( SQFastPointerHashProvider_TestSuite )
+
+/// <summary>
+/// Checks that the same address always produces the same hash, regardless of the type of the pointer.
+/// </summary>
+QTEST_CASE ( GenerateHash_SameAddressProducesSameHash_Test )
+{
+    // [Preparation]
+    u32_q uValue = 0;
+    const u32_q* INPUT_POINTER = &uValue;
+    const void* INPUT_VOID_POINTER = &uValue;
+
+    // [Execution]
+    u64_q uHash1 = SQFastPointerHashProvider::GenerateHash(INPUT_POINTER);
+    u64_q uHash2 = SQFastPointerHashProvider::GenerateHash(INPUT_VOID_POINTER);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHash1, uHash2);
+}
+
+/// <summary>
+/// Checks that the addresses of the elements of an array whose size is a power of two do not fall into the same bucket.
+/// </summary>
+QTEST_CASE ( GenerateHashKey_AlignedAddressesFallIntoDifferentBuckets_Test )
+{
+    // [Preparation]
+    struct Aligned64 { u64_q arPadding[8]; };
+    const pointer_uint_q NUMBER_OF_BUCKETS = 16U;
+    const u32_q MIN_EXPECTED_USED_BUCKETS = 12U;
+    static Aligned64 arElements[64];
+    bool arUsedBuckets[NUMBER_OF_BUCKETS] = { false };
+
+    // [Execution]
+    for(u32_q i = 0; i < 64U; ++i)
+        arUsedBuckets[SQFastPointerHashProvider::GenerateHashKey(&arElements[i], NUMBER_OF_BUCKETS)] = true;
+
+    // [Verification]
+    u32_q uUsedBuckets = 0;
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_BUCKETS; ++i)
+        uUsedBuckets += arUsedBuckets[i] ? 1U : 0;
+
+    BOOST_CHECK(uUsedBuckets >= MIN_EXPECTED_USED_BUCKETS);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the number of buckets is zero.
+/// </summary>
+QTEST_CASE ( GenerateHashKey_AssertionFailsWhenNumberOfBucketsIsZero_Test )
+{
+    // [Preparation]
+    u32_q uValue = 0;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQFastPointerHashProvider::GenerateHashKey(&uValue, 0);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+    
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+// End - Test Suite: SQFastPointerHashProvider
+QTEST_SUITE_END()
@@ -0,0 +1,123 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "DataTypesDefinitions.h"
+#include "SQFastStringHashProvider.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::SQFastStringHashProvider;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+
+
+QTEST_SUITE_BEGIN( SQFastStringHashProvider_TestSuite )
+
+/// <summary>
+/// Checks that the hash is the one calculated by the string.
+/// </summary>
+QTEST_CASE ( GenerateHash_ItReturnsTheHashOfTheString_Test )
+{
+    // [Preparation]
+    const string_q INPUT_VALUE("A text to be used to generate a hash key");
+    const u64_q EXPECTED_VALUE = INPUT_VALUE.GetHash();
+
+    // [Execution]
+    u64_q uHash = SQFastStringHashProvider::GenerateHash(INPUT_VALUE);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHash, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that the hash key is the remainder of dividing the hash of the string by the number of buckets.
+/// </summary>
+QTEST_CASE ( GenerateHashKey_ItReturnsTheRemainderOfTheHashOfTheString_Test )
+{
+    // [Preparation]
+    const string_q INPUT_VALUE("A text to be used to generate a hash key");
+    const pointer_uint_q NUMBER_OF_BUCKETS = 500U;
+    const pointer_uint_q EXPECTED_VALUE = scast_q(INPUT_VALUE.GetHash() % NUMBER_OF_BUCKETS, pointer_uint_q);
+
+    // [Execution]
+    pointer_uint_q uHashKey = SQFastStringHashProvider::GenerateHashKey(INPUT_VALUE, NUMBER_OF_BUCKETS);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHashKey, EXPECTED_VALUE);
+}
+
+/// <summary>
+/// Checks that empty strings produce a valid hash key.
+/// </summary>
+QTEST_CASE ( GenerateHashKey_ItReturnsValidKeyWhenInputIsEmpty_Test )
+{
+    // [Preparation]
+    const string_q INPUT_VALUE("");
+    const pointer_uint_q NUMBER_OF_BUCKETS = 4U;
+
+    // [Execution]
+    pointer_uint_q uHashKey = SQFastStringHashProvider::GenerateHashKey(INPUT_VALUE, NUMBER_OF_BUCKETS);
+    
+    // [Verification]
+    BOOST_CHECK(uHashKey < NUMBER_OF_BUCKETS);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the number of buckets is zero.
+/// </summary>
+QTEST_CASE ( GenerateHashKey_AssertionFailsWhenNumberOfBucketsIsZero_Test )
+{
+    // [Preparation]
+    const string_q INPUT_VALUE("Common text");
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQFastStringHashProvider::GenerateHashKey(INPUT_VALUE, 0);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+    
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+// End - Test Suite: SQFastStringHashProvider
+QTEST_SUITE_END()
@@ -0,0 +1,175 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "SQFastVectorHashProvider.h"
+#include "QVector2.h"
+#include "QVector3.h"
+#include "QVector4.h"
+#include "SQFloat.h"
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::SQFastVectorHashProvider;
+using Kinesis::QuimeraEngine::Tools::Math::QVector2;
+using Kinesis::QuimeraEngine::Tools::Math::QVector3;
+using Kinesis::QuimeraEngine::Tools::Math::QVector4;
+using Kinesis::QuimeraEngine::Common::DataTypes::SQFloat;
+using Kinesis::QuimeraEngine::Common::DataTypes::u64_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+
+
+QTEST_SUITE_BEGIN( SQFastVectorHashProvider_TestSuite )
+
+/// <summary>
+/// Checks that equal vectors produce the same hash and different vectors produce different hashes.
+/// </summary>
+QTEST_CASE ( GenerateHash1_EqualVectorsProduceSameHash_Test )
+{
+    // [Preparation]
+    const QVector2 VECTOR_A(SQFloat::_1, SQFloat::_2);
+    const QVector2 VECTOR_B(SQFloat::_1, SQFloat::_2);
+    const QVector2 VECTOR_C(SQFloat::_2, SQFloat::_1);
+
+    // [Execution]
+    u64_q uHashA = SQFastVectorHashProvider::GenerateHash(VECTOR_A);
+    u64_q uHashB = SQFastVectorHashProvider::GenerateHash(VECTOR_B);
+    u64_q uHashC = SQFastVectorHashProvider::GenerateHash(VECTOR_C);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHashA, uHashB);
+    BOOST_CHECK(uHashA != uHashC);
+}
+
+/// <summary>
+/// Checks that equal vectors produce the same hash and different vectors produce different hashes.
+/// </summary>
+QTEST_CASE ( GenerateHash2_EqualVectorsProduceSameHash_Test )
+{
+    // [Preparation]
+    const QVector3 VECTOR_A(SQFloat::_1, SQFloat::_2, SQFloat::_3);
+    const QVector3 VECTOR_B(SQFloat::_1, SQFloat::_2, SQFloat::_3);
+    const QVector3 VECTOR_C(SQFloat::_1, SQFloat::_3, SQFloat::_2);
+
+    // [Execution]
+    u64_q uHashA = SQFastVectorHashProvider::GenerateHash(VECTOR_A);
+    u64_q uHashB = SQFastVectorHashProvider::GenerateHash(VECTOR_B);
+    u64_q uHashC = SQFastVectorHashProvider::GenerateHash(VECTOR_C);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHashA, uHashB);
+    BOOST_CHECK(uHashA != uHashC);
+}
+
+/// <summary>
+/// Checks that equal vectors produce the same hash and different vectors produce different hashes.
+/// </summary>
+QTEST_CASE ( GenerateHash3_EqualVectorsProduceSameHash_Test )
+{
+    // [Preparation]
+    const QVector4 VECTOR_A(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4);
+    const QVector4 VECTOR_B(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_4);
+    const QVector4 VECTOR_C(SQFloat::_1, SQFloat::_2, SQFloat::_3, SQFloat::_5);
+
+    // [Execution]
+    u64_q uHashA = SQFastVectorHashProvider::GenerateHash(VECTOR_A);
+    u64_q uHashB = SQFastVectorHashProvider::GenerateHash(VECTOR_B);
+    u64_q uHashC = SQFastVectorHashProvider::GenerateHash(VECTOR_C);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHashA, uHashB);
+    BOOST_CHECK(uHashA != uHashC);
+}
+
+/// <summary>
+/// Checks that zero and negative zero produce the same hash.
+/// </summary>
+QTEST_CASE ( GenerateHash2_ZeroAndNegativeZeroProduceSameHash_Test )
+{
+    // [Preparation]
+    const QVector3 VECTOR_A(SQFloat::_0, SQFloat::_1, SQFloat::_0);
+    const QVector3 VECTOR_B(-SQFloat::_0, SQFloat::_1, -SQFloat::_0);
+
+    // [Execution]
+    u64_q uHashA = SQFastVectorHashProvider::GenerateHash(VECTOR_A);
+    u64_q uHashB = SQFastVectorHashProvider::GenerateHash(VECTOR_B);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHashA, uHashB);
+}
+
+/// <summary>
+/// Checks that the hash key is the remainder of dividing the hash of the vector by the number of buckets.
+/// </summary>
+QTEST_CASE ( GenerateHashKey2_ItReturnsTheRemainderOfTheHashOfTheVector_Test )
+{
+    // [Preparation]
+    const QVector3 INPUT_VALUE(SQFloat::_1, SQFloat::_2, SQFloat::_3);
+    const pointer_uint_q NUMBER_OF_BUCKETS = 500U;
+    const pointer_uint_q EXPECTED_VALUE = scast_q(SQFastVectorHashProvider::GenerateHash(INPUT_VALUE) % NUMBER_OF_BUCKETS, pointer_uint_q);
+
+    // [Execution]
+    pointer_uint_q uHashKey = SQFastVectorHashProvider::GenerateHashKey(INPUT_VALUE, NUMBER_OF_BUCKETS);
+    
+    // [Verification]
+    BOOST_CHECK_EQUAL(uHashKey, EXPECTED_VALUE);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the number of buckets is zero.
+/// </summary>
+QTEST_CASE ( GenerateHashKey2_AssertionFailsWhenNumberOfBucketsIsZero_Test )
+{
+    // [Preparation]
+    const QVector3 INPUT_VALUE(SQFloat::_1, SQFloat::_2, SQFloat::_3);
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQFastVectorHashProvider::GenerateHashKey(INPUT_VALUE, 0);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+    
+    // [Verification]
+    BOOST_CHECK(bAssertionFailed);
+}
+
+#endif
+
+// End - Test Suite: SQFastVectorHashProvider
+QTEST_SUITE_END()
@@ -0,0 +1,91 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "DataTypesDefinitions.h"
+#include "SQGeometricGrowthPolicy.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::SQGeometricGrowthPolicy;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+
+
+QTEST_SUITE_BEGIN( SQGeometricGrowthPolicy_TestSuite )
+
+/// <summary>
+/// Checks that the new capacity is one and a half times the required capacity.
+/// </summary>
+QTEST_CASE ( GetNewCapacity_ReturnsOneAndAHalfTimesTheRequiredCapacity_Test )
+{
+    // [Preparation]
+    const pointer_uint_q REQUIRED_CAPACITY = 10U;
+    const pointer_uint_q EXPECTED_CAPACITY = 15U;
+
+    // [Execution]
+    pointer_uint_q uCapacity = SQGeometricGrowthPolicy::GetNewCapacity(REQUIRED_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the result is rounded down when the required capacity is odd.
+/// </summary>
+QTEST_CASE ( GetNewCapacity_ResultIsRoundedDownWhenRequiredCapacityIsOdd_Test )
+{
+    // [Preparation]
+    const pointer_uint_q REQUIRED_CAPACITY = 11U;
+    const pointer_uint_q EXPECTED_CAPACITY = 16U;
+
+    // [Execution]
+    pointer_uint_q uCapacity = SQGeometricGrowthPolicy::GetNewCapacity(REQUIRED_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the new capacity is never lower than the required capacity.
+/// </summary>
+QTEST_CASE ( GetNewCapacity_ReturnsRequiredCapacityWhenItIsOne_Test )
+{
+    // [Preparation]
+    const pointer_uint_q REQUIRED_CAPACITY = 1U;
+    const pointer_uint_q EXPECTED_CAPACITY = 1U;
+
+    // [Execution]
+    pointer_uint_q uCapacity = SQGeometricGrowthPolicy::GetNewCapacity(REQUIRED_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+// End - Test Suite: SQGeometricGrowthPolicy
+QTEST_SUITE_END()
@@ -0,0 +1,91 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "DataTypesDefinitions.h"
+#include "SQPowerOfTwoGrowthPolicy.h"
+
+using Kinesis::QuimeraEngine::Tools::Containers::SQPowerOfTwoGrowthPolicy;
+using Kinesis::QuimeraEngine::Common::DataTypes::pointer_uint_q;
+
+
+QTEST_SUITE_BEGIN( SQPowerOfTwoGrowthPolicy_TestSuite )
+
+/// <summary>
+/// Checks that the new capacity is the next power of two when the required capacity is not a power of two.
+/// </summary>
+QTEST_CASE ( GetNewCapacity_ReturnsNextPowerOfTwoWhenRequiredCapacityIsNotPowerOfTwo_Test )
+{
+    // [Preparation]
+    const pointer_uint_q REQUIRED_CAPACITY = 17U;
+    const pointer_uint_q EXPECTED_CAPACITY = 32U;
+
+    // [Execution]
+    pointer_uint_q uCapacity = SQPowerOfTwoGrowthPolicy::GetNewCapacity(REQUIRED_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the new capacity equals the required capacity when it is a power of two.
+/// </summary>
+QTEST_CASE ( GetNewCapacity_ReturnsRequiredCapacityWhenItIsPowerOfTwo_Test )
+{
+    // [Preparation]
+    const pointer_uint_q REQUIRED_CAPACITY = 16U;
+    const pointer_uint_q EXPECTED_CAPACITY = 16U;
+
+    // [Execution]
+    pointer_uint_q uCapacity = SQPowerOfTwoGrowthPolicy::GetNewCapacity(REQUIRED_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+/// <summary>
+/// Checks that the new capacity is one when the required capacity is one.
+/// </summary>
+QTEST_CASE ( GetNewCapacity_ReturnsOneWhenRequiredCapacityIsOne_Test )
+{
+    // [Preparation]
+    const pointer_uint_q REQUIRED_CAPACITY = 1U;
+    const pointer_uint_q EXPECTED_CAPACITY = 1U;
+
+    // [Execution]
+    pointer_uint_q uCapacity = SQPowerOfTwoGrowthPolicy::GetNewCapacity(REQUIRED_CAPACITY);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(uCapacity, EXPECTED_CAPACITY);
+}
+
+// End - Test Suite: SQPowerOfTwoGrowthPolicy
+QTEST_SUITE_END()
@@ -0,0 +1,478 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "SQSorter.h"
+
+#include "QAssertException.h"
+
+using Kinesis::QuimeraEngine::Common::Exceptions::QAssertException;
+using Kinesis::QuimeraEngine::Common::DataTypes::i8_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Tools::Containers::SQSorter;
+
+/// <summary>
+/// Element used to check that equal elements keep their relative order. Only the key is used when comparing elements.
+/// </summary>
+struct SQSorterTestElement
+{
+    u32_q m_uKey;
+    u32_q m_uOrder;
+};
+
+/// <summary>
+/// Comparator that only compares the key of the elements.
+/// </summary>
+class SQSorterTestComparator
+{
+public:
+
+    static i8_q Compare(const SQSorterTestElement &leftOperand, const SQSorterTestElement &rightOperand)
+    {
+        return leftOperand.m_uKey < rightOperand.m_uKey ? -1 : (leftOperand.m_uKey == rightOperand.m_uKey ? 0 : 1);
+    }
+};
+
+/// <summary>
+/// Fills a sequence with pseudo-random numbers using a linear congruential generator, so all the executions are equal.
+/// </summary>
+/// <param name="arElements">[OUT] The sequence to fill.</param>
+/// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+/// <param name="uMaximumValue">[IN] The values will be lower than this value.</param>
+static void SQSorter_Test_FillWithRandomNumbers(u32_q* arElements, const pointer_uint_q uNumberOfElements, const u32_q uMaximumValue)
+{
+    u32_q uRandom = 12345U;
+
+    for(pointer_uint_q i = 0; i < uNumberOfElements; ++i)
+    {
+        uRandom = uRandom * 1664525U + 1013904223U;
+        arElements[i] = (uRandom >> 8U) % uMaximumValue;
+    }
+}
+
+/// <summary>
+/// Checks whether a sequence of numbers is sorted in ascending order.
+/// </summary>
+/// <param name="arElements">[IN] The sequence to check.</param>
+/// <param name="uNumberOfElements">[IN] The number of elements in the sequence.</param>
+/// <returns>
+/// True if every element is lower than or equal to the next one; False otherwise.
+/// </returns>
+static bool SQSorter_Test_IsSorted(const u32_q* arElements, const pointer_uint_q uNumberOfElements)
+{
+    bool bIsSorted = true;
+
+    for(pointer_uint_q i = 1U; i < uNumberOfElements && bIsSorted; ++i)
+        bIsSorted = arElements[i - 1U] <= arElements[i];
+
+    return bIsSorted;
+}
+
+
+QTEST_SUITE_BEGIN( SQSorter_TestSuite )
+
+/// <summary>
+/// Checks that elements are sorted in ascending order.
+/// </summary>
+QTEST_CASE ( Sort_ElementsAreSortedInAscendingOrder_Test )
+{
+    // [Preparation]
+    u32_q arElements[] = { 5U, 3U, 8U, 1U, 9U, 2U, 7U, 4U, 6U, 0U };
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U };
+    const pointer_uint_q NUMBER_OF_ELEMENTS = sizeof(arElements) / sizeof(u32_q);
+
+    // [Execution]
+    SQSorter<u32_q>::Sort(arElements, NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arElements, arElements + NUMBER_OF_ELEMENTS, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + NUMBER_OF_ELEMENTS);
+}
+
+/// <summary>
+/// Checks that elements are sorted when the sequence is long enough to be partitioned.
+/// </summary>
+QTEST_CASE ( Sort_ElementsAreSortedWhenSequenceIsLong_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 10000U;
+    const bool EXPECTED_RESULT = true;
+    u32_q arElements[NUMBER_OF_ELEMENTS];
+    SQSorter_Test_FillWithRandomNumbers(arElements, NUMBER_OF_ELEMENTS, 1000000U);
+
+    // [Execution]
+    SQSorter<u32_q>::Sort(arElements, NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    bool bIsSorted = SQSorter_Test_IsSorted(arElements, NUMBER_OF_ELEMENTS);
+    BOOST_CHECK_EQUAL(bIsSorted, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that elements are sorted when most of them are equal.
+/// </summary>
+QTEST_CASE ( Sort_ElementsAreSortedWhenThereAreManyEqualElements_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 10000U;
+    const bool EXPECTED_RESULT = true;
+    u32_q arElements[NUMBER_OF_ELEMENTS];
+    SQSorter_Test_FillWithRandomNumbers(arElements, NUMBER_OF_ELEMENTS, 3U);
+
+    // [Execution]
+    SQSorter<u32_q>::Sort(arElements, NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    bool bIsSorted = SQSorter_Test_IsSorted(arElements, NUMBER_OF_ELEMENTS);
+    BOOST_CHECK_EQUAL(bIsSorted, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that elements are sorted when they were sorted in descending order.
+/// </summary>
+QTEST_CASE ( Sort_ElementsAreSortedWhenTheyAreInDescendingOrder_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 10000U;
+    const bool EXPECTED_RESULT = true;
+    u32_q arElements[NUMBER_OF_ELEMENTS];
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+        arElements[i] = scast_q(NUMBER_OF_ELEMENTS - i, u32_q);
+
+    // [Execution]
+    SQSorter<u32_q>::Sort(arElements, NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    bool bIsSorted = SQSorter_Test_IsSorted(arElements, NUMBER_OF_ELEMENTS);
+    BOOST_CHECK_EQUAL(bIsSorted, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that nothing happens when the sequence is empty.
+/// </summary>
+QTEST_CASE ( Sort_NothingHappensWhenThereAreNoElements_Test )
+{
+    // [Preparation]
+    u32_q arElements[] = { 2U, 1U };
+    const u32_q EXPECTED_ELEMENTS[] = { 2U, 1U };
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 0;
+
+    // [Execution]
+    SQSorter<u32_q>::Sort(arElements, NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arElements, arElements + 2U, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + 2U);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the input sequence is null.
+/// </summary>
+QTEST_CASE ( Sort_AssertionFailsWhenInputSequenceIsNull_Test )
+{
+    // [Preparation]
+    u32_q* NULL_SEQUENCE = null_q;
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 2U;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQSorter<u32_q>::Sort(NULL_SEQUENCE, NUMBER_OF_ELEMENTS);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that elements are sorted when the sequence is long enough to be merged.
+/// </summary>
+QTEST_CASE ( StableSort_ElementsAreSortedWhenSequenceIsLong_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 10000U;
+    const bool EXPECTED_RESULT = true;
+    u32_q arElements[NUMBER_OF_ELEMENTS];
+    SQSorter_Test_FillWithRandomNumbers(arElements, NUMBER_OF_ELEMENTS, 1000000U);
+
+    // [Execution]
+    SQSorter<u32_q>::StableSort(arElements, NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    bool bIsSorted = SQSorter_Test_IsSorted(arElements, NUMBER_OF_ELEMENTS);
+    BOOST_CHECK_EQUAL(bIsSorted, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that equal elements keep their relative order.
+/// </summary>
+QTEST_CASE ( StableSort_EqualElementsKeepTheirRelativeOrder_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 1000U;
+    const bool EXPECTED_RESULT = true;
+    u32_q arKeys[NUMBER_OF_ELEMENTS];
+    SQSorter_Test_FillWithRandomNumbers(arKeys, NUMBER_OF_ELEMENTS, 10U);
+
+    SQSorterTestElement arElements[NUMBER_OF_ELEMENTS];
+
+    for(pointer_uint_q i = 0; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        arElements[i].m_uKey = arKeys[i];
+        arElements[i].m_uOrder = scast_q(i, u32_q);
+    }
+
+    // [Execution]
+    SQSorter<SQSorterTestElement, SQSorterTestComparator>::StableSort(arElements, NUMBER_OF_ELEMENTS);
+
+    // [Verification]
+    bool bResultIsWhatEspected = true;
+
+    for(pointer_uint_q i = 1U; i < NUMBER_OF_ELEMENTS; ++i)
+    {
+        bResultIsWhatEspected = bResultIsWhatEspected && 
+                                (arElements[i - 1U].m_uKey < arElements[i].m_uKey || 
+                                 (arElements[i - 1U].m_uKey == arElements[i].m_uKey && arElements[i - 1U].m_uOrder < arElements[i].m_uOrder));
+    }
+
+    BOOST_CHECK_EQUAL(bResultIsWhatEspected, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that elements are sorted when the auxiliary buffer is provided and its capacity is half the number of elements.
+/// </summary>
+QTEST_CASE ( StableSort_ElementsAreSortedWhenBufferIsProvided_Test )
+{
+    // [Preparation]
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 10000U;
+    const bool EXPECTED_RESULT = true;
+    u32_q arElements[NUMBER_OF_ELEMENTS];
+    u32_q arBuffer[NUMBER_OF_ELEMENTS / 2U];
+    SQSorter_Test_FillWithRandomNumbers(arElements, NUMBER_OF_ELEMENTS, 1000000U);
+
+    // [Execution]
+    SQSorter<u32_q>::StableSort(arElements, NUMBER_OF_ELEMENTS, arBuffer);
+
+    // [Verification]
+    bool bIsSorted = SQSorter_Test_IsSorted(arElements, NUMBER_OF_ELEMENTS);
+    BOOST_CHECK_EQUAL(bIsSorted, EXPECTED_RESULT);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the provided auxiliary buffer is null.
+/// </summary>
+QTEST_CASE ( StableSort_AssertionFailsWhenBufferIsNull_Test )
+{
+    // [Preparation]
+    u32_q arElements[] = { 2U, 1U };
+    u32_q* NULL_BUFFER = null_q;
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 2U;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQSorter<u32_q>::StableSort(arElements, NUMBER_OF_ELEMENTS, NULL_BUFFER);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the input sequence is null.
+/// </summary>
+QTEST_CASE ( StableSort_AssertionFailsWhenInputSequenceIsNull_Test )
+{
+    // [Preparation]
+    u32_q* NULL_SEQUENCE = null_q;
+    const pointer_uint_q NUMBER_OF_ELEMENTS = 2U;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQSorter<u32_q>::StableSort(NULL_SEQUENCE, NUMBER_OF_ELEMENTS);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+/// <summary>
+/// Checks that two sorted sequences are merged into one sorted sequence.
+/// </summary>
+QTEST_CASE ( Merge_SequencesAreMerged_Test )
+{
+    // [Preparation]
+    u32_q arElements[] = { 1U, 4U, 5U, 9U, 0U, 2U, 3U, 6U, 7U, 8U };
+    const u32_q EXPECTED_ELEMENTS[] = { 0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U };
+    const pointer_uint_q NUMBER_OF_ELEMENTS = sizeof(arElements) / sizeof(u32_q);
+    const pointer_uint_q MIDDLE = 4U;
+    u32_q arBuffer[MIDDLE];
+
+    // [Execution]
+    SQSorter<u32_q>::Merge(arElements, MIDDLE, NUMBER_OF_ELEMENTS, arBuffer);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arElements, arElements + NUMBER_OF_ELEMENTS, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + NUMBER_OF_ELEMENTS);
+}
+
+/// <summary>
+/// Checks that, when two elements are equal, the one that belongs to the first sequence is placed first.
+/// </summary>
+QTEST_CASE ( Merge_EqualElementsOfTheFirstSequenceArePlacedFirst_Test )
+{
+    // [Preparation]
+    const u32_q EXPECTED_ORDERS[] = { 0U, 2U, 1U, 3U };
+    SQSorterTestElement arElements[4];
+    arElements[0].m_uKey = 1U; arElements[0].m_uOrder = 0U;
+    arElements[1].m_uKey = 2U; arElements[1].m_uOrder = 1U;
+    arElements[2].m_uKey = 1U; arElements[2].m_uOrder = 2U;
+    arElements[3].m_uKey = 2U; arElements[3].m_uOrder = 3U;
+    const pointer_uint_q MIDDLE = 2U;
+    SQSorterTestElement arBuffer[MIDDLE];
+
+    // [Execution]
+    SQSorter<SQSorterTestElement, SQSorterTestComparator>::Merge(arElements, MIDDLE, 4U, arBuffer);
+
+    // [Verification]
+    for(pointer_uint_q i = 0; i < 4U; ++i)
+        BOOST_CHECK_EQUAL(arElements[i].m_uOrder, EXPECTED_ORDERS[i]);
+}
+
+/// <summary>
+/// Checks that nothing happens when the first sequence is empty.
+/// </summary>
+QTEST_CASE ( Merge_NothingHappensWhenFirstSequenceIsEmpty_Test )
+{
+    // [Preparation]
+    u32_q arElements[] = { 1U, 2U, 3U };
+    const u32_q EXPECTED_ELEMENTS[] = { 1U, 2U, 3U };
+    const pointer_uint_q NUMBER_OF_ELEMENTS = sizeof(arElements) / sizeof(u32_q);
+    const pointer_uint_q MIDDLE = 0;
+    u32_q arBuffer[1];
+
+    // [Execution]
+    SQSorter<u32_q>::Merge(arElements, MIDDLE, NUMBER_OF_ELEMENTS, arBuffer);
+
+    // [Verification]
+    BOOST_CHECK_EQUAL_COLLECTIONS(arElements, arElements + NUMBER_OF_ELEMENTS, EXPECTED_ELEMENTS, EXPECTED_ELEMENTS + NUMBER_OF_ELEMENTS);
+}
+
+#if QE_CONFIG_ASSERTSBEHAVIOR_DEFAULT == QE_CONFIG_ASSERTSBEHAVIOR_THROWEXCEPTIONS
+
+/// <summary>
+/// Checks that an assertion fails when the middle position is greater than the number of elements.
+/// </summary>
+QTEST_CASE ( Merge_AssertionFailsWhenMiddleIsGreaterThanNumberOfElements_Test )
+{
+    // [Preparation]
+    u32_q arElements[] = { 1U, 2U, 3U };
+    const pointer_uint_q NUMBER_OF_ELEMENTS = sizeof(arElements) / sizeof(u32_q);
+    const pointer_uint_q MIDDLE = NUMBER_OF_ELEMENTS + 1U;
+    u32_q arBuffer[MIDDLE];
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQSorter<u32_q>::Merge(arElements, MIDDLE, NUMBER_OF_ELEMENTS, arBuffer);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+/// <summary>
+/// Checks that an assertion fails when the buffer is null.
+/// </summary>
+QTEST_CASE ( Merge_AssertionFailsWhenBufferIsNull_Test )
+{
+    // [Preparation]
+    u32_q arElements[] = { 2U, 1U };
+    const pointer_uint_q NUMBER_OF_ELEMENTS = sizeof(arElements) / sizeof(u32_q);
+    const pointer_uint_q MIDDLE = 1U;
+    u32_q* NULL_BUFFER = null_q;
+    const bool ASSERTION_FAILED = true;
+
+    // [Execution]
+    bool bAssertionFailed = false;
+
+    try
+    {
+        SQSorter<u32_q>::Merge(arElements, MIDDLE, NUMBER_OF_ELEMENTS, NULL_BUFFER);
+    }
+    catch(const QAssertException&)
+    {
+        bAssertionFailed = true;
+    }
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bAssertionFailed, ASSERTION_FAILED);
+}
+
+#endif
+
+// End - Test Suite: SQSorter
+QTEST_SUITE_END()
@@ -0,0 +1,150 @@
+//-------------------------------------------------------------------------------//
+//                         QUIMERA ENGINE : LICENSE                              //
+//-------------------------------------------------------------------------------//
+// This file is part of Quimera Engine.                                          //
+// Quimera Engine is free software: you can redistribute it and/or modify        //
+// it under the terms of the Lesser GNU General Public License as published by   //
+// the Free Software Foundation, either version 3 of the License, or             //
+// (at your option) any later version.                                           //
+//                                                                               //
+// Quimera Engine is distributed in the hope that it will be useful,             //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// Lesser GNU General Public License for more details.                           //
+//                                                                               //
+// You should have received a copy of the Lesser GNU General Public License      //
+// along with Quimera Engine. If not, see <http://www.gnu.org/licenses/>.        //
+//                                                                               //
+// This license doesn't force you to put any kind of banner or logo telling      //
+// that you are using Quimera Engine in your project but we would appreciate     //
+// if you do so or, at least, if you let us know about that.                     //
+//                                                                               //
+// Enjoy!                                                                        //
+//                                                                               //
+// Kinesis Team                                                                  //
+//-------------------------------------------------------------------------------//
+
+#include <boost/test/auto_unit_test.hpp>
+#include <boost/test/unit_test_log.hpp>
+using namespace boost::unit_test;
+
+#include "../../testsystem/TestingExternalDefinitions.h"
+
+#include "SQTypeTraits.h"
+
+#include "QVector3.h"
+#include "QMatrix4x4.h"
+#include "QQuaternion.h"
+#include "CallCounter.h"
+
+using Kinesis::QuimeraEngine::Common::DataTypes::u32_q;
+using Kinesis::QuimeraEngine::Common::DataTypes::f32_q;
+using Kinesis::QuimeraEngine::Tools::Math::QVector3;
+using Kinesis::QuimeraEngine::Tools::Math::QMatrix4x4;
+using Kinesis::QuimeraEngine::Tools::Math::QQuaternion;
+using Kinesis::QuimeraEngine::Tools::Containers::SQTypeTraits;
+using Kinesis::QuimeraEngine::Tools::Containers::Test::CallCounter;
+
+/// <summary>
+/// Plain structure with no user-defined special member functions.
+/// </summary>
+struct SQTypeTraitsTestPlainStructure
+{
+    u32_q m_uValue;
+    f32_q m_fValue;
+};
+
+
+QTEST_SUITE_BEGIN( SQTypeTraits_TestSuite )
+
+#if defined(QE_COMPILER_MSVC) || defined(QE_COMPILER_GCC)
+
+/// <summary>
+/// Checks that basic types are trivially copyable.
+/// </summary>
+QTEST_CASE ( IS_TRIVIALLY_COPYABLE_IsTrueForBasicTypes_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = true;
+
+    // [Execution]
+    bool bIsTriviallyCopyableU32 = SQTypeTraits<u32_q>::IS_TRIVIALLY_COPYABLE;
+    bool bIsTriviallyCopyableF32 = SQTypeTraits<f32_q>::IS_TRIVIALLY_COPYABLE;
+    bool bIsTriviallyCopyablePointer = SQTypeTraits<u32_q*>::IS_TRIVIALLY_COPYABLE;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bIsTriviallyCopyableU32, EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(bIsTriviallyCopyableF32, EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(bIsTriviallyCopyablePointer, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that structures without user-defined copy constructor, assignment operator and destructor are trivially copyable.
+/// </summary>
+QTEST_CASE ( IS_TRIVIALLY_COPYABLE_IsTrueForPlainStructures_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = true;
+
+    // [Execution]
+    bool bIsTriviallyCopyable = SQTypeTraits<SQTypeTraitsTestPlainStructure>::IS_TRIVIALLY_COPYABLE;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bIsTriviallyCopyable, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that types with user-defined copy constructor, assignment operator or destructor are not trivially copyable.
+/// </summary>
+QTEST_CASE ( IS_TRIVIALLY_COPYABLE_IsFalseForTypesWithUserDefinedCopyOperations_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = false;
+
+    // [Execution]
+    bool bIsTriviallyCopyable = SQTypeTraits<CallCounter>::IS_TRIVIALLY_COPYABLE;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bIsTriviallyCopyable, EXPECTED_RESULT);
+}
+
+/// <summary>
+/// Checks that types with user-defined destructor are not trivially destructible.
+/// </summary>
+QTEST_CASE ( IS_TRIVIALLY_DESTRUCTIBLE_IsFalseForTypesWithUserDefinedDestructor_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = false;
+
+    // [Execution]
+    bool bIsTriviallyDestructible = SQTypeTraits<CallCounter>::IS_TRIVIALLY_DESTRUCTIBLE;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bIsTriviallyDestructible, EXPECTED_RESULT);
+}
+
+#endif
+
+/// <summary>
+/// Checks that math types are trivially copyable and destructible.
+/// </summary>
+QTEST_CASE ( IS_TRIVIALLY_COPYABLE_IsTrueForMathTypes_Test )
+{
+    // [Preparation]
+    const bool EXPECTED_RESULT = true;
+
+    // [Execution]
+    bool bIsTriviallyCopyableVector = SQTypeTraits<QVector3>::IS_TRIVIALLY_COPYABLE;
+    bool bIsTriviallyCopyableMatrix = SQTypeTraits<QMatrix4x4>::IS_TRIVIALLY_COPYABLE;
+    bool bIsTriviallyCopyableQuaternion = SQTypeTraits<QQuaternion>::IS_TRIVIALLY_COPYABLE;
+    bool bIsTriviallyDestructibleVector = SQTypeTraits<QVector3>::IS_TRIVIALLY_DESTRUCTIBLE;
+
+    // [Verification]
+    BOOST_CHECK_EQUAL(bIsTriviallyCopyableVector, EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(bIsTriviallyCopyableMatrix, EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(bIsTriviallyCopyableQuaternion, EXPECTED_RESULT);
+    BOOST_CHECK_EQUAL(bIsTriviallyDestructibleVector, EXPECTED_RESULT);
+}
+
+// End - Test Suite: SQTypeTraits
+QTEST_SUITE_END()